@@ -17,6 +17,10 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// log.c keeps logged blocks in the cache until they have been
+// installed by holding an extra reference (bpin/bunpin), so a
+// buffer with refcnt > 0 is never recycled.
 
 #include "types.h"
 #include "defs.h"
@@ -76,8 +80,7 @@ bget(uint dev, uint blockno)
   }
 
   // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
+  // Buffers pinned by log.c have refcnt > 0 and are skipped.
   for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
     if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
       b->dev = dev;
@@ -139,6 +142,25 @@ brelse(struct buf *b)
   
   release(&bcache.lock);
 }
+
+// Pin b in the cache: take a reference that is not tied to
+// the buffer's sleep-lock, so b survives brelse() until bunpin().
+void
+bpin(struct buf *b)
+{
+  acquire(&bcache.lock);
+  b->refcnt++;
+  release(&bcache.lock);
+}
+
+void
+bunpin(struct buf *b)
+{
+  acquire(&bcache.lock);
+  if(b->refcnt < 1)
+    panic("bunpin");
+  b->refcnt--;
+  release(&bcache.lock);
+}
 //PAGEBREAK!
 // Blank page.
-
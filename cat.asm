@@ -0,0 +1,2120 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 47 03 00 00       	call   38e <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 4b 03 00 00       	call   3a6 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 8b 0f 00 00       	push   $0xf8b
+  6c:	6a 01                	push   $0x1
+  6e:	e8 ed 0c 00 00       	call   d60 <printf>
+      exit();
+  73:	e8 d8 02 00 00       	call   350 <exit>
+  }
+  exit();
+  78:	e8 d3 02 00 00       	call   350 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 c4 02 00 00       	call   350 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 00 20 00 00       	push   $0x2000
+  a9:	6a 01                	push   $0x1
+  ab:	e8 d6 02 00 00       	call   386 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 10 00 00       	push   $0x1000
+  bf:	68 00 20 00 00       	push   $0x2000
+  c4:	56                   	push   %esi
+  c5:	e8 b4 02 00 00       	call   37e <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 68 0f 00 00       	push   $0xf68
+  e4:	6a 01                	push   $0x1
+  e6:	e8 75 0c 00 00       	call   d60 <printf>
+      exit();
+  eb:	e8 60 02 00 00       	call   350 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 7a 0f 00 00       	push   $0xf7a
+  f7:	6a 01                	push   $0x1
+  f9:	e8 62 0c 00 00       	call   d60 <printf>
+    exit();
+  fe:	e8 4d 02 00 00       	call   350 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 31 01 00 00       	call   37e <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 04 01 00 00       	call   3a6 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 07 01 00 00       	call   3be <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 cd 00 00 00       	call   38e <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 356:	a1 00 30 00 00       	mov    0x3000,%eax
+ 35b:	85 c0                	test   %eax,%eax
+ 35d:	74 02                	je     361 <exit+0x11>
+    exithook();
+ 35f:	ff d0                	call   *%eax
+  _exit();
+ 361:	e8 10 01 00 00       	call   476 <_exit>
+
+00000366 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 366:	b8 01 00 00 00       	mov    $0x1,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <wait>:
+SYSCALL(wait)
+ 36e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <pipe>:
+SYSCALL(pipe)
+ 376:	b8 04 00 00 00       	mov    $0x4,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <read>:
+SYSCALL(read)
+ 37e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <write>:
+SYSCALL(write)
+ 386:	b8 10 00 00 00       	mov    $0x10,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <close>:
+SYSCALL(close)
+ 38e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <kill>:
+SYSCALL(kill)
+ 396:	b8 06 00 00 00       	mov    $0x6,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <exec>:
+SYSCALL(exec)
+ 39e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <open>:
+SYSCALL(open)
+ 3a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <mknod>:
+SYSCALL(mknod)
+ 3ae:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <unlink>:
+SYSCALL(unlink)
+ 3b6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <fstat>:
+SYSCALL(fstat)
+ 3be:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <link>:
+SYSCALL(link)
+ 3c6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <mkdir>:
+SYSCALL(mkdir)
+ 3ce:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <chdir>:
+SYSCALL(chdir)
+ 3d6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <dup>:
+SYSCALL(dup)
+ 3de:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <getpid>:
+SYSCALL(getpid)
+ 3e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <sbrk>:
+SYSCALL(sbrk)
+ 3ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <sleep>:
+SYSCALL(sleep)
+ 3f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <uptime>:
+SYSCALL(uptime)
+ 3fe:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 406:	b8 16 00 00 00       	mov    $0x16,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <sigaction>:
+SYSCALL(sigaction)
+ 40e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <sigret>:
+SYSCALL(sigret)
+ 416:	b8 18 00 00 00       	mov    $0x18,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <readv>:
+SYSCALL(readv)
+ 41e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <writev>:
+SYSCALL(writev)
+ 426:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <nanosleep>:
+SYSCALL(nanosleep)
+ 42e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <setpriority>:
+SYSCALL(setpriority)
+ 436:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <sched_setattr>:
+SYSCALL(sched_setattr)
+ 43e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <sched_yield>:
+SYSCALL(sched_yield)
+ 446:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 44e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 456:	b8 20 00 00 00       	mov    $0x20,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <getrusage>:
+SYSCALL(getrusage)
+ 45e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <syslat>:
+SYSCALL(syslat)
+ 466:	b8 22 00 00 00       	mov    $0x22,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <sched_getattr>:
+SYSCALL(sched_getattr)
+ 46e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 476:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 47b:	cd 40                	int    $0x40
+  ret
+ 47d:	c3                   	ret
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 485:	31 db                	xor    %ebx,%ebx
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 490:	8b 34 9d 20 30 00 00 	mov    0x3020(,%ebx,4),%esi
+ 497:	85 f6                	test   %esi,%esi
+ 499:	74 27                	je     4c2 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 49b:	8b 46 08             	mov    0x8(%esi),%eax
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 12                	jle    4b4 <flushall+0x34>
+ 4a2:	83 ec 04             	sub    $0x4,%esp
+ 4a5:	50                   	push   %eax
+ 4a6:	8d 46 10             	lea    0x10(%esi),%eax
+ 4a9:	50                   	push   %eax
+ 4aa:	ff 36                	push   (%esi)
+ 4ac:	e8 d5 fe ff ff       	call   386 <write>
+ 4b1:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 4b4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 4bb:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 4c2:	83 c3 01             	add    $0x1,%ebx
+ 4c5:	83 fb 10             	cmp    $0x10,%ebx
+ 4c8:	75 c6                	jne    490 <flushall+0x10>
+}
+ 4ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4cd:	5b                   	pop    %ebx
+ 4ce:	5e                   	pop    %esi
+ 4cf:	5d                   	pop    %ebp
+ 4d0:	c3                   	ret
+ 4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4e8:	89 d1                	mov    %edx,%ecx
+{
+ 4ea:	83 ec 2c             	sub    $0x2c,%esp
+ 4ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 4f0:	85 d2                	test   %edx,%edx
+ 4f2:	0f 89 c8 00 00 00    	jns    5c0 <printint+0xe0>
+ 4f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4fc:	0f 84 be 00 00 00    	je     5c0 <printint+0xe0>
+    x = -xx;
+ 502:	f7 d9                	neg    %ecx
+    neg = 1;
+ 504:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 509:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 50c:	31 f6                	xor    %esi,%esi
+ 50e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	31 d2                	xor    %edx,%edx
+ 514:	89 f7                	mov    %esi,%edi
+ 516:	f7 f3                	div    %ebx
+ 518:	8d 76 01             	lea    0x1(%esi),%esi
+ 51b:	0f b6 92 00 10 00 00 	movzbl 0x1000(%edx),%edx
+ 522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 526:	89 ca                	mov    %ecx,%edx
+ 528:	89 c1                	mov    %eax,%ecx
+ 52a:	39 da                	cmp    %ebx,%edx
+ 52c:	73 e2                	jae    510 <printint+0x30>
+  if(neg)
+ 52e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 07                	je     53c <printint+0x5c>
+    buf[i++] = '-';
+ 535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 53a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 53c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 53f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 542:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 544:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 547:	8b 41 08             	mov    0x8(%ecx),%eax
+ 54a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 54d:	89 ce                	mov    %ecx,%esi
+ 54f:	eb 28                	jmp    579 <printint+0x99>
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 558:	89 c1                	mov    %eax,%ecx
+ 55a:	83 c0 01             	add    $0x1,%eax
+ 55d:	89 46 08             	mov    %eax,0x8(%esi)
+ 560:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 564:	80 fa 0a             	cmp    $0xa,%dl
+ 567:	75 07                	jne    570 <printint+0x90>
+    f->nl = 1;
+ 569:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 570:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 573:	39 fb                	cmp    %edi,%ebx
+ 575:	74 39                	je     5b0 <printint+0xd0>
+ 577:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 579:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 57c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 581:	75 d5                	jne    558 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 583:	83 ec 04             	sub    $0x4,%esp
+ 586:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 589:	68 00 02 00 00       	push   $0x200
+ 58e:	ff 75 d0             	push   -0x30(%ebp)
+ 591:	ff 36                	push   (%esi)
+ 593:	e8 ee fd ff ff       	call   386 <write>
+  return r;
+ 598:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 59c:	83 c4 10             	add    $0x10,%esp
+ 59f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 5a1:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 5a8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ad:	eb ae                	jmp    55d <printint+0x7d>
+ 5af:	90                   	nop
+}
+ 5b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b3:	5b                   	pop    %ebx
+ 5b4:	5e                   	pop    %esi
+ 5b5:	5f                   	pop    %edi
+ 5b6:	5d                   	pop    %ebp
+ 5b7:	c3                   	ret
+ 5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+  neg = 0;
+ 5c0:	31 c0                	xor    %eax,%eax
+ 5c2:	e9 42 ff ff ff       	jmp    509 <printint+0x29>
+ 5c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <bputc>:
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	53                   	push   %ebx
+ 5d4:	89 c3                	mov    %eax,%ebx
+ 5d6:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 5d9:	8b 40 08             	mov    0x8(%eax),%eax
+ 5dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5e1:	74 1d                	je     600 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 5e3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5e6:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 5e9:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 5ed:	80 fa 0a             	cmp    $0xa,%dl
+ 5f0:	75 07                	jne    5f9 <bputc+0x29>
+    f->nl = 1;
+ 5f2:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 5f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5fc:	c9                   	leave
+ 5fd:	c3                   	ret
+ 5fe:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	8d 43 10             	lea    0x10(%ebx),%eax
+ 606:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 609:	68 00 02 00 00       	push   $0x200
+ 60e:	50                   	push   %eax
+ 60f:	ff 33                	push   (%ebx)
+ 611:	e8 70 fd ff ff       	call   386 <write>
+  return r;
+ 616:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 619:	83 c4 10             	add    $0x10,%esp
+ 61c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 621:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 628:	31 c0                	xor    %eax,%eax
+ 62a:	eb ba                	jmp    5e6 <bputc+0x16>
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 1c             	sub    $0x1c,%esp
+ 639:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 63c:	0f b6 0a             	movzbl (%edx),%ecx
+ 63f:	84 c9                	test   %cl,%cl
+ 641:	74 47                	je     68a <vfprintf+0x5a>
+ 643:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 646:	89 c7                	mov    %eax,%edi
+ 648:	31 d2                	xor    %edx,%edx
+ 64a:	89 de                	mov    %ebx,%esi
+ 64c:	89 cb                	mov    %ecx,%ebx
+ 64e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 650:	0f be cb             	movsbl %bl,%ecx
+ 653:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 656:	85 d2                	test   %edx,%edx
+ 658:	75 4e                	jne    6a8 <vfprintf+0x78>
+      if(c == '%'){
+ 65a:	83 f8 25             	cmp    $0x25,%eax
+ 65d:	74 69                	je     6c8 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 65f:	8b 47 08             	mov    0x8(%edi),%eax
+ 662:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 667:	0f 84 73 01 00 00    	je     7e0 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 66d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 670:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 673:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 677:	80 fb 0a             	cmp    $0xa,%bl
+ 67a:	74 1c                	je     698 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 680:	0f b6 1e             	movzbl (%esi),%ebx
+ 683:	83 c6 01             	add    $0x1,%esi
+ 686:	84 db                	test   %bl,%bl
+ 688:	75 c6                	jne    650 <vfprintf+0x20>
+    }
+  }
+}
+ 68a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 68d:	5b                   	pop    %ebx
+ 68e:	5e                   	pop    %esi
+ 68f:	5f                   	pop    %edi
+ 690:	5d                   	pop    %ebp
+ 691:	c3                   	ret
+ 692:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 698:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 69f:	eb df                	jmp    680 <vfprintf+0x50>
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 6a8:	83 fa 25             	cmp    $0x25,%edx
+ 6ab:	75 d3                	jne    680 <vfprintf+0x50>
+      if(c == 'd'){
+ 6ad:	83 f8 25             	cmp    $0x25,%eax
+ 6b0:	74 37                	je     6e9 <vfprintf+0xb9>
+ 6b2:	83 e8 63             	sub    $0x63,%eax
+ 6b5:	83 f8 15             	cmp    $0x15,%eax
+ 6b8:	77 16                	ja     6d0 <vfprintf+0xa0>
+ 6ba:	ff 24 85 a8 0f 00 00 	jmp    *0xfa8(,%eax,4)
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 6c8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6cd:	eb b1                	jmp    680 <vfprintf+0x50>
+ 6cf:	90                   	nop
+  if(f->n == BUFSIZ)
+ 6d0:	8b 47 08             	mov    0x8(%edi),%eax
+ 6d3:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6d8:	0f 84 4c 01 00 00    	je     82a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 6de:	8d 50 01             	lea    0x1(%eax),%edx
+ 6e1:	89 57 08             	mov    %edx,0x8(%edi)
+ 6e4:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 6e9:	89 ca                	mov    %ecx,%edx
+ 6eb:	89 f8                	mov    %edi,%eax
+ 6ed:	e8 de fe ff ff       	call   5d0 <bputc>
+ 6f2:	eb 88                	jmp    67c <vfprintf+0x4c>
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 6f8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 6fb:	83 ec 0c             	sub    $0xc,%esp
+ 6fe:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 703:	8b 13                	mov    (%ebx),%edx
+ 705:	6a 00                	push   $0x0
+ 707:	89 f8                	mov    %edi,%eax
+        ap++;
+ 709:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 70c:	e8 cf fd ff ff       	call   4e0 <printint>
+        ap++;
+ 711:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 714:	83 c4 10             	add    $0x10,%esp
+ 717:	e9 60 ff ff ff       	jmp    67c <vfprintf+0x4c>
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 720:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 723:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 72b:	85 d2                	test   %edx,%edx
+ 72d:	0f 84 dd 00 00 00    	je     810 <vfprintf+0x1e0>
+        while(*s != 0){
+ 733:	0f b6 1a             	movzbl (%edx),%ebx
+ 736:	84 db                	test   %bl,%bl
+ 738:	0f 84 3e ff ff ff    	je     67c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 73e:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 741:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 744:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 747:	89 fe                	mov    %edi,%esi
+ 749:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 74c:	89 d7                	mov    %edx,%edi
+ 74e:	eb 27                	jmp    777 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 750:	89 c1                	mov    %eax,%ecx
+ 752:	83 c0 01             	add    $0x1,%eax
+ 755:	89 46 08             	mov    %eax,0x8(%esi)
+ 758:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 75c:	80 fb 0a             	cmp    $0xa,%bl
+ 75f:	75 07                	jne    768 <vfprintf+0x138>
+    f->nl = 1;
+ 761:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 768:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 76c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 76f:	84 db                	test   %bl,%bl
+ 771:	0f 84 a9 00 00 00    	je     820 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 777:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 77c:	75 d2                	jne    750 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 77e:	83 ec 04             	sub    $0x4,%esp
+ 781:	68 00 02 00 00       	push   $0x200
+ 786:	ff 75 e0             	push   -0x20(%ebp)
+ 789:	ff 36                	push   (%esi)
+ 78b:	e8 f6 fb ff ff       	call   386 <write>
+  return r;
+ 790:	83 c4 10             	add    $0x10,%esp
+ 793:	b8 01 00 00 00       	mov    $0x1,%eax
+ 798:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 79a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 7a1:	eb b2                	jmp    755 <vfprintf+0x125>
+ 7a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7a7:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 7a8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 7ab:	83 ec 0c             	sub    $0xc,%esp
+ 7ae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7b3:	8b 13                	mov    (%ebx),%edx
+ 7b5:	6a 01                	push   $0x1
+ 7b7:	e9 4b ff ff ff       	jmp    707 <vfprintf+0xd7>
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 7c0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 7c3:	89 f8                	mov    %edi,%eax
+ 7c5:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 7c8:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 7cb:	e8 00 fe ff ff       	call   5d0 <bputc>
+        ap++;
+ 7d0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 7d3:	31 d2                	xor    %edx,%edx
+ 7d5:	e9 a6 fe ff ff       	jmp    680 <vfprintf+0x50>
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	8d 47 10             	lea    0x10(%edi),%eax
+ 7e6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 7e9:	68 00 02 00 00       	push   $0x200
+ 7ee:	50                   	push   %eax
+ 7ef:	ff 37                	push   (%edi)
+ 7f1:	e8 90 fb ff ff       	call   386 <write>
+  return r;
+ 7f6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 7f9:	83 c4 10             	add    $0x10,%esp
+ 7fc:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 7fe:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 805:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 80a:	e9 61 fe ff ff       	jmp    670 <vfprintf+0x40>
+ 80f:	90                   	nop
+          s = "(null)";
+ 810:	ba a0 0f 00 00       	mov    $0xfa0,%edx
+ 815:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 81a:	e9 1f ff ff ff       	jmp    73e <vfprintf+0x10e>
+ 81f:	90                   	nop
+ 820:	89 f7                	mov    %esi,%edi
+ 822:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 825:	e9 52 fe ff ff       	jmp    67c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 82a:	83 ec 04             	sub    $0x4,%esp
+ 82d:	8d 47 10             	lea    0x10(%edi),%eax
+ 830:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 833:	68 00 02 00 00       	push   $0x200
+ 838:	50                   	push   %eax
+ 839:	ff 37                	push   (%edi)
+ 83b:	e8 46 fb ff ff       	call   386 <write>
+  return r;
+ 840:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 843:	83 c4 10             	add    $0x10,%esp
+ 846:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 84b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 852:	31 c0                	xor    %eax,%eax
+ 854:	e9 88 fe ff ff       	jmp    6e1 <vfprintf+0xb1>
+ 859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <fdopen>:
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	56                   	push   %esi
+ 864:	53                   	push   %ebx
+ 865:	83 ec 20             	sub    $0x20,%esp
+ 868:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 86b:	83 fe 0f             	cmp    $0xf,%esi
+ 86e:	0f 87 84 00 00 00    	ja     8f8 <fdopen+0x98>
+  if(streams[fd])
+ 874:	8b 1c b5 20 30 00 00 	mov    0x3020(,%esi,4),%ebx
+ 87b:	85 db                	test   %ebx,%ebx
+ 87d:	74 11                	je     890 <fdopen+0x30>
+}
+ 87f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 882:	89 d8                	mov    %ebx,%eax
+ 884:	5b                   	pop    %ebx
+ 885:	5e                   	pop    %esi
+ 886:	5d                   	pop    %ebp
+ 887:	c3                   	ret
+ 888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 890:	83 ec 0c             	sub    $0xc,%esp
+ 893:	68 10 02 00 00       	push   $0x210
+ 898:	e8 e3 05 00 00       	call   e80 <malloc>
+ 89d:	83 c4 10             	add    $0x10,%esp
+ 8a0:	89 c3                	mov    %eax,%ebx
+ 8a2:	85 c0                	test   %eax,%eax
+ 8a4:	74 52                	je     8f8 <fdopen+0x98>
+  f->fd = fd;
+ 8a6:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 8a8:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 8ab:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 8b2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 8b9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 8c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 8c3:	50                   	push   %eax
+ 8c4:	56                   	push   %esi
+ 8c5:	e8 f4 fa ff ff       	call   3be <fstat>
+ 8ca:	83 c4 10             	add    $0x10,%esp
+ 8cd:	85 c0                	test   %eax,%eax
+ 8cf:	75 07                	jne    8d8 <fdopen+0x78>
+ 8d1:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 8d6:	74 30                	je     908 <fdopen+0xa8>
+  streams[fd] = f;
+ 8d8:	89 1c b5 20 30 00 00 	mov    %ebx,0x3020(,%esi,4)
+}
+ 8df:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 8e1:	c7 05 00 30 00 00 80 	movl   $0x480,0x3000
+ 8e8:	04 00 00 
+}
+ 8eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8ee:	5b                   	pop    %ebx
+ 8ef:	5e                   	pop    %esi
+ 8f0:	5d                   	pop    %ebp
+ 8f1:	c3                   	ret
+ 8f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 8fb:	31 db                	xor    %ebx,%ebx
+}
+ 8fd:	89 d8                	mov    %ebx,%eax
+ 8ff:	5b                   	pop    %ebx
+ 900:	5e                   	pop    %esi
+ 901:	5d                   	pop    %ebp
+ 902:	c3                   	ret
+ 903:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 907:	90                   	nop
+    f->mode = _IOLBF;
+ 908:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 90f:	eb c7                	jmp    8d8 <fdopen+0x78>
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+
+00000920 <fopen>:
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	53                   	push   %ebx
+ 924:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 927:	ff 75 0c             	push   0xc(%ebp)
+ 92a:	ff 75 08             	push   0x8(%ebp)
+ 92d:	e8 74 fa ff ff       	call   3a6 <open>
+ 932:	83 c4 10             	add    $0x10,%esp
+ 935:	85 c0                	test   %eax,%eax
+ 937:	78 37                	js     970 <fopen+0x50>
+ 939:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 93b:	8b 04 85 20 30 00 00 	mov    0x3020(,%eax,4),%eax
+ 942:	85 c0                	test   %eax,%eax
+ 944:	74 17                	je     95d <fopen+0x3d>
+    free(streams[fd]);
+ 946:	83 ec 0c             	sub    $0xc,%esp
+ 949:	50                   	push   %eax
+ 94a:	e8 a1 04 00 00       	call   df0 <free>
+    streams[fd] = 0;
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	c7 04 9d 20 30 00 00 	movl   $0x0,0x3020(,%ebx,4)
+ 959:	00 00 00 00 
+  return fdopen(fd);
+ 95d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 963:	c9                   	leave
+  return fdopen(fd);
+ 964:	e9 f7 fe ff ff       	jmp    860 <fdopen>
+ 969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 973:	31 c0                	xor    %eax,%eax
+ 975:	c9                   	leave
+ 976:	c3                   	ret
+ 977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97e:	66 90                	xchg   %ax,%ax
+
+00000980 <setvbuf>:
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	56                   	push   %esi
+ 984:	53                   	push   %ebx
+ 985:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 988:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 98b:	83 fe 02             	cmp    $0x2,%esi
+ 98e:	77 38                	ja     9c8 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 990:	8b 43 08             	mov    0x8(%ebx),%eax
+ 993:	85 c0                	test   %eax,%eax
+ 995:	7e 12                	jle    9a9 <setvbuf+0x29>
+ 997:	83 ec 04             	sub    $0x4,%esp
+ 99a:	50                   	push   %eax
+ 99b:	8d 43 10             	lea    0x10(%ebx),%eax
+ 99e:	50                   	push   %eax
+ 99f:	ff 33                	push   (%ebx)
+ 9a1:	e8 e0 f9 ff ff       	call   386 <write>
+ 9a6:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 9a9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 9b0:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 9b2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 9b9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 9bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9bf:	5b                   	pop    %ebx
+ 9c0:	5e                   	pop    %esi
+ 9c1:	5d                   	pop    %ebp
+ 9c2:	c3                   	ret
+ 9c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9c7:	90                   	nop
+    return -1;
+ 9c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9cd:	eb ed                	jmp    9bc <setvbuf+0x3c>
+ 9cf:	90                   	nop
+
+000009d0 <fflush>:
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	31 c0                	xor    %eax,%eax
+ 9d3:	89 e5                	mov    %esp,%ebp
+ 9d5:	53                   	push   %ebx
+ 9d6:	83 ec 04             	sub    $0x4,%esp
+ 9d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 9dc:	8b 53 08             	mov    0x8(%ebx),%edx
+ 9df:	85 d2                	test   %edx,%edx
+ 9e1:	7e 1d                	jle    a00 <fflush+0x30>
+ 9e3:	83 ec 04             	sub    $0x4,%esp
+ 9e6:	8d 43 10             	lea    0x10(%ebx),%eax
+ 9e9:	52                   	push   %edx
+ 9ea:	50                   	push   %eax
+ 9eb:	ff 33                	push   (%ebx)
+ 9ed:	e8 94 f9 ff ff       	call   386 <write>
+ 9f2:	83 c4 10             	add    $0x10,%esp
+ 9f5:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 9f8:	0f 95 c0             	setne  %al
+ 9fb:	0f b6 c0             	movzbl %al,%eax
+ 9fe:	f7 d8                	neg    %eax
+  f->n = 0;
+ a00:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a07:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a11:	c9                   	leave
+ a12:	c3                   	ret
+ a13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a20 <fclose>:
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	56                   	push   %esi
+ a24:	31 f6                	xor    %esi,%esi
+ a26:	53                   	push   %ebx
+ a27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a2a:	8b 43 08             	mov    0x8(%ebx),%eax
+ a2d:	85 c0                	test   %eax,%eax
+ a2f:	7e 1f                	jle    a50 <fclose+0x30>
+ a31:	83 ec 04             	sub    $0x4,%esp
+ a34:	50                   	push   %eax
+ a35:	8d 43 10             	lea    0x10(%ebx),%eax
+ a38:	50                   	push   %eax
+ a39:	ff 33                	push   (%ebx)
+ a3b:	e8 46 f9 ff ff       	call   386 <write>
+ a40:	83 c4 10             	add    $0x10,%esp
+ a43:	39 43 08             	cmp    %eax,0x8(%ebx)
+ a46:	0f 95 c0             	setne  %al
+ a49:	0f b6 c0             	movzbl %al,%eax
+ a4c:	f7 d8                	neg    %eax
+ a4e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ a50:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ a53:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a5a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ a61:	ff 33                	push   (%ebx)
+ a63:	e8 26 f9 ff ff       	call   38e <close>
+ a68:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ a6b:	85 c0                	test   %eax,%eax
+ a6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a72:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ a75:	8b 03                	mov    (%ebx),%eax
+ a77:	83 f8 0f             	cmp    $0xf,%eax
+ a7a:	77 09                	ja     a85 <fclose+0x65>
+ a7c:	39 1c 85 20 30 00 00 	cmp    %ebx,0x3020(,%eax,4)
+ a83:	74 0b                	je     a90 <fclose+0x70>
+}
+ a85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a88:	89 f0                	mov    %esi,%eax
+ a8a:	5b                   	pop    %ebx
+ a8b:	5e                   	pop    %esi
+ a8c:	5d                   	pop    %ebp
+ a8d:	c3                   	ret
+ a8e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ a90:	c7 04 85 20 30 00 00 	movl   $0x0,0x3020(,%eax,4)
+ a97:	00 00 00 00 
+    free(f);
+ a9b:	83 ec 0c             	sub    $0xc,%esp
+ a9e:	53                   	push   %ebx
+ a9f:	e8 4c 03 00 00       	call   df0 <free>
+ aa4:	83 c4 10             	add    $0x10,%esp
+  return r;
+ aa7:	eb dc                	jmp    a85 <fclose+0x65>
+ aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ab0 <fputc>:
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	53                   	push   %ebx
+ ab4:	83 ec 04             	sub    $0x4,%esp
+ ab7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ aba:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ abd:	8b 43 08             	mov    0x8(%ebx),%eax
+ ac0:	3d 00 02 00 00       	cmp    $0x200,%eax
+ ac5:	74 59                	je     b20 <fputc+0x70>
+  f->buf[f->n++] = c;
+ ac7:	8d 48 01             	lea    0x1(%eax),%ecx
+ aca:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ acd:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ ad1:	80 fa 0a             	cmp    $0xa,%dl
+ ad4:	75 07                	jne    add <fputc+0x2d>
+    f->nl = 1;
+ ad6:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ add:	8b 43 04             	mov    0x4(%ebx),%eax
+ ae0:	83 f8 02             	cmp    $0x2,%eax
+ ae3:	74 1a                	je     aff <fputc+0x4f>
+ ae5:	83 f8 01             	cmp    $0x1,%eax
+ ae8:	74 0e                	je     af8 <fputc+0x48>
+}
+ aea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ aed:	0f b6 c2             	movzbl %dl,%eax
+}
+ af0:	c9                   	leave
+ af1:	c3                   	ret
+ af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ af8:	8b 43 0c             	mov    0xc(%ebx),%eax
+ afb:	85 c0                	test   %eax,%eax
+ afd:	74 eb                	je     aea <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ aff:	85 c9                	test   %ecx,%ecx
+ b01:	7f 4d                	jg     b50 <fputc+0xa0>
+  f->n = 0;
+ b03:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ b0a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ b11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ b14:	0f b6 c2             	movzbl %dl,%eax
+}
+ b17:	c9                   	leave
+ b18:	c3                   	ret
+ b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b20:	83 ec 04             	sub    $0x4,%esp
+ b23:	8d 43 10             	lea    0x10(%ebx),%eax
+ b26:	89 55 08             	mov    %edx,0x8(%ebp)
+ b29:	68 00 02 00 00       	push   $0x200
+ b2e:	50                   	push   %eax
+ b2f:	ff 33                	push   (%ebx)
+ b31:	e8 50 f8 ff ff       	call   386 <write>
+  return r;
+ b36:	8b 55 08             	mov    0x8(%ebp),%edx
+ b39:	83 c4 10             	add    $0x10,%esp
+ b3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ b41:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ b48:	31 c0                	xor    %eax,%eax
+ b4a:	e9 7b ff ff ff       	jmp    aca <fputc+0x1a>
+ b4f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b50:	83 ec 04             	sub    $0x4,%esp
+ b53:	8d 43 10             	lea    0x10(%ebx),%eax
+ b56:	89 55 08             	mov    %edx,0x8(%ebp)
+ b59:	51                   	push   %ecx
+ b5a:	50                   	push   %eax
+ b5b:	ff 33                	push   (%ebx)
+ b5d:	e8 24 f8 ff ff       	call   386 <write>
+  f->n = 0;
+ b62:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ b6c:	83 c4 10             	add    $0x10,%esp
+ b6f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ b76:	eb 99                	jmp    b11 <fputc+0x61>
+ b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+
+00000b80 <fwrite>:
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	83 ec 1c             	sub    $0x1c,%esp
+ b89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ b8c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ b8f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ b92:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ b95:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ b9b:	0f 8f af 00 00 00    	jg     c50 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ ba1:	85 ff                	test   %edi,%edi
+ ba3:	7e 73                	jle    c18 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ ba5:	8d 56 10             	lea    0x10(%esi),%edx
+ ba8:	8b 46 08             	mov    0x8(%esi),%eax
+ bab:	31 db                	xor    %ebx,%ebx
+ bad:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ bb0:	eb 25                	jmp    bd7 <fwrite+0x57>
+ bb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ bb8:	89 c1                	mov    %eax,%ecx
+ bba:	83 c0 01             	add    $0x1,%eax
+ bbd:	89 46 08             	mov    %eax,0x8(%esi)
+ bc0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ bc4:	80 fa 0a             	cmp    $0xa,%dl
+ bc7:	75 07                	jne    bd0 <fwrite+0x50>
+    f->nl = 1;
+ bc9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ bd0:	83 c3 01             	add    $0x1,%ebx
+ bd3:	39 df                	cmp    %ebx,%edi
+ bd5:	7e 41                	jle    c18 <fwrite+0x98>
+    bputc(f, s[i]);
+ bd7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ bda:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ bde:	3d 00 02 00 00       	cmp    $0x200,%eax
+ be3:	75 d3                	jne    bb8 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ be5:	83 ec 04             	sub    $0x4,%esp
+ be8:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ beb:	68 00 02 00 00       	push   $0x200
+ bf0:	ff 75 e0             	push   -0x20(%ebp)
+ bf3:	ff 36                	push   (%esi)
+ bf5:	e8 8c f7 ff ff       	call   386 <write>
+  return r;
+ bfa:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ bfe:	83 c4 10             	add    $0x10,%esp
+ c01:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ c03:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ c0a:	b8 01 00 00 00       	mov    $0x1,%eax
+ c0f:	eb ac                	jmp    bbd <fwrite+0x3d>
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c18:	8b 46 04             	mov    0x4(%esi),%eax
+ c1b:	83 f8 02             	cmp    $0x2,%eax
+ c1e:	74 0c                	je     c2c <fwrite+0xac>
+ c20:	83 f8 01             	cmp    $0x1,%eax
+ c23:	75 1c                	jne    c41 <fwrite+0xc1>
+ c25:	8b 46 0c             	mov    0xc(%esi),%eax
+ c28:	85 c0                	test   %eax,%eax
+ c2a:	74 15                	je     c41 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c2c:	8b 46 08             	mov    0x8(%esi),%eax
+ c2f:	85 c0                	test   %eax,%eax
+ c31:	7f 5d                	jg     c90 <fwrite+0x110>
+  f->n = 0;
+ c33:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c3a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ c41:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c47:	5b                   	pop    %ebx
+ c48:	5e                   	pop    %esi
+ c49:	5f                   	pop    %edi
+ c4a:	5d                   	pop    %ebp
+ c4b:	c3                   	ret
+ c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ c50:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ c54:	0f 84 4b ff ff ff    	je     ba5 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c5a:	8b 46 08             	mov    0x8(%esi),%eax
+ c5d:	8b 16                	mov    (%esi),%edx
+ c5f:	85 c0                	test   %eax,%eax
+ c61:	7f 45                	jg     ca8 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ c63:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ c66:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c6d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ c74:	57                   	push   %edi
+ c75:	ff 75 08             	push   0x8(%ebp)
+ c78:	ff 36                	push   (%esi)
+ c7a:	e8 07 f7 ff ff       	call   386 <write>
+    return size > 0 ? i / size : 0;
+ c7f:	83 c4 10             	add    $0x10,%esp
+ c82:	85 c0                	test   %eax,%eax
+ c84:	78 4a                	js     cd0 <fwrite+0x150>
+ c86:	85 db                	test   %ebx,%ebx
+ c88:	7e 46                	jle    cd0 <fwrite+0x150>
+ c8a:	99                   	cltd
+ c8b:	f7 fb                	idiv   %ebx
+ c8d:	eb b5                	jmp    c44 <fwrite+0xc4>
+ c8f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c90:	83 ec 04             	sub    $0x4,%esp
+ c93:	50                   	push   %eax
+ c94:	8d 46 10             	lea    0x10(%esi),%eax
+ c97:	50                   	push   %eax
+ c98:	ff 36                	push   (%esi)
+ c9a:	e8 e7 f6 ff ff       	call   386 <write>
+ c9f:	83 c4 10             	add    $0x10,%esp
+ ca2:	eb 8f                	jmp    c33 <fwrite+0xb3>
+ ca4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ca8:	83 ec 04             	sub    $0x4,%esp
+ cab:	50                   	push   %eax
+ cac:	8d 46 10             	lea    0x10(%esi),%eax
+ caf:	50                   	push   %eax
+ cb0:	52                   	push   %edx
+ cb1:	e8 d0 f6 ff ff       	call   386 <write>
+ cb6:	83 c4 10             	add    $0x10,%esp
+ cb9:	3b 46 08             	cmp    0x8(%esi),%eax
+ cbc:	74 a5                	je     c63 <fwrite+0xe3>
+  f->n = 0;
+ cbe:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ cc5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ cd0:	31 c0                	xor    %eax,%eax
+ cd2:	e9 6d ff ff ff       	jmp    c44 <fwrite+0xc4>
+ cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cde:	66 90                	xchg   %ax,%ax
+
+00000ce0 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ ce4:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ ce7:	83 ec 04             	sub    $0x4,%esp
+ cea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ ced:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cf0:	89 d8                	mov    %ebx,%eax
+ cf2:	e8 39 f9 ff ff       	call   630 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ cf7:	8b 43 04             	mov    0x4(%ebx),%eax
+ cfa:	83 f8 02             	cmp    $0x2,%eax
+ cfd:	74 18                	je     d17 <fprintf+0x37>
+ cff:	83 f8 01             	cmp    $0x1,%eax
+ d02:	74 0c                	je     d10 <fprintf+0x30>
+  settle(f);
+}
+ d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d07:	c9                   	leave
+ d08:	c3                   	ret
+ d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ d10:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d13:	85 c0                	test   %eax,%eax
+ d15:	74 ed                	je     d04 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d17:	8b 43 08             	mov    0x8(%ebx),%eax
+ d1a:	85 c0                	test   %eax,%eax
+ d1c:	7f 1a                	jg     d38 <fprintf+0x58>
+  f->n = 0;
+ d1e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d25:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ d2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d2f:	c9                   	leave
+ d30:	c3                   	ret
+ d31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d38:	83 ec 04             	sub    $0x4,%esp
+ d3b:	50                   	push   %eax
+ d3c:	8d 43 10             	lea    0x10(%ebx),%eax
+ d3f:	50                   	push   %eax
+ d40:	ff 33                	push   (%ebx)
+ d42:	e8 3f f6 ff ff       	call   386 <write>
+  f->n = 0;
+ d47:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ d4e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ d51:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ d58:	eb d2                	jmp    d2c <fprintf+0x4c>
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d60 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	53                   	push   %ebx
+ d64:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ d6d:	83 f8 0f             	cmp    $0xf,%eax
+ d70:	77 4e                	ja     dc0 <printf+0x60>
+ d72:	8b 1c 85 20 30 00 00 	mov    0x3020(,%eax,4),%ebx
+ d79:	85 db                	test   %ebx,%ebx
+ d7b:	74 43                	je     dc0 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ d7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d80:	89 d8                	mov    %ebx,%eax
+ d82:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ d85:	e8 a6 f8 ff ff       	call   630 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d8a:	8b 43 08             	mov    0x8(%ebx),%eax
+ d8d:	85 c0                	test   %eax,%eax
+ d8f:	7e 12                	jle    da3 <printf+0x43>
+ d91:	83 ec 04             	sub    $0x4,%esp
+ d94:	50                   	push   %eax
+ d95:	8d 43 10             	lea    0x10(%ebx),%eax
+ d98:	50                   	push   %eax
+ d99:	ff 33                	push   (%ebx)
+ d9b:	e8 e6 f5 ff ff       	call   386 <write>
+ da0:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ da3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ daa:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ db1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ db4:	c9                   	leave
+ db5:	c3                   	ret
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ dc0:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ dc6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ dcc:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ dd3:	00 00 00 
+    f->n = 0;
+ dd6:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ ddd:	00 00 00 
+    f->nl = 0;
+ de0:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ de7:	00 00 00 
+ dea:	eb 91                	jmp    d7d <printf+0x1d>
+ dec:	66 90                	xchg   %ax,%ax
+ dee:	66 90                	xchg   %ax,%ax
+
+00000df0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ df0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ df1:	a1 60 30 00 00       	mov    0x3060,%eax
+{
+ df6:	89 e5                	mov    %esp,%ebp
+ df8:	57                   	push   %edi
+ df9:	56                   	push   %esi
+ dfa:	53                   	push   %ebx
+ dfb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ dfe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e0c:	39 ca                	cmp    %ecx,%edx
+ e0e:	73 30                	jae    e40 <free+0x50>
+ e10:	39 c1                	cmp    %eax,%ecx
+ e12:	72 04                	jb     e18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e14:	39 c2                	cmp    %eax,%edx
+ e16:	72 f0                	jb     e08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ e1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ e1e:	39 f8                	cmp    %edi,%eax
+ e20:	74 2e                	je     e50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e25:	8b 42 04             	mov    0x4(%edx),%eax
+ e28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e2b:	39 f1                	cmp    %esi,%ecx
+ e2d:	74 38                	je     e67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ e31:	5b                   	pop    %ebx
+  freep = p;
+ e32:	89 15 60 30 00 00    	mov    %edx,0x3060
+}
+ e38:	5e                   	pop    %esi
+ e39:	5f                   	pop    %edi
+ e3a:	5d                   	pop    %ebp
+ e3b:	c3                   	ret
+ e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e40:	39 c1                	cmp    %eax,%ecx
+ e42:	72 d0                	jb     e14 <free+0x24>
+ e44:	eb c2                	jmp    e08 <free+0x18>
+ e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ e50:	03 70 04             	add    0x4(%eax),%esi
+ e53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e56:	8b 02                	mov    (%edx),%eax
+ e58:	8b 00                	mov    (%eax),%eax
+ e5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ e5d:	8b 42 04             	mov    0x4(%edx),%eax
+ e60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e63:	39 f1                	cmp    %esi,%ecx
+ e65:	75 c8                	jne    e2f <free+0x3f>
+    p->s.size += bp->s.size;
+ e67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e6a:	89 15 60 30 00 00    	mov    %edx,0x3060
+    p->s.size += bp->s.size;
+ e70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ e73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ e76:	89 0a                	mov    %ecx,(%edx)
+}
+ e78:	5b                   	pop    %ebx
+ e79:	5e                   	pop    %esi
+ e7a:	5f                   	pop    %edi
+ e7b:	5d                   	pop    %ebp
+ e7c:	c3                   	ret
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e80:	55                   	push   %ebp
+ e81:	89 e5                	mov    %esp,%ebp
+ e83:	57                   	push   %edi
+ e84:	56                   	push   %esi
+ e85:	53                   	push   %ebx
+ e86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e8c:	8b 15 60 30 00 00    	mov    0x3060,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e92:	8d 78 07             	lea    0x7(%eax),%edi
+ e95:	c1 ef 03             	shr    $0x3,%edi
+ e98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e9b:	85 d2                	test   %edx,%edx
+ e9d:	0f 84 8d 00 00 00    	je     f30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ea3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ea5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ea8:	39 f9                	cmp    %edi,%ecx
+ eaa:	73 64                	jae    f10 <malloc+0x90>
+  if(nu < 4096)
+ eac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ eb1:	39 df                	cmp    %ebx,%edi
+ eb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ eb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ebd:	eb 0a                	jmp    ec9 <malloc+0x49>
+ ebf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ec0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ec2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ec5:	39 f9                	cmp    %edi,%ecx
+ ec7:	73 47                	jae    f10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ec9:	89 c2                	mov    %eax,%edx
+ ecb:	39 05 60 30 00 00    	cmp    %eax,0x3060
+ ed1:	75 ed                	jne    ec0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ed3:	83 ec 0c             	sub    $0xc,%esp
+ ed6:	56                   	push   %esi
+ ed7:	e8 12 f5 ff ff       	call   3ee <sbrk>
+  if(p == (char*)-1)
+ edc:	83 c4 10             	add    $0x10,%esp
+ edf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ee2:	74 1c                	je     f00 <malloc+0x80>
+  hp->s.size = nu;
+ ee4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ee7:	83 ec 0c             	sub    $0xc,%esp
+ eea:	83 c0 08             	add    $0x8,%eax
+ eed:	50                   	push   %eax
+ eee:	e8 fd fe ff ff       	call   df0 <free>
+  return freep;
+ ef3:	8b 15 60 30 00 00    	mov    0x3060,%edx
+      if((p = morecore(nunits)) == 0)
+ ef9:	83 c4 10             	add    $0x10,%esp
+ efc:	85 d2                	test   %edx,%edx
+ efe:	75 c0                	jne    ec0 <malloc+0x40>
+        return 0;
+  }
+}
+ f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ f03:	31 c0                	xor    %eax,%eax
+}
+ f05:	5b                   	pop    %ebx
+ f06:	5e                   	pop    %esi
+ f07:	5f                   	pop    %edi
+ f08:	5d                   	pop    %ebp
+ f09:	c3                   	ret
+ f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ f10:	39 cf                	cmp    %ecx,%edi
+ f12:	74 4c                	je     f60 <malloc+0xe0>
+        p->s.size -= nunits;
+ f14:	29 f9                	sub    %edi,%ecx
+ f16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ f19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ f1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ f1f:	89 15 60 30 00 00    	mov    %edx,0x3060
+}
+ f25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f28:	83 c0 08             	add    $0x8,%eax
+}
+ f2b:	5b                   	pop    %ebx
+ f2c:	5e                   	pop    %esi
+ f2d:	5f                   	pop    %edi
+ f2e:	5d                   	pop    %ebp
+ f2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ f30:	c7 05 60 30 00 00 64 	movl   $0x3064,0x3060
+ f37:	30 00 00 
+    base.s.size = 0;
+ f3a:	b8 64 30 00 00       	mov    $0x3064,%eax
+    base.s.ptr = freep = prevp = &base;
+ f3f:	c7 05 64 30 00 00 64 	movl   $0x3064,0x3064
+ f46:	30 00 00 
+    base.s.size = 0;
+ f49:	c7 05 68 30 00 00 00 	movl   $0x0,0x3068
+ f50:	00 00 00 
+    if(p->s.size >= nunits){
+ f53:	e9 54 ff ff ff       	jmp    eac <malloc+0x2c>
+ f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f60:	8b 08                	mov    (%eax),%ecx
+ f62:	89 0a                	mov    %ecx,(%edx)
+ f64:	eb b9                	jmp    f1f <malloc+0x9f>
@@ -2,7 +2,7 @@
 #include "stat.h"
 #include "user.h"
 
-char buf[512];
+char buf[4096] __attribute__((aligned(4096)));
 
 void
 cat(int fd)
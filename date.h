@@ -6,3 +6,8 @@ struct rtcdate {
   uint month;
   uint year;
 };
+
+struct timespec {
+  uint tv_sec;
+  uint tv_nsec;
+};
@@ -2,9 +2,12 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct iovec;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct rusage;
+struct sched_attr;
 struct spinlock;
 struct sleeplock;
 struct stat;
@@ -16,6 +19,8 @@ void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bpin(struct buf*);
+void            bunpin(struct buf*);
 
 // console.c
 void            consoleinit(void);
@@ -32,16 +37,20 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filereadv(struct file*, struct iovec*, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritev(struct file*, struct iovec*, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+void            dirunlink(struct inode*, char*, uint);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
+int             isdirempty(struct inode*);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
@@ -67,6 +76,8 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+void            kref(char*);
+int             krefs(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -79,13 +90,16 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapictimer(uint);
+void            lapicipi(int, int);
+uint            lapiccount(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
-void            begin_op();
+void            begin_op(int);
 void            end_op();
 
 // mp.c
@@ -100,7 +114,9 @@ void            picinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
+int             pipereadv(struct pipe*, struct iovec*, int, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipewritev(struct pipe*, struct iovec*, int, int);
 
 //PAGEBREAK: 16
 // proc.c
@@ -109,6 +125,7 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int,int); //2.2.1
+struct proc*    kthread(char*, void (*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -120,10 +137,20 @@ void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+void            wakeproc(struct proc*, void*);
+void            preempt(void);
+void            schedtick(int);
+void            schedyield(void);
+int             setsched(int, int, int, int, int);
+int             getsched(int, struct sched_attr*);
+int             setaffinity(int, uint);
+int             getaffinity(int);
+int             getrusage(int, struct rusage*);
 void            yield(void);
 uint            sigprocmask(uint);
 int             sigaction(int, const struct sigaction*, struct sigaction*);
 void            sigret(void);
+int             sigwakes(struct proc*);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -159,15 +186,21 @@ int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
+int             syslat(int, uint*);
 
 // timer.c
 void            timerinit(void);
+int             timerintr(void);
+void            timeridle(void);
+void            timerbusy(void);
+uint64          nsnow(void);
+uint            tickcount(void);
+uint            nstoms(uint64);
+int             sleepns(uint64);
 
 // trap.c
 void            idtinit(void);
-extern uint     ticks;
 void            tvinit(void);
-extern struct spinlock tickslock;
 
 // uart.c
 void            uartinit(void);
@@ -189,6 +222,8 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             mapcow(pde_t*, char*, char*);
+int             cowfault(pde_t*, uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,2034 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 c8 0e 00 00       	push   $0xec8
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 ca 0e 00 00       	push   $0xeca
+  3e:	6a 01                	push   $0x1
+  40:	e8 7b 0c 00 00       	call   cc0 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 cf 0e 00 00       	push   $0xecf
+  55:	50                   	push   %eax
+  56:	68 ca 0e 00 00       	push   $0xeca
+  5b:	6a 01                	push   $0x1
+  5d:	e8 5e 0c 00 00       	call   cc0 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 46 02 00 00       	call   2b0 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 31 01 00 00       	call   2de <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 04 01 00 00       	call   306 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 07 01 00 00       	call   31e <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 cd 00 00 00       	call   2ee <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 2b6:	a1 00 14 00 00       	mov    0x1400,%eax
+ 2bb:	85 c0                	test   %eax,%eax
+ 2bd:	74 02                	je     2c1 <exit+0x11>
+    exithook();
+ 2bf:	ff d0                	call   *%eax
+  _exit();
+ 2c1:	e8 10 01 00 00       	call   3d6 <_exit>
+
+000002c6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2c6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+000002ce <wait>:
+SYSCALL(wait)
+ 2ce:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+000002d6 <pipe>:
+SYSCALL(pipe)
+ 2d6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <read>:
+SYSCALL(read)
+ 2de:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <write>:
+SYSCALL(write)
+ 2e6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <close>:
+SYSCALL(close)
+ 2ee:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <kill>:
+SYSCALL(kill)
+ 2f6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <exec>:
+SYSCALL(exec)
+ 2fe:	b8 07 00 00 00       	mov    $0x7,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <open>:
+SYSCALL(open)
+ 306:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <mknod>:
+SYSCALL(mknod)
+ 30e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <unlink>:
+SYSCALL(unlink)
+ 316:	b8 12 00 00 00       	mov    $0x12,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <fstat>:
+SYSCALL(fstat)
+ 31e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <link>:
+SYSCALL(link)
+ 326:	b8 13 00 00 00       	mov    $0x13,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <mkdir>:
+SYSCALL(mkdir)
+ 32e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <chdir>:
+SYSCALL(chdir)
+ 336:	b8 09 00 00 00       	mov    $0x9,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <dup>:
+SYSCALL(dup)
+ 33e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <getpid>:
+SYSCALL(getpid)
+ 346:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <sbrk>:
+SYSCALL(sbrk)
+ 34e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <sleep>:
+SYSCALL(sleep)
+ 356:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <uptime>:
+SYSCALL(uptime)
+ 35e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 366:	b8 16 00 00 00       	mov    $0x16,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <sigaction>:
+SYSCALL(sigaction)
+ 36e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <sigret>:
+SYSCALL(sigret)
+ 376:	b8 18 00 00 00       	mov    $0x18,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <readv>:
+SYSCALL(readv)
+ 37e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <writev>:
+SYSCALL(writev)
+ 386:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <nanosleep>:
+SYSCALL(nanosleep)
+ 38e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <setpriority>:
+SYSCALL(setpriority)
+ 396:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <sched_setattr>:
+SYSCALL(sched_setattr)
+ 39e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <sched_yield>:
+SYSCALL(sched_yield)
+ 3a6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 3ae:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 3b6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <getrusage>:
+SYSCALL(getrusage)
+ 3be:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <syslat>:
+SYSCALL(syslat)
+ 3c6:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <sched_getattr>:
+SYSCALL(sched_getattr)
+ 3ce:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 3d6:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 3db:	cd 40                	int    $0x40
+  ret
+ 3dd:	c3                   	ret
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 3e5:	31 db                	xor    %ebx,%ebx
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 3f0:	8b 34 9d 20 14 00 00 	mov    0x1420(,%ebx,4),%esi
+ 3f7:	85 f6                	test   %esi,%esi
+ 3f9:	74 27                	je     422 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 3fb:	8b 46 08             	mov    0x8(%esi),%eax
+ 3fe:	85 c0                	test   %eax,%eax
+ 400:	7e 12                	jle    414 <flushall+0x34>
+ 402:	83 ec 04             	sub    $0x4,%esp
+ 405:	50                   	push   %eax
+ 406:	8d 46 10             	lea    0x10(%esi),%eax
+ 409:	50                   	push   %eax
+ 40a:	ff 36                	push   (%esi)
+ 40c:	e8 d5 fe ff ff       	call   2e6 <write>
+ 411:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 414:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 41b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 422:	83 c3 01             	add    $0x1,%ebx
+ 425:	83 fb 10             	cmp    $0x10,%ebx
+ 428:	75 c6                	jne    3f0 <flushall+0x10>
+}
+ 42a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5d                   	pop    %ebp
+ 430:	c3                   	ret
+ 431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 448:	89 d1                	mov    %edx,%ecx
+{
+ 44a:	83 ec 2c             	sub    $0x2c,%esp
+ 44d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 450:	85 d2                	test   %edx,%edx
+ 452:	0f 89 c8 00 00 00    	jns    520 <printint+0xe0>
+ 458:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 45c:	0f 84 be 00 00 00    	je     520 <printint+0xe0>
+    x = -xx;
+ 462:	f7 d9                	neg    %ecx
+    neg = 1;
+ 464:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 469:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 46c:	31 f6                	xor    %esi,%esi
+ 46e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 470:	89 c8                	mov    %ecx,%eax
+ 472:	31 d2                	xor    %edx,%edx
+ 474:	89 f7                	mov    %esi,%edi
+ 476:	f7 f3                	div    %ebx
+ 478:	8d 76 01             	lea    0x1(%esi),%esi
+ 47b:	0f b6 92 30 0f 00 00 	movzbl 0xf30(%edx),%edx
+ 482:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 486:	89 ca                	mov    %ecx,%edx
+ 488:	89 c1                	mov    %eax,%ecx
+ 48a:	39 da                	cmp    %ebx,%edx
+ 48c:	73 e2                	jae    470 <printint+0x30>
+  if(neg)
+ 48e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 491:	85 c0                	test   %eax,%eax
+ 493:	74 07                	je     49c <printint+0x5c>
+    buf[i++] = '-';
+ 495:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 49a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 49c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 49f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4a2:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4a4:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 4a7:	8b 41 08             	mov    0x8(%ecx),%eax
+ 4aa:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4ad:	89 ce                	mov    %ecx,%esi
+ 4af:	eb 28                	jmp    4d9 <printint+0x99>
+ 4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 4b8:	89 c1                	mov    %eax,%ecx
+ 4ba:	83 c0 01             	add    $0x1,%eax
+ 4bd:	89 46 08             	mov    %eax,0x8(%esi)
+ 4c0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 4c4:	80 fa 0a             	cmp    $0xa,%dl
+ 4c7:	75 07                	jne    4d0 <printint+0x90>
+    f->nl = 1;
+ 4c9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 4d0:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 4d3:	39 fb                	cmp    %edi,%ebx
+ 4d5:	74 39                	je     510 <printint+0xd0>
+ 4d7:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 4d9:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 4dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 4e1:	75 d5                	jne    4b8 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4e3:	83 ec 04             	sub    $0x4,%esp
+ 4e6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 4e9:	68 00 02 00 00       	push   $0x200
+ 4ee:	ff 75 d0             	push   -0x30(%ebp)
+ 4f1:	ff 36                	push   (%esi)
+ 4f3:	e8 ee fd ff ff       	call   2e6 <write>
+  return r;
+ 4f8:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 4fc:	83 c4 10             	add    $0x10,%esp
+ 4ff:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 501:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 508:	b8 01 00 00 00       	mov    $0x1,%eax
+ 50d:	eb ae                	jmp    4bd <printint+0x7d>
+ 50f:	90                   	nop
+}
+ 510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 513:	5b                   	pop    %ebx
+ 514:	5e                   	pop    %esi
+ 515:	5f                   	pop    %edi
+ 516:	5d                   	pop    %ebp
+ 517:	c3                   	ret
+ 518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+  neg = 0;
+ 520:	31 c0                	xor    %eax,%eax
+ 522:	e9 42 ff ff ff       	jmp    469 <printint+0x29>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <bputc>:
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	89 c3                	mov    %eax,%ebx
+ 536:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 539:	8b 40 08             	mov    0x8(%eax),%eax
+ 53c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 541:	74 1d                	je     560 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 543:	8d 48 01             	lea    0x1(%eax),%ecx
+ 546:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 549:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 54d:	80 fa 0a             	cmp    $0xa,%dl
+ 550:	75 07                	jne    559 <bputc+0x29>
+    f->nl = 1;
+ 552:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 559:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 55c:	c9                   	leave
+ 55d:	c3                   	ret
+ 55e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 560:	83 ec 04             	sub    $0x4,%esp
+ 563:	8d 43 10             	lea    0x10(%ebx),%eax
+ 566:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 569:	68 00 02 00 00       	push   $0x200
+ 56e:	50                   	push   %eax
+ 56f:	ff 33                	push   (%ebx)
+ 571:	e8 70 fd ff ff       	call   2e6 <write>
+  return r;
+ 576:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 579:	83 c4 10             	add    $0x10,%esp
+ 57c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 581:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 588:	31 c0                	xor    %eax,%eax
+ 58a:	eb ba                	jmp    546 <bputc+0x16>
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 1c             	sub    $0x1c,%esp
+ 599:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 59c:	0f b6 0a             	movzbl (%edx),%ecx
+ 59f:	84 c9                	test   %cl,%cl
+ 5a1:	74 47                	je     5ea <vfprintf+0x5a>
+ 5a3:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 5a6:	89 c7                	mov    %eax,%edi
+ 5a8:	31 d2                	xor    %edx,%edx
+ 5aa:	89 de                	mov    %ebx,%esi
+ 5ac:	89 cb                	mov    %ecx,%ebx
+ 5ae:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 5b0:	0f be cb             	movsbl %bl,%ecx
+ 5b3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5b6:	85 d2                	test   %edx,%edx
+ 5b8:	75 4e                	jne    608 <vfprintf+0x78>
+      if(c == '%'){
+ 5ba:	83 f8 25             	cmp    $0x25,%eax
+ 5bd:	74 69                	je     628 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 5bf:	8b 47 08             	mov    0x8(%edi),%eax
+ 5c2:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5c7:	0f 84 73 01 00 00    	je     740 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 5cd:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5d0:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 5d3:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 5d7:	80 fb 0a             	cmp    $0xa,%bl
+ 5da:	74 1c                	je     5f8 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 5dc:	31 d2                	xor    %edx,%edx
+ 5de:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 5e0:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e3:	83 c6 01             	add    $0x1,%esi
+ 5e6:	84 db                	test   %bl,%bl
+ 5e8:	75 c6                	jne    5b0 <vfprintf+0x20>
+    }
+  }
+}
+ 5ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ed:	5b                   	pop    %ebx
+ 5ee:	5e                   	pop    %esi
+ 5ef:	5f                   	pop    %edi
+ 5f0:	5d                   	pop    %ebp
+ 5f1:	c3                   	ret
+ 5f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 5f8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 5ff:	eb df                	jmp    5e0 <vfprintf+0x50>
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 608:	83 fa 25             	cmp    $0x25,%edx
+ 60b:	75 d3                	jne    5e0 <vfprintf+0x50>
+      if(c == 'd'){
+ 60d:	83 f8 25             	cmp    $0x25,%eax
+ 610:	74 37                	je     649 <vfprintf+0xb9>
+ 612:	83 e8 63             	sub    $0x63,%eax
+ 615:	83 f8 15             	cmp    $0x15,%eax
+ 618:	77 16                	ja     630 <vfprintf+0xa0>
+ 61a:	ff 24 85 d8 0e 00 00 	jmp    *0xed8(,%eax,4)
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 628:	ba 25 00 00 00       	mov    $0x25,%edx
+ 62d:	eb b1                	jmp    5e0 <vfprintf+0x50>
+ 62f:	90                   	nop
+  if(f->n == BUFSIZ)
+ 630:	8b 47 08             	mov    0x8(%edi),%eax
+ 633:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 638:	0f 84 4c 01 00 00    	je     78a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 63e:	8d 50 01             	lea    0x1(%eax),%edx
+ 641:	89 57 08             	mov    %edx,0x8(%edi)
+ 644:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 649:	89 ca                	mov    %ecx,%edx
+ 64b:	89 f8                	mov    %edi,%eax
+ 64d:	e8 de fe ff ff       	call   530 <bputc>
+ 652:	eb 88                	jmp    5dc <vfprintf+0x4c>
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 658:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 65b:	83 ec 0c             	sub    $0xc,%esp
+ 65e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 663:	8b 13                	mov    (%ebx),%edx
+ 665:	6a 00                	push   $0x0
+ 667:	89 f8                	mov    %edi,%eax
+        ap++;
+ 669:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 66c:	e8 cf fd ff ff       	call   440 <printint>
+        ap++;
+ 671:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 674:	83 c4 10             	add    $0x10,%esp
+ 677:	e9 60 ff ff ff       	jmp    5dc <vfprintf+0x4c>
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 680:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 683:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 685:	83 c0 04             	add    $0x4,%eax
+ 688:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 68b:	85 d2                	test   %edx,%edx
+ 68d:	0f 84 dd 00 00 00    	je     770 <vfprintf+0x1e0>
+        while(*s != 0){
+ 693:	0f b6 1a             	movzbl (%edx),%ebx
+ 696:	84 db                	test   %bl,%bl
+ 698:	0f 84 3e ff ff ff    	je     5dc <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 69e:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 6a1:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 6a4:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 6a7:	89 fe                	mov    %edi,%esi
+ 6a9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 6ac:	89 d7                	mov    %edx,%edi
+ 6ae:	eb 27                	jmp    6d7 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 6b0:	89 c1                	mov    %eax,%ecx
+ 6b2:	83 c0 01             	add    $0x1,%eax
+ 6b5:	89 46 08             	mov    %eax,0x8(%esi)
+ 6b8:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 6bc:	80 fb 0a             	cmp    $0xa,%bl
+ 6bf:	75 07                	jne    6c8 <vfprintf+0x138>
+    f->nl = 1;
+ 6c1:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 6c8:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 6cc:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 6cf:	84 db                	test   %bl,%bl
+ 6d1:	0f 84 a9 00 00 00    	je     780 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 6d7:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6dc:	75 d2                	jne    6b0 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 6de:	83 ec 04             	sub    $0x4,%esp
+ 6e1:	68 00 02 00 00       	push   $0x200
+ 6e6:	ff 75 e0             	push   -0x20(%ebp)
+ 6e9:	ff 36                	push   (%esi)
+ 6eb:	e8 f6 fb ff ff       	call   2e6 <write>
+  return r;
+ 6f0:	83 c4 10             	add    $0x10,%esp
+ 6f3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6f8:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 6fa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 701:	eb b2                	jmp    6b5 <vfprintf+0x125>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 708:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 70b:	83 ec 0c             	sub    $0xc,%esp
+ 70e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 713:	8b 13                	mov    (%ebx),%edx
+ 715:	6a 01                	push   $0x1
+ 717:	e9 4b ff ff ff       	jmp    667 <vfprintf+0xd7>
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 720:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 723:	89 f8                	mov    %edi,%eax
+ 725:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 728:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 72b:	e8 00 fe ff ff       	call   530 <bputc>
+        ap++;
+ 730:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 733:	31 d2                	xor    %edx,%edx
+ 735:	e9 a6 fe ff ff       	jmp    5e0 <vfprintf+0x50>
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	8d 47 10             	lea    0x10(%edi),%eax
+ 746:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 749:	68 00 02 00 00       	push   $0x200
+ 74e:	50                   	push   %eax
+ 74f:	ff 37                	push   (%edi)
+ 751:	e8 90 fb ff ff       	call   2e6 <write>
+  return r;
+ 756:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 759:	83 c4 10             	add    $0x10,%esp
+ 75c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 75e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 765:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 76a:	e9 61 fe ff ff       	jmp    5d0 <vfprintf+0x40>
+ 76f:	90                   	nop
+          s = "(null)";
+ 770:	ba d1 0e 00 00       	mov    $0xed1,%edx
+ 775:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 77a:	e9 1f ff ff ff       	jmp    69e <vfprintf+0x10e>
+ 77f:	90                   	nop
+ 780:	89 f7                	mov    %esi,%edi
+ 782:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 785:	e9 52 fe ff ff       	jmp    5dc <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 78a:	83 ec 04             	sub    $0x4,%esp
+ 78d:	8d 47 10             	lea    0x10(%edi),%eax
+ 790:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 793:	68 00 02 00 00       	push   $0x200
+ 798:	50                   	push   %eax
+ 799:	ff 37                	push   (%edi)
+ 79b:	e8 46 fb ff ff       	call   2e6 <write>
+  return r;
+ 7a0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 7a3:	83 c4 10             	add    $0x10,%esp
+ 7a6:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 7ab:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 7b2:	31 c0                	xor    %eax,%eax
+ 7b4:	e9 88 fe ff ff       	jmp    641 <vfprintf+0xb1>
+ 7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <fdopen>:
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	56                   	push   %esi
+ 7c4:	53                   	push   %ebx
+ 7c5:	83 ec 20             	sub    $0x20,%esp
+ 7c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 7cb:	83 fe 0f             	cmp    $0xf,%esi
+ 7ce:	0f 87 84 00 00 00    	ja     858 <fdopen+0x98>
+  if(streams[fd])
+ 7d4:	8b 1c b5 20 14 00 00 	mov    0x1420(,%esi,4),%ebx
+ 7db:	85 db                	test   %ebx,%ebx
+ 7dd:	74 11                	je     7f0 <fdopen+0x30>
+}
+ 7df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7e2:	89 d8                	mov    %ebx,%eax
+ 7e4:	5b                   	pop    %ebx
+ 7e5:	5e                   	pop    %esi
+ 7e6:	5d                   	pop    %ebp
+ 7e7:	c3                   	ret
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 7f0:	83 ec 0c             	sub    $0xc,%esp
+ 7f3:	68 10 02 00 00       	push   $0x210
+ 7f8:	e8 e3 05 00 00       	call   de0 <malloc>
+ 7fd:	83 c4 10             	add    $0x10,%esp
+ 800:	89 c3                	mov    %eax,%ebx
+ 802:	85 c0                	test   %eax,%eax
+ 804:	74 52                	je     858 <fdopen+0x98>
+  f->fd = fd;
+ 806:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 808:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 80b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 812:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 819:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 820:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 823:	50                   	push   %eax
+ 824:	56                   	push   %esi
+ 825:	e8 f4 fa ff ff       	call   31e <fstat>
+ 82a:	83 c4 10             	add    $0x10,%esp
+ 82d:	85 c0                	test   %eax,%eax
+ 82f:	75 07                	jne    838 <fdopen+0x78>
+ 831:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 836:	74 30                	je     868 <fdopen+0xa8>
+  streams[fd] = f;
+ 838:	89 1c b5 20 14 00 00 	mov    %ebx,0x1420(,%esi,4)
+}
+ 83f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 841:	c7 05 00 14 00 00 e0 	movl   $0x3e0,0x1400
+ 848:	03 00 00 
+}
+ 84b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 84e:	5b                   	pop    %ebx
+ 84f:	5e                   	pop    %esi
+ 850:	5d                   	pop    %ebp
+ 851:	c3                   	ret
+ 852:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 858:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 85b:	31 db                	xor    %ebx,%ebx
+}
+ 85d:	89 d8                	mov    %ebx,%eax
+ 85f:	5b                   	pop    %ebx
+ 860:	5e                   	pop    %esi
+ 861:	5d                   	pop    %ebp
+ 862:	c3                   	ret
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+    f->mode = _IOLBF;
+ 868:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 86f:	eb c7                	jmp    838 <fdopen+0x78>
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+
+00000880 <fopen>:
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	53                   	push   %ebx
+ 884:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 887:	ff 75 0c             	push   0xc(%ebp)
+ 88a:	ff 75 08             	push   0x8(%ebp)
+ 88d:	e8 74 fa ff ff       	call   306 <open>
+ 892:	83 c4 10             	add    $0x10,%esp
+ 895:	85 c0                	test   %eax,%eax
+ 897:	78 37                	js     8d0 <fopen+0x50>
+ 899:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 89b:	8b 04 85 20 14 00 00 	mov    0x1420(,%eax,4),%eax
+ 8a2:	85 c0                	test   %eax,%eax
+ 8a4:	74 17                	je     8bd <fopen+0x3d>
+    free(streams[fd]);
+ 8a6:	83 ec 0c             	sub    $0xc,%esp
+ 8a9:	50                   	push   %eax
+ 8aa:	e8 a1 04 00 00       	call   d50 <free>
+    streams[fd] = 0;
+ 8af:	83 c4 10             	add    $0x10,%esp
+ 8b2:	c7 04 9d 20 14 00 00 	movl   $0x0,0x1420(,%ebx,4)
+ 8b9:	00 00 00 00 
+  return fdopen(fd);
+ 8bd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 8c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8c3:	c9                   	leave
+  return fdopen(fd);
+ 8c4:	e9 f7 fe ff ff       	jmp    7c0 <fdopen>
+ 8c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 8d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8d3:	31 c0                	xor    %eax,%eax
+ 8d5:	c9                   	leave
+ 8d6:	c3                   	ret
+ 8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <setvbuf>:
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	56                   	push   %esi
+ 8e4:	53                   	push   %ebx
+ 8e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 8e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 8eb:	83 fe 02             	cmp    $0x2,%esi
+ 8ee:	77 38                	ja     928 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 8f0:	8b 43 08             	mov    0x8(%ebx),%eax
+ 8f3:	85 c0                	test   %eax,%eax
+ 8f5:	7e 12                	jle    909 <setvbuf+0x29>
+ 8f7:	83 ec 04             	sub    $0x4,%esp
+ 8fa:	50                   	push   %eax
+ 8fb:	8d 43 10             	lea    0x10(%ebx),%eax
+ 8fe:	50                   	push   %eax
+ 8ff:	ff 33                	push   (%ebx)
+ 901:	e8 e0 f9 ff ff       	call   2e6 <write>
+ 906:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 909:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 910:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 912:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 919:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 91c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 91f:	5b                   	pop    %ebx
+ 920:	5e                   	pop    %esi
+ 921:	5d                   	pop    %ebp
+ 922:	c3                   	ret
+ 923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 927:	90                   	nop
+    return -1;
+ 928:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 92d:	eb ed                	jmp    91c <setvbuf+0x3c>
+ 92f:	90                   	nop
+
+00000930 <fflush>:
+{
+ 930:	55                   	push   %ebp
+ 931:	31 c0                	xor    %eax,%eax
+ 933:	89 e5                	mov    %esp,%ebp
+ 935:	53                   	push   %ebx
+ 936:	83 ec 04             	sub    $0x4,%esp
+ 939:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 93c:	8b 53 08             	mov    0x8(%ebx),%edx
+ 93f:	85 d2                	test   %edx,%edx
+ 941:	7e 1d                	jle    960 <fflush+0x30>
+ 943:	83 ec 04             	sub    $0x4,%esp
+ 946:	8d 43 10             	lea    0x10(%ebx),%eax
+ 949:	52                   	push   %edx
+ 94a:	50                   	push   %eax
+ 94b:	ff 33                	push   (%ebx)
+ 94d:	e8 94 f9 ff ff       	call   2e6 <write>
+ 952:	83 c4 10             	add    $0x10,%esp
+ 955:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 958:	0f 95 c0             	setne  %al
+ 95b:	0f b6 c0             	movzbl %al,%eax
+ 95e:	f7 d8                	neg    %eax
+  f->n = 0;
+ 960:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 967:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 96e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 971:	c9                   	leave
+ 972:	c3                   	ret
+ 973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000980 <fclose>:
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	56                   	push   %esi
+ 984:	31 f6                	xor    %esi,%esi
+ 986:	53                   	push   %ebx
+ 987:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 98a:	8b 43 08             	mov    0x8(%ebx),%eax
+ 98d:	85 c0                	test   %eax,%eax
+ 98f:	7e 1f                	jle    9b0 <fclose+0x30>
+ 991:	83 ec 04             	sub    $0x4,%esp
+ 994:	50                   	push   %eax
+ 995:	8d 43 10             	lea    0x10(%ebx),%eax
+ 998:	50                   	push   %eax
+ 999:	ff 33                	push   (%ebx)
+ 99b:	e8 46 f9 ff ff       	call   2e6 <write>
+ 9a0:	83 c4 10             	add    $0x10,%esp
+ 9a3:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 9a6:	0f 95 c0             	setne  %al
+ 9a9:	0f b6 c0             	movzbl %al,%eax
+ 9ac:	f7 d8                	neg    %eax
+ 9ae:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ 9b0:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ 9b3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 9ba:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ 9c1:	ff 33                	push   (%ebx)
+ 9c3:	e8 26 f9 ff ff       	call   2ee <close>
+ 9c8:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ 9cb:	85 c0                	test   %eax,%eax
+ 9cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9d2:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ 9d5:	8b 03                	mov    (%ebx),%eax
+ 9d7:	83 f8 0f             	cmp    $0xf,%eax
+ 9da:	77 09                	ja     9e5 <fclose+0x65>
+ 9dc:	39 1c 85 20 14 00 00 	cmp    %ebx,0x1420(,%eax,4)
+ 9e3:	74 0b                	je     9f0 <fclose+0x70>
+}
+ 9e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9e8:	89 f0                	mov    %esi,%eax
+ 9ea:	5b                   	pop    %ebx
+ 9eb:	5e                   	pop    %esi
+ 9ec:	5d                   	pop    %ebp
+ 9ed:	c3                   	ret
+ 9ee:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ 9f0:	c7 04 85 20 14 00 00 	movl   $0x0,0x1420(,%eax,4)
+ 9f7:	00 00 00 00 
+    free(f);
+ 9fb:	83 ec 0c             	sub    $0xc,%esp
+ 9fe:	53                   	push   %ebx
+ 9ff:	e8 4c 03 00 00       	call   d50 <free>
+ a04:	83 c4 10             	add    $0x10,%esp
+  return r;
+ a07:	eb dc                	jmp    9e5 <fclose+0x65>
+ a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a10 <fputc>:
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	53                   	push   %ebx
+ a14:	83 ec 04             	sub    $0x4,%esp
+ a17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ a1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ a1d:	8b 43 08             	mov    0x8(%ebx),%eax
+ a20:	3d 00 02 00 00       	cmp    $0x200,%eax
+ a25:	74 59                	je     a80 <fputc+0x70>
+  f->buf[f->n++] = c;
+ a27:	8d 48 01             	lea    0x1(%eax),%ecx
+ a2a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ a2d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ a31:	80 fa 0a             	cmp    $0xa,%dl
+ a34:	75 07                	jne    a3d <fputc+0x2d>
+    f->nl = 1;
+ a36:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a3d:	8b 43 04             	mov    0x4(%ebx),%eax
+ a40:	83 f8 02             	cmp    $0x2,%eax
+ a43:	74 1a                	je     a5f <fputc+0x4f>
+ a45:	83 f8 01             	cmp    $0x1,%eax
+ a48:	74 0e                	je     a58 <fputc+0x48>
+}
+ a4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a4d:	0f b6 c2             	movzbl %dl,%eax
+}
+ a50:	c9                   	leave
+ a51:	c3                   	ret
+ a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a58:	8b 43 0c             	mov    0xc(%ebx),%eax
+ a5b:	85 c0                	test   %eax,%eax
+ a5d:	74 eb                	je     a4a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a5f:	85 c9                	test   %ecx,%ecx
+ a61:	7f 4d                	jg     ab0 <fputc+0xa0>
+  f->n = 0;
+ a63:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a6a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a74:	0f b6 c2             	movzbl %dl,%eax
+}
+ a77:	c9                   	leave
+ a78:	c3                   	ret
+ a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a80:	83 ec 04             	sub    $0x4,%esp
+ a83:	8d 43 10             	lea    0x10(%ebx),%eax
+ a86:	89 55 08             	mov    %edx,0x8(%ebp)
+ a89:	68 00 02 00 00       	push   $0x200
+ a8e:	50                   	push   %eax
+ a8f:	ff 33                	push   (%ebx)
+ a91:	e8 50 f8 ff ff       	call   2e6 <write>
+  return r;
+ a96:	8b 55 08             	mov    0x8(%ebp),%edx
+ a99:	83 c4 10             	add    $0x10,%esp
+ a9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ aa1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ aa8:	31 c0                	xor    %eax,%eax
+ aaa:	e9 7b ff ff ff       	jmp    a2a <fputc+0x1a>
+ aaf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	8d 43 10             	lea    0x10(%ebx),%eax
+ ab6:	89 55 08             	mov    %edx,0x8(%ebp)
+ ab9:	51                   	push   %ecx
+ aba:	50                   	push   %eax
+ abb:	ff 33                	push   (%ebx)
+ abd:	e8 24 f8 ff ff       	call   2e6 <write>
+  f->n = 0;
+ ac2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ ac9:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ acc:	83 c4 10             	add    $0x10,%esp
+ acf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ ad6:	eb 99                	jmp    a71 <fputc+0x61>
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+
+00000ae0 <fwrite>:
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	56                   	push   %esi
+ ae5:	53                   	push   %ebx
+ ae6:	83 ec 1c             	sub    $0x1c,%esp
+ ae9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ aec:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ aef:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ af2:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ af5:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ afb:	0f 8f af 00 00 00    	jg     bb0 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ b01:	85 ff                	test   %edi,%edi
+ b03:	7e 73                	jle    b78 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b05:	8d 56 10             	lea    0x10(%esi),%edx
+ b08:	8b 46 08             	mov    0x8(%esi),%eax
+ b0b:	31 db                	xor    %ebx,%ebx
+ b0d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ b10:	eb 25                	jmp    b37 <fwrite+0x57>
+ b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ b18:	89 c1                	mov    %eax,%ecx
+ b1a:	83 c0 01             	add    $0x1,%eax
+ b1d:	89 46 08             	mov    %eax,0x8(%esi)
+ b20:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ b24:	80 fa 0a             	cmp    $0xa,%dl
+ b27:	75 07                	jne    b30 <fwrite+0x50>
+    f->nl = 1;
+ b29:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ b30:	83 c3 01             	add    $0x1,%ebx
+ b33:	39 df                	cmp    %ebx,%edi
+ b35:	7e 41                	jle    b78 <fwrite+0x98>
+    bputc(f, s[i]);
+ b37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b3a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ b3e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ b43:	75 d3                	jne    b18 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b45:	83 ec 04             	sub    $0x4,%esp
+ b48:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ b4b:	68 00 02 00 00       	push   $0x200
+ b50:	ff 75 e0             	push   -0x20(%ebp)
+ b53:	ff 36                	push   (%esi)
+ b55:	e8 8c f7 ff ff       	call   2e6 <write>
+  return r;
+ b5a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ b5e:	83 c4 10             	add    $0x10,%esp
+ b61:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ b63:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ b6a:	b8 01 00 00 00       	mov    $0x1,%eax
+ b6f:	eb ac                	jmp    b1d <fwrite+0x3d>
+ b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b78:	8b 46 04             	mov    0x4(%esi),%eax
+ b7b:	83 f8 02             	cmp    $0x2,%eax
+ b7e:	74 0c                	je     b8c <fwrite+0xac>
+ b80:	83 f8 01             	cmp    $0x1,%eax
+ b83:	75 1c                	jne    ba1 <fwrite+0xc1>
+ b85:	8b 46 0c             	mov    0xc(%esi),%eax
+ b88:	85 c0                	test   %eax,%eax
+ b8a:	74 15                	je     ba1 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b8c:	8b 46 08             	mov    0x8(%esi),%eax
+ b8f:	85 c0                	test   %eax,%eax
+ b91:	7f 5d                	jg     bf0 <fwrite+0x110>
+  f->n = 0;
+ b93:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ b9a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ ba1:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ba7:	5b                   	pop    %ebx
+ ba8:	5e                   	pop    %esi
+ ba9:	5f                   	pop    %edi
+ baa:	5d                   	pop    %ebp
+ bab:	c3                   	ret
+ bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ bb0:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ bb4:	0f 84 4b ff ff ff    	je     b05 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bba:	8b 46 08             	mov    0x8(%esi),%eax
+ bbd:	8b 16                	mov    (%esi),%edx
+ bbf:	85 c0                	test   %eax,%eax
+ bc1:	7f 45                	jg     c08 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ bc3:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ bc6:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ bcd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ bd4:	57                   	push   %edi
+ bd5:	ff 75 08             	push   0x8(%ebp)
+ bd8:	ff 36                	push   (%esi)
+ bda:	e8 07 f7 ff ff       	call   2e6 <write>
+    return size > 0 ? i / size : 0;
+ bdf:	83 c4 10             	add    $0x10,%esp
+ be2:	85 c0                	test   %eax,%eax
+ be4:	78 4a                	js     c30 <fwrite+0x150>
+ be6:	85 db                	test   %ebx,%ebx
+ be8:	7e 46                	jle    c30 <fwrite+0x150>
+ bea:	99                   	cltd
+ beb:	f7 fb                	idiv   %ebx
+ bed:	eb b5                	jmp    ba4 <fwrite+0xc4>
+ bef:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	50                   	push   %eax
+ bf4:	8d 46 10             	lea    0x10(%esi),%eax
+ bf7:	50                   	push   %eax
+ bf8:	ff 36                	push   (%esi)
+ bfa:	e8 e7 f6 ff ff       	call   2e6 <write>
+ bff:	83 c4 10             	add    $0x10,%esp
+ c02:	eb 8f                	jmp    b93 <fwrite+0xb3>
+ c04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c08:	83 ec 04             	sub    $0x4,%esp
+ c0b:	50                   	push   %eax
+ c0c:	8d 46 10             	lea    0x10(%esi),%eax
+ c0f:	50                   	push   %eax
+ c10:	52                   	push   %edx
+ c11:	e8 d0 f6 ff ff       	call   2e6 <write>
+ c16:	83 c4 10             	add    $0x10,%esp
+ c19:	3b 46 08             	cmp    0x8(%esi),%eax
+ c1c:	74 a5                	je     bc3 <fwrite+0xe3>
+  f->n = 0;
+ c1e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c25:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ c30:	31 c0                	xor    %eax,%eax
+ c32:	e9 6d ff ff ff       	jmp    ba4 <fwrite+0xc4>
+ c37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3e:	66 90                	xchg   %ax,%ax
+
+00000c40 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c44:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c47:	83 ec 04             	sub    $0x4,%esp
+ c4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c50:	89 d8                	mov    %ebx,%eax
+ c52:	e8 39 f9 ff ff       	call   590 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c57:	8b 43 04             	mov    0x4(%ebx),%eax
+ c5a:	83 f8 02             	cmp    $0x2,%eax
+ c5d:	74 18                	je     c77 <fprintf+0x37>
+ c5f:	83 f8 01             	cmp    $0x1,%eax
+ c62:	74 0c                	je     c70 <fprintf+0x30>
+  settle(f);
+}
+ c64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c67:	c9                   	leave
+ c68:	c3                   	ret
+ c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c70:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c73:	85 c0                	test   %eax,%eax
+ c75:	74 ed                	je     c64 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c77:	8b 43 08             	mov    0x8(%ebx),%eax
+ c7a:	85 c0                	test   %eax,%eax
+ c7c:	7f 1a                	jg     c98 <fprintf+0x58>
+  f->n = 0;
+ c7e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ c85:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ c8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c8f:	c9                   	leave
+ c90:	c3                   	ret
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c98:	83 ec 04             	sub    $0x4,%esp
+ c9b:	50                   	push   %eax
+ c9c:	8d 43 10             	lea    0x10(%ebx),%eax
+ c9f:	50                   	push   %eax
+ ca0:	ff 33                	push   (%ebx)
+ ca2:	e8 3f f6 ff ff       	call   2e6 <write>
+  f->n = 0;
+ ca7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ cae:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ cb1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ cb8:	eb d2                	jmp    c8c <fprintf+0x4c>
+ cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cc0 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ cc0:	55                   	push   %ebp
+ cc1:	89 e5                	mov    %esp,%ebp
+ cc3:	53                   	push   %ebx
+ cc4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ cca:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ ccd:	83 f8 0f             	cmp    $0xf,%eax
+ cd0:	77 4e                	ja     d20 <printf+0x60>
+ cd2:	8b 1c 85 20 14 00 00 	mov    0x1420(,%eax,4),%ebx
+ cd9:	85 db                	test   %ebx,%ebx
+ cdb:	74 43                	je     d20 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ cdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ce0:	89 d8                	mov    %ebx,%eax
+ ce2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ ce5:	e8 a6 f8 ff ff       	call   590 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ cea:	8b 43 08             	mov    0x8(%ebx),%eax
+ ced:	85 c0                	test   %eax,%eax
+ cef:	7e 12                	jle    d03 <printf+0x43>
+ cf1:	83 ec 04             	sub    $0x4,%esp
+ cf4:	50                   	push   %eax
+ cf5:	8d 43 10             	lea    0x10(%ebx),%eax
+ cf8:	50                   	push   %eax
+ cf9:	ff 33                	push   (%ebx)
+ cfb:	e8 e6 f5 ff ff       	call   2e6 <write>
+ d00:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ d03:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d0a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d14:	c9                   	leave
+ d15:	c3                   	ret
+ d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ d20:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ d26:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ d2c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ d33:	00 00 00 
+    f->n = 0;
+ d36:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ d3d:	00 00 00 
+    f->nl = 0;
+ d40:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ d47:	00 00 00 
+ d4a:	eb 91                	jmp    cdd <printf+0x1d>
+ d4c:	66 90                	xchg   %ax,%ax
+ d4e:	66 90                	xchg   %ax,%ax
+
+00000d50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d51:	a1 60 14 00 00       	mov    0x1460,%eax
+{
+ d56:	89 e5                	mov    %esp,%ebp
+ d58:	57                   	push   %edi
+ d59:	56                   	push   %esi
+ d5a:	53                   	push   %ebx
+ d5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d6c:	39 ca                	cmp    %ecx,%edx
+ d6e:	73 30                	jae    da0 <free+0x50>
+ d70:	39 c1                	cmp    %eax,%ecx
+ d72:	72 04                	jb     d78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d74:	39 c2                	cmp    %eax,%edx
+ d76:	72 f0                	jb     d68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d7e:	39 f8                	cmp    %edi,%eax
+ d80:	74 2e                	je     db0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d85:	8b 42 04             	mov    0x4(%edx),%eax
+ d88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d8b:	39 f1                	cmp    %esi,%ecx
+ d8d:	74 38                	je     dc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d91:	5b                   	pop    %ebx
+  freep = p;
+ d92:	89 15 60 14 00 00    	mov    %edx,0x1460
+}
+ d98:	5e                   	pop    %esi
+ d99:	5f                   	pop    %edi
+ d9a:	5d                   	pop    %ebp
+ d9b:	c3                   	ret
+ d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ da0:	39 c1                	cmp    %eax,%ecx
+ da2:	72 d0                	jb     d74 <free+0x24>
+ da4:	eb c2                	jmp    d68 <free+0x18>
+ da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ db0:	03 70 04             	add    0x4(%eax),%esi
+ db3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ db6:	8b 02                	mov    (%edx),%eax
+ db8:	8b 00                	mov    (%eax),%eax
+ dba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dbd:	8b 42 04             	mov    0x4(%edx),%eax
+ dc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dc3:	39 f1                	cmp    %esi,%ecx
+ dc5:	75 c8                	jne    d8f <free+0x3f>
+    p->s.size += bp->s.size;
+ dc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dca:	89 15 60 14 00 00    	mov    %edx,0x1460
+    p->s.size += bp->s.size;
+ dd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ dd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ dd6:	89 0a                	mov    %ecx,(%edx)
+}
+ dd8:	5b                   	pop    %ebx
+ dd9:	5e                   	pop    %esi
+ dda:	5f                   	pop    %edi
+ ddb:	5d                   	pop    %ebp
+ ddc:	c3                   	ret
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000de0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	57                   	push   %edi
+ de4:	56                   	push   %esi
+ de5:	53                   	push   %ebx
+ de6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dec:	8b 15 60 14 00 00    	mov    0x1460,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ df2:	8d 78 07             	lea    0x7(%eax),%edi
+ df5:	c1 ef 03             	shr    $0x3,%edi
+ df8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ dfb:	85 d2                	test   %edx,%edx
+ dfd:	0f 84 8d 00 00 00    	je     e90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e05:	8b 48 04             	mov    0x4(%eax),%ecx
+ e08:	39 f9                	cmp    %edi,%ecx
+ e0a:	73 64                	jae    e70 <malloc+0x90>
+  if(nu < 4096)
+ e0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e11:	39 df                	cmp    %ebx,%edi
+ e13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e1d:	eb 0a                	jmp    e29 <malloc+0x49>
+ e1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e22:	8b 48 04             	mov    0x4(%eax),%ecx
+ e25:	39 f9                	cmp    %edi,%ecx
+ e27:	73 47                	jae    e70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e29:	89 c2                	mov    %eax,%edx
+ e2b:	39 05 60 14 00 00    	cmp    %eax,0x1460
+ e31:	75 ed                	jne    e20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e33:	83 ec 0c             	sub    $0xc,%esp
+ e36:	56                   	push   %esi
+ e37:	e8 12 f5 ff ff       	call   34e <sbrk>
+  if(p == (char*)-1)
+ e3c:	83 c4 10             	add    $0x10,%esp
+ e3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e42:	74 1c                	je     e60 <malloc+0x80>
+  hp->s.size = nu;
+ e44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e47:	83 ec 0c             	sub    $0xc,%esp
+ e4a:	83 c0 08             	add    $0x8,%eax
+ e4d:	50                   	push   %eax
+ e4e:	e8 fd fe ff ff       	call   d50 <free>
+  return freep;
+ e53:	8b 15 60 14 00 00    	mov    0x1460,%edx
+      if((p = morecore(nunits)) == 0)
+ e59:	83 c4 10             	add    $0x10,%esp
+ e5c:	85 d2                	test   %edx,%edx
+ e5e:	75 c0                	jne    e20 <malloc+0x40>
+        return 0;
+  }
+}
+ e60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e63:	31 c0                	xor    %eax,%eax
+}
+ e65:	5b                   	pop    %ebx
+ e66:	5e                   	pop    %esi
+ e67:	5f                   	pop    %edi
+ e68:	5d                   	pop    %ebp
+ e69:	c3                   	ret
+ e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e70:	39 cf                	cmp    %ecx,%edi
+ e72:	74 4c                	je     ec0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e74:	29 f9                	sub    %edi,%ecx
+ e76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e7f:	89 15 60 14 00 00    	mov    %edx,0x1460
+}
+ e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e88:	83 c0 08             	add    $0x8,%eax
+}
+ e8b:	5b                   	pop    %ebx
+ e8c:	5e                   	pop    %esi
+ e8d:	5f                   	pop    %edi
+ e8e:	5d                   	pop    %ebp
+ e8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e90:	c7 05 60 14 00 00 64 	movl   $0x1464,0x1460
+ e97:	14 00 00 
+    base.s.size = 0;
+ e9a:	b8 64 14 00 00       	mov    $0x1464,%eax
+    base.s.ptr = freep = prevp = &base;
+ e9f:	c7 05 64 14 00 00 64 	movl   $0x1464,0x1464
+ ea6:	14 00 00 
+    base.s.size = 0;
+ ea9:	c7 05 68 14 00 00 00 	movl   $0x0,0x1468
+ eb0:	00 00 00 
+    if(p->s.size >= nunits){
+ eb3:	e9 54 ff ff ff       	jmp    e0c <malloc+0x2c>
+ eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ebf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ec0:	8b 08                	mov    (%eax),%ecx
+ ec2:	89 0a                	mov    %ecx,(%edx)
+ ec4:	eb b9                	jmp    e7f <malloc+0x9f>
@@ -9,6 +9,25 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
+
+// Metadata blocks a file write may dirty besides its data:
+// the i-node and up to three indirect blocks.
+#define WRITEOPMETA 4
+#define NBITMAP     (FSSIZE/BPB + 1)
+
+// Blocks to reserve for a write spanning nb data blocks.
+// balloc() starts each search at a goal and may wrap around
+// the disk, so every block allocated, data or indirect, can
+// dirty a different bitmap block, up to all of them.
+static int
+writeop(int nb)
+{
+  int nalloc;
+
+  nalloc = nb + WRITEOPMETA - 1;
+  return nb + WRITEOPMETA + (nalloc < NBITMAP ? nalloc : NBITMAP);
+}
 
 struct devsw devsw[NDEV];
 struct {
@@ -73,7 +92,7 @@ fileclose(struct file *f)
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
-    begin_op();
+    begin_op(MAXOPBLOCKS);
     iput(ff.ip);
     end_op();
   }
@@ -96,18 +115,43 @@ filestat(struct file *f, struct stat *st)
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return filereadv(f, &iov, 1);
+}
+
+// Read from file f into the cnt segments of iov,
+// stopping early at the end of the data.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, r, tot;
 
   if(f->readable == 0)
     return -1;
+  // Only this process holds f if f->ref is 1, and it can't
+  // gain a holder while we are here, so we are the only reader.
   if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
+    return pipereadv(f->pipe, iov, cnt, f->ref == 1);
   if(f->type == FD_INODE){
+    tot = 0;
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    for(i = 0; i < cnt; i++){
+      r = readi(f->ip, iov[i].iov_base, f->off, iov[i].iov_len);
+      if(r < 0){
+        if(tot == 0)
+          tot = -1;
+        break;
+      }
       f->off += r;
+      tot += r;
+      if(r < iov[i].iov_len)
+        break;
+    }
     iunlock(f->ip);
-    return r;
+    return tot;
   }
   panic("fileread");
 }
@@ -117,40 +161,76 @@ fileread(struct file *f, char *addr, int n)
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
+  struct iovec iov;
+
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return filewritev(f, &iov, 1);
+}
+
+// Write the cnt segments of iov to file f.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
+{
+  int r, n, n1, m, seg, segoff, s, so, max;
 
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
+    return pipewritev(f->pipe, iov, cnt, f->ref == 1);
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // write many blocks at a time, reserving log space
+    // for the data blocks the chunk touches plus the
+    // i-node, indirect block, and allocation blocks.
+    // a chunk takes in as many segments as fit, so that
+    // a vector of small writes costs one transaction.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
+    max = (LOGSIZE/2 - 1 - WRITEOPMETA - NBITMAP) * BSIZE;
+    n = 0;
+    seg = segoff = 0;
+    for(;;){
+      // Measure the next chunk: segments from seg, segoff on.
+      n1 = 0;
+      for(s = seg, so = segoff; s < cnt && n1 < max; s++, so = 0){
+        m = iov[s].iov_len - so;
+        if(m > max - n1){
+          n1 = max;
+          break;
+        }
+        n1 += m;
+      }
+      if(n1 == 0)
+        break;
+
+      begin_op(writeop((f->off+n1-1)/BSIZE - f->off/BSIZE + 1));
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
+      r = 0;
+      while(n1 > 0){
+        m = iov[seg].iov_len - segoff;
+        if(m > n1)
+          m = n1;
+        if ((r = writei(f->ip, (char*)iov[seg].iov_base + segoff, f->off, m)) > 0)
+          f->off += r;
+        if(r != m)
+          break;
+        n += m;
+        n1 -= m;
+        segoff += m;
+        if(segoff == iov[seg].iov_len){
+          seg++;
+          segoff = 0;
+        }
+      }
       iunlock(f->ip);
       end_op();
 
       if(r < 0)
-        break;
-      if(r != n1)
+        return -1;
+      if(n1 > 0)
         panic("short filewrite");
-      i += r;
     }
-    return i == n ? n : -1;
+    return n;
   }
   panic("filewrite");
 }
@@ -14,6 +14,7 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "memlayout.h"
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -23,6 +24,10 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dcinit(void);
+static void dcpurge(uint, uint);
+static void pcinit(void);
+static void pcdrop(struct inode*, uint, uint);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -53,25 +58,81 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// In-memory summary of the free bitmap: the number of free
+// blocks mapped by each bitmap block (-1 until counted), so
+// that full bitmap blocks are not read, and where to start
+// looking when the caller has no preferred location.
+// nfree[i] is only changed while holding bitmap block i.
+static struct {
+  int nfree[FSSIZE/BPB+1];
+  uint hint;
+} bsum;
+
+// Count the free blocks mapped by bitmap block bp,
+// which maps blocks b..b+BPB-1.
+static int
+bcount(struct buf *bp, uint b)
+{
+  int bi, n;
+
+  n = 0;
+  for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+    if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+      n++;
+  return n;
+}
+
+// Find the first free bit at or after bit start in bitmap
+// block bp, which maps blocks b..b+BPB-1, a word at a time.
+// Returns -1 if there is none.
+static int
+bfind(struct buf *bp, uint b, int start)
+{
+  uint *w, x;
+  int bi;
+
+  w = (uint*)bp->data;
+  for(bi = start & ~31; bi < BPB && b + bi < sb.size; bi += 32){
+    x = ~w[bi/32];
+    if(bi < start)
+      x &= ~0U << (start - bi);
+    if(x == 0)
+      continue;
+    bi += __builtin_ctz(x);
+    return b + bi < sb.size ? bi : -1;
+  }
+  return -1;
+}
+
+// Allocate a zeroed disk block, as close after block
+// near as possible. near is 0 if the caller does not care.
 static uint
-balloc(uint dev)
+balloc(uint dev, uint near)
 {
-  int b, bi, m;
+  int bi, i, n;
+  uint b, goal;
   struct buf *bp;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
+  goal = near ? near + 1 : bsum.hint;
+  if(goal >= sb.size)
+    goal = 0;
+  n = (sb.size + BPB - 1) / BPB;
+  // The last iteration revisits the start of goal's bitmap block.
+  for(i = 0; i <= n; i++){
+    b = (goal/BPB + i) % n * BPB;
+    if(bsum.nfree[b/BPB] == 0)
+      continue;
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+    if(bsum.nfree[b/BPB] < 0)
+      bsum.nfree[b/BPB] = bcount(bp, b);
+    if((bi = bfind(bp, b, i == 0 ? goal % BPB : 0)) >= 0){
+      bp->data[bi/8] |= 1 << (bi % 8);  // Mark block in use.
+      log_write(bp);
+      bsum.nfree[b/BPB]--;
+      brelse(bp);
+      bsum.hint = b + bi + 1;
+      bzero(dev, b + bi);
+      return b + bi;
     }
     brelse(bp);
   }
@@ -92,6 +153,8 @@ bfree(int dev, uint b)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
+  if(bsum.nfree[b/BPB] >= 0)
+    bsum.nfree[b/BPB]++;
   brelse(bp);
 }
 
@@ -120,18 +183,19 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, and iput() frees if
 //   the reference and link counts have fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() finds or
-//   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to an entry (open files and current
+//   directories). iget() finds or creates a cache entry and
+//   increments its ref; iput() decrements ref. An entry
+//   whose ref is zero stays cached, on an LRU list, until
+//   iget() recycles it for another inode. If every entry
+//   is referenced, iget() adds a page of new entries.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
-//   ilock() reads the inode from
-//   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ilock() reads the inode from the disk and sets
+//   ip->valid, while iput() clears ip->valid if it frees
+//   the inode and iget() clears it when recycling an entry.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,30 +219,84 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// Cached entries are found through a hash table on (dev, inum).
+// Each hash bucket has a spin-lock, which protects its chain
+// and the ip->ref, ip->dev and ip->inum fields of the entries on
+// it; one must hold it while using any of those fields. An entry
+// with inum 0 is on no chain. The icache.lock spin-lock protects
+// the LRU list and the growth of the cache; it may be acquired
+// while holding a bucket lock, but not the other way around.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
-// dev, and inum.  One must hold ip->lock in order to
+// dev, inum and the list links.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define NIHASH 64
+
+struct ibucket {
+  struct spinlock lock;
+  struct inode *head;
+};
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode inode[NINODE];  // initial entries
+  struct ibucket bucket[NIHASH];
+  // LRU list of unreferenced entries, through prev/next.
+  // lru.next is least recently used.
+  struct inode lru;
 } icache;
 
+static struct ibucket*
+ibucket(uint dev, uint inum)
+{
+  return &icache.bucket[(dev*31 + inum) % NIHASH];
+}
+
+// Put an unreferenced entry on the LRU list: at the front
+// to be recycled first, else at the back.
+// Caller must hold icache.lock.
+static void
+lruadd(struct inode *ip, int front)
+{
+  struct inode *at;
+
+  at = front ? &icache.lru : icache.lru.prev;
+  ip->prev = at;
+  ip->next = at->next;
+  at->next->prev = ip;
+  at->next = ip;
+}
+
+// Caller must hold icache.lock.
+static void
+lrudel(struct inode *ip)
+{
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+  ip->next = ip->prev = 0;
+}
+
 void
 iinit(int dev)
 {
   int i = 0;
   initlock(&icache.lock, "icache");
+  dcinit();
+  pcinit();
+  for(i = 0; i < NIHASH; i++)
+    initlock(&icache.bucket[i].lock, "ibucket");
+  icache.lru.prev = icache.lru.next = &icache.lru;
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
+    lruadd(&icache.inode[i], 0);
   }
   
   readsb(dev, &sb);
+  if(sb.size > FSSIZE)
+    panic("iinit: file system too big");
+  for(i = 0; i < sb.size/BPB+1; i++)
+    bsum.nfree[i] = -1;
 
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
@@ -236,40 +354,117 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Add a page of new entries to the inode cache.
+// Caller must hold icache.lock.
+static int
+igrow(void)
+{
+  struct inode *ip;
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  for(ip = (struct inode*)mem; ip + 1 <= (struct inode*)(mem + PGSIZE); ip++){
+    initsleeplock(&ip->lock, "inode");
+    lruadd(ip, 1);
+  }
+  return 0;
+}
+
+// Take the least recently used unreferenced entry
+// out of the cache, for iget() to reuse.
+static struct inode*
+ireclaim(void)
+{
+  struct inode *ip, **pp;
+  struct ibucket *b;
+
+  for(;;){
+    acquire(&icache.lock);
+    ip = icache.lru.next;
+    if(ip == &icache.lru){
+      // Every entry is referenced.
+      if(igrow() < 0)
+        panic("iget: no inodes");
+      release(&icache.lock);
+      continue;
+    }
+    if(ip->inum == 0){
+      lrudel(ip);
+      release(&icache.lock);
+      return ip;
+    }
+    b = ibucket(ip->dev, ip->inum);
+    release(&icache.lock);
+
+    // Lock ip's bucket, then check that no one
+    // has taken or recycled ip in the meantime.
+    acquire(&b->lock);
+    acquire(&icache.lock);
+    if(ip->ref == 0 && ip->inum != 0 && ibucket(ip->dev, ip->inum) == b){
+      lrudel(ip);
+      for(pp = &b->head; *pp != ip; pp = &(*pp)->hnext)
+        ;
+      *pp = ip->hnext;
+      ip->inum = 0;
+      release(&icache.lock);
+      release(&b->lock);
+      return ip;
+    }
+    release(&icache.lock);
+    release(&b->lock);
+  }
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
+  struct ibucket *b;
   struct inode *ip, *empty;
 
-  acquire(&icache.lock);
-
-  // Is the inode already cached?
+  b = ibucket(dev, inum);
   empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
-      return ip;
+  for(;;){
+    acquire(&b->lock);
+
+    // Is the inode already cached?
+    for(ip = b->head; ip; ip = ip->hnext){
+      if(ip->dev == dev && ip->inum == inum){
+        ip->ref++;
+        if(ip->ref == 1 || empty){
+          acquire(&icache.lock);
+          if(ip->ref == 1)
+            lrudel(ip);
+          if(empty)   // Recycled entry not needed after all.
+            lruadd(empty, 1);
+          release(&icache.lock);
+        }
+        release(&b->lock);
+        return ip;
+      }
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
-  }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
-
-  ip = empty;
-  ip->dev = dev;
-  ip->inum = inum;
-  ip->ref = 1;
-  ip->valid = 0;
-  release(&icache.lock);
+    if(empty){
+      ip = empty;
+      ip->dev = dev;
+      ip->inum = inum;
+      ip->ref = 1;
+      ip->valid = 0;
+      ip->hnext = b->head;
+      b->head = ip;
+      release(&b->lock);
+      return ip;
+    }
 
-  return ip;
+    // Recycle an inode cache entry, then look again,
+    // since the bucket lock was not held meanwhile.
+    release(&b->lock);
+    empty = ireclaim();
+  }
 }
 
 // Increment reference count for ip.
@@ -277,9 +472,12 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *b;
+
+  b = ibucket(ip->dev, ip->inum);
+  acquire(&b->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&b->lock);
   return ip;
 }
 
@@ -306,6 +504,7 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->exlen = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -324,7 +523,7 @@ iunlock(struct inode *ip)
 
 // Drop a reference to an in-memory inode.
 // If that was the last reference, the inode cache entry can
-// be recycled.
+// be recycled, least recently used first.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -332,14 +531,19 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *b;
+
+  b = ibucket(ip->dev, ip->inum);
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&b->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&b->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
+      if(ip->type == T_DIR)
+        dcpurge(ip->dev, ip->inum);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
@@ -347,9 +551,14 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  acquire(&b->lock);
+  if(--ip->ref == 0){
+    // Freed inodes are recycled first.
+    acquire(&icache.lock);
+    lruadd(ip, !ip->valid);
+    release(&icache.lock);
+  }
+  release(&b->lock);
 }
 
 // Common idiom: unlock, then put.
@@ -366,19 +575,51 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. The next NDINDIRECT
+// blocks are listed in the indirect blocks listed in block
+// ip->addrs[NDIRECT+1].
+//
+// The in-memory inode caches the last extent bmap found:
+// a run of file blocks stored in consecutive disk blocks.
+// Sequential I/O within an extent does not read any
+// indirect blocks.
+
+// Cache the extent around file block bn, where a[] lists
+// the n disk blocks of file blocks base..base+n-1.
+static void
+setextent(struct inode *ip, uint *a, uint n, uint base, uint bn)
+{
+  uint i, j;
+
+  i = j = bn - base;
+  while(i > 0 && a[i-1] && a[i-1] + 1 == a[i])
+    i--;
+  while(j+1 < n && a[j+1] == a[j] + 1)
+    j++;
+  ip->exbn = base + i;
+  ip->exaddr = a[i];
+  ip->exlen = j - i + 1;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, fbn, near;
   struct buf *bp;
 
+  if(bn - ip->exbn < ip->exlen)
+    return ip->exaddr + (bn - ip->exbn);
+  fbn = bn;
+  // Allocate after the last block bmap translated, so that
+  // files written sequentially are laid out contiguously.
+  near = ip->exlen ? ip->exaddr + ip->exlen - 1 : 0;
+
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev, near);
+    setextent(ip, ip->addrs, NDIRECT, 0, fbn);
     return addr;
   }
   bn -= NDIRECT;
@@ -386,20 +627,63 @@ bmap(struct inode *ip, uint bn)
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+      ip->addrs[NDIRECT] = addr = near = balloc(ip->dev, near);
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+      a[bn] = addr = balloc(ip->dev, near);
+      log_write(bp);
+    }
+    setextent(ip, a, NINDIRECT, NDIRECT, fbn);
+    brelse(bp);
+    return addr;
+  }
+  bn -= NINDIRECT;
+
+  if(bn < NDINDIRECT){
+    // Load double-indirect block, then the indirect
+    // block it lists, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT+1]) == 0)
+      ip->addrs[NDIRECT+1] = addr = near = balloc(ip->dev, near);
+    bp = bread(ip->dev, addr);
+    a = (uint*)bp->data;
+    if((addr = a[bn/NINDIRECT]) == 0){
+      a[bn/NINDIRECT] = addr = near = balloc(ip->dev, near);
       log_write(bp);
     }
     brelse(bp);
+    bp = bread(ip->dev, addr);
+    a = (uint*)bp->data;
+    if((addr = a[bn%NINDIRECT]) == 0){
+      a[bn%NINDIRECT] = addr = balloc(ip->dev, near);
+      log_write(bp);
+    }
+    setextent(ip, a, NINDIRECT, fbn - bn%NINDIRECT, fbn);
+    brelse(bp);
     return addr;
   }
 
   panic("bmap: out of range");
 }
 
+// Free the blocks listed in indirect block addr.
+static void
+ifreeind(uint dev, uint addr)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
+
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j])
+      bfree(dev, a[j]);
+  }
+  brelse(bp);
+  bfree(dev, addr);
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
@@ -412,6 +696,7 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  pcdrop(ip, 0, MAXFILE*BSIZE/PGSIZE);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -420,17 +705,23 @@ itrunc(struct inode *ip)
   }
 
   if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+    ifreeind(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  if(ip->addrs[NDIRECT+1]){
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
       if(a[j])
-        bfree(ip->dev, a[j]);
+        ifreeind(ip->dev, a[j]);
     }
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
   }
 
+  ip->exlen = 0;
   ip->size = 0;
   iupdate(ip);
 }
@@ -447,6 +738,112 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Page cache.
+//
+// Zero-copy reads map whole pages of a file into the reader
+// from here, read-only and copy-on-write, so reading a cached
+// page again only updates a page table. A page is filled from
+// the buffer cache once and never written after that: writei()
+// and itrunc() drop the pages they make stale, and readers
+// that mapped one keep the old contents, as if they had copied
+// them. A file's inode lock orders its reads, writes and fills;
+// pcache.lock protects the table.
+
+struct cpage {
+  uint dev;
+  uint inum;          // file the page belongs to, 0 if unused
+  uint pgno;          // page number within the file
+  char *pg;           // the cache's reference to the page
+};
+
+struct {
+  struct spinlock lock;
+  struct cpage page[NPCACHE];
+  int hand;           // next page to recycle
+} pcache;
+
+static void
+pcinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Forget the cached pages lo..hi of file ip.
+static void
+pcdrop(struct inode *ip, uint lo, uint hi)
+{
+  struct cpage *c;
+
+  acquire(&pcache.lock);
+  for(c = pcache.page; c < &pcache.page[NPCACHE]; c++){
+    if(c->inum == ip->inum && c->dev == ip->dev &&
+       c->pgno >= lo && c->pgno <= hi){
+      kfree(c->pg);
+      c->inum = 0;
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Return page pgno of file ip from the page cache, filling it
+// from the buffer cache on a miss, with a reference for the
+// caller; 0 if out of memory. Caller must hold ip->lock.
+static char*
+pcget(struct inode *ip, uint pgno)
+{
+  struct cpage *c;
+  struct buf *bp;
+  char *pg;
+  int i;
+
+  acquire(&pcache.lock);
+  for(c = pcache.page; c < &pcache.page[NPCACHE]; c++){
+    if(c->inum == ip->inum && c->dev == ip->dev && c->pgno == pgno){
+      kref(c->pg);
+      release(&pcache.lock);
+      return c->pg;
+    }
+  }
+  release(&pcache.lock);
+
+  if((pg = kalloc()) == 0)
+    return 0;
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+    bp = bread(ip->dev, bmap(ip, pgno*(PGSIZE/BSIZE) + i));
+    memmove(pg + i*BSIZE, bp->data, BSIZE);
+    brelse(bp);
+  }
+
+  acquire(&pcache.lock);
+  c = &pcache.page[pcache.hand];
+  pcache.hand = (pcache.hand + 1) % NPCACHE;
+  if(c->inum)
+    kfree(c->pg);
+  c->dev = ip->dev;
+  c->inum = ip->inum;
+  c->pgno = pgno;
+  c->pg = pg;
+  kref(pg);
+  release(&pcache.lock);
+  return pg;
+}
+
+// Map page pgno of file ip at dst, a page-aligned address
+// in the current process. Caller must hold ip->lock.
+static int
+pcmap(struct inode *ip, uint pgno, char *dst)
+{
+  char *pg;
+
+  if((pg = pcget(ip, pgno)) == 0)
+    return -1;
+  if(mapcow(myproc()->pgdir, dst, pg) < 0){
+    kfree(pg);
+    return -1;
+  }
+  return 0;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -459,7 +856,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
       return -1;
-    return devsw[ip->major].read(ip, dst, n);
+    return devsw[ip->major].read(ip, dst, off, n);
   }
 
   if(off > ip->size || off + n < off)
@@ -468,8 +865,16 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    // Whole pages of a file read into whole pages of user
+    // memory are mapped from the page cache, not copied.
+    if(ip->type == T_FILE && n - tot >= PGSIZE && off % PGSIZE == 0 &&
+       (uint)dst % PGSIZE == 0 && (uint)dst < KERNBASE &&
+       pcmap(ip, off/PGSIZE, dst) == 0){
+      m = PGSIZE;
+      continue;
+    }
     m = min(n - tot, BSIZE - off%BSIZE);
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
@@ -495,6 +900,8 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(n > 0)
+    pcdrop(ip, off/PGSIZE, (off+n-1)/PGSIZE);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -520,41 +927,557 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory name cache.
+//
+// The dcache remembers the results of recent directory
+// lookups, keyed by (device, directory i-number, name):
+// either the i-number and offset of the entry, or that
+// there is no such entry (a negative entry, with inum 0).
+// A directory's entries only change while its lock is
+// held, in dirlookup(), dirlink() and dcforget();
+// dcache.lock protects the table itself.
+
+#define DCHASH 64
+
+struct dentry {
+  uint dev;
+  uint dinum;         // directory holding the entry, 0 if unused
+  char name[DIRSIZ];
+  uint inum;          // 0 if the name is not present
+  uint off;           // byte offset of the entry in the directory
+  struct dentry *next;  // hash chain
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry dentry[NDENTRY];
+  struct dentry *hash[DCHASH];
+  int hand;           // next entry to recycle
+} dcache;
+
+static void
+dcinit(void)
+{
+  initlock(&dcache.lock, "dcache");
+}
+
+static struct dentry**
+dchash(uint dev, uint dinum, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dinum;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + name[i];
+  return &dcache.hash[h % DCHASH];
+}
+
+// Find the cached entry for name in directory dinum.
+// Caller must hold dcache.lock.
+static struct dentry*
+dcfind(uint dev, uint dinum, char *name)
+{
+  struct dentry *d;
+
+  for(d = *dchash(dev, dinum, name); d; d = d->next)
+    if(d->dev == dev && d->dinum == dinum && namecmp(name, d->name) == 0)
+      return d;
+  return 0;
+}
+
+// Remove d from its hash chain and mark it unused.
+// Caller must hold dcache.lock.
+static void
+dcremove(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = dchash(d->dev, d->dinum, d->name); *pp != d; pp = &(*pp)->next)
+    ;
+  *pp = d->next;
+  d->dinum = 0;
+}
+
+// Remember that name in dp is inum at offset off,
+// or that it is absent if inum is 0.
+static void
+dcenter(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d, **pp;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp->dev, dp->inum, name)) == 0){
+    d = &dcache.dentry[dcache.hand];
+    dcache.hand = (dcache.hand + 1) % NDENTRY;
+    if(d->dinum)
+      dcremove(d);
+    d->dev = dp->dev;
+    d->dinum = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    pp = dchash(d->dev, d->dinum, d->name);
+    d->next = *pp;
+    *pp = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  release(&dcache.lock);
+}
+
+// Forget what is cached about name in dp,
+// whose entry for name has been removed or moved.
+static void
+dcforget(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp->dev, dp->inum, name)) != 0)
+    dcremove(d);
+  release(&dcache.lock);
+}
+
+// Forget the entries of a directory being freed,
+// whose i-number may be reused.
+static void
+dcpurge(uint dev, uint dinum)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++)
+    if(d->dinum == dinum && d->dev == dev)
+      dcremove(d);
+  release(&dcache.lock);
+}
+
+// Scan directory dp for the entry named name, or for an
+// empty entry if name is 0, a block at a time, between byte
+// offsets off and end. Returns the byte offset of the entry
+// and sets *pinum to its i-number, or returns -1 if none.
+static int
+dirscan(struct inode *dp, char *name, uint *pinum, uint off, uint end)
+{
+  uint bend;
+  struct buf *bp;
+  struct dirent *de;
+
+  for(; off < end; off = bend){
+    bend = min(end, (off/BSIZE + 1) * BSIZE);
+    bp = bread(dp->dev, bmap(dp, off/BSIZE));
+    for(; off < bend; off += sizeof(*de)){
+      de = (struct dirent*)(bp->data + off%BSIZE);
+      if(name ? de->inum != 0 && namecmp(name, de->name) == 0 : de->inum == 0){
+        *pinum = de->inum;
+        brelse(bp);
+        return off;
+      }
+    }
+    brelse(bp);
+  }
+  return -1;
+}
+
+// Indexed directories.
+//
+// dxframe records the path from the root of the index to a
+// leaf: the index block visited at each level and the entry
+// followed in it.
+
+struct dxframe {
+  uint lblk;
+  int idx;
+};
+
+// Header of index block bp at the given level (0 is the root).
+static struct dxhdr*
+dxhdrof(struct buf *bp, int level)
+{
+  if(level == 0)
+    return (struct dxhdr*)(bp->data + 2*sizeof(struct dirent));
+  return (struct dxhdr*)bp->data;
+}
+
+// Entries of the index block with header h at level,
+// and how many it can hold.
+static struct dxentry*
+dxents(struct dxhdr *h, int level, int *pmax)
+{
+  if(level == 0){
+    *pmax = DXROOTENT;
+    return ((struct dxroot*)h)->ent;
+  }
+  *pmax = DXNODEENT;
+  return ((struct dxnode*)h)->ent;
+}
+
+// Is dp an indexed directory?
+static int
+dxindexed(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxhdr *h;
+  int r;
+
+  if(dp->size <= BSIZE)
+    return 0;
+  bp = bread(dp->dev, bmap(dp, 0));
+  h = dxhdrof(bp, 0);
+  r = h->zero == 0 && h->magic == DXMAGIC;
+  brelse(bp);
+  return r;
+}
+
+// Position of the last of the n entries in ent[] whose
+// hash is <= hash. ent[0] covers all smaller hashes.
+static int
+dxsearch(struct dxentry *ent, int n, uint hash)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(ent[mid].hash <= hash)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+// Walk the index of dp to the leaf block for hash,
+// recording the path in f[]. Returns the leaf block
+// and sets *pdepth to the number of index levels walked.
+static uint
+dxleaf(struct inode *dp, uint hash, struct dxframe *f, int *pdepth)
+{
+  struct buf *bp;
+  struct dxhdr *h;
+  struct dxentry *ent;
+  int level, levels, max;
+  uint lblk;
+
+  lblk = 0;
+  levels = 0;
+  for(level = 0; level <= levels; level++){
+    bp = bread(dp->dev, bmap(dp, lblk));
+    h = dxhdrof(bp, level);
+    if(level == 0)
+      levels = h->levels;
+    if(levels > DXMAXLEVELS || h->count == 0)
+      panic("dxleaf: bad index");
+    ent = dxents(h, level, &max);
+    f[level].lblk = lblk;
+    f[level].idx = dxsearch(ent, h->count, hash);
+    lblk = ent[f[level].idx].lblk;
+    brelse(bp);
+  }
+  *pdepth = level;
+  return lblk;
+}
+
+// Append a zeroed block to directory dp; return its number.
+static uint
+dirgrow(struct inode *dp)
+{
+  uint lblk;
+
+  lblk = dp->size / BSIZE;
+  bmap(dp, lblk);
+  dp->size += BSIZE;
+  iupdate(dp);
+  return lblk;
+}
+
+// Add delta to the count of entries in indexed directory dp.
+static void
+dxcount(struct inode *dp, int delta)
+{
+  struct buf *bp;
+
+  bp = bread(dp->dev, bmap(dp, 0));
+  ((struct dxroot*)dxhdrof(bp, 0))->nentries += delta;
+  log_write(bp);
+  brelse(bp);
+}
+
+// Convert directory dp, whose only block is full, to an indexed
+// directory: move its entries to a leaf in block 1 and put the
+// index root after "." and ".." in block 0.
+static int
+dxconvert(struct inode *dp)
+{
+  struct buf *bp, *lbp;
+  struct dirent *de;
+  struct dxroot *r;
+  int i, n;
+
+  bp = bread(dp->dev, bmap(dp, 0));
+  de = (struct dirent*)bp->data;
+  if(namecmp(de[0].name, ".") != 0 || namecmp(de[1].name, "..") != 0){
+    brelse(bp);
+    return -1;
+  }
+  brelse(bp);
+
+  dirgrow(dp);
+  bp = bread(dp->dev, bmap(dp, 0));
+  lbp = bread(dp->dev, bmap(dp, 1));
+  de = (struct dirent*)bp->data;
+  n = 0;
+  for(i = 2; i < BSIZE/sizeof(*de); i++)
+    if(de[i].inum)
+      memmove(lbp->data + n++*sizeof(*de), &de[i], sizeof(*de));
+  memset(bp->data + 2*sizeof(*de), 0, BSIZE - 2*sizeof(*de));
+  r = (struct dxroot*)dxhdrof(bp, 0);
+  r->h.magic = DXMAGIC;
+  r->h.count = 1;
+  r->nentries = n;
+  r->ent[0].lblk = 1;
+  log_write(bp);
+  log_write(lbp);
+  brelse(lbp);
+  brelse(bp);
+
+  dcpurge(dp->dev, dp->inum);  // offsets have changed
+  return 0;
+}
+
+// Insert an entry for block lblk, holding hashes from hash on,
+// after entry f[depth-1].idx of the deepest index block on the
+// path f[] to a leaf. Splits index blocks as needed.
+// Returns -1 if the index is full.
+static int
+dxinsert(struct inode *dp, struct dxframe *f, int depth, uint hash, uint lblk)
+{
+  struct buf *bp, *nbp;
+  struct dxhdr *h, *nh;
+  struct dxentry *ent, *nent;
+  int level, max, nmax, half, rootfull;
+  uint nblk;
+
+  level = depth - 1;
+  bp = bread(dp->dev, bmap(dp, f[level].lblk));
+  h = dxhdrof(bp, level);
+  ent = dxents(h, level, &max);
+  if(h->count < max){
+    memmove(&ent[f[level].idx+2], &ent[f[level].idx+1],
+            (h->count - f[level].idx - 1) * sizeof(*ent));
+    ent[f[level].idx+1].zero = 0;
+    ent[f[level].idx+1].lblk = lblk;
+    ent[f[level].idx+1].hash = hash;
+    h->count++;
+    log_write(bp);
+    brelse(bp);
+    return 0;
+  }
+  brelse(bp);
+
+  if(level == 0){
+    // Root is full: move its entries to a new interior node.
+    if(depth > DXMAXLEVELS)
+      return -1;
+    nblk = dirgrow(dp);
+    bp = bread(dp->dev, bmap(dp, 0));
+    nbp = bread(dp->dev, bmap(dp, nblk));
+    h = dxhdrof(bp, 0);
+    nh = dxhdrof(nbp, 1);
+    ent = dxents(h, 0, &max);
+    nent = dxents(nh, 1, &nmax);
+    memmove(nent, ent, h->count * sizeof(*ent));
+    nh->count = h->count;
+    h->count = 1;
+    h->levels = 1;
+    ent[0].lblk = nblk;
+    log_write(nbp);
+    log_write(bp);
+    brelse(nbp);
+    brelse(bp);
+    f[1].lblk = nblk;
+    f[1].idx = f[0].idx;
+    f[0].idx = 0;
+    return dxinsert(dp, f, 2, hash, lblk);
+  }
+
+  // Interior node is full: move its upper half to a new node,
+  // which the root must have room for.
+  bp = bread(dp->dev, bmap(dp, 0));
+  h = dxhdrof(bp, 0);
+  rootfull = h->count >= DXROOTENT;
+  brelse(bp);
+  if(rootfull)
+    return -1;
+  nblk = dirgrow(dp);
+  bp = bread(dp->dev, bmap(dp, f[1].lblk));
+  nbp = bread(dp->dev, bmap(dp, nblk));
+  h = dxhdrof(bp, 1);
+  nh = dxhdrof(nbp, 1);
+  ent = dxents(h, 1, &max);
+  nent = dxents(nh, 1, &nmax);
+  half = h->count / 2;
+  memmove(nent, &ent[half], (h->count - half) * sizeof(*ent));
+  nh->count = h->count - half;
+  h->count = half;
+  log_write(nbp);
+  log_write(bp);
+  if(dxinsert(dp, f, 1, nent[0].hash, nblk) < 0)
+    panic("dxinsert: root");
+  brelse(nbp);
+  brelse(bp);
+  if(f[1].idx >= half){
+    f[0].idx++;
+    f[1].lblk = nblk;
+    f[1].idx -= half;
+  }
+  return dxinsert(dp, f, 2, hash, lblk);
+}
+
+// Is there no room to add an entry to the index of dp
+// at the end of path f[], even by splitting index blocks?
+static int
+dxfull(struct inode *dp, struct dxframe *f, int depth)
+{
+  struct buf *bp;
+  struct dxhdr *h;
+  int level, max, full;
+
+  full = 1;
+  for(level = depth - 1; level >= 0 && full; level--){
+    bp = bread(dp->dev, bmap(dp, f[level].lblk));
+    h = dxhdrof(bp, level);
+    dxents(h, level, &max);
+    full = h->count >= max;
+    brelse(bp);
+  }
+  return full && depth > DXMAXLEVELS;
+}
+
+// Split the full leaf block lblk of indexed directory dp,
+// reached by path f[], moving the entries with the upper half
+// of its hashes to a new leaf. Returns -1 if it cannot be split.
+static int
+dxsplit(struct inode *dp, uint lblk, struct dxframe *f, int depth)
+{
+  struct buf *bp, *nbp;
+  struct dirent *de, *nde;
+  uint hash[BSIZE/sizeof(struct dirent)], split, x, nblk;
+  int i, j, n;
+
+  if(dxfull(dp, f, depth))
+    return -1;
+  bp = bread(dp->dev, bmap(dp, lblk));
+  de = (struct dirent*)bp->data;
+  n = 0;
+  for(i = 0; i < BSIZE/sizeof(*de); i++)
+    if(de[i].inum)
+      hash[n++] = dxhash(de[i].name);
+  brelse(bp);
+
+  // Sort the hashes and split at the median, keeping
+  // entries with equal hashes in the same leaf.
+  for(i = 1; i < n; i++){
+    x = hash[i];
+    for(j = i; j > 0 && hash[j-1] > x; j--)
+      hash[j] = hash[j-1];
+    hash[j] = x;
+  }
+  for(i = n/2; i > 0 && hash[i] == hash[i-1]; i--)
+    ;
+  if(i == 0)
+    for(i = n/2; i < n && hash[i] == hash[i-1]; i++)
+      ;
+  if(i == 0 || i == n)
+    return -1;
+  split = hash[i];
+
+  nblk = dirgrow(dp);
+  bp = bread(dp->dev, bmap(dp, lblk));
+  nbp = bread(dp->dev, bmap(dp, nblk));
+  de = (struct dirent*)bp->data;
+  nde = (struct dirent*)nbp->data;
+  for(i = 0; i < BSIZE/sizeof(*de); i++){
+    if(de[i].inum && dxhash(de[i].name) >= split){
+      dcforget(dp, de[i].name);  // moving
+      *nde++ = de[i];
+      memset(&de[i], 0, sizeof(de[i]));
+    }
+  }
+  log_write(nbp);
+  log_write(bp);
+  brelse(nbp);
+  brelse(bp);
+
+  if(dxinsert(dp, f, depth, split, nblk) < 0)
+    panic("dxsplit: index full");
+  return 0;
+}
+
+// Find the entry for name in directory dp.
+// Returns its byte offset and sets *pinum, or returns -1.
+static int
+dirfind(struct inode *dp, char *name, uint *pinum)
+{
+  struct dxframe f[DXMAXLEVELS+1];
+  int depth;
+  uint lblk;
+
+  if(!dxindexed(dp))
+    return dirscan(dp, name, pinum, 0, dp->size);
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+    return dirscan(dp, name, pinum, 0, 2*sizeof(struct dirent));
+  lblk = dxleaf(dp, dxhash(name), f, &depth);
+  return dirscan(dp, name, pinum, lblk*BSIZE, (lblk+1)*BSIZE);
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
-  struct dirent de;
+  uint inum;
+  int off;
+  struct dentry *d;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
-      continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
-    }
+  acquire(&dcache.lock);
+  if((d = dcfind(dp->dev, dp->inum, name)) != 0){
+    inum = d->inum;
+    off = d->off;
+    release(&dcache.lock);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+  release(&dcache.lock);
+
+  if((off = dirfind(dp, name, &inum)) >= 0){
+    // entry matches path element
+    if(poff)
+      *poff = off;
+    dcenter(dp, name, inum, off);
+    return iget(dp->dev, inum);
   }
 
+  dcenter(dp, name, 0, 0);
   return 0;
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Returns -1 if name is present or the directory is full.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, depth, indexed;
+  uint empty, lblk;
   struct dirent de;
   struct inode *ip;
+  struct dxframe f[DXMAXLEVELS+1];
 
   // Check that name is not present.
   if((ip = dirlookup(dp, name, 0)) != 0){
@@ -562,22 +1485,77 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  indexed = dxindexed(dp);
+  if(!indexed){
+    // Look for an empty dirent, else append,
+    // converting a full first block to an index.
+    if((off = dirscan(dp, 0, &empty, 0, dp->size)) < 0){
+      off = dp->size;
+      if(off == BSIZE && dxconvert(dp) == 0)
+        indexed = 1;
+    }
+  }
+  if(indexed){
+    // Look for an empty dirent in the leaf for name,
+    // splitting the leaf if it is full.
+    for(;;){
+      lblk = dxleaf(dp, dxhash(name), f, &depth);
+      off = dirscan(dp, 0, &empty, lblk*BSIZE, (lblk+1)*BSIZE);
+      if(off >= 0)
+        break;
+      if(dxsplit(dp, lblk, f, depth) < 0)
+        return -1;
+    }
+    dxcount(dp, 1);
   }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcenter(dp, name, inum, off);
 
   return 0;
 }
 
+// Remove the entry for name, found at byte offset off,
+// from directory dp.
+void
+dirunlink(struct inode *dp, char *name, uint off)
+{
+  struct dirent de;
+
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+  if(dxindexed(dp))
+    dxcount(dp, -1);
+  dcforget(dp, name);
+}
+
+// Is the directory dp empty except for "." and ".." ?
+int
+isdirempty(struct inode *dp)
+{
+  int off, empty;
+  struct dirent de;
+  struct buf *bp;
+
+  if(dxindexed(dp)){
+    bp = bread(dp->dev, bmap(dp, 0));
+    empty = ((struct dxroot*)dxhdrof(bp, 0))->nentries == 0;
+    brelse(bp);
+    return empty;
+  }
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+      return 0;
+  }
+  return 1;
+}
+
 //PAGEBREAK!
 // Paths
 
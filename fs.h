@@ -21,9 +21,10 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +33,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses
 };
 
 // Inodes per block.
@@ -55,3 +56,61 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+
+// Indexed directories.
+//
+// A directory that outgrows its first block is converted to an
+// indexed directory, like ext3's htree. Block 0 keeps "." and
+// "..", followed by the root of an index that maps ranges of
+// name hashes to the directory's other blocks. Those are leaf
+// blocks of ordinary dirents or, once the root fills up,
+// interior index nodes. Every 16-byte dirent slot of an index
+// begins with a zero, so programs that read a directory as an
+// array of dirents skip the index.
+
+#define DXMAGIC 0xd1c7
+#define DXMAXLEVELS 1    // levels of interior nodes below the root
+
+struct dxentry {
+  ushort zero;      // inum 0 for readers of dirents
+  ushort lblk;      // directory block for hashes >= hash
+  uint hash;
+};
+
+// Common header of the root and interior nodes.
+struct dxhdr {
+  ushort zero;
+  ushort magic;     // DXMAGIC in the root
+  ushort levels;    // interior node levels below the root
+  ushort count;     // entries in use
+};
+
+// Index root; follows "." and ".." in block 0.
+struct dxroot {
+  struct dxhdr h;
+  uint nentries;    // directory entries, not counting "." and ".."
+  uint unused;
+  struct dxentry ent[(BSIZE - 2*sizeof(struct dirent) - 16) / sizeof(struct dxentry)];
+};
+
+// Interior index node; fills a block.
+struct dxnode {
+  struct dxhdr h;
+  struct dxentry ent[(BSIZE - sizeof(struct dxhdr)) / sizeof(struct dxentry)];
+};
+
+#define DXROOTENT (sizeof(((struct dxroot*)0)->ent) / sizeof(struct dxentry))
+#define DXNODEENT (sizeof(((struct dxnode*)0)->ent) / sizeof(struct dxentry))
+
+// Hash of a directory entry name (FNV-1a).
+static inline uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
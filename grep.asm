@@ -0,0 +1,2468 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+      1c:	83 f8 01             	cmp    $0x1,%eax
+      1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+      21:	8b 43 04             	mov    0x4(%ebx),%eax
+      24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+      27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+      2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+      30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+      33:	75 2d                	jne    62 <main+0x62>
+      35:	eb 6c                	jmp    a3 <main+0xa3>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+      40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+      43:	83 c6 01             	add    $0x1,%esi
+      46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+      49:	50                   	push   %eax
+      4a:	ff 75 e0             	push   -0x20(%ebp)
+      4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+      52:	89 3c 24             	mov    %edi,(%esp)
+      55:	e8 c4 05 00 00       	call   61e <close>
+  for(i = 2; i < argc; i++){
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+      62:	83 ec 08             	sub    $0x8,%esp
+      65:	6a 00                	push   $0x0
+      67:	ff 33                	push   (%ebx)
+      69:	e8 c8 05 00 00       	call   636 <open>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	89 c7                	mov    %eax,%edi
+      73:	85 c0                	test   %eax,%eax
+      75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      77:	50                   	push   %eax
+      78:	ff 33                	push   (%ebx)
+      7a:	68 18 12 00 00       	push   $0x1218
+      7f:	6a 01                	push   $0x1
+      81:	e8 6a 0f 00 00       	call   ff0 <printf>
+      exit();
+      86:	e8 55 05 00 00       	call   5e0 <exit>
+  }
+  exit();
+      8b:	e8 50 05 00 00       	call   5e0 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+      90:	51                   	push   %ecx
+      91:	51                   	push   %ecx
+      92:	68 f8 11 00 00       	push   $0x11f8
+      97:	6a 02                	push   $0x2
+      99:	e8 52 0f 00 00       	call   ff0 <printf>
+    exit();
+      9e:	e8 3d 05 00 00       	call   5e0 <exit>
+    grep(pattern, 0);
+      a3:	52                   	push   %edx
+      a4:	52                   	push   %edx
+      a5:	6a 00                	push   $0x0
+      a7:	50                   	push   %eax
+      a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+      ad:	e8 2e 05 00 00       	call   5e0 <exit>
+      b2:	66 90                	xchg   %ax,%ax
+      b4:	66 90                	xchg   %ax,%ax
+      b6:	66 90                	xchg   %ax,%ax
+      b8:	66 90                	xchg   %ax,%ax
+      ba:	66 90                	xchg   %ax,%ax
+      bc:	66 90                	xchg   %ax,%ax
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+      c6:	83 ec 0c             	sub    $0xc,%esp
+      c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+      cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+      cf:	0f b6 0f             	movzbl (%edi),%ecx
+      d2:	84 c9                	test   %cl,%cl
+      d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+      da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      de:	3c 2a                	cmp    $0x2a,%al
+      e0:	74 2d                	je     10f <matchhere+0x4f>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+      e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+      eb:	80 f9 24             	cmp    $0x24,%cl
+      ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      f0:	89 f2                	mov    %esi,%edx
+      f2:	84 d2                	test   %dl,%dl
+      f4:	74 6e                	je     164 <matchhere+0xa4>
+      f6:	80 f9 2e             	cmp    $0x2e,%cl
+      f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+      fb:	83 c3 01             	add    $0x1,%ebx
+      fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     101:	84 c0                	test   %al,%al
+     103:	74 6b                	je     170 <matchhere+0xb0>
+     105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+     107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     10b:	3c 2a                	cmp    $0x2a,%al
+     10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+     10f:	8d 77 02             	lea    0x2(%edi),%esi
+     112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+     115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	53                   	push   %ebx
+     11c:	56                   	push   %esi
+     11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+     122:	83 c4 10             	add    $0x10,%esp
+     125:	85 c0                	test   %eax,%eax
+     127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     129:	0f be 13             	movsbl (%ebx),%edx
+     12c:	84 d2                	test   %dl,%dl
+     12e:	74 45                	je     175 <matchhere+0xb5>
+     130:	83 c3 01             	add    $0x1,%ebx
+     133:	39 fa                	cmp    %edi,%edx
+     135:	74 e1                	je     118 <matchhere+0x58>
+     137:	83 ff 2e             	cmp    $0x2e,%edi
+     13a:	74 dc                	je     118 <matchhere+0x58>
+     13c:	eb 37                	jmp    175 <matchhere+0xb5>
+     13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+     140:	84 c0                	test   %al,%al
+     142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     144:	89 f2                	mov    %esi,%edx
+     146:	84 d2                	test   %dl,%dl
+     148:	74 1a                	je     164 <matchhere+0xa4>
+     14a:	80 fa 24             	cmp    $0x24,%dl
+     14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+     14f:	83 c3 01             	add    $0x1,%ebx
+     152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     155:	89 c1                	mov    %eax,%ecx
+     157:	eb ae                	jmp    107 <matchhere+0x47>
+     159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     160:	38 ca                	cmp    %cl,%dl
+     162:	74 97                	je     fb <matchhere+0x3b>
+}
+     164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     167:	31 c0                	xor    %eax,%eax
+}
+     169:	5b                   	pop    %ebx
+     16a:	5e                   	pop    %esi
+     16b:	5f                   	pop    %edi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+    return 1;
+     170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     178:	5b                   	pop    %ebx
+     179:	5e                   	pop    %esi
+     17a:	5f                   	pop    %edi
+     17b:	5d                   	pop    %ebp
+     17c:	c3                   	ret
+    return *text == '\0';
+     17d:	89 f0                	mov    %esi,%eax
+     17f:	84 c0                	test   %al,%al
+     181:	0f 94 c0             	sete   %al
+     184:	0f b6 c0             	movzbl %al,%eax
+     187:	eb ec                	jmp    175 <matchhere+0xb5>
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+     19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+     19e:	75 11                	jne    1b1 <match+0x21>
+     1a0:	eb 2e                	jmp    1d0 <match+0x40>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     1a8:	83 c6 01             	add    $0x1,%esi
+     1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+     1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+     1b1:	83 ec 08             	sub    $0x8,%esp
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+     1bb:	83 c4 10             	add    $0x10,%esp
+     1be:	85 c0                	test   %eax,%eax
+     1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+     1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     1d0:	83 c3 01             	add    $0x1,%ebx
+     1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1d9:	5b                   	pop    %ebx
+     1da:	5e                   	pop    %esi
+     1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+     1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	57                   	push   %edi
+  m = 0;
+     1f4:	31 ff                	xor    %edi,%edi
+{
+     1f6:	56                   	push   %esi
+     1f7:	53                   	push   %ebx
+     1f8:	83 ec 1c             	sub    $0x1c,%esp
+     1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+     201:	8d 43 01             	lea    0x1(%ebx),%eax
+     204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     218:	83 ec 04             	sub    $0x4,%esp
+     21b:	29 c8                	sub    %ecx,%eax
+     21d:	50                   	push   %eax
+     21e:	8d 81 40 18 00 00    	lea    0x1840(%ecx),%eax
+     224:	50                   	push   %eax
+     225:	ff 75 0c             	push   0xc(%ebp)
+     228:	e8 e1 03 00 00       	call   60e <read>
+     22d:	83 c4 10             	add    $0x10,%esp
+     230:	85 c0                	test   %eax,%eax
+     232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+     238:	01 45 e0             	add    %eax,-0x20(%ebp)
+     23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+     23e:	bf 40 18 00 00       	mov    $0x1840,%edi
+     243:	89 de                	mov    %ebx,%esi
+     245:	c6 81 40 18 00 00 00 	movb   $0x0,0x1840(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	6a 0a                	push   $0xa
+     255:	57                   	push   %edi
+     256:	e8 25 02 00 00       	call   480 <strchr>
+     25b:	83 c4 10             	add    $0x10,%esp
+     25e:	89 c2                	mov    %eax,%edx
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+     268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     26e:	74 58                	je     2c8 <grep+0xd8>
+     270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     273:	89 d3                	mov    %edx,%ebx
+     275:	eb 12                	jmp    289 <grep+0x99>
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+     280:	83 c7 01             	add    $0x1,%edi
+     283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+     289:	83 ec 08             	sub    $0x8,%esp
+     28c:	57                   	push   %edi
+     28d:	56                   	push   %esi
+     28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+     293:	83 c4 10             	add    $0x10,%esp
+     296:	85 c0                	test   %eax,%eax
+     298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+     29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     29d:	89 da                	mov    %ebx,%edx
+     29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     2a2:	89 d8                	mov    %ebx,%eax
+     2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+     2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+     2aa:	29 f8                	sub    %edi,%eax
+     2ac:	50                   	push   %eax
+     2ad:	57                   	push   %edi
+     2ae:	89 df                	mov    %ebx,%edi
+     2b0:	6a 01                	push   $0x1
+     2b2:	e8 5f 03 00 00       	call   616 <write>
+     2b7:	83 c4 10             	add    $0x10,%esp
+     2ba:	eb 94                	jmp    250 <grep+0x60>
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+     2c3:	eb 8b                	jmp    250 <grep+0x60>
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     2ce:	57                   	push   %edi
+     2cf:	ff 75 dc             	push   -0x24(%ebp)
+     2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+     2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+     2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+     2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+     2e4:	89 df                	mov    %ebx,%edi
+     2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+    if(p == buf)
+     2f0:	89 f3                	mov    %esi,%ebx
+     2f2:	81 ff 40 18 00 00    	cmp    $0x1840,%edi
+     2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+     2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2fd:	85 c0                	test   %eax,%eax
+     2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+     305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+     307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     30a:	2d 40 18 00 00       	sub    $0x1840,%eax
+     30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+     312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+     315:	51                   	push   %ecx
+     316:	57                   	push   %edi
+     317:	68 40 18 00 00       	push   $0x1840
+     31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+     321:	83 c4 10             	add    $0x10,%esp
+     324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+     329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+     335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     338:	5b                   	pop    %ebx
+     339:	5e                   	pop    %esi
+     33a:	5f                   	pop    %edi
+     33b:	5d                   	pop    %ebp
+     33c:	c3                   	ret
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	53                   	push   %ebx
+     346:	83 ec 0c             	sub    $0xc,%esp
+     349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+     34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	57                   	push   %edi
+     35c:	56                   	push   %esi
+     35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+     362:	83 c4 10             	add    $0x10,%esp
+     365:	85 c0                	test   %eax,%eax
+     367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     369:	0f be 17             	movsbl (%edi),%edx
+     36c:	84 d2                	test   %dl,%dl
+     36e:	74 0c                	je     37c <matchstar+0x3c>
+     370:	83 c7 01             	add    $0x1,%edi
+     373:	39 da                	cmp    %ebx,%edx
+     375:	74 e1                	je     358 <matchstar+0x18>
+     377:	83 fb 2e             	cmp    $0x2e,%ebx
+     37a:	74 dc                	je     358 <matchstar+0x18>
+}
+     37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     37f:	5b                   	pop    %ebx
+     380:	5e                   	pop    %esi
+     381:	5f                   	pop    %edi
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+     384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     390:	5b                   	pop    %ebx
+     391:	5e                   	pop    %esi
+     392:	5f                   	pop    %edi
+     393:	5d                   	pop    %ebp
+     394:	c3                   	ret
+     395:	66 90                	xchg   %ax,%ax
+     397:	66 90                	xchg   %ax,%ax
+     399:	66 90                	xchg   %ax,%ax
+     39b:	66 90                	xchg   %ax,%ax
+     39d:	66 90                	xchg   %ax,%ax
+     39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3a1:	31 c0                	xor    %eax,%eax
+{
+     3a3:	89 e5                	mov    %esp,%ebp
+     3a5:	53                   	push   %ebx
+     3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     3b7:	83 c0 01             	add    $0x1,%eax
+     3ba:	84 d2                	test   %dl,%dl
+     3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c1:	89 c8                	mov    %ecx,%eax
+     3c3:	c9                   	leave
+     3c4:	c3                   	ret
+     3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3da:	0f b6 02             	movzbl (%edx),%eax
+     3dd:	84 c0                	test   %al,%al
+     3df:	75 17                	jne    3f8 <strcmp+0x28>
+     3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+     3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e7:	90                   	nop
+     3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     3ec:	83 c2 01             	add    $0x1,%edx
+     3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     3f2:	84 c0                	test   %al,%al
+     3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+     3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     3f8:	0f b6 19             	movzbl (%ecx),%ebx
+     3fb:	38 c3                	cmp    %al,%bl
+     3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     3ff:	29 d8                	sub    %ebx,%eax
+}
+     401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     404:	c9                   	leave
+     405:	c3                   	ret
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     414:	31 c0                	xor    %eax,%eax
+     416:	29 d8                	sub    %ebx,%eax
+}
+     418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     41b:	c9                   	leave
+     41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     41d:	0f b6 19             	movzbl (%ecx),%ebx
+     420:	31 c0                	xor    %eax,%eax
+     422:	eb db                	jmp    3ff <strcmp+0x2f>
+     424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     436:	80 3a 00             	cmpb   $0x0,(%edx)
+     439:	74 15                	je     450 <strlen+0x20>
+     43b:	31 c0                	xor    %eax,%eax
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+     440:	83 c0 01             	add    $0x1,%eax
+     443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     447:	89 c1                	mov    %eax,%ecx
+     449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+     44b:	89 c8                	mov    %ecx,%eax
+     44d:	5d                   	pop    %ebp
+     44e:	c3                   	ret
+     44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     450:	31 c9                	xor    %ecx,%ecx
+}
+     452:	5d                   	pop    %ebp
+     453:	89 c8                	mov    %ecx,%eax
+     455:	c3                   	ret
+     456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46d:	89 d7                	mov    %edx,%edi
+     46f:	fc                   	cld
+     470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     475:	89 d0                	mov    %edx,%eax
+     477:	c9                   	leave
+     478:	c3                   	ret
+     479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	8b 45 08             	mov    0x8(%ebp),%eax
+     486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     48a:	0f b6 10             	movzbl (%eax),%edx
+     48d:	84 d2                	test   %dl,%dl
+     48f:	75 12                	jne    4a3 <strchr+0x23>
+     491:	eb 1d                	jmp    4b0 <strchr+0x30>
+     493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     497:	90                   	nop
+     498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     49c:	83 c0 01             	add    $0x1,%eax
+     49f:	84 d2                	test   %dl,%dl
+     4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+     4a3:	38 d1                	cmp    %dl,%cl
+     4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4a7:	5d                   	pop    %ebp
+     4a8:	c3                   	ret
+     4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4b0:	31 c0                	xor    %eax,%eax
+}
+     4b2:	5d                   	pop    %ebp
+     4b3:	c3                   	ret
+     4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     4c9:	31 db                	xor    %ebx,%ebx
+{
+     4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	6a 01                	push   $0x1
+     4d5:	56                   	push   %esi
+     4d6:	6a 00                	push   $0x0
+     4d8:	e8 31 01 00 00       	call   60e <read>
+    if(cc < 1)
+     4dd:	83 c4 10             	add    $0x10,%esp
+     4e0:	85 c0                	test   %eax,%eax
+     4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+     4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     4ef:	3c 0a                	cmp    $0xa,%al
+     4f1:	74 10                	je     503 <gets+0x43>
+     4f3:	3c 0d                	cmp    $0xd,%al
+     4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     4f7:	89 df                	mov    %ebx,%edi
+     4f9:	83 c3 01             	add    $0x1,%ebx
+     4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     4ff:	7c cf                	jl     4d0 <gets+0x10>
+     501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     503:	8b 45 08             	mov    0x8(%ebp),%eax
+     506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     50d:	5b                   	pop    %ebx
+     50e:	5e                   	pop    %esi
+     50f:	5f                   	pop    %edi
+     510:	5d                   	pop    %ebp
+     511:	c3                   	ret
+     512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+     524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     525:	83 ec 08             	sub    $0x8,%esp
+     528:	6a 00                	push   $0x0
+     52a:	ff 75 08             	push   0x8(%ebp)
+     52d:	e8 04 01 00 00       	call   636 <open>
+  if(fd < 0)
+     532:	83 c4 10             	add    $0x10,%esp
+     535:	85 c0                	test   %eax,%eax
+     537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     539:	83 ec 08             	sub    $0x8,%esp
+     53c:	ff 75 0c             	push   0xc(%ebp)
+     53f:	89 c3                	mov    %eax,%ebx
+     541:	50                   	push   %eax
+     542:	e8 07 01 00 00       	call   64e <fstat>
+  close(fd);
+     547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     54c:	e8 cd 00 00 00       	call   61e <close>
+  return r;
+     551:	83 c4 10             	add    $0x10,%esp
+}
+     554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     557:	89 f0                	mov    %esi,%eax
+     559:	5b                   	pop    %ebx
+     55a:	5e                   	pop    %esi
+     55b:	5d                   	pop    %ebp
+     55c:	c3                   	ret
+     55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     565:	eb ed                	jmp    554 <stat+0x34>
+     567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	53                   	push   %ebx
+     574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     577:	0f be 02             	movsbl (%edx),%eax
+     57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     585:	77 1e                	ja     5a5 <atoi+0x35>
+     587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     590:	83 c2 01             	add    $0x1,%edx
+     593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     59a:	0f be 02             	movsbl (%edx),%eax
+     59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5a0:	80 fb 09             	cmp    $0x9,%bl
+     5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+     5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5a8:	89 c8                	mov    %ecx,%eax
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+     5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5be:	85 c0                	test   %eax,%eax
+     5c0:	7e 13                	jle    5d5 <memmove+0x25>
+     5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     5c4:	89 d7                	mov    %edx,%edi
+     5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5d1:	39 f8                	cmp    %edi,%eax
+     5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+     5d5:	5e                   	pop    %esi
+     5d6:	89 d0                	mov    %edx,%eax
+     5d8:	5f                   	pop    %edi
+     5d9:	5d                   	pop    %ebp
+     5da:	c3                   	ret
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+     5e6:	a1 40 1c 00 00       	mov    0x1c40,%eax
+     5eb:	85 c0                	test   %eax,%eax
+     5ed:	74 02                	je     5f1 <exit+0x11>
+    exithook();
+     5ef:	ff d0                	call   *%eax
+  _exit();
+     5f1:	e8 10 01 00 00       	call   706 <_exit>
+
+000005f6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     5f6:	b8 01 00 00 00       	mov    $0x1,%eax
+     5fb:	cd 40                	int    $0x40
+     5fd:	c3                   	ret
+
+000005fe <wait>:
+SYSCALL(wait)
+     5fe:	b8 03 00 00 00       	mov    $0x3,%eax
+     603:	cd 40                	int    $0x40
+     605:	c3                   	ret
+
+00000606 <pipe>:
+SYSCALL(pipe)
+     606:	b8 04 00 00 00       	mov    $0x4,%eax
+     60b:	cd 40                	int    $0x40
+     60d:	c3                   	ret
+
+0000060e <read>:
+SYSCALL(read)
+     60e:	b8 05 00 00 00       	mov    $0x5,%eax
+     613:	cd 40                	int    $0x40
+     615:	c3                   	ret
+
+00000616 <write>:
+SYSCALL(write)
+     616:	b8 10 00 00 00       	mov    $0x10,%eax
+     61b:	cd 40                	int    $0x40
+     61d:	c3                   	ret
+
+0000061e <close>:
+SYSCALL(close)
+     61e:	b8 15 00 00 00       	mov    $0x15,%eax
+     623:	cd 40                	int    $0x40
+     625:	c3                   	ret
+
+00000626 <kill>:
+SYSCALL(kill)
+     626:	b8 06 00 00 00       	mov    $0x6,%eax
+     62b:	cd 40                	int    $0x40
+     62d:	c3                   	ret
+
+0000062e <exec>:
+SYSCALL(exec)
+     62e:	b8 07 00 00 00       	mov    $0x7,%eax
+     633:	cd 40                	int    $0x40
+     635:	c3                   	ret
+
+00000636 <open>:
+SYSCALL(open)
+     636:	b8 0f 00 00 00       	mov    $0xf,%eax
+     63b:	cd 40                	int    $0x40
+     63d:	c3                   	ret
+
+0000063e <mknod>:
+SYSCALL(mknod)
+     63e:	b8 11 00 00 00       	mov    $0x11,%eax
+     643:	cd 40                	int    $0x40
+     645:	c3                   	ret
+
+00000646 <unlink>:
+SYSCALL(unlink)
+     646:	b8 12 00 00 00       	mov    $0x12,%eax
+     64b:	cd 40                	int    $0x40
+     64d:	c3                   	ret
+
+0000064e <fstat>:
+SYSCALL(fstat)
+     64e:	b8 08 00 00 00       	mov    $0x8,%eax
+     653:	cd 40                	int    $0x40
+     655:	c3                   	ret
+
+00000656 <link>:
+SYSCALL(link)
+     656:	b8 13 00 00 00       	mov    $0x13,%eax
+     65b:	cd 40                	int    $0x40
+     65d:	c3                   	ret
+
+0000065e <mkdir>:
+SYSCALL(mkdir)
+     65e:	b8 14 00 00 00       	mov    $0x14,%eax
+     663:	cd 40                	int    $0x40
+     665:	c3                   	ret
+
+00000666 <chdir>:
+SYSCALL(chdir)
+     666:	b8 09 00 00 00       	mov    $0x9,%eax
+     66b:	cd 40                	int    $0x40
+     66d:	c3                   	ret
+
+0000066e <dup>:
+SYSCALL(dup)
+     66e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     673:	cd 40                	int    $0x40
+     675:	c3                   	ret
+
+00000676 <getpid>:
+SYSCALL(getpid)
+     676:	b8 0b 00 00 00       	mov    $0xb,%eax
+     67b:	cd 40                	int    $0x40
+     67d:	c3                   	ret
+
+0000067e <sbrk>:
+SYSCALL(sbrk)
+     67e:	b8 0c 00 00 00       	mov    $0xc,%eax
+     683:	cd 40                	int    $0x40
+     685:	c3                   	ret
+
+00000686 <sleep>:
+SYSCALL(sleep)
+     686:	b8 0d 00 00 00       	mov    $0xd,%eax
+     68b:	cd 40                	int    $0x40
+     68d:	c3                   	ret
+
+0000068e <uptime>:
+SYSCALL(uptime)
+     68e:	b8 0e 00 00 00       	mov    $0xe,%eax
+     693:	cd 40                	int    $0x40
+     695:	c3                   	ret
+
+00000696 <sigprocmask>:
+SYSCALL(sigprocmask)
+     696:	b8 16 00 00 00       	mov    $0x16,%eax
+     69b:	cd 40                	int    $0x40
+     69d:	c3                   	ret
+
+0000069e <sigaction>:
+SYSCALL(sigaction)
+     69e:	b8 17 00 00 00       	mov    $0x17,%eax
+     6a3:	cd 40                	int    $0x40
+     6a5:	c3                   	ret
+
+000006a6 <sigret>:
+SYSCALL(sigret)
+     6a6:	b8 18 00 00 00       	mov    $0x18,%eax
+     6ab:	cd 40                	int    $0x40
+     6ad:	c3                   	ret
+
+000006ae <readv>:
+SYSCALL(readv)
+     6ae:	b8 19 00 00 00       	mov    $0x19,%eax
+     6b3:	cd 40                	int    $0x40
+     6b5:	c3                   	ret
+
+000006b6 <writev>:
+SYSCALL(writev)
+     6b6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     6bb:	cd 40                	int    $0x40
+     6bd:	c3                   	ret
+
+000006be <nanosleep>:
+SYSCALL(nanosleep)
+     6be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     6c3:	cd 40                	int    $0x40
+     6c5:	c3                   	ret
+
+000006c6 <setpriority>:
+SYSCALL(setpriority)
+     6c6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6cb:	cd 40                	int    $0x40
+     6cd:	c3                   	ret
+
+000006ce <sched_setattr>:
+SYSCALL(sched_setattr)
+     6ce:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     6d3:	cd 40                	int    $0x40
+     6d5:	c3                   	ret
+
+000006d6 <sched_yield>:
+SYSCALL(sched_yield)
+     6d6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6db:	cd 40                	int    $0x40
+     6dd:	c3                   	ret
+
+000006de <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     6de:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     6e3:	cd 40                	int    $0x40
+     6e5:	c3                   	ret
+
+000006e6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     6e6:	b8 20 00 00 00       	mov    $0x20,%eax
+     6eb:	cd 40                	int    $0x40
+     6ed:	c3                   	ret
+
+000006ee <getrusage>:
+SYSCALL(getrusage)
+     6ee:	b8 21 00 00 00       	mov    $0x21,%eax
+     6f3:	cd 40                	int    $0x40
+     6f5:	c3                   	ret
+
+000006f6 <syslat>:
+SYSCALL(syslat)
+     6f6:	b8 22 00 00 00       	mov    $0x22,%eax
+     6fb:	cd 40                	int    $0x40
+     6fd:	c3                   	ret
+
+000006fe <sched_getattr>:
+SYSCALL(sched_getattr)
+     6fe:	b8 23 00 00 00       	mov    $0x23,%eax
+     703:	cd 40                	int    $0x40
+     705:	c3                   	ret
+
+00000706 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+     706:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+     70b:	cd 40                	int    $0x40
+  ret
+     70d:	c3                   	ret
+     70e:	66 90                	xchg   %ax,%ax
+
+00000710 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	56                   	push   %esi
+     714:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+     715:	31 db                	xor    %ebx,%ebx
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+     720:	8b 34 9d 60 1c 00 00 	mov    0x1c60(,%ebx,4),%esi
+     727:	85 f6                	test   %esi,%esi
+     729:	74 27                	je     752 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     72b:	8b 46 08             	mov    0x8(%esi),%eax
+     72e:	85 c0                	test   %eax,%eax
+     730:	7e 12                	jle    744 <flushall+0x34>
+     732:	83 ec 04             	sub    $0x4,%esp
+     735:	50                   	push   %eax
+     736:	8d 46 10             	lea    0x10(%esi),%eax
+     739:	50                   	push   %eax
+     73a:	ff 36                	push   (%esi)
+     73c:	e8 d5 fe ff ff       	call   616 <write>
+     741:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+     744:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     74b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+     752:	83 c3 01             	add    $0x1,%ebx
+     755:	83 fb 10             	cmp    $0x10,%ebx
+     758:	75 c6                	jne    720 <flushall+0x10>
+}
+     75a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     75d:	5b                   	pop    %ebx
+     75e:	5e                   	pop    %esi
+     75f:	5d                   	pop    %ebp
+     760:	c3                   	ret
+     761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	53                   	push   %ebx
+     776:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     778:	89 d1                	mov    %edx,%ecx
+{
+     77a:	83 ec 2c             	sub    $0x2c,%esp
+     77d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     780:	85 d2                	test   %edx,%edx
+     782:	0f 89 c8 00 00 00    	jns    850 <printint+0xe0>
+     788:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     78c:	0f 84 be 00 00 00    	je     850 <printint+0xe0>
+    x = -xx;
+     792:	f7 d9                	neg    %ecx
+    neg = 1;
+     794:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     799:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     79c:	31 f6                	xor    %esi,%esi
+     79e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+     7a0:	89 c8                	mov    %ecx,%eax
+     7a2:	31 d2                	xor    %edx,%edx
+     7a4:	89 f7                	mov    %esi,%edi
+     7a6:	f7 f3                	div    %ebx
+     7a8:	8d 76 01             	lea    0x1(%esi),%esi
+     7ab:	0f b6 92 90 12 00 00 	movzbl 0x1290(%edx),%edx
+     7b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     7b6:	89 ca                	mov    %ecx,%edx
+     7b8:	89 c1                	mov    %eax,%ecx
+     7ba:	39 da                	cmp    %ebx,%edx
+     7bc:	73 e2                	jae    7a0 <printint+0x30>
+  if(neg)
+     7be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     7c1:	85 c0                	test   %eax,%eax
+     7c3:	74 07                	je     7cc <printint+0x5c>
+    buf[i++] = '-';
+     7c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     7ca:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+     7cc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     7cf:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     7d2:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     7d4:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+     7d7:	8b 41 08             	mov    0x8(%ecx),%eax
+     7da:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     7dd:	89 ce                	mov    %ecx,%esi
+     7df:	eb 28                	jmp    809 <printint+0x99>
+     7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+     7e8:	89 c1                	mov    %eax,%ecx
+     7ea:	83 c0 01             	add    $0x1,%eax
+     7ed:	89 46 08             	mov    %eax,0x8(%esi)
+     7f0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     7f4:	80 fa 0a             	cmp    $0xa,%dl
+     7f7:	75 07                	jne    800 <printint+0x90>
+    f->nl = 1;
+     7f9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+     800:	8d 57 ff             	lea    -0x1(%edi),%edx
+     803:	39 fb                	cmp    %edi,%ebx
+     805:	74 39                	je     840 <printint+0xd0>
+     807:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+     809:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+     80c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     811:	75 d5                	jne    7e8 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     813:	83 ec 04             	sub    $0x4,%esp
+     816:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+     819:	68 00 02 00 00       	push   $0x200
+     81e:	ff 75 d0             	push   -0x30(%ebp)
+     821:	ff 36                	push   (%esi)
+     823:	e8 ee fd ff ff       	call   616 <write>
+  return r;
+     828:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+     82c:	83 c4 10             	add    $0x10,%esp
+     82f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     831:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     838:	b8 01 00 00 00       	mov    $0x1,%eax
+     83d:	eb ae                	jmp    7ed <printint+0x7d>
+     83f:	90                   	nop
+}
+     840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     843:	5b                   	pop    %ebx
+     844:	5e                   	pop    %esi
+     845:	5f                   	pop    %edi
+     846:	5d                   	pop    %ebp
+     847:	c3                   	ret
+     848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84f:	90                   	nop
+  neg = 0;
+     850:	31 c0                	xor    %eax,%eax
+     852:	e9 42 ff ff ff       	jmp    799 <printint+0x29>
+     857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85e:	66 90                	xchg   %ax,%ax
+
+00000860 <bputc>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+     864:	89 c3                	mov    %eax,%ebx
+     866:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+     869:	8b 40 08             	mov    0x8(%eax),%eax
+     86c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     871:	74 1d                	je     890 <bputc+0x30>
+  f->buf[f->n++] = c;
+     873:	8d 48 01             	lea    0x1(%eax),%ecx
+     876:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     879:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     87d:	80 fa 0a             	cmp    $0xa,%dl
+     880:	75 07                	jne    889 <bputc+0x29>
+    f->nl = 1;
+     882:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+     889:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     88c:	c9                   	leave
+     88d:	c3                   	ret
+     88e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     890:	83 ec 04             	sub    $0x4,%esp
+     893:	8d 43 10             	lea    0x10(%ebx),%eax
+     896:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     899:	68 00 02 00 00       	push   $0x200
+     89e:	50                   	push   %eax
+     89f:	ff 33                	push   (%ebx)
+     8a1:	e8 70 fd ff ff       	call   616 <write>
+  return r;
+     8a6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     8a9:	83 c4 10             	add    $0x10,%esp
+     8ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     8b1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     8b8:	31 c0                	xor    %eax,%eax
+     8ba:	eb ba                	jmp    876 <bputc+0x16>
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 1c             	sub    $0x1c,%esp
+     8c9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     8cc:	0f b6 0a             	movzbl (%edx),%ecx
+     8cf:	84 c9                	test   %cl,%cl
+     8d1:	74 47                	je     91a <vfprintf+0x5a>
+     8d3:	8d 5a 01             	lea    0x1(%edx),%ebx
+     8d6:	89 c7                	mov    %eax,%edi
+     8d8:	31 d2                	xor    %edx,%edx
+     8da:	89 de                	mov    %ebx,%esi
+     8dc:	89 cb                	mov    %ecx,%ebx
+     8de:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+     8e0:	0f be cb             	movsbl %bl,%ecx
+     8e3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     8e6:	85 d2                	test   %edx,%edx
+     8e8:	75 4e                	jne    938 <vfprintf+0x78>
+      if(c == '%'){
+     8ea:	83 f8 25             	cmp    $0x25,%eax
+     8ed:	74 69                	je     958 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+     8ef:	8b 47 08             	mov    0x8(%edi),%eax
+     8f2:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8f7:	0f 84 73 01 00 00    	je     a70 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+     8fd:	8d 48 01             	lea    0x1(%eax),%ecx
+     900:	89 4f 08             	mov    %ecx,0x8(%edi)
+     903:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+     907:	80 fb 0a             	cmp    $0xa,%bl
+     90a:	74 1c                	je     928 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+     90c:	31 d2                	xor    %edx,%edx
+     90e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+     910:	0f b6 1e             	movzbl (%esi),%ebx
+     913:	83 c6 01             	add    $0x1,%esi
+     916:	84 db                	test   %bl,%bl
+     918:	75 c6                	jne    8e0 <vfprintf+0x20>
+    }
+  }
+}
+     91a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     91d:	5b                   	pop    %ebx
+     91e:	5e                   	pop    %esi
+     91f:	5f                   	pop    %edi
+     920:	5d                   	pop    %ebp
+     921:	c3                   	ret
+     922:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+     928:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+     92f:	eb df                	jmp    910 <vfprintf+0x50>
+     931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+     938:	83 fa 25             	cmp    $0x25,%edx
+     93b:	75 d3                	jne    910 <vfprintf+0x50>
+      if(c == 'd'){
+     93d:	83 f8 25             	cmp    $0x25,%eax
+     940:	74 37                	je     979 <vfprintf+0xb9>
+     942:	83 e8 63             	sub    $0x63,%eax
+     945:	83 f8 15             	cmp    $0x15,%eax
+     948:	77 16                	ja     960 <vfprintf+0xa0>
+     94a:	ff 24 85 38 12 00 00 	jmp    *0x1238(,%eax,4)
+     951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+     958:	ba 25 00 00 00       	mov    $0x25,%edx
+     95d:	eb b1                	jmp    910 <vfprintf+0x50>
+     95f:	90                   	nop
+  if(f->n == BUFSIZ)
+     960:	8b 47 08             	mov    0x8(%edi),%eax
+     963:	3d 00 02 00 00       	cmp    $0x200,%eax
+     968:	0f 84 4c 01 00 00    	je     aba <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+     96e:	8d 50 01             	lea    0x1(%eax),%edx
+     971:	89 57 08             	mov    %edx,0x8(%edi)
+     974:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+     979:	89 ca                	mov    %ecx,%edx
+     97b:	89 f8                	mov    %edi,%eax
+     97d:	e8 de fe ff ff       	call   860 <bputc>
+     982:	eb 88                	jmp    90c <vfprintf+0x4c>
+     984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     988:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     98b:	83 ec 0c             	sub    $0xc,%esp
+     98e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     993:	8b 13                	mov    (%ebx),%edx
+     995:	6a 00                	push   $0x0
+     997:	89 f8                	mov    %edi,%eax
+        ap++;
+     999:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+     99c:	e8 cf fd ff ff       	call   770 <printint>
+        ap++;
+     9a1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+     9a4:	83 c4 10             	add    $0x10,%esp
+     9a7:	e9 60 ff ff ff       	jmp    90c <vfprintf+0x4c>
+     9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+     9b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9b3:	8b 10                	mov    (%eax),%edx
+        ap++;
+     9b5:	83 c0 04             	add    $0x4,%eax
+     9b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     9bb:	85 d2                	test   %edx,%edx
+     9bd:	0f 84 dd 00 00 00    	je     aa0 <vfprintf+0x1e0>
+        while(*s != 0){
+     9c3:	0f b6 1a             	movzbl (%edx),%ebx
+     9c6:	84 db                	test   %bl,%bl
+     9c8:	0f 84 3e ff ff ff    	je     90c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     9ce:	8d 4f 10             	lea    0x10(%edi),%ecx
+     9d1:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+     9d4:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     9d7:	89 fe                	mov    %edi,%esi
+     9d9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     9dc:	89 d7                	mov    %edx,%edi
+     9de:	eb 27                	jmp    a07 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+     9e0:	89 c1                	mov    %eax,%ecx
+     9e2:	83 c0 01             	add    $0x1,%eax
+     9e5:	89 46 08             	mov    %eax,0x8(%esi)
+     9e8:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     9ec:	80 fb 0a             	cmp    $0xa,%bl
+     9ef:	75 07                	jne    9f8 <vfprintf+0x138>
+    f->nl = 1;
+     9f1:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+     9f8:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+     9fc:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+     9ff:	84 db                	test   %bl,%bl
+     a01:	0f 84 a9 00 00 00    	je     ab0 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+     a07:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a0c:	75 d2                	jne    9e0 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     a0e:	83 ec 04             	sub    $0x4,%esp
+     a11:	68 00 02 00 00       	push   $0x200
+     a16:	ff 75 e0             	push   -0x20(%ebp)
+     a19:	ff 36                	push   (%esi)
+     a1b:	e8 f6 fb ff ff       	call   616 <write>
+  return r;
+     a20:	83 c4 10             	add    $0x10,%esp
+     a23:	b8 01 00 00 00       	mov    $0x1,%eax
+     a28:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     a2a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     a31:	eb b2                	jmp    9e5 <vfprintf+0x125>
+     a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a37:	90                   	nop
+        printint(f, *ap, 10, 1);
+     a38:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     a3b:	83 ec 0c             	sub    $0xc,%esp
+     a3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a43:	8b 13                	mov    (%ebx),%edx
+     a45:	6a 01                	push   $0x1
+     a47:	e9 4b ff ff ff       	jmp    997 <vfprintf+0xd7>
+     a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+     a50:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     a53:	89 f8                	mov    %edi,%eax
+     a55:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+     a58:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+     a5b:	e8 00 fe ff ff       	call   860 <bputc>
+        ap++;
+     a60:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+     a63:	31 d2                	xor    %edx,%edx
+     a65:	e9 a6 fe ff ff       	jmp    910 <vfprintf+0x50>
+     a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     a70:	83 ec 04             	sub    $0x4,%esp
+     a73:	8d 47 10             	lea    0x10(%edi),%eax
+     a76:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     a79:	68 00 02 00 00       	push   $0x200
+     a7e:	50                   	push   %eax
+     a7f:	ff 37                	push   (%edi)
+     a81:	e8 90 fb ff ff       	call   616 <write>
+  return r;
+     a86:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     a89:	83 c4 10             	add    $0x10,%esp
+     a8c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+     a8e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+     a95:	b9 01 00 00 00       	mov    $0x1,%ecx
+     a9a:	e9 61 fe ff ff       	jmp    900 <vfprintf+0x40>
+     a9f:	90                   	nop
+          s = "(null)";
+     aa0:	ba 2e 12 00 00       	mov    $0x122e,%edx
+     aa5:	bb 28 00 00 00       	mov    $0x28,%ebx
+     aaa:	e9 1f ff ff ff       	jmp    9ce <vfprintf+0x10e>
+     aaf:	90                   	nop
+     ab0:	89 f7                	mov    %esi,%edi
+     ab2:	8b 75 dc             	mov    -0x24(%ebp),%esi
+     ab5:	e9 52 fe ff ff       	jmp    90c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     aba:	83 ec 04             	sub    $0x4,%esp
+     abd:	8d 47 10             	lea    0x10(%edi),%eax
+     ac0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     ac3:	68 00 02 00 00       	push   $0x200
+     ac8:	50                   	push   %eax
+     ac9:	ff 37                	push   (%edi)
+     acb:	e8 46 fb ff ff       	call   616 <write>
+  return r;
+     ad0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     ad3:	83 c4 10             	add    $0x10,%esp
+     ad6:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+     adb:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+     ae2:	31 c0                	xor    %eax,%eax
+     ae4:	e9 88 fe ff ff       	jmp    971 <vfprintf+0xb1>
+     ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000af0 <fdopen>:
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	56                   	push   %esi
+     af4:	53                   	push   %ebx
+     af5:	83 ec 20             	sub    $0x20,%esp
+     af8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+     afb:	83 fe 0f             	cmp    $0xf,%esi
+     afe:	0f 87 84 00 00 00    	ja     b88 <fdopen+0x98>
+  if(streams[fd])
+     b04:	8b 1c b5 60 1c 00 00 	mov    0x1c60(,%esi,4),%ebx
+     b0b:	85 db                	test   %ebx,%ebx
+     b0d:	74 11                	je     b20 <fdopen+0x30>
+}
+     b0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b12:	89 d8                	mov    %ebx,%eax
+     b14:	5b                   	pop    %ebx
+     b15:	5e                   	pop    %esi
+     b16:	5d                   	pop    %ebp
+     b17:	c3                   	ret
+     b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+     b20:	83 ec 0c             	sub    $0xc,%esp
+     b23:	68 10 02 00 00       	push   $0x210
+     b28:	e8 e3 05 00 00       	call   1110 <malloc>
+     b2d:	83 c4 10             	add    $0x10,%esp
+     b30:	89 c3                	mov    %eax,%ebx
+     b32:	85 c0                	test   %eax,%eax
+     b34:	74 52                	je     b88 <fdopen+0x98>
+  f->fd = fd;
+     b36:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+     b38:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+     b3b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+     b42:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+     b49:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+     b50:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b53:	50                   	push   %eax
+     b54:	56                   	push   %esi
+     b55:	e8 f4 fa ff ff       	call   64e <fstat>
+     b5a:	83 c4 10             	add    $0x10,%esp
+     b5d:	85 c0                	test   %eax,%eax
+     b5f:	75 07                	jne    b68 <fdopen+0x78>
+     b61:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     b66:	74 30                	je     b98 <fdopen+0xa8>
+  streams[fd] = f;
+     b68:	89 1c b5 60 1c 00 00 	mov    %ebx,0x1c60(,%esi,4)
+}
+     b6f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+     b71:	c7 05 40 1c 00 00 10 	movl   $0x710,0x1c40
+     b78:	07 00 00 
+}
+     b7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b7e:	5b                   	pop    %ebx
+     b7f:	5e                   	pop    %esi
+     b80:	5d                   	pop    %ebp
+     b81:	c3                   	ret
+     b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     b88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b8b:	31 db                	xor    %ebx,%ebx
+}
+     b8d:	89 d8                	mov    %ebx,%eax
+     b8f:	5b                   	pop    %ebx
+     b90:	5e                   	pop    %esi
+     b91:	5d                   	pop    %ebp
+     b92:	c3                   	ret
+     b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b97:	90                   	nop
+    f->mode = _IOLBF;
+     b98:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+     b9f:	eb c7                	jmp    b68 <fdopen+0x78>
+     ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     baf:	90                   	nop
+
+00000bb0 <fopen>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	53                   	push   %ebx
+     bb4:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+     bb7:	ff 75 0c             	push   0xc(%ebp)
+     bba:	ff 75 08             	push   0x8(%ebp)
+     bbd:	e8 74 fa ff ff       	call   636 <open>
+     bc2:	83 c4 10             	add    $0x10,%esp
+     bc5:	85 c0                	test   %eax,%eax
+     bc7:	78 37                	js     c00 <fopen+0x50>
+     bc9:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+     bcb:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+     bd2:	85 c0                	test   %eax,%eax
+     bd4:	74 17                	je     bed <fopen+0x3d>
+    free(streams[fd]);
+     bd6:	83 ec 0c             	sub    $0xc,%esp
+     bd9:	50                   	push   %eax
+     bda:	e8 a1 04 00 00       	call   1080 <free>
+    streams[fd] = 0;
+     bdf:	83 c4 10             	add    $0x10,%esp
+     be2:	c7 04 9d 60 1c 00 00 	movl   $0x0,0x1c60(,%ebx,4)
+     be9:	00 00 00 00 
+  return fdopen(fd);
+     bed:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     bf0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bf3:	c9                   	leave
+  return fdopen(fd);
+     bf4:	e9 f7 fe ff ff       	jmp    af0 <fdopen>
+     bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+     c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c03:	31 c0                	xor    %eax,%eax
+     c05:	c9                   	leave
+     c06:	c3                   	ret
+     c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0e:	66 90                	xchg   %ax,%ax
+
+00000c10 <setvbuf>:
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	56                   	push   %esi
+     c14:	53                   	push   %ebx
+     c15:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+     c1b:	83 fe 02             	cmp    $0x2,%esi
+     c1e:	77 38                	ja     c58 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     c20:	8b 43 08             	mov    0x8(%ebx),%eax
+     c23:	85 c0                	test   %eax,%eax
+     c25:	7e 12                	jle    c39 <setvbuf+0x29>
+     c27:	83 ec 04             	sub    $0x4,%esp
+     c2a:	50                   	push   %eax
+     c2b:	8d 43 10             	lea    0x10(%ebx),%eax
+     c2e:	50                   	push   %eax
+     c2f:	ff 33                	push   (%ebx)
+     c31:	e8 e0 f9 ff ff       	call   616 <write>
+     c36:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+     c39:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+     c40:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+     c42:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+     c49:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+     c4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c4f:	5b                   	pop    %ebx
+     c50:	5e                   	pop    %esi
+     c51:	5d                   	pop    %ebp
+     c52:	c3                   	ret
+     c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c57:	90                   	nop
+    return -1;
+     c58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c5d:	eb ed                	jmp    c4c <setvbuf+0x3c>
+     c5f:	90                   	nop
+
+00000c60 <fflush>:
+{
+     c60:	55                   	push   %ebp
+     c61:	31 c0                	xor    %eax,%eax
+     c63:	89 e5                	mov    %esp,%ebp
+     c65:	53                   	push   %ebx
+     c66:	83 ec 04             	sub    $0x4,%esp
+     c69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     c6c:	8b 53 08             	mov    0x8(%ebx),%edx
+     c6f:	85 d2                	test   %edx,%edx
+     c71:	7e 1d                	jle    c90 <fflush+0x30>
+     c73:	83 ec 04             	sub    $0x4,%esp
+     c76:	8d 43 10             	lea    0x10(%ebx),%eax
+     c79:	52                   	push   %edx
+     c7a:	50                   	push   %eax
+     c7b:	ff 33                	push   (%ebx)
+     c7d:	e8 94 f9 ff ff       	call   616 <write>
+     c82:	83 c4 10             	add    $0x10,%esp
+     c85:	39 43 08             	cmp    %eax,0x8(%ebx)
+     c88:	0f 95 c0             	setne  %al
+     c8b:	0f b6 c0             	movzbl %al,%eax
+     c8e:	f7 d8                	neg    %eax
+  f->n = 0;
+     c90:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     c97:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     c9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ca1:	c9                   	leave
+     ca2:	c3                   	ret
+     ca3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <fclose>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	56                   	push   %esi
+     cb4:	31 f6                	xor    %esi,%esi
+     cb6:	53                   	push   %ebx
+     cb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     cba:	8b 43 08             	mov    0x8(%ebx),%eax
+     cbd:	85 c0                	test   %eax,%eax
+     cbf:	7e 1f                	jle    ce0 <fclose+0x30>
+     cc1:	83 ec 04             	sub    $0x4,%esp
+     cc4:	50                   	push   %eax
+     cc5:	8d 43 10             	lea    0x10(%ebx),%eax
+     cc8:	50                   	push   %eax
+     cc9:	ff 33                	push   (%ebx)
+     ccb:	e8 46 f9 ff ff       	call   616 <write>
+     cd0:	83 c4 10             	add    $0x10,%esp
+     cd3:	39 43 08             	cmp    %eax,0x8(%ebx)
+     cd6:	0f 95 c0             	setne  %al
+     cd9:	0f b6 c0             	movzbl %al,%eax
+     cdc:	f7 d8                	neg    %eax
+     cde:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     ce0:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+     ce3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     cea:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+     cf1:	ff 33                	push   (%ebx)
+     cf3:	e8 26 f9 ff ff       	call   61e <close>
+     cf8:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+     cfb:	85 c0                	test   %eax,%eax
+     cfd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d02:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+     d05:	8b 03                	mov    (%ebx),%eax
+     d07:	83 f8 0f             	cmp    $0xf,%eax
+     d0a:	77 09                	ja     d15 <fclose+0x65>
+     d0c:	39 1c 85 60 1c 00 00 	cmp    %ebx,0x1c60(,%eax,4)
+     d13:	74 0b                	je     d20 <fclose+0x70>
+}
+     d15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d18:	89 f0                	mov    %esi,%eax
+     d1a:	5b                   	pop    %ebx
+     d1b:	5e                   	pop    %esi
+     d1c:	5d                   	pop    %ebp
+     d1d:	c3                   	ret
+     d1e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+     d20:	c7 04 85 60 1c 00 00 	movl   $0x0,0x1c60(,%eax,4)
+     d27:	00 00 00 00 
+    free(f);
+     d2b:	83 ec 0c             	sub    $0xc,%esp
+     d2e:	53                   	push   %ebx
+     d2f:	e8 4c 03 00 00       	call   1080 <free>
+     d34:	83 c4 10             	add    $0x10,%esp
+  return r;
+     d37:	eb dc                	jmp    d15 <fclose+0x65>
+     d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <fputc>:
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	53                   	push   %ebx
+     d44:	83 ec 04             	sub    $0x4,%esp
+     d47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+     d4d:	8b 43 08             	mov    0x8(%ebx),%eax
+     d50:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d55:	74 59                	je     db0 <fputc+0x70>
+  f->buf[f->n++] = c;
+     d57:	8d 48 01             	lea    0x1(%eax),%ecx
+     d5a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     d5d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     d61:	80 fa 0a             	cmp    $0xa,%dl
+     d64:	75 07                	jne    d6d <fputc+0x2d>
+    f->nl = 1;
+     d66:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     d6d:	8b 43 04             	mov    0x4(%ebx),%eax
+     d70:	83 f8 02             	cmp    $0x2,%eax
+     d73:	74 1a                	je     d8f <fputc+0x4f>
+     d75:	83 f8 01             	cmp    $0x1,%eax
+     d78:	74 0e                	je     d88 <fputc+0x48>
+}
+     d7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+     d7d:	0f b6 c2             	movzbl %dl,%eax
+}
+     d80:	c9                   	leave
+     d81:	c3                   	ret
+     d82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     d88:	8b 43 0c             	mov    0xc(%ebx),%eax
+     d8b:	85 c0                	test   %eax,%eax
+     d8d:	74 eb                	je     d7a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d8f:	85 c9                	test   %ecx,%ecx
+     d91:	7f 4d                	jg     de0 <fputc+0xa0>
+  f->n = 0;
+     d93:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     d9a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     da1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+     da4:	0f b6 c2             	movzbl %dl,%eax
+}
+     da7:	c9                   	leave
+     da8:	c3                   	ret
+     da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     db0:	83 ec 04             	sub    $0x4,%esp
+     db3:	8d 43 10             	lea    0x10(%ebx),%eax
+     db6:	89 55 08             	mov    %edx,0x8(%ebp)
+     db9:	68 00 02 00 00       	push   $0x200
+     dbe:	50                   	push   %eax
+     dbf:	ff 33                	push   (%ebx)
+     dc1:	e8 50 f8 ff ff       	call   616 <write>
+  return r;
+     dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+     dc9:	83 c4 10             	add    $0x10,%esp
+     dcc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     dd1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     dd8:	31 c0                	xor    %eax,%eax
+     dda:	e9 7b ff ff ff       	jmp    d5a <fputc+0x1a>
+     ddf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     de0:	83 ec 04             	sub    $0x4,%esp
+     de3:	8d 43 10             	lea    0x10(%ebx),%eax
+     de6:	89 55 08             	mov    %edx,0x8(%ebp)
+     de9:	51                   	push   %ecx
+     dea:	50                   	push   %eax
+     deb:	ff 33                	push   (%ebx)
+     ded:	e8 24 f8 ff ff       	call   616 <write>
+  f->n = 0;
+     df2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+     df9:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+     dfc:	83 c4 10             	add    $0x10,%esp
+     dff:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     e06:	eb 99                	jmp    da1 <fputc+0x61>
+     e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+
+00000e10 <fwrite>:
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	57                   	push   %edi
+     e14:	56                   	push   %esi
+     e15:	53                   	push   %ebx
+     e16:	83 ec 1c             	sub    $0x1c,%esp
+     e19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+     e1c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+     e1f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+     e22:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+     e25:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+     e2b:	0f 8f af 00 00 00    	jg     ee0 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+     e31:	85 ff                	test   %edi,%edi
+     e33:	7e 73                	jle    ea8 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e35:	8d 56 10             	lea    0x10(%esi),%edx
+     e38:	8b 46 08             	mov    0x8(%esi),%eax
+     e3b:	31 db                	xor    %ebx,%ebx
+     e3d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     e40:	eb 25                	jmp    e67 <fwrite+0x57>
+     e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+     e48:	89 c1                	mov    %eax,%ecx
+     e4a:	83 c0 01             	add    $0x1,%eax
+     e4d:	89 46 08             	mov    %eax,0x8(%esi)
+     e50:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     e54:	80 fa 0a             	cmp    $0xa,%dl
+     e57:	75 07                	jne    e60 <fwrite+0x50>
+    f->nl = 1;
+     e59:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+     e60:	83 c3 01             	add    $0x1,%ebx
+     e63:	39 df                	cmp    %ebx,%edi
+     e65:	7e 41                	jle    ea8 <fwrite+0x98>
+    bputc(f, s[i]);
+     e67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e6a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+     e6e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     e73:	75 d3                	jne    e48 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e75:	83 ec 04             	sub    $0x4,%esp
+     e78:	88 55 e7             	mov    %dl,-0x19(%ebp)
+     e7b:	68 00 02 00 00       	push   $0x200
+     e80:	ff 75 e0             	push   -0x20(%ebp)
+     e83:	ff 36                	push   (%esi)
+     e85:	e8 8c f7 ff ff       	call   616 <write>
+  return r;
+     e8a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+     e8e:	83 c4 10             	add    $0x10,%esp
+     e91:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     e93:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     e9a:	b8 01 00 00 00       	mov    $0x1,%eax
+     e9f:	eb ac                	jmp    e4d <fwrite+0x3d>
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     ea8:	8b 46 04             	mov    0x4(%esi),%eax
+     eab:	83 f8 02             	cmp    $0x2,%eax
+     eae:	74 0c                	je     ebc <fwrite+0xac>
+     eb0:	83 f8 01             	cmp    $0x1,%eax
+     eb3:	75 1c                	jne    ed1 <fwrite+0xc1>
+     eb5:	8b 46 0c             	mov    0xc(%esi),%eax
+     eb8:	85 c0                	test   %eax,%eax
+     eba:	74 15                	je     ed1 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     ebc:	8b 46 08             	mov    0x8(%esi),%eax
+     ebf:	85 c0                	test   %eax,%eax
+     ec1:	7f 5d                	jg     f20 <fwrite+0x110>
+  f->n = 0;
+     ec3:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     eca:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+     ed1:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+     ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ed7:	5b                   	pop    %ebx
+     ed8:	5e                   	pop    %esi
+     ed9:	5f                   	pop    %edi
+     eda:	5d                   	pop    %ebp
+     edb:	c3                   	ret
+     edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+     ee0:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+     ee4:	0f 84 4b ff ff ff    	je     e35 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     eea:	8b 46 08             	mov    0x8(%esi),%eax
+     eed:	8b 16                	mov    (%esi),%edx
+     eef:	85 c0                	test   %eax,%eax
+     ef1:	7f 45                	jg     f38 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+     ef3:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+     ef6:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     efd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+     f04:	57                   	push   %edi
+     f05:	ff 75 08             	push   0x8(%ebp)
+     f08:	ff 36                	push   (%esi)
+     f0a:	e8 07 f7 ff ff       	call   616 <write>
+    return size > 0 ? i / size : 0;
+     f0f:	83 c4 10             	add    $0x10,%esp
+     f12:	85 c0                	test   %eax,%eax
+     f14:	78 4a                	js     f60 <fwrite+0x150>
+     f16:	85 db                	test   %ebx,%ebx
+     f18:	7e 46                	jle    f60 <fwrite+0x150>
+     f1a:	99                   	cltd
+     f1b:	f7 fb                	idiv   %ebx
+     f1d:	eb b5                	jmp    ed4 <fwrite+0xc4>
+     f1f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     f20:	83 ec 04             	sub    $0x4,%esp
+     f23:	50                   	push   %eax
+     f24:	8d 46 10             	lea    0x10(%esi),%eax
+     f27:	50                   	push   %eax
+     f28:	ff 36                	push   (%esi)
+     f2a:	e8 e7 f6 ff ff       	call   616 <write>
+     f2f:	83 c4 10             	add    $0x10,%esp
+     f32:	eb 8f                	jmp    ec3 <fwrite+0xb3>
+     f34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f38:	83 ec 04             	sub    $0x4,%esp
+     f3b:	50                   	push   %eax
+     f3c:	8d 46 10             	lea    0x10(%esi),%eax
+     f3f:	50                   	push   %eax
+     f40:	52                   	push   %edx
+     f41:	e8 d0 f6 ff ff       	call   616 <write>
+     f46:	83 c4 10             	add    $0x10,%esp
+     f49:	3b 46 08             	cmp    0x8(%esi),%eax
+     f4c:	74 a5                	je     ef3 <fwrite+0xe3>
+  f->n = 0;
+     f4e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     f55:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+     f60:	31 c0                	xor    %eax,%eax
+     f62:	e9 6d ff ff ff       	jmp    ed4 <fwrite+0xc4>
+     f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     f74:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     f77:	83 ec 04             	sub    $0x4,%esp
+     f7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     f7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+     f80:	89 d8                	mov    %ebx,%eax
+     f82:	e8 39 f9 ff ff       	call   8c0 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     f87:	8b 43 04             	mov    0x4(%ebx),%eax
+     f8a:	83 f8 02             	cmp    $0x2,%eax
+     f8d:	74 18                	je     fa7 <fprintf+0x37>
+     f8f:	83 f8 01             	cmp    $0x1,%eax
+     f92:	74 0c                	je     fa0 <fprintf+0x30>
+  settle(f);
+}
+     f94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f97:	c9                   	leave
+     f98:	c3                   	ret
+     f99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     fa0:	8b 43 0c             	mov    0xc(%ebx),%eax
+     fa3:	85 c0                	test   %eax,%eax
+     fa5:	74 ed                	je     f94 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     fa7:	8b 43 08             	mov    0x8(%ebx),%eax
+     faa:	85 c0                	test   %eax,%eax
+     fac:	7f 1a                	jg     fc8 <fprintf+0x58>
+  f->n = 0;
+     fae:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     fb5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     fbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fbf:	c9                   	leave
+     fc0:	c3                   	ret
+     fc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     fc8:	83 ec 04             	sub    $0x4,%esp
+     fcb:	50                   	push   %eax
+     fcc:	8d 43 10             	lea    0x10(%ebx),%eax
+     fcf:	50                   	push   %eax
+     fd0:	ff 33                	push   (%ebx)
+     fd2:	e8 3f f6 ff ff       	call   616 <write>
+  f->n = 0;
+     fd7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+     fde:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+     fe1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     fe8:	eb d2                	jmp    fbc <fprintf+0x4c>
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ff0 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	53                   	push   %ebx
+     ff4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+     ffd:	83 f8 0f             	cmp    $0xf,%eax
+    1000:	77 4e                	ja     1050 <printf+0x60>
+    1002:	8b 1c 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%ebx
+    1009:	85 db                	test   %ebx,%ebx
+    100b:	74 43                	je     1050 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    100d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1010:	89 d8                	mov    %ebx,%eax
+    1012:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1015:	e8 a6 f8 ff ff       	call   8c0 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    101a:	8b 43 08             	mov    0x8(%ebx),%eax
+    101d:	85 c0                	test   %eax,%eax
+    101f:	7e 12                	jle    1033 <printf+0x43>
+    1021:	83 ec 04             	sub    $0x4,%esp
+    1024:	50                   	push   %eax
+    1025:	8d 43 10             	lea    0x10(%ebx),%eax
+    1028:	50                   	push   %eax
+    1029:	ff 33                	push   (%ebx)
+    102b:	e8 e6 f5 ff ff       	call   616 <write>
+    1030:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    1033:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    103a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+    1041:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1044:	c9                   	leave
+    1045:	c3                   	ret
+    1046:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+    1050:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+    1056:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+    105c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+    1063:	00 00 00 
+    f->n = 0;
+    1066:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    106d:	00 00 00 
+    f->nl = 0;
+    1070:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+    1077:	00 00 00 
+    107a:	eb 91                	jmp    100d <printf+0x1d>
+    107c:	66 90                	xchg   %ax,%ax
+    107e:	66 90                	xchg   %ax,%ax
+
+00001080 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1080:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1081:	a1 a0 1c 00 00       	mov    0x1ca0,%eax
+{
+    1086:	89 e5                	mov    %esp,%ebp
+    1088:	57                   	push   %edi
+    1089:	56                   	push   %esi
+    108a:	53                   	push   %ebx
+    108b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    108e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1098:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    109a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    109c:	39 ca                	cmp    %ecx,%edx
+    109e:	73 30                	jae    10d0 <free+0x50>
+    10a0:	39 c1                	cmp    %eax,%ecx
+    10a2:	72 04                	jb     10a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10a4:	39 c2                	cmp    %eax,%edx
+    10a6:	72 f0                	jb     1098 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    10a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    10ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    10ae:	39 f8                	cmp    %edi,%eax
+    10b0:	74 2e                	je     10e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    10b5:	8b 42 04             	mov    0x4(%edx),%eax
+    10b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10bb:	39 f1                	cmp    %esi,%ecx
+    10bd:	74 38                	je     10f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    10bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    10c1:	5b                   	pop    %ebx
+  freep = p;
+    10c2:	89 15 a0 1c 00 00    	mov    %edx,0x1ca0
+}
+    10c8:	5e                   	pop    %esi
+    10c9:	5f                   	pop    %edi
+    10ca:	5d                   	pop    %ebp
+    10cb:	c3                   	ret
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10d0:	39 c1                	cmp    %eax,%ecx
+    10d2:	72 d0                	jb     10a4 <free+0x24>
+    10d4:	eb c2                	jmp    1098 <free+0x18>
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    10e0:	03 70 04             	add    0x4(%eax),%esi
+    10e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10e6:	8b 02                	mov    (%edx),%eax
+    10e8:	8b 00                	mov    (%eax),%eax
+    10ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    10ed:	8b 42 04             	mov    0x4(%edx),%eax
+    10f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10f3:	39 f1                	cmp    %esi,%ecx
+    10f5:	75 c8                	jne    10bf <free+0x3f>
+    p->s.size += bp->s.size;
+    10f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10fa:	89 15 a0 1c 00 00    	mov    %edx,0x1ca0
+    p->s.size += bp->s.size;
+    1100:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1103:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1106:	89 0a                	mov    %ecx,(%edx)
+}
+    1108:	5b                   	pop    %ebx
+    1109:	5e                   	pop    %esi
+    110a:	5f                   	pop    %edi
+    110b:	5d                   	pop    %ebp
+    110c:	c3                   	ret
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001110 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	53                   	push   %ebx
+    1116:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1119:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    111c:	8b 15 a0 1c 00 00    	mov    0x1ca0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1122:	8d 78 07             	lea    0x7(%eax),%edi
+    1125:	c1 ef 03             	shr    $0x3,%edi
+    1128:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    112b:	85 d2                	test   %edx,%edx
+    112d:	0f 84 8d 00 00 00    	je     11c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1133:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1135:	8b 48 04             	mov    0x4(%eax),%ecx
+    1138:	39 f9                	cmp    %edi,%ecx
+    113a:	73 64                	jae    11a0 <malloc+0x90>
+  if(nu < 4096)
+    113c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1141:	39 df                	cmp    %ebx,%edi
+    1143:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1146:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    114d:	eb 0a                	jmp    1159 <malloc+0x49>
+    114f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1150:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1152:	8b 48 04             	mov    0x4(%eax),%ecx
+    1155:	39 f9                	cmp    %edi,%ecx
+    1157:	73 47                	jae    11a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1159:	89 c2                	mov    %eax,%edx
+    115b:	39 05 a0 1c 00 00    	cmp    %eax,0x1ca0
+    1161:	75 ed                	jne    1150 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1163:	83 ec 0c             	sub    $0xc,%esp
+    1166:	56                   	push   %esi
+    1167:	e8 12 f5 ff ff       	call   67e <sbrk>
+  if(p == (char*)-1)
+    116c:	83 c4 10             	add    $0x10,%esp
+    116f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1172:	74 1c                	je     1190 <malloc+0x80>
+  hp->s.size = nu;
+    1174:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1177:	83 ec 0c             	sub    $0xc,%esp
+    117a:	83 c0 08             	add    $0x8,%eax
+    117d:	50                   	push   %eax
+    117e:	e8 fd fe ff ff       	call   1080 <free>
+  return freep;
+    1183:	8b 15 a0 1c 00 00    	mov    0x1ca0,%edx
+      if((p = morecore(nunits)) == 0)
+    1189:	83 c4 10             	add    $0x10,%esp
+    118c:	85 d2                	test   %edx,%edx
+    118e:	75 c0                	jne    1150 <malloc+0x40>
+        return 0;
+  }
+}
+    1190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1193:	31 c0                	xor    %eax,%eax
+}
+    1195:	5b                   	pop    %ebx
+    1196:	5e                   	pop    %esi
+    1197:	5f                   	pop    %edi
+    1198:	5d                   	pop    %ebp
+    1199:	c3                   	ret
+    119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    11a0:	39 cf                	cmp    %ecx,%edi
+    11a2:	74 4c                	je     11f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    11a4:	29 f9                	sub    %edi,%ecx
+    11a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    11a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    11ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    11af:	89 15 a0 1c 00 00    	mov    %edx,0x1ca0
+}
+    11b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    11b8:	83 c0 08             	add    $0x8,%eax
+}
+    11bb:	5b                   	pop    %ebx
+    11bc:	5e                   	pop    %esi
+    11bd:	5f                   	pop    %edi
+    11be:	5d                   	pop    %ebp
+    11bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    11c0:	c7 05 a0 1c 00 00 a4 	movl   $0x1ca4,0x1ca0
+    11c7:	1c 00 00 
+    base.s.size = 0;
+    11ca:	b8 a4 1c 00 00       	mov    $0x1ca4,%eax
+    base.s.ptr = freep = prevp = &base;
+    11cf:	c7 05 a4 1c 00 00 a4 	movl   $0x1ca4,0x1ca4
+    11d6:	1c 00 00 
+    base.s.size = 0;
+    11d9:	c7 05 a8 1c 00 00 00 	movl   $0x0,0x1ca8
+    11e0:	00 00 00 
+    if(p->s.size >= nunits){
+    11e3:	e9 54 ff ff ff       	jmp    113c <malloc+0x2c>
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    11f0:	8b 08                	mov    (%eax),%ecx
+    11f2:	89 0a                	mov    %ecx,(%edx)
+    11f4:	eb b9                	jmp    11af <malloc+0x9f>
@@ -0,0 +1,2102 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 58 0f 00 00       	push   $0xf58
+  19:	e8 78 03 00 00       	call   396 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 af 00 00 00    	js     d8 <main+0xd8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 9b 03 00 00       	call   3ce <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 8f 03 00 00       	call   3ce <dup>
+  mknod("proc", 2, 0);  // PROCSTAT; fails if it is already there
+  3f:	83 c4 0c             	add    $0xc,%esp
+  42:	6a 00                	push   $0x0
+  44:	6a 02                	push   $0x2
+  46:	68 60 0f 00 00       	push   $0xf60
+  4b:	e8 4e 03 00 00       	call   39e <mknod>
+  50:	83 c4 10             	add    $0x10,%esp
+  53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  57:	90                   	nop
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 65 0f 00 00       	push   $0xf65
+  60:	6a 01                	push   $0x1
+  62:	e8 e9 0c 00 00       	call   d50 <printf>
+    pid = fork();
+  67:	e8 ea 02 00 00       	call   356 <fork>
+    if(pid < 0){
+  6c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  6f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  71:	85 c0                	test   %eax,%eax
+  73:	78 2c                	js     a1 <main+0xa1>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  75:	74 3d                	je     b4 <main+0xb4>
+  77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  80:	e8 d9 02 00 00       	call   35e <wait>
+  85:	85 c0                	test   %eax,%eax
+  87:	78 cf                	js     58 <main+0x58>
+  89:	39 c3                	cmp    %eax,%ebx
+  8b:	74 cb                	je     58 <main+0x58>
+      printf(1, "zombie!\n");
+  8d:	83 ec 08             	sub    $0x8,%esp
+  90:	68 a4 0f 00 00       	push   $0xfa4
+  95:	6a 01                	push   $0x1
+  97:	e8 b4 0c 00 00       	call   d50 <printf>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	eb df                	jmp    80 <main+0x80>
+      printf(1, "init: fork failed\n");
+  a1:	53                   	push   %ebx
+  a2:	53                   	push   %ebx
+  a3:	68 78 0f 00 00       	push   $0xf78
+  a8:	6a 01                	push   $0x1
+  aa:	e8 a1 0c 00 00       	call   d50 <printf>
+      exit();
+  af:	e8 8c 02 00 00       	call   340 <exit>
+      exec("sh", argv);
+  b4:	50                   	push   %eax
+  b5:	50                   	push   %eax
+  b6:	68 bc 14 00 00       	push   $0x14bc
+  bb:	68 8b 0f 00 00       	push   $0xf8b
+  c0:	e8 c9 02 00 00       	call   38e <exec>
+      printf(1, "init: exec sh failed\n");
+  c5:	5a                   	pop    %edx
+  c6:	59                   	pop    %ecx
+  c7:	68 8e 0f 00 00       	push   $0xf8e
+  cc:	6a 01                	push   $0x1
+  ce:	e8 7d 0c 00 00       	call   d50 <printf>
+      exit();
+  d3:	e8 68 02 00 00       	call   340 <exit>
+    mknod("console", 1, 1);
+  d8:	50                   	push   %eax
+  d9:	6a 01                	push   $0x1
+  db:	6a 01                	push   $0x1
+  dd:	68 58 0f 00 00       	push   $0xf58
+  e2:	e8 b7 02 00 00       	call   39e <mknod>
+    open("console", O_RDWR);
+  e7:	58                   	pop    %eax
+  e8:	5a                   	pop    %edx
+  e9:	6a 02                	push   $0x2
+  eb:	68 58 0f 00 00       	push   $0xf58
+  f0:	e8 a1 02 00 00       	call   396 <open>
+  f5:	83 c4 10             	add    $0x10,%esp
+  f8:	e9 2c ff ff ff       	jmp    29 <main+0x29>
+  fd:	66 90                	xchg   %ax,%ax
+  ff:	90                   	nop
+
+00000100 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 100:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 101:	31 c0                	xor    %eax,%eax
+{
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	53                   	push   %ebx
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 110:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 114:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 117:	83 c0 01             	add    $0x1,%eax
+ 11a:	84 d2                	test   %dl,%dl
+ 11c:	75 f2                	jne    110 <strcpy+0x10>
+    ;
+  return os;
+}
+ 11e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 121:	89 c8                	mov    %ecx,%eax
+ 123:	c9                   	leave
+ 124:	c3                   	ret
+ 125:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	53                   	push   %ebx
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+ 137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 13a:	0f b6 02             	movzbl (%edx),%eax
+ 13d:	84 c0                	test   %al,%al
+ 13f:	75 17                	jne    158 <strcmp+0x28>
+ 141:	eb 3a                	jmp    17d <strcmp+0x4d>
+ 143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 147:	90                   	nop
+ 148:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 14c:	83 c2 01             	add    $0x1,%edx
+ 14f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 152:	84 c0                	test   %al,%al
+ 154:	74 1a                	je     170 <strcmp+0x40>
+    p++, q++;
+ 156:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 158:	0f b6 19             	movzbl (%ecx),%ebx
+ 15b:	38 c3                	cmp    %al,%bl
+ 15d:	74 e9                	je     148 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 15f:	29 d8                	sub    %ebx,%eax
+}
+ 161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 170:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 174:	31 c0                	xor    %eax,%eax
+ 176:	29 d8                	sub    %ebx,%eax
+}
+ 178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 17d:	0f b6 19             	movzbl (%ecx),%ebx
+ 180:	31 c0                	xor    %eax,%eax
+ 182:	eb db                	jmp    15f <strcmp+0x2f>
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 196:	80 3a 00             	cmpb   $0x0,(%edx)
+ 199:	74 15                	je     1b0 <strlen+0x20>
+ 19b:	31 c0                	xor    %eax,%eax
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+ 1a0:	83 c0 01             	add    $0x1,%eax
+ 1a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1a7:	89 c1                	mov    %eax,%ecx
+ 1a9:	75 f5                	jne    1a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1ab:	89 c8                	mov    %ecx,%eax
+ 1ad:	5d                   	pop    %ebp
+ 1ae:	c3                   	ret
+ 1af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1b0:	31 c9                	xor    %ecx,%ecx
+}
+ 1b2:	5d                   	pop    %ebp
+ 1b3:	89 c8                	mov    %ecx,%eax
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cd:	89 d7                	mov    %edx,%edi
+ 1cf:	fc                   	cld
+ 1d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1d5:	89 d0                	mov    %edx,%eax
+ 1d7:	c9                   	leave
+ 1d8:	c3                   	ret
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ea:	0f b6 10             	movzbl (%eax),%edx
+ 1ed:	84 d2                	test   %dl,%dl
+ 1ef:	75 12                	jne    203 <strchr+0x23>
+ 1f1:	eb 1d                	jmp    210 <strchr+0x30>
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+ 1f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1fc:	83 c0 01             	add    $0x1,%eax
+ 1ff:	84 d2                	test   %dl,%dl
+ 201:	74 0d                	je     210 <strchr+0x30>
+    if(*s == c)
+ 203:	38 d1                	cmp    %dl,%cl
+ 205:	75 f1                	jne    1f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 207:	5d                   	pop    %ebp
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 210:	31 c0                	xor    %eax,%eax
+}
+ 212:	5d                   	pop    %ebp
+ 213:	c3                   	ret
+ 214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+
+00000220 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 225:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 228:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 229:	31 db                	xor    %ebx,%ebx
+{
+ 22b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 22e:	eb 27                	jmp    257 <gets+0x37>
+    cc = read(0, &c, 1);
+ 230:	83 ec 04             	sub    $0x4,%esp
+ 233:	6a 01                	push   $0x1
+ 235:	56                   	push   %esi
+ 236:	6a 00                	push   $0x0
+ 238:	e8 31 01 00 00       	call   36e <read>
+    if(cc < 1)
+ 23d:	83 c4 10             	add    $0x10,%esp
+ 240:	85 c0                	test   %eax,%eax
+ 242:	7e 1d                	jle    261 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 244:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 24f:	3c 0a                	cmp    $0xa,%al
+ 251:	74 10                	je     263 <gets+0x43>
+ 253:	3c 0d                	cmp    $0xd,%al
+ 255:	74 0c                	je     263 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 257:	89 df                	mov    %ebx,%edi
+ 259:	83 c3 01             	add    $0x1,%ebx
+ 25c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 25f:	7c cf                	jl     230 <gets+0x10>
+ 261:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 26a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26d:	5b                   	pop    %ebx
+ 26e:	5e                   	pop    %esi
+ 26f:	5f                   	pop    %edi
+ 270:	5d                   	pop    %ebp
+ 271:	c3                   	ret
+ 272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	56                   	push   %esi
+ 284:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 285:	83 ec 08             	sub    $0x8,%esp
+ 288:	6a 00                	push   $0x0
+ 28a:	ff 75 08             	push   0x8(%ebp)
+ 28d:	e8 04 01 00 00       	call   396 <open>
+  if(fd < 0)
+ 292:	83 c4 10             	add    $0x10,%esp
+ 295:	85 c0                	test   %eax,%eax
+ 297:	78 27                	js     2c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 299:	83 ec 08             	sub    $0x8,%esp
+ 29c:	ff 75 0c             	push   0xc(%ebp)
+ 29f:	89 c3                	mov    %eax,%ebx
+ 2a1:	50                   	push   %eax
+ 2a2:	e8 07 01 00 00       	call   3ae <fstat>
+  close(fd);
+ 2a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2ac:	e8 cd 00 00 00       	call   37e <close>
+  return r;
+ 2b1:	83 c4 10             	add    $0x10,%esp
+}
+ 2b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2b7:	89 f0                	mov    %esi,%eax
+ 2b9:	5b                   	pop    %ebx
+ 2ba:	5e                   	pop    %esi
+ 2bb:	5d                   	pop    %ebp
+ 2bc:	c3                   	ret
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2c5:	eb ed                	jmp    2b4 <stat+0x34>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	53                   	push   %ebx
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2d7:	0f be 02             	movsbl (%edx),%eax
+ 2da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2e5:	77 1e                	ja     305 <atoi+0x35>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2f0:	83 c2 01             	add    $0x1,%edx
+ 2f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2fa:	0f be 02             	movsbl (%edx),%eax
+ 2fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 300:	80 fb 09             	cmp    $0x9,%bl
+ 303:	76 eb                	jbe    2f0 <atoi+0x20>
+  return n;
+}
+ 305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 308:	89 c8                	mov    %ecx,%eax
+ 30a:	c9                   	leave
+ 30b:	c3                   	ret
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+ 315:	8b 45 10             	mov    0x10(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 31e:	85 c0                	test   %eax,%eax
+ 320:	7e 13                	jle    335 <memmove+0x25>
+ 322:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 324:	89 d7                	mov    %edx,%edi
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 330:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 331:	39 f8                	cmp    %edi,%eax
+ 333:	75 fb                	jne    330 <memmove+0x20>
+  return vdst;
+}
+ 335:	5e                   	pop    %esi
+ 336:	89 d0                	mov    %edx,%eax
+ 338:	5f                   	pop    %edi
+ 339:	5d                   	pop    %ebp
+ 33a:	c3                   	ret
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 346:	a1 e0 14 00 00       	mov    0x14e0,%eax
+ 34b:	85 c0                	test   %eax,%eax
+ 34d:	74 02                	je     351 <exit+0x11>
+    exithook();
+ 34f:	ff d0                	call   *%eax
+  _exit();
+ 351:	e8 10 01 00 00       	call   466 <_exit>
+
+00000356 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 356:	b8 01 00 00 00       	mov    $0x1,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <wait>:
+SYSCALL(wait)
+ 35e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <pipe>:
+SYSCALL(pipe)
+ 366:	b8 04 00 00 00       	mov    $0x4,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <read>:
+SYSCALL(read)
+ 36e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <write>:
+SYSCALL(write)
+ 376:	b8 10 00 00 00       	mov    $0x10,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <close>:
+SYSCALL(close)
+ 37e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <kill>:
+SYSCALL(kill)
+ 386:	b8 06 00 00 00       	mov    $0x6,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <exec>:
+SYSCALL(exec)
+ 38e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <open>:
+SYSCALL(open)
+ 396:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <mknod>:
+SYSCALL(mknod)
+ 39e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <unlink>:
+SYSCALL(unlink)
+ 3a6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <fstat>:
+SYSCALL(fstat)
+ 3ae:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <link>:
+SYSCALL(link)
+ 3b6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <mkdir>:
+SYSCALL(mkdir)
+ 3be:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <chdir>:
+SYSCALL(chdir)
+ 3c6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <dup>:
+SYSCALL(dup)
+ 3ce:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <getpid>:
+SYSCALL(getpid)
+ 3d6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <sbrk>:
+SYSCALL(sbrk)
+ 3de:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <sleep>:
+SYSCALL(sleep)
+ 3e6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <uptime>:
+SYSCALL(uptime)
+ 3ee:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 3f6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <sigaction>:
+SYSCALL(sigaction)
+ 3fe:	b8 17 00 00 00       	mov    $0x17,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <sigret>:
+SYSCALL(sigret)
+ 406:	b8 18 00 00 00       	mov    $0x18,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <readv>:
+SYSCALL(readv)
+ 40e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <writev>:
+SYSCALL(writev)
+ 416:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <nanosleep>:
+SYSCALL(nanosleep)
+ 41e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <setpriority>:
+SYSCALL(setpriority)
+ 426:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <sched_setattr>:
+SYSCALL(sched_setattr)
+ 42e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <sched_yield>:
+SYSCALL(sched_yield)
+ 436:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 43e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 446:	b8 20 00 00 00       	mov    $0x20,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <getrusage>:
+SYSCALL(getrusage)
+ 44e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <syslat>:
+SYSCALL(syslat)
+ 456:	b8 22 00 00 00       	mov    $0x22,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <sched_getattr>:
+SYSCALL(sched_getattr)
+ 45e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 466:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 46b:	cd 40                	int    $0x40
+  ret
+ 46d:	c3                   	ret
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	56                   	push   %esi
+ 474:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 475:	31 db                	xor    %ebx,%ebx
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 480:	8b 34 9d 00 15 00 00 	mov    0x1500(,%ebx,4),%esi
+ 487:	85 f6                	test   %esi,%esi
+ 489:	74 27                	je     4b2 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 48b:	8b 46 08             	mov    0x8(%esi),%eax
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 12                	jle    4a4 <flushall+0x34>
+ 492:	83 ec 04             	sub    $0x4,%esp
+ 495:	50                   	push   %eax
+ 496:	8d 46 10             	lea    0x10(%esi),%eax
+ 499:	50                   	push   %eax
+ 49a:	ff 36                	push   (%esi)
+ 49c:	e8 d5 fe ff ff       	call   376 <write>
+ 4a1:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 4a4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 4ab:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 4b2:	83 c3 01             	add    $0x1,%ebx
+ 4b5:	83 fb 10             	cmp    $0x10,%ebx
+ 4b8:	75 c6                	jne    480 <flushall+0x10>
+}
+ 4ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4bd:	5b                   	pop    %ebx
+ 4be:	5e                   	pop    %esi
+ 4bf:	5d                   	pop    %ebp
+ 4c0:	c3                   	ret
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4d8:	89 d1                	mov    %edx,%ecx
+{
+ 4da:	83 ec 2c             	sub    $0x2c,%esp
+ 4dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 4e0:	85 d2                	test   %edx,%edx
+ 4e2:	0f 89 c8 00 00 00    	jns    5b0 <printint+0xe0>
+ 4e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ec:	0f 84 be 00 00 00    	je     5b0 <printint+0xe0>
+    x = -xx;
+ 4f2:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 4fc:	31 f6                	xor    %esi,%esi
+ 4fe:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 500:	89 c8                	mov    %ecx,%eax
+ 502:	31 d2                	xor    %edx,%edx
+ 504:	89 f7                	mov    %esi,%edi
+ 506:	f7 f3                	div    %ebx
+ 508:	8d 76 01             	lea    0x1(%esi),%esi
+ 50b:	0f b6 92 0c 10 00 00 	movzbl 0x100c(%edx),%edx
+ 512:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 516:	89 ca                	mov    %ecx,%edx
+ 518:	89 c1                	mov    %eax,%ecx
+ 51a:	39 da                	cmp    %ebx,%edx
+ 51c:	73 e2                	jae    500 <printint+0x30>
+  if(neg)
+ 51e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 521:	85 c0                	test   %eax,%eax
+ 523:	74 07                	je     52c <printint+0x5c>
+    buf[i++] = '-';
+ 525:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 52a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 52c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 52f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 532:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 534:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 537:	8b 41 08             	mov    0x8(%ecx),%eax
+ 53a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 53d:	89 ce                	mov    %ecx,%esi
+ 53f:	eb 28                	jmp    569 <printint+0x99>
+ 541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 548:	89 c1                	mov    %eax,%ecx
+ 54a:	83 c0 01             	add    $0x1,%eax
+ 54d:	89 46 08             	mov    %eax,0x8(%esi)
+ 550:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 554:	80 fa 0a             	cmp    $0xa,%dl
+ 557:	75 07                	jne    560 <printint+0x90>
+    f->nl = 1;
+ 559:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 560:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 563:	39 fb                	cmp    %edi,%ebx
+ 565:	74 39                	je     5a0 <printint+0xd0>
+ 567:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 569:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 56c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 571:	75 d5                	jne    548 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 573:	83 ec 04             	sub    $0x4,%esp
+ 576:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 579:	68 00 02 00 00       	push   $0x200
+ 57e:	ff 75 d0             	push   -0x30(%ebp)
+ 581:	ff 36                	push   (%esi)
+ 583:	e8 ee fd ff ff       	call   376 <write>
+  return r;
+ 588:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 58c:	83 c4 10             	add    $0x10,%esp
+ 58f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 591:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 598:	b8 01 00 00 00       	mov    $0x1,%eax
+ 59d:	eb ae                	jmp    54d <printint+0x7d>
+ 59f:	90                   	nop
+}
+ 5a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5a3:	5b                   	pop    %ebx
+ 5a4:	5e                   	pop    %esi
+ 5a5:	5f                   	pop    %edi
+ 5a6:	5d                   	pop    %ebp
+ 5a7:	c3                   	ret
+ 5a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+  neg = 0;
+ 5b0:	31 c0                	xor    %eax,%eax
+ 5b2:	e9 42 ff ff ff       	jmp    4f9 <printint+0x29>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <bputc>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	89 c3                	mov    %eax,%ebx
+ 5c6:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 5c9:	8b 40 08             	mov    0x8(%eax),%eax
+ 5cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5d1:	74 1d                	je     5f0 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 5d3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5d6:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 5d9:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 5dd:	80 fa 0a             	cmp    $0xa,%dl
+ 5e0:	75 07                	jne    5e9 <bputc+0x29>
+    f->nl = 1;
+ 5e2:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 5e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5ec:	c9                   	leave
+ 5ed:	c3                   	ret
+ 5ee:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	8d 43 10             	lea    0x10(%ebx),%eax
+ 5f6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f9:	68 00 02 00 00       	push   $0x200
+ 5fe:	50                   	push   %eax
+ 5ff:	ff 33                	push   (%ebx)
+ 601:	e8 70 fd ff ff       	call   376 <write>
+  return r;
+ 606:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 609:	83 c4 10             	add    $0x10,%esp
+ 60c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 611:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb ba                	jmp    5d6 <bputc+0x16>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 1c             	sub    $0x1c,%esp
+ 629:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 62c:	0f b6 0a             	movzbl (%edx),%ecx
+ 62f:	84 c9                	test   %cl,%cl
+ 631:	74 47                	je     67a <vfprintf+0x5a>
+ 633:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 636:	89 c7                	mov    %eax,%edi
+ 638:	31 d2                	xor    %edx,%edx
+ 63a:	89 de                	mov    %ebx,%esi
+ 63c:	89 cb                	mov    %ecx,%ebx
+ 63e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 640:	0f be cb             	movsbl %bl,%ecx
+ 643:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 646:	85 d2                	test   %edx,%edx
+ 648:	75 4e                	jne    698 <vfprintf+0x78>
+      if(c == '%'){
+ 64a:	83 f8 25             	cmp    $0x25,%eax
+ 64d:	74 69                	je     6b8 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 64f:	8b 47 08             	mov    0x8(%edi),%eax
+ 652:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 657:	0f 84 73 01 00 00    	je     7d0 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 65d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 660:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 663:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 667:	80 fb 0a             	cmp    $0xa,%bl
+ 66a:	74 1c                	je     688 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 670:	0f b6 1e             	movzbl (%esi),%ebx
+ 673:	83 c6 01             	add    $0x1,%esi
+ 676:	84 db                	test   %bl,%bl
+ 678:	75 c6                	jne    640 <vfprintf+0x20>
+    }
+  }
+}
+ 67a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67d:	5b                   	pop    %ebx
+ 67e:	5e                   	pop    %esi
+ 67f:	5f                   	pop    %edi
+ 680:	5d                   	pop    %ebp
+ 681:	c3                   	ret
+ 682:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 688:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 68f:	eb df                	jmp    670 <vfprintf+0x50>
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 698:	83 fa 25             	cmp    $0x25,%edx
+ 69b:	75 d3                	jne    670 <vfprintf+0x50>
+      if(c == 'd'){
+ 69d:	83 f8 25             	cmp    $0x25,%eax
+ 6a0:	74 37                	je     6d9 <vfprintf+0xb9>
+ 6a2:	83 e8 63             	sub    $0x63,%eax
+ 6a5:	83 f8 15             	cmp    $0x15,%eax
+ 6a8:	77 16                	ja     6c0 <vfprintf+0xa0>
+ 6aa:	ff 24 85 b4 0f 00 00 	jmp    *0xfb4(,%eax,4)
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 6b8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6bd:	eb b1                	jmp    670 <vfprintf+0x50>
+ 6bf:	90                   	nop
+  if(f->n == BUFSIZ)
+ 6c0:	8b 47 08             	mov    0x8(%edi),%eax
+ 6c3:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6c8:	0f 84 4c 01 00 00    	je     81a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 6ce:	8d 50 01             	lea    0x1(%eax),%edx
+ 6d1:	89 57 08             	mov    %edx,0x8(%edi)
+ 6d4:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 6d9:	89 ca                	mov    %ecx,%edx
+ 6db:	89 f8                	mov    %edi,%eax
+ 6dd:	e8 de fe ff ff       	call   5c0 <bputc>
+ 6e2:	eb 88                	jmp    66c <vfprintf+0x4c>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 6e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 6eb:	83 ec 0c             	sub    $0xc,%esp
+ 6ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6f3:	8b 13                	mov    (%ebx),%edx
+ 6f5:	6a 00                	push   $0x0
+ 6f7:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f9:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 6fc:	e8 cf fd ff ff       	call   4d0 <printint>
+        ap++;
+ 701:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 704:	83 c4 10             	add    $0x10,%esp
+ 707:	e9 60 ff ff ff       	jmp    66c <vfprintf+0x4c>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 710:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 713:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 71b:	85 d2                	test   %edx,%edx
+ 71d:	0f 84 dd 00 00 00    	je     800 <vfprintf+0x1e0>
+        while(*s != 0){
+ 723:	0f b6 1a             	movzbl (%edx),%ebx
+ 726:	84 db                	test   %bl,%bl
+ 728:	0f 84 3e ff ff ff    	je     66c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 72e:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 731:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 734:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 737:	89 fe                	mov    %edi,%esi
+ 739:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 73c:	89 d7                	mov    %edx,%edi
+ 73e:	eb 27                	jmp    767 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 740:	89 c1                	mov    %eax,%ecx
+ 742:	83 c0 01             	add    $0x1,%eax
+ 745:	89 46 08             	mov    %eax,0x8(%esi)
+ 748:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 74c:	80 fb 0a             	cmp    $0xa,%bl
+ 74f:	75 07                	jne    758 <vfprintf+0x138>
+    f->nl = 1;
+ 751:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 758:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 75c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 75f:	84 db                	test   %bl,%bl
+ 761:	0f 84 a9 00 00 00    	je     810 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 767:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 76c:	75 d2                	jne    740 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 76e:	83 ec 04             	sub    $0x4,%esp
+ 771:	68 00 02 00 00       	push   $0x200
+ 776:	ff 75 e0             	push   -0x20(%ebp)
+ 779:	ff 36                	push   (%esi)
+ 77b:	e8 f6 fb ff ff       	call   376 <write>
+  return r;
+ 780:	83 c4 10             	add    $0x10,%esp
+ 783:	b8 01 00 00 00       	mov    $0x1,%eax
+ 788:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 78a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 791:	eb b2                	jmp    745 <vfprintf+0x125>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 798:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 79b:	83 ec 0c             	sub    $0xc,%esp
+ 79e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7a3:	8b 13                	mov    (%ebx),%edx
+ 7a5:	6a 01                	push   $0x1
+ 7a7:	e9 4b ff ff ff       	jmp    6f7 <vfprintf+0xd7>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 7b0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 7b3:	89 f8                	mov    %edi,%eax
+ 7b5:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 7b8:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 7bb:	e8 00 fe ff ff       	call   5c0 <bputc>
+        ap++;
+ 7c0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 7c3:	31 d2                	xor    %edx,%edx
+ 7c5:	e9 a6 fe ff ff       	jmp    670 <vfprintf+0x50>
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	8d 47 10             	lea    0x10(%edi),%eax
+ 7d6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 7d9:	68 00 02 00 00       	push   $0x200
+ 7de:	50                   	push   %eax
+ 7df:	ff 37                	push   (%edi)
+ 7e1:	e8 90 fb ff ff       	call   376 <write>
+  return r;
+ 7e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 7e9:	83 c4 10             	add    $0x10,%esp
+ 7ec:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 7ee:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 7f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 7fa:	e9 61 fe ff ff       	jmp    660 <vfprintf+0x40>
+ 7ff:	90                   	nop
+          s = "(null)";
+ 800:	ba ad 0f 00 00       	mov    $0xfad,%edx
+ 805:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 80a:	e9 1f ff ff ff       	jmp    72e <vfprintf+0x10e>
+ 80f:	90                   	nop
+ 810:	89 f7                	mov    %esi,%edi
+ 812:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 815:	e9 52 fe ff ff       	jmp    66c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 81a:	83 ec 04             	sub    $0x4,%esp
+ 81d:	8d 47 10             	lea    0x10(%edi),%eax
+ 820:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 823:	68 00 02 00 00       	push   $0x200
+ 828:	50                   	push   %eax
+ 829:	ff 37                	push   (%edi)
+ 82b:	e8 46 fb ff ff       	call   376 <write>
+  return r;
+ 830:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 833:	83 c4 10             	add    $0x10,%esp
+ 836:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 83b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 842:	31 c0                	xor    %eax,%eax
+ 844:	e9 88 fe ff ff       	jmp    6d1 <vfprintf+0xb1>
+ 849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <fdopen>:
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	56                   	push   %esi
+ 854:	53                   	push   %ebx
+ 855:	83 ec 20             	sub    $0x20,%esp
+ 858:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 85b:	83 fe 0f             	cmp    $0xf,%esi
+ 85e:	0f 87 84 00 00 00    	ja     8e8 <fdopen+0x98>
+  if(streams[fd])
+ 864:	8b 1c b5 00 15 00 00 	mov    0x1500(,%esi,4),%ebx
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	74 11                	je     880 <fdopen+0x30>
+}
+ 86f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 872:	89 d8                	mov    %ebx,%eax
+ 874:	5b                   	pop    %ebx
+ 875:	5e                   	pop    %esi
+ 876:	5d                   	pop    %ebp
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 880:	83 ec 0c             	sub    $0xc,%esp
+ 883:	68 10 02 00 00       	push   $0x210
+ 888:	e8 e3 05 00 00       	call   e70 <malloc>
+ 88d:	83 c4 10             	add    $0x10,%esp
+ 890:	89 c3                	mov    %eax,%ebx
+ 892:	85 c0                	test   %eax,%eax
+ 894:	74 52                	je     8e8 <fdopen+0x98>
+  f->fd = fd;
+ 896:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 898:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 89b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 8a2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 8a9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 8b0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 8b3:	50                   	push   %eax
+ 8b4:	56                   	push   %esi
+ 8b5:	e8 f4 fa ff ff       	call   3ae <fstat>
+ 8ba:	83 c4 10             	add    $0x10,%esp
+ 8bd:	85 c0                	test   %eax,%eax
+ 8bf:	75 07                	jne    8c8 <fdopen+0x78>
+ 8c1:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 8c6:	74 30                	je     8f8 <fdopen+0xa8>
+  streams[fd] = f;
+ 8c8:	89 1c b5 00 15 00 00 	mov    %ebx,0x1500(,%esi,4)
+}
+ 8cf:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 8d1:	c7 05 e0 14 00 00 70 	movl   $0x470,0x14e0
+ 8d8:	04 00 00 
+}
+ 8db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8de:	5b                   	pop    %ebx
+ 8df:	5e                   	pop    %esi
+ 8e0:	5d                   	pop    %ebp
+ 8e1:	c3                   	ret
+ 8e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 8e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 8eb:	31 db                	xor    %ebx,%ebx
+}
+ 8ed:	89 d8                	mov    %ebx,%eax
+ 8ef:	5b                   	pop    %ebx
+ 8f0:	5e                   	pop    %esi
+ 8f1:	5d                   	pop    %ebp
+ 8f2:	c3                   	ret
+ 8f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8f7:	90                   	nop
+    f->mode = _IOLBF;
+ 8f8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 8ff:	eb c7                	jmp    8c8 <fdopen+0x78>
+ 901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+
+00000910 <fopen>:
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	53                   	push   %ebx
+ 914:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 917:	ff 75 0c             	push   0xc(%ebp)
+ 91a:	ff 75 08             	push   0x8(%ebp)
+ 91d:	e8 74 fa ff ff       	call   396 <open>
+ 922:	83 c4 10             	add    $0x10,%esp
+ 925:	85 c0                	test   %eax,%eax
+ 927:	78 37                	js     960 <fopen+0x50>
+ 929:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 92b:	8b 04 85 00 15 00 00 	mov    0x1500(,%eax,4),%eax
+ 932:	85 c0                	test   %eax,%eax
+ 934:	74 17                	je     94d <fopen+0x3d>
+    free(streams[fd]);
+ 936:	83 ec 0c             	sub    $0xc,%esp
+ 939:	50                   	push   %eax
+ 93a:	e8 a1 04 00 00       	call   de0 <free>
+    streams[fd] = 0;
+ 93f:	83 c4 10             	add    $0x10,%esp
+ 942:	c7 04 9d 00 15 00 00 	movl   $0x0,0x1500(,%ebx,4)
+ 949:	00 00 00 00 
+  return fdopen(fd);
+ 94d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 950:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 953:	c9                   	leave
+  return fdopen(fd);
+ 954:	e9 f7 fe ff ff       	jmp    850 <fdopen>
+ 959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 963:	31 c0                	xor    %eax,%eax
+ 965:	c9                   	leave
+ 966:	c3                   	ret
+ 967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96e:	66 90                	xchg   %ax,%ax
+
+00000970 <setvbuf>:
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	56                   	push   %esi
+ 974:	53                   	push   %ebx
+ 975:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 978:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 97b:	83 fe 02             	cmp    $0x2,%esi
+ 97e:	77 38                	ja     9b8 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 980:	8b 43 08             	mov    0x8(%ebx),%eax
+ 983:	85 c0                	test   %eax,%eax
+ 985:	7e 12                	jle    999 <setvbuf+0x29>
+ 987:	83 ec 04             	sub    $0x4,%esp
+ 98a:	50                   	push   %eax
+ 98b:	8d 43 10             	lea    0x10(%ebx),%eax
+ 98e:	50                   	push   %eax
+ 98f:	ff 33                	push   (%ebx)
+ 991:	e8 e0 f9 ff ff       	call   376 <write>
+ 996:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 999:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 9a0:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 9a2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 9a9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 9ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9af:	5b                   	pop    %ebx
+ 9b0:	5e                   	pop    %esi
+ 9b1:	5d                   	pop    %ebp
+ 9b2:	c3                   	ret
+ 9b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9b7:	90                   	nop
+    return -1;
+ 9b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9bd:	eb ed                	jmp    9ac <setvbuf+0x3c>
+ 9bf:	90                   	nop
+
+000009c0 <fflush>:
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	31 c0                	xor    %eax,%eax
+ 9c3:	89 e5                	mov    %esp,%ebp
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 04             	sub    $0x4,%esp
+ 9c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 9cc:	8b 53 08             	mov    0x8(%ebx),%edx
+ 9cf:	85 d2                	test   %edx,%edx
+ 9d1:	7e 1d                	jle    9f0 <fflush+0x30>
+ 9d3:	83 ec 04             	sub    $0x4,%esp
+ 9d6:	8d 43 10             	lea    0x10(%ebx),%eax
+ 9d9:	52                   	push   %edx
+ 9da:	50                   	push   %eax
+ 9db:	ff 33                	push   (%ebx)
+ 9dd:	e8 94 f9 ff ff       	call   376 <write>
+ 9e2:	83 c4 10             	add    $0x10,%esp
+ 9e5:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 9e8:	0f 95 c0             	setne  %al
+ 9eb:	0f b6 c0             	movzbl %al,%eax
+ 9ee:	f7 d8                	neg    %eax
+  f->n = 0;
+ 9f0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 9f7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 9fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a01:	c9                   	leave
+ a02:	c3                   	ret
+ a03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <fclose>:
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	56                   	push   %esi
+ a14:	31 f6                	xor    %esi,%esi
+ a16:	53                   	push   %ebx
+ a17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a1a:	8b 43 08             	mov    0x8(%ebx),%eax
+ a1d:	85 c0                	test   %eax,%eax
+ a1f:	7e 1f                	jle    a40 <fclose+0x30>
+ a21:	83 ec 04             	sub    $0x4,%esp
+ a24:	50                   	push   %eax
+ a25:	8d 43 10             	lea    0x10(%ebx),%eax
+ a28:	50                   	push   %eax
+ a29:	ff 33                	push   (%ebx)
+ a2b:	e8 46 f9 ff ff       	call   376 <write>
+ a30:	83 c4 10             	add    $0x10,%esp
+ a33:	39 43 08             	cmp    %eax,0x8(%ebx)
+ a36:	0f 95 c0             	setne  %al
+ a39:	0f b6 c0             	movzbl %al,%eax
+ a3c:	f7 d8                	neg    %eax
+ a3e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ a40:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ a43:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a4a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ a51:	ff 33                	push   (%ebx)
+ a53:	e8 26 f9 ff ff       	call   37e <close>
+ a58:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ a5b:	85 c0                	test   %eax,%eax
+ a5d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a62:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ a65:	8b 03                	mov    (%ebx),%eax
+ a67:	83 f8 0f             	cmp    $0xf,%eax
+ a6a:	77 09                	ja     a75 <fclose+0x65>
+ a6c:	39 1c 85 00 15 00 00 	cmp    %ebx,0x1500(,%eax,4)
+ a73:	74 0b                	je     a80 <fclose+0x70>
+}
+ a75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a78:	89 f0                	mov    %esi,%eax
+ a7a:	5b                   	pop    %ebx
+ a7b:	5e                   	pop    %esi
+ a7c:	5d                   	pop    %ebp
+ a7d:	c3                   	ret
+ a7e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ a80:	c7 04 85 00 15 00 00 	movl   $0x0,0x1500(,%eax,4)
+ a87:	00 00 00 00 
+    free(f);
+ a8b:	83 ec 0c             	sub    $0xc,%esp
+ a8e:	53                   	push   %ebx
+ a8f:	e8 4c 03 00 00       	call   de0 <free>
+ a94:	83 c4 10             	add    $0x10,%esp
+  return r;
+ a97:	eb dc                	jmp    a75 <fclose+0x65>
+ a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000aa0 <fputc>:
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	53                   	push   %ebx
+ aa4:	83 ec 04             	sub    $0x4,%esp
+ aa7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ aaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ aad:	8b 43 08             	mov    0x8(%ebx),%eax
+ ab0:	3d 00 02 00 00       	cmp    $0x200,%eax
+ ab5:	74 59                	je     b10 <fputc+0x70>
+  f->buf[f->n++] = c;
+ ab7:	8d 48 01             	lea    0x1(%eax),%ecx
+ aba:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ abd:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ ac1:	80 fa 0a             	cmp    $0xa,%dl
+ ac4:	75 07                	jne    acd <fputc+0x2d>
+    f->nl = 1;
+ ac6:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ acd:	8b 43 04             	mov    0x4(%ebx),%eax
+ ad0:	83 f8 02             	cmp    $0x2,%eax
+ ad3:	74 1a                	je     aef <fputc+0x4f>
+ ad5:	83 f8 01             	cmp    $0x1,%eax
+ ad8:	74 0e                	je     ae8 <fputc+0x48>
+}
+ ada:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ add:	0f b6 c2             	movzbl %dl,%eax
+}
+ ae0:	c9                   	leave
+ ae1:	c3                   	ret
+ ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ ae8:	8b 43 0c             	mov    0xc(%ebx),%eax
+ aeb:	85 c0                	test   %eax,%eax
+ aed:	74 eb                	je     ada <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ aef:	85 c9                	test   %ecx,%ecx
+ af1:	7f 4d                	jg     b40 <fputc+0xa0>
+  f->n = 0;
+ af3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ afa:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ b04:	0f b6 c2             	movzbl %dl,%eax
+}
+ b07:	c9                   	leave
+ b08:	c3                   	ret
+ b09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b10:	83 ec 04             	sub    $0x4,%esp
+ b13:	8d 43 10             	lea    0x10(%ebx),%eax
+ b16:	89 55 08             	mov    %edx,0x8(%ebp)
+ b19:	68 00 02 00 00       	push   $0x200
+ b1e:	50                   	push   %eax
+ b1f:	ff 33                	push   (%ebx)
+ b21:	e8 50 f8 ff ff       	call   376 <write>
+  return r;
+ b26:	8b 55 08             	mov    0x8(%ebp),%edx
+ b29:	83 c4 10             	add    $0x10,%esp
+ b2c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ b31:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ b38:	31 c0                	xor    %eax,%eax
+ b3a:	e9 7b ff ff ff       	jmp    aba <fputc+0x1a>
+ b3f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b40:	83 ec 04             	sub    $0x4,%esp
+ b43:	8d 43 10             	lea    0x10(%ebx),%eax
+ b46:	89 55 08             	mov    %edx,0x8(%ebp)
+ b49:	51                   	push   %ecx
+ b4a:	50                   	push   %eax
+ b4b:	ff 33                	push   (%ebx)
+ b4d:	e8 24 f8 ff ff       	call   376 <write>
+  f->n = 0;
+ b52:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ b5c:	83 c4 10             	add    $0x10,%esp
+ b5f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ b66:	eb 99                	jmp    b01 <fputc+0x61>
+ b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+
+00000b70 <fwrite>:
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	57                   	push   %edi
+ b74:	56                   	push   %esi
+ b75:	53                   	push   %ebx
+ b76:	83 ec 1c             	sub    $0x1c,%esp
+ b79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ b7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ b7f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ b82:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ b85:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ b8b:	0f 8f af 00 00 00    	jg     c40 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ b91:	85 ff                	test   %edi,%edi
+ b93:	7e 73                	jle    c08 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b95:	8d 56 10             	lea    0x10(%esi),%edx
+ b98:	8b 46 08             	mov    0x8(%esi),%eax
+ b9b:	31 db                	xor    %ebx,%ebx
+ b9d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ ba0:	eb 25                	jmp    bc7 <fwrite+0x57>
+ ba2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ ba8:	89 c1                	mov    %eax,%ecx
+ baa:	83 c0 01             	add    $0x1,%eax
+ bad:	89 46 08             	mov    %eax,0x8(%esi)
+ bb0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ bb4:	80 fa 0a             	cmp    $0xa,%dl
+ bb7:	75 07                	jne    bc0 <fwrite+0x50>
+    f->nl = 1;
+ bb9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ bc0:	83 c3 01             	add    $0x1,%ebx
+ bc3:	39 df                	cmp    %ebx,%edi
+ bc5:	7e 41                	jle    c08 <fwrite+0x98>
+    bputc(f, s[i]);
+ bc7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ bca:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ bce:	3d 00 02 00 00       	cmp    $0x200,%eax
+ bd3:	75 d3                	jne    ba8 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bd5:	83 ec 04             	sub    $0x4,%esp
+ bd8:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ bdb:	68 00 02 00 00       	push   $0x200
+ be0:	ff 75 e0             	push   -0x20(%ebp)
+ be3:	ff 36                	push   (%esi)
+ be5:	e8 8c f7 ff ff       	call   376 <write>
+  return r;
+ bea:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ bee:	83 c4 10             	add    $0x10,%esp
+ bf1:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ bf3:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ bfa:	b8 01 00 00 00       	mov    $0x1,%eax
+ bff:	eb ac                	jmp    bad <fwrite+0x3d>
+ c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c08:	8b 46 04             	mov    0x4(%esi),%eax
+ c0b:	83 f8 02             	cmp    $0x2,%eax
+ c0e:	74 0c                	je     c1c <fwrite+0xac>
+ c10:	83 f8 01             	cmp    $0x1,%eax
+ c13:	75 1c                	jne    c31 <fwrite+0xc1>
+ c15:	8b 46 0c             	mov    0xc(%esi),%eax
+ c18:	85 c0                	test   %eax,%eax
+ c1a:	74 15                	je     c31 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c1c:	8b 46 08             	mov    0x8(%esi),%eax
+ c1f:	85 c0                	test   %eax,%eax
+ c21:	7f 5d                	jg     c80 <fwrite+0x110>
+  f->n = 0;
+ c23:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c2a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ c31:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c37:	5b                   	pop    %ebx
+ c38:	5e                   	pop    %esi
+ c39:	5f                   	pop    %edi
+ c3a:	5d                   	pop    %ebp
+ c3b:	c3                   	ret
+ c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ c40:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ c44:	0f 84 4b ff ff ff    	je     b95 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c4a:	8b 46 08             	mov    0x8(%esi),%eax
+ c4d:	8b 16                	mov    (%esi),%edx
+ c4f:	85 c0                	test   %eax,%eax
+ c51:	7f 45                	jg     c98 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ c53:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ c56:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c5d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ c64:	57                   	push   %edi
+ c65:	ff 75 08             	push   0x8(%ebp)
+ c68:	ff 36                	push   (%esi)
+ c6a:	e8 07 f7 ff ff       	call   376 <write>
+    return size > 0 ? i / size : 0;
+ c6f:	83 c4 10             	add    $0x10,%esp
+ c72:	85 c0                	test   %eax,%eax
+ c74:	78 4a                	js     cc0 <fwrite+0x150>
+ c76:	85 db                	test   %ebx,%ebx
+ c78:	7e 46                	jle    cc0 <fwrite+0x150>
+ c7a:	99                   	cltd
+ c7b:	f7 fb                	idiv   %ebx
+ c7d:	eb b5                	jmp    c34 <fwrite+0xc4>
+ c7f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c80:	83 ec 04             	sub    $0x4,%esp
+ c83:	50                   	push   %eax
+ c84:	8d 46 10             	lea    0x10(%esi),%eax
+ c87:	50                   	push   %eax
+ c88:	ff 36                	push   (%esi)
+ c8a:	e8 e7 f6 ff ff       	call   376 <write>
+ c8f:	83 c4 10             	add    $0x10,%esp
+ c92:	eb 8f                	jmp    c23 <fwrite+0xb3>
+ c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c98:	83 ec 04             	sub    $0x4,%esp
+ c9b:	50                   	push   %eax
+ c9c:	8d 46 10             	lea    0x10(%esi),%eax
+ c9f:	50                   	push   %eax
+ ca0:	52                   	push   %edx
+ ca1:	e8 d0 f6 ff ff       	call   376 <write>
+ ca6:	83 c4 10             	add    $0x10,%esp
+ ca9:	3b 46 08             	cmp    0x8(%esi),%eax
+ cac:	74 a5                	je     c53 <fwrite+0xe3>
+  f->n = 0;
+ cae:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ cb5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ cc0:	31 c0                	xor    %eax,%eax
+ cc2:	e9 6d ff ff ff       	jmp    c34 <fwrite+0xc4>
+ cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cce:	66 90                	xchg   %ax,%ax
+
+00000cd0 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ cd4:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ cd7:	83 ec 04             	sub    $0x4,%esp
+ cda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ cdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ce0:	89 d8                	mov    %ebx,%eax
+ ce2:	e8 39 f9 ff ff       	call   620 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ ce7:	8b 43 04             	mov    0x4(%ebx),%eax
+ cea:	83 f8 02             	cmp    $0x2,%eax
+ ced:	74 18                	je     d07 <fprintf+0x37>
+ cef:	83 f8 01             	cmp    $0x1,%eax
+ cf2:	74 0c                	je     d00 <fprintf+0x30>
+  settle(f);
+}
+ cf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ cf7:	c9                   	leave
+ cf8:	c3                   	ret
+ cf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ d00:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d03:	85 c0                	test   %eax,%eax
+ d05:	74 ed                	je     cf4 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d07:	8b 43 08             	mov    0x8(%ebx),%eax
+ d0a:	85 c0                	test   %eax,%eax
+ d0c:	7f 1a                	jg     d28 <fprintf+0x58>
+  f->n = 0;
+ d0e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d15:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ d1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d1f:	c9                   	leave
+ d20:	c3                   	ret
+ d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d28:	83 ec 04             	sub    $0x4,%esp
+ d2b:	50                   	push   %eax
+ d2c:	8d 43 10             	lea    0x10(%ebx),%eax
+ d2f:	50                   	push   %eax
+ d30:	ff 33                	push   (%ebx)
+ d32:	e8 3f f6 ff ff       	call   376 <write>
+  f->n = 0;
+ d37:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ d3e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ d41:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ d48:	eb d2                	jmp    d1c <fprintf+0x4c>
+ d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d50 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	53                   	push   %ebx
+ d54:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ d5d:	83 f8 0f             	cmp    $0xf,%eax
+ d60:	77 4e                	ja     db0 <printf+0x60>
+ d62:	8b 1c 85 00 15 00 00 	mov    0x1500(,%eax,4),%ebx
+ d69:	85 db                	test   %ebx,%ebx
+ d6b:	74 43                	je     db0 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ d6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d70:	89 d8                	mov    %ebx,%eax
+ d72:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ d75:	e8 a6 f8 ff ff       	call   620 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d7a:	8b 43 08             	mov    0x8(%ebx),%eax
+ d7d:	85 c0                	test   %eax,%eax
+ d7f:	7e 12                	jle    d93 <printf+0x43>
+ d81:	83 ec 04             	sub    $0x4,%esp
+ d84:	50                   	push   %eax
+ d85:	8d 43 10             	lea    0x10(%ebx),%eax
+ d88:	50                   	push   %eax
+ d89:	ff 33                	push   (%ebx)
+ d8b:	e8 e6 f5 ff ff       	call   376 <write>
+ d90:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ d93:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d9a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ da1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ da4:	c9                   	leave
+ da5:	c3                   	ret
+ da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ db0:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ db6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ dbc:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ dc3:	00 00 00 
+    f->n = 0;
+ dc6:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ dcd:	00 00 00 
+    f->nl = 0;
+ dd0:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ dd7:	00 00 00 
+ dda:	eb 91                	jmp    d6d <printf+0x1d>
+ ddc:	66 90                	xchg   %ax,%ax
+ dde:	66 90                	xchg   %ax,%ax
+
+00000de0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ de0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ de1:	a1 40 15 00 00       	mov    0x1540,%eax
+{
+ de6:	89 e5                	mov    %esp,%ebp
+ de8:	57                   	push   %edi
+ de9:	56                   	push   %esi
+ dea:	53                   	push   %ebx
+ deb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ dee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ df8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ dfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dfc:	39 ca                	cmp    %ecx,%edx
+ dfe:	73 30                	jae    e30 <free+0x50>
+ e00:	39 c1                	cmp    %eax,%ecx
+ e02:	72 04                	jb     e08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e04:	39 c2                	cmp    %eax,%edx
+ e06:	72 f0                	jb     df8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ e0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ e0e:	39 f8                	cmp    %edi,%eax
+ e10:	74 2e                	je     e40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e15:	8b 42 04             	mov    0x4(%edx),%eax
+ e18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e1b:	39 f1                	cmp    %esi,%ecx
+ e1d:	74 38                	je     e57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ e21:	5b                   	pop    %ebx
+  freep = p;
+ e22:	89 15 40 15 00 00    	mov    %edx,0x1540
+}
+ e28:	5e                   	pop    %esi
+ e29:	5f                   	pop    %edi
+ e2a:	5d                   	pop    %ebp
+ e2b:	c3                   	ret
+ e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e30:	39 c1                	cmp    %eax,%ecx
+ e32:	72 d0                	jb     e04 <free+0x24>
+ e34:	eb c2                	jmp    df8 <free+0x18>
+ e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ e40:	03 70 04             	add    0x4(%eax),%esi
+ e43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e46:	8b 02                	mov    (%edx),%eax
+ e48:	8b 00                	mov    (%eax),%eax
+ e4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ e4d:	8b 42 04             	mov    0x4(%edx),%eax
+ e50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e53:	39 f1                	cmp    %esi,%ecx
+ e55:	75 c8                	jne    e1f <free+0x3f>
+    p->s.size += bp->s.size;
+ e57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e5a:	89 15 40 15 00 00    	mov    %edx,0x1540
+    p->s.size += bp->s.size;
+ e60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ e63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ e66:	89 0a                	mov    %ecx,(%edx)
+}
+ e68:	5b                   	pop    %ebx
+ e69:	5e                   	pop    %esi
+ e6a:	5f                   	pop    %edi
+ e6b:	5d                   	pop    %ebp
+ e6c:	c3                   	ret
+ e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e70:	55                   	push   %ebp
+ e71:	89 e5                	mov    %esp,%ebp
+ e73:	57                   	push   %edi
+ e74:	56                   	push   %esi
+ e75:	53                   	push   %ebx
+ e76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e7c:	8b 15 40 15 00 00    	mov    0x1540,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e82:	8d 78 07             	lea    0x7(%eax),%edi
+ e85:	c1 ef 03             	shr    $0x3,%edi
+ e88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e8b:	85 d2                	test   %edx,%edx
+ e8d:	0f 84 8d 00 00 00    	je     f20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e95:	8b 48 04             	mov    0x4(%eax),%ecx
+ e98:	39 f9                	cmp    %edi,%ecx
+ e9a:	73 64                	jae    f00 <malloc+0x90>
+  if(nu < 4096)
+ e9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ea1:	39 df                	cmp    %ebx,%edi
+ ea3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ea6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ead:	eb 0a                	jmp    eb9 <malloc+0x49>
+ eaf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ eb0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ eb2:	8b 48 04             	mov    0x4(%eax),%ecx
+ eb5:	39 f9                	cmp    %edi,%ecx
+ eb7:	73 47                	jae    f00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ eb9:	89 c2                	mov    %eax,%edx
+ ebb:	39 05 40 15 00 00    	cmp    %eax,0x1540
+ ec1:	75 ed                	jne    eb0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ec3:	83 ec 0c             	sub    $0xc,%esp
+ ec6:	56                   	push   %esi
+ ec7:	e8 12 f5 ff ff       	call   3de <sbrk>
+  if(p == (char*)-1)
+ ecc:	83 c4 10             	add    $0x10,%esp
+ ecf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ed2:	74 1c                	je     ef0 <malloc+0x80>
+  hp->s.size = nu;
+ ed4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ed7:	83 ec 0c             	sub    $0xc,%esp
+ eda:	83 c0 08             	add    $0x8,%eax
+ edd:	50                   	push   %eax
+ ede:	e8 fd fe ff ff       	call   de0 <free>
+  return freep;
+ ee3:	8b 15 40 15 00 00    	mov    0x1540,%edx
+      if((p = morecore(nunits)) == 0)
+ ee9:	83 c4 10             	add    $0x10,%esp
+ eec:	85 d2                	test   %edx,%edx
+ eee:	75 c0                	jne    eb0 <malloc+0x40>
+        return 0;
+  }
+}
+ ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ef3:	31 c0                	xor    %eax,%eax
+}
+ ef5:	5b                   	pop    %ebx
+ ef6:	5e                   	pop    %esi
+ ef7:	5f                   	pop    %edi
+ ef8:	5d                   	pop    %ebp
+ ef9:	c3                   	ret
+ efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ f00:	39 cf                	cmp    %ecx,%edi
+ f02:	74 4c                	je     f50 <malloc+0xe0>
+        p->s.size -= nunits;
+ f04:	29 f9                	sub    %edi,%ecx
+ f06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ f09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ f0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ f0f:	89 15 40 15 00 00    	mov    %edx,0x1540
+}
+ f15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f18:	83 c0 08             	add    $0x8,%eax
+}
+ f1b:	5b                   	pop    %ebx
+ f1c:	5e                   	pop    %esi
+ f1d:	5f                   	pop    %edi
+ f1e:	5d                   	pop    %ebp
+ f1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ f20:	c7 05 40 15 00 00 44 	movl   $0x1544,0x1540
+ f27:	15 00 00 
+    base.s.size = 0;
+ f2a:	b8 44 15 00 00       	mov    $0x1544,%eax
+    base.s.ptr = freep = prevp = &base;
+ f2f:	c7 05 44 15 00 00 44 	movl   $0x1544,0x1544
+ f36:	15 00 00 
+    base.s.size = 0;
+ f39:	c7 05 48 15 00 00 00 	movl   $0x0,0x1548
+ f40:	00 00 00 
+    if(p->s.size >= nunits){
+ f43:	e9 54 ff ff ff       	jmp    e9c <malloc+0x2c>
+ f48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f50:	8b 08                	mov    (%eax),%ecx
+ f52:	89 0a                	mov    %ecx,(%edx)
+ f54:	eb b9                	jmp    f0f <malloc+0x9f>
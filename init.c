@@ -17,6 +17,7 @@ main(void)
   }
   dup(0);  // stdout
   dup(0);  // stderr
+  mknod("proc", 2, 0);  // PROCSTAT; fails if it is already there
 
   for(;;){
     printf(1, "init: starting sh\n");
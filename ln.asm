@@ -0,0 +1,2034 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 b8 0e 00 00       	push   $0xeb8
+  1e:	6a 02                	push   $0x2
+  20:	e8 8b 0c 00 00       	call   cb0 <printf>
+    exit();
+  25:	e8 76 02 00 00       	call   2a0 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 df 02 00 00       	call   316 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 5d 02 00 00       	call   2a0 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 cb 0e 00 00       	push   $0xecb
+  4e:	6a 02                	push   $0x2
+  50:	e8 5b 0c 00 00       	call   cb0 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 31 01 00 00       	call   2ce <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 04 01 00 00       	call   2f6 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 07 01 00 00       	call   30e <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 cd 00 00 00       	call   2de <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 2a6:	a1 00 14 00 00       	mov    0x1400,%eax
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	74 02                	je     2b1 <exit+0x11>
+    exithook();
+ 2af:	ff d0                	call   *%eax
+  _exit();
+ 2b1:	e8 10 01 00 00       	call   3c6 <_exit>
+
+000002b6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2bb:	cd 40                	int    $0x40
+ 2bd:	c3                   	ret
+
+000002be <wait>:
+SYSCALL(wait)
+ 2be:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c3:	cd 40                	int    $0x40
+ 2c5:	c3                   	ret
+
+000002c6 <pipe>:
+SYSCALL(pipe)
+ 2c6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+000002ce <read>:
+SYSCALL(read)
+ 2ce:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+000002d6 <write>:
+SYSCALL(write)
+ 2d6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <close>:
+SYSCALL(close)
+ 2de:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <kill>:
+SYSCALL(kill)
+ 2e6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <exec>:
+SYSCALL(exec)
+ 2ee:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <open>:
+SYSCALL(open)
+ 2f6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <mknod>:
+SYSCALL(mknod)
+ 2fe:	b8 11 00 00 00       	mov    $0x11,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <unlink>:
+SYSCALL(unlink)
+ 306:	b8 12 00 00 00       	mov    $0x12,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <fstat>:
+SYSCALL(fstat)
+ 30e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <link>:
+SYSCALL(link)
+ 316:	b8 13 00 00 00       	mov    $0x13,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <mkdir>:
+SYSCALL(mkdir)
+ 31e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <chdir>:
+SYSCALL(chdir)
+ 326:	b8 09 00 00 00       	mov    $0x9,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <dup>:
+SYSCALL(dup)
+ 32e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <getpid>:
+SYSCALL(getpid)
+ 336:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <sbrk>:
+SYSCALL(sbrk)
+ 33e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <sleep>:
+SYSCALL(sleep)
+ 346:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <uptime>:
+SYSCALL(uptime)
+ 34e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 356:	b8 16 00 00 00       	mov    $0x16,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <sigaction>:
+SYSCALL(sigaction)
+ 35e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <sigret>:
+SYSCALL(sigret)
+ 366:	b8 18 00 00 00       	mov    $0x18,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <readv>:
+SYSCALL(readv)
+ 36e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <writev>:
+SYSCALL(writev)
+ 376:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <nanosleep>:
+SYSCALL(nanosleep)
+ 37e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <setpriority>:
+SYSCALL(setpriority)
+ 386:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <sched_setattr>:
+SYSCALL(sched_setattr)
+ 38e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <sched_yield>:
+SYSCALL(sched_yield)
+ 396:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 39e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 3a6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <getrusage>:
+SYSCALL(getrusage)
+ 3ae:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <syslat>:
+SYSCALL(syslat)
+ 3b6:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <sched_getattr>:
+SYSCALL(sched_getattr)
+ 3be:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 3c6:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 3cb:	cd 40                	int    $0x40
+  ret
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 3d5:	31 db                	xor    %ebx,%ebx
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 3e0:	8b 34 9d 20 14 00 00 	mov    0x1420(,%ebx,4),%esi
+ 3e7:	85 f6                	test   %esi,%esi
+ 3e9:	74 27                	je     412 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 3eb:	8b 46 08             	mov    0x8(%esi),%eax
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 12                	jle    404 <flushall+0x34>
+ 3f2:	83 ec 04             	sub    $0x4,%esp
+ 3f5:	50                   	push   %eax
+ 3f6:	8d 46 10             	lea    0x10(%esi),%eax
+ 3f9:	50                   	push   %eax
+ 3fa:	ff 36                	push   (%esi)
+ 3fc:	e8 d5 fe ff ff       	call   2d6 <write>
+ 401:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 404:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 40b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 412:	83 c3 01             	add    $0x1,%ebx
+ 415:	83 fb 10             	cmp    $0x10,%ebx
+ 418:	75 c6                	jne    3e0 <flushall+0x10>
+}
+ 41a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5d                   	pop    %ebp
+ 420:	c3                   	ret
+ 421:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 438:	89 d1                	mov    %edx,%ecx
+{
+ 43a:	83 ec 2c             	sub    $0x2c,%esp
+ 43d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 440:	85 d2                	test   %edx,%edx
+ 442:	0f 89 c8 00 00 00    	jns    510 <printint+0xe0>
+ 448:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 44c:	0f 84 be 00 00 00    	je     510 <printint+0xe0>
+    x = -xx;
+ 452:	f7 d9                	neg    %ecx
+    neg = 1;
+ 454:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 459:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 45c:	31 f6                	xor    %esi,%esi
+ 45e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 460:	89 c8                	mov    %ecx,%eax
+ 462:	31 d2                	xor    %edx,%edx
+ 464:	89 f7                	mov    %esi,%edi
+ 466:	f7 f3                	div    %ebx
+ 468:	8d 76 01             	lea    0x1(%esi),%esi
+ 46b:	0f b6 92 40 0f 00 00 	movzbl 0xf40(%edx),%edx
+ 472:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 476:	89 ca                	mov    %ecx,%edx
+ 478:	89 c1                	mov    %eax,%ecx
+ 47a:	39 da                	cmp    %ebx,%edx
+ 47c:	73 e2                	jae    460 <printint+0x30>
+  if(neg)
+ 47e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 481:	85 c0                	test   %eax,%eax
+ 483:	74 07                	je     48c <printint+0x5c>
+    buf[i++] = '-';
+ 485:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 48a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 48c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 48f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 492:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 494:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 497:	8b 41 08             	mov    0x8(%ecx),%eax
+ 49a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 49d:	89 ce                	mov    %ecx,%esi
+ 49f:	eb 28                	jmp    4c9 <printint+0x99>
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 4a8:	89 c1                	mov    %eax,%ecx
+ 4aa:	83 c0 01             	add    $0x1,%eax
+ 4ad:	89 46 08             	mov    %eax,0x8(%esi)
+ 4b0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 4b4:	80 fa 0a             	cmp    $0xa,%dl
+ 4b7:	75 07                	jne    4c0 <printint+0x90>
+    f->nl = 1;
+ 4b9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 4c0:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 4c3:	39 fb                	cmp    %edi,%ebx
+ 4c5:	74 39                	je     500 <printint+0xd0>
+ 4c7:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 4c9:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 4cc:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 4d1:	75 d5                	jne    4a8 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4d3:	83 ec 04             	sub    $0x4,%esp
+ 4d6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 4d9:	68 00 02 00 00       	push   $0x200
+ 4de:	ff 75 d0             	push   -0x30(%ebp)
+ 4e1:	ff 36                	push   (%esi)
+ 4e3:	e8 ee fd ff ff       	call   2d6 <write>
+  return r;
+ 4e8:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 4ec:	83 c4 10             	add    $0x10,%esp
+ 4ef:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 4f1:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 4f8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4fd:	eb ae                	jmp    4ad <printint+0x7d>
+ 4ff:	90                   	nop
+}
+ 500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 503:	5b                   	pop    %ebx
+ 504:	5e                   	pop    %esi
+ 505:	5f                   	pop    %edi
+ 506:	5d                   	pop    %ebp
+ 507:	c3                   	ret
+ 508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+  neg = 0;
+ 510:	31 c0                	xor    %eax,%eax
+ 512:	e9 42 ff ff ff       	jmp    459 <printint+0x29>
+ 517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <bputc>:
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	53                   	push   %ebx
+ 524:	89 c3                	mov    %eax,%ebx
+ 526:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 529:	8b 40 08             	mov    0x8(%eax),%eax
+ 52c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 531:	74 1d                	je     550 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 533:	8d 48 01             	lea    0x1(%eax),%ecx
+ 536:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 539:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 53d:	80 fa 0a             	cmp    $0xa,%dl
+ 540:	75 07                	jne    549 <bputc+0x29>
+    f->nl = 1;
+ 542:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 549:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 54c:	c9                   	leave
+ 54d:	c3                   	ret
+ 54e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 550:	83 ec 04             	sub    $0x4,%esp
+ 553:	8d 43 10             	lea    0x10(%ebx),%eax
+ 556:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 559:	68 00 02 00 00       	push   $0x200
+ 55e:	50                   	push   %eax
+ 55f:	ff 33                	push   (%ebx)
+ 561:	e8 70 fd ff ff       	call   2d6 <write>
+  return r;
+ 566:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 569:	83 c4 10             	add    $0x10,%esp
+ 56c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 571:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 578:	31 c0                	xor    %eax,%eax
+ 57a:	eb ba                	jmp    536 <bputc+0x16>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 1c             	sub    $0x1c,%esp
+ 589:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 58c:	0f b6 0a             	movzbl (%edx),%ecx
+ 58f:	84 c9                	test   %cl,%cl
+ 591:	74 47                	je     5da <vfprintf+0x5a>
+ 593:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 596:	89 c7                	mov    %eax,%edi
+ 598:	31 d2                	xor    %edx,%edx
+ 59a:	89 de                	mov    %ebx,%esi
+ 59c:	89 cb                	mov    %ecx,%ebx
+ 59e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 5a0:	0f be cb             	movsbl %bl,%ecx
+ 5a3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5a6:	85 d2                	test   %edx,%edx
+ 5a8:	75 4e                	jne    5f8 <vfprintf+0x78>
+      if(c == '%'){
+ 5aa:	83 f8 25             	cmp    $0x25,%eax
+ 5ad:	74 69                	je     618 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 5af:	8b 47 08             	mov    0x8(%edi),%eax
+ 5b2:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5b7:	0f 84 73 01 00 00    	je     730 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 5bd:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5c0:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 5c3:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 5c7:	80 fb 0a             	cmp    $0xa,%bl
+ 5ca:	74 1c                	je     5e8 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 5cc:	31 d2                	xor    %edx,%edx
+ 5ce:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 5d0:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d3:	83 c6 01             	add    $0x1,%esi
+ 5d6:	84 db                	test   %bl,%bl
+ 5d8:	75 c6                	jne    5a0 <vfprintf+0x20>
+    }
+  }
+}
+ 5da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dd:	5b                   	pop    %ebx
+ 5de:	5e                   	pop    %esi
+ 5df:	5f                   	pop    %edi
+ 5e0:	5d                   	pop    %ebp
+ 5e1:	c3                   	ret
+ 5e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 5e8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 5ef:	eb df                	jmp    5d0 <vfprintf+0x50>
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 5f8:	83 fa 25             	cmp    $0x25,%edx
+ 5fb:	75 d3                	jne    5d0 <vfprintf+0x50>
+      if(c == 'd'){
+ 5fd:	83 f8 25             	cmp    $0x25,%eax
+ 600:	74 37                	je     639 <vfprintf+0xb9>
+ 602:	83 e8 63             	sub    $0x63,%eax
+ 605:	83 f8 15             	cmp    $0x15,%eax
+ 608:	77 16                	ja     620 <vfprintf+0xa0>
+ 60a:	ff 24 85 e8 0e 00 00 	jmp    *0xee8(,%eax,4)
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 618:	ba 25 00 00 00       	mov    $0x25,%edx
+ 61d:	eb b1                	jmp    5d0 <vfprintf+0x50>
+ 61f:	90                   	nop
+  if(f->n == BUFSIZ)
+ 620:	8b 47 08             	mov    0x8(%edi),%eax
+ 623:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 628:	0f 84 4c 01 00 00    	je     77a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 62e:	8d 50 01             	lea    0x1(%eax),%edx
+ 631:	89 57 08             	mov    %edx,0x8(%edi)
+ 634:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 639:	89 ca                	mov    %ecx,%edx
+ 63b:	89 f8                	mov    %edi,%eax
+ 63d:	e8 de fe ff ff       	call   520 <bputc>
+ 642:	eb 88                	jmp    5cc <vfprintf+0x4c>
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 648:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 64b:	83 ec 0c             	sub    $0xc,%esp
+ 64e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 653:	8b 13                	mov    (%ebx),%edx
+ 655:	6a 00                	push   $0x0
+ 657:	89 f8                	mov    %edi,%eax
+        ap++;
+ 659:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 65c:	e8 cf fd ff ff       	call   430 <printint>
+        ap++;
+ 661:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 664:	83 c4 10             	add    $0x10,%esp
+ 667:	e9 60 ff ff ff       	jmp    5cc <vfprintf+0x4c>
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 670:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 673:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 675:	83 c0 04             	add    $0x4,%eax
+ 678:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 67b:	85 d2                	test   %edx,%edx
+ 67d:	0f 84 dd 00 00 00    	je     760 <vfprintf+0x1e0>
+        while(*s != 0){
+ 683:	0f b6 1a             	movzbl (%edx),%ebx
+ 686:	84 db                	test   %bl,%bl
+ 688:	0f 84 3e ff ff ff    	je     5cc <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 68e:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 691:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 694:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 697:	89 fe                	mov    %edi,%esi
+ 699:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 69c:	89 d7                	mov    %edx,%edi
+ 69e:	eb 27                	jmp    6c7 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 6a0:	89 c1                	mov    %eax,%ecx
+ 6a2:	83 c0 01             	add    $0x1,%eax
+ 6a5:	89 46 08             	mov    %eax,0x8(%esi)
+ 6a8:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 6ac:	80 fb 0a             	cmp    $0xa,%bl
+ 6af:	75 07                	jne    6b8 <vfprintf+0x138>
+    f->nl = 1;
+ 6b1:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 6b8:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 6bc:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 6bf:	84 db                	test   %bl,%bl
+ 6c1:	0f 84 a9 00 00 00    	je     770 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 6c7:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6cc:	75 d2                	jne    6a0 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 6ce:	83 ec 04             	sub    $0x4,%esp
+ 6d1:	68 00 02 00 00       	push   $0x200
+ 6d6:	ff 75 e0             	push   -0x20(%ebp)
+ 6d9:	ff 36                	push   (%esi)
+ 6db:	e8 f6 fb ff ff       	call   2d6 <write>
+  return r;
+ 6e0:	83 c4 10             	add    $0x10,%esp
+ 6e3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6e8:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 6ea:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 6f1:	eb b2                	jmp    6a5 <vfprintf+0x125>
+ 6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6f7:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 6f8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 6fb:	83 ec 0c             	sub    $0xc,%esp
+ 6fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 703:	8b 13                	mov    (%ebx),%edx
+ 705:	6a 01                	push   $0x1
+ 707:	e9 4b ff ff ff       	jmp    657 <vfprintf+0xd7>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 710:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 713:	89 f8                	mov    %edi,%eax
+ 715:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 718:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 71b:	e8 00 fe ff ff       	call   520 <bputc>
+        ap++;
+ 720:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 723:	31 d2                	xor    %edx,%edx
+ 725:	e9 a6 fe ff ff       	jmp    5d0 <vfprintf+0x50>
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	8d 47 10             	lea    0x10(%edi),%eax
+ 736:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 739:	68 00 02 00 00       	push   $0x200
+ 73e:	50                   	push   %eax
+ 73f:	ff 37                	push   (%edi)
+ 741:	e8 90 fb ff ff       	call   2d6 <write>
+  return r;
+ 746:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 749:	83 c4 10             	add    $0x10,%esp
+ 74c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 74e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 755:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 75a:	e9 61 fe ff ff       	jmp    5c0 <vfprintf+0x40>
+ 75f:	90                   	nop
+          s = "(null)";
+ 760:	ba df 0e 00 00       	mov    $0xedf,%edx
+ 765:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 76a:	e9 1f ff ff ff       	jmp    68e <vfprintf+0x10e>
+ 76f:	90                   	nop
+ 770:	89 f7                	mov    %esi,%edi
+ 772:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 775:	e9 52 fe ff ff       	jmp    5cc <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 77a:	83 ec 04             	sub    $0x4,%esp
+ 77d:	8d 47 10             	lea    0x10(%edi),%eax
+ 780:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 783:	68 00 02 00 00       	push   $0x200
+ 788:	50                   	push   %eax
+ 789:	ff 37                	push   (%edi)
+ 78b:	e8 46 fb ff ff       	call   2d6 <write>
+  return r;
+ 790:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 793:	83 c4 10             	add    $0x10,%esp
+ 796:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 79b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 7a2:	31 c0                	xor    %eax,%eax
+ 7a4:	e9 88 fe ff ff       	jmp    631 <vfprintf+0xb1>
+ 7a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <fdopen>:
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	56                   	push   %esi
+ 7b4:	53                   	push   %ebx
+ 7b5:	83 ec 20             	sub    $0x20,%esp
+ 7b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 7bb:	83 fe 0f             	cmp    $0xf,%esi
+ 7be:	0f 87 84 00 00 00    	ja     848 <fdopen+0x98>
+  if(streams[fd])
+ 7c4:	8b 1c b5 20 14 00 00 	mov    0x1420(,%esi,4),%ebx
+ 7cb:	85 db                	test   %ebx,%ebx
+ 7cd:	74 11                	je     7e0 <fdopen+0x30>
+}
+ 7cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7d2:	89 d8                	mov    %ebx,%eax
+ 7d4:	5b                   	pop    %ebx
+ 7d5:	5e                   	pop    %esi
+ 7d6:	5d                   	pop    %ebp
+ 7d7:	c3                   	ret
+ 7d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 7e0:	83 ec 0c             	sub    $0xc,%esp
+ 7e3:	68 10 02 00 00       	push   $0x210
+ 7e8:	e8 e3 05 00 00       	call   dd0 <malloc>
+ 7ed:	83 c4 10             	add    $0x10,%esp
+ 7f0:	89 c3                	mov    %eax,%ebx
+ 7f2:	85 c0                	test   %eax,%eax
+ 7f4:	74 52                	je     848 <fdopen+0x98>
+  f->fd = fd;
+ 7f6:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 7f8:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 7fb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 802:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 809:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 810:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 813:	50                   	push   %eax
+ 814:	56                   	push   %esi
+ 815:	e8 f4 fa ff ff       	call   30e <fstat>
+ 81a:	83 c4 10             	add    $0x10,%esp
+ 81d:	85 c0                	test   %eax,%eax
+ 81f:	75 07                	jne    828 <fdopen+0x78>
+ 821:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 826:	74 30                	je     858 <fdopen+0xa8>
+  streams[fd] = f;
+ 828:	89 1c b5 20 14 00 00 	mov    %ebx,0x1420(,%esi,4)
+}
+ 82f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 831:	c7 05 00 14 00 00 d0 	movl   $0x3d0,0x1400
+ 838:	03 00 00 
+}
+ 83b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 83e:	5b                   	pop    %ebx
+ 83f:	5e                   	pop    %esi
+ 840:	5d                   	pop    %ebp
+ 841:	c3                   	ret
+ 842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 848:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 84b:	31 db                	xor    %ebx,%ebx
+}
+ 84d:	89 d8                	mov    %ebx,%eax
+ 84f:	5b                   	pop    %ebx
+ 850:	5e                   	pop    %esi
+ 851:	5d                   	pop    %ebp
+ 852:	c3                   	ret
+ 853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 857:	90                   	nop
+    f->mode = _IOLBF;
+ 858:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 85f:	eb c7                	jmp    828 <fdopen+0x78>
+ 861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+
+00000870 <fopen>:
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	53                   	push   %ebx
+ 874:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 877:	ff 75 0c             	push   0xc(%ebp)
+ 87a:	ff 75 08             	push   0x8(%ebp)
+ 87d:	e8 74 fa ff ff       	call   2f6 <open>
+ 882:	83 c4 10             	add    $0x10,%esp
+ 885:	85 c0                	test   %eax,%eax
+ 887:	78 37                	js     8c0 <fopen+0x50>
+ 889:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 88b:	8b 04 85 20 14 00 00 	mov    0x1420(,%eax,4),%eax
+ 892:	85 c0                	test   %eax,%eax
+ 894:	74 17                	je     8ad <fopen+0x3d>
+    free(streams[fd]);
+ 896:	83 ec 0c             	sub    $0xc,%esp
+ 899:	50                   	push   %eax
+ 89a:	e8 a1 04 00 00       	call   d40 <free>
+    streams[fd] = 0;
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	c7 04 9d 20 14 00 00 	movl   $0x0,0x1420(,%ebx,4)
+ 8a9:	00 00 00 00 
+  return fdopen(fd);
+ 8ad:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 8b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8b3:	c9                   	leave
+  return fdopen(fd);
+ 8b4:	e9 f7 fe ff ff       	jmp    7b0 <fdopen>
+ 8b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 8c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8c3:	31 c0                	xor    %eax,%eax
+ 8c5:	c9                   	leave
+ 8c6:	c3                   	ret
+ 8c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ce:	66 90                	xchg   %ax,%ax
+
+000008d0 <setvbuf>:
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	56                   	push   %esi
+ 8d4:	53                   	push   %ebx
+ 8d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 8d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 8db:	83 fe 02             	cmp    $0x2,%esi
+ 8de:	77 38                	ja     918 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 8e0:	8b 43 08             	mov    0x8(%ebx),%eax
+ 8e3:	85 c0                	test   %eax,%eax
+ 8e5:	7e 12                	jle    8f9 <setvbuf+0x29>
+ 8e7:	83 ec 04             	sub    $0x4,%esp
+ 8ea:	50                   	push   %eax
+ 8eb:	8d 43 10             	lea    0x10(%ebx),%eax
+ 8ee:	50                   	push   %eax
+ 8ef:	ff 33                	push   (%ebx)
+ 8f1:	e8 e0 f9 ff ff       	call   2d6 <write>
+ 8f6:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 8f9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 900:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 902:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 909:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 90c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 90f:	5b                   	pop    %ebx
+ 910:	5e                   	pop    %esi
+ 911:	5d                   	pop    %ebp
+ 912:	c3                   	ret
+ 913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 917:	90                   	nop
+    return -1;
+ 918:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 91d:	eb ed                	jmp    90c <setvbuf+0x3c>
+ 91f:	90                   	nop
+
+00000920 <fflush>:
+{
+ 920:	55                   	push   %ebp
+ 921:	31 c0                	xor    %eax,%eax
+ 923:	89 e5                	mov    %esp,%ebp
+ 925:	53                   	push   %ebx
+ 926:	83 ec 04             	sub    $0x4,%esp
+ 929:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 92c:	8b 53 08             	mov    0x8(%ebx),%edx
+ 92f:	85 d2                	test   %edx,%edx
+ 931:	7e 1d                	jle    950 <fflush+0x30>
+ 933:	83 ec 04             	sub    $0x4,%esp
+ 936:	8d 43 10             	lea    0x10(%ebx),%eax
+ 939:	52                   	push   %edx
+ 93a:	50                   	push   %eax
+ 93b:	ff 33                	push   (%ebx)
+ 93d:	e8 94 f9 ff ff       	call   2d6 <write>
+ 942:	83 c4 10             	add    $0x10,%esp
+ 945:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 948:	0f 95 c0             	setne  %al
+ 94b:	0f b6 c0             	movzbl %al,%eax
+ 94e:	f7 d8                	neg    %eax
+  f->n = 0;
+ 950:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 957:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 95e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 961:	c9                   	leave
+ 962:	c3                   	ret
+ 963:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000970 <fclose>:
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	56                   	push   %esi
+ 974:	31 f6                	xor    %esi,%esi
+ 976:	53                   	push   %ebx
+ 977:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 97a:	8b 43 08             	mov    0x8(%ebx),%eax
+ 97d:	85 c0                	test   %eax,%eax
+ 97f:	7e 1f                	jle    9a0 <fclose+0x30>
+ 981:	83 ec 04             	sub    $0x4,%esp
+ 984:	50                   	push   %eax
+ 985:	8d 43 10             	lea    0x10(%ebx),%eax
+ 988:	50                   	push   %eax
+ 989:	ff 33                	push   (%ebx)
+ 98b:	e8 46 f9 ff ff       	call   2d6 <write>
+ 990:	83 c4 10             	add    $0x10,%esp
+ 993:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 996:	0f 95 c0             	setne  %al
+ 999:	0f b6 c0             	movzbl %al,%eax
+ 99c:	f7 d8                	neg    %eax
+ 99e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ 9a0:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ 9a3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 9aa:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ 9b1:	ff 33                	push   (%ebx)
+ 9b3:	e8 26 f9 ff ff       	call   2de <close>
+ 9b8:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ 9bb:	85 c0                	test   %eax,%eax
+ 9bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9c2:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ 9c5:	8b 03                	mov    (%ebx),%eax
+ 9c7:	83 f8 0f             	cmp    $0xf,%eax
+ 9ca:	77 09                	ja     9d5 <fclose+0x65>
+ 9cc:	39 1c 85 20 14 00 00 	cmp    %ebx,0x1420(,%eax,4)
+ 9d3:	74 0b                	je     9e0 <fclose+0x70>
+}
+ 9d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9d8:	89 f0                	mov    %esi,%eax
+ 9da:	5b                   	pop    %ebx
+ 9db:	5e                   	pop    %esi
+ 9dc:	5d                   	pop    %ebp
+ 9dd:	c3                   	ret
+ 9de:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ 9e0:	c7 04 85 20 14 00 00 	movl   $0x0,0x1420(,%eax,4)
+ 9e7:	00 00 00 00 
+    free(f);
+ 9eb:	83 ec 0c             	sub    $0xc,%esp
+ 9ee:	53                   	push   %ebx
+ 9ef:	e8 4c 03 00 00       	call   d40 <free>
+ 9f4:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 9f7:	eb dc                	jmp    9d5 <fclose+0x65>
+ 9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <fputc>:
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	53                   	push   %ebx
+ a04:	83 ec 04             	sub    $0x4,%esp
+ a07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ a0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ a0d:	8b 43 08             	mov    0x8(%ebx),%eax
+ a10:	3d 00 02 00 00       	cmp    $0x200,%eax
+ a15:	74 59                	je     a70 <fputc+0x70>
+  f->buf[f->n++] = c;
+ a17:	8d 48 01             	lea    0x1(%eax),%ecx
+ a1a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ a1d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ a21:	80 fa 0a             	cmp    $0xa,%dl
+ a24:	75 07                	jne    a2d <fputc+0x2d>
+    f->nl = 1;
+ a26:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a2d:	8b 43 04             	mov    0x4(%ebx),%eax
+ a30:	83 f8 02             	cmp    $0x2,%eax
+ a33:	74 1a                	je     a4f <fputc+0x4f>
+ a35:	83 f8 01             	cmp    $0x1,%eax
+ a38:	74 0e                	je     a48 <fputc+0x48>
+}
+ a3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a3d:	0f b6 c2             	movzbl %dl,%eax
+}
+ a40:	c9                   	leave
+ a41:	c3                   	ret
+ a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a48:	8b 43 0c             	mov    0xc(%ebx),%eax
+ a4b:	85 c0                	test   %eax,%eax
+ a4d:	74 eb                	je     a3a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a4f:	85 c9                	test   %ecx,%ecx
+ a51:	7f 4d                	jg     aa0 <fputc+0xa0>
+  f->n = 0;
+ a53:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a5a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a64:	0f b6 c2             	movzbl %dl,%eax
+}
+ a67:	c9                   	leave
+ a68:	c3                   	ret
+ a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	8d 43 10             	lea    0x10(%ebx),%eax
+ a76:	89 55 08             	mov    %edx,0x8(%ebp)
+ a79:	68 00 02 00 00       	push   $0x200
+ a7e:	50                   	push   %eax
+ a7f:	ff 33                	push   (%ebx)
+ a81:	e8 50 f8 ff ff       	call   2d6 <write>
+  return r;
+ a86:	8b 55 08             	mov    0x8(%ebp),%edx
+ a89:	83 c4 10             	add    $0x10,%esp
+ a8c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ a91:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ a98:	31 c0                	xor    %eax,%eax
+ a9a:	e9 7b ff ff ff       	jmp    a1a <fputc+0x1a>
+ a9f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	8d 43 10             	lea    0x10(%ebx),%eax
+ aa6:	89 55 08             	mov    %edx,0x8(%ebp)
+ aa9:	51                   	push   %ecx
+ aaa:	50                   	push   %eax
+ aab:	ff 33                	push   (%ebx)
+ aad:	e8 24 f8 ff ff       	call   2d6 <write>
+  f->n = 0;
+ ab2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ ab9:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ ac6:	eb 99                	jmp    a61 <fputc+0x61>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+
+00000ad0 <fwrite>:
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 1c             	sub    $0x1c,%esp
+ ad9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ adc:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ adf:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ ae2:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ ae5:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ aeb:	0f 8f af 00 00 00    	jg     ba0 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ af1:	85 ff                	test   %edi,%edi
+ af3:	7e 73                	jle    b68 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ af5:	8d 56 10             	lea    0x10(%esi),%edx
+ af8:	8b 46 08             	mov    0x8(%esi),%eax
+ afb:	31 db                	xor    %ebx,%ebx
+ afd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ b00:	eb 25                	jmp    b27 <fwrite+0x57>
+ b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ b08:	89 c1                	mov    %eax,%ecx
+ b0a:	83 c0 01             	add    $0x1,%eax
+ b0d:	89 46 08             	mov    %eax,0x8(%esi)
+ b10:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ b14:	80 fa 0a             	cmp    $0xa,%dl
+ b17:	75 07                	jne    b20 <fwrite+0x50>
+    f->nl = 1;
+ b19:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ b20:	83 c3 01             	add    $0x1,%ebx
+ b23:	39 df                	cmp    %ebx,%edi
+ b25:	7e 41                	jle    b68 <fwrite+0x98>
+    bputc(f, s[i]);
+ b27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b2a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ b2e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ b33:	75 d3                	jne    b08 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b35:	83 ec 04             	sub    $0x4,%esp
+ b38:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ b3b:	68 00 02 00 00       	push   $0x200
+ b40:	ff 75 e0             	push   -0x20(%ebp)
+ b43:	ff 36                	push   (%esi)
+ b45:	e8 8c f7 ff ff       	call   2d6 <write>
+  return r;
+ b4a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ b4e:	83 c4 10             	add    $0x10,%esp
+ b51:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ b53:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+ b5f:	eb ac                	jmp    b0d <fwrite+0x3d>
+ b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b68:	8b 46 04             	mov    0x4(%esi),%eax
+ b6b:	83 f8 02             	cmp    $0x2,%eax
+ b6e:	74 0c                	je     b7c <fwrite+0xac>
+ b70:	83 f8 01             	cmp    $0x1,%eax
+ b73:	75 1c                	jne    b91 <fwrite+0xc1>
+ b75:	8b 46 0c             	mov    0xc(%esi),%eax
+ b78:	85 c0                	test   %eax,%eax
+ b7a:	74 15                	je     b91 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b7c:	8b 46 08             	mov    0x8(%esi),%eax
+ b7f:	85 c0                	test   %eax,%eax
+ b81:	7f 5d                	jg     be0 <fwrite+0x110>
+  f->n = 0;
+ b83:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ b8a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ b91:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b97:	5b                   	pop    %ebx
+ b98:	5e                   	pop    %esi
+ b99:	5f                   	pop    %edi
+ b9a:	5d                   	pop    %ebp
+ b9b:	c3                   	ret
+ b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ ba0:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ ba4:	0f 84 4b ff ff ff    	je     af5 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ baa:	8b 46 08             	mov    0x8(%esi),%eax
+ bad:	8b 16                	mov    (%esi),%edx
+ baf:	85 c0                	test   %eax,%eax
+ bb1:	7f 45                	jg     bf8 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ bb3:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ bb6:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ bbd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ bc4:	57                   	push   %edi
+ bc5:	ff 75 08             	push   0x8(%ebp)
+ bc8:	ff 36                	push   (%esi)
+ bca:	e8 07 f7 ff ff       	call   2d6 <write>
+    return size > 0 ? i / size : 0;
+ bcf:	83 c4 10             	add    $0x10,%esp
+ bd2:	85 c0                	test   %eax,%eax
+ bd4:	78 4a                	js     c20 <fwrite+0x150>
+ bd6:	85 db                	test   %ebx,%ebx
+ bd8:	7e 46                	jle    c20 <fwrite+0x150>
+ bda:	99                   	cltd
+ bdb:	f7 fb                	idiv   %ebx
+ bdd:	eb b5                	jmp    b94 <fwrite+0xc4>
+ bdf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ be0:	83 ec 04             	sub    $0x4,%esp
+ be3:	50                   	push   %eax
+ be4:	8d 46 10             	lea    0x10(%esi),%eax
+ be7:	50                   	push   %eax
+ be8:	ff 36                	push   (%esi)
+ bea:	e8 e7 f6 ff ff       	call   2d6 <write>
+ bef:	83 c4 10             	add    $0x10,%esp
+ bf2:	eb 8f                	jmp    b83 <fwrite+0xb3>
+ bf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bf8:	83 ec 04             	sub    $0x4,%esp
+ bfb:	50                   	push   %eax
+ bfc:	8d 46 10             	lea    0x10(%esi),%eax
+ bff:	50                   	push   %eax
+ c00:	52                   	push   %edx
+ c01:	e8 d0 f6 ff ff       	call   2d6 <write>
+ c06:	83 c4 10             	add    $0x10,%esp
+ c09:	3b 46 08             	cmp    0x8(%esi),%eax
+ c0c:	74 a5                	je     bb3 <fwrite+0xe3>
+  f->n = 0;
+ c0e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c15:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ c20:	31 c0                	xor    %eax,%eax
+ c22:	e9 6d ff ff ff       	jmp    b94 <fwrite+0xc4>
+ c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2e:	66 90                	xchg   %ax,%ax
+
+00000c30 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c34:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c37:	83 ec 04             	sub    $0x4,%esp
+ c3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c40:	89 d8                	mov    %ebx,%eax
+ c42:	e8 39 f9 ff ff       	call   580 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c47:	8b 43 04             	mov    0x4(%ebx),%eax
+ c4a:	83 f8 02             	cmp    $0x2,%eax
+ c4d:	74 18                	je     c67 <fprintf+0x37>
+ c4f:	83 f8 01             	cmp    $0x1,%eax
+ c52:	74 0c                	je     c60 <fprintf+0x30>
+  settle(f);
+}
+ c54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c57:	c9                   	leave
+ c58:	c3                   	ret
+ c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c60:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c63:	85 c0                	test   %eax,%eax
+ c65:	74 ed                	je     c54 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c67:	8b 43 08             	mov    0x8(%ebx),%eax
+ c6a:	85 c0                	test   %eax,%eax
+ c6c:	7f 1a                	jg     c88 <fprintf+0x58>
+  f->n = 0;
+ c6e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ c75:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ c7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c7f:	c9                   	leave
+ c80:	c3                   	ret
+ c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c88:	83 ec 04             	sub    $0x4,%esp
+ c8b:	50                   	push   %eax
+ c8c:	8d 43 10             	lea    0x10(%ebx),%eax
+ c8f:	50                   	push   %eax
+ c90:	ff 33                	push   (%ebx)
+ c92:	e8 3f f6 ff ff       	call   2d6 <write>
+  f->n = 0;
+ c97:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ c9e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ ca1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ ca8:	eb d2                	jmp    c7c <fprintf+0x4c>
+ caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	53                   	push   %ebx
+ cb4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ cba:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ cbd:	83 f8 0f             	cmp    $0xf,%eax
+ cc0:	77 4e                	ja     d10 <printf+0x60>
+ cc2:	8b 1c 85 20 14 00 00 	mov    0x1420(,%eax,4),%ebx
+ cc9:	85 db                	test   %ebx,%ebx
+ ccb:	74 43                	je     d10 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ ccd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cd0:	89 d8                	mov    %ebx,%eax
+ cd2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ cd5:	e8 a6 f8 ff ff       	call   580 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ cda:	8b 43 08             	mov    0x8(%ebx),%eax
+ cdd:	85 c0                	test   %eax,%eax
+ cdf:	7e 12                	jle    cf3 <printf+0x43>
+ ce1:	83 ec 04             	sub    $0x4,%esp
+ ce4:	50                   	push   %eax
+ ce5:	8d 43 10             	lea    0x10(%ebx),%eax
+ ce8:	50                   	push   %eax
+ ce9:	ff 33                	push   (%ebx)
+ ceb:	e8 e6 f5 ff ff       	call   2d6 <write>
+ cf0:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ cf3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ cfa:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ d01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d04:	c9                   	leave
+ d05:	c3                   	ret
+ d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ d10:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ d16:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ d1c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ d23:	00 00 00 
+    f->n = 0;
+ d26:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ d2d:	00 00 00 
+    f->nl = 0;
+ d30:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ d37:	00 00 00 
+ d3a:	eb 91                	jmp    ccd <printf+0x1d>
+ d3c:	66 90                	xchg   %ax,%ax
+ d3e:	66 90                	xchg   %ax,%ax
+
+00000d40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d41:	a1 60 14 00 00       	mov    0x1460,%eax
+{
+ d46:	89 e5                	mov    %esp,%ebp
+ d48:	57                   	push   %edi
+ d49:	56                   	push   %esi
+ d4a:	53                   	push   %ebx
+ d4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d5c:	39 ca                	cmp    %ecx,%edx
+ d5e:	73 30                	jae    d90 <free+0x50>
+ d60:	39 c1                	cmp    %eax,%ecx
+ d62:	72 04                	jb     d68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d64:	39 c2                	cmp    %eax,%edx
+ d66:	72 f0                	jb     d58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d6e:	39 f8                	cmp    %edi,%eax
+ d70:	74 2e                	je     da0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d75:	8b 42 04             	mov    0x4(%edx),%eax
+ d78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d7b:	39 f1                	cmp    %esi,%ecx
+ d7d:	74 38                	je     db7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d81:	5b                   	pop    %ebx
+  freep = p;
+ d82:	89 15 60 14 00 00    	mov    %edx,0x1460
+}
+ d88:	5e                   	pop    %esi
+ d89:	5f                   	pop    %edi
+ d8a:	5d                   	pop    %ebp
+ d8b:	c3                   	ret
+ d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d90:	39 c1                	cmp    %eax,%ecx
+ d92:	72 d0                	jb     d64 <free+0x24>
+ d94:	eb c2                	jmp    d58 <free+0x18>
+ d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ da0:	03 70 04             	add    0x4(%eax),%esi
+ da3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ da6:	8b 02                	mov    (%edx),%eax
+ da8:	8b 00                	mov    (%eax),%eax
+ daa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dad:	8b 42 04             	mov    0x4(%edx),%eax
+ db0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ db3:	39 f1                	cmp    %esi,%ecx
+ db5:	75 c8                	jne    d7f <free+0x3f>
+    p->s.size += bp->s.size;
+ db7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dba:	89 15 60 14 00 00    	mov    %edx,0x1460
+    p->s.size += bp->s.size;
+ dc0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ dc3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ dc6:	89 0a                	mov    %ecx,(%edx)
+}
+ dc8:	5b                   	pop    %ebx
+ dc9:	5e                   	pop    %esi
+ dca:	5f                   	pop    %edi
+ dcb:	5d                   	pop    %ebp
+ dcc:	c3                   	ret
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dd0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	57                   	push   %edi
+ dd4:	56                   	push   %esi
+ dd5:	53                   	push   %ebx
+ dd6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ ddc:	8b 15 60 14 00 00    	mov    0x1460,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ de2:	8d 78 07             	lea    0x7(%eax),%edi
+ de5:	c1 ef 03             	shr    $0x3,%edi
+ de8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ deb:	85 d2                	test   %edx,%edx
+ ded:	0f 84 8d 00 00 00    	je     e80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ df3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ df5:	8b 48 04             	mov    0x4(%eax),%ecx
+ df8:	39 f9                	cmp    %edi,%ecx
+ dfa:	73 64                	jae    e60 <malloc+0x90>
+  if(nu < 4096)
+ dfc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e01:	39 df                	cmp    %ebx,%edi
+ e03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e0d:	eb 0a                	jmp    e19 <malloc+0x49>
+ e0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e12:	8b 48 04             	mov    0x4(%eax),%ecx
+ e15:	39 f9                	cmp    %edi,%ecx
+ e17:	73 47                	jae    e60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e19:	89 c2                	mov    %eax,%edx
+ e1b:	39 05 60 14 00 00    	cmp    %eax,0x1460
+ e21:	75 ed                	jne    e10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e23:	83 ec 0c             	sub    $0xc,%esp
+ e26:	56                   	push   %esi
+ e27:	e8 12 f5 ff ff       	call   33e <sbrk>
+  if(p == (char*)-1)
+ e2c:	83 c4 10             	add    $0x10,%esp
+ e2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e32:	74 1c                	je     e50 <malloc+0x80>
+  hp->s.size = nu;
+ e34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e37:	83 ec 0c             	sub    $0xc,%esp
+ e3a:	83 c0 08             	add    $0x8,%eax
+ e3d:	50                   	push   %eax
+ e3e:	e8 fd fe ff ff       	call   d40 <free>
+  return freep;
+ e43:	8b 15 60 14 00 00    	mov    0x1460,%edx
+      if((p = morecore(nunits)) == 0)
+ e49:	83 c4 10             	add    $0x10,%esp
+ e4c:	85 d2                	test   %edx,%edx
+ e4e:	75 c0                	jne    e10 <malloc+0x40>
+        return 0;
+  }
+}
+ e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e53:	31 c0                	xor    %eax,%eax
+}
+ e55:	5b                   	pop    %ebx
+ e56:	5e                   	pop    %esi
+ e57:	5f                   	pop    %edi
+ e58:	5d                   	pop    %ebp
+ e59:	c3                   	ret
+ e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e60:	39 cf                	cmp    %ecx,%edi
+ e62:	74 4c                	je     eb0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e64:	29 f9                	sub    %edi,%ecx
+ e66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e6f:	89 15 60 14 00 00    	mov    %edx,0x1460
+}
+ e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e78:	83 c0 08             	add    $0x8,%eax
+}
+ e7b:	5b                   	pop    %ebx
+ e7c:	5e                   	pop    %esi
+ e7d:	5f                   	pop    %edi
+ e7e:	5d                   	pop    %ebp
+ e7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e80:	c7 05 60 14 00 00 64 	movl   $0x1464,0x1460
+ e87:	14 00 00 
+    base.s.size = 0;
+ e8a:	b8 64 14 00 00       	mov    $0x1464,%eax
+    base.s.ptr = freep = prevp = &base;
+ e8f:	c7 05 64 14 00 00 64 	movl   $0x1464,0x1464
+ e96:	14 00 00 
+    base.s.size = 0;
+ e99:	c7 05 68 14 00 00 00 	movl   $0x0,0x1468
+ ea0:	00 00 00 
+    if(p->s.size >= nunits){
+ ea3:	e9 54 ff ff ff       	jmp    dfc <malloc+0x2c>
+ ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ eb0:	8b 08                	mov    (%eax),%ecx
+ eb2:	89 0a                	mov    %ecx,(%edx)
+ eb4:	eb b9                	jmp    e6f <malloc+0x9f>
@@ -1,6 +1,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -14,41 +16,102 @@
 // any reasoning required about whether a commit might
 // write an uncommitted system call's updates to disk.
 //
-// A system call should call begin_op()/end_op() to mark
-// its start and end. Usually begin_op() just increments
-// the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// A system call should call begin_op(n)/end_op() to mark
+// its start and end, where n is the most blocks it can write.
+// Usually begin_op() just reserves the n blocks in the open
+// transaction and returns. But if the reservations would
+// overflow the transaction, it sleeps until the last
+// outstanding end_op() commits; if they would overflow the
+// log, until the checkpoint thread has freed log space.
+//
+// Group commit: when a transaction was shared by several
+// system calls, the last end_op() waits one clock tick
+// before committing, so that other writers can join the
+// same transaction instead of each paying for a commit.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
-//   block A
-//   block B
-//   block C
-//   ...
+//   head block, containing the position and seq of the oldest
+//     transaction that has not been installed yet
+//   circular area of transactions, each made of
+//     descriptor block, containing seq and block #s for A, B, C, ...
+//     block A
+//     block B
+//     block C
+//     ...
+// A transaction commits when its descriptor is written, after
+// its blocks. Committing does not install the blocks to their
+// home locations: they stay pinned in the buffer cache, which
+// serves all reads of them, until the checkpoint thread installs
+// a batch of transactions and advances the tail in the head
+// block. Recovery replays transactions from the tail for as long
+// as the descriptors carry the expected sequence numbers.
 // Log appends are synchronous.
 
-// Contents of the header block, used for both the on-disk header block
-// and to keep track in memory of logged block# before commit.
+#define LOGMAGIC 0x10c0ffee
+#define LOGHASH  256     // buckets in the absorption index, power of 2
+
+// Contents of a descriptor block, also used to keep track
+// in memory of logged block# before commit.
 struct logheader {
+  int magic;
+  int seq;
   int n;
   int block[LOGSIZE];
 };
 
+// Contents of the head block.
+struct loghead {
+  int tail;
+  int seq;
+};
+
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int size;        // blocks in the circular area.
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // blocks reserved by the executing FS sys calls.
   int committing;  // in commit(), please wait.
+  int batching;    // last end_op() is waiting for others to join.
+  int nops;        // FS sys calls that joined the open transaction.
+  int batched;     // open transaction already had a batching window.
   int dev;
-  struct logheader lh;
+  int head;        // position of the next descriptor.
+  int tail;        // position of the oldest uninstalled transaction.
+  int used;        // blocks from tail to head.
+  int seq;         // sequence number of the next commit.
+  // Like head, used and seq, but only counting transactions whose
+  // descriptor is on disk; the checkpoint thread stops there.
+  int chead;
+  int cused;
+  int cseq;
+  int ckpt;        // checkpoint requested.
+  struct logheader lh;  // open transaction
+  // Absorption index over lh.block[]: bucket heads and chains
+  // hold slot+1, 0 ends a chain.
+  ushort hhead[LOGHASH];
+  ushort hnext[LOGSIZE];
+  uint absorbed;   // writes to already-logged blocks, since boot.
+  int home[LOGBLOCKS];  // home block of each log position, -1 for descriptors
 };
 struct log log;
 
+// Installs write the committed copy of a block from the log
+// to its home location through this buffer, bypassing the
+// cache, whose copy may already hold newer updates.
+static struct buf ibuf;
+
 static void recover_from_log(void);
 static void commit();
+static void checkpointer(void);
+
+// Disk block holding log position pos.
+static int
+logblock(int pos)
+{
+  return log.start + 1 + pos % log.size;
+}
 
 void
 initlog(int dev)
@@ -58,56 +121,49 @@ initlog(int dev)
 
   struct superblock sb;
   initlock(&log.lock, "log");
+  initsleeplock(&ibuf.lock, "logibuf");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = sb.nlog - 1;
   log.dev = dev;
+  if (sb.nlog > LOGBLOCKS || log.size < 2*(LOGSIZE+1))
+    panic("initlog: bad log size");
   recover_from_log();
+  kthread("checkpoint", checkpointer);
 }
 
-// Copy committed blocks from log to their home location
+// Write the committed copy of a block, found at log position
+// pos, to its home location.
 static void
-install_trans(void)
+install_block(int pos, uint blockno)
 {
-  int tail;
-
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
-  }
+  struct buf *lbuf = bread(log.dev, logblock(pos)); // read log block
+  acquiresleep(&ibuf.lock);
+  ibuf.dev = log.dev;
+  ibuf.blockno = blockno;
+  ibuf.flags = 0;
+  memmove(ibuf.data, lbuf->data, BSIZE);  // copy block to dst
+  bwrite(&ibuf);  // write dst to disk
+  releasesleep(&ibuf.lock);
+  brelse(lbuf);
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the head block from disk.
 static void
-read_head(void)
+read_head(struct loghead *h)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
-  }
+  *h = *(struct loghead *) (buf->data);
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Write the head block to disk. This is the point at
+// which the transactions before h->tail are forgotten.
 static void
-write_head(void)
+write_head(struct loghead *h)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
-  }
+  *(struct loghead *) (buf->data) = *h;
   bwrite(buf);
   brelse(buf);
 }
@@ -115,25 +171,68 @@ write_head(void)
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct loghead h;
+  struct logheader *d;
+  struct buf *buf;
+  int i, n;
+
+  read_head(&h);
+  if (h.tail < 0 || h.tail >= log.size)
+    h.tail = 0;
+  for (;;) {
+    buf = bread(log.dev, logblock(h.tail));
+    d = (struct logheader *) (buf->data);
+    n = d->n;
+    if (d->magic != LOGMAGIC || d->seq != h.seq || n < 0 || n > LOGSIZE) {
+      brelse(buf);
+      break;
+    }
+    // committed: copy from log to disk
+    for (i = 0; i < n; i++)
+      install_block(h.tail+1+i, d->block[i]);
+    brelse(buf);
+    h.tail = (h.tail + 1 + n) % log.size;
+    h.seq++;
+  }
+  write_head(&h); // clear the log
+
+  log.head = log.tail = log.chead = h.tail;
+  log.seq = log.cseq = h.seq;
+  log.used = log.cused = 0;
+}
+
+// Is the checkpoint thread needed to free log space?
+static int
+lowspace(void)
+{
+  return log.used > log.size/2;
 }
 
-// called at the start of each FS system call.
+// called at the start of each FS system call, which
+// may write at most n distinct blocks.
 void
-begin_op(void)
+begin_op(int n)
 {
+  if(n < 1 || n > LOGSIZE)
+    panic("begin_op: bad reservation");
+
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(log.lh.n + log.reserved + n > LOGSIZE){
+      // this op might exhaust the transaction; wait for commit.
+      sleep(&log, &log.lock);
+    } else if(log.used + 1 + log.lh.n + log.reserved + n > log.size){
+      // this op might exhaust log space; wait for checkpoint.
+      log.ckpt = 1;
+      wakeup(&log.ckpt);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
+      log.nops += 1;
+      myproc()->logres = n;
       release(&log.lock);
       break;
     }
@@ -149,9 +248,23 @@ end_op(void)
 
   acquire(&log.lock);
   log.outstanding -= 1;
+  log.reserved -= myproc()->logres;
+  myproc()->logres = 0;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
+  if(log.outstanding == 0 && log.lh.n > 0 && log.nops > 1 && !log.batched &&
+     log.lh.n + MAXOPBLOCKS <= LOGSIZE){
+    // Others have been writing alongside us: leave the
+    // transaction open for a tick so that they can join it.
+    log.batched = 1;
+    log.batching = 1;
+    wakeup(&log);
+    release(&log.lock);
+    sleepns(TICKNS);
+    acquire(&log.lock);
+    log.batching = 0;
+  }
+  if(log.outstanding == 0 && !log.batching){
     do_commit = 1;
     log.committing = 1;
   } else {
@@ -166,22 +279,19 @@ end_op(void)
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Copy modified blocks from cache to the log after
+// the descriptor at position pos.
 static void
-write_log(void)
+write_log(int pos, struct logheader *lh)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+  for (tail = 0; tail < lh->n; tail++) {
+    struct buf *to = bread(log.dev, logblock(pos+1+tail)); // log block
+    struct buf *from = bread(log.dev, lh->block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
     bwrite(to);  // write the log
     brelse(from);
@@ -189,20 +299,140 @@ write_log(void)
   }
 }
 
+// Write the descriptor at position pos.
+// This is the true point at which the transaction commits.
+static void
+write_desc(int pos, struct logheader *lh)
+{
+  struct buf *buf = bread(log.dev, logblock(pos));
+  memmove(buf->data, lh, sizeof(*lh));
+  bwrite(buf);
+  brelse(buf);
+}
+
 static void
 commit()
 {
+  struct logheader d;
+  int i, pos;
+
+  acquire(&log.lock);
   if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+    // begin_op() reserved room for this transaction.
+    d = log.lh;
+    d.magic = LOGMAGIC;
+    d.seq = log.seq++;
+    pos = log.head;
+    log.home[pos] = -1;
+    for (i = 0; i < d.n; i++)
+      log.home[(pos+1+i) % log.size] = d.block[i];
+    log.head = (pos + 1 + d.n) % log.size;
+    log.used += 1 + d.n;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    memset(log.hhead, 0, sizeof(log.hhead));
+    release(&log.lock);
+
+    write_log(pos, &d);  // Write modified blocks from cache to log
+    write_desc(pos, &d); // Write descriptor to disk -- the real commit
+
+    acquire(&log.lock);
+    log.chead = log.head;
+    log.cseq = log.seq;
+    log.cused += 1 + d.n;
+  }
+  log.nops = 0;
+  log.batched = 0;
+  log.committing = 0;
+  if(lowspace() && !log.ckpt){
+    log.ckpt = 1;
+    wakeup(&log.ckpt);
   }
+  wakeup(&log);
+  release(&log.lock);
+}
+
+// Install the transactions committed so far to their home
+// locations, then free their log space. Only the newest
+// committed copy of each block is written.
+static void
+checkpoint(void)
+{
+  struct loghead h;
+  struct buf *dbuf;
+  int tail, pos, i, j, n;
+  uint b;
+
+  // A commit in progress has already moved log.head past its
+  // transaction, so stop at the last descriptor on disk.
+  acquire(&log.lock);
+  log.ckpt = 0;
+  tail = log.tail;
+  n = log.cused;
+  h.tail = log.chead;
+  h.seq = log.cseq;
+  release(&log.lock);
+  if(n == 0)
+    return;
+
+  // The n positions from tail belong to committed transactions
+  // and are not touched by commits until the tail moves past them.
+  // Count rather than compare with chead: a full log wraps onto tail.
+  for(i = 0; i < n; i++){
+    pos = (tail+i) % log.size;
+    if(log.home[pos] < 0)
+      continue;
+    b = log.home[pos];
+    for(j = i+1; j < n; j++)
+      if(log.home[(tail+j) % log.size] == b)
+        break;
+    if(j == n)   // newest committed copy
+      install_block(pos, b);
+  }
+  write_head(&h);  // Forget the installed transactions
+
+  // Drop the cache pins taken by log_write(), one per
+  // transaction that logged the block.
+  for(i = 0; i < n; i++){
+    pos = (tail+i) % log.size;
+    if(log.home[pos] < 0)
+      continue;
+    dbuf = bread(log.dev, log.home[pos]);
+    bunpin(dbuf);
+    brelse(dbuf);
+  }
+
+  acquire(&log.lock);
+  log.tail = h.tail;
+  log.used -= n;
+  log.cused -= n;
+  wakeup(&log);
+  release(&log.lock);
+}
+
+// The checkpoint thread installs committed transactions
+// once the log starts to fill up.
+static void
+checkpointer(void)
+{
+  for(;;){
+    acquire(&log.lock);
+    while(!log.ckpt)
+      sleep(&log.ckpt, &log.lock);
+    release(&log.lock);
+    checkpoint();
+  }
+}
+
+// Bucket of blockno in the absorption index.
+static uint
+loghash(uint blockno)
+{
+  return (blockno * 2654435761U) >> 24 & (LOGHASH-1);
 }
 
 // Caller has modified b->data and is done with the buffer.
-// Record the block number and pin in the cache with B_DIRTY.
+// Record the block number and pin it in the cache until
+// the checkpoint thread has installed it.
 // commit()/write_log() will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
@@ -213,22 +443,27 @@ commit()
 void
 log_write(struct buf *b)
 {
+  uint h;
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
   acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
-      break;
+  h = loghash(b->blockno);
+  for (i = log.hhead[h]; i > 0; i = log.hnext[i-1]) {
+    if (log.lh.block[i-1] == b->blockno) {   // log absorbtion
+      log.absorbed++;
+      release(&log.lock);
+      return;
+    }
   }
+  if (log.lh.n >= LOGSIZE)
+    panic("too big a transaction");
+  i = log.lh.n++;
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
+  log.hnext[i] = log.hhead[h];
+  log.hhead[h] = i+1;
+  bpin(b); // prevent eviction until installed
   release(&log.lock);
 }
-
@@ -0,0 +1,2319 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 31                	mov    (%ecx),%esi
+      1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      1e:	83 fe 01             	cmp    $0x1,%esi
+      21:	7e 1f                	jle    42 <main+0x42>
+      23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+      2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	39 de                	cmp    %ebx,%esi
+      3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+      3d:	e8 3e 05 00 00       	call   580 <exit>
+    ls(".");
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	68 e0 11 00 00       	push   $0x11e0
+      4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+      4f:	e8 2c 05 00 00       	call   580 <exit>
+      54:	66 90                	xchg   %ax,%ax
+      56:	66 90                	xchg   %ax,%ax
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	56                   	push   %esi
+      64:	53                   	push   %ebx
+      65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+      68:	83 ec 0c             	sub    $0xc,%esp
+      6b:	56                   	push   %esi
+      6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	01 f0                	add    %esi,%eax
+      76:	89 c3                	mov    %eax,%ebx
+      78:	73 0f                	jae    89 <fmtname+0x29>
+      7a:	eb 12                	jmp    8e <fmtname+0x2e>
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+      83:	39 f0                	cmp    %esi,%eax
+      85:	72 0a                	jb     91 <fmtname+0x31>
+      87:	89 c3                	mov    %eax,%ebx
+      89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+      8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	53                   	push   %ebx
+      95:	e8 36 03 00 00       	call   3d0 <strlen>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	83 f8 0d             	cmp    $0xd,%eax
+      a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+      a2:	83 ec 0c             	sub    $0xc,%esp
+      a5:	53                   	push   %ebx
+      a6:	e8 25 03 00 00       	call   3d0 <strlen>
+      ab:	83 c4 0c             	add    $0xc,%esp
+      ae:	50                   	push   %eax
+      af:	53                   	push   %ebx
+      b0:	68 80 17 00 00       	push   $0x1780
+      b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ba:	89 1c 24             	mov    %ebx,(%esp)
+      bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+      c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+      c5:	bb 80 17 00 00       	mov    $0x1780,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ca:	89 c6                	mov    %eax,%esi
+      cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+      d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+      d6:	83 c4 0c             	add    $0xc,%esp
+      d9:	29 f2                	sub    %esi,%edx
+      db:	05 80 17 00 00       	add    $0x1780,%eax
+      e0:	52                   	push   %edx
+      e1:	6a 20                	push   $0x20
+      e3:	50                   	push   %eax
+      e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+      e9:	83 c4 10             	add    $0x10,%esp
+}
+      ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      ef:	89 d8                	mov    %ebx,%eax
+      f1:	5b                   	pop    %ebx
+      f2:	5e                   	pop    %esi
+      f3:	5d                   	pop    %ebp
+      f4:	c3                   	ret
+      f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+     10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+     10f:	6a 00                	push   $0x0
+     111:	57                   	push   %edi
+     112:	e8 bf 04 00 00       	call   5d6 <open>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	85 c0                	test   %eax,%eax
+     11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+     122:	83 ec 08             	sub    $0x8,%esp
+     125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+     12b:	89 c3                	mov    %eax,%ebx
+     12d:	56                   	push   %esi
+     12e:	50                   	push   %eax
+     12f:	e8 ba 04 00 00       	call   5ee <fstat>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+     13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+     146:	66 83 f8 01          	cmp    $0x1,%ax
+     14a:	74 64                	je     1b0 <ls+0xb0>
+     14c:	66 83 f8 02          	cmp    $0x2,%ax
+     150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	53                   	push   %ebx
+     156:	e8 63 04 00 00       	call   5be <close>
+     15b:	83 c4 10             	add    $0x10,%esp
+}
+     15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     161:	5b                   	pop    %ebx
+     162:	5e                   	pop    %esi
+     163:	5f                   	pop    %edi
+     164:	5d                   	pop    %ebp
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+     176:	83 ec 0c             	sub    $0xc,%esp
+     179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+     17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+     185:	57                   	push   %edi
+     186:	e8 d5 fe ff ff       	call   60 <fmtname>
+     18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+     191:	59                   	pop    %ecx
+     192:	5f                   	pop    %edi
+     193:	52                   	push   %edx
+     194:	56                   	push   %esi
+     195:	6a 02                	push   $0x2
+     197:	50                   	push   %eax
+     198:	68 c0 11 00 00       	push   $0x11c0
+     19d:	6a 01                	push   $0x1
+     19f:	e8 ec 0d 00 00       	call   f90 <printf>
+    break;
+     1a4:	83 c4 20             	add    $0x20,%esp
+     1a7:	eb a9                	jmp    152 <ls+0x52>
+     1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	57                   	push   %edi
+     1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	83 c0 10             	add    $0x10,%eax
+     1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	57                   	push   %edi
+     1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+     1d4:	57                   	push   %edi
+     1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+     1da:	89 3c 24             	mov    %edi,(%esp)
+     1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+     1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+     1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+     1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     200:	83 ec 04             	sub    $0x4,%esp
+     203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     209:	6a 10                	push   $0x10
+     20b:	50                   	push   %eax
+     20c:	53                   	push   %ebx
+     20d:	e8 9c 03 00 00       	call   5ae <read>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	83 f8 10             	cmp    $0x10,%eax
+     218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+     21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+     225:	00 
+     226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+     228:	83 ec 04             	sub    $0x4,%esp
+     22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+     231:	6a 0e                	push   $0xe
+     233:	50                   	push   %eax
+     234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+     23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+     245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     249:	58                   	pop    %eax
+     24a:	5a                   	pop    %edx
+     24b:	56                   	push   %esi
+     24c:	57                   	push   %edi
+     24d:	e8 6e 02 00 00       	call   4c0 <stat>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+     263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+     273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     285:	57                   	push   %edi
+     286:	e8 d5 fd ff ff       	call   60 <fmtname>
+     28b:	5a                   	pop    %edx
+     28c:	59                   	pop    %ecx
+     28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     293:	51                   	push   %ecx
+     294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     29a:	52                   	push   %edx
+     29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     2a1:	50                   	push   %eax
+     2a2:	68 c0 11 00 00       	push   $0x11c0
+     2a7:	6a 01                	push   $0x1
+     2a9:	e8 e2 0c 00 00       	call   f90 <printf>
+     2ae:	83 c4 20             	add    $0x20,%esp
+     2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	57                   	push   %edi
+     2c4:	68 98 11 00 00       	push   $0x1198
+     2c9:	6a 02                	push   $0x2
+     2cb:	e8 c0 0c 00 00       	call   f90 <printf>
+    return;
+     2d0:	83 c4 10             	add    $0x10,%esp
+}
+     2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d6:	5b                   	pop    %ebx
+     2d7:	5e                   	pop    %esi
+     2d8:	5f                   	pop    %edi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	68 cd 11 00 00       	push   $0x11cd
+     2e8:	6a 01                	push   $0x1
+     2ea:	e8 a1 0c 00 00       	call   f90 <printf>
+      break;
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	57                   	push   %edi
+     304:	68 ac 11 00 00       	push   $0x11ac
+     309:	6a 02                	push   $0x2
+     30b:	e8 80 0c 00 00       	call   f90 <printf>
+    close(fd);
+     310:	89 1c 24             	mov    %ebx,(%esp)
+     313:	e8 a6 02 00 00       	call   5be <close>
+    return;
+     318:	83 c4 10             	add    $0x10,%esp
+}
+     31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     31e:	5b                   	pop    %ebx
+     31f:	5e                   	pop    %esi
+     320:	5f                   	pop    %edi
+     321:	5d                   	pop    %ebp
+     322:	c3                   	ret
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	57                   	push   %edi
+     32c:	68 ac 11 00 00       	push   $0x11ac
+     331:	6a 01                	push   $0x1
+     333:	e8 58 0c 00 00       	call   f90 <printf>
+        continue;
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     341:	31 c0                	xor    %eax,%eax
+{
+     343:	89 e5                	mov    %esp,%ebp
+     345:	53                   	push   %ebx
+     346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     357:	83 c0 01             	add    $0x1,%eax
+     35a:	84 d2                	test   %dl,%dl
+     35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+     35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     361:	89 c8                	mov    %ecx,%eax
+     363:	c9                   	leave
+     364:	c3                   	ret
+     365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+     377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     37a:	0f b6 02             	movzbl (%edx),%eax
+     37d:	84 c0                	test   %al,%al
+     37f:	75 17                	jne    398 <strcmp+0x28>
+     381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+     383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     387:	90                   	nop
+     388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     38c:	83 c2 01             	add    $0x1,%edx
+     38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     392:	84 c0                	test   %al,%al
+     394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+     396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     398:	0f b6 19             	movzbl (%ecx),%ebx
+     39b:	38 c3                	cmp    %al,%bl
+     39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     39f:	29 d8                	sub    %ebx,%eax
+}
+     3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3a4:	c9                   	leave
+     3a5:	c3                   	ret
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     3b4:	31 c0                	xor    %eax,%eax
+     3b6:	29 d8                	sub    %ebx,%eax
+}
+     3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3bb:	c9                   	leave
+     3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     3bd:	0f b6 19             	movzbl (%ecx),%ebx
+     3c0:	31 c0                	xor    %eax,%eax
+     3c2:	eb db                	jmp    39f <strcmp+0x2f>
+     3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     3d9:	74 15                	je     3f0 <strlen+0x20>
+     3db:	31 c0                	xor    %eax,%eax
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+     3e0:	83 c0 01             	add    $0x1,%eax
+     3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     3e7:	89 c1                	mov    %eax,%ecx
+     3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+     3eb:	89 c8                	mov    %ecx,%eax
+     3ed:	5d                   	pop    %ebp
+     3ee:	c3                   	ret
+     3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     3f0:	31 c9                	xor    %ecx,%ecx
+}
+     3f2:	5d                   	pop    %ebp
+     3f3:	89 c8                	mov    %ecx,%eax
+     3f5:	c3                   	ret
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40d:	89 d7                	mov    %edx,%edi
+     40f:	fc                   	cld
+     410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     415:	89 d0                	mov    %edx,%eax
+     417:	c9                   	leave
+     418:	c3                   	ret
+     419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	8b 45 08             	mov    0x8(%ebp),%eax
+     426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     42a:	0f b6 10             	movzbl (%eax),%edx
+     42d:	84 d2                	test   %dl,%dl
+     42f:	75 12                	jne    443 <strchr+0x23>
+     431:	eb 1d                	jmp    450 <strchr+0x30>
+     433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     437:	90                   	nop
+     438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     43c:	83 c0 01             	add    $0x1,%eax
+     43f:	84 d2                	test   %dl,%dl
+     441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+     443:	38 d1                	cmp    %dl,%cl
+     445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     447:	5d                   	pop    %ebp
+     448:	c3                   	ret
+     449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     450:	31 c0                	xor    %eax,%eax
+}
+     452:	5d                   	pop    %ebp
+     453:	c3                   	ret
+     454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     469:	31 db                	xor    %ebx,%ebx
+{
+     46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+     470:	83 ec 04             	sub    $0x4,%esp
+     473:	6a 01                	push   $0x1
+     475:	56                   	push   %esi
+     476:	6a 00                	push   $0x0
+     478:	e8 31 01 00 00       	call   5ae <read>
+    if(cc < 1)
+     47d:	83 c4 10             	add    $0x10,%esp
+     480:	85 c0                	test   %eax,%eax
+     482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     488:	8b 55 08             	mov    0x8(%ebp),%edx
+     48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     48f:	3c 0a                	cmp    $0xa,%al
+     491:	74 10                	je     4a3 <gets+0x43>
+     493:	3c 0d                	cmp    $0xd,%al
+     495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     497:	89 df                	mov    %ebx,%edi
+     499:	83 c3 01             	add    $0x1,%ebx
+     49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     49f:	7c cf                	jl     470 <gets+0x10>
+     4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ad:	5b                   	pop    %ebx
+     4ae:	5e                   	pop    %esi
+     4af:	5f                   	pop    %edi
+     4b0:	5d                   	pop    %ebp
+     4b1:	c3                   	ret
+     4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	56                   	push   %esi
+     4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     4c5:	83 ec 08             	sub    $0x8,%esp
+     4c8:	6a 00                	push   $0x0
+     4ca:	ff 75 08             	push   0x8(%ebp)
+     4cd:	e8 04 01 00 00       	call   5d6 <open>
+  if(fd < 0)
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	85 c0                	test   %eax,%eax
+     4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     4d9:	83 ec 08             	sub    $0x8,%esp
+     4dc:	ff 75 0c             	push   0xc(%ebp)
+     4df:	89 c3                	mov    %eax,%ebx
+     4e1:	50                   	push   %eax
+     4e2:	e8 07 01 00 00       	call   5ee <fstat>
+  close(fd);
+     4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+     4ec:	e8 cd 00 00 00       	call   5be <close>
+  return r;
+     4f1:	83 c4 10             	add    $0x10,%esp
+}
+     4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4f7:	89 f0                	mov    %esi,%eax
+     4f9:	5b                   	pop    %ebx
+     4fa:	5e                   	pop    %esi
+     4fb:	5d                   	pop    %ebp
+     4fc:	c3                   	ret
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     505:	eb ed                	jmp    4f4 <stat+0x34>
+     507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     517:	0f be 02             	movsbl (%edx),%eax
+     51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     525:	77 1e                	ja     545 <atoi+0x35>
+     527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     530:	83 c2 01             	add    $0x1,%edx
+     533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     53a:	0f be 02             	movsbl (%edx),%eax
+     53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     540:	80 fb 09             	cmp    $0x9,%bl
+     543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+     545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     548:	89 c8                	mov    %ecx,%eax
+     54a:	c9                   	leave
+     54b:	c3                   	ret
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	8b 45 10             	mov    0x10(%ebp),%eax
+     558:	8b 55 08             	mov    0x8(%ebp),%edx
+     55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     55e:	85 c0                	test   %eax,%eax
+     560:	7e 13                	jle    575 <memmove+0x25>
+     562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     564:	89 d7                	mov    %edx,%edi
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     571:	39 f8                	cmp    %edi,%eax
+     573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+     575:	5e                   	pop    %esi
+     576:	89 d0                	mov    %edx,%eax
+     578:	5f                   	pop    %edi
+     579:	5d                   	pop    %ebp
+     57a:	c3                   	ret
+     57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+
+00000580 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+     586:	a1 90 17 00 00       	mov    0x1790,%eax
+     58b:	85 c0                	test   %eax,%eax
+     58d:	74 02                	je     591 <exit+0x11>
+    exithook();
+     58f:	ff d0                	call   *%eax
+  _exit();
+     591:	e8 10 01 00 00       	call   6a6 <_exit>
+
+00000596 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     596:	b8 01 00 00 00       	mov    $0x1,%eax
+     59b:	cd 40                	int    $0x40
+     59d:	c3                   	ret
+
+0000059e <wait>:
+SYSCALL(wait)
+     59e:	b8 03 00 00 00       	mov    $0x3,%eax
+     5a3:	cd 40                	int    $0x40
+     5a5:	c3                   	ret
+
+000005a6 <pipe>:
+SYSCALL(pipe)
+     5a6:	b8 04 00 00 00       	mov    $0x4,%eax
+     5ab:	cd 40                	int    $0x40
+     5ad:	c3                   	ret
+
+000005ae <read>:
+SYSCALL(read)
+     5ae:	b8 05 00 00 00       	mov    $0x5,%eax
+     5b3:	cd 40                	int    $0x40
+     5b5:	c3                   	ret
+
+000005b6 <write>:
+SYSCALL(write)
+     5b6:	b8 10 00 00 00       	mov    $0x10,%eax
+     5bb:	cd 40                	int    $0x40
+     5bd:	c3                   	ret
+
+000005be <close>:
+SYSCALL(close)
+     5be:	b8 15 00 00 00       	mov    $0x15,%eax
+     5c3:	cd 40                	int    $0x40
+     5c5:	c3                   	ret
+
+000005c6 <kill>:
+SYSCALL(kill)
+     5c6:	b8 06 00 00 00       	mov    $0x6,%eax
+     5cb:	cd 40                	int    $0x40
+     5cd:	c3                   	ret
+
+000005ce <exec>:
+SYSCALL(exec)
+     5ce:	b8 07 00 00 00       	mov    $0x7,%eax
+     5d3:	cd 40                	int    $0x40
+     5d5:	c3                   	ret
+
+000005d6 <open>:
+SYSCALL(open)
+     5d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+     5db:	cd 40                	int    $0x40
+     5dd:	c3                   	ret
+
+000005de <mknod>:
+SYSCALL(mknod)
+     5de:	b8 11 00 00 00       	mov    $0x11,%eax
+     5e3:	cd 40                	int    $0x40
+     5e5:	c3                   	ret
+
+000005e6 <unlink>:
+SYSCALL(unlink)
+     5e6:	b8 12 00 00 00       	mov    $0x12,%eax
+     5eb:	cd 40                	int    $0x40
+     5ed:	c3                   	ret
+
+000005ee <fstat>:
+SYSCALL(fstat)
+     5ee:	b8 08 00 00 00       	mov    $0x8,%eax
+     5f3:	cd 40                	int    $0x40
+     5f5:	c3                   	ret
+
+000005f6 <link>:
+SYSCALL(link)
+     5f6:	b8 13 00 00 00       	mov    $0x13,%eax
+     5fb:	cd 40                	int    $0x40
+     5fd:	c3                   	ret
+
+000005fe <mkdir>:
+SYSCALL(mkdir)
+     5fe:	b8 14 00 00 00       	mov    $0x14,%eax
+     603:	cd 40                	int    $0x40
+     605:	c3                   	ret
+
+00000606 <chdir>:
+SYSCALL(chdir)
+     606:	b8 09 00 00 00       	mov    $0x9,%eax
+     60b:	cd 40                	int    $0x40
+     60d:	c3                   	ret
+
+0000060e <dup>:
+SYSCALL(dup)
+     60e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     613:	cd 40                	int    $0x40
+     615:	c3                   	ret
+
+00000616 <getpid>:
+SYSCALL(getpid)
+     616:	b8 0b 00 00 00       	mov    $0xb,%eax
+     61b:	cd 40                	int    $0x40
+     61d:	c3                   	ret
+
+0000061e <sbrk>:
+SYSCALL(sbrk)
+     61e:	b8 0c 00 00 00       	mov    $0xc,%eax
+     623:	cd 40                	int    $0x40
+     625:	c3                   	ret
+
+00000626 <sleep>:
+SYSCALL(sleep)
+     626:	b8 0d 00 00 00       	mov    $0xd,%eax
+     62b:	cd 40                	int    $0x40
+     62d:	c3                   	ret
+
+0000062e <uptime>:
+SYSCALL(uptime)
+     62e:	b8 0e 00 00 00       	mov    $0xe,%eax
+     633:	cd 40                	int    $0x40
+     635:	c3                   	ret
+
+00000636 <sigprocmask>:
+SYSCALL(sigprocmask)
+     636:	b8 16 00 00 00       	mov    $0x16,%eax
+     63b:	cd 40                	int    $0x40
+     63d:	c3                   	ret
+
+0000063e <sigaction>:
+SYSCALL(sigaction)
+     63e:	b8 17 00 00 00       	mov    $0x17,%eax
+     643:	cd 40                	int    $0x40
+     645:	c3                   	ret
+
+00000646 <sigret>:
+SYSCALL(sigret)
+     646:	b8 18 00 00 00       	mov    $0x18,%eax
+     64b:	cd 40                	int    $0x40
+     64d:	c3                   	ret
+
+0000064e <readv>:
+SYSCALL(readv)
+     64e:	b8 19 00 00 00       	mov    $0x19,%eax
+     653:	cd 40                	int    $0x40
+     655:	c3                   	ret
+
+00000656 <writev>:
+SYSCALL(writev)
+     656:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     65b:	cd 40                	int    $0x40
+     65d:	c3                   	ret
+
+0000065e <nanosleep>:
+SYSCALL(nanosleep)
+     65e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     663:	cd 40                	int    $0x40
+     665:	c3                   	ret
+
+00000666 <setpriority>:
+SYSCALL(setpriority)
+     666:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     66b:	cd 40                	int    $0x40
+     66d:	c3                   	ret
+
+0000066e <sched_setattr>:
+SYSCALL(sched_setattr)
+     66e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     673:	cd 40                	int    $0x40
+     675:	c3                   	ret
+
+00000676 <sched_yield>:
+SYSCALL(sched_yield)
+     676:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     67b:	cd 40                	int    $0x40
+     67d:	c3                   	ret
+
+0000067e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     67e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     683:	cd 40                	int    $0x40
+     685:	c3                   	ret
+
+00000686 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     686:	b8 20 00 00 00       	mov    $0x20,%eax
+     68b:	cd 40                	int    $0x40
+     68d:	c3                   	ret
+
+0000068e <getrusage>:
+SYSCALL(getrusage)
+     68e:	b8 21 00 00 00       	mov    $0x21,%eax
+     693:	cd 40                	int    $0x40
+     695:	c3                   	ret
+
+00000696 <syslat>:
+SYSCALL(syslat)
+     696:	b8 22 00 00 00       	mov    $0x22,%eax
+     69b:	cd 40                	int    $0x40
+     69d:	c3                   	ret
+
+0000069e <sched_getattr>:
+SYSCALL(sched_getattr)
+     69e:	b8 23 00 00 00       	mov    $0x23,%eax
+     6a3:	cd 40                	int    $0x40
+     6a5:	c3                   	ret
+
+000006a6 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+     6a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+     6ab:	cd 40                	int    $0x40
+  ret
+     6ad:	c3                   	ret
+     6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	56                   	push   %esi
+     6b4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+     6b5:	31 db                	xor    %ebx,%ebx
+     6b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6be:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+     6c0:	8b 34 9d a0 17 00 00 	mov    0x17a0(,%ebx,4),%esi
+     6c7:	85 f6                	test   %esi,%esi
+     6c9:	74 27                	je     6f2 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     6cb:	8b 46 08             	mov    0x8(%esi),%eax
+     6ce:	85 c0                	test   %eax,%eax
+     6d0:	7e 12                	jle    6e4 <flushall+0x34>
+     6d2:	83 ec 04             	sub    $0x4,%esp
+     6d5:	50                   	push   %eax
+     6d6:	8d 46 10             	lea    0x10(%esi),%eax
+     6d9:	50                   	push   %eax
+     6da:	ff 36                	push   (%esi)
+     6dc:	e8 d5 fe ff ff       	call   5b6 <write>
+     6e1:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+     6e4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     6eb:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+     6f2:	83 c3 01             	add    $0x1,%ebx
+     6f5:	83 fb 10             	cmp    $0x10,%ebx
+     6f8:	75 c6                	jne    6c0 <flushall+0x10>
+}
+     6fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6fd:	5b                   	pop    %ebx
+     6fe:	5e                   	pop    %esi
+     6ff:	5d                   	pop    %ebp
+     700:	c3                   	ret
+     701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+
+00000710 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	56                   	push   %esi
+     715:	53                   	push   %ebx
+     716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     718:	89 d1                	mov    %edx,%ecx
+{
+     71a:	83 ec 2c             	sub    $0x2c,%esp
+     71d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     720:	85 d2                	test   %edx,%edx
+     722:	0f 89 c8 00 00 00    	jns    7f0 <printint+0xe0>
+     728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     72c:	0f 84 be 00 00 00    	je     7f0 <printint+0xe0>
+    x = -xx;
+     732:	f7 d9                	neg    %ecx
+    neg = 1;
+     734:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     739:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     73c:	31 f6                	xor    %esi,%esi
+     73e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+     740:	89 c8                	mov    %ecx,%eax
+     742:	31 d2                	xor    %edx,%edx
+     744:	89 f7                	mov    %esi,%edi
+     746:	f7 f3                	div    %ebx
+     748:	8d 76 01             	lea    0x1(%esi),%esi
+     74b:	0f b6 92 44 12 00 00 	movzbl 0x1244(%edx),%edx
+     752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     756:	89 ca                	mov    %ecx,%edx
+     758:	89 c1                	mov    %eax,%ecx
+     75a:	39 da                	cmp    %ebx,%edx
+     75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+     75e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     761:	85 c0                	test   %eax,%eax
+     763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+     765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     76a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+     76c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     76f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     772:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     774:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+     777:	8b 41 08             	mov    0x8(%ecx),%eax
+     77a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     77d:	89 ce                	mov    %ecx,%esi
+     77f:	eb 28                	jmp    7a9 <printint+0x99>
+     781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+     788:	89 c1                	mov    %eax,%ecx
+     78a:	83 c0 01             	add    $0x1,%eax
+     78d:	89 46 08             	mov    %eax,0x8(%esi)
+     790:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     794:	80 fa 0a             	cmp    $0xa,%dl
+     797:	75 07                	jne    7a0 <printint+0x90>
+    f->nl = 1;
+     799:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+     7a0:	8d 57 ff             	lea    -0x1(%edi),%edx
+     7a3:	39 fb                	cmp    %edi,%ebx
+     7a5:	74 39                	je     7e0 <printint+0xd0>
+     7a7:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+     7a9:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+     7ac:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7b1:	75 d5                	jne    788 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     7b3:	83 ec 04             	sub    $0x4,%esp
+     7b6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+     7b9:	68 00 02 00 00       	push   $0x200
+     7be:	ff 75 d0             	push   -0x30(%ebp)
+     7c1:	ff 36                	push   (%esi)
+     7c3:	e8 ee fd ff ff       	call   5b6 <write>
+  return r;
+     7c8:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+     7cc:	83 c4 10             	add    $0x10,%esp
+     7cf:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     7d1:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     7d8:	b8 01 00 00 00       	mov    $0x1,%eax
+     7dd:	eb ae                	jmp    78d <printint+0x7d>
+     7df:	90                   	nop
+}
+     7e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7e3:	5b                   	pop    %ebx
+     7e4:	5e                   	pop    %esi
+     7e5:	5f                   	pop    %edi
+     7e6:	5d                   	pop    %ebp
+     7e7:	c3                   	ret
+     7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+  neg = 0;
+     7f0:	31 c0                	xor    %eax,%eax
+     7f2:	e9 42 ff ff ff       	jmp    739 <printint+0x29>
+     7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fe:	66 90                	xchg   %ax,%ax
+
+00000800 <bputc>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	53                   	push   %ebx
+     804:	89 c3                	mov    %eax,%ebx
+     806:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+     809:	8b 40 08             	mov    0x8(%eax),%eax
+     80c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     811:	74 1d                	je     830 <bputc+0x30>
+  f->buf[f->n++] = c;
+     813:	8d 48 01             	lea    0x1(%eax),%ecx
+     816:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     819:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     81d:	80 fa 0a             	cmp    $0xa,%dl
+     820:	75 07                	jne    829 <bputc+0x29>
+    f->nl = 1;
+     822:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+     829:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     82c:	c9                   	leave
+     82d:	c3                   	ret
+     82e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     830:	83 ec 04             	sub    $0x4,%esp
+     833:	8d 43 10             	lea    0x10(%ebx),%eax
+     836:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     839:	68 00 02 00 00       	push   $0x200
+     83e:	50                   	push   %eax
+     83f:	ff 33                	push   (%ebx)
+     841:	e8 70 fd ff ff       	call   5b6 <write>
+  return r;
+     846:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     849:	83 c4 10             	add    $0x10,%esp
+     84c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     851:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     858:	31 c0                	xor    %eax,%eax
+     85a:	eb ba                	jmp    816 <bputc+0x16>
+     85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	56                   	push   %esi
+     865:	53                   	push   %ebx
+     866:	83 ec 1c             	sub    $0x1c,%esp
+     869:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     86c:	0f b6 0a             	movzbl (%edx),%ecx
+     86f:	84 c9                	test   %cl,%cl
+     871:	74 47                	je     8ba <vfprintf+0x5a>
+     873:	8d 5a 01             	lea    0x1(%edx),%ebx
+     876:	89 c7                	mov    %eax,%edi
+     878:	31 d2                	xor    %edx,%edx
+     87a:	89 de                	mov    %ebx,%esi
+     87c:	89 cb                	mov    %ecx,%ebx
+     87e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+     880:	0f be cb             	movsbl %bl,%ecx
+     883:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     886:	85 d2                	test   %edx,%edx
+     888:	75 4e                	jne    8d8 <vfprintf+0x78>
+      if(c == '%'){
+     88a:	83 f8 25             	cmp    $0x25,%eax
+     88d:	74 69                	je     8f8 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+     88f:	8b 47 08             	mov    0x8(%edi),%eax
+     892:	3d 00 02 00 00       	cmp    $0x200,%eax
+     897:	0f 84 73 01 00 00    	je     a10 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+     89d:	8d 48 01             	lea    0x1(%eax),%ecx
+     8a0:	89 4f 08             	mov    %ecx,0x8(%edi)
+     8a3:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+     8a7:	80 fb 0a             	cmp    $0xa,%bl
+     8aa:	74 1c                	je     8c8 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+     8ac:	31 d2                	xor    %edx,%edx
+     8ae:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+     8b0:	0f b6 1e             	movzbl (%esi),%ebx
+     8b3:	83 c6 01             	add    $0x1,%esi
+     8b6:	84 db                	test   %bl,%bl
+     8b8:	75 c6                	jne    880 <vfprintf+0x20>
+    }
+  }
+}
+     8ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8bd:	5b                   	pop    %ebx
+     8be:	5e                   	pop    %esi
+     8bf:	5f                   	pop    %edi
+     8c0:	5d                   	pop    %ebp
+     8c1:	c3                   	ret
+     8c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+     8c8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+     8cf:	eb df                	jmp    8b0 <vfprintf+0x50>
+     8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+     8d8:	83 fa 25             	cmp    $0x25,%edx
+     8db:	75 d3                	jne    8b0 <vfprintf+0x50>
+      if(c == 'd'){
+     8dd:	83 f8 25             	cmp    $0x25,%eax
+     8e0:	74 37                	je     919 <vfprintf+0xb9>
+     8e2:	83 e8 63             	sub    $0x63,%eax
+     8e5:	83 f8 15             	cmp    $0x15,%eax
+     8e8:	77 16                	ja     900 <vfprintf+0xa0>
+     8ea:	ff 24 85 ec 11 00 00 	jmp    *0x11ec(,%eax,4)
+     8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+     8f8:	ba 25 00 00 00       	mov    $0x25,%edx
+     8fd:	eb b1                	jmp    8b0 <vfprintf+0x50>
+     8ff:	90                   	nop
+  if(f->n == BUFSIZ)
+     900:	8b 47 08             	mov    0x8(%edi),%eax
+     903:	3d 00 02 00 00       	cmp    $0x200,%eax
+     908:	0f 84 4c 01 00 00    	je     a5a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+     90e:	8d 50 01             	lea    0x1(%eax),%edx
+     911:	89 57 08             	mov    %edx,0x8(%edi)
+     914:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+     919:	89 ca                	mov    %ecx,%edx
+     91b:	89 f8                	mov    %edi,%eax
+     91d:	e8 de fe ff ff       	call   800 <bputc>
+     922:	eb 88                	jmp    8ac <vfprintf+0x4c>
+     924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     928:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     92b:	83 ec 0c             	sub    $0xc,%esp
+     92e:	b9 10 00 00 00       	mov    $0x10,%ecx
+     933:	8b 13                	mov    (%ebx),%edx
+     935:	6a 00                	push   $0x0
+     937:	89 f8                	mov    %edi,%eax
+        ap++;
+     939:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+     93c:	e8 cf fd ff ff       	call   710 <printint>
+        ap++;
+     941:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+     944:	83 c4 10             	add    $0x10,%esp
+     947:	e9 60 ff ff ff       	jmp    8ac <vfprintf+0x4c>
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+     950:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     953:	8b 10                	mov    (%eax),%edx
+        ap++;
+     955:	83 c0 04             	add    $0x4,%eax
+     958:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     95b:	85 d2                	test   %edx,%edx
+     95d:	0f 84 dd 00 00 00    	je     a40 <vfprintf+0x1e0>
+        while(*s != 0){
+     963:	0f b6 1a             	movzbl (%edx),%ebx
+     966:	84 db                	test   %bl,%bl
+     968:	0f 84 3e ff ff ff    	je     8ac <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     96e:	8d 4f 10             	lea    0x10(%edi),%ecx
+     971:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+     974:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     977:	89 fe                	mov    %edi,%esi
+     979:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     97c:	89 d7                	mov    %edx,%edi
+     97e:	eb 27                	jmp    9a7 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+     980:	89 c1                	mov    %eax,%ecx
+     982:	83 c0 01             	add    $0x1,%eax
+     985:	89 46 08             	mov    %eax,0x8(%esi)
+     988:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     98c:	80 fb 0a             	cmp    $0xa,%bl
+     98f:	75 07                	jne    998 <vfprintf+0x138>
+    f->nl = 1;
+     991:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+     998:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+     99c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+     99f:	84 db                	test   %bl,%bl
+     9a1:	0f 84 a9 00 00 00    	je     a50 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+     9a7:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9ac:	75 d2                	jne    980 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     9ae:	83 ec 04             	sub    $0x4,%esp
+     9b1:	68 00 02 00 00       	push   $0x200
+     9b6:	ff 75 e0             	push   -0x20(%ebp)
+     9b9:	ff 36                	push   (%esi)
+     9bb:	e8 f6 fb ff ff       	call   5b6 <write>
+  return r;
+     9c0:	83 c4 10             	add    $0x10,%esp
+     9c3:	b8 01 00 00 00       	mov    $0x1,%eax
+     9c8:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     9ca:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     9d1:	eb b2                	jmp    985 <vfprintf+0x125>
+     9d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9d7:	90                   	nop
+        printint(f, *ap, 10, 1);
+     9d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     9db:	83 ec 0c             	sub    $0xc,%esp
+     9de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     9e3:	8b 13                	mov    (%ebx),%edx
+     9e5:	6a 01                	push   $0x1
+     9e7:	e9 4b ff ff ff       	jmp    937 <vfprintf+0xd7>
+     9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+     9f0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     9f3:	89 f8                	mov    %edi,%eax
+     9f5:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+     9f8:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+     9fb:	e8 00 fe ff ff       	call   800 <bputc>
+        ap++;
+     a00:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+     a03:	31 d2                	xor    %edx,%edx
+     a05:	e9 a6 fe ff ff       	jmp    8b0 <vfprintf+0x50>
+     a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     a10:	83 ec 04             	sub    $0x4,%esp
+     a13:	8d 47 10             	lea    0x10(%edi),%eax
+     a16:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     a19:	68 00 02 00 00       	push   $0x200
+     a1e:	50                   	push   %eax
+     a1f:	ff 37                	push   (%edi)
+     a21:	e8 90 fb ff ff       	call   5b6 <write>
+  return r;
+     a26:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     a29:	83 c4 10             	add    $0x10,%esp
+     a2c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+     a2e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+     a35:	b9 01 00 00 00       	mov    $0x1,%ecx
+     a3a:	e9 61 fe ff ff       	jmp    8a0 <vfprintf+0x40>
+     a3f:	90                   	nop
+          s = "(null)";
+     a40:	ba e2 11 00 00       	mov    $0x11e2,%edx
+     a45:	bb 28 00 00 00       	mov    $0x28,%ebx
+     a4a:	e9 1f ff ff ff       	jmp    96e <vfprintf+0x10e>
+     a4f:	90                   	nop
+     a50:	89 f7                	mov    %esi,%edi
+     a52:	8b 75 dc             	mov    -0x24(%ebp),%esi
+     a55:	e9 52 fe ff ff       	jmp    8ac <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     a5a:	83 ec 04             	sub    $0x4,%esp
+     a5d:	8d 47 10             	lea    0x10(%edi),%eax
+     a60:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     a63:	68 00 02 00 00       	push   $0x200
+     a68:	50                   	push   %eax
+     a69:	ff 37                	push   (%edi)
+     a6b:	e8 46 fb ff ff       	call   5b6 <write>
+  return r;
+     a70:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     a73:	83 c4 10             	add    $0x10,%esp
+     a76:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+     a7b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+     a82:	31 c0                	xor    %eax,%eax
+     a84:	e9 88 fe ff ff       	jmp    911 <vfprintf+0xb1>
+     a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a90 <fdopen>:
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	56                   	push   %esi
+     a94:	53                   	push   %ebx
+     a95:	83 ec 20             	sub    $0x20,%esp
+     a98:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+     a9b:	83 fe 0f             	cmp    $0xf,%esi
+     a9e:	0f 87 84 00 00 00    	ja     b28 <fdopen+0x98>
+  if(streams[fd])
+     aa4:	8b 1c b5 a0 17 00 00 	mov    0x17a0(,%esi,4),%ebx
+     aab:	85 db                	test   %ebx,%ebx
+     aad:	74 11                	je     ac0 <fdopen+0x30>
+}
+     aaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ab2:	89 d8                	mov    %ebx,%eax
+     ab4:	5b                   	pop    %ebx
+     ab5:	5e                   	pop    %esi
+     ab6:	5d                   	pop    %ebp
+     ab7:	c3                   	ret
+     ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abf:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+     ac0:	83 ec 0c             	sub    $0xc,%esp
+     ac3:	68 10 02 00 00       	push   $0x210
+     ac8:	e8 e3 05 00 00       	call   10b0 <malloc>
+     acd:	83 c4 10             	add    $0x10,%esp
+     ad0:	89 c3                	mov    %eax,%ebx
+     ad2:	85 c0                	test   %eax,%eax
+     ad4:	74 52                	je     b28 <fdopen+0x98>
+  f->fd = fd;
+     ad6:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+     ad8:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+     adb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+     ae2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+     ae9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+     af0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     af3:	50                   	push   %eax
+     af4:	56                   	push   %esi
+     af5:	e8 f4 fa ff ff       	call   5ee <fstat>
+     afa:	83 c4 10             	add    $0x10,%esp
+     afd:	85 c0                	test   %eax,%eax
+     aff:	75 07                	jne    b08 <fdopen+0x78>
+     b01:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     b06:	74 30                	je     b38 <fdopen+0xa8>
+  streams[fd] = f;
+     b08:	89 1c b5 a0 17 00 00 	mov    %ebx,0x17a0(,%esi,4)
+}
+     b0f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+     b11:	c7 05 90 17 00 00 b0 	movl   $0x6b0,0x1790
+     b18:	06 00 00 
+}
+     b1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b1e:	5b                   	pop    %ebx
+     b1f:	5e                   	pop    %esi
+     b20:	5d                   	pop    %ebp
+     b21:	c3                   	ret
+     b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     b28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     b2b:	31 db                	xor    %ebx,%ebx
+}
+     b2d:	89 d8                	mov    %ebx,%eax
+     b2f:	5b                   	pop    %ebx
+     b30:	5e                   	pop    %esi
+     b31:	5d                   	pop    %ebp
+     b32:	c3                   	ret
+     b33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b37:	90                   	nop
+    f->mode = _IOLBF;
+     b38:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+     b3f:	eb c7                	jmp    b08 <fdopen+0x78>
+     b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+
+00000b50 <fopen>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	53                   	push   %ebx
+     b54:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+     b57:	ff 75 0c             	push   0xc(%ebp)
+     b5a:	ff 75 08             	push   0x8(%ebp)
+     b5d:	e8 74 fa ff ff       	call   5d6 <open>
+     b62:	83 c4 10             	add    $0x10,%esp
+     b65:	85 c0                	test   %eax,%eax
+     b67:	78 37                	js     ba0 <fopen+0x50>
+     b69:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+     b6b:	8b 04 85 a0 17 00 00 	mov    0x17a0(,%eax,4),%eax
+     b72:	85 c0                	test   %eax,%eax
+     b74:	74 17                	je     b8d <fopen+0x3d>
+    free(streams[fd]);
+     b76:	83 ec 0c             	sub    $0xc,%esp
+     b79:	50                   	push   %eax
+     b7a:	e8 a1 04 00 00       	call   1020 <free>
+    streams[fd] = 0;
+     b7f:	83 c4 10             	add    $0x10,%esp
+     b82:	c7 04 9d a0 17 00 00 	movl   $0x0,0x17a0(,%ebx,4)
+     b89:	00 00 00 00 
+  return fdopen(fd);
+     b8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     b90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b93:	c9                   	leave
+  return fdopen(fd);
+     b94:	e9 f7 fe ff ff       	jmp    a90 <fdopen>
+     b99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+     ba0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ba3:	31 c0                	xor    %eax,%eax
+     ba5:	c9                   	leave
+     ba6:	c3                   	ret
+     ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <setvbuf>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	56                   	push   %esi
+     bb4:	53                   	push   %ebx
+     bb5:	8b 75 0c             	mov    0xc(%ebp),%esi
+     bb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+     bbb:	83 fe 02             	cmp    $0x2,%esi
+     bbe:	77 38                	ja     bf8 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     bc0:	8b 43 08             	mov    0x8(%ebx),%eax
+     bc3:	85 c0                	test   %eax,%eax
+     bc5:	7e 12                	jle    bd9 <setvbuf+0x29>
+     bc7:	83 ec 04             	sub    $0x4,%esp
+     bca:	50                   	push   %eax
+     bcb:	8d 43 10             	lea    0x10(%ebx),%eax
+     bce:	50                   	push   %eax
+     bcf:	ff 33                	push   (%ebx)
+     bd1:	e8 e0 f9 ff ff       	call   5b6 <write>
+     bd6:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+     bd9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+     be0:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+     be2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+     be9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+     bec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bef:	5b                   	pop    %ebx
+     bf0:	5e                   	pop    %esi
+     bf1:	5d                   	pop    %ebp
+     bf2:	c3                   	ret
+     bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bf7:	90                   	nop
+    return -1;
+     bf8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bfd:	eb ed                	jmp    bec <setvbuf+0x3c>
+     bff:	90                   	nop
+
+00000c00 <fflush>:
+{
+     c00:	55                   	push   %ebp
+     c01:	31 c0                	xor    %eax,%eax
+     c03:	89 e5                	mov    %esp,%ebp
+     c05:	53                   	push   %ebx
+     c06:	83 ec 04             	sub    $0x4,%esp
+     c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     c0c:	8b 53 08             	mov    0x8(%ebx),%edx
+     c0f:	85 d2                	test   %edx,%edx
+     c11:	7e 1d                	jle    c30 <fflush+0x30>
+     c13:	83 ec 04             	sub    $0x4,%esp
+     c16:	8d 43 10             	lea    0x10(%ebx),%eax
+     c19:	52                   	push   %edx
+     c1a:	50                   	push   %eax
+     c1b:	ff 33                	push   (%ebx)
+     c1d:	e8 94 f9 ff ff       	call   5b6 <write>
+     c22:	83 c4 10             	add    $0x10,%esp
+     c25:	39 43 08             	cmp    %eax,0x8(%ebx)
+     c28:	0f 95 c0             	setne  %al
+     c2b:	0f b6 c0             	movzbl %al,%eax
+     c2e:	f7 d8                	neg    %eax
+  f->n = 0;
+     c30:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     c37:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c41:	c9                   	leave
+     c42:	c3                   	ret
+     c43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c50 <fclose>:
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	56                   	push   %esi
+     c54:	31 f6                	xor    %esi,%esi
+     c56:	53                   	push   %ebx
+     c57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     c5a:	8b 43 08             	mov    0x8(%ebx),%eax
+     c5d:	85 c0                	test   %eax,%eax
+     c5f:	7e 1f                	jle    c80 <fclose+0x30>
+     c61:	83 ec 04             	sub    $0x4,%esp
+     c64:	50                   	push   %eax
+     c65:	8d 43 10             	lea    0x10(%ebx),%eax
+     c68:	50                   	push   %eax
+     c69:	ff 33                	push   (%ebx)
+     c6b:	e8 46 f9 ff ff       	call   5b6 <write>
+     c70:	83 c4 10             	add    $0x10,%esp
+     c73:	39 43 08             	cmp    %eax,0x8(%ebx)
+     c76:	0f 95 c0             	setne  %al
+     c79:	0f b6 c0             	movzbl %al,%eax
+     c7c:	f7 d8                	neg    %eax
+     c7e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     c80:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+     c83:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     c8a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+     c91:	ff 33                	push   (%ebx)
+     c93:	e8 26 f9 ff ff       	call   5be <close>
+     c98:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+     c9b:	85 c0                	test   %eax,%eax
+     c9d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ca2:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+     ca5:	8b 03                	mov    (%ebx),%eax
+     ca7:	83 f8 0f             	cmp    $0xf,%eax
+     caa:	77 09                	ja     cb5 <fclose+0x65>
+     cac:	39 1c 85 a0 17 00 00 	cmp    %ebx,0x17a0(,%eax,4)
+     cb3:	74 0b                	je     cc0 <fclose+0x70>
+}
+     cb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cb8:	89 f0                	mov    %esi,%eax
+     cba:	5b                   	pop    %ebx
+     cbb:	5e                   	pop    %esi
+     cbc:	5d                   	pop    %ebp
+     cbd:	c3                   	ret
+     cbe:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+     cc0:	c7 04 85 a0 17 00 00 	movl   $0x0,0x17a0(,%eax,4)
+     cc7:	00 00 00 00 
+    free(f);
+     ccb:	83 ec 0c             	sub    $0xc,%esp
+     cce:	53                   	push   %ebx
+     ccf:	e8 4c 03 00 00       	call   1020 <free>
+     cd4:	83 c4 10             	add    $0x10,%esp
+  return r;
+     cd7:	eb dc                	jmp    cb5 <fclose+0x65>
+     cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ce0 <fputc>:
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	53                   	push   %ebx
+     ce4:	83 ec 04             	sub    $0x4,%esp
+     ce7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     cea:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+     ced:	8b 43 08             	mov    0x8(%ebx),%eax
+     cf0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     cf5:	74 59                	je     d50 <fputc+0x70>
+  f->buf[f->n++] = c;
+     cf7:	8d 48 01             	lea    0x1(%eax),%ecx
+     cfa:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     cfd:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     d01:	80 fa 0a             	cmp    $0xa,%dl
+     d04:	75 07                	jne    d0d <fputc+0x2d>
+    f->nl = 1;
+     d06:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     d0d:	8b 43 04             	mov    0x4(%ebx),%eax
+     d10:	83 f8 02             	cmp    $0x2,%eax
+     d13:	74 1a                	je     d2f <fputc+0x4f>
+     d15:	83 f8 01             	cmp    $0x1,%eax
+     d18:	74 0e                	je     d28 <fputc+0x48>
+}
+     d1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+     d1d:	0f b6 c2             	movzbl %dl,%eax
+}
+     d20:	c9                   	leave
+     d21:	c3                   	ret
+     d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     d28:	8b 43 0c             	mov    0xc(%ebx),%eax
+     d2b:	85 c0                	test   %eax,%eax
+     d2d:	74 eb                	je     d1a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d2f:	85 c9                	test   %ecx,%ecx
+     d31:	7f 4d                	jg     d80 <fputc+0xa0>
+  f->n = 0;
+     d33:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     d3a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     d41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+     d44:	0f b6 c2             	movzbl %dl,%eax
+}
+     d47:	c9                   	leave
+     d48:	c3                   	ret
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d50:	83 ec 04             	sub    $0x4,%esp
+     d53:	8d 43 10             	lea    0x10(%ebx),%eax
+     d56:	89 55 08             	mov    %edx,0x8(%ebp)
+     d59:	68 00 02 00 00       	push   $0x200
+     d5e:	50                   	push   %eax
+     d5f:	ff 33                	push   (%ebx)
+     d61:	e8 50 f8 ff ff       	call   5b6 <write>
+  return r;
+     d66:	8b 55 08             	mov    0x8(%ebp),%edx
+     d69:	83 c4 10             	add    $0x10,%esp
+     d6c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     d71:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     d78:	31 c0                	xor    %eax,%eax
+     d7a:	e9 7b ff ff ff       	jmp    cfa <fputc+0x1a>
+     d7f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d80:	83 ec 04             	sub    $0x4,%esp
+     d83:	8d 43 10             	lea    0x10(%ebx),%eax
+     d86:	89 55 08             	mov    %edx,0x8(%ebp)
+     d89:	51                   	push   %ecx
+     d8a:	50                   	push   %eax
+     d8b:	ff 33                	push   (%ebx)
+     d8d:	e8 24 f8 ff ff       	call   5b6 <write>
+  f->n = 0;
+     d92:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+     d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+     d9c:	83 c4 10             	add    $0x10,%esp
+     d9f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     da6:	eb 99                	jmp    d41 <fputc+0x61>
+     da8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     daf:	90                   	nop
+
+00000db0 <fwrite>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	57                   	push   %edi
+     db4:	56                   	push   %esi
+     db5:	53                   	push   %ebx
+     db6:	83 ec 1c             	sub    $0x1c,%esp
+     db9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+     dbc:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+     dbf:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+     dc2:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+     dc5:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+     dcb:	0f 8f af 00 00 00    	jg     e80 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+     dd1:	85 ff                	test   %edi,%edi
+     dd3:	7e 73                	jle    e48 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     dd5:	8d 56 10             	lea    0x10(%esi),%edx
+     dd8:	8b 46 08             	mov    0x8(%esi),%eax
+     ddb:	31 db                	xor    %ebx,%ebx
+     ddd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     de0:	eb 25                	jmp    e07 <fwrite+0x57>
+     de2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+     de8:	89 c1                	mov    %eax,%ecx
+     dea:	83 c0 01             	add    $0x1,%eax
+     ded:	89 46 08             	mov    %eax,0x8(%esi)
+     df0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     df4:	80 fa 0a             	cmp    $0xa,%dl
+     df7:	75 07                	jne    e00 <fwrite+0x50>
+    f->nl = 1;
+     df9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+     e00:	83 c3 01             	add    $0x1,%ebx
+     e03:	39 df                	cmp    %ebx,%edi
+     e05:	7e 41                	jle    e48 <fwrite+0x98>
+    bputc(f, s[i]);
+     e07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e0a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+     e0e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     e13:	75 d3                	jne    de8 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e15:	83 ec 04             	sub    $0x4,%esp
+     e18:	88 55 e7             	mov    %dl,-0x19(%ebp)
+     e1b:	68 00 02 00 00       	push   $0x200
+     e20:	ff 75 e0             	push   -0x20(%ebp)
+     e23:	ff 36                	push   (%esi)
+     e25:	e8 8c f7 ff ff       	call   5b6 <write>
+  return r;
+     e2a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+     e2e:	83 c4 10             	add    $0x10,%esp
+     e31:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     e33:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     e3a:	b8 01 00 00 00       	mov    $0x1,%eax
+     e3f:	eb ac                	jmp    ded <fwrite+0x3d>
+     e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     e48:	8b 46 04             	mov    0x4(%esi),%eax
+     e4b:	83 f8 02             	cmp    $0x2,%eax
+     e4e:	74 0c                	je     e5c <fwrite+0xac>
+     e50:	83 f8 01             	cmp    $0x1,%eax
+     e53:	75 1c                	jne    e71 <fwrite+0xc1>
+     e55:	8b 46 0c             	mov    0xc(%esi),%eax
+     e58:	85 c0                	test   %eax,%eax
+     e5a:	74 15                	je     e71 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e5c:	8b 46 08             	mov    0x8(%esi),%eax
+     e5f:	85 c0                	test   %eax,%eax
+     e61:	7f 5d                	jg     ec0 <fwrite+0x110>
+  f->n = 0;
+     e63:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     e6a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+     e71:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+     e74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e77:	5b                   	pop    %ebx
+     e78:	5e                   	pop    %esi
+     e79:	5f                   	pop    %edi
+     e7a:	5d                   	pop    %ebp
+     e7b:	c3                   	ret
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+     e80:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+     e84:	0f 84 4b ff ff ff    	je     dd5 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e8a:	8b 46 08             	mov    0x8(%esi),%eax
+     e8d:	8b 16                	mov    (%esi),%edx
+     e8f:	85 c0                	test   %eax,%eax
+     e91:	7f 45                	jg     ed8 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+     e93:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+     e96:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     e9d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+     ea4:	57                   	push   %edi
+     ea5:	ff 75 08             	push   0x8(%ebp)
+     ea8:	ff 36                	push   (%esi)
+     eaa:	e8 07 f7 ff ff       	call   5b6 <write>
+    return size > 0 ? i / size : 0;
+     eaf:	83 c4 10             	add    $0x10,%esp
+     eb2:	85 c0                	test   %eax,%eax
+     eb4:	78 4a                	js     f00 <fwrite+0x150>
+     eb6:	85 db                	test   %ebx,%ebx
+     eb8:	7e 46                	jle    f00 <fwrite+0x150>
+     eba:	99                   	cltd
+     ebb:	f7 fb                	idiv   %ebx
+     ebd:	eb b5                	jmp    e74 <fwrite+0xc4>
+     ebf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     ec0:	83 ec 04             	sub    $0x4,%esp
+     ec3:	50                   	push   %eax
+     ec4:	8d 46 10             	lea    0x10(%esi),%eax
+     ec7:	50                   	push   %eax
+     ec8:	ff 36                	push   (%esi)
+     eca:	e8 e7 f6 ff ff       	call   5b6 <write>
+     ecf:	83 c4 10             	add    $0x10,%esp
+     ed2:	eb 8f                	jmp    e63 <fwrite+0xb3>
+     ed4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ed8:	83 ec 04             	sub    $0x4,%esp
+     edb:	50                   	push   %eax
+     edc:	8d 46 10             	lea    0x10(%esi),%eax
+     edf:	50                   	push   %eax
+     ee0:	52                   	push   %edx
+     ee1:	e8 d0 f6 ff ff       	call   5b6 <write>
+     ee6:	83 c4 10             	add    $0x10,%esp
+     ee9:	3b 46 08             	cmp    0x8(%esi),%eax
+     eec:	74 a5                	je     e93 <fwrite+0xe3>
+  f->n = 0;
+     eee:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     ef5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+     f00:	31 c0                	xor    %eax,%eax
+     f02:	e9 6d ff ff ff       	jmp    e74 <fwrite+0xc4>
+     f07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0e:	66 90                	xchg   %ax,%ax
+
+00000f10 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     f14:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     f17:	83 ec 04             	sub    $0x4,%esp
+     f1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     f1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+     f20:	89 d8                	mov    %ebx,%eax
+     f22:	e8 39 f9 ff ff       	call   860 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     f27:	8b 43 04             	mov    0x4(%ebx),%eax
+     f2a:	83 f8 02             	cmp    $0x2,%eax
+     f2d:	74 18                	je     f47 <fprintf+0x37>
+     f2f:	83 f8 01             	cmp    $0x1,%eax
+     f32:	74 0c                	je     f40 <fprintf+0x30>
+  settle(f);
+}
+     f34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f37:	c9                   	leave
+     f38:	c3                   	ret
+     f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     f40:	8b 43 0c             	mov    0xc(%ebx),%eax
+     f43:	85 c0                	test   %eax,%eax
+     f45:	74 ed                	je     f34 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     f47:	8b 43 08             	mov    0x8(%ebx),%eax
+     f4a:	85 c0                	test   %eax,%eax
+     f4c:	7f 1a                	jg     f68 <fprintf+0x58>
+  f->n = 0;
+     f4e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     f55:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     f5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f5f:	c9                   	leave
+     f60:	c3                   	ret
+     f61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     f68:	83 ec 04             	sub    $0x4,%esp
+     f6b:	50                   	push   %eax
+     f6c:	8d 43 10             	lea    0x10(%ebx),%eax
+     f6f:	50                   	push   %eax
+     f70:	ff 33                	push   (%ebx)
+     f72:	e8 3f f6 ff ff       	call   5b6 <write>
+  f->n = 0;
+     f77:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+     f7e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+     f81:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     f88:	eb d2                	jmp    f5c <fprintf+0x4c>
+     f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f90 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	53                   	push   %ebx
+     f94:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+     f9d:	83 f8 0f             	cmp    $0xf,%eax
+     fa0:	77 4e                	ja     ff0 <printf+0x60>
+     fa2:	8b 1c 85 a0 17 00 00 	mov    0x17a0(,%eax,4),%ebx
+     fa9:	85 db                	test   %ebx,%ebx
+     fab:	74 43                	je     ff0 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     fad:	8b 55 0c             	mov    0xc(%ebp),%edx
+     fb0:	89 d8                	mov    %ebx,%eax
+     fb2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     fb5:	e8 a6 f8 ff ff       	call   860 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     fba:	8b 43 08             	mov    0x8(%ebx),%eax
+     fbd:	85 c0                	test   %eax,%eax
+     fbf:	7e 12                	jle    fd3 <printf+0x43>
+     fc1:	83 ec 04             	sub    $0x4,%esp
+     fc4:	50                   	push   %eax
+     fc5:	8d 43 10             	lea    0x10(%ebx),%eax
+     fc8:	50                   	push   %eax
+     fc9:	ff 33                	push   (%ebx)
+     fcb:	e8 e6 f5 ff ff       	call   5b6 <write>
+     fd0:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+     fd3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     fda:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+     fe1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fe4:	c9                   	leave
+     fe5:	c3                   	ret
+     fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+     ff0:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+     ff6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+     ffc:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+    1003:	00 00 00 
+    f->n = 0;
+    1006:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    100d:	00 00 00 
+    f->nl = 0;
+    1010:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+    1017:	00 00 00 
+    101a:	eb 91                	jmp    fad <printf+0x1d>
+    101c:	66 90                	xchg   %ax,%ax
+    101e:	66 90                	xchg   %ax,%ax
+
+00001020 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1020:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1021:	a1 e0 17 00 00       	mov    0x17e0,%eax
+{
+    1026:	89 e5                	mov    %esp,%ebp
+    1028:	57                   	push   %edi
+    1029:	56                   	push   %esi
+    102a:	53                   	push   %ebx
+    102b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    102e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1031:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1038:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    103a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    103c:	39 ca                	cmp    %ecx,%edx
+    103e:	73 30                	jae    1070 <free+0x50>
+    1040:	39 c1                	cmp    %eax,%ecx
+    1042:	72 04                	jb     1048 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1044:	39 c2                	cmp    %eax,%edx
+    1046:	72 f0                	jb     1038 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1048:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    104b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    104e:	39 f8                	cmp    %edi,%eax
+    1050:	74 2e                	je     1080 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1052:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1055:	8b 42 04             	mov    0x4(%edx),%eax
+    1058:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    105b:	39 f1                	cmp    %esi,%ecx
+    105d:	74 38                	je     1097 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    105f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1061:	5b                   	pop    %ebx
+  freep = p;
+    1062:	89 15 e0 17 00 00    	mov    %edx,0x17e0
+}
+    1068:	5e                   	pop    %esi
+    1069:	5f                   	pop    %edi
+    106a:	5d                   	pop    %ebp
+    106b:	c3                   	ret
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1070:	39 c1                	cmp    %eax,%ecx
+    1072:	72 d0                	jb     1044 <free+0x24>
+    1074:	eb c2                	jmp    1038 <free+0x18>
+    1076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1080:	03 70 04             	add    0x4(%eax),%esi
+    1083:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1086:	8b 02                	mov    (%edx),%eax
+    1088:	8b 00                	mov    (%eax),%eax
+    108a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    108d:	8b 42 04             	mov    0x4(%edx),%eax
+    1090:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1093:	39 f1                	cmp    %esi,%ecx
+    1095:	75 c8                	jne    105f <free+0x3f>
+    p->s.size += bp->s.size;
+    1097:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    109a:	89 15 e0 17 00 00    	mov    %edx,0x17e0
+    p->s.size += bp->s.size;
+    10a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    10a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    10a6:	89 0a                	mov    %ecx,(%edx)
+}
+    10a8:	5b                   	pop    %ebx
+    10a9:	5e                   	pop    %esi
+    10aa:	5f                   	pop    %edi
+    10ab:	5d                   	pop    %ebp
+    10ac:	c3                   	ret
+    10ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	57                   	push   %edi
+    10b4:	56                   	push   %esi
+    10b5:	53                   	push   %ebx
+    10b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    10bc:	8b 15 e0 17 00 00    	mov    0x17e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10c2:	8d 78 07             	lea    0x7(%eax),%edi
+    10c5:	c1 ef 03             	shr    $0x3,%edi
+    10c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    10cb:	85 d2                	test   %edx,%edx
+    10cd:	0f 84 8d 00 00 00    	je     1160 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    10d5:	8b 48 04             	mov    0x4(%eax),%ecx
+    10d8:	39 f9                	cmp    %edi,%ecx
+    10da:	73 64                	jae    1140 <malloc+0x90>
+  if(nu < 4096)
+    10dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    10e1:	39 df                	cmp    %ebx,%edi
+    10e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    10e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    10ed:	eb 0a                	jmp    10f9 <malloc+0x49>
+    10ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    10f2:	8b 48 04             	mov    0x4(%eax),%ecx
+    10f5:	39 f9                	cmp    %edi,%ecx
+    10f7:	73 47                	jae    1140 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    10f9:	89 c2                	mov    %eax,%edx
+    10fb:	39 05 e0 17 00 00    	cmp    %eax,0x17e0
+    1101:	75 ed                	jne    10f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1103:	83 ec 0c             	sub    $0xc,%esp
+    1106:	56                   	push   %esi
+    1107:	e8 12 f5 ff ff       	call   61e <sbrk>
+  if(p == (char*)-1)
+    110c:	83 c4 10             	add    $0x10,%esp
+    110f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1112:	74 1c                	je     1130 <malloc+0x80>
+  hp->s.size = nu;
+    1114:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1117:	83 ec 0c             	sub    $0xc,%esp
+    111a:	83 c0 08             	add    $0x8,%eax
+    111d:	50                   	push   %eax
+    111e:	e8 fd fe ff ff       	call   1020 <free>
+  return freep;
+    1123:	8b 15 e0 17 00 00    	mov    0x17e0,%edx
+      if((p = morecore(nunits)) == 0)
+    1129:	83 c4 10             	add    $0x10,%esp
+    112c:	85 d2                	test   %edx,%edx
+    112e:	75 c0                	jne    10f0 <malloc+0x40>
+        return 0;
+  }
+}
+    1130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1133:	31 c0                	xor    %eax,%eax
+}
+    1135:	5b                   	pop    %ebx
+    1136:	5e                   	pop    %esi
+    1137:	5f                   	pop    %edi
+    1138:	5d                   	pop    %ebp
+    1139:	c3                   	ret
+    113a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1140:	39 cf                	cmp    %ecx,%edi
+    1142:	74 4c                	je     1190 <malloc+0xe0>
+        p->s.size -= nunits;
+    1144:	29 f9                	sub    %edi,%ecx
+    1146:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1149:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    114c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    114f:	89 15 e0 17 00 00    	mov    %edx,0x17e0
+}
+    1155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1158:	83 c0 08             	add    $0x8,%eax
+}
+    115b:	5b                   	pop    %ebx
+    115c:	5e                   	pop    %esi
+    115d:	5f                   	pop    %edi
+    115e:	5d                   	pop    %ebp
+    115f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1160:	c7 05 e0 17 00 00 e4 	movl   $0x17e4,0x17e0
+    1167:	17 00 00 
+    base.s.size = 0;
+    116a:	b8 e4 17 00 00       	mov    $0x17e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    116f:	c7 05 e4 17 00 00 e4 	movl   $0x17e4,0x17e4
+    1176:	17 00 00 
+    base.s.size = 0;
+    1179:	c7 05 e8 17 00 00 00 	movl   $0x0,0x17e8
+    1180:	00 00 00 
+    if(p->s.size >= nunits){
+    1183:	e9 54 ff ff ff       	jmp    10dc <malloc+0x2c>
+    1188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1190:	8b 08                	mov    (%eax),%ecx
+    1192:	89 0a                	mov    %ecx,(%edx)
+    1194:	eb b9                	jmp    114f <malloc+0x9f>
@@ -0,0 +1,2054 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 fa 02 00 00       	call   33e <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 ef 0e 00 00       	push   $0xeef
+  53:	6a 02                	push   $0x2
+  55:	e8 76 0c 00 00       	call   cd0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 5e 02 00 00       	call   2c0 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 d8 0e 00 00       	push   $0xed8
+  69:	6a 02                	push   $0x2
+  6b:	e8 60 0c 00 00       	call   cd0 <printf>
+    exit();
+  70:	e8 4b 02 00 00       	call   2c0 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 31 01 00 00       	call   2ee <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 04 01 00 00       	call   316 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 07 01 00 00       	call   32e <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 cd 00 00 00       	call   2fe <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 2c6:	a1 40 14 00 00       	mov    0x1440,%eax
+ 2cb:	85 c0                	test   %eax,%eax
+ 2cd:	74 02                	je     2d1 <exit+0x11>
+    exithook();
+ 2cf:	ff d0                	call   *%eax
+  _exit();
+ 2d1:	e8 10 01 00 00       	call   3e6 <_exit>
+
+000002d6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2d6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <wait>:
+SYSCALL(wait)
+ 2de:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <pipe>:
+SYSCALL(pipe)
+ 2e6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <read>:
+SYSCALL(read)
+ 2ee:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <write>:
+SYSCALL(write)
+ 2f6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <close>:
+SYSCALL(close)
+ 2fe:	b8 15 00 00 00       	mov    $0x15,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <kill>:
+SYSCALL(kill)
+ 306:	b8 06 00 00 00       	mov    $0x6,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <exec>:
+SYSCALL(exec)
+ 30e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <open>:
+SYSCALL(open)
+ 316:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <mknod>:
+SYSCALL(mknod)
+ 31e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <unlink>:
+SYSCALL(unlink)
+ 326:	b8 12 00 00 00       	mov    $0x12,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <fstat>:
+SYSCALL(fstat)
+ 32e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <link>:
+SYSCALL(link)
+ 336:	b8 13 00 00 00       	mov    $0x13,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <mkdir>:
+SYSCALL(mkdir)
+ 33e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <chdir>:
+SYSCALL(chdir)
+ 346:	b8 09 00 00 00       	mov    $0x9,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <dup>:
+SYSCALL(dup)
+ 34e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <getpid>:
+SYSCALL(getpid)
+ 356:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <sbrk>:
+SYSCALL(sbrk)
+ 35e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <sleep>:
+SYSCALL(sleep)
+ 366:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <uptime>:
+SYSCALL(uptime)
+ 36e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 376:	b8 16 00 00 00       	mov    $0x16,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <sigaction>:
+SYSCALL(sigaction)
+ 37e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <sigret>:
+SYSCALL(sigret)
+ 386:	b8 18 00 00 00       	mov    $0x18,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <readv>:
+SYSCALL(readv)
+ 38e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <writev>:
+SYSCALL(writev)
+ 396:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <nanosleep>:
+SYSCALL(nanosleep)
+ 39e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <setpriority>:
+SYSCALL(setpriority)
+ 3a6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <sched_setattr>:
+SYSCALL(sched_setattr)
+ 3ae:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <sched_yield>:
+SYSCALL(sched_yield)
+ 3b6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 3be:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 3c6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <getrusage>:
+SYSCALL(getrusage)
+ 3ce:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <syslat>:
+SYSCALL(syslat)
+ 3d6:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <sched_getattr>:
+SYSCALL(sched_getattr)
+ 3de:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 3e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 3eb:	cd 40                	int    $0x40
+  ret
+ 3ed:	c3                   	ret
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 3f5:	31 db                	xor    %ebx,%ebx
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 400:	8b 34 9d 60 14 00 00 	mov    0x1460(,%ebx,4),%esi
+ 407:	85 f6                	test   %esi,%esi
+ 409:	74 27                	je     432 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 40b:	8b 46 08             	mov    0x8(%esi),%eax
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 12                	jle    424 <flushall+0x34>
+ 412:	83 ec 04             	sub    $0x4,%esp
+ 415:	50                   	push   %eax
+ 416:	8d 46 10             	lea    0x10(%esi),%eax
+ 419:	50                   	push   %eax
+ 41a:	ff 36                	push   (%esi)
+ 41c:	e8 d5 fe ff ff       	call   2f6 <write>
+ 421:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 424:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 42b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 432:	83 c3 01             	add    $0x1,%ebx
+ 435:	83 fb 10             	cmp    $0x10,%ebx
+ 438:	75 c6                	jne    400 <flushall+0x10>
+}
+ 43a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5d                   	pop    %ebp
+ 440:	c3                   	ret
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 458:	89 d1                	mov    %edx,%ecx
+{
+ 45a:	83 ec 2c             	sub    $0x2c,%esp
+ 45d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 460:	85 d2                	test   %edx,%edx
+ 462:	0f 89 c8 00 00 00    	jns    530 <printint+0xe0>
+ 468:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 46c:	0f 84 be 00 00 00    	je     530 <printint+0xe0>
+    x = -xx;
+ 472:	f7 d9                	neg    %ecx
+    neg = 1;
+ 474:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 479:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 47c:	31 f6                	xor    %esi,%esi
+ 47e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 480:	89 c8                	mov    %ecx,%eax
+ 482:	31 d2                	xor    %edx,%edx
+ 484:	89 f7                	mov    %esi,%edi
+ 486:	f7 f3                	div    %ebx
+ 488:	8d 76 01             	lea    0x1(%esi),%esi
+ 48b:	0f b6 92 6c 0f 00 00 	movzbl 0xf6c(%edx),%edx
+ 492:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 496:	89 ca                	mov    %ecx,%edx
+ 498:	89 c1                	mov    %eax,%ecx
+ 49a:	39 da                	cmp    %ebx,%edx
+ 49c:	73 e2                	jae    480 <printint+0x30>
+  if(neg)
+ 49e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 4a1:	85 c0                	test   %eax,%eax
+ 4a3:	74 07                	je     4ac <printint+0x5c>
+    buf[i++] = '-';
+ 4a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4aa:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 4ac:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 4af:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4b2:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4b4:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 4b7:	8b 41 08             	mov    0x8(%ecx),%eax
+ 4ba:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4bd:	89 ce                	mov    %ecx,%esi
+ 4bf:	eb 28                	jmp    4e9 <printint+0x99>
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 4c8:	89 c1                	mov    %eax,%ecx
+ 4ca:	83 c0 01             	add    $0x1,%eax
+ 4cd:	89 46 08             	mov    %eax,0x8(%esi)
+ 4d0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 4d4:	80 fa 0a             	cmp    $0xa,%dl
+ 4d7:	75 07                	jne    4e0 <printint+0x90>
+    f->nl = 1;
+ 4d9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 4e0:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 4e3:	39 fb                	cmp    %edi,%ebx
+ 4e5:	74 39                	je     520 <printint+0xd0>
+ 4e7:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 4e9:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 4ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 4f1:	75 d5                	jne    4c8 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4f3:	83 ec 04             	sub    $0x4,%esp
+ 4f6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 4f9:	68 00 02 00 00       	push   $0x200
+ 4fe:	ff 75 d0             	push   -0x30(%ebp)
+ 501:	ff 36                	push   (%esi)
+ 503:	e8 ee fd ff ff       	call   2f6 <write>
+  return r;
+ 508:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 50c:	83 c4 10             	add    $0x10,%esp
+ 50f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 511:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 518:	b8 01 00 00 00       	mov    $0x1,%eax
+ 51d:	eb ae                	jmp    4cd <printint+0x7d>
+ 51f:	90                   	nop
+}
+ 520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 523:	5b                   	pop    %ebx
+ 524:	5e                   	pop    %esi
+ 525:	5f                   	pop    %edi
+ 526:	5d                   	pop    %ebp
+ 527:	c3                   	ret
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+  neg = 0;
+ 530:	31 c0                	xor    %eax,%eax
+ 532:	e9 42 ff ff ff       	jmp    479 <printint+0x29>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <bputc>:
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	89 c3                	mov    %eax,%ebx
+ 546:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 549:	8b 40 08             	mov    0x8(%eax),%eax
+ 54c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 551:	74 1d                	je     570 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 553:	8d 48 01             	lea    0x1(%eax),%ecx
+ 556:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 559:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 55d:	80 fa 0a             	cmp    $0xa,%dl
+ 560:	75 07                	jne    569 <bputc+0x29>
+    f->nl = 1;
+ 562:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 569:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 56c:	c9                   	leave
+ 56d:	c3                   	ret
+ 56e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	8d 43 10             	lea    0x10(%ebx),%eax
+ 576:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 579:	68 00 02 00 00       	push   $0x200
+ 57e:	50                   	push   %eax
+ 57f:	ff 33                	push   (%ebx)
+ 581:	e8 70 fd ff ff       	call   2f6 <write>
+  return r;
+ 586:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 589:	83 c4 10             	add    $0x10,%esp
+ 58c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 591:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 598:	31 c0                	xor    %eax,%eax
+ 59a:	eb ba                	jmp    556 <bputc+0x16>
+ 59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	83 ec 1c             	sub    $0x1c,%esp
+ 5a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 5ac:	0f b6 0a             	movzbl (%edx),%ecx
+ 5af:	84 c9                	test   %cl,%cl
+ 5b1:	74 47                	je     5fa <vfprintf+0x5a>
+ 5b3:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 5b6:	89 c7                	mov    %eax,%edi
+ 5b8:	31 d2                	xor    %edx,%edx
+ 5ba:	89 de                	mov    %ebx,%esi
+ 5bc:	89 cb                	mov    %ecx,%ebx
+ 5be:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 5c0:	0f be cb             	movsbl %bl,%ecx
+ 5c3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5c6:	85 d2                	test   %edx,%edx
+ 5c8:	75 4e                	jne    618 <vfprintf+0x78>
+      if(c == '%'){
+ 5ca:	83 f8 25             	cmp    $0x25,%eax
+ 5cd:	74 69                	je     638 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 5cf:	8b 47 08             	mov    0x8(%edi),%eax
+ 5d2:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5d7:	0f 84 73 01 00 00    	je     750 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 5dd:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5e0:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 5e3:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 5e7:	80 fb 0a             	cmp    $0xa,%bl
+ 5ea:	74 1c                	je     608 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 5f0:	0f b6 1e             	movzbl (%esi),%ebx
+ 5f3:	83 c6 01             	add    $0x1,%esi
+ 5f6:	84 db                	test   %bl,%bl
+ 5f8:	75 c6                	jne    5c0 <vfprintf+0x20>
+    }
+  }
+}
+ 5fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fd:	5b                   	pop    %ebx
+ 5fe:	5e                   	pop    %esi
+ 5ff:	5f                   	pop    %edi
+ 600:	5d                   	pop    %ebp
+ 601:	c3                   	ret
+ 602:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 608:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 60f:	eb df                	jmp    5f0 <vfprintf+0x50>
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 618:	83 fa 25             	cmp    $0x25,%edx
+ 61b:	75 d3                	jne    5f0 <vfprintf+0x50>
+      if(c == 'd'){
+ 61d:	83 f8 25             	cmp    $0x25,%eax
+ 620:	74 37                	je     659 <vfprintf+0xb9>
+ 622:	83 e8 63             	sub    $0x63,%eax
+ 625:	83 f8 15             	cmp    $0x15,%eax
+ 628:	77 16                	ja     640 <vfprintf+0xa0>
+ 62a:	ff 24 85 14 0f 00 00 	jmp    *0xf14(,%eax,4)
+ 631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 638:	ba 25 00 00 00       	mov    $0x25,%edx
+ 63d:	eb b1                	jmp    5f0 <vfprintf+0x50>
+ 63f:	90                   	nop
+  if(f->n == BUFSIZ)
+ 640:	8b 47 08             	mov    0x8(%edi),%eax
+ 643:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 648:	0f 84 4c 01 00 00    	je     79a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 64e:	8d 50 01             	lea    0x1(%eax),%edx
+ 651:	89 57 08             	mov    %edx,0x8(%edi)
+ 654:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 659:	89 ca                	mov    %ecx,%edx
+ 65b:	89 f8                	mov    %edi,%eax
+ 65d:	e8 de fe ff ff       	call   540 <bputc>
+ 662:	eb 88                	jmp    5ec <vfprintf+0x4c>
+ 664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 668:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 66b:	83 ec 0c             	sub    $0xc,%esp
+ 66e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 673:	8b 13                	mov    (%ebx),%edx
+ 675:	6a 00                	push   $0x0
+ 677:	89 f8                	mov    %edi,%eax
+        ap++;
+ 679:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 67c:	e8 cf fd ff ff       	call   450 <printint>
+        ap++;
+ 681:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 684:	83 c4 10             	add    $0x10,%esp
+ 687:	e9 60 ff ff ff       	jmp    5ec <vfprintf+0x4c>
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 690:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 693:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 695:	83 c0 04             	add    $0x4,%eax
+ 698:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 69b:	85 d2                	test   %edx,%edx
+ 69d:	0f 84 dd 00 00 00    	je     780 <vfprintf+0x1e0>
+        while(*s != 0){
+ 6a3:	0f b6 1a             	movzbl (%edx),%ebx
+ 6a6:	84 db                	test   %bl,%bl
+ 6a8:	0f 84 3e ff ff ff    	je     5ec <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 6ae:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 6b1:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 6b4:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 6b7:	89 fe                	mov    %edi,%esi
+ 6b9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 6bc:	89 d7                	mov    %edx,%edi
+ 6be:	eb 27                	jmp    6e7 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 6c0:	89 c1                	mov    %eax,%ecx
+ 6c2:	83 c0 01             	add    $0x1,%eax
+ 6c5:	89 46 08             	mov    %eax,0x8(%esi)
+ 6c8:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 6cc:	80 fb 0a             	cmp    $0xa,%bl
+ 6cf:	75 07                	jne    6d8 <vfprintf+0x138>
+    f->nl = 1;
+ 6d1:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 6d8:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 6dc:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 6df:	84 db                	test   %bl,%bl
+ 6e1:	0f 84 a9 00 00 00    	je     790 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 6e7:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6ec:	75 d2                	jne    6c0 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 6ee:	83 ec 04             	sub    $0x4,%esp
+ 6f1:	68 00 02 00 00       	push   $0x200
+ 6f6:	ff 75 e0             	push   -0x20(%ebp)
+ 6f9:	ff 36                	push   (%esi)
+ 6fb:	e8 f6 fb ff ff       	call   2f6 <write>
+  return r;
+ 700:	83 c4 10             	add    $0x10,%esp
+ 703:	b8 01 00 00 00       	mov    $0x1,%eax
+ 708:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 70a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 711:	eb b2                	jmp    6c5 <vfprintf+0x125>
+ 713:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 717:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 718:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 71b:	83 ec 0c             	sub    $0xc,%esp
+ 71e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 723:	8b 13                	mov    (%ebx),%edx
+ 725:	6a 01                	push   $0x1
+ 727:	e9 4b ff ff ff       	jmp    677 <vfprintf+0xd7>
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 730:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 733:	89 f8                	mov    %edi,%eax
+ 735:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 738:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 73b:	e8 00 fe ff ff       	call   540 <bputc>
+        ap++;
+ 740:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 743:	31 d2                	xor    %edx,%edx
+ 745:	e9 a6 fe ff ff       	jmp    5f0 <vfprintf+0x50>
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	8d 47 10             	lea    0x10(%edi),%eax
+ 756:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 759:	68 00 02 00 00       	push   $0x200
+ 75e:	50                   	push   %eax
+ 75f:	ff 37                	push   (%edi)
+ 761:	e8 90 fb ff ff       	call   2f6 <write>
+  return r;
+ 766:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 769:	83 c4 10             	add    $0x10,%esp
+ 76c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 76e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 775:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 77a:	e9 61 fe ff ff       	jmp    5e0 <vfprintf+0x40>
+ 77f:	90                   	nop
+          s = "(null)";
+ 780:	ba 0b 0f 00 00       	mov    $0xf0b,%edx
+ 785:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 78a:	e9 1f ff ff ff       	jmp    6ae <vfprintf+0x10e>
+ 78f:	90                   	nop
+ 790:	89 f7                	mov    %esi,%edi
+ 792:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 795:	e9 52 fe ff ff       	jmp    5ec <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 79a:	83 ec 04             	sub    $0x4,%esp
+ 79d:	8d 47 10             	lea    0x10(%edi),%eax
+ 7a0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 7a3:	68 00 02 00 00       	push   $0x200
+ 7a8:	50                   	push   %eax
+ 7a9:	ff 37                	push   (%edi)
+ 7ab:	e8 46 fb ff ff       	call   2f6 <write>
+  return r;
+ 7b0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 7b3:	83 c4 10             	add    $0x10,%esp
+ 7b6:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 7bb:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 7c2:	31 c0                	xor    %eax,%eax
+ 7c4:	e9 88 fe ff ff       	jmp    651 <vfprintf+0xb1>
+ 7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <fdopen>:
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	56                   	push   %esi
+ 7d4:	53                   	push   %ebx
+ 7d5:	83 ec 20             	sub    $0x20,%esp
+ 7d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 7db:	83 fe 0f             	cmp    $0xf,%esi
+ 7de:	0f 87 84 00 00 00    	ja     868 <fdopen+0x98>
+  if(streams[fd])
+ 7e4:	8b 1c b5 60 14 00 00 	mov    0x1460(,%esi,4),%ebx
+ 7eb:	85 db                	test   %ebx,%ebx
+ 7ed:	74 11                	je     800 <fdopen+0x30>
+}
+ 7ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7f2:	89 d8                	mov    %ebx,%eax
+ 7f4:	5b                   	pop    %ebx
+ 7f5:	5e                   	pop    %esi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 800:	83 ec 0c             	sub    $0xc,%esp
+ 803:	68 10 02 00 00       	push   $0x210
+ 808:	e8 e3 05 00 00       	call   df0 <malloc>
+ 80d:	83 c4 10             	add    $0x10,%esp
+ 810:	89 c3                	mov    %eax,%ebx
+ 812:	85 c0                	test   %eax,%eax
+ 814:	74 52                	je     868 <fdopen+0x98>
+  f->fd = fd;
+ 816:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 818:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 81b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 822:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 829:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 830:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 833:	50                   	push   %eax
+ 834:	56                   	push   %esi
+ 835:	e8 f4 fa ff ff       	call   32e <fstat>
+ 83a:	83 c4 10             	add    $0x10,%esp
+ 83d:	85 c0                	test   %eax,%eax
+ 83f:	75 07                	jne    848 <fdopen+0x78>
+ 841:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 846:	74 30                	je     878 <fdopen+0xa8>
+  streams[fd] = f;
+ 848:	89 1c b5 60 14 00 00 	mov    %ebx,0x1460(,%esi,4)
+}
+ 84f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 851:	c7 05 40 14 00 00 f0 	movl   $0x3f0,0x1440
+ 858:	03 00 00 
+}
+ 85b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 85e:	5b                   	pop    %ebx
+ 85f:	5e                   	pop    %esi
+ 860:	5d                   	pop    %ebp
+ 861:	c3                   	ret
+ 862:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 86b:	31 db                	xor    %ebx,%ebx
+}
+ 86d:	89 d8                	mov    %ebx,%eax
+ 86f:	5b                   	pop    %ebx
+ 870:	5e                   	pop    %esi
+ 871:	5d                   	pop    %ebp
+ 872:	c3                   	ret
+ 873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 877:	90                   	nop
+    f->mode = _IOLBF;
+ 878:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 87f:	eb c7                	jmp    848 <fdopen+0x78>
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+
+00000890 <fopen>:
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	53                   	push   %ebx
+ 894:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 897:	ff 75 0c             	push   0xc(%ebp)
+ 89a:	ff 75 08             	push   0x8(%ebp)
+ 89d:	e8 74 fa ff ff       	call   316 <open>
+ 8a2:	83 c4 10             	add    $0x10,%esp
+ 8a5:	85 c0                	test   %eax,%eax
+ 8a7:	78 37                	js     8e0 <fopen+0x50>
+ 8a9:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 8ab:	8b 04 85 60 14 00 00 	mov    0x1460(,%eax,4),%eax
+ 8b2:	85 c0                	test   %eax,%eax
+ 8b4:	74 17                	je     8cd <fopen+0x3d>
+    free(streams[fd]);
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+ 8b9:	50                   	push   %eax
+ 8ba:	e8 a1 04 00 00       	call   d60 <free>
+    streams[fd] = 0;
+ 8bf:	83 c4 10             	add    $0x10,%esp
+ 8c2:	c7 04 9d 60 14 00 00 	movl   $0x0,0x1460(,%ebx,4)
+ 8c9:	00 00 00 00 
+  return fdopen(fd);
+ 8cd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 8d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8d3:	c9                   	leave
+  return fdopen(fd);
+ 8d4:	e9 f7 fe ff ff       	jmp    7d0 <fdopen>
+ 8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 8e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8e3:	31 c0                	xor    %eax,%eax
+ 8e5:	c9                   	leave
+ 8e6:	c3                   	ret
+ 8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <setvbuf>:
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	56                   	push   %esi
+ 8f4:	53                   	push   %ebx
+ 8f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 8f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 8fb:	83 fe 02             	cmp    $0x2,%esi
+ 8fe:	77 38                	ja     938 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 900:	8b 43 08             	mov    0x8(%ebx),%eax
+ 903:	85 c0                	test   %eax,%eax
+ 905:	7e 12                	jle    919 <setvbuf+0x29>
+ 907:	83 ec 04             	sub    $0x4,%esp
+ 90a:	50                   	push   %eax
+ 90b:	8d 43 10             	lea    0x10(%ebx),%eax
+ 90e:	50                   	push   %eax
+ 90f:	ff 33                	push   (%ebx)
+ 911:	e8 e0 f9 ff ff       	call   2f6 <write>
+ 916:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 919:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 920:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 922:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 929:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 92c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 92f:	5b                   	pop    %ebx
+ 930:	5e                   	pop    %esi
+ 931:	5d                   	pop    %ebp
+ 932:	c3                   	ret
+ 933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 937:	90                   	nop
+    return -1;
+ 938:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 93d:	eb ed                	jmp    92c <setvbuf+0x3c>
+ 93f:	90                   	nop
+
+00000940 <fflush>:
+{
+ 940:	55                   	push   %ebp
+ 941:	31 c0                	xor    %eax,%eax
+ 943:	89 e5                	mov    %esp,%ebp
+ 945:	53                   	push   %ebx
+ 946:	83 ec 04             	sub    $0x4,%esp
+ 949:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 94c:	8b 53 08             	mov    0x8(%ebx),%edx
+ 94f:	85 d2                	test   %edx,%edx
+ 951:	7e 1d                	jle    970 <fflush+0x30>
+ 953:	83 ec 04             	sub    $0x4,%esp
+ 956:	8d 43 10             	lea    0x10(%ebx),%eax
+ 959:	52                   	push   %edx
+ 95a:	50                   	push   %eax
+ 95b:	ff 33                	push   (%ebx)
+ 95d:	e8 94 f9 ff ff       	call   2f6 <write>
+ 962:	83 c4 10             	add    $0x10,%esp
+ 965:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 968:	0f 95 c0             	setne  %al
+ 96b:	0f b6 c0             	movzbl %al,%eax
+ 96e:	f7 d8                	neg    %eax
+  f->n = 0;
+ 970:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 977:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 97e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 981:	c9                   	leave
+ 982:	c3                   	ret
+ 983:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000990 <fclose>:
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	56                   	push   %esi
+ 994:	31 f6                	xor    %esi,%esi
+ 996:	53                   	push   %ebx
+ 997:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 99a:	8b 43 08             	mov    0x8(%ebx),%eax
+ 99d:	85 c0                	test   %eax,%eax
+ 99f:	7e 1f                	jle    9c0 <fclose+0x30>
+ 9a1:	83 ec 04             	sub    $0x4,%esp
+ 9a4:	50                   	push   %eax
+ 9a5:	8d 43 10             	lea    0x10(%ebx),%eax
+ 9a8:	50                   	push   %eax
+ 9a9:	ff 33                	push   (%ebx)
+ 9ab:	e8 46 f9 ff ff       	call   2f6 <write>
+ 9b0:	83 c4 10             	add    $0x10,%esp
+ 9b3:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 9b6:	0f 95 c0             	setne  %al
+ 9b9:	0f b6 c0             	movzbl %al,%eax
+ 9bc:	f7 d8                	neg    %eax
+ 9be:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ 9c0:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ 9c3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 9ca:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ 9d1:	ff 33                	push   (%ebx)
+ 9d3:	e8 26 f9 ff ff       	call   2fe <close>
+ 9d8:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ 9db:	85 c0                	test   %eax,%eax
+ 9dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9e2:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ 9e5:	8b 03                	mov    (%ebx),%eax
+ 9e7:	83 f8 0f             	cmp    $0xf,%eax
+ 9ea:	77 09                	ja     9f5 <fclose+0x65>
+ 9ec:	39 1c 85 60 14 00 00 	cmp    %ebx,0x1460(,%eax,4)
+ 9f3:	74 0b                	je     a00 <fclose+0x70>
+}
+ 9f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9f8:	89 f0                	mov    %esi,%eax
+ 9fa:	5b                   	pop    %ebx
+ 9fb:	5e                   	pop    %esi
+ 9fc:	5d                   	pop    %ebp
+ 9fd:	c3                   	ret
+ 9fe:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ a00:	c7 04 85 60 14 00 00 	movl   $0x0,0x1460(,%eax,4)
+ a07:	00 00 00 00 
+    free(f);
+ a0b:	83 ec 0c             	sub    $0xc,%esp
+ a0e:	53                   	push   %ebx
+ a0f:	e8 4c 03 00 00       	call   d60 <free>
+ a14:	83 c4 10             	add    $0x10,%esp
+  return r;
+ a17:	eb dc                	jmp    9f5 <fclose+0x65>
+ a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <fputc>:
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	53                   	push   %ebx
+ a24:	83 ec 04             	sub    $0x4,%esp
+ a27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ a2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ a2d:	8b 43 08             	mov    0x8(%ebx),%eax
+ a30:	3d 00 02 00 00       	cmp    $0x200,%eax
+ a35:	74 59                	je     a90 <fputc+0x70>
+  f->buf[f->n++] = c;
+ a37:	8d 48 01             	lea    0x1(%eax),%ecx
+ a3a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ a3d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ a41:	80 fa 0a             	cmp    $0xa,%dl
+ a44:	75 07                	jne    a4d <fputc+0x2d>
+    f->nl = 1;
+ a46:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a4d:	8b 43 04             	mov    0x4(%ebx),%eax
+ a50:	83 f8 02             	cmp    $0x2,%eax
+ a53:	74 1a                	je     a6f <fputc+0x4f>
+ a55:	83 f8 01             	cmp    $0x1,%eax
+ a58:	74 0e                	je     a68 <fputc+0x48>
+}
+ a5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a5d:	0f b6 c2             	movzbl %dl,%eax
+}
+ a60:	c9                   	leave
+ a61:	c3                   	ret
+ a62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a68:	8b 43 0c             	mov    0xc(%ebx),%eax
+ a6b:	85 c0                	test   %eax,%eax
+ a6d:	74 eb                	je     a5a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a6f:	85 c9                	test   %ecx,%ecx
+ a71:	7f 4d                	jg     ac0 <fputc+0xa0>
+  f->n = 0;
+ a73:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a7a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a84:	0f b6 c2             	movzbl %dl,%eax
+}
+ a87:	c9                   	leave
+ a88:	c3                   	ret
+ a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	8d 43 10             	lea    0x10(%ebx),%eax
+ a96:	89 55 08             	mov    %edx,0x8(%ebp)
+ a99:	68 00 02 00 00       	push   $0x200
+ a9e:	50                   	push   %eax
+ a9f:	ff 33                	push   (%ebx)
+ aa1:	e8 50 f8 ff ff       	call   2f6 <write>
+  return r;
+ aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+ aa9:	83 c4 10             	add    $0x10,%esp
+ aac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ ab1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ ab8:	31 c0                	xor    %eax,%eax
+ aba:	e9 7b ff ff ff       	jmp    a3a <fputc+0x1a>
+ abf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	8d 43 10             	lea    0x10(%ebx),%eax
+ ac6:	89 55 08             	mov    %edx,0x8(%ebp)
+ ac9:	51                   	push   %ecx
+ aca:	50                   	push   %eax
+ acb:	ff 33                	push   (%ebx)
+ acd:	e8 24 f8 ff ff       	call   2f6 <write>
+  f->n = 0;
+ ad2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ ad9:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ adc:	83 c4 10             	add    $0x10,%esp
+ adf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ ae6:	eb 99                	jmp    a81 <fputc+0x61>
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+
+00000af0 <fwrite>:
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 1c             	sub    $0x1c,%esp
+ af9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ afc:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ aff:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ b02:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ b05:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ b0b:	0f 8f af 00 00 00    	jg     bc0 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ b11:	85 ff                	test   %edi,%edi
+ b13:	7e 73                	jle    b88 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b15:	8d 56 10             	lea    0x10(%esi),%edx
+ b18:	8b 46 08             	mov    0x8(%esi),%eax
+ b1b:	31 db                	xor    %ebx,%ebx
+ b1d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ b20:	eb 25                	jmp    b47 <fwrite+0x57>
+ b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ b28:	89 c1                	mov    %eax,%ecx
+ b2a:	83 c0 01             	add    $0x1,%eax
+ b2d:	89 46 08             	mov    %eax,0x8(%esi)
+ b30:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ b34:	80 fa 0a             	cmp    $0xa,%dl
+ b37:	75 07                	jne    b40 <fwrite+0x50>
+    f->nl = 1;
+ b39:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ b40:	83 c3 01             	add    $0x1,%ebx
+ b43:	39 df                	cmp    %ebx,%edi
+ b45:	7e 41                	jle    b88 <fwrite+0x98>
+    bputc(f, s[i]);
+ b47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b4a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ b4e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ b53:	75 d3                	jne    b28 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b55:	83 ec 04             	sub    $0x4,%esp
+ b58:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ b5b:	68 00 02 00 00       	push   $0x200
+ b60:	ff 75 e0             	push   -0x20(%ebp)
+ b63:	ff 36                	push   (%esi)
+ b65:	e8 8c f7 ff ff       	call   2f6 <write>
+  return r;
+ b6a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ b6e:	83 c4 10             	add    $0x10,%esp
+ b71:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ b73:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ b7a:	b8 01 00 00 00       	mov    $0x1,%eax
+ b7f:	eb ac                	jmp    b2d <fwrite+0x3d>
+ b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b88:	8b 46 04             	mov    0x4(%esi),%eax
+ b8b:	83 f8 02             	cmp    $0x2,%eax
+ b8e:	74 0c                	je     b9c <fwrite+0xac>
+ b90:	83 f8 01             	cmp    $0x1,%eax
+ b93:	75 1c                	jne    bb1 <fwrite+0xc1>
+ b95:	8b 46 0c             	mov    0xc(%esi),%eax
+ b98:	85 c0                	test   %eax,%eax
+ b9a:	74 15                	je     bb1 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b9c:	8b 46 08             	mov    0x8(%esi),%eax
+ b9f:	85 c0                	test   %eax,%eax
+ ba1:	7f 5d                	jg     c00 <fwrite+0x110>
+  f->n = 0;
+ ba3:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ baa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ bb1:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bb7:	5b                   	pop    %ebx
+ bb8:	5e                   	pop    %esi
+ bb9:	5f                   	pop    %edi
+ bba:	5d                   	pop    %ebp
+ bbb:	c3                   	ret
+ bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ bc0:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ bc4:	0f 84 4b ff ff ff    	je     b15 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bca:	8b 46 08             	mov    0x8(%esi),%eax
+ bcd:	8b 16                	mov    (%esi),%edx
+ bcf:	85 c0                	test   %eax,%eax
+ bd1:	7f 45                	jg     c18 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ bd3:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ bd6:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ bdd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ be4:	57                   	push   %edi
+ be5:	ff 75 08             	push   0x8(%ebp)
+ be8:	ff 36                	push   (%esi)
+ bea:	e8 07 f7 ff ff       	call   2f6 <write>
+    return size > 0 ? i / size : 0;
+ bef:	83 c4 10             	add    $0x10,%esp
+ bf2:	85 c0                	test   %eax,%eax
+ bf4:	78 4a                	js     c40 <fwrite+0x150>
+ bf6:	85 db                	test   %ebx,%ebx
+ bf8:	7e 46                	jle    c40 <fwrite+0x150>
+ bfa:	99                   	cltd
+ bfb:	f7 fb                	idiv   %ebx
+ bfd:	eb b5                	jmp    bb4 <fwrite+0xc4>
+ bff:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c00:	83 ec 04             	sub    $0x4,%esp
+ c03:	50                   	push   %eax
+ c04:	8d 46 10             	lea    0x10(%esi),%eax
+ c07:	50                   	push   %eax
+ c08:	ff 36                	push   (%esi)
+ c0a:	e8 e7 f6 ff ff       	call   2f6 <write>
+ c0f:	83 c4 10             	add    $0x10,%esp
+ c12:	eb 8f                	jmp    ba3 <fwrite+0xb3>
+ c14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c18:	83 ec 04             	sub    $0x4,%esp
+ c1b:	50                   	push   %eax
+ c1c:	8d 46 10             	lea    0x10(%esi),%eax
+ c1f:	50                   	push   %eax
+ c20:	52                   	push   %edx
+ c21:	e8 d0 f6 ff ff       	call   2f6 <write>
+ c26:	83 c4 10             	add    $0x10,%esp
+ c29:	3b 46 08             	cmp    0x8(%esi),%eax
+ c2c:	74 a5                	je     bd3 <fwrite+0xe3>
+  f->n = 0;
+ c2e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c35:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ c40:	31 c0                	xor    %eax,%eax
+ c42:	e9 6d ff ff ff       	jmp    bb4 <fwrite+0xc4>
+ c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c54:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c57:	83 ec 04             	sub    $0x4,%esp
+ c5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c60:	89 d8                	mov    %ebx,%eax
+ c62:	e8 39 f9 ff ff       	call   5a0 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c67:	8b 43 04             	mov    0x4(%ebx),%eax
+ c6a:	83 f8 02             	cmp    $0x2,%eax
+ c6d:	74 18                	je     c87 <fprintf+0x37>
+ c6f:	83 f8 01             	cmp    $0x1,%eax
+ c72:	74 0c                	je     c80 <fprintf+0x30>
+  settle(f);
+}
+ c74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c77:	c9                   	leave
+ c78:	c3                   	ret
+ c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c80:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c83:	85 c0                	test   %eax,%eax
+ c85:	74 ed                	je     c74 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c87:	8b 43 08             	mov    0x8(%ebx),%eax
+ c8a:	85 c0                	test   %eax,%eax
+ c8c:	7f 1a                	jg     ca8 <fprintf+0x58>
+  f->n = 0;
+ c8e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ c95:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ c9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c9f:	c9                   	leave
+ ca0:	c3                   	ret
+ ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ ca8:	83 ec 04             	sub    $0x4,%esp
+ cab:	50                   	push   %eax
+ cac:	8d 43 10             	lea    0x10(%ebx),%eax
+ caf:	50                   	push   %eax
+ cb0:	ff 33                	push   (%ebx)
+ cb2:	e8 3f f6 ff ff       	call   2f6 <write>
+  f->n = 0;
+ cb7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ cbe:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ cc1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ cc8:	eb d2                	jmp    c9c <fprintf+0x4c>
+ cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cd0 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	53                   	push   %ebx
+ cd4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ cda:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ cdd:	83 f8 0f             	cmp    $0xf,%eax
+ ce0:	77 4e                	ja     d30 <printf+0x60>
+ ce2:	8b 1c 85 60 14 00 00 	mov    0x1460(,%eax,4),%ebx
+ ce9:	85 db                	test   %ebx,%ebx
+ ceb:	74 43                	je     d30 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ ced:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cf0:	89 d8                	mov    %ebx,%eax
+ cf2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ cf5:	e8 a6 f8 ff ff       	call   5a0 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ cfa:	8b 43 08             	mov    0x8(%ebx),%eax
+ cfd:	85 c0                	test   %eax,%eax
+ cff:	7e 12                	jle    d13 <printf+0x43>
+ d01:	83 ec 04             	sub    $0x4,%esp
+ d04:	50                   	push   %eax
+ d05:	8d 43 10             	lea    0x10(%ebx),%eax
+ d08:	50                   	push   %eax
+ d09:	ff 33                	push   (%ebx)
+ d0b:	e8 e6 f5 ff ff       	call   2f6 <write>
+ d10:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ d13:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d1a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ d21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d24:	c9                   	leave
+ d25:	c3                   	ret
+ d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ d30:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ d36:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ d3c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ d43:	00 00 00 
+    f->n = 0;
+ d46:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ d4d:	00 00 00 
+    f->nl = 0;
+ d50:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ d57:	00 00 00 
+ d5a:	eb 91                	jmp    ced <printf+0x1d>
+ d5c:	66 90                	xchg   %ax,%ax
+ d5e:	66 90                	xchg   %ax,%ax
+
+00000d60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d61:	a1 a0 14 00 00       	mov    0x14a0,%eax
+{
+ d66:	89 e5                	mov    %esp,%ebp
+ d68:	57                   	push   %edi
+ d69:	56                   	push   %esi
+ d6a:	53                   	push   %ebx
+ d6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d7c:	39 ca                	cmp    %ecx,%edx
+ d7e:	73 30                	jae    db0 <free+0x50>
+ d80:	39 c1                	cmp    %eax,%ecx
+ d82:	72 04                	jb     d88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d84:	39 c2                	cmp    %eax,%edx
+ d86:	72 f0                	jb     d78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d8e:	39 f8                	cmp    %edi,%eax
+ d90:	74 2e                	je     dc0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d95:	8b 42 04             	mov    0x4(%edx),%eax
+ d98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d9b:	39 f1                	cmp    %esi,%ecx
+ d9d:	74 38                	je     dd7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ da1:	5b                   	pop    %ebx
+  freep = p;
+ da2:	89 15 a0 14 00 00    	mov    %edx,0x14a0
+}
+ da8:	5e                   	pop    %esi
+ da9:	5f                   	pop    %edi
+ daa:	5d                   	pop    %ebp
+ dab:	c3                   	ret
+ dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ db0:	39 c1                	cmp    %eax,%ecx
+ db2:	72 d0                	jb     d84 <free+0x24>
+ db4:	eb c2                	jmp    d78 <free+0x18>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ dc0:	03 70 04             	add    0x4(%eax),%esi
+ dc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ dc6:	8b 02                	mov    (%edx),%eax
+ dc8:	8b 00                	mov    (%eax),%eax
+ dca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dcd:	8b 42 04             	mov    0x4(%edx),%eax
+ dd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dd3:	39 f1                	cmp    %esi,%ecx
+ dd5:	75 c8                	jne    d9f <free+0x3f>
+    p->s.size += bp->s.size;
+ dd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dda:	89 15 a0 14 00 00    	mov    %edx,0x14a0
+    p->s.size += bp->s.size;
+ de0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ de3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ de6:	89 0a                	mov    %ecx,(%edx)
+}
+ de8:	5b                   	pop    %ebx
+ de9:	5e                   	pop    %esi
+ dea:	5f                   	pop    %edi
+ deb:	5d                   	pop    %ebp
+ dec:	c3                   	ret
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	57                   	push   %edi
+ df4:	56                   	push   %esi
+ df5:	53                   	push   %ebx
+ df6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ df9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dfc:	8b 15 a0 14 00 00    	mov    0x14a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e02:	8d 78 07             	lea    0x7(%eax),%edi
+ e05:	c1 ef 03             	shr    $0x3,%edi
+ e08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e0b:	85 d2                	test   %edx,%edx
+ e0d:	0f 84 8d 00 00 00    	je     ea0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e15:	8b 48 04             	mov    0x4(%eax),%ecx
+ e18:	39 f9                	cmp    %edi,%ecx
+ e1a:	73 64                	jae    e80 <malloc+0x90>
+  if(nu < 4096)
+ e1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e21:	39 df                	cmp    %ebx,%edi
+ e23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e2d:	eb 0a                	jmp    e39 <malloc+0x49>
+ e2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e32:	8b 48 04             	mov    0x4(%eax),%ecx
+ e35:	39 f9                	cmp    %edi,%ecx
+ e37:	73 47                	jae    e80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e39:	89 c2                	mov    %eax,%edx
+ e3b:	39 05 a0 14 00 00    	cmp    %eax,0x14a0
+ e41:	75 ed                	jne    e30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e43:	83 ec 0c             	sub    $0xc,%esp
+ e46:	56                   	push   %esi
+ e47:	e8 12 f5 ff ff       	call   35e <sbrk>
+  if(p == (char*)-1)
+ e4c:	83 c4 10             	add    $0x10,%esp
+ e4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e52:	74 1c                	je     e70 <malloc+0x80>
+  hp->s.size = nu;
+ e54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e57:	83 ec 0c             	sub    $0xc,%esp
+ e5a:	83 c0 08             	add    $0x8,%eax
+ e5d:	50                   	push   %eax
+ e5e:	e8 fd fe ff ff       	call   d60 <free>
+  return freep;
+ e63:	8b 15 a0 14 00 00    	mov    0x14a0,%edx
+      if((p = morecore(nunits)) == 0)
+ e69:	83 c4 10             	add    $0x10,%esp
+ e6c:	85 d2                	test   %edx,%edx
+ e6e:	75 c0                	jne    e30 <malloc+0x40>
+        return 0;
+  }
+}
+ e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e73:	31 c0                	xor    %eax,%eax
+}
+ e75:	5b                   	pop    %ebx
+ e76:	5e                   	pop    %esi
+ e77:	5f                   	pop    %edi
+ e78:	5d                   	pop    %ebp
+ e79:	c3                   	ret
+ e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e80:	39 cf                	cmp    %ecx,%edi
+ e82:	74 4c                	je     ed0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e84:	29 f9                	sub    %edi,%ecx
+ e86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e8f:	89 15 a0 14 00 00    	mov    %edx,0x14a0
+}
+ e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e98:	83 c0 08             	add    $0x8,%eax
+}
+ e9b:	5b                   	pop    %ebx
+ e9c:	5e                   	pop    %esi
+ e9d:	5f                   	pop    %edi
+ e9e:	5d                   	pop    %ebp
+ e9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ea0:	c7 05 a0 14 00 00 a4 	movl   $0x14a4,0x14a0
+ ea7:	14 00 00 
+    base.s.size = 0;
+ eaa:	b8 a4 14 00 00       	mov    $0x14a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ eaf:	c7 05 a4 14 00 00 a4 	movl   $0x14a4,0x14a4
+ eb6:	14 00 00 
+    base.s.size = 0;
+ eb9:	c7 05 a8 14 00 00 00 	movl   $0x0,0x14a8
+ ec0:	00 00 00 
+    if(p->s.size >= nunits){
+ ec3:	e9 54 ff ff ff       	jmp    e1c <malloc+0x2c>
+ ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ed0:	8b 08                	mov    (%eax),%ecx
+ ed2:	89 0a                	mov    %ecx,(%edx)
+ ed4:	eb b9                	jmp    e8f <malloc+0x9f>
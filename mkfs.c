@@ -22,7 +22,7 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog = LOGBLOCKS;
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -31,6 +31,8 @@ struct superblock sb;
 char zeroes[BSIZE];
 uint freeinode = 1;
 uint freeblock;
+struct dirent rootde[NINODES+2];  // root directory entries
+int nrootde;
 
 
 void balloc(int);
@@ -40,6 +42,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void wdir(uint inum, struct dirent *de, int n);
 
 // convert to intel byte order
 ushort
@@ -68,10 +71,9 @@ int
 main(int argc, char *argv[])
 {
   int i, cc, fd;
-  uint rootino, inum, off;
+  uint rootino, inum;
   struct dirent de;
   char buf[BSIZE];
-  struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
@@ -120,12 +122,12 @@ main(int argc, char *argv[])
   bzero(&de, sizeof(de));
   de.inum = xshort(rootino);
   strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
+  rootde[nrootde++] = de;
 
   bzero(&de, sizeof(de));
   de.inum = xshort(rootino);
   strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  rootde[nrootde++] = de;
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -147,7 +149,7 @@ main(int argc, char *argv[])
     bzero(&de, sizeof(de));
     de.inum = xshort(inum);
     strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    rootde[nrootde++] = de;
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +157,7 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  wdir(rootino, rootde, nrootde);
 
   balloc(freeblock);
 
@@ -260,7 +257,7 @@ iappend(uint inum, void *xp, int n)
   struct dinode din;
   char buf[BSIZE];
   uint indirect[NINDIRECT];
-  uint x;
+  uint x, y, i;
 
   rinode(inum, &din);
   off = xint(din.size);
@@ -273,7 +270,7 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
         din.addrs[NDIRECT] = xint(freeblock++);
       }
@@ -283,6 +280,24 @@ iappend(uint inum, void *xp, int n)
         wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
       }
       x = xint(indirect[fbn-NDIRECT]);
+    } else {
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(freeblock++);
+      }
+      rsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+      i = (fbn - NDIRECT - NINDIRECT) / NINDIRECT;
+      if(indirect[i] == 0){
+        indirect[i] = xint(freeblock++);
+        wsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+      }
+      y = xint(indirect[i]);
+      rsect(y, (char*)indirect);
+      i = (fbn - NDIRECT - NINDIRECT) % NINDIRECT;
+      if(indirect[i] == 0){
+        indirect[i] = xint(freeblock++);
+        wsect(y, (char*)indirect);
+      }
+      x = xint(indirect[i]);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -295,3 +310,64 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Write the n entries de[] of directory inum, starting with
+// "." and "..". A directory that does not fit in one block is
+// written in indexed form, with leaves sorted by name hash
+// and filled 3/4 full.
+void
+wdir(uint inum, struct dirent *de, int n)
+{
+  char buf[BSIZE], lbuf[BSIZE];
+  struct dirent t;
+  struct dxroot *r;
+  struct dinode din;
+  int i, j, nleaf, per;
+  uint off;
+
+  if(n*sizeof(*de) <= BSIZE){
+    for(i = 0; i < n; i++)
+      iappend(inum, &de[i], sizeof(de[i]));
+
+    // fix size of directory inode
+    rinode(inum, &din);
+    off = xint(din.size);
+    off = ((off/BSIZE) + 1) * BSIZE;
+    din.size = xint(off);
+    winode(inum, &din);
+    return;
+  }
+
+  for(i = 3; i < n; i++){
+    t = de[i];
+    for(j = i; j > 2 && dxhash(de[j-1].name) > dxhash(t.name); j--)
+      de[j] = de[j-1];
+    de[j] = t;
+  }
+
+  bzero(buf, sizeof(buf));
+  memmove(buf, de, 2*sizeof(*de));
+  r = (struct dxroot*)(buf + 2*sizeof(*de));
+  r->h.magic = xshort(DXMAGIC);
+  r->nentries = xint(n-2);
+  iappend(inum, buf, BSIZE);  // rewritten below
+
+  per = BSIZE/sizeof(*de) * 3/4;
+  nleaf = 0;
+  for(i = 2; i < n; ){
+    assert(nleaf < DXROOTENT);
+    r->ent[nleaf].lblk = xshort(nleaf+1);
+    r->ent[nleaf].hash = xint(nleaf ? dxhash(de[i].name) : 0);
+    nleaf++;
+    bzero(lbuf, sizeof(lbuf));
+    // keep entries with equal hashes in the same leaf
+    for(j = 0; i < n && (j < per || dxhash(de[i].name) == dxhash(de[i-1].name)); i++, j++){
+      assert(j < BSIZE/sizeof(*de));
+      memmove(lbuf + j*sizeof(*de), &de[i], sizeof(*de));
+    }
+    iappend(inum, lbuf, BSIZE);
+  }
+  r->h.count = xshort(nleaf);
+  rinode(inum, &din);
+  wsect(xint(din.addrs[0]), buf);
+}
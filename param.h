@@ -4,11 +4,18 @@
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
+#define NDENTRY     128  // size of directory name cache
+#define NPCACHE      64  // file pages cached for zero-copy reads
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define MAXOPBLOCKS  16  // log blocks reserved by a metadata FS op
+#define LOGSIZE      120  // max data blocks in one log transaction
+#define LOGBLOCKS    (LOGSIZE*3+1)  // size of on-disk log, including head block
+#define NBUF         (LOGBLOCKS+MAXOPBLOCKS*3)  // size of disk block cache
+#define FSSIZE       20000  // size of file system in blocks
+#define HZ           100  // clock ticks per second
+#define TICKNS (1000000000/HZ)  // nanoseconds per clock tick
+#define RTSLICE      10  // ticks a SCHED_RT process runs before its peers
+#define FAIRSLICE     3  // ticks a SCHED_FAIR process runs before preemption
 
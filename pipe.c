@@ -7,16 +7,34 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
 
-#define PIPESIZE 512
+#define PIPESIZE PGSIZE
+#define PIPEWAKE (PIPESIZE/4)  // free space that wakes a waiting writer
 
+// Bytes are copied in and out of the ring with memmove,
+// a contiguous span at a time. A side only calls wakeup()
+// if the other side is waiting, and a reader only wakes a
+// waiting writer once there is PIPEWAKE bytes of room.
+//
+// Only the writer advances nwrite and only the reader
+// advances nread, so a side whose file is not shared
+// (one writer, or one reader) need not hold p->lock to
+// copy: it publishes its data or its room by advancing
+// its counter with a locked add, which is a full barrier.
+// p->lock is still taken to sleep and to wake; a side
+// that sleeps sets its wait flag before re-checking the
+// counters, and a side that advanced its counter looks
+// at the other's flag after, so no wakeup is lost.
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *data;     // ring of PIPESIZE bytes, in its own page
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int rwait;      // a reader is waiting for data
+  int wwait;      // a writer is waiting for room
 };
 
 int
@@ -30,10 +48,14 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  if((p->data = kalloc()) == 0)
+    goto bad;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
+  p->rwait = 0;
+  p->wwait = 0;
   initlock(&p->lock, "pipe");
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
@@ -47,8 +69,11 @@ pipealloc(struct file **f0, struct file **f1)
 
 //PAGEBREAK: 20
  bad:
-  if(p)
+  if(p){
+    if(p->data)
+      kfree(p->data);
     kfree((char*)p);
+  }
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -69,53 +94,145 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    kfree(p->data);
     kfree((char*)p);
   } else
     release(&p->lock);
 }
 
+// If *wait says the other side sleeps on chan, wake it.
+// The caller holds p->lock unless alone.
+static void
+pipewake(struct pipe *p, int *wait, void *chan, int alone)
+{
+  if(*wait == 0)
+    return;
+  if(alone)
+    acquire(&p->lock);
+  if(*wait){
+    *wait = 0;
+    wakeup(chan);
+  }
+  if(alone)
+    release(&p->lock);
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  struct iovec iov;
 
-  acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
-      if(p->readopen == 0 || myproc()->killed){
-        release(&p->lock);
-        return -1;
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return pipewritev(p, &iov, 1, 0);
+}
+
+// Write the cnt segments of iov to the pipe, without
+// letting other writers interleave between segments
+// unless the pipe fills up. alone says the caller is
+// the only writer, so it can copy without p->lock.
+int
+pipewritev(struct pipe *p, struct iovec *iov, int cnt, int alone)
+{
+  int s, n, m, tot;
+  char *addr;
+
+  tot = 0;
+  if(!alone)
+    acquire(&p->lock);
+  for(s = 0; s < cnt; s++){
+    addr = iov[s].iov_base;
+    for(n = iov[s].iov_len; n > 0; n -= m, addr += m){
+      while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+        if(alone)
+          acquire(&p->lock);
+        pipewake(p, &p->rwait, &p->nread, 0);
+        p->wwait = 1;
+        __sync_synchronize();
+        if(p->nwrite == p->nread + PIPESIZE){
+          if(p->readopen == 0 || myproc()->killed){
+            release(&p->lock);
+            return -1;
+          }
+          sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+        }
+        if(alone)
+          release(&p->lock);
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      // Copy as much as fits before the end of the ring.
+      m = PIPESIZE - (p->nwrite - p->nread);
+      if(m > PIPESIZE - p->nwrite % PIPESIZE)
+        m = PIPESIZE - p->nwrite % PIPESIZE;
+      if(m > n)
+        m = n;
+      memmove(p->data + p->nwrite % PIPESIZE, addr, m);
+      __sync_fetch_and_add(&p->nwrite, m);
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    tot += iov[s].iov_len;
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
-  release(&p->lock);
-  return n;
+  pipewake(p, &p->rwait, &p->nread, alone);  //DOC: pipewrite-wakeup1
+  if(!alone)
+    release(&p->lock);
+  return tot;
 }
 
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  struct iovec iov;
 
-  acquire(&p->lock);
-  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
-    if(myproc()->killed){
-      release(&p->lock);
-      return -1;
+  iov.iov_base = addr;
+  iov.iov_len = n;
+  return pipereadv(p, &iov, 1, 0);
+}
+
+// Read into the cnt segments of iov whatever the pipe
+// holds, waiting only until it holds something. alone
+// says the caller is the only reader, so it can copy
+// without p->lock.
+int
+pipereadv(struct pipe *p, struct iovec *iov, int cnt, int alone)
+{
+  int s, n, m, tot;
+  char *addr;
+
+  if(!alone)
+    acquire(&p->lock);
+  while(p->nread == p->nwrite){  //DOC: pipe-empty
+    if(alone)
+      acquire(&p->lock);
+    p->rwait = 1;
+    __sync_synchronize();
+    if(p->nread == p->nwrite){
+      if(p->writeopen == 0 || myproc()->killed){
+        tot = p->writeopen ? -1 : 0;
+        release(&p->lock);
+        return tot;
+      }
+      sleep(&p->nread, &p->lock); //DOC: piperead-sleep
     }
-    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+    if(alone)
+      release(&p->lock);
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  tot = 0;
+  for(s = 0; s < cnt && p->nread != p->nwrite; s++){
+    addr = iov[s].iov_base;
+    for(n = iov[s].iov_len; n > 0 && p->nread != p->nwrite; n -= m, addr += m){  //DOC: piperead-copy
+      // Copy as much as is there before the end of the ring.
+      m = p->nwrite - p->nread;
+      if(m > PIPESIZE - p->nread % PIPESIZE)
+        m = PIPESIZE - p->nread % PIPESIZE;
+      if(m > n)
+        m = n;
+      memmove(addr, p->data + p->nread % PIPESIZE, m);
+      __sync_fetch_and_add(&p->nread, m);
+      tot += m;
+    }
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
-  release(&p->lock);
-  return i;
+  if(PIPESIZE - (p->nwrite - p->nread) >= PIPEWAKE)
+    pipewake(p, &p->wwait, &p->nwrite, alone);  //DOC: piperead-wakeup
+  if(!alone)
+    release(&p->lock);
+  return tot;
 }
@@ -1,15 +1,163 @@
 #include "types.h"
 #include "stat.h"
+#include "param.h"
 #include "user.h"
 
+// Buffered output streams.
+//
+// A stream collects output for a file descriptor in a buffer
+// and writes it with one write() when the buffer fills, when
+// the stream is flushed, and also at the end of each line for
+// a line-buffered stream or of each call for an unbuffered one.
+// There is at most one stream per descriptor, so fprintf() and
+// printf() output to the same descriptor stay in order.
+// exit() flushes all streams.
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    if(streams[fd])
+      fflush(streams[fd]);
+}
+
+// Return the stream for fd, creating it if needed.
+// Streams for devices such as the console are line
+// buffered, others fully buffered.
+FILE*
+fdopen(int fd)
+{
+  FILE *f;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  if(streams[fd])
+    return streams[fd];
+  if((f = malloc(sizeof(*f))) == 0)
+    return 0;
+  f->fd = fd;
+  f->n = 0;
+  f->nl = 0;
+  f->mode = _IOFBF;
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    f->mode = _IOLBF;
+  streams[fd] = f;
+  exithook = flushall;
+  return f;
+}
+
+// Open a file for buffered output. omode is as for open().
+FILE*
+fopen(const char *path, int omode)
+{
+  int fd;
+
+  if((fd = open(path, omode)) < 0)
+    return 0;
+  if(streams[fd]){
+    // Left over from a descriptor closed without fclose().
+    free(streams[fd]);
+    streams[fd] = 0;
+  }
+  return fdopen(fd);
+}
+
+// Set the buffering mode of f: _IOFBF, _IOLBF or _IONBF.
+int
+setvbuf(FILE *f, int mode)
+{
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+    return -1;
+  fflush(f);
+  f->mode = mode;
+  return 0;
+}
+
+// Write out what f has buffered.
+int
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    r = -1;
+  f->n = 0;
+  f->nl = 0;
+  return r;
+}
+
+int
+fclose(FILE *f)
+{
+  int r;
+
+  r = fflush(f);
+  if(close(f->fd) < 0)
+    r = -1;
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+    streams[f->fd] = 0;
+    free(f);
+  }
+  return r;
+}
+
+// Add c to f's buffer, writing the buffer out if it is full.
 static void
-putc(int fd, char c)
+bputc(FILE *f, char c)
+{
+  if(f->n == BUFSIZ)
+    fflush(f);
+  f->buf[f->n++] = c;
+  if(c == '\n')
+    f->nl = 1;
+}
+
+// Apply f's buffering mode at the end of an output call.
+static void
+settle(FILE *f)
+{
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    fflush(f);
+}
+
+int
+fputc(int c, FILE *f)
 {
-  write(fd, &c, 1);
+  bputc(f, c);
+  settle(f);
+  return c & 0xff;
+}
+
+// Write n items of size bytes from p to f.
+// Returns the number of items written.
+int
+fwrite(const void *p, int size, int n, FILE *f)
+{
+  const char *s;
+  int i, len;
+
+  s = p;
+  len = size * n;
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    // Too big to be worth copying.
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+      return 0;
+    return size > 0 ? i / size : 0;
+  }
+  for(i = 0; i < len; i++)
+    bputc(f, s[i]);
+  settle(f);
+  return n;
 }
 
 static void
-printint(int fd, int xx, int base, int sgn)
+printint(FILE *f, int xx, int base, int sgn)
 {
   static char digits[] = "0123456789ABCDEF";
   char buf[16];
@@ -32,33 +180,31 @@ printint(int fd, int xx, int base, int sgn)
     buf[i++] = '-';
 
   while(--i >= 0)
-    putc(fd, buf[i]);
+    bputc(f, buf[i]);
 }
 
-// Print to the given fd. Only understands %d, %x, %p, %s.
-void
-printf(int fd, const char *fmt, ...)
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
 {
   char *s;
   int c, i, state;
-  uint *ap;
 
   state = 0;
-  ap = (uint*)(void*)&fmt + 1;
   for(i = 0; fmt[i]; i++){
     c = fmt[i] & 0xff;
     if(state == 0){
       if(c == '%'){
         state = '%';
       } else {
-        putc(fd, c);
+        bputc(f, c);
       }
     } else if(state == '%'){
       if(c == 'd'){
-        printint(fd, *ap, 10, 1);
+        printint(f, *ap, 10, 1);
         ap++;
       } else if(c == 'x' || c == 'p'){
-        printint(fd, *ap, 16, 0);
+        printint(f, *ap, 16, 0);
         ap++;
       } else if(c == 's'){
         s = (char*)*ap;
@@ -66,20 +212,49 @@ printf(int fd, const char *fmt, ...)
         if(s == 0)
           s = "(null)";
         while(*s != 0){
-          putc(fd, *s);
+          bputc(f, *s);
           s++;
         }
       } else if(c == 'c'){
-        putc(fd, *ap);
+        bputc(f, *ap);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        bputc(f, c);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        bputc(f, '%');
+        bputc(f, c);
       }
       state = 0;
     }
   }
 }
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+  settle(f);
+}
+
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+    f = streams[fd];
+  else {
+    f = &tmp;
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+  fflush(f);
+}
@@ -6,24 +6,75 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
+#include "sched.h"
+#include "fs.h"
+#include "sleeplock.h"
+#include "file.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+#define NNICE (NICEMAX-NICEMIN+1)
+
+// RUNNABLE processes wait on the run queue. SCHED_RT ones
+// wait on a list per priority, with a bitmap of the lists
+// that are not empty, and run first, in priority order.
+// SCHED_FAIR ones wait on a min-heap ordered by virtual
+// runtime: the time a process has run, scaled down by its
+// weight, so that the one that has had least of its share
+// of the CPU runs next.
+struct {
+  struct spinlock lock;
+  int n;                          // processes queued
+  uint rtmap;                     // bit i set if rt[i] is not empty
+  struct proc *rt[NRTPRIO];
+  struct proc *rttail[NRTPRIO];
+  struct proc *fair[NPROC];       // heap of SCHED_FAIR processes
+  int nfair;
+  uint64 minvr;                   // low water mark of vruntime
+} runq;
+
+// Relative CPU share of each nice value; each step is ~10%.
+static int niceweight[NNICE] = {
+  88761, 71755, 56483, 46273, 36291,
+  29154, 23254, 18705, 14949, 11916,
+  9548, 7620, 6100, 4904, 3906,
+  3121, 2501, 1991, 1586, 1277,
+  1024, 820, 655, 526, 423,
+  335, 272, 215, 172, 137,
+  110, 87, 70, 56, 45,
+  36, 29, 23, 18, 15,
+};
+
+#define FAIRGRAN  (TICKNS/2)     // vruntime lead that lets a wakeup preempt
+#define SLEEPCREDIT (3*TICKNS)   // vruntime a waking sleeper may lag
+
 static struct proc *initproc;
+static int usemwait;  // idle with MONITOR/MWAIT rather than HLT
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void idle(struct cpu*);
+static void ready(struct proc*);
+static int procread(struct inode*, char*, uint, int);
+static void ruadd(struct rusage*, struct rusage*);
 
 void
 pinit(void)
 {
+  uint a, b, c, d;
+
   initlock(&ptable.lock, "ptable");
+  initlock(&runq.lock, "runq");
+  cpuinfo(1, &a, &b, &c, &d);
+  usemwait = (c & (1<<3)) != 0;
+  devsw[PROCSTAT].read = procread;
 }
 
 // Must be called with interrupts disabled
@@ -132,6 +183,16 @@ allocproc(void)
   p->block_user_signals = 0;
   p->suspend = 0;
 
+  p->policy = SCHED_FAIR;
+  p->rtprio = 0;
+  p->nice = 0;
+  p->vruntime = 0;
+  p->affinity = ~0;
+  p->cpu = 0;
+  memset(&p->ru, 0, sizeof(p->ru));
+  memset(&p->cru, 0, sizeof(p->cru));
+  p->onrq = 0;
+
   return p;
 }
 
@@ -170,9 +231,38 @@ userinit(void)
   pushcli();
   if (!cas(&p->state, EMBRYO, RUNNABLE))
     panic("userinit: cas failed");
+  ready(p);
   popcli();
 }
 
+// Create a kernel thread that runs fn(), which must never return.
+// Kernel threads have no user memory, no parent and ignore signals.
+struct proc*
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread: no procs");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread: out of memory?");
+  p->sz = 0;
+  p->parent = 0;
+  p->signalMask = ~0;
+  for(int i=0; i<32; i++)
+    p->signalHandlers[i].sa_handler = (void*)SIG_IGN;
+  // forkret() returns into fn instead of trapret.
+  *((uint*)p->tf - 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  pushcli();
+  if (!cas(&p->state, EMBRYO, RUNNABLE))
+    panic("kthread: cas failed");
+  ready(p);
+  popcli();
+  return p;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -238,9 +328,18 @@ fork(void)
   np->cwd = idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->policy = curproc->policy;
+  np->rtprio = curproc->rtprio;
+  np->nice = curproc->nice;
+  acquire(&runq.lock);  // minvr is 64 bits: two loads
+  np->vruntime = runq.minvr;  // no credit for being new
+  release(&runq.lock);
+  np->affinity = curproc->affinity;
+  np->cpu = curproc->cpu;
   pid = np->pid;
   if(!cas(&np->state, EMBRYO, RUNNABLE))
     panic("fork: cas failed");
+  ready(np);
 
   return pid;
 }
@@ -266,7 +365,7 @@ exit(void)
     }
   }
 
-  begin_op();
+  begin_op(MAXOPBLOCKS);
   iput(curproc->cwd);
   end_op();
   curproc->cwd = 0;
@@ -301,6 +400,9 @@ wait(void)
   
   pushcli();
   for(;;){
+    // Set chan before scanning, so that a child that becomes
+    // a ZOMBIE after the scan sees us in wakeup1.
+    curproc->chan = (void*)curproc;
     if (!cas(&(curproc->state), RUNNING,-SLEEPING))
         panic("wait: cas failed");
 
@@ -313,6 +415,8 @@ wait(void)
       if(cas(&p->state,ZOMBIE, ZOMBIE)){
         // Found one.
         pid = p->pid;
+        ruadd(&curproc->cru, &p->ru);
+        ruadd(&curproc->cru, &p->cru);
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
@@ -344,13 +448,486 @@ wait(void)
       return -1;
     }
     //curproc sleeps on its own address
-    curproc->chan = (void*)curproc;
     sched();
     curproc->chan = 0;
     // Wait for children to exit.  (See wakeup1 call in proc_exit.)
   }
 }
 
+static void
+qpush(struct proc **head, struct proc **tail, struct proc *p)
+{
+  p->rqnext = 0;
+  if(*head)
+    (*tail)->rqnext = p;
+  else
+    *head = p;
+  *tail = p;
+}
+
+// Take p off the list at head, if it is there.
+static int
+qremove(struct proc **head, struct proc **tail, struct proc *p)
+{
+  struct proc **pp, *prev;
+
+  prev = 0;
+  for(pp = head; *pp; pp = &(*pp)->rqnext){
+    if(*pp == p){
+      *pp = p->rqnext;
+      if(*tail == p)
+        *tail = prev;
+      return 1;
+    }
+    prev = *pp;
+  }
+  return 0;
+}
+
+//PAGEBREAK!
+static void
+heapset(int i, struct proc *p)
+{
+  runq.fair[i] = p;
+  p->rqidx = i;
+}
+
+// Move the process at i up the heap to where it belongs.
+static void
+siftup(int i)
+{
+  struct proc *p;
+
+  p = runq.fair[i];
+  while(i > 0 && p->vruntime < runq.fair[(i-1)/2]->vruntime){
+    heapset(i, runq.fair[(i-1)/2]);
+    i = (i-1)/2;
+  }
+  heapset(i, p);
+}
+
+// Move the process at i down the heap to where it belongs.
+static void
+siftdown(int i)
+{
+  struct proc *p;
+  int j;
+
+  p = runq.fair[i];
+  for(;;){
+    j = 2*i + 1;
+    if(j >= runq.nfair)
+      break;
+    if(j+1 < runq.nfair && runq.fair[j+1]->vruntime < runq.fair[j]->vruntime)
+      j++;
+    if(p->vruntime <= runq.fair[j]->vruntime)
+      break;
+    heapset(i, runq.fair[j]);
+    i = j;
+  }
+  heapset(i, p);
+}
+
+static void
+heapremove(struct proc *p)
+{
+  struct proc *q;
+
+  // Fill p's place with the last process, then let that
+  // go up or down to where it belongs.
+  q = runq.fair[--runq.nfair];
+  if(q == p)
+    return;
+  heapset(p->rqidx, q);
+  siftup(q->rqidx);
+  siftdown(q->rqidx);
+}
+
+// Charge p for the CPU time since it last was, in
+// virtual runtime if it is SCHED_FAIR.
+static void
+account(struct proc *p, uint64 now)
+{
+  uint64 d;
+
+  d = now - p->lastrun;
+  p->lastrun = now;
+  if(p->policy != SCHED_FAIR)
+    return;
+  if(d > 0xffffffff)
+    d = 0xffffffff;
+  // d * 1024 / weight, without a 64-bit divide.
+  p->vruntime += (d * (0xffffffff / niceweight[p->nice-NICEMIN])) >> 22;
+}
+
+// Put p on the run queue. Caller holds runq.lock.
+// A process that slept is let lag the others by at most
+// SLEEPCREDIT, so that it runs soon after it wakes but
+// cannot bank its sleep to take the CPU for long.
+static void
+enqueue(struct proc *p)
+{
+  if(p->policy == SCHED_RT){
+    qpush(&runq.rt[p->rtprio], &runq.rttail[p->rtprio], p);
+    runq.rtmap |= 1 << p->rtprio;
+  } else {
+    if(p->vruntime + SLEEPCREDIT < runq.minvr)
+      p->vruntime = runq.minvr - SLEEPCREDIT;
+    heapset(runq.nfair++, p);
+    siftup(p->rqidx);
+  }
+  p->onrq = 1;
+  runq.n++;
+}
+
+// Take p off the run queue. Caller holds runq.lock.
+static void
+dequeue(struct proc *p)
+{
+  int i;
+
+  if(p->policy == SCHED_RT){
+    i = p->rtprio;
+    qremove(&runq.rt[i], &runq.rttail[i], p);
+    if(runq.rt[i] == 0)
+      runq.rtmap &= ~(1 << i);
+  } else
+    heapremove(p);
+  p->onrq = 0;
+  runq.n--;
+}
+
+// The most urgent queued process that may run on CPU id.
+// Caller holds runq.lock. A SCHED_FAIR process that may
+// not run here can be at the top of the heap, in which case
+// the heap is searched, since it is at most NPROC long.
+static struct proc*
+best(int id)
+{
+  struct proc *p, *q;
+  uint m;
+  int i;
+
+  for(m = runq.rtmap; m; m &= m-1){
+    i = __builtin_ctz(m);
+    for(p = runq.rt[i]; p; p = p->rqnext)
+      if(p->affinity & (1 << id))
+        return p;
+  }
+  if(runq.nfair == 0 || (runq.fair[0]->affinity & (1 << id)))
+    return runq.nfair ? runq.fair[0] : 0;
+  p = 0;
+  for(i = 1; i < runq.nfair; i++){
+    q = runq.fair[i];
+    if((q->affinity & (1 << id)) && (p == 0 || q->vruntime < p->vruntime))
+      p = q;
+  }
+  return p;
+}
+
+// Take the next process to run on CPU id off the run queue.
+static struct proc*
+pick(int id)
+{
+  struct proc *p;
+
+  acquire(&runq.lock);
+  if((p = best(id)) != 0){
+    dequeue(p);
+    if(p->policy == SCHED_FAIR && p->vruntime > runq.minvr)
+      runq.minvr = p->vruntime;
+  }
+  release(&runq.lock);
+  return p;
+}
+
+// Is a process queued that may run on CPU id?
+static int
+waiting(int id)
+{
+  int r;
+
+  if(runq.n == 0)
+    return 0;
+  acquire(&runq.lock);
+  r = best(id) != 0;
+  release(&runq.lock);
+  return r;
+}
+
+// How urgently p wants a CPU; lower is more urgent.
+static int
+rank(struct proc *p)
+{
+  if(p == 0)
+    return NRTPRIO + 1;
+  if(p->policy == SCHED_RT)
+    return p->rtprio;
+  return NRTPRIO;
+}
+
+// Find a CPU that p, just put on the run queue, may run
+// on: wake an idle CPU, the one p last ran on if it can,
+// to keep its cache warm, or else ask the CPU running the
+// least urgent process to reschedule if p is more urgent.
+// A store to an idle CPU's kick word wakes it from MWAIT,
+// and a reschedule IPI from HLT; taking c->idle makes
+// sure that only one waker sends it an IPI.
+static void
+kick(struct proc *p)
+{
+  struct cpu *c, *me, *worst;
+  struct proc *cp, *wp;
+  int i;
+
+  pushcli();
+  me = mycpu();
+  for(i = 0; i < ncpu; i++){
+    c = &cpus[(p->cpu + i) % ncpu];
+    if(c == me || !(p->affinity & (1 << (c-cpus))) ||
+       !c->idle || !cas(&c->idle, 1, 0))
+      continue;
+    c->kick = 1;
+    if(!usemwait)
+      lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+    popcli();
+    return;
+  }
+  // Other CPUs' c->proc change under us, and go to 0 when
+  // their schedulers take back control, so read each once,
+  // through a volatile pointer so that the compiler cannot
+  // load it again.
+  worst = 0;
+  wp = 0;
+  for(c = cpus; c < cpus+ncpu; c++){
+    cp = *(struct proc * volatile *)&c->proc;
+    if((p->affinity & (1 << (c-cpus))) &&
+       (worst == 0 || rank(cp) > rank(wp))){
+      worst = c;
+      wp = cp;
+    }
+  }
+  if(worst && (rank(p) < rank(wp) ||
+     (rank(p) == NRTPRIO && rank(wp) == NRTPRIO &&
+      p->vruntime + FAIRGRAN < wp->vruntime))){
+    if(worst == me)
+      me->resched = 1;
+    else
+      lapicipi(worst->apicid, T_IRQ0 + IRQ_RESCHED);
+  }
+  popcli();
+}
+
+// Queue p, just made RUNNABLE, and find it a CPU.
+static void
+ready(struct proc *p)
+{
+  acquire(&runq.lock);
+  enqueue(p);
+  release(&runq.lock);
+  kick(p);
+}
+
+// Account a clock tick, taken in user mode if user, to the
+// process running on this CPU and to the CPU, and ask for
+// the process to be preempted once its time slice is up:
+// for SCHED_RT if another of its priority is waiting, and
+// for SCHED_FAIR if the next one waiting has run less.
+// Only processes that may run on this CPU count, and one
+// of a more urgent class preempts at once.
+void
+schedtick(int user)
+{
+  struct proc *p, *q;
+  struct cpu *c;
+  int r;
+
+  if((p = myproc()) == 0)
+    return;
+  c = mycpu();
+  if(user){
+    p->ru.ru_utime++;
+    c->ru.ru_utime++;
+  } else {
+    p->ru.ru_stime++;
+    c->ru.ru_stime++;
+  }
+  account(p, nsnow());
+  p->ticks++;
+  if(runq.n == 0)
+    return;
+  acquire(&runq.lock);
+  r = 0;
+  if((q = best(c-cpus)) != 0){
+    if(p->policy == SCHED_RT)
+      r = q->policy == SCHED_RT && (q->rtprio < p->rtprio ||
+          (q->rtprio == p->rtprio && p->ticks >= RTSLICE));
+    else
+      r = q->policy == SCHED_RT ||
+          (p->ticks >= FAIRSLICE && q->vruntime < p->vruntime);
+  }
+  release(&runq.lock);
+  if(r)
+    c->resched = 1;
+}
+
+// Give up the CPU if another process that may run on this
+// CPU is waiting for it.
+// A SCHED_FAIR process goes behind the next one waiting,
+// which it would not by yield() alone if it still has
+// the least virtual runtime.
+void
+schedyield(void)
+{
+  struct proc *p = myproc(), *q;
+
+  if(runq.n == 0)
+    return;
+  acquire(&runq.lock);
+  q = best(cpuid());
+  if(p->policy == SCHED_FAIR && q && q->policy == SCHED_FAIR &&
+     p->vruntime <= q->vruntime)
+    p->vruntime = q->vruntime + 1;
+  release(&runq.lock);
+  if(q)
+    yield();
+}
+
+// Yield if this CPU has been asked to reschedule.
+void
+preempt(void)
+{
+  struct cpu *c;
+  int r;
+
+  pushcli();
+  c = mycpu();
+  r = c->resched && c->proc && c->proc->state == RUNNING;
+  if(r)
+    c->resched = 0;
+  popcli();
+  if(r)
+    yield();
+}
+
+// Process pid, or the caller if pid is 0.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  if(pid == 0)
+    return myproc();
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->pid == pid && p->state != UNUSED && p->state != EMBRYO)
+      return p;
+  return 0;
+}
+
+// Set the scheduling class, SCHED_RT priority and nice
+// value of process pid, or of the caller if pid is 0:
+// those of them whose SCHED_SET flags are in set.
+int
+setsched(int pid, int set, int policy, int rtprio, int nice)
+{
+  struct proc *p;
+
+  if(((set & SCHED_SETPOLICY) && policy != SCHED_FAIR && policy != SCHED_RT) ||
+     ((set & SCHED_SETRTPRIO) && (rtprio < 0 || rtprio >= NRTPRIO)) ||
+     ((set & SCHED_SETNICE) && (nice < NICEMIN || nice > NICEMAX)))
+    return -1;
+  if((p = findproc(pid)) == 0)
+    return -1;
+
+  acquire(&runq.lock);
+  if(p->onrq){
+    dequeue(p);
+    p->onrq = 1;
+  }
+  if((set & SCHED_SETPOLICY) && policy != p->policy){
+    p->policy = policy;
+    p->vruntime = runq.minvr;
+  }
+  if(set & SCHED_SETRTPRIO)
+    p->rtprio = rtprio;
+  if(set & SCHED_SETNICE)
+    p->nice = nice;
+  if(p->onrq)
+    enqueue(p);
+  release(&runq.lock);
+
+  // Let the scheduler choose again, since p may now be
+  // more urgent than a running process, or less than one
+  // that is waiting.
+  if(p->onrq)
+    kick(p);
+  else if(p == myproc()){
+    pushcli();
+    mycpu()->resched = 1;
+    popcli();
+  }
+  return 0;
+}
+
+// Copy the scheduling class, SCHED_RT priority and nice
+// value of process pid, or of the caller if pid is 0, to attr.
+int
+getsched(int pid, struct sched_attr *attr)
+{
+  struct proc *p;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  attr->policy = p->policy;
+  attr->priority = p->rtprio;
+  attr->nice = p->nice;
+  return 0;
+}
+
+// Let process pid, or the caller if pid is 0, run only on
+// the CPUs whose bits are set in mask.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+  struct cpu *c;
+  int id;
+
+  if(ncpu < 32)
+    mask &= (1 << ncpu) - 1;
+  if(mask == 0 || (p = findproc(pid)) == 0)
+    return -1;
+  p->affinity = mask;
+  if(p->onrq)
+    kick(p);
+
+  // If p is running on a CPU it may no longer use,
+  // make that CPU give it up.
+  pushcli();
+  id = p->cpu;
+  c = &cpus[id];
+  if(p->state == RUNNING && c->proc == p && !(mask & (1 << id))){
+    if(c == mycpu())
+      c->resched = 1;
+    else
+      lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+  }
+  popcli();
+  return 0;
+}
+
+// The affinity mask of process pid, or of the caller if
+// pid is 0.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  return p->affinity;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -370,42 +947,77 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
+    // Take the most urgent process off the run queue.
     pushcli();
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(!cas(&p->state, RUNNABLE, RUNNING)){
-        if(cas(&p->state,ZOMBIE, ZOMBIE)){
-          wakeup1(p->parent);//****
-        }
-        continue;
-      }
-      // Switch to chosen process.
-      c->proc = p;
-      switchuvm(p);
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      if(cas(&p->state,-ZOMBIE, ZOMBIE)){
-        wakeup1(p->parent);//****
-      }
+    if((p = pick(c-cpus)) == 0){
+      idle(c);
+      popcli();
+      continue;
+    }
+    if(!cas(&p->state, RUNNABLE, RUNNING))
+      panic("scheduler: queued proc not RUNNABLE");
+
+    // Switch to chosen process.
+    timerbusy();
+    c->resched = 0;
+    c->proc = p;
+    p->cpu = c-cpus;
+    p->lastrun = nsnow();
+    p->ticks = 0;
+    switchuvm(p);
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+    // Charge p before anyone else can requeue it.
+    account(p, nsnow());
+
+    if(cas(&p->state,-ZOMBIE, ZOMBIE)){
+      wakeup1(p->parent);//****
+    }
 
-      if(cas(&p->state, -SLEEPING, SLEEPING)){
-        if(p->killed == 1){ //needs to keep runnig inorder to die
-          if(!cas(&p->state, SLEEPING,-RUNNABLE)){
-            panic("scheduler: cas failed SLEEPING to -RUNNABLE");
-          }
+    if(cas(&p->state, -SLEEPING, SLEEPING)){
+      if(p->killed == 1){ //needs to keep runnig inorder to die
+        if(!cas(&p->state, SLEEPING,-RUNNABLE)){
+          panic("scheduler: cas failed SLEEPING to -RUNNABLE");
         }
       }
-      cas(&p->state, -RUNNABLE, RUNNABLE);
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
     }
+    if(cas(&p->state, -RUNNABLE, RUNNABLE))
+      ready(p);
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
     popcli();
   }
 }
 
+// Called by the scheduler with interrupts off when it found
+// nothing to run. Stop the tick and wait for this CPU's next
+// timer or another interrupt or, with MWAIT, for kick()
+// to store to c->kick, and count the time as idle.
+static void
+idle(struct cpu *c)
+{
+  uint64 t0;
+
+  timeridle();
+  c->kick = 0;
+  xchg(&c->idle, 1);
+  if(usemwait)
+    monitor(&c->kick);
+  // A waker that saw c->idle clear queued its process
+  // before we set it, so look once more.
+  if(!waiting(c-cpus) && !c->kick){
+    t0 = nsnow();
+    if(usemwait)
+      stimwait();
+    else
+      stihlt();
+    c->idlens += nsnow() - t0;
+  }
+  c->idle = 0;
+}
+
 // Enter scheduler.  Must hold only ptable.lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
@@ -424,6 +1036,13 @@ sched(void)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
+  if(p->state == -SLEEPING){
+    p->ru.ru_nvcsw++;
+    mycpu()->ru.ru_nvcsw++;
+  } else if(p->state == -RUNNABLE){
+    p->ru.ru_nivcsw++;
+    mycpu()->ru.ru_nivcsw++;
+  }
   intena = mycpu()->intena;
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
@@ -502,20 +1121,28 @@ sleep(void *chan, struct spinlock *lk)
 }
 
 //PAGEBREAK!
+// Wake up p if it is sleeping on chan.
+// Must be called with interrupts disabled.
+static void
+wakeproc1(struct proc *p, void *chan)
+{
+  if((cas(&p->state, SLEEPING, SLEEPING) || cas(&p->state, -SLEEPING, -SLEEPING)) && p->chan == chan){
+    while(cas(&p->state, -SLEEPING, -SLEEPING)){
+      //busy-wait for -SLEEPING to become SLEEPING
+    }
+    if(cas(&p->state, SLEEPING, RUNNABLE))
+      ready(p);
+  }
+}
+
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Must be called with interrupts disabled.
 static void
 wakeup1(void *chan)
 {
   struct proc *p;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if((cas(&p->state, SLEEPING, SLEEPING) || cas(&p->state, -SLEEPING, -SLEEPING)) && p->chan == chan){
-      while(cas(&p->state, -SLEEPING, -SLEEPING)){
-        //busy-wait for -SLEEPING to become SLEEPING
-      }
-      cas(&p->state, SLEEPING, RUNNABLE);
-    }
-  }
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    wakeproc1(p, chan);
 }
 
 // Wake up all processes sleeping on chan.
@@ -527,11 +1154,23 @@ wakeup(void *chan)
   popcli();
 }
 
+// Wake up p if it is sleeping on chan, for callers
+// that know which process is waiting.
+void
+wakeproc(struct proc *p, void *chan)
+{
+  pushcli();
+  wakeproc1(p, chan);
+  popcli();
+}
+
 int
 shouldWakeup(int signum, struct proc *p){
   if( signum == SIGKILL ){ // SIGKILL recieved
     return 1;
   }
+  if(p->signalMask & (1 << signum)) // blocked, not delivered yet
+    return 0;
   void* handler = p->signalHandlers[signum].sa_handler;
   if(signum != SIGSTOP){
     if((signum == SIGCONT) && (handler == (void*)SIGKILL)){
@@ -544,6 +1183,20 @@ shouldWakeup(int signum, struct proc *p){
   return 0; // should stay asleep
 }
 
+// Is a signal pending that kill() would have woken p for?
+int
+sigwakes(struct proc *p)
+{
+  uint pending;
+  int signum;
+
+  pending = p->pendingSignals;
+  for(signum = 0; signum < 32; signum++)
+    if((pending & (1 << signum)) && shouldWakeup(signum, p))
+      return 1;
+  return 0;
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -571,6 +1224,7 @@ kill(int pid, int signum)
           continue;
         if(!cas(&p->state, SLEEPING, RUNNABLE))
           panic("kill: failed cas SLEEPING to RUNNABLE");
+        ready(p);
       }
       popcli();
       return 0;
@@ -580,12 +1234,35 @@ kill(int pid, int signum)
   return -1;
 }
  
-//PAGEBREAK: 36
-// Print a process listing to console.  For debugging.
-// Runs when user types ^P on console.
-// No lock to avoid wedging a stuck machine further.
-void
-procdump(void)
+static void
+ruadd(struct rusage *a, struct rusage *b)
+{
+  a->ru_utime += b->ru_utime;
+  a->ru_stime += b->ru_stime;
+  a->ru_nvcsw += b->ru_nvcsw;
+  a->ru_nivcsw += b->ru_nivcsw;
+  a->ru_nsyscall += b->ru_nsyscall;
+  a->ru_nfault += b->ru_nfault;
+}
+
+// Copy the caller's resource usage, or that of its
+// children that it has waited for, to ru.
+int
+getrusage(int who, struct rusage *ru)
+{
+  struct proc *p = myproc();
+
+  if(who == RUSAGE_SELF)
+    *ru = p->ru;
+  else if(who == RUSAGE_CHILDREN)
+    *ru = p->cru;
+  else
+    return -1;
+  return 0;
+}
+
+static char*
+statename(struct proc *p)
 {
   static char *states[] = {
   [UNUSED]    "unused",
@@ -595,19 +1272,31 @@ procdump(void)
   [RUNNING]   "run   ",
   [ZOMBIE]    "zombie"
   };
+
+  if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+    return states[p->state];
+  return p->state==-ZOMBIE ? "-ZOMBIE": p->state==-SLEEPING ? "-SLEEPING":p->state==-RUNNABLE ? "-RUNNABLE":"???";
+}
+
+//PAGEBREAK: 36
+// Print a process listing, and how long each CPU has
+// been idle, to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
   int i;
   struct proc *p;
-  char *state;
+  struct cpu *c;
   uint pc[10];
 
+  for(c = cpus; c < cpus+ncpu; c++)
+    cprintf("cpu%d idle %d ms\n", c-cpus, nstoms(c->idlens));
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->state == UNUSED)
       continue;
-    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
-      state = states[p->state];
-    else
-      state = p->state==-ZOMBIE ? "-ZOMBIE": p->state==-SLEEPING ? "-SLEEPING":p->state==-RUNNABLE ? "-RUNNABLE":"???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s", p->pid, statename(p), p->name);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -617,6 +1306,107 @@ procdump(void)
   }
 }
 
+// The PROCSTAT device reads as a table of the resource
+// usage of each CPU and each process, made afresh on every
+// read. A read at off gets the bytes of the table from off
+// on, which emitf() keeps as it goes, dropping the rest.
+struct emitter {
+  char *dst;
+  uint off;   // first byte to keep
+  uint end;   // byte after the last to keep
+  uint pos;   // bytes made so far
+};
+
+static void
+emitc(struct emitter *e, char c)
+{
+  if(e->pos >= e->off && e->pos < e->end)
+    e->dst[e->pos - e->off] = c;
+  e->pos++;
+}
+
+// Like cprintf, for %d and %s.
+static void
+emitf(struct emitter *e, char *fmt, ...)
+{
+  char buf[16], *s;
+  uint *argp, x;
+  int i, c, n;
+
+  argp = (uint*)(void*)(&fmt + 1);
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+    if(c != '%'){
+      emitc(e, c);
+      continue;
+    }
+    c = fmt[++i] & 0xff;
+    if(c == 0)
+      break;
+    switch(c){
+    case 'd':
+      x = *argp++;
+      if((int)x < 0){
+        emitc(e, '-');
+        x = -x;
+      }
+      n = 0;
+      do
+        buf[n++] = '0' + x % 10;
+      while((x /= 10) != 0);
+      while(--n >= 0)
+        emitc(e, buf[n]);
+      break;
+    case 's':
+      for(s = (char*)*argp++; *s; s++)
+        emitc(e, *s);
+      break;
+    default:
+      emitc(e, '%');
+      emitc(e, c);
+      break;
+    }
+  }
+}
+
+static void
+emitru(struct emitter *e, struct rusage *ru)
+{
+  emitf(e, " %d %d %d %d %d %d\n", ru->ru_utime, ru->ru_stime,
+        ru->ru_nvcsw, ru->ru_nivcsw, ru->ru_nsyscall, ru->ru_nfault);
+}
+
+// No lock, like procdump: the counts may be a little
+// out of step with one another.
+static int
+procread(struct inode *ip, char *dst, uint off, int n)
+{
+  struct emitter e;
+  struct proc *p;
+  struct cpu *c;
+
+  if(n <= 0)
+    return 0;
+  e.dst = dst;
+  e.off = off;
+  e.end = off + n;
+  e.pos = 0;
+  emitf(&e, "cpu idlems user sys vcsw ivcsw syscall fault\n");
+  for(c = cpus; c < cpus+ncpu; c++){
+    emitf(&e, "%d %d", c-cpus, nstoms(c->idlens));
+    emitru(&e, &c->ru);
+  }
+  emitf(&e, "pid state name user sys vcsw ivcsw syscall fault\n");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state == UNUSED || p->state == EMBRYO)
+      continue;
+    emitf(&e, "%d %s %s", p->pid, statename(p), p->name);
+    emitru(&e, &p->ru);
+  }
+  if(e.pos <= off)
+    return 0;
+  return e.pos < e.end ? e.pos - off : n;
+}
+
 uint
 sigprocmask(uint sigmask){
   struct proc *p = myproc();
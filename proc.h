@@ -8,6 +8,11 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted in the scheduler?
+  volatile uint kick;          // Set to wake it from mwait
+  volatile uint resched;       // Yield at the end of this trap
+  uint64 idlens;               // Time spent idle (ns)
+  struct rusage ru;            // Usage by the processes run here
 };
 
 extern struct cpu cpus[NCPU];
@@ -92,6 +97,24 @@ struct proc {
   struct backuptrapframe userTrapBackup; // user trap frame backup
   int block_user_signals;      // 1 if proc is executing a user sighandler, 0 otherwise
   volatile int suspend;
+  int logres;                  // log blocks reserved by current FS op
+  int policy;                  // SCHED_FAIR or SCHED_RT
+  int rtprio;                  // SCHED_RT priority
+  int nice;                    // SCHED_FAIR nice value
+  uint64 vruntime;             // SCHED_FAIR virtual runtime, in ns
+  uint64 lastrun;              // when last charged for CPU time
+  int ticks;                   // clock ticks run since scheduled
+  uint affinity;               // bit i set if it may run on cpus[i]
+  int cpu;                     // index of the CPU it last ran on
+  struct rusage ru;            // resource usage
+  struct rusage cru;           // of children waited for
+  int onrq;                    // on the run queue?
+  struct proc *rqnext;         // SCHED_RT run queue list
+  int rqidx;                   // SCHED_FAIR run queue heap index
+  uint64 deadline;             // when to wake from sleepns(), in ns
+  struct proc **tslot;         // timer wheel slot, if on one
+  struct proc *tprev;          // timer wheel slot list
+  struct proc *tnext;
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,3191 @@
+
+_sanity:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1,"inheritTest Passed\n\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1,"Signal Test Started:\n\n");
+      11:	68 a8 1a 00 00       	push   $0x1aa8
+      16:	6a 01                	push   $0x1
+      18:	e8 03 17 00 00       	call   1720 <printf>
+  userHandlersTest();
+      1d:	e8 5e 04 00 00       	call   480 <userHandlersTest>
+  concurrentUserHandlersTest();
+      22:	e8 a9 05 00 00       	call   5d0 <concurrentUserHandlersTest>
+  stopContTest();
+      27:	e8 c4 06 00 00       	call   6f0 <stopContTest>
+  procMaskTest();
+      2c:	e8 5f 07 00 00       	call   790 <procMaskTest>
+  signalDefaultTest();
+      31:	e8 2a 08 00 00       	call   860 <signalDefaultTest>
+  killIgnoreTest();
+      36:	e8 95 08 00 00       	call   8d0 <killIgnoreTest>
+  inheritTest();
+      3b:	e8 30 09 00 00       	call   970 <inheritTest>
+  printf(1,"Signal Test Ended Succesfully!\n"); 
+      40:	58                   	pop    %eax
+      41:	5a                   	pop    %edx
+      42:	68 b4 1b 00 00       	push   $0x1bb4
+      47:	6a 01                	push   $0x1
+      49:	e8 d2 16 00 00       	call   1720 <printf>
+  exit();
+      4e:	e8 bd 0c 00 00       	call   d10 <exit>
+      53:	66 90                	xchg   %ax,%ax
+      55:	66 90                	xchg   %ax,%ax
+      57:	66 90                	xchg   %ax,%ax
+      59:	66 90                	xchg   %ax,%ax
+      5b:	66 90                	xchg   %ax,%ax
+      5d:	66 90                	xchg   %ax,%ax
+      5f:	90                   	nop
+
+00000060 <userHandler1>:
+void userHandler1(int signum){
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	83 ec 08             	sub    $0x8,%esp
+  flag=1;
+      66:	c7 05 00 23 00 00 01 	movl   $0x1,0x2300
+      6d:	00 00 00 
+  exit();
+      70:	e8 9b 0c 00 00       	call   d10 <exit>
+      75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000080 <userHandler3>:
+void userHandler3(int signum){
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	83 ec 08             	sub    $0x8,%esp
+      86:	c7 05 00 23 00 00 01 	movl   $0x1,0x2300
+      8d:	00 00 00 
+      90:	e8 7b 0c 00 00       	call   d10 <exit>
+      95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <userHandler2>:
+void userHandler2(int signum){
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	83 ec 08             	sub    $0x8,%esp
+      a6:	c7 05 00 23 00 00 01 	movl   $0x1,0x2300
+      ad:	00 00 00 
+      b0:	e8 5b 0c 00 00       	call   d10 <exit>
+      b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000c0 <fib>:
+fib(int n){ //some calculation
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+      c6:	83 ec 6c             	sub    $0x6c,%esp
+      c9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if(n<=1)
+      cc:	83 fe 01             	cmp    $0x1,%esi
+      cf:	0f 8e d4 02 00 00    	jle    3a9 <fib+0x2e9>
+      d5:	8d 4e ff             	lea    -0x1(%esi),%ecx
+      d8:	89 f0                	mov    %esi,%eax
+      da:	89 f3                	mov    %esi,%ebx
+      dc:	31 ff                	xor    %edi,%edi
+      de:	89 ca                	mov    %ecx,%edx
+      e0:	83 e2 fe             	and    $0xfffffffe,%edx
+      e3:	29 d0                	sub    %edx,%eax
+      e5:	89 45 90             	mov    %eax,-0x70(%ebp)
+      e8:	8b 75 90             	mov    -0x70(%ebp),%esi
+      eb:	89 c8                	mov    %ecx,%eax
+	else return fib(n-1)+fib(n-2);
+      ed:	89 c1                	mov    %eax,%ecx
+	if(n<=1)
+      ef:	39 f3                	cmp    %esi,%ebx
+      f1:	0f 84 ac 02 00 00    	je     3a3 <fib+0x2e3>
+      f7:	83 eb 02             	sub    $0x2,%ebx
+      fa:	89 ce                	mov    %ecx,%esi
+      fc:	89 7d bc             	mov    %edi,-0x44(%ebp)
+      ff:	31 d2                	xor    %edx,%edx
+     101:	89 d8                	mov    %ebx,%eax
+     103:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+     106:	89 d3                	mov    %edx,%ebx
+     108:	83 e0 fe             	and    $0xfffffffe,%eax
+     10b:	29 c6                	sub    %eax,%esi
+     10d:	89 75 94             	mov    %esi,-0x6c(%ebp)
+     110:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     113:	8d 71 ff             	lea    -0x1(%ecx),%esi
+	else return fib(n-1)+fib(n-2);
+     116:	89 f0                	mov    %esi,%eax
+	if(n<=1)
+     118:	39 f9                	cmp    %edi,%ecx
+     11a:	0f 84 59 02 00 00    	je     379 <fib+0x2b9>
+     120:	8d 79 fe             	lea    -0x2(%ecx),%edi
+     123:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+     126:	89 fa                	mov    %edi,%edx
+     128:	89 7d b0             	mov    %edi,-0x50(%ebp)
+     12b:	83 e2 fe             	and    $0xfffffffe,%edx
+     12e:	29 d6                	sub    %edx,%esi
+     130:	89 75 98             	mov    %esi,-0x68(%ebp)
+     133:	31 f6                	xor    %esi,%esi
+     135:	8b 7d 98             	mov    -0x68(%ebp),%edi
+     138:	8d 48 ff             	lea    -0x1(%eax),%ecx
+     13b:	39 f8                	cmp    %edi,%eax
+     13d:	0f 84 0c 02 00 00    	je     34f <fib+0x28f>
+     143:	8d 58 fe             	lea    -0x2(%eax),%ebx
+     146:	89 cf                	mov    %ecx,%edi
+     148:	89 75 ac             	mov    %esi,-0x54(%ebp)
+     14b:	89 d8                	mov    %ebx,%eax
+     14d:	89 5d a8             	mov    %ebx,-0x58(%ebp)
+     150:	89 cb                	mov    %ecx,%ebx
+     152:	83 e0 fe             	and    $0xfffffffe,%eax
+     155:	29 c7                	sub    %eax,%edi
+     157:	89 7d 9c             	mov    %edi,-0x64(%ebp)
+     15a:	31 ff                	xor    %edi,%edi
+	else return fib(n-1)+fib(n-2);
+     15c:	8d 4b ff             	lea    -0x1(%ebx),%ecx
+     15f:	89 c8                	mov    %ecx,%eax
+	if(n<=1)
+     161:	39 5d 9c             	cmp    %ebx,-0x64(%ebp)
+     164:	0f 84 d3 01 00 00    	je     33d <fib+0x27d>
+     16a:	8d 73 fe             	lea    -0x2(%ebx),%esi
+     16d:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+     170:	89 f2                	mov    %esi,%edx
+     172:	89 75 a0             	mov    %esi,-0x60(%ebp)
+     175:	83 e2 fe             	and    $0xfffffffe,%edx
+     178:	29 d1                	sub    %edx,%ecx
+     17a:	31 d2                	xor    %edx,%edx
+     17c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     17f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	else return fib(n-1)+fib(n-2);
+     182:	8d 58 ff             	lea    -0x1(%eax),%ebx
+     185:	89 da                	mov    %ebx,%edx
+	if(n<=1)
+     187:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+     18a:	0f 84 9a 01 00 00    	je     32a <fib+0x26a>
+     190:	8d 58 fe             	lea    -0x2(%eax),%ebx
+     193:	89 d6                	mov    %edx,%esi
+     195:	89 d8                	mov    %ebx,%eax
+     197:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+     19a:	89 d3                	mov    %edx,%ebx
+     19c:	83 e0 fe             	and    $0xfffffffe,%eax
+     19f:	29 c6                	sub    %eax,%esi
+     1a1:	89 75 cc             	mov    %esi,-0x34(%ebp)
+     1a4:	31 f6                	xor    %esi,%esi
+     1a6:	8b 7d cc             	mov    -0x34(%ebp),%edi
+     1a9:	8d 43 ff             	lea    -0x1(%ebx),%eax
+	else return fib(n-1)+fib(n-2);
+     1ac:	89 c1                	mov    %eax,%ecx
+	if(n<=1)
+     1ae:	39 fb                	cmp    %edi,%ebx
+     1b0:	0f 84 3a 01 00 00    	je     2f0 <fib+0x230>
+     1b6:	8d 43 fd             	lea    -0x3(%ebx),%eax
+     1b9:	8d 7b fe             	lea    -0x2(%ebx),%edi
+     1bc:	89 ca                	mov    %ecx,%edx
+     1be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1c1:	89 f8                	mov    %edi,%eax
+     1c3:	83 e0 fe             	and    $0xfffffffe,%eax
+     1c6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     1c9:	29 c2                	sub    %eax,%edx
+     1cb:	89 55 c0             	mov    %edx,-0x40(%ebp)
+     1ce:	31 d2                	xor    %edx,%edx
+     1d0:	8b 7d c0             	mov    -0x40(%ebp),%edi
+     1d3:	8d 41 ff             	lea    -0x1(%ecx),%eax
+	else return fib(n-1)+fib(n-2);
+     1d6:	89 c3                	mov    %eax,%ebx
+	if(n<=1)
+     1d8:	39 f9                	cmp    %edi,%ecx
+     1da:	0f 84 28 01 00 00    	je     308 <fib+0x248>
+     1e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1e3:	89 df                	mov    %ebx,%edi
+     1e5:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+     1e8:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     1eb:	83 e0 fe             	and    $0xfffffffe,%eax
+     1ee:	29 c7                	sub    %eax,%edi
+     1f0:	89 7d d8             	mov    %edi,-0x28(%ebp)
+     1f3:	31 ff                	xor    %edi,%edi
+     1f5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+	else return fib(n-1)+fib(n-2);
+     1f8:	8d 53 ff             	lea    -0x1(%ebx),%edx
+	if(n<=1)
+     1fb:	39 c3                	cmp    %eax,%ebx
+     1fd:	0f 84 15 01 00 00    	je     318 <fib+0x258>
+     203:	31 c9                	xor    %ecx,%ecx
+	else return fib(n-1)+fib(n-2);
+     205:	83 ec 0c             	sub    $0xc,%esp
+     208:	8d 42 ff             	lea    -0x1(%edx),%eax
+     20b:	89 4d 88             	mov    %ecx,-0x78(%ebp)
+     20e:	89 55 8c             	mov    %edx,-0x74(%ebp)
+     211:	50                   	push   %eax
+     212:	e8 a9 fe ff ff       	call   c0 <fib>
+     217:	8b 55 8c             	mov    -0x74(%ebp),%edx
+     21a:	8b 4d 88             	mov    -0x78(%ebp),%ecx
+     21d:	83 c4 10             	add    $0x10,%esp
+     220:	83 ea 02             	sub    $0x2,%edx
+     223:	01 c1                	add    %eax,%ecx
+	if(n<=1)
+     225:	83 fa 01             	cmp    $0x1,%edx
+     228:	7f db                	jg     205 <fib+0x145>
+     22a:	8d 43 fd             	lea    -0x3(%ebx),%eax
+	else return fib(n-1)+fib(n-2);
+     22d:	83 eb 02             	sub    $0x2,%ebx
+     230:	83 e0 01             	and    $0x1,%eax
+     233:	01 c8                	add    %ecx,%eax
+     235:	01 c7                	add    %eax,%edi
+	if(n<=1)
+     237:	83 fb 01             	cmp    $0x1,%ebx
+     23a:	7f b9                	jg     1f5 <fib+0x135>
+     23c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+     23f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+		return n;
+     242:	01 fb                	add    %edi,%ebx
+	else return fib(n-1)+fib(n-2);
+     244:	83 e9 02             	sub    $0x2,%ecx
+	if(n<=1)
+     247:	83 6d e0 02          	subl   $0x2,-0x20(%ebp)
+     24b:	01 da                	add    %ebx,%edx
+     24d:	83 f9 01             	cmp    $0x1,%ecx
+     250:	0f 8f 7a ff ff ff    	jg     1d0 <fib+0x110>
+     256:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		return n;
+     259:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+	else return fib(n-1)+fib(n-2);
+     25c:	89 fb                	mov    %edi,%ebx
+     25e:	01 c6                	add    %eax,%esi
+	if(n<=1)
+     260:	83 ff 01             	cmp    $0x1,%edi
+     263:	0f 8f 3d ff ff ff    	jg     1a6 <fib+0xe6>
+     269:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+     26c:	89 fa                	mov    %edi,%edx
+     26e:	89 f1                	mov    %esi,%ecx
+     270:	01 ca                	add    %ecx,%edx
+	else return fib(n-1)+fib(n-2);
+     272:	89 d8                	mov    %ebx,%eax
+     274:	01 55 d4             	add    %edx,-0x2c(%ebp)
+	if(n<=1)
+     277:	83 fb 01             	cmp    $0x1,%ebx
+     27a:	0f 8f 02 ff ff ff    	jg     182 <fib+0xc2>
+     280:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+     283:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     286:	8b 75 a0             	mov    -0x60(%ebp),%esi
+		return n;
+     289:	01 d0                	add    %edx,%eax
+	else return fib(n-1)+fib(n-2);
+     28b:	89 f3                	mov    %esi,%ebx
+     28d:	01 c7                	add    %eax,%edi
+	if(n<=1)
+     28f:	83 fe 01             	cmp    $0x1,%esi
+     292:	0f 8f c4 fe ff ff    	jg     15c <fib+0x9c>
+     298:	89 da                	mov    %ebx,%edx
+     29a:	8b 75 ac             	mov    -0x54(%ebp),%esi
+     29d:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+		return n;
+     2a0:	01 fa                	add    %edi,%edx
+	else return fib(n-1)+fib(n-2);
+     2a2:	89 d8                	mov    %ebx,%eax
+     2a4:	01 d6                	add    %edx,%esi
+	if(n<=1)
+     2a6:	83 fb 01             	cmp    $0x1,%ebx
+     2a9:	0f 8f 86 fe ff ff    	jg     135 <fib+0x75>
+     2af:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+     2b2:	8b 7d b0             	mov    -0x50(%ebp),%edi
+		return n;
+     2b5:	01 f0                	add    %esi,%eax
+	else return fib(n-1)+fib(n-2);
+     2b7:	89 f9                	mov    %edi,%ecx
+     2b9:	01 c3                	add    %eax,%ebx
+	if(n<=1)
+     2bb:	83 ff 01             	cmp    $0x1,%edi
+     2be:	0f 8f 4c fe ff ff    	jg     110 <fib+0x50>
+     2c4:	89 da                	mov    %ebx,%edx
+     2c6:	8b 7d bc             	mov    -0x44(%ebp),%edi
+     2c9:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		return n;
+     2cc:	01 d1                	add    %edx,%ecx
+     2ce:	01 cf                	add    %ecx,%edi
+	if(n<=1)
+     2d0:	83 fb 01             	cmp    $0x1,%ebx
+     2d3:	0f 8f ba 00 00 00    	jg     393 <fib+0x2d3>
+     2d9:	89 de                	mov    %ebx,%esi
+}
+     2db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2de:	01 fe                	add    %edi,%esi
+     2e0:	5b                   	pop    %ebx
+     2e1:	89 f0                	mov    %esi,%eax
+     2e3:	5e                   	pop    %esi
+     2e4:	5f                   	pop    %edi
+     2e5:	5d                   	pop    %ebp
+     2e6:	c3                   	ret
+     2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ee:	66 90                	xchg   %ax,%ax
+	else return fib(n-1)+fib(n-2);
+     2f0:	89 da                	mov    %ebx,%edx
+     2f2:	89 f1                	mov    %esi,%ecx
+     2f4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+     2f7:	83 ea 02             	sub    $0x2,%edx
+     2fa:	01 c1                	add    %eax,%ecx
+	if(n<=1)
+     2fc:	e9 6f ff ff ff       	jmp    270 <fib+0x1b0>
+     301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+	else return fib(n-1)+fib(n-2);
+     308:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     30b:	83 e9 02             	sub    $0x2,%ecx
+     30e:	01 c2                	add    %eax,%edx
+	if(n<=1)
+     310:	e9 44 ff ff ff       	jmp    259 <fib+0x199>
+     315:	8d 76 00             	lea    0x0(%esi),%esi
+	else return fib(n-1)+fib(n-2);
+     318:	89 d0                	mov    %edx,%eax
+     31a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+     31d:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     320:	83 eb 02             	sub    $0x2,%ebx
+     323:	01 c7                	add    %eax,%edi
+	if(n<=1)
+     325:	e9 18 ff ff ff       	jmp    242 <fib+0x182>
+	else return fib(n-1)+fib(n-2);
+     32a:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     32d:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+     330:	83 e8 02             	sub    $0x2,%eax
+     333:	8b 75 a0             	mov    -0x60(%ebp),%esi
+		return n;
+     336:	01 da                	add    %ebx,%edx
+	if(n<=1)
+     338:	e9 4c ff ff ff       	jmp    289 <fib+0x1c9>
+	else return fib(n-1)+fib(n-2);
+     33d:	89 da                	mov    %ebx,%edx
+     33f:	8b 75 ac             	mov    -0x54(%ebp),%esi
+     342:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+		return n;
+     345:	01 cf                	add    %ecx,%edi
+	else return fib(n-1)+fib(n-2);
+     347:	83 ea 02             	sub    $0x2,%edx
+     34a:	e9 51 ff ff ff       	jmp    2a0 <fib+0x1e0>
+     34f:	01 ce                	add    %ecx,%esi
+     351:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+     354:	8b 7d b0             	mov    -0x50(%ebp),%edi
+     357:	83 e8 02             	sub    $0x2,%eax
+     35a:	01 f0                	add    %esi,%eax
+     35c:	89 f9                	mov    %edi,%ecx
+     35e:	01 c3                	add    %eax,%ebx
+	if(n<=1)
+     360:	83 ff 01             	cmp    $0x1,%edi
+     363:	0f 8e 5b ff ff ff    	jle    2c4 <fib+0x204>
+     369:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     36c:	8d 71 ff             	lea    -0x1(%ecx),%esi
+	else return fib(n-1)+fib(n-2);
+     36f:	89 f0                	mov    %esi,%eax
+	if(n<=1)
+     371:	39 f9                	cmp    %edi,%ecx
+     373:	0f 85 a7 fd ff ff    	jne    120 <fib+0x60>
+	else return fib(n-1)+fib(n-2);
+     379:	89 da                	mov    %ebx,%edx
+     37b:	8b 7d bc             	mov    -0x44(%ebp),%edi
+     37e:	83 e9 02             	sub    $0x2,%ecx
+     381:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		return n;
+     384:	01 f2                	add    %esi,%edx
+     386:	01 d1                	add    %edx,%ecx
+     388:	01 cf                	add    %ecx,%edi
+	if(n<=1)
+     38a:	83 fb 01             	cmp    $0x1,%ebx
+     38d:	0f 8e 46 ff ff ff    	jle    2d9 <fib+0x219>
+     393:	8b 75 90             	mov    -0x70(%ebp),%esi
+     396:	8d 43 ff             	lea    -0x1(%ebx),%eax
+	else return fib(n-1)+fib(n-2);
+     399:	89 c1                	mov    %eax,%ecx
+	if(n<=1)
+     39b:	39 f3                	cmp    %esi,%ebx
+     39d:	0f 85 54 fd ff ff    	jne    f7 <fib+0x37>
+     3a3:	01 f9                	add    %edi,%ecx
+     3a5:	8d 74 0b fe          	lea    -0x2(%ebx,%ecx,1),%esi
+}
+     3a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3ac:	89 f0                	mov    %esi,%eax
+     3ae:	5b                   	pop    %ebx
+     3af:	5e                   	pop    %esi
+     3b0:	5f                   	pop    %edi
+     3b1:	5d                   	pop    %ebp
+     3b2:	c3                   	ret
+     3b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <bigHandler>:
+void bigHandler(int signum){
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	56                   	push   %esi
+  kill(getpid(),SIGUSER2);
+     3c4:	be 05 00 00 00       	mov    $0x5,%esi
+void bigHandler(int signum){
+     3c9:	53                   	push   %ebx
+     3ca:	83 ec 10             	sub    $0x10,%esp
+  kill(getpid(),SIGUSER2);
+     3cd:	e8 d4 09 00 00       	call   da6 <getpid>
+     3d2:	83 ec 08             	sub    $0x8,%esp
+     3d5:	6a 15                	push   $0x15
+     3d7:	50                   	push   %eax
+     3d8:	e8 79 09 00 00       	call   d56 <kill>
+     3dd:	83 c4 10             	add    $0x10,%esp
+void bigHandler(int signum){
+     3e0:	bb 1d 00 00 00       	mov    $0x1d,%ebx
+	else return fib(n-1)+fib(n-2);
+     3e5:	83 ec 0c             	sub    $0xc,%esp
+     3e8:	53                   	push   %ebx
+	if(n<=1)
+     3e9:	83 eb 02             	sub    $0x2,%ebx
+	else return fib(n-1)+fib(n-2);
+     3ec:	e8 cf fc ff ff       	call   c0 <fib>
+     3f1:	83 c4 10             	add    $0x10,%esp
+	if(n<=1)
+     3f4:	83 fb ff             	cmp    $0xffffffff,%ebx
+     3f7:	75 ec                	jne    3e5 <bigHandler+0x25>
+    printf(1,"bigHandler...\n");
+     3f9:	83 ec 08             	sub    $0x8,%esp
+     3fc:	68 28 19 00 00       	push   $0x1928
+     401:	6a 01                	push   $0x1
+     403:	e8 18 13 00 00       	call   1720 <printf>
+  for (int i = 0; i < 5; i++){
+     408:	83 c4 10             	add    $0x10,%esp
+     40b:	83 ee 01             	sub    $0x1,%esi
+     40e:	75 d0                	jne    3e0 <bigHandler+0x20>
+  sigaction(SIGUSER2,&act,null);
+     410:	83 ec 04             	sub    $0x4,%esp
+     413:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  act.sa_handler = (void*)SIG_IGN;
+     416:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  act.sigmask = 0;
+     41d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  sigaction(SIGUSER2,&act,null);
+     424:	6a 00                	push   $0x0
+     426:	50                   	push   %eax
+     427:	6a 15                	push   $0x15
+     429:	e8 a0 09 00 00       	call   dce <sigaction>
+}
+     42e:	83 c4 10             	add    $0x10,%esp
+  flag=1;
+     431:	c7 05 00 23 00 00 01 	movl   $0x1,0x2300
+     438:	00 00 00 
+}
+     43b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     43e:	5b                   	pop    %ebx
+     43f:	5e                   	pop    %esi
+     440:	5d                   	pop    %ebp
+     441:	c3                   	ret
+     442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <failHandler>:
+	flag=1;
+     450:	c7 05 00 23 00 00 01 	movl   $0x1,0x2300
+     457:	00 00 00 
+}
+     45a:	c3                   	ret
+     45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     45f:	90                   	nop
+
+00000460 <printHandler>:
+void printHandler(int signum){
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	83 ec 0c             	sub    $0xc,%esp
+  printf(1,"printHandler, got signal: %d\n", signum);
+     466:	ff 75 08             	push   0x8(%ebp)
+     469:	68 37 19 00 00       	push   $0x1937
+     46e:	6a 01                	push   $0x1
+     470:	e8 ab 12 00 00       	call   1720 <printf>
+}
+     475:	83 c4 10             	add    $0x10,%esp
+     478:	c9                   	leave
+     479:	c3                   	ret
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000480 <userHandlersTest>:
+void userHandlersTest(){
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	53                   	push   %ebx
+	for(int i=0; i<N; i++){
+     484:	31 db                	xor    %ebx,%ebx
+void userHandlersTest(){
+     486:	83 ec 1c             	sub    $0x1c,%esp
+	printf(1,"userHandlersTest\n");
+     489:	68 55 19 00 00       	push   $0x1955
+     48e:	6a 01                	push   $0x1
+     490:	e8 8b 12 00 00       	call   1720 <printf>
+     495:	83 c4 10             	add    $0x10,%esp
+     498:	eb 17                	jmp    4b1 <userHandlersTest+0x31>
+     49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        wait();
+     4a0:	e8 89 08 00 00       	call   d2e <wait>
+	for(int i=0; i<N; i++){
+     4a5:	83 c3 01             	add    $0x1,%ebx
+     4a8:	83 fb 3c             	cmp    $0x3c,%ebx
+     4ab:	0f 84 b2 00 00 00    	je     563 <userHandlersTest+0xe3>
+      int pid = fork();
+     4b1:	e8 70 08 00 00       	call   d26 <fork>
+      if(pid<0){
+     4b6:	85 c0                	test   %eax,%eax
+     4b8:	0f 88 fa 00 00 00    	js     5b8 <userHandlersTest+0x138>
+      if(pid == 0){
+     4be:	75 e0                	jne    4a0 <userHandlersTest+0x20>
+          if(i % 3 == 0){
+     4c0:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+        act.sigmask=0;
+     4c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+          if(i % 3 == 0){
+     4cc:	f7 e3                	mul    %ebx
+     4ce:	89 d1                	mov    %edx,%ecx
+     4d0:	83 e2 fe             	and    $0xfffffffe,%edx
+     4d3:	d1 e9                	shr    %ecx
+     4d5:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     4d8:	89 d9                	mov    %ebx,%ecx
+     4da:	29 c1                	sub    %eax,%ecx
+     4dc:	74 4a                	je     528 <userHandlersTest+0xa8>
+          if(i % 3 == 1){
+     4de:	83 f9 01             	cmp    $0x1,%ecx
+     4e1:	0f 84 93 00 00 00    	je     57a <userHandlersTest+0xfa>
+            sigaction(SIGUSER3,&act,null);
+     4e7:	83 ec 04             	sub    $0x4,%esp
+     4ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+            act.sa_handler = &userHandler3;
+     4ed:	c7 45 f0 80 00 00 00 	movl   $0x80,-0x10(%ebp)
+            sigaction(SIGUSER3,&act,null);
+     4f4:	6a 00                	push   $0x0
+     4f6:	50                   	push   %eax
+     4f7:	6a 16                	push   $0x16
+     4f9:	e8 d0 08 00 00       	call   dce <sigaction>
+            printf(1,"(fork number: %d) \n",i);
+     4fe:	83 c4 0c             	add    $0xc,%esp
+     501:	53                   	push   %ebx
+     502:	68 74 19 00 00       	push   $0x1974
+     507:	6a 01                	push   $0x1
+     509:	e8 12 12 00 00       	call   1720 <printf>
+            kill(getpid(), SIGUSER3);
+     50e:	e8 93 08 00 00       	call   da6 <getpid>
+     513:	5b                   	pop    %ebx
+     514:	5a                   	pop    %edx
+     515:	6a 16                	push   $0x16
+     517:	50                   	push   %eax
+     518:	e8 39 08 00 00       	call   d56 <kill>
+     51d:	83 c4 10             	add    $0x10,%esp
+          for(;;){
+     520:	eb fe                	jmp    520 <userHandlersTest+0xa0>
+     522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            sigaction(SIGUSER1,&act,null);
+     528:	83 ec 04             	sub    $0x4,%esp
+     52b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+            act.sa_handler = &userHandler1;
+     52e:	c7 45 f0 60 00 00 00 	movl   $0x60,-0x10(%ebp)
+            sigaction(SIGUSER1,&act,null);
+     535:	6a 00                	push   $0x0
+     537:	50                   	push   %eax
+     538:	6a 14                	push   $0x14
+     53a:	e8 8f 08 00 00       	call   dce <sigaction>
+            printf(1,"(fork number: %d) \n",i);
+     53f:	83 c4 0c             	add    $0xc,%esp
+     542:	53                   	push   %ebx
+     543:	68 74 19 00 00       	push   $0x1974
+     548:	6a 01                	push   $0x1
+     54a:	e8 d1 11 00 00       	call   1720 <printf>
+            kill(getpid(), SIGUSER1);
+     54f:	e8 52 08 00 00       	call   da6 <getpid>
+     554:	59                   	pop    %ecx
+     555:	5b                   	pop    %ebx
+     556:	6a 14                	push   $0x14
+     558:	50                   	push   %eax
+     559:	e8 f8 07 00 00       	call   d56 <kill>
+          if(i % 3 == 2){
+     55e:	83 c4 10             	add    $0x10,%esp
+     561:	eb bd                	jmp    520 <userHandlersTest+0xa0>
+	printf(1,"userHandlersTest Passed\n\n");
+     563:	83 ec 08             	sub    $0x8,%esp
+     566:	68 88 19 00 00       	push   $0x1988
+     56b:	6a 01                	push   $0x1
+     56d:	e8 ae 11 00 00       	call   1720 <printf>
+}
+     572:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     575:	83 c4 10             	add    $0x10,%esp
+     578:	c9                   	leave
+     579:	c3                   	ret
+            sigaction(SIGUSER2,&act,null);
+     57a:	83 ec 04             	sub    $0x4,%esp
+     57d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+            act.sa_handler = &userHandler2;
+     580:	c7 45 f0 a0 00 00 00 	movl   $0xa0,-0x10(%ebp)
+            sigaction(SIGUSER2,&act,null);
+     587:	6a 00                	push   $0x0
+     589:	50                   	push   %eax
+     58a:	6a 15                	push   $0x15
+     58c:	e8 3d 08 00 00       	call   dce <sigaction>
+            printf(1,"(fork number: %d) \n",i);
+     591:	83 c4 0c             	add    $0xc,%esp
+     594:	53                   	push   %ebx
+     595:	68 74 19 00 00       	push   $0x1974
+     59a:	6a 01                	push   $0x1
+     59c:	e8 7f 11 00 00       	call   1720 <printf>
+            kill(getpid(), SIGUSER2);
+     5a1:	e8 00 08 00 00       	call   da6 <getpid>
+     5a6:	5a                   	pop    %edx
+     5a7:	59                   	pop    %ecx
+     5a8:	6a 15                	push   $0x15
+     5aa:	50                   	push   %eax
+     5ab:	e8 a6 07 00 00       	call   d56 <kill>
+     5b0:	83 c4 10             	add    $0x10,%esp
+     5b3:	e9 68 ff ff ff       	jmp    520 <userHandlersTest+0xa0>
+        printf(1,"fork failed\n");
+     5b8:	83 ec 08             	sub    $0x8,%esp
+     5bb:	68 67 19 00 00       	push   $0x1967
+     5c0:	6a 01                	push   $0x1
+     5c2:	e8 59 11 00 00       	call   1720 <printf>
+        exit();
+     5c7:	e8 44 07 00 00       	call   d10 <exit>
+     5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <concurrentUserHandlersTest>:
+void concurrentUserHandlersTest(){
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	53                   	push   %ebx
+	for(int i=0; i<N; i++){
+     5d4:	31 db                	xor    %ebx,%ebx
+void concurrentUserHandlersTest(){
+     5d6:	83 ec 1c             	sub    $0x1c,%esp
+	printf(1,"concurrentUserHandlersTest\n");
+     5d9:	68 a2 19 00 00       	push   $0x19a2
+     5de:	6a 01                	push   $0x1
+     5e0:	e8 3b 11 00 00       	call   1720 <printf>
+     5e5:	83 c4 10             	add    $0x10,%esp
+     5e8:	eb 0e                	jmp    5f8 <concurrentUserHandlersTest+0x28>
+     5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+	for(int i=0; i<N; i++){
+     5f0:	83 c3 01             	add    $0x1,%ebx
+     5f3:	83 fb 3c             	cmp    $0x3c,%ebx
+     5f6:	74 60                	je     658 <concurrentUserHandlersTest+0x88>
+      int pid = fork();
+     5f8:	e8 29 07 00 00       	call   d26 <fork>
+      if(pid<0){
+     5fd:	85 c0                	test   %eax,%eax
+     5ff:	0f 88 ca 00 00 00    	js     6cf <concurrentUserHandlersTest+0xff>
+      if(pid == 0){
+     605:	75 e9                	jne    5f0 <concurrentUserHandlersTest+0x20>
+          if(i % 3 == 0){
+     607:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+        act.sigmask=0;
+     60c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+          if(i % 3 == 0){
+     613:	f7 e3                	mul    %ebx
+     615:	89 d1                	mov    %edx,%ecx
+     617:	83 e2 fe             	and    $0xfffffffe,%edx
+     61a:	d1 e9                	shr    %ecx
+     61c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     61f:	89 d9                	mov    %ebx,%ecx
+     621:	29 c1                	sub    %eax,%ecx
+     623:	74 54                	je     679 <concurrentUserHandlersTest+0xa9>
+          if(i % 3 == 1){
+     625:	83 f9 01             	cmp    $0x1,%ecx
+     628:	74 7a                	je     6a4 <concurrentUserHandlersTest+0xd4>
+            sigaction(SIGUSER3,&act,null);
+     62a:	83 ec 04             	sub    $0x4,%esp
+     62d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+            act.sa_handler = &userHandler3;
+     630:	c7 45 f0 80 00 00 00 	movl   $0x80,-0x10(%ebp)
+            sigaction(SIGUSER3,&act,null);
+     637:	6a 00                	push   $0x0
+     639:	50                   	push   %eax
+     63a:	6a 16                	push   $0x16
+     63c:	e8 8d 07 00 00       	call   dce <sigaction>
+            kill(getpid(), SIGUSER3);
+     641:	e8 60 07 00 00       	call   da6 <getpid>
+     646:	5b                   	pop    %ebx
+     647:	5a                   	pop    %edx
+     648:	6a 16                	push   $0x16
+     64a:	50                   	push   %eax
+     64b:	e8 06 07 00 00       	call   d56 <kill>
+     650:	83 c4 10             	add    $0x10,%esp
+        for(;;){
+     653:	eb fe                	jmp    653 <concurrentUserHandlersTest+0x83>
+     655:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+     658:	e8 d1 06 00 00       	call   d2e <wait>
+  for(int i=0; i<N; i++){
+     65d:	83 eb 01             	sub    $0x1,%ebx
+     660:	75 f6                	jne    658 <concurrentUserHandlersTest+0x88>
+	printf(1,"concurrentUserHandlersTest Passed\n\n");
+     662:	83 ec 08             	sub    $0x8,%esp
+     665:	68 c0 1a 00 00       	push   $0x1ac0
+     66a:	6a 01                	push   $0x1
+     66c:	e8 af 10 00 00       	call   1720 <printf>
+}
+     671:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     674:	83 c4 10             	add    $0x10,%esp
+     677:	c9                   	leave
+     678:	c3                   	ret
+            sigaction(SIGUSER1,&act,null);
+     679:	83 ec 04             	sub    $0x4,%esp
+     67c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+            act.sa_handler = &userHandler1;
+     67f:	c7 45 f0 60 00 00 00 	movl   $0x60,-0x10(%ebp)
+            sigaction(SIGUSER1,&act,null);
+     686:	6a 00                	push   $0x0
+     688:	50                   	push   %eax
+     689:	6a 14                	push   $0x14
+     68b:	e8 3e 07 00 00       	call   dce <sigaction>
+            kill(getpid(), SIGUSER1);
+     690:	e8 11 07 00 00       	call   da6 <getpid>
+     695:	59                   	pop    %ecx
+     696:	5b                   	pop    %ebx
+     697:	6a 14                	push   $0x14
+     699:	50                   	push   %eax
+     69a:	e8 b7 06 00 00       	call   d56 <kill>
+          if(i % 3 == 2){
+     69f:	83 c4 10             	add    $0x10,%esp
+     6a2:	eb af                	jmp    653 <concurrentUserHandlersTest+0x83>
+            sigaction(SIGUSER2,&act,null);
+     6a4:	83 ec 04             	sub    $0x4,%esp
+     6a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+            act.sa_handler = &userHandler2;
+     6aa:	c7 45 f0 a0 00 00 00 	movl   $0xa0,-0x10(%ebp)
+            sigaction(SIGUSER2,&act,null);
+     6b1:	6a 00                	push   $0x0
+     6b3:	50                   	push   %eax
+     6b4:	6a 15                	push   $0x15
+     6b6:	e8 13 07 00 00       	call   dce <sigaction>
+            kill(getpid(), SIGUSER2);
+     6bb:	e8 e6 06 00 00       	call   da6 <getpid>
+     6c0:	5a                   	pop    %edx
+     6c1:	59                   	pop    %ecx
+     6c2:	6a 15                	push   $0x15
+     6c4:	50                   	push   %eax
+     6c5:	e8 8c 06 00 00       	call   d56 <kill>
+     6ca:	83 c4 10             	add    $0x10,%esp
+     6cd:	eb 84                	jmp    653 <concurrentUserHandlersTest+0x83>
+        printf(1,"fork failed\n");
+     6cf:	83 ec 08             	sub    $0x8,%esp
+     6d2:	68 67 19 00 00       	push   $0x1967
+     6d7:	6a 01                	push   $0x1
+     6d9:	e8 42 10 00 00       	call   1720 <printf>
+        exit();
+     6de:	e8 2d 06 00 00       	call   d10 <exit>
+     6e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006f0 <stopContTest>:
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	53                   	push   %ebx
+     6f4:	83 ec 0c             	sub    $0xc,%esp
+	printf(1,"stopContTest\n");
+     6f7:	68 be 19 00 00       	push   $0x19be
+     6fc:	6a 01                	push   $0x1
+     6fe:	e8 1d 10 00 00       	call   1720 <printf>
+	int pid = fork();
+     703:	e8 1e 06 00 00       	call   d26 <fork>
+	if(pid<0){
+     708:	83 c4 10             	add    $0x10,%esp
+     70b:	85 c0                	test   %eax,%eax
+     70d:	78 40                	js     74f <stopContTest+0x5f>
+	if(pid == 0){
+     70f:	74 51                	je     762 <stopContTest+0x72>
+		kill(pid,SIGSTOP);
+     711:	83 ec 08             	sub    $0x8,%esp
+     714:	89 c3                	mov    %eax,%ebx
+     716:	6a 11                	push   $0x11
+     718:	50                   	push   %eax
+     719:	e8 38 06 00 00       	call   d56 <kill>
+    sleep(100);
+     71e:	c7 04 24 64 00 00 00 	movl   $0x64,(%esp)
+     725:	e8 8c 06 00 00       	call   db6 <sleep>
+		kill(pid,SIGCONT);
+     72a:	58                   	pop    %eax
+     72b:	5a                   	pop    %edx
+     72c:	6a 13                	push   $0x13
+     72e:	53                   	push   %ebx
+     72f:	e8 22 06 00 00       	call   d56 <kill>
+		wait();
+     734:	e8 f5 05 00 00       	call   d2e <wait>
+	printf(1,"stopContTest Passed\n\n");
+     739:	59                   	pop    %ecx
+     73a:	5b                   	pop    %ebx
+     73b:	68 d8 19 00 00       	push   $0x19d8
+     740:	6a 01                	push   $0x1
+     742:	e8 d9 0f 00 00       	call   1720 <printf>
+}
+     747:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     74a:	83 c4 10             	add    $0x10,%esp
+     74d:	c9                   	leave
+     74e:	c3                   	ret
+		printf(1,"fork failed\n");
+     74f:	50                   	push   %eax
+     750:	50                   	push   %eax
+     751:	68 67 19 00 00       	push   $0x1967
+     756:	6a 01                	push   $0x1
+     758:	e8 c3 0f 00 00       	call   1720 <printf>
+		exit();
+     75d:	e8 ae 05 00 00       	call   d10 <exit>
+     762:	bb 0f 00 00 00       	mov    $0xf,%ebx
+			fib(25);
+     767:	83 ec 0c             	sub    $0xc,%esp
+     76a:	6a 19                	push   $0x19
+     76c:	e8 4f f9 ff ff       	call   c0 <fib>
+     771:	83 c4 10             	add    $0x10,%esp
+		for(int i=0;i<15;i++){
+     774:	83 eb 01             	sub    $0x1,%ebx
+     777:	75 ee                	jne    767 <stopContTest+0x77>
+		printf(1,"child done\n");
+     779:	50                   	push   %eax
+     77a:	50                   	push   %eax
+     77b:	68 cc 19 00 00       	push   $0x19cc
+     780:	6a 01                	push   $0x1
+     782:	e8 99 0f 00 00       	call   1720 <printf>
+		exit();
+     787:	e8 84 05 00 00       	call   d10 <exit>
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <procMaskTest>:
+void procMaskTest(){
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	53                   	push   %ebx
+     794:	83 ec 1c             	sub    $0x1c,%esp
+	  printf(1,"procMaskTest \n");
+     797:	68 ee 19 00 00       	push   $0x19ee
+     79c:	6a 01                	push   $0x1
+     79e:	e8 7d 0f 00 00       	call   1720 <printf>
+    sigprocmask(mask);
+     7a3:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+     7aa:	e8 17 06 00 00       	call   dc6 <sigprocmask>
+	  kill(getpid(),SIGUSER3); // if test exits here then failed
+     7af:	e8 f2 05 00 00       	call   da6 <getpid>
+     7b4:	5b                   	pop    %ebx
+     7b5:	5a                   	pop    %edx
+     7b6:	6a 16                	push   $0x16
+     7b8:	50                   	push   %eax
+     7b9:	bb 18 00 00 00       	mov    $0x18,%ebx
+     7be:	e8 93 05 00 00       	call   d56 <kill>
+     7c3:	83 c4 10             	add    $0x10,%esp
+	else return fib(n-1)+fib(n-2);
+     7c6:	83 ec 0c             	sub    $0xc,%esp
+     7c9:	53                   	push   %ebx
+     7ca:	e8 f1 f8 ff ff       	call   c0 <fib>
+     7cf:	83 c4 10             	add    $0x10,%esp
+	if(n<=1)
+     7d2:	83 eb 02             	sub    $0x2,%ebx
+     7d5:	75 ef                	jne    7c6 <procMaskTest+0x36>
+    sigaction(SIGUSER3,&act,null);
+     7d7:	83 ec 04             	sub    $0x4,%esp
+     7da:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+    act.sa_handler = (void*)SIG_IGN;
+     7dd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    sigaction(SIGUSER3,&act,null);
+     7e4:	6a 00                	push   $0x0
+     7e6:	53                   	push   %ebx
+     7e7:	6a 16                	push   $0x16
+     7e9:	e8 e0 05 00 00       	call   dce <sigaction>
+    sigprocmask(0);
+     7ee:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     7f5:	e8 cc 05 00 00       	call   dc6 <sigprocmask>
+    sigaction(SIGUSER1,&act,null);
+     7fa:	83 c4 0c             	add    $0xc,%esp
+    act.sigmask = mask;
+     7fd:	c7 45 f4 00 00 20 00 	movl   $0x200000,-0xc(%ebp)
+    act.sa_handler = &bigHandler;
+     804:	c7 45 f0 c0 03 00 00 	movl   $0x3c0,-0x10(%ebp)
+    sigaction(SIGUSER1,&act,null);
+     80b:	6a 00                	push   $0x0
+     80d:	53                   	push   %ebx
+	  kill(getpid(),SIGUSER1);
+     80e:	bb 18 00 00 00       	mov    $0x18,%ebx
+    sigaction(SIGUSER1,&act,null);
+     813:	6a 14                	push   $0x14
+     815:	e8 b4 05 00 00       	call   dce <sigaction>
+	  kill(getpid(),SIGUSER1);
+     81a:	e8 87 05 00 00       	call   da6 <getpid>
+     81f:	5a                   	pop    %edx
+     820:	59                   	pop    %ecx
+     821:	6a 14                	push   $0x14
+     823:	50                   	push   %eax
+     824:	e8 2d 05 00 00       	call   d56 <kill>
+     829:	83 c4 10             	add    $0x10,%esp
+	else return fib(n-1)+fib(n-2);
+     82c:	83 ec 0c             	sub    $0xc,%esp
+     82f:	53                   	push   %ebx
+     830:	e8 8b f8 ff ff       	call   c0 <fib>
+     835:	83 c4 10             	add    $0x10,%esp
+	if(n<=1)
+     838:	83 eb 02             	sub    $0x2,%ebx
+     83b:	75 ef                	jne    82c <procMaskTest+0x9c>
+    flag = 0;
+     83d:	c7 05 00 23 00 00 00 	movl   $0x0,0x2300
+     844:	00 00 00 
+    printf(1,"procMaskTest Passed\n\n");
+     847:	83 ec 08             	sub    $0x8,%esp
+     84a:	68 fd 19 00 00       	push   $0x19fd
+     84f:	6a 01                	push   $0x1
+     851:	e8 ca 0e 00 00       	call   1720 <printf>
+}
+     856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     859:	c9                   	leave
+     85a:	c3                   	ret
+     85b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     85f:	90                   	nop
+
+00000860 <signalDefaultTest>:
+void signalDefaultTest(){
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+	sigaction(5,&act, &old);
+     864:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+void signalDefaultTest(){
+     867:	83 ec 1c             	sub    $0x1c,%esp
+  act.sa_handler = &userHandler1;
+     86a:	c7 45 e8 60 00 00 00 	movl   $0x60,-0x18(%ebp)
+  printf(1,"signalDefaultTest\n");
+     871:	68 13 1a 00 00       	push   $0x1a13
+     876:	6a 01                	push   $0x1
+     878:	e8 a3 0e 00 00       	call   1720 <printf>
+	sigaction(5,&act, &old);
+     87d:	83 c4 0c             	add    $0xc,%esp
+     880:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     883:	53                   	push   %ebx
+     884:	50                   	push   %eax
+     885:	6a 05                	push   $0x5
+     887:	e8 42 05 00 00       	call   dce <sigaction>
+  if(old.sa_handler != (void*)SIG_DFL){
+     88c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     88f:	83 c4 10             	add    $0x10,%esp
+     892:	85 c0                	test   %eax,%eax
+     894:	75 23                	jne    8b9 <signalDefaultTest+0x59>
+  sigaction(5,&old, null); 
+     896:	83 ec 04             	sub    $0x4,%esp
+     899:	6a 00                	push   $0x0
+     89b:	53                   	push   %ebx
+     89c:	6a 05                	push   $0x5
+     89e:	e8 2b 05 00 00       	call   dce <sigaction>
+  printf(1,"signalDefaultTest Passed\n\n");
+     8a3:	58                   	pop    %eax
+     8a4:	5a                   	pop    %edx
+     8a5:	68 26 1a 00 00       	push   $0x1a26
+     8aa:	6a 01                	push   $0x1
+     8ac:	e8 6f 0e 00 00       	call   1720 <printf>
+}
+     8b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8b4:	83 c4 10             	add    $0x10,%esp
+     8b7:	c9                   	leave
+     8b8:	c3                   	ret
+    printf(1,"signalDefaultTest fail signal 5 wasn't default ");
+     8b9:	51                   	push   %ecx
+     8ba:	51                   	push   %ecx
+     8bb:	68 e4 1a 00 00       	push   $0x1ae4
+     8c0:	6a 01                	push   $0x1
+     8c2:	e8 59 0e 00 00       	call   1720 <printf>
+    exit();
+     8c7:	e8 44 04 00 00       	call   d10 <exit>
+     8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <killIgnoreTest>:
+void killIgnoreTest(){
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	53                   	push   %ebx
+     8d4:	83 ec 1c             	sub    $0x1c,%esp
+	printf(1,"killIgnoreTest \n");
+     8d7:	68 41 1a 00 00       	push   $0x1a41
+     8dc:	6a 01                	push   $0x1
+     8de:	e8 3d 0e 00 00       	call   1720 <printf>
+  int p = fork();
+     8e3:	e8 3e 04 00 00       	call   d26 <fork>
+  if (p == 0) {
+     8e8:	83 c4 10             	add    $0x10,%esp
+     8eb:	85 c0                	test   %eax,%eax
+     8ed:	75 49                	jne    938 <killIgnoreTest+0x68>
+    sigaction(SIGKILL, &act, null);//1 - child ignores SIGKILL
+     8ef:	83 ec 04             	sub    $0x4,%esp
+     8f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     8f5:	bb 2c 00 00 00       	mov    $0x2c,%ebx
+    act.sa_handler = (void*)SIG_IGN;
+     8fa:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    sigaction(SIGKILL, &act, null);//1 - child ignores SIGKILL
+     901:	6a 00                	push   $0x0
+     903:	50                   	push   %eax
+     904:	6a 09                	push   $0x9
+     906:	e8 c3 04 00 00       	call   dce <sigaction>
+     90b:	83 c4 10             	add    $0x10,%esp
+	else return fib(n-1)+fib(n-2);
+     90e:	83 ec 0c             	sub    $0xc,%esp
+     911:	53                   	push   %ebx
+     912:	e8 a9 f7 ff ff       	call   c0 <fib>
+     917:	83 c4 10             	add    $0x10,%esp
+	if(n<=1)
+     91a:	83 eb 02             	sub    $0x2,%ebx
+     91d:	75 ef                	jne    90e <killIgnoreTest+0x3e>
+    printf(1,"killIgnoreTest failed: Ignoring SIGKILL!\n");
+     91f:	83 ec 08             	sub    $0x8,%esp
+     922:	68 14 1b 00 00       	push   $0x1b14
+     927:	6a 01                	push   $0x1
+     929:	e8 f2 0d 00 00       	call   1720 <printf>
+     92e:	83 c4 10             	add    $0x10,%esp
+    for(;;);
+     931:	eb fe                	jmp    931 <killIgnoreTest+0x61>
+     933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     937:	90                   	nop
+    sleep(5);
+     938:	83 ec 0c             	sub    $0xc,%esp
+     93b:	89 c3                	mov    %eax,%ebx
+     93d:	6a 05                	push   $0x5
+     93f:	e8 72 04 00 00       	call   db6 <sleep>
+    kill(p,SIGKILL);
+     944:	58                   	pop    %eax
+     945:	5a                   	pop    %edx
+     946:	6a 09                	push   $0x9
+     948:	53                   	push   %ebx
+     949:	e8 08 04 00 00       	call   d56 <kill>
+    wait();
+     94e:	e8 db 03 00 00       	call   d2e <wait>
+    printf(1,"killIgnoreTest Passed\n\n");
+     953:	59                   	pop    %ecx
+     954:	5b                   	pop    %ebx
+     955:	68 52 1a 00 00       	push   $0x1a52
+     95a:	6a 01                	push   $0x1
+     95c:	e8 bf 0d 00 00       	call   1720 <printf>
+}
+     961:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     964:	83 c4 10             	add    $0x10,%esp
+     967:	c9                   	leave
+     968:	c3                   	ret
+     969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <inheritTest>:
+void inheritTest(){
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	56                   	push   %esi
+     974:	53                   	push   %ebx
+     975:	83 ec 38             	sub    $0x38,%esp
+  printf(1,"inheritTest\n");
+     978:	68 6a 1a 00 00       	push   $0x1a6a
+     97d:	6a 01                	push   $0x1
+     97f:	e8 9c 0d 00 00       	call   1720 <printf>
+  act1.sa_handler = &userHandler1;
+     984:	c7 45 e0 60 00 00 00 	movl   $0x60,-0x20(%ebp)
+  act2.sa_handler = &userHandler2;
+     98b:	c7 45 e8 a0 00 00 00 	movl   $0xa0,-0x18(%ebp)
+  act3.sa_handler = &userHandler3;
+     992:	c7 45 f0 80 00 00 00 	movl   $0x80,-0x10(%ebp)
+  sigprocmask(((1 << 13) | (1 << 14) | (1 << 15)));
+     999:	c7 04 24 00 e0 00 00 	movl   $0xe000,(%esp)
+     9a0:	e8 21 04 00 00       	call   dc6 <sigprocmask>
+  sigaction(13, &act1, null);
+     9a5:	83 c4 0c             	add    $0xc,%esp
+     9a8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     9ab:	6a 00                	push   $0x0
+     9ad:	50                   	push   %eax
+     9ae:	6a 0d                	push   $0xd
+     9b0:	e8 19 04 00 00       	call   dce <sigaction>
+  sigaction(14, &act2, null);
+     9b5:	83 c4 0c             	add    $0xc,%esp
+     9b8:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     9bb:	6a 00                	push   $0x0
+     9bd:	50                   	push   %eax
+     9be:	6a 0e                	push   $0xe
+     9c0:	e8 09 04 00 00       	call   dce <sigaction>
+  sigaction(15, &act3, null);
+     9c5:	83 c4 0c             	add    $0xc,%esp
+     9c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     9cb:	6a 00                	push   $0x0
+     9cd:	50                   	push   %eax
+     9ce:	6a 0f                	push   $0xf
+     9d0:	e8 f9 03 00 00       	call   dce <sigaction>
+  int pid = fork();
+     9d5:	e8 4c 03 00 00       	call   d26 <fork>
+  if(pid < 0){
+     9da:	83 c4 10             	add    $0x10,%esp
+     9dd:	85 c0                	test   %eax,%eax
+     9df:	0f 88 d4 00 00 00    	js     ab9 <inheritTest+0x149>
+  if (pid == 0) {
+     9e5:	75 79                	jne    a60 <inheritTest+0xf0>
+      if (sigprocmask(0) != ((1 << 13) | (1 << 14) | (1 << 15))){
+     9e7:	83 ec 0c             	sub    $0xc,%esp
+     9ea:	6a 00                	push   $0x0
+     9ec:	e8 d5 03 00 00       	call   dc6 <sigprocmask>
+     9f1:	83 c4 10             	add    $0x10,%esp
+     9f4:	3d 00 e0 00 00       	cmp    $0xe000,%eax
+     9f9:	0f 85 94 00 00 00    	jne    a93 <inheritTest+0x123>
+      sigaction(13, &_act, &act);
+     9ff:	83 ec 04             	sub    $0x4,%esp
+     a02:	8d 75 d0             	lea    -0x30(%ebp),%esi
+     a05:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      _act.sa_handler = (void*)SIG_DFL;
+     a08:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+      sigaction(13, &_act, &act);
+     a0f:	56                   	push   %esi
+     a10:	53                   	push   %ebx
+     a11:	6a 0d                	push   $0xd
+     a13:	e8 b6 03 00 00       	call   dce <sigaction>
+      if(act.sa_handler != &userHandler1){
+     a18:	83 c4 10             	add    $0x10,%esp
+     a1b:	81 7d d0 60 00 00 00 	cmpl   $0x60,-0x30(%ebp)
+     a22:	0f 85 7e 00 00 00    	jne    aa6 <inheritTest+0x136>
+      sigaction(14, &_act, &act);
+     a28:	83 ec 04             	sub    $0x4,%esp
+     a2b:	56                   	push   %esi
+     a2c:	53                   	push   %ebx
+     a2d:	6a 0e                	push   $0xe
+     a2f:	e8 9a 03 00 00       	call   dce <sigaction>
+      if(act.sa_handler != &userHandler2){
+     a34:	83 c4 10             	add    $0x10,%esp
+     a37:	81 7d d0 a0 00 00 00 	cmpl   $0xa0,-0x30(%ebp)
+     a3e:	75 66                	jne    aa6 <inheritTest+0x136>
+      sigaction(15, &_act, &act);
+     a40:	83 ec 04             	sub    $0x4,%esp
+     a43:	56                   	push   %esi
+     a44:	53                   	push   %ebx
+     a45:	6a 0f                	push   $0xf
+     a47:	e8 82 03 00 00       	call   dce <sigaction>
+      if(act.sa_handler != &userHandler3){
+     a4c:	83 c4 10             	add    $0x10,%esp
+     a4f:	81 7d d0 80 00 00 00 	cmpl   $0x80,-0x30(%ebp)
+     a56:	75 4e                	jne    aa6 <inheritTest+0x136>
+      for(;;);
+     a58:	eb fe                	jmp    a58 <inheritTest+0xe8>
+     a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      sleep(20);
+     a60:	83 ec 0c             	sub    $0xc,%esp
+     a63:	89 c3                	mov    %eax,%ebx
+     a65:	6a 14                	push   $0x14
+     a67:	e8 4a 03 00 00       	call   db6 <sleep>
+      kill(pid,15);
+     a6c:	58                   	pop    %eax
+     a6d:	5a                   	pop    %edx
+     a6e:	6a 0f                	push   $0xf
+     a70:	53                   	push   %ebx
+     a71:	e8 e0 02 00 00       	call   d56 <kill>
+      wait();
+     a76:	e8 b3 02 00 00       	call   d2e <wait>
+  printf(1,"inheritTest Passed\n\n");
+     a7b:	59                   	pop    %ecx
+     a7c:	5b                   	pop    %ebx
+     a7d:	68 93 1a 00 00       	push   $0x1a93
+     a82:	6a 01                	push   $0x1
+     a84:	e8 97 0c 00 00       	call   1720 <printf>
+}
+     a89:	83 c4 10             	add    $0x10,%esp
+     a8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a8f:	5b                   	pop    %ebx
+     a90:	5e                   	pop    %esi
+     a91:	5d                   	pop    %ebp
+     a92:	c3                   	ret
+          printf(1,"inheritTest failed : Child didnt inherit mask array\n");
+     a93:	50                   	push   %eax
+     a94:	50                   	push   %eax
+     a95:	68 40 1b 00 00       	push   $0x1b40
+     a9a:	6a 01                	push   $0x1
+     a9c:	e8 7f 0c 00 00       	call   1720 <printf>
+          exit();
+     aa1:	e8 6a 02 00 00       	call   d10 <exit>
+          printf(1,"inheritTest failed : Child didnt inherit signal handler\n");
+     aa6:	56                   	push   %esi
+     aa7:	56                   	push   %esi
+     aa8:	68 78 1b 00 00       	push   $0x1b78
+     aad:	6a 01                	push   $0x1
+     aaf:	e8 6c 0c 00 00       	call   1720 <printf>
+          exit();
+     ab4:	e8 57 02 00 00       	call   d10 <exit>
+    printf(1,"inheritTest failed in fork\n");
+     ab9:	50                   	push   %eax
+     aba:	50                   	push   %eax
+     abb:	68 77 1a 00 00       	push   $0x1a77
+     ac0:	6a 01                	push   $0x1
+     ac2:	e8 59 0c 00 00       	call   1720 <printf>
+    exit();
+     ac7:	e8 44 02 00 00       	call   d10 <exit>
+     acc:	66 90                	xchg   %ax,%ax
+     ace:	66 90                	xchg   %ax,%ax
+
+00000ad0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     ad0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     ad1:	31 c0                	xor    %eax,%eax
+{
+     ad3:	89 e5                	mov    %esp,%ebp
+     ad5:	53                   	push   %ebx
+     ad6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ad9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     ae0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     ae4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     ae7:	83 c0 01             	add    $0x1,%eax
+     aea:	84 d2                	test   %dl,%dl
+     aec:	75 f2                	jne    ae0 <strcpy+0x10>
+    ;
+  return os;
+}
+     aee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     af1:	89 c8                	mov    %ecx,%eax
+     af3:	c9                   	leave
+     af4:	c3                   	ret
+     af5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	53                   	push   %ebx
+     b04:	8b 55 08             	mov    0x8(%ebp),%edx
+     b07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     b0a:	0f b6 02             	movzbl (%edx),%eax
+     b0d:	84 c0                	test   %al,%al
+     b0f:	75 17                	jne    b28 <strcmp+0x28>
+     b11:	eb 3a                	jmp    b4d <strcmp+0x4d>
+     b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b17:	90                   	nop
+     b18:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b1c:	83 c2 01             	add    $0x1,%edx
+     b1f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     b22:	84 c0                	test   %al,%al
+     b24:	74 1a                	je     b40 <strcmp+0x40>
+    p++, q++;
+     b26:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     b28:	0f b6 19             	movzbl (%ecx),%ebx
+     b2b:	38 c3                	cmp    %al,%bl
+     b2d:	74 e9                	je     b18 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     b2f:	29 d8                	sub    %ebx,%eax
+}
+     b31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b34:	c9                   	leave
+     b35:	c3                   	ret
+     b36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     b40:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     b44:	31 c0                	xor    %eax,%eax
+     b46:	29 d8                	sub    %ebx,%eax
+}
+     b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b4b:	c9                   	leave
+     b4c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     b4d:	0f b6 19             	movzbl (%ecx),%ebx
+     b50:	31 c0                	xor    %eax,%eax
+     b52:	eb db                	jmp    b2f <strcmp+0x2f>
+     b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     b66:	80 3a 00             	cmpb   $0x0,(%edx)
+     b69:	74 15                	je     b80 <strlen+0x20>
+     b6b:	31 c0                	xor    %eax,%eax
+     b6d:	8d 76 00             	lea    0x0(%esi),%esi
+     b70:	83 c0 01             	add    $0x1,%eax
+     b73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b77:	89 c1                	mov    %eax,%ecx
+     b79:	75 f5                	jne    b70 <strlen+0x10>
+    ;
+  return n;
+}
+     b7b:	89 c8                	mov    %ecx,%eax
+     b7d:	5d                   	pop    %ebp
+     b7e:	c3                   	ret
+     b7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     b80:	31 c9                	xor    %ecx,%ecx
+}
+     b82:	5d                   	pop    %ebp
+     b83:	89 c8                	mov    %ecx,%eax
+     b85:	c3                   	ret
+     b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	57                   	push   %edi
+     b94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     b97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b9d:	89 d7                	mov    %edx,%edi
+     b9f:	fc                   	cld
+     ba0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ba2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ba5:	89 d0                	mov    %edx,%eax
+     ba7:	c9                   	leave
+     ba8:	c3                   	ret
+     ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bb0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     bba:	0f b6 10             	movzbl (%eax),%edx
+     bbd:	84 d2                	test   %dl,%dl
+     bbf:	75 12                	jne    bd3 <strchr+0x23>
+     bc1:	eb 1d                	jmp    be0 <strchr+0x30>
+     bc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bc7:	90                   	nop
+     bc8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     bcc:	83 c0 01             	add    $0x1,%eax
+     bcf:	84 d2                	test   %dl,%dl
+     bd1:	74 0d                	je     be0 <strchr+0x30>
+    if(*s == c)
+     bd3:	38 d1                	cmp    %dl,%cl
+     bd5:	75 f1                	jne    bc8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     bd7:	5d                   	pop    %ebp
+     bd8:	c3                   	ret
+     bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     be0:	31 c0                	xor    %eax,%eax
+}
+     be2:	5d                   	pop    %ebp
+     be3:	c3                   	ret
+     be4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     bf5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     bf8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     bf9:	31 db                	xor    %ebx,%ebx
+{
+     bfb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     bfe:	eb 27                	jmp    c27 <gets+0x37>
+    cc = read(0, &c, 1);
+     c00:	83 ec 04             	sub    $0x4,%esp
+     c03:	6a 01                	push   $0x1
+     c05:	56                   	push   %esi
+     c06:	6a 00                	push   $0x0
+     c08:	e8 31 01 00 00       	call   d3e <read>
+    if(cc < 1)
+     c0d:	83 c4 10             	add    $0x10,%esp
+     c10:	85 c0                	test   %eax,%eax
+     c12:	7e 1d                	jle    c31 <gets+0x41>
+      break;
+    buf[i++] = c;
+     c14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c18:	8b 55 08             	mov    0x8(%ebp),%edx
+     c1b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     c1f:	3c 0a                	cmp    $0xa,%al
+     c21:	74 10                	je     c33 <gets+0x43>
+     c23:	3c 0d                	cmp    $0xd,%al
+     c25:	74 0c                	je     c33 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     c27:	89 df                	mov    %ebx,%edi
+     c29:	83 c3 01             	add    $0x1,%ebx
+     c2c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     c2f:	7c cf                	jl     c00 <gets+0x10>
+     c31:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     c33:	8b 45 08             	mov    0x8(%ebp),%eax
+     c36:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     c3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c3d:	5b                   	pop    %ebx
+     c3e:	5e                   	pop    %esi
+     c3f:	5f                   	pop    %edi
+     c40:	5d                   	pop    %ebp
+     c41:	c3                   	ret
+     c42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c50 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	56                   	push   %esi
+     c54:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     c55:	83 ec 08             	sub    $0x8,%esp
+     c58:	6a 00                	push   $0x0
+     c5a:	ff 75 08             	push   0x8(%ebp)
+     c5d:	e8 04 01 00 00       	call   d66 <open>
+  if(fd < 0)
+     c62:	83 c4 10             	add    $0x10,%esp
+     c65:	85 c0                	test   %eax,%eax
+     c67:	78 27                	js     c90 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     c69:	83 ec 08             	sub    $0x8,%esp
+     c6c:	ff 75 0c             	push   0xc(%ebp)
+     c6f:	89 c3                	mov    %eax,%ebx
+     c71:	50                   	push   %eax
+     c72:	e8 07 01 00 00       	call   d7e <fstat>
+  close(fd);
+     c77:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     c7a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     c7c:	e8 cd 00 00 00       	call   d4e <close>
+  return r;
+     c81:	83 c4 10             	add    $0x10,%esp
+}
+     c84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c87:	89 f0                	mov    %esi,%eax
+     c89:	5b                   	pop    %ebx
+     c8a:	5e                   	pop    %esi
+     c8b:	5d                   	pop    %ebp
+     c8c:	c3                   	ret
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     c90:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     c95:	eb ed                	jmp    c84 <stat+0x34>
+     c97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c9e:	66 90                	xchg   %ax,%ax
+
+00000ca0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	53                   	push   %ebx
+     ca4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     ca7:	0f be 02             	movsbl (%edx),%eax
+     caa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     cad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     cb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     cb5:	77 1e                	ja     cd5 <atoi+0x35>
+     cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     cc0:	83 c2 01             	add    $0x1,%edx
+     cc3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     cc6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     cca:	0f be 02             	movsbl (%edx),%eax
+     ccd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     cd0:	80 fb 09             	cmp    $0x9,%bl
+     cd3:	76 eb                	jbe    cc0 <atoi+0x20>
+  return n;
+}
+     cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cd8:	89 c8                	mov    %ecx,%eax
+     cda:	c9                   	leave
+     cdb:	c3                   	ret
+     cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ce0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	57                   	push   %edi
+     ce4:	56                   	push   %esi
+     ce5:	8b 45 10             	mov    0x10(%ebp),%eax
+     ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+     ceb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     cee:	85 c0                	test   %eax,%eax
+     cf0:	7e 13                	jle    d05 <memmove+0x25>
+     cf2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     cf4:	89 d7                	mov    %edx,%edi
+     cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     d00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     d01:	39 f8                	cmp    %edi,%eax
+     d03:	75 fb                	jne    d00 <memmove+0x20>
+  return vdst;
+}
+     d05:	5e                   	pop    %esi
+     d06:	89 d0                	mov    %edx,%eax
+     d08:	5f                   	pop    %edi
+     d09:	5d                   	pop    %ebp
+     d0a:	c3                   	ret
+     d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+
+00000d10 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+     d16:	a1 04 23 00 00       	mov    0x2304,%eax
+     d1b:	85 c0                	test   %eax,%eax
+     d1d:	74 02                	je     d21 <exit+0x11>
+    exithook();
+     d1f:	ff d0                	call   *%eax
+  _exit();
+     d21:	e8 10 01 00 00       	call   e36 <_exit>
+
+00000d26 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     d26:	b8 01 00 00 00       	mov    $0x1,%eax
+     d2b:	cd 40                	int    $0x40
+     d2d:	c3                   	ret
+
+00000d2e <wait>:
+SYSCALL(wait)
+     d2e:	b8 03 00 00 00       	mov    $0x3,%eax
+     d33:	cd 40                	int    $0x40
+     d35:	c3                   	ret
+
+00000d36 <pipe>:
+SYSCALL(pipe)
+     d36:	b8 04 00 00 00       	mov    $0x4,%eax
+     d3b:	cd 40                	int    $0x40
+     d3d:	c3                   	ret
+
+00000d3e <read>:
+SYSCALL(read)
+     d3e:	b8 05 00 00 00       	mov    $0x5,%eax
+     d43:	cd 40                	int    $0x40
+     d45:	c3                   	ret
+
+00000d46 <write>:
+SYSCALL(write)
+     d46:	b8 10 00 00 00       	mov    $0x10,%eax
+     d4b:	cd 40                	int    $0x40
+     d4d:	c3                   	ret
+
+00000d4e <close>:
+SYSCALL(close)
+     d4e:	b8 15 00 00 00       	mov    $0x15,%eax
+     d53:	cd 40                	int    $0x40
+     d55:	c3                   	ret
+
+00000d56 <kill>:
+SYSCALL(kill)
+     d56:	b8 06 00 00 00       	mov    $0x6,%eax
+     d5b:	cd 40                	int    $0x40
+     d5d:	c3                   	ret
+
+00000d5e <exec>:
+SYSCALL(exec)
+     d5e:	b8 07 00 00 00       	mov    $0x7,%eax
+     d63:	cd 40                	int    $0x40
+     d65:	c3                   	ret
+
+00000d66 <open>:
+SYSCALL(open)
+     d66:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d6b:	cd 40                	int    $0x40
+     d6d:	c3                   	ret
+
+00000d6e <mknod>:
+SYSCALL(mknod)
+     d6e:	b8 11 00 00 00       	mov    $0x11,%eax
+     d73:	cd 40                	int    $0x40
+     d75:	c3                   	ret
+
+00000d76 <unlink>:
+SYSCALL(unlink)
+     d76:	b8 12 00 00 00       	mov    $0x12,%eax
+     d7b:	cd 40                	int    $0x40
+     d7d:	c3                   	ret
+
+00000d7e <fstat>:
+SYSCALL(fstat)
+     d7e:	b8 08 00 00 00       	mov    $0x8,%eax
+     d83:	cd 40                	int    $0x40
+     d85:	c3                   	ret
+
+00000d86 <link>:
+SYSCALL(link)
+     d86:	b8 13 00 00 00       	mov    $0x13,%eax
+     d8b:	cd 40                	int    $0x40
+     d8d:	c3                   	ret
+
+00000d8e <mkdir>:
+SYSCALL(mkdir)
+     d8e:	b8 14 00 00 00       	mov    $0x14,%eax
+     d93:	cd 40                	int    $0x40
+     d95:	c3                   	ret
+
+00000d96 <chdir>:
+SYSCALL(chdir)
+     d96:	b8 09 00 00 00       	mov    $0x9,%eax
+     d9b:	cd 40                	int    $0x40
+     d9d:	c3                   	ret
+
+00000d9e <dup>:
+SYSCALL(dup)
+     d9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     da3:	cd 40                	int    $0x40
+     da5:	c3                   	ret
+
+00000da6 <getpid>:
+SYSCALL(getpid)
+     da6:	b8 0b 00 00 00       	mov    $0xb,%eax
+     dab:	cd 40                	int    $0x40
+     dad:	c3                   	ret
+
+00000dae <sbrk>:
+SYSCALL(sbrk)
+     dae:	b8 0c 00 00 00       	mov    $0xc,%eax
+     db3:	cd 40                	int    $0x40
+     db5:	c3                   	ret
+
+00000db6 <sleep>:
+SYSCALL(sleep)
+     db6:	b8 0d 00 00 00       	mov    $0xd,%eax
+     dbb:	cd 40                	int    $0x40
+     dbd:	c3                   	ret
+
+00000dbe <uptime>:
+SYSCALL(uptime)
+     dbe:	b8 0e 00 00 00       	mov    $0xe,%eax
+     dc3:	cd 40                	int    $0x40
+     dc5:	c3                   	ret
+
+00000dc6 <sigprocmask>:
+SYSCALL(sigprocmask)
+     dc6:	b8 16 00 00 00       	mov    $0x16,%eax
+     dcb:	cd 40                	int    $0x40
+     dcd:	c3                   	ret
+
+00000dce <sigaction>:
+SYSCALL(sigaction)
+     dce:	b8 17 00 00 00       	mov    $0x17,%eax
+     dd3:	cd 40                	int    $0x40
+     dd5:	c3                   	ret
+
+00000dd6 <sigret>:
+SYSCALL(sigret)
+     dd6:	b8 18 00 00 00       	mov    $0x18,%eax
+     ddb:	cd 40                	int    $0x40
+     ddd:	c3                   	ret
+
+00000dde <readv>:
+SYSCALL(readv)
+     dde:	b8 19 00 00 00       	mov    $0x19,%eax
+     de3:	cd 40                	int    $0x40
+     de5:	c3                   	ret
+
+00000de6 <writev>:
+SYSCALL(writev)
+     de6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     deb:	cd 40                	int    $0x40
+     ded:	c3                   	ret
+
+00000dee <nanosleep>:
+SYSCALL(nanosleep)
+     dee:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     df3:	cd 40                	int    $0x40
+     df5:	c3                   	ret
+
+00000df6 <setpriority>:
+SYSCALL(setpriority)
+     df6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     dfb:	cd 40                	int    $0x40
+     dfd:	c3                   	ret
+
+00000dfe <sched_setattr>:
+SYSCALL(sched_setattr)
+     dfe:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     e03:	cd 40                	int    $0x40
+     e05:	c3                   	ret
+
+00000e06 <sched_yield>:
+SYSCALL(sched_yield)
+     e06:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     e0b:	cd 40                	int    $0x40
+     e0d:	c3                   	ret
+
+00000e0e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     e0e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     e13:	cd 40                	int    $0x40
+     e15:	c3                   	ret
+
+00000e16 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     e16:	b8 20 00 00 00       	mov    $0x20,%eax
+     e1b:	cd 40                	int    $0x40
+     e1d:	c3                   	ret
+
+00000e1e <getrusage>:
+SYSCALL(getrusage)
+     e1e:	b8 21 00 00 00       	mov    $0x21,%eax
+     e23:	cd 40                	int    $0x40
+     e25:	c3                   	ret
+
+00000e26 <syslat>:
+SYSCALL(syslat)
+     e26:	b8 22 00 00 00       	mov    $0x22,%eax
+     e2b:	cd 40                	int    $0x40
+     e2d:	c3                   	ret
+
+00000e2e <sched_getattr>:
+SYSCALL(sched_getattr)
+     e2e:	b8 23 00 00 00       	mov    $0x23,%eax
+     e33:	cd 40                	int    $0x40
+     e35:	c3                   	ret
+
+00000e36 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+     e36:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+     e3b:	cd 40                	int    $0x40
+  ret
+     e3d:	c3                   	ret
+     e3e:	66 90                	xchg   %ax,%ax
+
+00000e40 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	56                   	push   %esi
+     e44:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+     e45:	31 db                	xor    %ebx,%ebx
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+     e50:	8b 34 9d 20 23 00 00 	mov    0x2320(,%ebx,4),%esi
+     e57:	85 f6                	test   %esi,%esi
+     e59:	74 27                	je     e82 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e5b:	8b 46 08             	mov    0x8(%esi),%eax
+     e5e:	85 c0                	test   %eax,%eax
+     e60:	7e 12                	jle    e74 <flushall+0x34>
+     e62:	83 ec 04             	sub    $0x4,%esp
+     e65:	50                   	push   %eax
+     e66:	8d 46 10             	lea    0x10(%esi),%eax
+     e69:	50                   	push   %eax
+     e6a:	ff 36                	push   (%esi)
+     e6c:	e8 d5 fe ff ff       	call   d46 <write>
+     e71:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+     e74:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     e7b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+     e82:	83 c3 01             	add    $0x1,%ebx
+     e85:	83 fb 10             	cmp    $0x10,%ebx
+     e88:	75 c6                	jne    e50 <flushall+0x10>
+}
+     e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e8d:	5b                   	pop    %ebx
+     e8e:	5e                   	pop    %esi
+     e8f:	5d                   	pop    %ebp
+     e90:	c3                   	ret
+     e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+
+00000ea0 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     ea8:	89 d1                	mov    %edx,%ecx
+{
+     eaa:	83 ec 2c             	sub    $0x2c,%esp
+     ead:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     eb0:	85 d2                	test   %edx,%edx
+     eb2:	0f 89 c8 00 00 00    	jns    f80 <printint+0xe0>
+     eb8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     ebc:	0f 84 be 00 00 00    	je     f80 <printint+0xe0>
+    x = -xx;
+     ec2:	f7 d9                	neg    %ecx
+    neg = 1;
+     ec4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ec9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     ecc:	31 f6                	xor    %esi,%esi
+     ece:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+     ed0:	89 c8                	mov    %ecx,%eax
+     ed2:	31 d2                	xor    %edx,%edx
+     ed4:	89 f7                	mov    %esi,%edi
+     ed6:	f7 f3                	div    %ebx
+     ed8:	8d 76 01             	lea    0x1(%esi),%esi
+     edb:	0f b6 92 34 1c 00 00 	movzbl 0x1c34(%edx),%edx
+     ee2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ee6:	89 ca                	mov    %ecx,%edx
+     ee8:	89 c1                	mov    %eax,%ecx
+     eea:	39 da                	cmp    %ebx,%edx
+     eec:	73 e2                	jae    ed0 <printint+0x30>
+  if(neg)
+     eee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     ef1:	85 c0                	test   %eax,%eax
+     ef3:	74 07                	je     efc <printint+0x5c>
+    buf[i++] = '-';
+     ef5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     efa:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+     efc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     eff:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     f02:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     f04:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+     f07:	8b 41 08             	mov    0x8(%ecx),%eax
+     f0a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     f0d:	89 ce                	mov    %ecx,%esi
+     f0f:	eb 28                	jmp    f39 <printint+0x99>
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+     f18:	89 c1                	mov    %eax,%ecx
+     f1a:	83 c0 01             	add    $0x1,%eax
+     f1d:	89 46 08             	mov    %eax,0x8(%esi)
+     f20:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     f24:	80 fa 0a             	cmp    $0xa,%dl
+     f27:	75 07                	jne    f30 <printint+0x90>
+    f->nl = 1;
+     f29:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+     f30:	8d 57 ff             	lea    -0x1(%edi),%edx
+     f33:	39 fb                	cmp    %edi,%ebx
+     f35:	74 39                	je     f70 <printint+0xd0>
+     f37:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+     f39:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+     f3c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     f41:	75 d5                	jne    f18 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     f43:	83 ec 04             	sub    $0x4,%esp
+     f46:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+     f49:	68 00 02 00 00       	push   $0x200
+     f4e:	ff 75 d0             	push   -0x30(%ebp)
+     f51:	ff 36                	push   (%esi)
+     f53:	e8 ee fd ff ff       	call   d46 <write>
+  return r;
+     f58:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+     f5c:	83 c4 10             	add    $0x10,%esp
+     f5f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     f61:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     f68:	b8 01 00 00 00       	mov    $0x1,%eax
+     f6d:	eb ae                	jmp    f1d <printint+0x7d>
+     f6f:	90                   	nop
+}
+     f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f73:	5b                   	pop    %ebx
+     f74:	5e                   	pop    %esi
+     f75:	5f                   	pop    %edi
+     f76:	5d                   	pop    %ebp
+     f77:	c3                   	ret
+     f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+  neg = 0;
+     f80:	31 c0                	xor    %eax,%eax
+     f82:	e9 42 ff ff ff       	jmp    ec9 <printint+0x29>
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+
+00000f90 <bputc>:
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	53                   	push   %ebx
+     f94:	89 c3                	mov    %eax,%ebx
+     f96:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+     f99:	8b 40 08             	mov    0x8(%eax),%eax
+     f9c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     fa1:	74 1d                	je     fc0 <bputc+0x30>
+  f->buf[f->n++] = c;
+     fa3:	8d 48 01             	lea    0x1(%eax),%ecx
+     fa6:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     fa9:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     fad:	80 fa 0a             	cmp    $0xa,%dl
+     fb0:	75 07                	jne    fb9 <bputc+0x29>
+    f->nl = 1;
+     fb2:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+     fb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fbc:	c9                   	leave
+     fbd:	c3                   	ret
+     fbe:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     fc0:	83 ec 04             	sub    $0x4,%esp
+     fc3:	8d 43 10             	lea    0x10(%ebx),%eax
+     fc6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     fc9:	68 00 02 00 00       	push   $0x200
+     fce:	50                   	push   %eax
+     fcf:	ff 33                	push   (%ebx)
+     fd1:	e8 70 fd ff ff       	call   d46 <write>
+  return r;
+     fd6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fd9:	83 c4 10             	add    $0x10,%esp
+     fdc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     fe1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     fe8:	31 c0                	xor    %eax,%eax
+     fea:	eb ba                	jmp    fa6 <bputc+0x16>
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 1c             	sub    $0x1c,%esp
+     ff9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     ffc:	0f b6 0a             	movzbl (%edx),%ecx
+     fff:	84 c9                	test   %cl,%cl
+    1001:	74 47                	je     104a <vfprintf+0x5a>
+    1003:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1006:	89 c7                	mov    %eax,%edi
+    1008:	31 d2                	xor    %edx,%edx
+    100a:	89 de                	mov    %ebx,%esi
+    100c:	89 cb                	mov    %ecx,%ebx
+    100e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    1010:	0f be cb             	movsbl %bl,%ecx
+    1013:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1016:	85 d2                	test   %edx,%edx
+    1018:	75 4e                	jne    1068 <vfprintf+0x78>
+      if(c == '%'){
+    101a:	83 f8 25             	cmp    $0x25,%eax
+    101d:	74 69                	je     1088 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+    101f:	8b 47 08             	mov    0x8(%edi),%eax
+    1022:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1027:	0f 84 73 01 00 00    	je     11a0 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+    102d:	8d 48 01             	lea    0x1(%eax),%ecx
+    1030:	89 4f 08             	mov    %ecx,0x8(%edi)
+    1033:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+    1037:	80 fb 0a             	cmp    $0xa,%bl
+    103a:	74 1c                	je     1058 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+    103c:	31 d2                	xor    %edx,%edx
+    103e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+    1040:	0f b6 1e             	movzbl (%esi),%ebx
+    1043:	83 c6 01             	add    $0x1,%esi
+    1046:	84 db                	test   %bl,%bl
+    1048:	75 c6                	jne    1010 <vfprintf+0x20>
+    }
+  }
+}
+    104a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    104d:	5b                   	pop    %ebx
+    104e:	5e                   	pop    %esi
+    104f:	5f                   	pop    %edi
+    1050:	5d                   	pop    %ebp
+    1051:	c3                   	ret
+    1052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+    1058:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+    105f:	eb df                	jmp    1040 <vfprintf+0x50>
+    1061:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+    1068:	83 fa 25             	cmp    $0x25,%edx
+    106b:	75 d3                	jne    1040 <vfprintf+0x50>
+      if(c == 'd'){
+    106d:	83 f8 25             	cmp    $0x25,%eax
+    1070:	74 37                	je     10a9 <vfprintf+0xb9>
+    1072:	83 e8 63             	sub    $0x63,%eax
+    1075:	83 f8 15             	cmp    $0x15,%eax
+    1078:	77 16                	ja     1090 <vfprintf+0xa0>
+    107a:	ff 24 85 dc 1b 00 00 	jmp    *0x1bdc(,%eax,4)
+    1081:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+    1088:	ba 25 00 00 00       	mov    $0x25,%edx
+    108d:	eb b1                	jmp    1040 <vfprintf+0x50>
+    108f:	90                   	nop
+  if(f->n == BUFSIZ)
+    1090:	8b 47 08             	mov    0x8(%edi),%eax
+    1093:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1098:	0f 84 4c 01 00 00    	je     11ea <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+    109e:	8d 50 01             	lea    0x1(%eax),%edx
+    10a1:	89 57 08             	mov    %edx,0x8(%edi)
+    10a4:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+    10a9:	89 ca                	mov    %ecx,%edx
+    10ab:	89 f8                	mov    %edi,%eax
+    10ad:	e8 de fe ff ff       	call   f90 <bputc>
+    10b2:	eb 88                	jmp    103c <vfprintf+0x4c>
+    10b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+    10b8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    10bb:	83 ec 0c             	sub    $0xc,%esp
+    10be:	b9 10 00 00 00       	mov    $0x10,%ecx
+    10c3:	8b 13                	mov    (%ebx),%edx
+    10c5:	6a 00                	push   $0x0
+    10c7:	89 f8                	mov    %edi,%eax
+        ap++;
+    10c9:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+    10cc:	e8 cf fd ff ff       	call   ea0 <printint>
+        ap++;
+    10d1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    10d4:	83 c4 10             	add    $0x10,%esp
+    10d7:	e9 60 ff ff ff       	jmp    103c <vfprintf+0x4c>
+    10dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+    10e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10e3:	8b 10                	mov    (%eax),%edx
+        ap++;
+    10e5:	83 c0 04             	add    $0x4,%eax
+    10e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    10eb:	85 d2                	test   %edx,%edx
+    10ed:	0f 84 dd 00 00 00    	je     11d0 <vfprintf+0x1e0>
+        while(*s != 0){
+    10f3:	0f b6 1a             	movzbl (%edx),%ebx
+    10f6:	84 db                	test   %bl,%bl
+    10f8:	0f 84 3e ff ff ff    	je     103c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    10fe:	8d 4f 10             	lea    0x10(%edi),%ecx
+    1101:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+    1104:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1107:	89 fe                	mov    %edi,%esi
+    1109:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    110c:	89 d7                	mov    %edx,%edi
+    110e:	eb 27                	jmp    1137 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+    1110:	89 c1                	mov    %eax,%ecx
+    1112:	83 c0 01             	add    $0x1,%eax
+    1115:	89 46 08             	mov    %eax,0x8(%esi)
+    1118:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    111c:	80 fb 0a             	cmp    $0xa,%bl
+    111f:	75 07                	jne    1128 <vfprintf+0x138>
+    f->nl = 1;
+    1121:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+    1128:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+    112c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+    112f:	84 db                	test   %bl,%bl
+    1131:	0f 84 a9 00 00 00    	je     11e0 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+    1137:	3d 00 02 00 00       	cmp    $0x200,%eax
+    113c:	75 d2                	jne    1110 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    113e:	83 ec 04             	sub    $0x4,%esp
+    1141:	68 00 02 00 00       	push   $0x200
+    1146:	ff 75 e0             	push   -0x20(%ebp)
+    1149:	ff 36                	push   (%esi)
+    114b:	e8 f6 fb ff ff       	call   d46 <write>
+  return r;
+    1150:	83 c4 10             	add    $0x10,%esp
+    1153:	b8 01 00 00 00       	mov    $0x1,%eax
+    1158:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    115a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    1161:	eb b2                	jmp    1115 <vfprintf+0x125>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+        printint(f, *ap, 10, 1);
+    1168:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    116b:	83 ec 0c             	sub    $0xc,%esp
+    116e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1173:	8b 13                	mov    (%ebx),%edx
+    1175:	6a 01                	push   $0x1
+    1177:	e9 4b ff ff ff       	jmp    10c7 <vfprintf+0xd7>
+    117c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+    1180:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1183:	89 f8                	mov    %edi,%eax
+    1185:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+    1188:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+    118b:	e8 00 fe ff ff       	call   f90 <bputc>
+        ap++;
+    1190:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+    1193:	31 d2                	xor    %edx,%edx
+    1195:	e9 a6 fe ff ff       	jmp    1040 <vfprintf+0x50>
+    119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    11a0:	83 ec 04             	sub    $0x4,%esp
+    11a3:	8d 47 10             	lea    0x10(%edi),%eax
+    11a6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    11a9:	68 00 02 00 00       	push   $0x200
+    11ae:	50                   	push   %eax
+    11af:	ff 37                	push   (%edi)
+    11b1:	e8 90 fb ff ff       	call   d46 <write>
+  return r;
+    11b6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    11b9:	83 c4 10             	add    $0x10,%esp
+    11bc:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+    11be:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+    11c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11ca:	e9 61 fe ff ff       	jmp    1030 <vfprintf+0x40>
+    11cf:	90                   	nop
+          s = "(null)";
+    11d0:	ba d4 1b 00 00       	mov    $0x1bd4,%edx
+    11d5:	bb 28 00 00 00       	mov    $0x28,%ebx
+    11da:	e9 1f ff ff ff       	jmp    10fe <vfprintf+0x10e>
+    11df:	90                   	nop
+    11e0:	89 f7                	mov    %esi,%edi
+    11e2:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    11e5:	e9 52 fe ff ff       	jmp    103c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    11ea:	83 ec 04             	sub    $0x4,%esp
+    11ed:	8d 47 10             	lea    0x10(%edi),%eax
+    11f0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    11f3:	68 00 02 00 00       	push   $0x200
+    11f8:	50                   	push   %eax
+    11f9:	ff 37                	push   (%edi)
+    11fb:	e8 46 fb ff ff       	call   d46 <write>
+  return r;
+    1200:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1203:	83 c4 10             	add    $0x10,%esp
+    1206:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+    120b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+    1212:	31 c0                	xor    %eax,%eax
+    1214:	e9 88 fe ff ff       	jmp    10a1 <vfprintf+0xb1>
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <fdopen>:
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	56                   	push   %esi
+    1224:	53                   	push   %ebx
+    1225:	83 ec 20             	sub    $0x20,%esp
+    1228:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+    122b:	83 fe 0f             	cmp    $0xf,%esi
+    122e:	0f 87 84 00 00 00    	ja     12b8 <fdopen+0x98>
+  if(streams[fd])
+    1234:	8b 1c b5 20 23 00 00 	mov    0x2320(,%esi,4),%ebx
+    123b:	85 db                	test   %ebx,%ebx
+    123d:	74 11                	je     1250 <fdopen+0x30>
+}
+    123f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1242:	89 d8                	mov    %ebx,%eax
+    1244:	5b                   	pop    %ebx
+    1245:	5e                   	pop    %esi
+    1246:	5d                   	pop    %ebp
+    1247:	c3                   	ret
+    1248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+    1250:	83 ec 0c             	sub    $0xc,%esp
+    1253:	68 10 02 00 00       	push   $0x210
+    1258:	e8 e3 05 00 00       	call   1840 <malloc>
+    125d:	83 c4 10             	add    $0x10,%esp
+    1260:	89 c3                	mov    %eax,%ebx
+    1262:	85 c0                	test   %eax,%eax
+    1264:	74 52                	je     12b8 <fdopen+0x98>
+  f->fd = fd;
+    1266:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    1268:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+    126b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+    1272:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+    1279:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    1280:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1283:	50                   	push   %eax
+    1284:	56                   	push   %esi
+    1285:	e8 f4 fa ff ff       	call   d7e <fstat>
+    128a:	83 c4 10             	add    $0x10,%esp
+    128d:	85 c0                	test   %eax,%eax
+    128f:	75 07                	jne    1298 <fdopen+0x78>
+    1291:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1296:	74 30                	je     12c8 <fdopen+0xa8>
+  streams[fd] = f;
+    1298:	89 1c b5 20 23 00 00 	mov    %ebx,0x2320(,%esi,4)
+}
+    129f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+    12a1:	c7 05 04 23 00 00 40 	movl   $0xe40,0x2304
+    12a8:	0e 00 00 
+}
+    12ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12ae:	5b                   	pop    %ebx
+    12af:	5e                   	pop    %esi
+    12b0:	5d                   	pop    %ebp
+    12b1:	c3                   	ret
+    12b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    12b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    12bb:	31 db                	xor    %ebx,%ebx
+}
+    12bd:	89 d8                	mov    %ebx,%eax
+    12bf:	5b                   	pop    %ebx
+    12c0:	5e                   	pop    %esi
+    12c1:	5d                   	pop    %ebp
+    12c2:	c3                   	ret
+    12c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12c7:	90                   	nop
+    f->mode = _IOLBF;
+    12c8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+    12cf:	eb c7                	jmp    1298 <fdopen+0x78>
+    12d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12df:	90                   	nop
+
+000012e0 <fopen>:
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	53                   	push   %ebx
+    12e4:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+    12e7:	ff 75 0c             	push   0xc(%ebp)
+    12ea:	ff 75 08             	push   0x8(%ebp)
+    12ed:	e8 74 fa ff ff       	call   d66 <open>
+    12f2:	83 c4 10             	add    $0x10,%esp
+    12f5:	85 c0                	test   %eax,%eax
+    12f7:	78 37                	js     1330 <fopen+0x50>
+    12f9:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+    12fb:	8b 04 85 20 23 00 00 	mov    0x2320(,%eax,4),%eax
+    1302:	85 c0                	test   %eax,%eax
+    1304:	74 17                	je     131d <fopen+0x3d>
+    free(streams[fd]);
+    1306:	83 ec 0c             	sub    $0xc,%esp
+    1309:	50                   	push   %eax
+    130a:	e8 a1 04 00 00       	call   17b0 <free>
+    streams[fd] = 0;
+    130f:	83 c4 10             	add    $0x10,%esp
+    1312:	c7 04 9d 20 23 00 00 	movl   $0x0,0x2320(,%ebx,4)
+    1319:	00 00 00 00 
+  return fdopen(fd);
+    131d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1320:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1323:	c9                   	leave
+  return fdopen(fd);
+    1324:	e9 f7 fe ff ff       	jmp    1220 <fdopen>
+    1329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+    1330:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1333:	31 c0                	xor    %eax,%eax
+    1335:	c9                   	leave
+    1336:	c3                   	ret
+    1337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133e:	66 90                	xchg   %ax,%ax
+
+00001340 <setvbuf>:
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	56                   	push   %esi
+    1344:	53                   	push   %ebx
+    1345:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1348:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+    134b:	83 fe 02             	cmp    $0x2,%esi
+    134e:	77 38                	ja     1388 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1350:	8b 43 08             	mov    0x8(%ebx),%eax
+    1353:	85 c0                	test   %eax,%eax
+    1355:	7e 12                	jle    1369 <setvbuf+0x29>
+    1357:	83 ec 04             	sub    $0x4,%esp
+    135a:	50                   	push   %eax
+    135b:	8d 43 10             	lea    0x10(%ebx),%eax
+    135e:	50                   	push   %eax
+    135f:	ff 33                	push   (%ebx)
+    1361:	e8 e0 f9 ff ff       	call   d46 <write>
+    1366:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    1369:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+    1370:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+    1372:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+    1379:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+    137c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    137f:	5b                   	pop    %ebx
+    1380:	5e                   	pop    %esi
+    1381:	5d                   	pop    %ebp
+    1382:	c3                   	ret
+    1383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1387:	90                   	nop
+    return -1;
+    1388:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    138d:	eb ed                	jmp    137c <setvbuf+0x3c>
+    138f:	90                   	nop
+
+00001390 <fflush>:
+{
+    1390:	55                   	push   %ebp
+    1391:	31 c0                	xor    %eax,%eax
+    1393:	89 e5                	mov    %esp,%ebp
+    1395:	53                   	push   %ebx
+    1396:	83 ec 04             	sub    $0x4,%esp
+    1399:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    139c:	8b 53 08             	mov    0x8(%ebx),%edx
+    139f:	85 d2                	test   %edx,%edx
+    13a1:	7e 1d                	jle    13c0 <fflush+0x30>
+    13a3:	83 ec 04             	sub    $0x4,%esp
+    13a6:	8d 43 10             	lea    0x10(%ebx),%eax
+    13a9:	52                   	push   %edx
+    13aa:	50                   	push   %eax
+    13ab:	ff 33                	push   (%ebx)
+    13ad:	e8 94 f9 ff ff       	call   d46 <write>
+    13b2:	83 c4 10             	add    $0x10,%esp
+    13b5:	39 43 08             	cmp    %eax,0x8(%ebx)
+    13b8:	0f 95 c0             	setne  %al
+    13bb:	0f b6 c0             	movzbl %al,%eax
+    13be:	f7 d8                	neg    %eax
+  f->n = 0;
+    13c0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    13c7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    13ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13d1:	c9                   	leave
+    13d2:	c3                   	ret
+    13d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000013e0 <fclose>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	56                   	push   %esi
+    13e4:	31 f6                	xor    %esi,%esi
+    13e6:	53                   	push   %ebx
+    13e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    13ea:	8b 43 08             	mov    0x8(%ebx),%eax
+    13ed:	85 c0                	test   %eax,%eax
+    13ef:	7e 1f                	jle    1410 <fclose+0x30>
+    13f1:	83 ec 04             	sub    $0x4,%esp
+    13f4:	50                   	push   %eax
+    13f5:	8d 43 10             	lea    0x10(%ebx),%eax
+    13f8:	50                   	push   %eax
+    13f9:	ff 33                	push   (%ebx)
+    13fb:	e8 46 f9 ff ff       	call   d46 <write>
+    1400:	83 c4 10             	add    $0x10,%esp
+    1403:	39 43 08             	cmp    %eax,0x8(%ebx)
+    1406:	0f 95 c0             	setne  %al
+    1409:	0f b6 c0             	movzbl %al,%eax
+    140c:	f7 d8                	neg    %eax
+    140e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    1410:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+    1413:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    141a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+    1421:	ff 33                	push   (%ebx)
+    1423:	e8 26 f9 ff ff       	call   d4e <close>
+    1428:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    142b:	85 c0                	test   %eax,%eax
+    142d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1432:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+    1435:	8b 03                	mov    (%ebx),%eax
+    1437:	83 f8 0f             	cmp    $0xf,%eax
+    143a:	77 09                	ja     1445 <fclose+0x65>
+    143c:	39 1c 85 20 23 00 00 	cmp    %ebx,0x2320(,%eax,4)
+    1443:	74 0b                	je     1450 <fclose+0x70>
+}
+    1445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1448:	89 f0                	mov    %esi,%eax
+    144a:	5b                   	pop    %ebx
+    144b:	5e                   	pop    %esi
+    144c:	5d                   	pop    %ebp
+    144d:	c3                   	ret
+    144e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+    1450:	c7 04 85 20 23 00 00 	movl   $0x0,0x2320(,%eax,4)
+    1457:	00 00 00 00 
+    free(f);
+    145b:	83 ec 0c             	sub    $0xc,%esp
+    145e:	53                   	push   %ebx
+    145f:	e8 4c 03 00 00       	call   17b0 <free>
+    1464:	83 c4 10             	add    $0x10,%esp
+  return r;
+    1467:	eb dc                	jmp    1445 <fclose+0x65>
+    1469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001470 <fputc>:
+{
+    1470:	55                   	push   %ebp
+    1471:	89 e5                	mov    %esp,%ebp
+    1473:	53                   	push   %ebx
+    1474:	83 ec 04             	sub    $0x4,%esp
+    1477:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    147a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+    147d:	8b 43 08             	mov    0x8(%ebx),%eax
+    1480:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1485:	74 59                	je     14e0 <fputc+0x70>
+  f->buf[f->n++] = c;
+    1487:	8d 48 01             	lea    0x1(%eax),%ecx
+    148a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+    148d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+    1491:	80 fa 0a             	cmp    $0xa,%dl
+    1494:	75 07                	jne    149d <fputc+0x2d>
+    f->nl = 1;
+    1496:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    149d:	8b 43 04             	mov    0x4(%ebx),%eax
+    14a0:	83 f8 02             	cmp    $0x2,%eax
+    14a3:	74 1a                	je     14bf <fputc+0x4f>
+    14a5:	83 f8 01             	cmp    $0x1,%eax
+    14a8:	74 0e                	je     14b8 <fputc+0x48>
+}
+    14aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+    14ad:	0f b6 c2             	movzbl %dl,%eax
+}
+    14b0:	c9                   	leave
+    14b1:	c3                   	ret
+    14b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    14b8:	8b 43 0c             	mov    0xc(%ebx),%eax
+    14bb:	85 c0                	test   %eax,%eax
+    14bd:	74 eb                	je     14aa <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    14bf:	85 c9                	test   %ecx,%ecx
+    14c1:	7f 4d                	jg     1510 <fputc+0xa0>
+  f->n = 0;
+    14c3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    14ca:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    14d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+    14d4:	0f b6 c2             	movzbl %dl,%eax
+}
+    14d7:	c9                   	leave
+    14d8:	c3                   	ret
+    14d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    14e0:	83 ec 04             	sub    $0x4,%esp
+    14e3:	8d 43 10             	lea    0x10(%ebx),%eax
+    14e6:	89 55 08             	mov    %edx,0x8(%ebp)
+    14e9:	68 00 02 00 00       	push   $0x200
+    14ee:	50                   	push   %eax
+    14ef:	ff 33                	push   (%ebx)
+    14f1:	e8 50 f8 ff ff       	call   d46 <write>
+  return r;
+    14f6:	8b 55 08             	mov    0x8(%ebp),%edx
+    14f9:	83 c4 10             	add    $0x10,%esp
+    14fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+    1501:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    1508:	31 c0                	xor    %eax,%eax
+    150a:	e9 7b ff ff ff       	jmp    148a <fputc+0x1a>
+    150f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1510:	83 ec 04             	sub    $0x4,%esp
+    1513:	8d 43 10             	lea    0x10(%ebx),%eax
+    1516:	89 55 08             	mov    %edx,0x8(%ebp)
+    1519:	51                   	push   %ecx
+    151a:	50                   	push   %eax
+    151b:	ff 33                	push   (%ebx)
+    151d:	e8 24 f8 ff ff       	call   d46 <write>
+  f->n = 0;
+    1522:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    1529:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+    152c:	83 c4 10             	add    $0x10,%esp
+    152f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    1536:	eb 99                	jmp    14d1 <fputc+0x61>
+    1538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153f:	90                   	nop
+
+00001540 <fwrite>:
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+    1546:	83 ec 1c             	sub    $0x1c,%esp
+    1549:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+    154c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+    154f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+    1552:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    1555:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+    155b:	0f 8f af 00 00 00    	jg     1610 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+    1561:	85 ff                	test   %edi,%edi
+    1563:	7e 73                	jle    15d8 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1565:	8d 56 10             	lea    0x10(%esi),%edx
+    1568:	8b 46 08             	mov    0x8(%esi),%eax
+    156b:	31 db                	xor    %ebx,%ebx
+    156d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    1570:	eb 25                	jmp    1597 <fwrite+0x57>
+    1572:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+    1578:	89 c1                	mov    %eax,%ecx
+    157a:	83 c0 01             	add    $0x1,%eax
+    157d:	89 46 08             	mov    %eax,0x8(%esi)
+    1580:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    1584:	80 fa 0a             	cmp    $0xa,%dl
+    1587:	75 07                	jne    1590 <fwrite+0x50>
+    f->nl = 1;
+    1589:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+    1590:	83 c3 01             	add    $0x1,%ebx
+    1593:	39 df                	cmp    %ebx,%edi
+    1595:	7e 41                	jle    15d8 <fwrite+0x98>
+    bputc(f, s[i]);
+    1597:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    159a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+    159e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    15a3:	75 d3                	jne    1578 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    15a5:	83 ec 04             	sub    $0x4,%esp
+    15a8:	88 55 e7             	mov    %dl,-0x19(%ebp)
+    15ab:	68 00 02 00 00       	push   $0x200
+    15b0:	ff 75 e0             	push   -0x20(%ebp)
+    15b3:	ff 36                	push   (%esi)
+    15b5:	e8 8c f7 ff ff       	call   d46 <write>
+  return r;
+    15ba:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+    15be:	83 c4 10             	add    $0x10,%esp
+    15c1:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    15c3:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    15ca:	b8 01 00 00 00       	mov    $0x1,%eax
+    15cf:	eb ac                	jmp    157d <fwrite+0x3d>
+    15d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    15d8:	8b 46 04             	mov    0x4(%esi),%eax
+    15db:	83 f8 02             	cmp    $0x2,%eax
+    15de:	74 0c                	je     15ec <fwrite+0xac>
+    15e0:	83 f8 01             	cmp    $0x1,%eax
+    15e3:	75 1c                	jne    1601 <fwrite+0xc1>
+    15e5:	8b 46 0c             	mov    0xc(%esi),%eax
+    15e8:	85 c0                	test   %eax,%eax
+    15ea:	74 15                	je     1601 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    15ec:	8b 46 08             	mov    0x8(%esi),%eax
+    15ef:	85 c0                	test   %eax,%eax
+    15f1:	7f 5d                	jg     1650 <fwrite+0x110>
+  f->n = 0;
+    15f3:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    15fa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+    1601:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+    1604:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1607:	5b                   	pop    %ebx
+    1608:	5e                   	pop    %esi
+    1609:	5f                   	pop    %edi
+    160a:	5d                   	pop    %ebp
+    160b:	c3                   	ret
+    160c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    1610:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+    1614:	0f 84 4b ff ff ff    	je     1565 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    161a:	8b 46 08             	mov    0x8(%esi),%eax
+    161d:	8b 16                	mov    (%esi),%edx
+    161f:	85 c0                	test   %eax,%eax
+    1621:	7f 45                	jg     1668 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+    1623:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+    1626:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    162d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+    1634:	57                   	push   %edi
+    1635:	ff 75 08             	push   0x8(%ebp)
+    1638:	ff 36                	push   (%esi)
+    163a:	e8 07 f7 ff ff       	call   d46 <write>
+    return size > 0 ? i / size : 0;
+    163f:	83 c4 10             	add    $0x10,%esp
+    1642:	85 c0                	test   %eax,%eax
+    1644:	78 4a                	js     1690 <fwrite+0x150>
+    1646:	85 db                	test   %ebx,%ebx
+    1648:	7e 46                	jle    1690 <fwrite+0x150>
+    164a:	99                   	cltd
+    164b:	f7 fb                	idiv   %ebx
+    164d:	eb b5                	jmp    1604 <fwrite+0xc4>
+    164f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1650:	83 ec 04             	sub    $0x4,%esp
+    1653:	50                   	push   %eax
+    1654:	8d 46 10             	lea    0x10(%esi),%eax
+    1657:	50                   	push   %eax
+    1658:	ff 36                	push   (%esi)
+    165a:	e8 e7 f6 ff ff       	call   d46 <write>
+    165f:	83 c4 10             	add    $0x10,%esp
+    1662:	eb 8f                	jmp    15f3 <fwrite+0xb3>
+    1664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1668:	83 ec 04             	sub    $0x4,%esp
+    166b:	50                   	push   %eax
+    166c:	8d 46 10             	lea    0x10(%esi),%eax
+    166f:	50                   	push   %eax
+    1670:	52                   	push   %edx
+    1671:	e8 d0 f6 ff ff       	call   d46 <write>
+    1676:	83 c4 10             	add    $0x10,%esp
+    1679:	3b 46 08             	cmp    0x8(%esi),%eax
+    167c:	74 a5                	je     1623 <fwrite+0xe3>
+  f->n = 0;
+    167e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    1685:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    168c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+    1690:	31 c0                	xor    %eax,%eax
+    1692:	e9 6d ff ff ff       	jmp    1604 <fwrite+0xc4>
+    1697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169e:	66 90                	xchg   %ax,%ax
+
+000016a0 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    16a4:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    16a7:	83 ec 04             	sub    $0x4,%esp
+    16aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    16ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+    16b0:	89 d8                	mov    %ebx,%eax
+    16b2:	e8 39 f9 ff ff       	call   ff0 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    16b7:	8b 43 04             	mov    0x4(%ebx),%eax
+    16ba:	83 f8 02             	cmp    $0x2,%eax
+    16bd:	74 18                	je     16d7 <fprintf+0x37>
+    16bf:	83 f8 01             	cmp    $0x1,%eax
+    16c2:	74 0c                	je     16d0 <fprintf+0x30>
+  settle(f);
+}
+    16c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    16c7:	c9                   	leave
+    16c8:	c3                   	ret
+    16c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    16d0:	8b 43 0c             	mov    0xc(%ebx),%eax
+    16d3:	85 c0                	test   %eax,%eax
+    16d5:	74 ed                	je     16c4 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    16d7:	8b 43 08             	mov    0x8(%ebx),%eax
+    16da:	85 c0                	test   %eax,%eax
+    16dc:	7f 1a                	jg     16f8 <fprintf+0x58>
+  f->n = 0;
+    16de:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    16e5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    16ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    16ef:	c9                   	leave
+    16f0:	c3                   	ret
+    16f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    16f8:	83 ec 04             	sub    $0x4,%esp
+    16fb:	50                   	push   %eax
+    16fc:	8d 43 10             	lea    0x10(%ebx),%eax
+    16ff:	50                   	push   %eax
+    1700:	ff 33                	push   (%ebx)
+    1702:	e8 3f f6 ff ff       	call   d46 <write>
+  f->n = 0;
+    1707:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    170e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+    1711:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    1718:	eb d2                	jmp    16ec <fprintf+0x4c>
+    171a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001720 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1720:	55                   	push   %ebp
+    1721:	89 e5                	mov    %esp,%ebp
+    1723:	53                   	push   %ebx
+    1724:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    172a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+    172d:	83 f8 0f             	cmp    $0xf,%eax
+    1730:	77 4e                	ja     1780 <printf+0x60>
+    1732:	8b 1c 85 20 23 00 00 	mov    0x2320(,%eax,4),%ebx
+    1739:	85 db                	test   %ebx,%ebx
+    173b:	74 43                	je     1780 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    173d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1740:	89 d8                	mov    %ebx,%eax
+    1742:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1745:	e8 a6 f8 ff ff       	call   ff0 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    174a:	8b 43 08             	mov    0x8(%ebx),%eax
+    174d:	85 c0                	test   %eax,%eax
+    174f:	7e 12                	jle    1763 <printf+0x43>
+    1751:	83 ec 04             	sub    $0x4,%esp
+    1754:	50                   	push   %eax
+    1755:	8d 43 10             	lea    0x10(%ebx),%eax
+    1758:	50                   	push   %eax
+    1759:	ff 33                	push   (%ebx)
+    175b:	e8 e6 f5 ff ff       	call   d46 <write>
+    1760:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    1763:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    176a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+    1771:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1774:	c9                   	leave
+    1775:	c3                   	ret
+    1776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+    1780:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+    1786:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+    178c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+    1793:	00 00 00 
+    f->n = 0;
+    1796:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    179d:	00 00 00 
+    f->nl = 0;
+    17a0:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+    17a7:	00 00 00 
+    17aa:	eb 91                	jmp    173d <printf+0x1d>
+    17ac:	66 90                	xchg   %ax,%ax
+    17ae:	66 90                	xchg   %ax,%ax
+
+000017b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    17b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17b1:	a1 60 23 00 00       	mov    0x2360,%eax
+{
+    17b6:	89 e5                	mov    %esp,%ebp
+    17b8:	57                   	push   %edi
+    17b9:	56                   	push   %esi
+    17ba:	53                   	push   %ebx
+    17bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    17be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    17cc:	39 ca                	cmp    %ecx,%edx
+    17ce:	73 30                	jae    1800 <free+0x50>
+    17d0:	39 c1                	cmp    %eax,%ecx
+    17d2:	72 04                	jb     17d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    17d4:	39 c2                	cmp    %eax,%edx
+    17d6:	72 f0                	jb     17c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    17d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    17db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    17de:	39 f8                	cmp    %edi,%eax
+    17e0:	74 2e                	je     1810 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    17e5:	8b 42 04             	mov    0x4(%edx),%eax
+    17e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17eb:	39 f1                	cmp    %esi,%ecx
+    17ed:	74 38                	je     1827 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    17ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    17f1:	5b                   	pop    %ebx
+  freep = p;
+    17f2:	89 15 60 23 00 00    	mov    %edx,0x2360
+}
+    17f8:	5e                   	pop    %esi
+    17f9:	5f                   	pop    %edi
+    17fa:	5d                   	pop    %ebp
+    17fb:	c3                   	ret
+    17fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1800:	39 c1                	cmp    %eax,%ecx
+    1802:	72 d0                	jb     17d4 <free+0x24>
+    1804:	eb c2                	jmp    17c8 <free+0x18>
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1810:	03 70 04             	add    0x4(%eax),%esi
+    1813:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1816:	8b 02                	mov    (%edx),%eax
+    1818:	8b 00                	mov    (%eax),%eax
+    181a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    181d:	8b 42 04             	mov    0x4(%edx),%eax
+    1820:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1823:	39 f1                	cmp    %esi,%ecx
+    1825:	75 c8                	jne    17ef <free+0x3f>
+    p->s.size += bp->s.size;
+    1827:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    182a:	89 15 60 23 00 00    	mov    %edx,0x2360
+    p->s.size += bp->s.size;
+    1830:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1833:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1836:	89 0a                	mov    %ecx,(%edx)
+}
+    1838:	5b                   	pop    %ebx
+    1839:	5e                   	pop    %esi
+    183a:	5f                   	pop    %edi
+    183b:	5d                   	pop    %ebp
+    183c:	c3                   	ret
+    183d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001840 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1840:	55                   	push   %ebp
+    1841:	89 e5                	mov    %esp,%ebp
+    1843:	57                   	push   %edi
+    1844:	56                   	push   %esi
+    1845:	53                   	push   %ebx
+    1846:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1849:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    184c:	8b 15 60 23 00 00    	mov    0x2360,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1852:	8d 78 07             	lea    0x7(%eax),%edi
+    1855:	c1 ef 03             	shr    $0x3,%edi
+    1858:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    185b:	85 d2                	test   %edx,%edx
+    185d:	0f 84 8d 00 00 00    	je     18f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1863:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1865:	8b 48 04             	mov    0x4(%eax),%ecx
+    1868:	39 f9                	cmp    %edi,%ecx
+    186a:	73 64                	jae    18d0 <malloc+0x90>
+  if(nu < 4096)
+    186c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1871:	39 df                	cmp    %ebx,%edi
+    1873:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1876:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    187d:	eb 0a                	jmp    1889 <malloc+0x49>
+    187f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1880:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1882:	8b 48 04             	mov    0x4(%eax),%ecx
+    1885:	39 f9                	cmp    %edi,%ecx
+    1887:	73 47                	jae    18d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1889:	89 c2                	mov    %eax,%edx
+    188b:	39 05 60 23 00 00    	cmp    %eax,0x2360
+    1891:	75 ed                	jne    1880 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1893:	83 ec 0c             	sub    $0xc,%esp
+    1896:	56                   	push   %esi
+    1897:	e8 12 f5 ff ff       	call   dae <sbrk>
+  if(p == (char*)-1)
+    189c:	83 c4 10             	add    $0x10,%esp
+    189f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18a2:	74 1c                	je     18c0 <malloc+0x80>
+  hp->s.size = nu;
+    18a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    18a7:	83 ec 0c             	sub    $0xc,%esp
+    18aa:	83 c0 08             	add    $0x8,%eax
+    18ad:	50                   	push   %eax
+    18ae:	e8 fd fe ff ff       	call   17b0 <free>
+  return freep;
+    18b3:	8b 15 60 23 00 00    	mov    0x2360,%edx
+      if((p = morecore(nunits)) == 0)
+    18b9:	83 c4 10             	add    $0x10,%esp
+    18bc:	85 d2                	test   %edx,%edx
+    18be:	75 c0                	jne    1880 <malloc+0x40>
+        return 0;
+  }
+}
+    18c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    18c3:	31 c0                	xor    %eax,%eax
+}
+    18c5:	5b                   	pop    %ebx
+    18c6:	5e                   	pop    %esi
+    18c7:	5f                   	pop    %edi
+    18c8:	5d                   	pop    %ebp
+    18c9:	c3                   	ret
+    18ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    18d0:	39 cf                	cmp    %ecx,%edi
+    18d2:	74 4c                	je     1920 <malloc+0xe0>
+        p->s.size -= nunits;
+    18d4:	29 f9                	sub    %edi,%ecx
+    18d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    18d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    18dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    18df:	89 15 60 23 00 00    	mov    %edx,0x2360
+}
+    18e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    18e8:	83 c0 08             	add    $0x8,%eax
+}
+    18eb:	5b                   	pop    %ebx
+    18ec:	5e                   	pop    %esi
+    18ed:	5f                   	pop    %edi
+    18ee:	5d                   	pop    %ebp
+    18ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    18f0:	c7 05 60 23 00 00 64 	movl   $0x2364,0x2360
+    18f7:	23 00 00 
+    base.s.size = 0;
+    18fa:	b8 64 23 00 00       	mov    $0x2364,%eax
+    base.s.ptr = freep = prevp = &base;
+    18ff:	c7 05 64 23 00 00 64 	movl   $0x2364,0x2364
+    1906:	23 00 00 
+    base.s.size = 0;
+    1909:	c7 05 68 23 00 00 00 	movl   $0x0,0x2368
+    1910:	00 00 00 
+    if(p->s.size >= nunits){
+    1913:	e9 54 ff ff ff       	jmp    186c <malloc+0x2c>
+    1918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1920:	8b 08                	mov    (%eax),%ecx
+    1922:	89 0a                	mov    %ecx,(%edx)
+    1924:	eb b9                	jmp    18df <malloc+0x9f>
@@ -0,0 +1,18 @@
+// Scheduling classes, for sched_setattr().
+#define SCHED_FAIR   0   // share the CPU by nice value
+#define SCHED_RT     1   // fixed priority, ahead of all SCHED_FAIR
+
+#define NRTPRIO     32   // SCHED_RT priorities, 0 the highest
+#define NICEMIN   (-20)  // SCHED_FAIR nice values, NICEMIN
+#define NICEMAX     19   // getting the biggest share
+
+// Which settings setsched() changes (kernel).
+#define SCHED_SETPOLICY  0x1
+#define SCHED_SETRTPRIO  0x2
+#define SCHED_SETNICE    0x4
+
+struct sched_attr {
+  int policy;
+  int priority;          // for SCHED_RT
+  int nice;              // for SCHED_FAIR
+};
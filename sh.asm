@@ -0,0 +1,3569 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 96 00 00 00    	jg     b7 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 c9 1a 00 00       	push   $0x1ac9
+      2b:	e8 36 0e 00 00       	call   e66 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      40:	80 3d 42 23 00 00 20 	cmpb   $0x20,0x2342
+      47:	0f 84 8d 00 00 00    	je     da <main+0xda>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      50:	e8 d1 0d 00 00       	call   e26 <fork>
+  if(pid == -1)
+      55:	83 f8 ff             	cmp    $0xffffffff,%eax
+      58:	0f 84 c1 00 00 00    	je     11f <main+0x11f>
+    if(fork1() == 0)
+      5e:	85 c0                	test   %eax,%eax
+      60:	74 63                	je     c5 <main+0xc5>
+    wait();
+      62:	e8 c7 0d 00 00       	call   e2e <wait>
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 28 1a 00 00       	push   $0x1a28
+      6f:	6a 02                	push   $0x2
+      71:	e8 aa 17 00 00       	call   1820 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 40 23 00 00       	push   $0x2340
+      82:	e8 09 0c 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 40 23 00 00       	push   $0x2340
+      90:	e8 5b 0c 00 00       	call   cf0 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 40 23 00 00 	movzbl 0x2340,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	74 0f                	je     b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a3:	3c 63                	cmp    $0x63,%al
+      a5:	75 a9                	jne    50 <main+0x50>
+      a7:	80 3d 41 23 00 00 64 	cmpb   $0x64,0x2341
+      ae:	75 a0                	jne    50 <main+0x50>
+      b0:	eb 8e                	jmp    40 <main+0x40>
+  exit();
+      b2:	e8 59 0d 00 00       	call   e10 <exit>
+      close(fd);
+      b7:	83 ec 0c             	sub    $0xc,%esp
+      ba:	50                   	push   %eax
+      bb:	e8 8e 0d 00 00       	call   e4e <close>
+      break;
+      c0:	83 c4 10             	add    $0x10,%esp
+      c3:	eb a2                	jmp    67 <main+0x67>
+      runcmd(parsecmd(buf));
+      c5:	83 ec 0c             	sub    $0xc,%esp
+      c8:	68 40 23 00 00       	push   $0x2340
+      cd:	e8 8e 0a 00 00       	call   b60 <parsecmd>
+      d2:	89 04 24             	mov    %eax,(%esp)
+      d5:	e8 d6 00 00 00       	call   1b0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 40 23 00 00       	push   $0x2340
+      e2:	e8 79 0b 00 00       	call   c60 <strlen>
+      if(chdir(buf+3) < 0)
+      e7:	c7 04 24 43 23 00 00 	movl   $0x2343,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ee:	c6 80 3f 23 00 00 00 	movb   $0x0,0x233f(%eax)
+      if(chdir(buf+3) < 0)
+      f5:	e8 9c 0d 00 00       	call   e96 <chdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	0f 89 62 ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     105:	51                   	push   %ecx
+     106:	68 43 23 00 00       	push   $0x2343
+     10b:	68 d1 1a 00 00       	push   $0x1ad1
+     110:	6a 02                	push   $0x2
+     112:	e8 09 17 00 00       	call   1820 <printf>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	e9 48 ff ff ff       	jmp    67 <main+0x67>
+    panic("fork");
+     11f:	83 ec 0c             	sub    $0xc,%esp
+     122:	68 2b 1a 00 00       	push   $0x1a2b
+     127:	e8 44 00 00 00       	call   170 <panic>
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <getcmd>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	56                   	push   %esi
+     134:	53                   	push   %ebx
+     135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	68 28 1a 00 00       	push   $0x1a28
+     143:	6a 02                	push   $0x2
+     145:	e8 d6 16 00 00       	call   1820 <printf>
+  memset(buf, 0, nbuf);
+     14a:	83 c4 0c             	add    $0xc,%esp
+     14d:	56                   	push   %esi
+     14e:	6a 00                	push   $0x0
+     150:	53                   	push   %ebx
+     151:	e8 3a 0b 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+     156:	58                   	pop    %eax
+     157:	5a                   	pop    %edx
+     158:	56                   	push   %esi
+     159:	53                   	push   %ebx
+     15a:	e8 91 0b 00 00       	call   cf0 <gets>
+  if(buf[0] == 0) // EOF
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	80 3b 01             	cmpb   $0x1,(%ebx)
+     165:	19 c0                	sbb    %eax,%eax
+}
+     167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     16a:	5b                   	pop    %ebx
+     16b:	5e                   	pop    %esi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <panic>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     176:	ff 75 08             	push   0x8(%ebp)
+     179:	68 c5 1a 00 00       	push   $0x1ac5
+     17e:	6a 02                	push   $0x2
+     180:	e8 9b 16 00 00       	call   1820 <printf>
+  exit();
+     185:	e8 86 0c 00 00       	call   e10 <exit>
+     18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000190 <fork1>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     196:	e8 8b 0c 00 00       	call   e26 <fork>
+  if(pid == -1)
+     19b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     19e:	74 02                	je     1a2 <fork1+0x12>
+  return pid;
+}
+     1a0:	c9                   	leave
+     1a1:	c3                   	ret
+    panic("fork");
+     1a2:	83 ec 0c             	sub    $0xc,%esp
+     1a5:	68 2b 1a 00 00       	push   $0x1a2b
+     1aa:	e8 c1 ff ff ff       	call   170 <panic>
+     1af:	90                   	nop
+
+000001b0 <runcmd>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	53                   	push   %ebx
+     1b4:	83 ec 14             	sub    $0x14,%esp
+     1b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1ba:	85 db                	test   %ebx,%ebx
+     1bc:	74 42                	je     200 <runcmd+0x50>
+  switch(cmd->type){
+     1be:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1c1:	0f 87 e3 00 00 00    	ja     2aa <runcmd+0xfa>
+     1c7:	8b 03                	mov    (%ebx),%eax
+     1c9:	ff 24 85 e0 1a 00 00 	jmp    *0x1ae0(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     1d0:	8b 43 04             	mov    0x4(%ebx),%eax
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	74 29                	je     200 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     1d7:	8d 53 04             	lea    0x4(%ebx),%edx
+     1da:	51                   	push   %ecx
+     1db:	51                   	push   %ecx
+     1dc:	52                   	push   %edx
+     1dd:	50                   	push   %eax
+     1de:	e8 7b 0c 00 00       	call   e5e <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     1e3:	83 c4 0c             	add    $0xc,%esp
+     1e6:	ff 73 04             	push   0x4(%ebx)
+     1e9:	68 37 1a 00 00       	push   $0x1a37
+     1ee:	6a 02                	push   $0x2
+     1f0:	e8 2b 16 00 00       	call   1820 <printf>
+    break;
+     1f5:	83 c4 10             	add    $0x10,%esp
+     1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+    exit();
+     200:	e8 0b 0c 00 00       	call   e10 <exit>
+    if(fork1() == 0)
+     205:	e8 86 ff ff ff       	call   190 <fork1>
+     20a:	85 c0                	test   %eax,%eax
+     20c:	75 f2                	jne    200 <runcmd+0x50>
+     20e:	e9 8c 00 00 00       	jmp    29f <runcmd+0xef>
+    if(pipe(p) < 0)
+     213:	83 ec 0c             	sub    $0xc,%esp
+     216:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     219:	50                   	push   %eax
+     21a:	e8 17 0c 00 00       	call   e36 <pipe>
+     21f:	83 c4 10             	add    $0x10,%esp
+     222:	85 c0                	test   %eax,%eax
+     224:	0f 88 a2 00 00 00    	js     2cc <runcmd+0x11c>
+    if(fork1() == 0){
+     22a:	e8 61 ff ff ff       	call   190 <fork1>
+     22f:	85 c0                	test   %eax,%eax
+     231:	0f 84 a2 00 00 00    	je     2d9 <runcmd+0x129>
+    if(fork1() == 0){
+     237:	e8 54 ff ff ff       	call   190 <fork1>
+     23c:	85 c0                	test   %eax,%eax
+     23e:	0f 84 c3 00 00 00    	je     307 <runcmd+0x157>
+    close(p[0]);
+     244:	83 ec 0c             	sub    $0xc,%esp
+     247:	ff 75 f0             	push   -0x10(%ebp)
+     24a:	e8 ff 0b 00 00       	call   e4e <close>
+    close(p[1]);
+     24f:	58                   	pop    %eax
+     250:	ff 75 f4             	push   -0xc(%ebp)
+     253:	e8 f6 0b 00 00       	call   e4e <close>
+    wait();
+     258:	e8 d1 0b 00 00       	call   e2e <wait>
+    wait();
+     25d:	e8 cc 0b 00 00       	call   e2e <wait>
+    break;
+     262:	83 c4 10             	add    $0x10,%esp
+     265:	eb 99                	jmp    200 <runcmd+0x50>
+    if(fork1() == 0)
+     267:	e8 24 ff ff ff       	call   190 <fork1>
+     26c:	85 c0                	test   %eax,%eax
+     26e:	74 2f                	je     29f <runcmd+0xef>
+    wait();
+     270:	e8 b9 0b 00 00       	call   e2e <wait>
+    runcmd(lcmd->right);
+     275:	83 ec 0c             	sub    $0xc,%esp
+     278:	ff 73 08             	push   0x8(%ebx)
+     27b:	e8 30 ff ff ff       	call   1b0 <runcmd>
+    close(rcmd->fd);
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	ff 73 14             	push   0x14(%ebx)
+     286:	e8 c3 0b 00 00       	call   e4e <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     28b:	58                   	pop    %eax
+     28c:	5a                   	pop    %edx
+     28d:	ff 73 10             	push   0x10(%ebx)
+     290:	ff 73 08             	push   0x8(%ebx)
+     293:	e8 ce 0b 00 00       	call   e66 <open>
+     298:	83 c4 10             	add    $0x10,%esp
+     29b:	85 c0                	test   %eax,%eax
+     29d:	78 18                	js     2b7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     29f:	83 ec 0c             	sub    $0xc,%esp
+     2a2:	ff 73 04             	push   0x4(%ebx)
+     2a5:	e8 06 ff ff ff       	call   1b0 <runcmd>
+    panic("runcmd");
+     2aa:	83 ec 0c             	sub    $0xc,%esp
+     2ad:	68 30 1a 00 00       	push   $0x1a30
+     2b2:	e8 b9 fe ff ff       	call   170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2b7:	51                   	push   %ecx
+     2b8:	ff 73 08             	push   0x8(%ebx)
+     2bb:	68 47 1a 00 00       	push   $0x1a47
+     2c0:	6a 02                	push   $0x2
+     2c2:	e8 59 15 00 00       	call   1820 <printf>
+      exit();
+     2c7:	e8 44 0b 00 00       	call   e10 <exit>
+      panic("pipe");
+     2cc:	83 ec 0c             	sub    $0xc,%esp
+     2cf:	68 57 1a 00 00       	push   $0x1a57
+     2d4:	e8 97 fe ff ff       	call   170 <panic>
+      close(1);
+     2d9:	83 ec 0c             	sub    $0xc,%esp
+     2dc:	6a 01                	push   $0x1
+     2de:	e8 6b 0b 00 00       	call   e4e <close>
+      dup(p[1]);
+     2e3:	58                   	pop    %eax
+     2e4:	ff 75 f4             	push   -0xc(%ebp)
+     2e7:	e8 b2 0b 00 00       	call   e9e <dup>
+      close(p[0]);
+     2ec:	58                   	pop    %eax
+     2ed:	ff 75 f0             	push   -0x10(%ebp)
+     2f0:	e8 59 0b 00 00       	call   e4e <close>
+      close(p[1]);
+     2f5:	58                   	pop    %eax
+     2f6:	ff 75 f4             	push   -0xc(%ebp)
+     2f9:	e8 50 0b 00 00       	call   e4e <close>
+      runcmd(pcmd->left);
+     2fe:	5a                   	pop    %edx
+     2ff:	ff 73 04             	push   0x4(%ebx)
+     302:	e8 a9 fe ff ff       	call   1b0 <runcmd>
+      close(0);
+     307:	83 ec 0c             	sub    $0xc,%esp
+     30a:	6a 00                	push   $0x0
+     30c:	e8 3d 0b 00 00       	call   e4e <close>
+      dup(p[0]);
+     311:	5a                   	pop    %edx
+     312:	ff 75 f0             	push   -0x10(%ebp)
+     315:	e8 84 0b 00 00       	call   e9e <dup>
+      close(p[0]);
+     31a:	59                   	pop    %ecx
+     31b:	ff 75 f0             	push   -0x10(%ebp)
+     31e:	e8 2b 0b 00 00       	call   e4e <close>
+      close(p[1]);
+     323:	58                   	pop    %eax
+     324:	ff 75 f4             	push   -0xc(%ebp)
+     327:	e8 22 0b 00 00       	call   e4e <close>
+      runcmd(pcmd->right);
+     32c:	58                   	pop    %eax
+     32d:	ff 73 08             	push   0x8(%ebx)
+     330:	e8 7b fe ff ff       	call   1b0 <runcmd>
+     335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	53                   	push   %ebx
+     344:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     347:	6a 54                	push   $0x54
+     349:	e8 f2 15 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     34e:	83 c4 0c             	add    $0xc,%esp
+     351:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     353:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     355:	6a 00                	push   $0x0
+     357:	50                   	push   %eax
+     358:	e8 33 09 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     35d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     363:	89 d8                	mov    %ebx,%eax
+     365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     368:	c9                   	leave
+     369:	c3                   	ret
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000370 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     377:	6a 18                	push   $0x18
+     379:	e8 c2 15 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     37e:	83 c4 0c             	add    $0xc,%esp
+     381:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     383:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     385:	6a 00                	push   $0x0
+     387:	50                   	push   %eax
+     388:	e8 03 09 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     38d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     390:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     396:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     399:	8b 45 0c             	mov    0xc(%ebp),%eax
+     39c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     39f:	8b 45 10             	mov    0x10(%ebp),%eax
+     3a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     3a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     3ab:	8b 45 18             	mov    0x18(%ebp),%eax
+     3ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3b1:	89 d8                	mov    %ebx,%eax
+     3b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3b6:	c9                   	leave
+     3b7:	c3                   	ret
+     3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bf:	90                   	nop
+
+000003c0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	53                   	push   %ebx
+     3c4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3c7:	6a 0c                	push   $0xc
+     3c9:	e8 72 15 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3ce:	83 c4 0c             	add    $0xc,%esp
+     3d1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     3d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3d5:	6a 00                	push   $0x0
+     3d7:	50                   	push   %eax
+     3d8:	e8 b3 08 00 00       	call   c90 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     3e0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     3e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     3e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ec:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     3ef:	89 d8                	mov    %ebx,%eax
+     3f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3f4:	c9                   	leave
+     3f5:	c3                   	ret
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	53                   	push   %ebx
+     404:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     407:	6a 0c                	push   $0xc
+     409:	e8 32 15 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     40e:	83 c4 0c             	add    $0xc,%esp
+     411:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     413:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     415:	6a 00                	push   $0x0
+     417:	50                   	push   %eax
+     418:	e8 73 08 00 00       	call   c90 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     41d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     420:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     426:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     429:	8b 45 0c             	mov    0xc(%ebp),%eax
+     42c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     42f:	89 d8                	mov    %ebx,%eax
+     431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     434:	c9                   	leave
+     435:	c3                   	ret
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	53                   	push   %ebx
+     444:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     447:	6a 08                	push   $0x8
+     449:	e8 f2 14 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     44e:	83 c4 0c             	add    $0xc,%esp
+     451:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     453:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     455:	6a 00                	push   $0x0
+     457:	50                   	push   %eax
+     458:	e8 33 08 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     45d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     460:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     466:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     469:	89 d8                	mov    %ebx,%eax
+     46b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     46e:	c9                   	leave
+     46f:	c3                   	ret
+
+00000470 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	57                   	push   %edi
+     474:	56                   	push   %esi
+     475:	53                   	push   %ebx
+     476:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     479:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     47c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     47f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     482:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     484:	39 df                	cmp    %ebx,%edi
+     486:	72 0f                	jb     497 <gettoken+0x27>
+     488:	eb 25                	jmp    4af <gettoken+0x3f>
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     490:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     493:	39 fb                	cmp    %edi,%ebx
+     495:	74 18                	je     4af <gettoken+0x3f>
+     497:	0f be 07             	movsbl (%edi),%eax
+     49a:	83 ec 08             	sub    $0x8,%esp
+     49d:	50                   	push   %eax
+     49e:	68 38 23 00 00       	push   $0x2338
+     4a3:	e8 08 08 00 00       	call   cb0 <strchr>
+     4a8:	83 c4 10             	add    $0x10,%esp
+     4ab:	85 c0                	test   %eax,%eax
+     4ad:	75 e1                	jne    490 <gettoken+0x20>
+  if(q)
+     4af:	85 f6                	test   %esi,%esi
+     4b1:	74 02                	je     4b5 <gettoken+0x45>
+    *q = s;
+     4b3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4b5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4b8:	3c 3c                	cmp    $0x3c,%al
+     4ba:	0f 8f d0 00 00 00    	jg     590 <gettoken+0x120>
+     4c0:	3c 3a                	cmp    $0x3a,%al
+     4c2:	0f 8f bc 00 00 00    	jg     584 <gettoken+0x114>
+     4c8:	84 c0                	test   %al,%al
+     4ca:	75 44                	jne    510 <gettoken+0xa0>
+     4cc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4ce:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     4d1:	85 c9                	test   %ecx,%ecx
+     4d3:	74 05                	je     4da <gettoken+0x6a>
+    *eq = s;
+     4d5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4d8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     4da:	39 df                	cmp    %ebx,%edi
+     4dc:	72 09                	jb     4e7 <gettoken+0x77>
+     4de:	eb 1f                	jmp    4ff <gettoken+0x8f>
+    s++;
+     4e0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4e3:	39 fb                	cmp    %edi,%ebx
+     4e5:	74 18                	je     4ff <gettoken+0x8f>
+     4e7:	0f be 07             	movsbl (%edi),%eax
+     4ea:	83 ec 08             	sub    $0x8,%esp
+     4ed:	50                   	push   %eax
+     4ee:	68 38 23 00 00       	push   $0x2338
+     4f3:	e8 b8 07 00 00       	call   cb0 <strchr>
+     4f8:	83 c4 10             	add    $0x10,%esp
+     4fb:	85 c0                	test   %eax,%eax
+     4fd:	75 e1                	jne    4e0 <gettoken+0x70>
+  *ps = s;
+     4ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     502:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     507:	89 f0                	mov    %esi,%eax
+     509:	5b                   	pop    %ebx
+     50a:	5e                   	pop    %esi
+     50b:	5f                   	pop    %edi
+     50c:	5d                   	pop    %ebp
+     50d:	c3                   	ret
+     50e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     510:	79 66                	jns    578 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     512:	39 df                	cmp    %ebx,%edi
+     514:	72 39                	jb     54f <gettoken+0xdf>
+  if(eq)
+     516:	8b 55 14             	mov    0x14(%ebp),%edx
+     519:	85 d2                	test   %edx,%edx
+     51b:	0f 84 b3 00 00 00    	je     5d4 <gettoken+0x164>
+    *eq = s;
+     521:	8b 45 14             	mov    0x14(%ebp),%eax
+     524:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     526:	e9 a9 00 00 00       	jmp    5d4 <gettoken+0x164>
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     530:	0f be 07             	movsbl (%edi),%eax
+     533:	83 ec 08             	sub    $0x8,%esp
+     536:	50                   	push   %eax
+     537:	68 30 23 00 00       	push   $0x2330
+     53c:	e8 6f 07 00 00       	call   cb0 <strchr>
+     541:	83 c4 10             	add    $0x10,%esp
+     544:	85 c0                	test   %eax,%eax
+     546:	75 1f                	jne    567 <gettoken+0xf7>
+      s++;
+     548:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     54b:	39 fb                	cmp    %edi,%ebx
+     54d:	74 77                	je     5c6 <gettoken+0x156>
+     54f:	0f be 07             	movsbl (%edi),%eax
+     552:	83 ec 08             	sub    $0x8,%esp
+     555:	50                   	push   %eax
+     556:	68 38 23 00 00       	push   $0x2338
+     55b:	e8 50 07 00 00       	call   cb0 <strchr>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	85 c0                	test   %eax,%eax
+     565:	74 c9                	je     530 <gettoken+0xc0>
+    ret = 'a';
+     567:	be 61 00 00 00       	mov    $0x61,%esi
+     56c:	e9 5d ff ff ff       	jmp    4ce <gettoken+0x5e>
+     571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     578:	3c 26                	cmp    $0x26,%al
+     57a:	74 08                	je     584 <gettoken+0x114>
+     57c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     57f:	80 f9 01             	cmp    $0x1,%cl
+     582:	77 8e                	ja     512 <gettoken+0xa2>
+  ret = *s;
+     584:	0f be f0             	movsbl %al,%esi
+    s++;
+     587:	83 c7 01             	add    $0x1,%edi
+    break;
+     58a:	e9 3f ff ff ff       	jmp    4ce <gettoken+0x5e>
+     58f:	90                   	nop
+  switch(*s){
+     590:	3c 3e                	cmp    $0x3e,%al
+     592:	75 1c                	jne    5b0 <gettoken+0x140>
+    if(*s == '>'){
+     594:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     598:	74 1f                	je     5b9 <gettoken+0x149>
+    s++;
+     59a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     59d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     5a2:	e9 27 ff ff ff       	jmp    4ce <gettoken+0x5e>
+     5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ae:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5b0:	3c 7c                	cmp    $0x7c,%al
+     5b2:	74 d0                	je     584 <gettoken+0x114>
+     5b4:	e9 59 ff ff ff       	jmp    512 <gettoken+0xa2>
+      s++;
+     5b9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5bc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5c1:	e9 08 ff ff ff       	jmp    4ce <gettoken+0x5e>
+  if(eq)
+     5c6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c9:	85 c0                	test   %eax,%eax
+     5cb:	74 05                	je     5d2 <gettoken+0x162>
+    *eq = s;
+     5cd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5d0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     5d2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     5d4:	be 61 00 00 00       	mov    $0x61,%esi
+     5d9:	e9 21 ff ff ff       	jmp    4ff <gettoken+0x8f>
+     5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	83 ec 0c             	sub    $0xc,%esp
+     5e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     5ef:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     5f1:	39 f3                	cmp    %esi,%ebx
+     5f3:	72 12                	jb     607 <peek+0x27>
+     5f5:	eb 28                	jmp    61f <peek+0x3f>
+     5f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fe:	66 90                	xchg   %ax,%ax
+    s++;
+     600:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     603:	39 de                	cmp    %ebx,%esi
+     605:	74 18                	je     61f <peek+0x3f>
+     607:	0f be 03             	movsbl (%ebx),%eax
+     60a:	83 ec 08             	sub    $0x8,%esp
+     60d:	50                   	push   %eax
+     60e:	68 38 23 00 00       	push   $0x2338
+     613:	e8 98 06 00 00       	call   cb0 <strchr>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	85 c0                	test   %eax,%eax
+     61d:	75 e1                	jne    600 <peek+0x20>
+  *ps = s;
+     61f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     621:	0f be 03             	movsbl (%ebx),%eax
+     624:	31 d2                	xor    %edx,%edx
+     626:	84 c0                	test   %al,%al
+     628:	75 0e                	jne    638 <peek+0x58>
+}
+     62a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     62d:	89 d0                	mov    %edx,%eax
+     62f:	5b                   	pop    %ebx
+     630:	5e                   	pop    %esi
+     631:	5f                   	pop    %edi
+     632:	5d                   	pop    %ebp
+     633:	c3                   	ret
+     634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     638:	83 ec 08             	sub    $0x8,%esp
+     63b:	50                   	push   %eax
+     63c:	ff 75 10             	push   0x10(%ebp)
+     63f:	e8 6c 06 00 00       	call   cb0 <strchr>
+     644:	83 c4 10             	add    $0x10,%esp
+     647:	31 d2                	xor    %edx,%edx
+     649:	85 c0                	test   %eax,%eax
+     64b:	0f 95 c2             	setne  %dl
+}
+     64e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     651:	5b                   	pop    %ebx
+     652:	89 d0                	mov    %edx,%eax
+     654:	5e                   	pop    %esi
+     655:	5f                   	pop    %edi
+     656:	5d                   	pop    %ebp
+     657:	c3                   	ret
+     658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+
+00000660 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	56                   	push   %esi
+     665:	53                   	push   %ebx
+     666:	83 ec 2c             	sub    $0x2c,%esp
+     669:	8b 75 0c             	mov    0xc(%ebp),%esi
+     66c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     66f:	90                   	nop
+     670:	83 ec 04             	sub    $0x4,%esp
+     673:	68 79 1a 00 00       	push   $0x1a79
+     678:	53                   	push   %ebx
+     679:	56                   	push   %esi
+     67a:	e8 61 ff ff ff       	call   5e0 <peek>
+     67f:	83 c4 10             	add    $0x10,%esp
+     682:	85 c0                	test   %eax,%eax
+     684:	0f 84 f6 00 00 00    	je     780 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     68a:	6a 00                	push   $0x0
+     68c:	6a 00                	push   $0x0
+     68e:	53                   	push   %ebx
+     68f:	56                   	push   %esi
+     690:	e8 db fd ff ff       	call   470 <gettoken>
+     695:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     697:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     69a:	50                   	push   %eax
+     69b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     69e:	50                   	push   %eax
+     69f:	53                   	push   %ebx
+     6a0:	56                   	push   %esi
+     6a1:	e8 ca fd ff ff       	call   470 <gettoken>
+     6a6:	83 c4 20             	add    $0x20,%esp
+     6a9:	83 f8 61             	cmp    $0x61,%eax
+     6ac:	0f 85 d9 00 00 00    	jne    78b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6b2:	83 ff 3c             	cmp    $0x3c,%edi
+     6b5:	74 69                	je     720 <parseredirs+0xc0>
+     6b7:	83 ff 3e             	cmp    $0x3e,%edi
+     6ba:	74 05                	je     6c1 <parseredirs+0x61>
+     6bc:	83 ff 2b             	cmp    $0x2b,%edi
+     6bf:	75 af                	jne    670 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6c4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6c7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6cd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     6d0:	6a 18                	push   $0x18
+     6d2:	e8 69 12 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6d7:	83 c4 0c             	add    $0xc,%esp
+     6da:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6dc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     6de:	6a 00                	push   $0x0
+     6e0:	50                   	push   %eax
+     6e1:	e8 aa 05 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+     6e6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     6ec:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     6ef:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     6f2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     6f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     6f8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     6fb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     6fe:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     705:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     708:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     70f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     712:	e9 59 ff ff ff       	jmp    670 <parseredirs+0x10>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     723:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     726:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     729:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     72c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     72f:	6a 18                	push   $0x18
+     731:	e8 0a 12 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     736:	83 c4 0c             	add    $0xc,%esp
+     739:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     73b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     73d:	6a 00                	push   $0x0
+     73f:	50                   	push   %eax
+     740:	e8 4b 05 00 00       	call   c90 <memset>
+  cmd->cmd = subcmd;
+     745:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     748:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     74b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     74e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     751:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     757:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     75a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     75d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     760:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     763:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     76a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     771:	e9 fa fe ff ff       	jmp    670 <parseredirs+0x10>
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     780:	8b 45 08             	mov    0x8(%ebp),%eax
+     783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5f                   	pop    %edi
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+      panic("missing file for redirection");
+     78b:	83 ec 0c             	sub    $0xc,%esp
+     78e:	68 5c 1a 00 00       	push   $0x1a5c
+     793:	e8 d8 f9 ff ff       	call   170 <panic>
+     798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 30             	sub    $0x30,%esp
+     7a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7af:	68 7c 1a 00 00       	push   $0x1a7c
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	e8 25 fe ff ff       	call   5e0 <peek>
+     7bb:	83 c4 10             	add    $0x10,%esp
+     7be:	85 c0                	test   %eax,%eax
+     7c0:	0f 85 aa 00 00 00    	jne    870 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7c6:	83 ec 0c             	sub    $0xc,%esp
+     7c9:	89 c7                	mov    %eax,%edi
+     7cb:	6a 54                	push   $0x54
+     7cd:	e8 6e 11 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7d2:	83 c4 0c             	add    $0xc,%esp
+     7d5:	6a 54                	push   $0x54
+     7d7:	6a 00                	push   $0x0
+     7d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     7dc:	50                   	push   %eax
+     7dd:	e8 ae 04 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     7e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7e5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     7e8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     7ee:	56                   	push   %esi
+     7ef:	53                   	push   %ebx
+     7f0:	50                   	push   %eax
+     7f1:	e8 6a fe ff ff       	call   660 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     7f6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     7f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     7fc:	eb 15                	jmp    813 <parseexec+0x73>
+     7fe:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     800:	83 ec 04             	sub    $0x4,%esp
+     803:	56                   	push   %esi
+     804:	53                   	push   %ebx
+     805:	ff 75 d4             	push   -0x2c(%ebp)
+     808:	e8 53 fe ff ff       	call   660 <parseredirs>
+     80d:	83 c4 10             	add    $0x10,%esp
+     810:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     813:	83 ec 04             	sub    $0x4,%esp
+     816:	68 93 1a 00 00       	push   $0x1a93
+     81b:	56                   	push   %esi
+     81c:	53                   	push   %ebx
+     81d:	e8 be fd ff ff       	call   5e0 <peek>
+     822:	83 c4 10             	add    $0x10,%esp
+     825:	85 c0                	test   %eax,%eax
+     827:	75 5f                	jne    888 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     82c:	50                   	push   %eax
+     82d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     830:	50                   	push   %eax
+     831:	56                   	push   %esi
+     832:	53                   	push   %ebx
+     833:	e8 38 fc ff ff       	call   470 <gettoken>
+     838:	83 c4 10             	add    $0x10,%esp
+     83b:	85 c0                	test   %eax,%eax
+     83d:	74 49                	je     888 <parseexec+0xe8>
+    if(tok != 'a')
+     83f:	83 f8 61             	cmp    $0x61,%eax
+     842:	75 62                	jne    8a6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     844:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     847:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     84a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     84e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     851:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     855:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     858:	83 ff 0a             	cmp    $0xa,%edi
+     85b:	75 a3                	jne    800 <parseexec+0x60>
+      panic("too many args");
+     85d:	83 ec 0c             	sub    $0xc,%esp
+     860:	68 85 1a 00 00       	push   $0x1a85
+     865:	e8 06 f9 ff ff       	call   170 <panic>
+     86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     870:	89 75 0c             	mov    %esi,0xc(%ebp)
+     873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     879:	5b                   	pop    %ebx
+     87a:	5e                   	pop    %esi
+     87b:	5f                   	pop    %edi
+     87c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     87d:	e9 ae 01 00 00       	jmp    a30 <parseblock>
+     882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     888:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     88b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     892:	00 
+  cmd->eargv[argc] = 0;
+     893:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     89a:	00 
+}
+     89b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     89e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a1:	5b                   	pop    %ebx
+     8a2:	5e                   	pop    %esi
+     8a3:	5f                   	pop    %edi
+     8a4:	5d                   	pop    %ebp
+     8a5:	c3                   	ret
+      panic("syntax");
+     8a6:	83 ec 0c             	sub    $0xc,%esp
+     8a9:	68 7e 1a 00 00       	push   $0x1a7e
+     8ae:	e8 bd f8 ff ff       	call   170 <panic>
+     8b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <parsepipe>:
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 14             	sub    $0x14,%esp
+     8c9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8cf:	57                   	push   %edi
+     8d0:	56                   	push   %esi
+     8d1:	e8 ca fe ff ff       	call   7a0 <parseexec>
+  if(peek(ps, es, "|")){
+     8d6:	83 c4 0c             	add    $0xc,%esp
+     8d9:	68 98 1a 00 00       	push   $0x1a98
+  cmd = parseexec(ps, es);
+     8de:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8e0:	57                   	push   %edi
+     8e1:	56                   	push   %esi
+     8e2:	e8 f9 fc ff ff       	call   5e0 <peek>
+     8e7:	83 c4 10             	add    $0x10,%esp
+     8ea:	85 c0                	test   %eax,%eax
+     8ec:	75 12                	jne    900 <parsepipe+0x40>
+}
+     8ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f1:	89 d8                	mov    %ebx,%eax
+     8f3:	5b                   	pop    %ebx
+     8f4:	5e                   	pop    %esi
+     8f5:	5f                   	pop    %edi
+     8f6:	5d                   	pop    %ebp
+     8f7:	c3                   	ret
+     8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     900:	6a 00                	push   $0x0
+     902:	6a 00                	push   $0x0
+     904:	57                   	push   %edi
+     905:	56                   	push   %esi
+     906:	e8 65 fb ff ff       	call   470 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     90b:	58                   	pop    %eax
+     90c:	5a                   	pop    %edx
+     90d:	57                   	push   %edi
+     90e:	56                   	push   %esi
+     90f:	e8 ac ff ff ff       	call   8c0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     914:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     91b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     91d:	e8 1e 10 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     922:	83 c4 0c             	add    $0xc,%esp
+     925:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     927:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     929:	6a 00                	push   $0x0
+     92b:	50                   	push   %eax
+     92c:	e8 5f 03 00 00       	call   c90 <memset>
+  cmd->left = left;
+     931:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     934:	83 c4 10             	add    $0x10,%esp
+     937:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     939:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     93f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     941:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     947:	5b                   	pop    %ebx
+     948:	5e                   	pop    %esi
+     949:	5f                   	pop    %edi
+     94a:	5d                   	pop    %ebp
+     94b:	c3                   	ret
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <parseline>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 24             	sub    $0x24,%esp
+     959:	8b 75 08             	mov    0x8(%ebp),%esi
+     95c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     95f:	57                   	push   %edi
+     960:	56                   	push   %esi
+     961:	e8 5a ff ff ff       	call   8c0 <parsepipe>
+  while(peek(ps, es, "&")){
+     966:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     969:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     96b:	eb 3b                	jmp    9a8 <parseline+0x58>
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     970:	6a 00                	push   $0x0
+     972:	6a 00                	push   $0x0
+     974:	57                   	push   %edi
+     975:	56                   	push   %esi
+     976:	e8 f5 fa ff ff       	call   470 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     97b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     982:	e8 b9 0f 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     987:	83 c4 0c             	add    $0xc,%esp
+     98a:	6a 08                	push   $0x8
+     98c:	6a 00                	push   $0x0
+     98e:	50                   	push   %eax
+     98f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     992:	e8 f9 02 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+     997:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     99a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     99d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     9a3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     9a6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     9a8:	83 ec 04             	sub    $0x4,%esp
+     9ab:	68 9a 1a 00 00       	push   $0x1a9a
+     9b0:	57                   	push   %edi
+     9b1:	56                   	push   %esi
+     9b2:	e8 29 fc ff ff       	call   5e0 <peek>
+     9b7:	83 c4 10             	add    $0x10,%esp
+     9ba:	85 c0                	test   %eax,%eax
+     9bc:	75 b2                	jne    970 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9be:	83 ec 04             	sub    $0x4,%esp
+     9c1:	68 96 1a 00 00       	push   $0x1a96
+     9c6:	57                   	push   %edi
+     9c7:	56                   	push   %esi
+     9c8:	e8 13 fc ff ff       	call   5e0 <peek>
+     9cd:	83 c4 10             	add    $0x10,%esp
+     9d0:	85 c0                	test   %eax,%eax
+     9d2:	75 0c                	jne    9e0 <parseline+0x90>
+}
+     9d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d7:	89 d8                	mov    %ebx,%eax
+     9d9:	5b                   	pop    %ebx
+     9da:	5e                   	pop    %esi
+     9db:	5f                   	pop    %edi
+     9dc:	5d                   	pop    %ebp
+     9dd:	c3                   	ret
+     9de:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     9e0:	6a 00                	push   $0x0
+     9e2:	6a 00                	push   $0x0
+     9e4:	57                   	push   %edi
+     9e5:	56                   	push   %esi
+     9e6:	e8 85 fa ff ff       	call   470 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     9eb:	58                   	pop    %eax
+     9ec:	5a                   	pop    %edx
+     9ed:	57                   	push   %edi
+     9ee:	56                   	push   %esi
+     9ef:	e8 5c ff ff ff       	call   950 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     9f4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     9fb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     9fd:	e8 3e 0f 00 00       	call   1940 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a02:	83 c4 0c             	add    $0xc,%esp
+     a05:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a07:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a09:	6a 00                	push   $0x0
+     a0b:	50                   	push   %eax
+     a0c:	e8 7f 02 00 00       	call   c90 <memset>
+  cmd->left = left;
+     a11:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a14:	83 c4 10             	add    $0x10,%esp
+     a17:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a19:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a1f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a21:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a27:	5b                   	pop    %ebx
+     a28:	5e                   	pop    %esi
+     a29:	5f                   	pop    %edi
+     a2a:	5d                   	pop    %ebp
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <parseblock>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	83 ec 10             	sub    $0x10,%esp
+     a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a3f:	68 7c 1a 00 00       	push   $0x1a7c
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	e8 95 fb ff ff       	call   5e0 <peek>
+     a4b:	83 c4 10             	add    $0x10,%esp
+     a4e:	85 c0                	test   %eax,%eax
+     a50:	74 4a                	je     a9c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a52:	6a 00                	push   $0x0
+     a54:	6a 00                	push   $0x0
+     a56:	56                   	push   %esi
+     a57:	53                   	push   %ebx
+     a58:	e8 13 fa ff ff       	call   470 <gettoken>
+  cmd = parseline(ps, es);
+     a5d:	58                   	pop    %eax
+     a5e:	5a                   	pop    %edx
+     a5f:	56                   	push   %esi
+     a60:	53                   	push   %ebx
+     a61:	e8 ea fe ff ff       	call   950 <parseline>
+  if(!peek(ps, es, ")"))
+     a66:	83 c4 0c             	add    $0xc,%esp
+     a69:	68 b8 1a 00 00       	push   $0x1ab8
+  cmd = parseline(ps, es);
+     a6e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     a70:	56                   	push   %esi
+     a71:	53                   	push   %ebx
+     a72:	e8 69 fb ff ff       	call   5e0 <peek>
+     a77:	83 c4 10             	add    $0x10,%esp
+     a7a:	85 c0                	test   %eax,%eax
+     a7c:	74 2b                	je     aa9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     a7e:	6a 00                	push   $0x0
+     a80:	6a 00                	push   $0x0
+     a82:	56                   	push   %esi
+     a83:	53                   	push   %ebx
+     a84:	e8 e7 f9 ff ff       	call   470 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a89:	83 c4 0c             	add    $0xc,%esp
+     a8c:	56                   	push   %esi
+     a8d:	53                   	push   %ebx
+     a8e:	57                   	push   %edi
+     a8f:	e8 cc fb ff ff       	call   660 <parseredirs>
+}
+     a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a97:	5b                   	pop    %ebx
+     a98:	5e                   	pop    %esi
+     a99:	5f                   	pop    %edi
+     a9a:	5d                   	pop    %ebp
+     a9b:	c3                   	ret
+    panic("parseblock");
+     a9c:	83 ec 0c             	sub    $0xc,%esp
+     a9f:	68 9c 1a 00 00       	push   $0x1a9c
+     aa4:	e8 c7 f6 ff ff       	call   170 <panic>
+    panic("syntax - missing )");
+     aa9:	83 ec 0c             	sub    $0xc,%esp
+     aac:	68 a7 1a 00 00       	push   $0x1aa7
+     ab1:	e8 ba f6 ff ff       	call   170 <panic>
+     ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	83 ec 04             	sub    $0x4,%esp
+     ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     aca:	85 db                	test   %ebx,%ebx
+     acc:	0f 84 7e 00 00 00    	je     b50 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ad2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ad5:	77 20                	ja     af7 <nulterminate+0x37>
+     ad7:	8b 03                	mov    (%ebx),%eax
+     ad9:	ff 24 85 f8 1a 00 00 	jmp    *0x1af8(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     ae0:	83 ec 0c             	sub    $0xc,%esp
+     ae3:	ff 73 04             	push   0x4(%ebx)
+     ae6:	e8 d5 ff ff ff       	call   ac0 <nulterminate>
+    nulterminate(lcmd->right);
+     aeb:	58                   	pop    %eax
+     aec:	ff 73 08             	push   0x8(%ebx)
+     aef:	e8 cc ff ff ff       	call   ac0 <nulterminate>
+    break;
+     af4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     af7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     afc:	c9                   	leave
+     afd:	c3                   	ret
+     afe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	ff 73 04             	push   0x4(%ebx)
+     b06:	e8 b5 ff ff ff       	call   ac0 <nulterminate>
+    break;
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	eb e7                	jmp    af7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b10:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b13:	8d 43 08             	lea    0x8(%ebx),%eax
+     b16:	85 c9                	test   %ecx,%ecx
+     b18:	74 dd                	je     af7 <nulterminate+0x37>
+     b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b20:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b23:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b26:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b29:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b2c:	85 d2                	test   %edx,%edx
+     b2e:	75 f0                	jne    b20 <nulterminate+0x60>
+     b30:	eb c5                	jmp    af7 <nulterminate+0x37>
+     b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b38:	83 ec 0c             	sub    $0xc,%esp
+     b3b:	ff 73 04             	push   0x4(%ebx)
+     b3e:	e8 7d ff ff ff       	call   ac0 <nulterminate>
+    *rcmd->efile = 0;
+     b43:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b46:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b49:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b4c:	eb a9                	jmp    af7 <nulterminate+0x37>
+     b4e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b50:	31 c0                	xor    %eax,%eax
+     b52:	eb a5                	jmp    af9 <nulterminate+0x39>
+     b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <parsecmd>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b65:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b68:	53                   	push   %ebx
+     b69:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b6f:	53                   	push   %ebx
+     b70:	e8 eb 00 00 00       	call   c60 <strlen>
+  cmd = parseline(&s, es);
+     b75:	59                   	pop    %ecx
+     b76:	5e                   	pop    %esi
+  es = s + strlen(s);
+     b77:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b79:	53                   	push   %ebx
+     b7a:	57                   	push   %edi
+     b7b:	e8 d0 fd ff ff       	call   950 <parseline>
+  peek(&s, es, "");
+     b80:	83 c4 0c             	add    $0xc,%esp
+     b83:	68 46 1a 00 00       	push   $0x1a46
+  cmd = parseline(&s, es);
+     b88:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b8a:	53                   	push   %ebx
+     b8b:	57                   	push   %edi
+     b8c:	e8 4f fa ff ff       	call   5e0 <peek>
+  if(s != es){
+     b91:	8b 45 08             	mov    0x8(%ebp),%eax
+     b94:	83 c4 10             	add    $0x10,%esp
+     b97:	39 d8                	cmp    %ebx,%eax
+     b99:	75 13                	jne    bae <parsecmd+0x4e>
+  nulterminate(cmd);
+     b9b:	83 ec 0c             	sub    $0xc,%esp
+     b9e:	56                   	push   %esi
+     b9f:	e8 1c ff ff ff       	call   ac0 <nulterminate>
+}
+     ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba7:	89 f0                	mov    %esi,%eax
+     ba9:	5b                   	pop    %ebx
+     baa:	5e                   	pop    %esi
+     bab:	5f                   	pop    %edi
+     bac:	5d                   	pop    %ebp
+     bad:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     bae:	52                   	push   %edx
+     baf:	50                   	push   %eax
+     bb0:	68 ba 1a 00 00       	push   $0x1aba
+     bb5:	6a 02                	push   $0x2
+     bb7:	e8 64 0c 00 00       	call   1820 <printf>
+    panic("syntax");
+     bbc:	c7 04 24 7e 1a 00 00 	movl   $0x1a7e,(%esp)
+     bc3:	e8 a8 f5 ff ff       	call   170 <panic>
+     bc8:	66 90                	xchg   %ax,%ax
+     bca:	66 90                	xchg   %ax,%ax
+     bcc:	66 90                	xchg   %ax,%ax
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     bd0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     bd1:	31 c0                	xor    %eax,%eax
+{
+     bd3:	89 e5                	mov    %esp,%ebp
+     bd5:	53                   	push   %ebx
+     bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     be0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     be4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     be7:	83 c0 01             	add    $0x1,%eax
+     bea:	84 d2                	test   %dl,%dl
+     bec:	75 f2                	jne    be0 <strcpy+0x10>
+    ;
+  return os;
+}
+     bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bf1:	89 c8                	mov    %ecx,%eax
+     bf3:	c9                   	leave
+     bf4:	c3                   	ret
+     bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	53                   	push   %ebx
+     c04:	8b 55 08             	mov    0x8(%ebp),%edx
+     c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c0a:	0f b6 02             	movzbl (%edx),%eax
+     c0d:	84 c0                	test   %al,%al
+     c0f:	75 17                	jne    c28 <strcmp+0x28>
+     c11:	eb 3a                	jmp    c4d <strcmp+0x4d>
+     c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c17:	90                   	nop
+     c18:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c1c:	83 c2 01             	add    $0x1,%edx
+     c1f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     c22:	84 c0                	test   %al,%al
+     c24:	74 1a                	je     c40 <strcmp+0x40>
+    p++, q++;
+     c26:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     c28:	0f b6 19             	movzbl (%ecx),%ebx
+     c2b:	38 c3                	cmp    %al,%bl
+     c2d:	74 e9                	je     c18 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     c2f:	29 d8                	sub    %ebx,%eax
+}
+     c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c34:	c9                   	leave
+     c35:	c3                   	ret
+     c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     c40:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     c44:	31 c0                	xor    %eax,%eax
+     c46:	29 d8                	sub    %ebx,%eax
+}
+     c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c4b:	c9                   	leave
+     c4c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     c4d:	0f b6 19             	movzbl (%ecx),%ebx
+     c50:	31 c0                	xor    %eax,%eax
+     c52:	eb db                	jmp    c2f <strcmp+0x2f>
+     c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c66:	80 3a 00             	cmpb   $0x0,(%edx)
+     c69:	74 15                	je     c80 <strlen+0x20>
+     c6b:	31 c0                	xor    %eax,%eax
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+     c70:	83 c0 01             	add    $0x1,%eax
+     c73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     c77:	89 c1                	mov    %eax,%ecx
+     c79:	75 f5                	jne    c70 <strlen+0x10>
+    ;
+  return n;
+}
+     c7b:	89 c8                	mov    %ecx,%eax
+     c7d:	5d                   	pop    %ebp
+     c7e:	c3                   	ret
+     c7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     c80:	31 c9                	xor    %ecx,%ecx
+}
+     c82:	5d                   	pop    %ebp
+     c83:	89 c8                	mov    %ecx,%eax
+     c85:	c3                   	ret
+     c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c9d:	89 d7                	mov    %edx,%edi
+     c9f:	fc                   	cld
+     ca0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ca2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ca5:	89 d0                	mov    %edx,%eax
+     ca7:	c9                   	leave
+     ca8:	c3                   	ret
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     cba:	0f b6 10             	movzbl (%eax),%edx
+     cbd:	84 d2                	test   %dl,%dl
+     cbf:	75 12                	jne    cd3 <strchr+0x23>
+     cc1:	eb 1d                	jmp    ce0 <strchr+0x30>
+     cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cc7:	90                   	nop
+     cc8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     ccc:	83 c0 01             	add    $0x1,%eax
+     ccf:	84 d2                	test   %dl,%dl
+     cd1:	74 0d                	je     ce0 <strchr+0x30>
+    if(*s == c)
+     cd3:	38 d1                	cmp    %dl,%cl
+     cd5:	75 f1                	jne    cc8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     cd7:	5d                   	pop    %ebp
+     cd8:	c3                   	ret
+     cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     ce0:	31 c0                	xor    %eax,%eax
+}
+     ce2:	5d                   	pop    %ebp
+     ce3:	c3                   	ret
+     ce4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+
+00000cf0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     cf5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     cf8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     cf9:	31 db                	xor    %ebx,%ebx
+{
+     cfb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     cfe:	eb 27                	jmp    d27 <gets+0x37>
+    cc = read(0, &c, 1);
+     d00:	83 ec 04             	sub    $0x4,%esp
+     d03:	6a 01                	push   $0x1
+     d05:	56                   	push   %esi
+     d06:	6a 00                	push   $0x0
+     d08:	e8 31 01 00 00       	call   e3e <read>
+    if(cc < 1)
+     d0d:	83 c4 10             	add    $0x10,%esp
+     d10:	85 c0                	test   %eax,%eax
+     d12:	7e 1d                	jle    d31 <gets+0x41>
+      break;
+    buf[i++] = c;
+     d14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d18:	8b 55 08             	mov    0x8(%ebp),%edx
+     d1b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     d1f:	3c 0a                	cmp    $0xa,%al
+     d21:	74 10                	je     d33 <gets+0x43>
+     d23:	3c 0d                	cmp    $0xd,%al
+     d25:	74 0c                	je     d33 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     d27:	89 df                	mov    %ebx,%edi
+     d29:	83 c3 01             	add    $0x1,%ebx
+     d2c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     d2f:	7c cf                	jl     d00 <gets+0x10>
+     d31:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     d33:	8b 45 08             	mov    0x8(%ebp),%eax
+     d36:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d3d:	5b                   	pop    %ebx
+     d3e:	5e                   	pop    %esi
+     d3f:	5f                   	pop    %edi
+     d40:	5d                   	pop    %ebp
+     d41:	c3                   	ret
+     d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d55:	83 ec 08             	sub    $0x8,%esp
+     d58:	6a 00                	push   $0x0
+     d5a:	ff 75 08             	push   0x8(%ebp)
+     d5d:	e8 04 01 00 00       	call   e66 <open>
+  if(fd < 0)
+     d62:	83 c4 10             	add    $0x10,%esp
+     d65:	85 c0                	test   %eax,%eax
+     d67:	78 27                	js     d90 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     d69:	83 ec 08             	sub    $0x8,%esp
+     d6c:	ff 75 0c             	push   0xc(%ebp)
+     d6f:	89 c3                	mov    %eax,%ebx
+     d71:	50                   	push   %eax
+     d72:	e8 07 01 00 00       	call   e7e <fstat>
+  close(fd);
+     d77:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     d7a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d7c:	e8 cd 00 00 00       	call   e4e <close>
+  return r;
+     d81:	83 c4 10             	add    $0x10,%esp
+}
+     d84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d87:	89 f0                	mov    %esi,%eax
+     d89:	5b                   	pop    %ebx
+     d8a:	5e                   	pop    %esi
+     d8b:	5d                   	pop    %ebp
+     d8c:	c3                   	ret
+     d8d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     d90:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d95:	eb ed                	jmp    d84 <stat+0x34>
+     d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	53                   	push   %ebx
+     da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     da7:	0f be 02             	movsbl (%edx),%eax
+     daa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     dad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     db5:	77 1e                	ja     dd5 <atoi+0x35>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     dc0:	83 c2 01             	add    $0x1,%edx
+     dc3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     dc6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     dca:	0f be 02             	movsbl (%edx),%eax
+     dcd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     dd0:	80 fb 09             	cmp    $0x9,%bl
+     dd3:	76 eb                	jbe    dc0 <atoi+0x20>
+  return n;
+}
+     dd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dd8:	89 c8                	mov    %ecx,%eax
+     dda:	c9                   	leave
+     ddb:	c3                   	ret
+     ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000de0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+     de5:	8b 45 10             	mov    0x10(%ebp),%eax
+     de8:	8b 55 08             	mov    0x8(%ebp),%edx
+     deb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     dee:	85 c0                	test   %eax,%eax
+     df0:	7e 13                	jle    e05 <memmove+0x25>
+     df2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     df4:	89 d7                	mov    %edx,%edi
+     df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e01:	39 f8                	cmp    %edi,%eax
+     e03:	75 fb                	jne    e00 <memmove+0x20>
+  return vdst;
+}
+     e05:	5e                   	pop    %esi
+     e06:	89 d0                	mov    %edx,%eax
+     e08:	5f                   	pop    %edi
+     e09:	5d                   	pop    %ebp
+     e0a:	c3                   	ret
+     e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+
+00000e10 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+     e16:	a1 a4 23 00 00       	mov    0x23a4,%eax
+     e1b:	85 c0                	test   %eax,%eax
+     e1d:	74 02                	je     e21 <exit+0x11>
+    exithook();
+     e1f:	ff d0                	call   *%eax
+  _exit();
+     e21:	e8 10 01 00 00       	call   f36 <_exit>
+
+00000e26 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     e26:	b8 01 00 00 00       	mov    $0x1,%eax
+     e2b:	cd 40                	int    $0x40
+     e2d:	c3                   	ret
+
+00000e2e <wait>:
+SYSCALL(wait)
+     e2e:	b8 03 00 00 00       	mov    $0x3,%eax
+     e33:	cd 40                	int    $0x40
+     e35:	c3                   	ret
+
+00000e36 <pipe>:
+SYSCALL(pipe)
+     e36:	b8 04 00 00 00       	mov    $0x4,%eax
+     e3b:	cd 40                	int    $0x40
+     e3d:	c3                   	ret
+
+00000e3e <read>:
+SYSCALL(read)
+     e3e:	b8 05 00 00 00       	mov    $0x5,%eax
+     e43:	cd 40                	int    $0x40
+     e45:	c3                   	ret
+
+00000e46 <write>:
+SYSCALL(write)
+     e46:	b8 10 00 00 00       	mov    $0x10,%eax
+     e4b:	cd 40                	int    $0x40
+     e4d:	c3                   	ret
+
+00000e4e <close>:
+SYSCALL(close)
+     e4e:	b8 15 00 00 00       	mov    $0x15,%eax
+     e53:	cd 40                	int    $0x40
+     e55:	c3                   	ret
+
+00000e56 <kill>:
+SYSCALL(kill)
+     e56:	b8 06 00 00 00       	mov    $0x6,%eax
+     e5b:	cd 40                	int    $0x40
+     e5d:	c3                   	ret
+
+00000e5e <exec>:
+SYSCALL(exec)
+     e5e:	b8 07 00 00 00       	mov    $0x7,%eax
+     e63:	cd 40                	int    $0x40
+     e65:	c3                   	ret
+
+00000e66 <open>:
+SYSCALL(open)
+     e66:	b8 0f 00 00 00       	mov    $0xf,%eax
+     e6b:	cd 40                	int    $0x40
+     e6d:	c3                   	ret
+
+00000e6e <mknod>:
+SYSCALL(mknod)
+     e6e:	b8 11 00 00 00       	mov    $0x11,%eax
+     e73:	cd 40                	int    $0x40
+     e75:	c3                   	ret
+
+00000e76 <unlink>:
+SYSCALL(unlink)
+     e76:	b8 12 00 00 00       	mov    $0x12,%eax
+     e7b:	cd 40                	int    $0x40
+     e7d:	c3                   	ret
+
+00000e7e <fstat>:
+SYSCALL(fstat)
+     e7e:	b8 08 00 00 00       	mov    $0x8,%eax
+     e83:	cd 40                	int    $0x40
+     e85:	c3                   	ret
+
+00000e86 <link>:
+SYSCALL(link)
+     e86:	b8 13 00 00 00       	mov    $0x13,%eax
+     e8b:	cd 40                	int    $0x40
+     e8d:	c3                   	ret
+
+00000e8e <mkdir>:
+SYSCALL(mkdir)
+     e8e:	b8 14 00 00 00       	mov    $0x14,%eax
+     e93:	cd 40                	int    $0x40
+     e95:	c3                   	ret
+
+00000e96 <chdir>:
+SYSCALL(chdir)
+     e96:	b8 09 00 00 00       	mov    $0x9,%eax
+     e9b:	cd 40                	int    $0x40
+     e9d:	c3                   	ret
+
+00000e9e <dup>:
+SYSCALL(dup)
+     e9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ea3:	cd 40                	int    $0x40
+     ea5:	c3                   	ret
+
+00000ea6 <getpid>:
+SYSCALL(getpid)
+     ea6:	b8 0b 00 00 00       	mov    $0xb,%eax
+     eab:	cd 40                	int    $0x40
+     ead:	c3                   	ret
+
+00000eae <sbrk>:
+SYSCALL(sbrk)
+     eae:	b8 0c 00 00 00       	mov    $0xc,%eax
+     eb3:	cd 40                	int    $0x40
+     eb5:	c3                   	ret
+
+00000eb6 <sleep>:
+SYSCALL(sleep)
+     eb6:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ebb:	cd 40                	int    $0x40
+     ebd:	c3                   	ret
+
+00000ebe <uptime>:
+SYSCALL(uptime)
+     ebe:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ec3:	cd 40                	int    $0x40
+     ec5:	c3                   	ret
+
+00000ec6 <sigprocmask>:
+SYSCALL(sigprocmask)
+     ec6:	b8 16 00 00 00       	mov    $0x16,%eax
+     ecb:	cd 40                	int    $0x40
+     ecd:	c3                   	ret
+
+00000ece <sigaction>:
+SYSCALL(sigaction)
+     ece:	b8 17 00 00 00       	mov    $0x17,%eax
+     ed3:	cd 40                	int    $0x40
+     ed5:	c3                   	ret
+
+00000ed6 <sigret>:
+SYSCALL(sigret)
+     ed6:	b8 18 00 00 00       	mov    $0x18,%eax
+     edb:	cd 40                	int    $0x40
+     edd:	c3                   	ret
+
+00000ede <readv>:
+SYSCALL(readv)
+     ede:	b8 19 00 00 00       	mov    $0x19,%eax
+     ee3:	cd 40                	int    $0x40
+     ee5:	c3                   	ret
+
+00000ee6 <writev>:
+SYSCALL(writev)
+     ee6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     eeb:	cd 40                	int    $0x40
+     eed:	c3                   	ret
+
+00000eee <nanosleep>:
+SYSCALL(nanosleep)
+     eee:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ef3:	cd 40                	int    $0x40
+     ef5:	c3                   	ret
+
+00000ef6 <setpriority>:
+SYSCALL(setpriority)
+     ef6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     efb:	cd 40                	int    $0x40
+     efd:	c3                   	ret
+
+00000efe <sched_setattr>:
+SYSCALL(sched_setattr)
+     efe:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f03:	cd 40                	int    $0x40
+     f05:	c3                   	ret
+
+00000f06 <sched_yield>:
+SYSCALL(sched_yield)
+     f06:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f0b:	cd 40                	int    $0x40
+     f0d:	c3                   	ret
+
+00000f0e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     f0e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f13:	cd 40                	int    $0x40
+     f15:	c3                   	ret
+
+00000f16 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     f16:	b8 20 00 00 00       	mov    $0x20,%eax
+     f1b:	cd 40                	int    $0x40
+     f1d:	c3                   	ret
+
+00000f1e <getrusage>:
+SYSCALL(getrusage)
+     f1e:	b8 21 00 00 00       	mov    $0x21,%eax
+     f23:	cd 40                	int    $0x40
+     f25:	c3                   	ret
+
+00000f26 <syslat>:
+SYSCALL(syslat)
+     f26:	b8 22 00 00 00       	mov    $0x22,%eax
+     f2b:	cd 40                	int    $0x40
+     f2d:	c3                   	ret
+
+00000f2e <sched_getattr>:
+SYSCALL(sched_getattr)
+     f2e:	b8 23 00 00 00       	mov    $0x23,%eax
+     f33:	cd 40                	int    $0x40
+     f35:	c3                   	ret
+
+00000f36 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+     f36:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+     f3b:	cd 40                	int    $0x40
+  ret
+     f3d:	c3                   	ret
+     f3e:	66 90                	xchg   %ax,%ax
+
+00000f40 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	56                   	push   %esi
+     f44:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+     f45:	31 db                	xor    %ebx,%ebx
+     f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+     f50:	8b 34 9d c0 23 00 00 	mov    0x23c0(,%ebx,4),%esi
+     f57:	85 f6                	test   %esi,%esi
+     f59:	74 27                	je     f82 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     f5b:	8b 46 08             	mov    0x8(%esi),%eax
+     f5e:	85 c0                	test   %eax,%eax
+     f60:	7e 12                	jle    f74 <flushall+0x34>
+     f62:	83 ec 04             	sub    $0x4,%esp
+     f65:	50                   	push   %eax
+     f66:	8d 46 10             	lea    0x10(%esi),%eax
+     f69:	50                   	push   %eax
+     f6a:	ff 36                	push   (%esi)
+     f6c:	e8 d5 fe ff ff       	call   e46 <write>
+     f71:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+     f74:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     f7b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+     f82:	83 c3 01             	add    $0x1,%ebx
+     f85:	83 fb 10             	cmp    $0x10,%ebx
+     f88:	75 c6                	jne    f50 <flushall+0x10>
+}
+     f8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f8d:	5b                   	pop    %ebx
+     f8e:	5e                   	pop    %esi
+     f8f:	5d                   	pop    %ebp
+     f90:	c3                   	ret
+     f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9f:	90                   	nop
+
+00000fa0 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     fa0:	55                   	push   %ebp
+     fa1:	89 e5                	mov    %esp,%ebp
+     fa3:	57                   	push   %edi
+     fa4:	56                   	push   %esi
+     fa5:	53                   	push   %ebx
+     fa6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     fa8:	89 d1                	mov    %edx,%ecx
+{
+     faa:	83 ec 2c             	sub    $0x2c,%esp
+     fad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     fb0:	85 d2                	test   %edx,%edx
+     fb2:	0f 89 c8 00 00 00    	jns    1080 <printint+0xe0>
+     fb8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     fbc:	0f 84 be 00 00 00    	je     1080 <printint+0xe0>
+    x = -xx;
+     fc2:	f7 d9                	neg    %ecx
+    neg = 1;
+     fc4:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     fc9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     fcc:	31 f6                	xor    %esi,%esi
+     fce:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+     fd0:	89 c8                	mov    %ecx,%eax
+     fd2:	31 d2                	xor    %edx,%edx
+     fd4:	89 f7                	mov    %esi,%edi
+     fd6:	f7 f3                	div    %ebx
+     fd8:	8d 76 01             	lea    0x1(%esi),%esi
+     fdb:	0f b6 92 70 1b 00 00 	movzbl 0x1b70(%edx),%edx
+     fe2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     fe6:	89 ca                	mov    %ecx,%edx
+     fe8:	89 c1                	mov    %eax,%ecx
+     fea:	39 da                	cmp    %ebx,%edx
+     fec:	73 e2                	jae    fd0 <printint+0x30>
+  if(neg)
+     fee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     ff1:	85 c0                	test   %eax,%eax
+     ff3:	74 07                	je     ffc <printint+0x5c>
+    buf[i++] = '-';
+     ff5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     ffa:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+     ffc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     fff:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1002:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1004:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+    1007:	8b 41 08             	mov    0x8(%ecx),%eax
+    100a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    100d:	89 ce                	mov    %ecx,%esi
+    100f:	eb 28                	jmp    1039 <printint+0x99>
+    1011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+    1018:	89 c1                	mov    %eax,%ecx
+    101a:	83 c0 01             	add    $0x1,%eax
+    101d:	89 46 08             	mov    %eax,0x8(%esi)
+    1020:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    1024:	80 fa 0a             	cmp    $0xa,%dl
+    1027:	75 07                	jne    1030 <printint+0x90>
+    f->nl = 1;
+    1029:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+    1030:	8d 57 ff             	lea    -0x1(%edi),%edx
+    1033:	39 fb                	cmp    %edi,%ebx
+    1035:	74 39                	je     1070 <printint+0xd0>
+    1037:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+    1039:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+    103c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1041:	75 d5                	jne    1018 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1043:	83 ec 04             	sub    $0x4,%esp
+    1046:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+    1049:	68 00 02 00 00       	push   $0x200
+    104e:	ff 75 d0             	push   -0x30(%ebp)
+    1051:	ff 36                	push   (%esi)
+    1053:	e8 ee fd ff ff       	call   e46 <write>
+  return r;
+    1058:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+    105c:	83 c4 10             	add    $0x10,%esp
+    105f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    1061:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    1068:	b8 01 00 00 00       	mov    $0x1,%eax
+    106d:	eb ae                	jmp    101d <printint+0x7d>
+    106f:	90                   	nop
+}
+    1070:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1073:	5b                   	pop    %ebx
+    1074:	5e                   	pop    %esi
+    1075:	5f                   	pop    %edi
+    1076:	5d                   	pop    %ebp
+    1077:	c3                   	ret
+    1078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    107f:	90                   	nop
+  neg = 0;
+    1080:	31 c0                	xor    %eax,%eax
+    1082:	e9 42 ff ff ff       	jmp    fc9 <printint+0x29>
+    1087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108e:	66 90                	xchg   %ax,%ax
+
+00001090 <bputc>:
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	53                   	push   %ebx
+    1094:	89 c3                	mov    %eax,%ebx
+    1096:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+    1099:	8b 40 08             	mov    0x8(%eax),%eax
+    109c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    10a1:	74 1d                	je     10c0 <bputc+0x30>
+  f->buf[f->n++] = c;
+    10a3:	8d 48 01             	lea    0x1(%eax),%ecx
+    10a6:	89 4b 08             	mov    %ecx,0x8(%ebx)
+    10a9:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+    10ad:	80 fa 0a             	cmp    $0xa,%dl
+    10b0:	75 07                	jne    10b9 <bputc+0x29>
+    f->nl = 1;
+    10b2:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+    10b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10bc:	c9                   	leave
+    10bd:	c3                   	ret
+    10be:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    10c0:	83 ec 04             	sub    $0x4,%esp
+    10c3:	8d 43 10             	lea    0x10(%ebx),%eax
+    10c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    10c9:	68 00 02 00 00       	push   $0x200
+    10ce:	50                   	push   %eax
+    10cf:	ff 33                	push   (%ebx)
+    10d1:	e8 70 fd ff ff       	call   e46 <write>
+  return r;
+    10d6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10d9:	83 c4 10             	add    $0x10,%esp
+    10dc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+    10e1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    10e8:	31 c0                	xor    %eax,%eax
+    10ea:	eb ba                	jmp    10a6 <bputc+0x16>
+    10ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010f0 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	56                   	push   %esi
+    10f5:	53                   	push   %ebx
+    10f6:	83 ec 1c             	sub    $0x1c,%esp
+    10f9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    10fc:	0f b6 0a             	movzbl (%edx),%ecx
+    10ff:	84 c9                	test   %cl,%cl
+    1101:	74 47                	je     114a <vfprintf+0x5a>
+    1103:	8d 5a 01             	lea    0x1(%edx),%ebx
+    1106:	89 c7                	mov    %eax,%edi
+    1108:	31 d2                	xor    %edx,%edx
+    110a:	89 de                	mov    %ebx,%esi
+    110c:	89 cb                	mov    %ecx,%ebx
+    110e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    1110:	0f be cb             	movsbl %bl,%ecx
+    1113:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1116:	85 d2                	test   %edx,%edx
+    1118:	75 4e                	jne    1168 <vfprintf+0x78>
+      if(c == '%'){
+    111a:	83 f8 25             	cmp    $0x25,%eax
+    111d:	74 69                	je     1188 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+    111f:	8b 47 08             	mov    0x8(%edi),%eax
+    1122:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1127:	0f 84 73 01 00 00    	je     12a0 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+    112d:	8d 48 01             	lea    0x1(%eax),%ecx
+    1130:	89 4f 08             	mov    %ecx,0x8(%edi)
+    1133:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+    1137:	80 fb 0a             	cmp    $0xa,%bl
+    113a:	74 1c                	je     1158 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+    113c:	31 d2                	xor    %edx,%edx
+    113e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+    1140:	0f b6 1e             	movzbl (%esi),%ebx
+    1143:	83 c6 01             	add    $0x1,%esi
+    1146:	84 db                	test   %bl,%bl
+    1148:	75 c6                	jne    1110 <vfprintf+0x20>
+    }
+  }
+}
+    114a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    114d:	5b                   	pop    %ebx
+    114e:	5e                   	pop    %esi
+    114f:	5f                   	pop    %edi
+    1150:	5d                   	pop    %ebp
+    1151:	c3                   	ret
+    1152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+    1158:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+    115f:	eb df                	jmp    1140 <vfprintf+0x50>
+    1161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+    1168:	83 fa 25             	cmp    $0x25,%edx
+    116b:	75 d3                	jne    1140 <vfprintf+0x50>
+      if(c == 'd'){
+    116d:	83 f8 25             	cmp    $0x25,%eax
+    1170:	74 37                	je     11a9 <vfprintf+0xb9>
+    1172:	83 e8 63             	sub    $0x63,%eax
+    1175:	83 f8 15             	cmp    $0x15,%eax
+    1178:	77 16                	ja     1190 <vfprintf+0xa0>
+    117a:	ff 24 85 18 1b 00 00 	jmp    *0x1b18(,%eax,4)
+    1181:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+    1188:	ba 25 00 00 00       	mov    $0x25,%edx
+    118d:	eb b1                	jmp    1140 <vfprintf+0x50>
+    118f:	90                   	nop
+  if(f->n == BUFSIZ)
+    1190:	8b 47 08             	mov    0x8(%edi),%eax
+    1193:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1198:	0f 84 4c 01 00 00    	je     12ea <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+    119e:	8d 50 01             	lea    0x1(%eax),%edx
+    11a1:	89 57 08             	mov    %edx,0x8(%edi)
+    11a4:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+    11a9:	89 ca                	mov    %ecx,%edx
+    11ab:	89 f8                	mov    %edi,%eax
+    11ad:	e8 de fe ff ff       	call   1090 <bputc>
+    11b2:	eb 88                	jmp    113c <vfprintf+0x4c>
+    11b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+    11b8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    11bb:	83 ec 0c             	sub    $0xc,%esp
+    11be:	b9 10 00 00 00       	mov    $0x10,%ecx
+    11c3:	8b 13                	mov    (%ebx),%edx
+    11c5:	6a 00                	push   $0x0
+    11c7:	89 f8                	mov    %edi,%eax
+        ap++;
+    11c9:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+    11cc:	e8 cf fd ff ff       	call   fa0 <printint>
+        ap++;
+    11d1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    11d4:	83 c4 10             	add    $0x10,%esp
+    11d7:	e9 60 ff ff ff       	jmp    113c <vfprintf+0x4c>
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+    11e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    11e3:	8b 10                	mov    (%eax),%edx
+        ap++;
+    11e5:	83 c0 04             	add    $0x4,%eax
+    11e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    11eb:	85 d2                	test   %edx,%edx
+    11ed:	0f 84 dd 00 00 00    	je     12d0 <vfprintf+0x1e0>
+        while(*s != 0){
+    11f3:	0f b6 1a             	movzbl (%edx),%ebx
+    11f6:	84 db                	test   %bl,%bl
+    11f8:	0f 84 3e ff ff ff    	je     113c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    11fe:	8d 4f 10             	lea    0x10(%edi),%ecx
+    1201:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+    1204:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1207:	89 fe                	mov    %edi,%esi
+    1209:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    120c:	89 d7                	mov    %edx,%edi
+    120e:	eb 27                	jmp    1237 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+    1210:	89 c1                	mov    %eax,%ecx
+    1212:	83 c0 01             	add    $0x1,%eax
+    1215:	89 46 08             	mov    %eax,0x8(%esi)
+    1218:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    121c:	80 fb 0a             	cmp    $0xa,%bl
+    121f:	75 07                	jne    1228 <vfprintf+0x138>
+    f->nl = 1;
+    1221:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+    1228:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+    122c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+    122f:	84 db                	test   %bl,%bl
+    1231:	0f 84 a9 00 00 00    	je     12e0 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+    1237:	3d 00 02 00 00       	cmp    $0x200,%eax
+    123c:	75 d2                	jne    1210 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    123e:	83 ec 04             	sub    $0x4,%esp
+    1241:	68 00 02 00 00       	push   $0x200
+    1246:	ff 75 e0             	push   -0x20(%ebp)
+    1249:	ff 36                	push   (%esi)
+    124b:	e8 f6 fb ff ff       	call   e46 <write>
+  return r;
+    1250:	83 c4 10             	add    $0x10,%esp
+    1253:	b8 01 00 00 00       	mov    $0x1,%eax
+    1258:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    125a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    1261:	eb b2                	jmp    1215 <vfprintf+0x125>
+    1263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1267:	90                   	nop
+        printint(f, *ap, 10, 1);
+    1268:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    126b:	83 ec 0c             	sub    $0xc,%esp
+    126e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1273:	8b 13                	mov    (%ebx),%edx
+    1275:	6a 01                	push   $0x1
+    1277:	e9 4b ff ff ff       	jmp    11c7 <vfprintf+0xd7>
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+    1280:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    1283:	89 f8                	mov    %edi,%eax
+    1285:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+    1288:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+    128b:	e8 00 fe ff ff       	call   1090 <bputc>
+        ap++;
+    1290:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+    1293:	31 d2                	xor    %edx,%edx
+    1295:	e9 a6 fe ff ff       	jmp    1140 <vfprintf+0x50>
+    129a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    12a0:	83 ec 04             	sub    $0x4,%esp
+    12a3:	8d 47 10             	lea    0x10(%edi),%eax
+    12a6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    12a9:	68 00 02 00 00       	push   $0x200
+    12ae:	50                   	push   %eax
+    12af:	ff 37                	push   (%edi)
+    12b1:	e8 90 fb ff ff       	call   e46 <write>
+  return r;
+    12b6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    12b9:	83 c4 10             	add    $0x10,%esp
+    12bc:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+    12be:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+    12c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+    12ca:	e9 61 fe ff ff       	jmp    1130 <vfprintf+0x40>
+    12cf:	90                   	nop
+          s = "(null)";
+    12d0:	ba 10 1b 00 00       	mov    $0x1b10,%edx
+    12d5:	bb 28 00 00 00       	mov    $0x28,%ebx
+    12da:	e9 1f ff ff ff       	jmp    11fe <vfprintf+0x10e>
+    12df:	90                   	nop
+    12e0:	89 f7                	mov    %esi,%edi
+    12e2:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    12e5:	e9 52 fe ff ff       	jmp    113c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    12ea:	83 ec 04             	sub    $0x4,%esp
+    12ed:	8d 47 10             	lea    0x10(%edi),%eax
+    12f0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    12f3:	68 00 02 00 00       	push   $0x200
+    12f8:	50                   	push   %eax
+    12f9:	ff 37                	push   (%edi)
+    12fb:	e8 46 fb ff ff       	call   e46 <write>
+  return r;
+    1300:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1303:	83 c4 10             	add    $0x10,%esp
+    1306:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+    130b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+    1312:	31 c0                	xor    %eax,%eax
+    1314:	e9 88 fe ff ff       	jmp    11a1 <vfprintf+0xb1>
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <fdopen>:
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	56                   	push   %esi
+    1324:	53                   	push   %ebx
+    1325:	83 ec 20             	sub    $0x20,%esp
+    1328:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+    132b:	83 fe 0f             	cmp    $0xf,%esi
+    132e:	0f 87 84 00 00 00    	ja     13b8 <fdopen+0x98>
+  if(streams[fd])
+    1334:	8b 1c b5 c0 23 00 00 	mov    0x23c0(,%esi,4),%ebx
+    133b:	85 db                	test   %ebx,%ebx
+    133d:	74 11                	je     1350 <fdopen+0x30>
+}
+    133f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1342:	89 d8                	mov    %ebx,%eax
+    1344:	5b                   	pop    %ebx
+    1345:	5e                   	pop    %esi
+    1346:	5d                   	pop    %ebp
+    1347:	c3                   	ret
+    1348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+    1350:	83 ec 0c             	sub    $0xc,%esp
+    1353:	68 10 02 00 00       	push   $0x210
+    1358:	e8 e3 05 00 00       	call   1940 <malloc>
+    135d:	83 c4 10             	add    $0x10,%esp
+    1360:	89 c3                	mov    %eax,%ebx
+    1362:	85 c0                	test   %eax,%eax
+    1364:	74 52                	je     13b8 <fdopen+0x98>
+  f->fd = fd;
+    1366:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    1368:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+    136b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+    1372:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+    1379:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    1380:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1383:	50                   	push   %eax
+    1384:	56                   	push   %esi
+    1385:	e8 f4 fa ff ff       	call   e7e <fstat>
+    138a:	83 c4 10             	add    $0x10,%esp
+    138d:	85 c0                	test   %eax,%eax
+    138f:	75 07                	jne    1398 <fdopen+0x78>
+    1391:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    1396:	74 30                	je     13c8 <fdopen+0xa8>
+  streams[fd] = f;
+    1398:	89 1c b5 c0 23 00 00 	mov    %ebx,0x23c0(,%esi,4)
+}
+    139f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+    13a1:	c7 05 a4 23 00 00 40 	movl   $0xf40,0x23a4
+    13a8:	0f 00 00 
+}
+    13ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13ae:	5b                   	pop    %ebx
+    13af:	5e                   	pop    %esi
+    13b0:	5d                   	pop    %ebp
+    13b1:	c3                   	ret
+    13b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    13b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    13bb:	31 db                	xor    %ebx,%ebx
+}
+    13bd:	89 d8                	mov    %ebx,%eax
+    13bf:	5b                   	pop    %ebx
+    13c0:	5e                   	pop    %esi
+    13c1:	5d                   	pop    %ebp
+    13c2:	c3                   	ret
+    13c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13c7:	90                   	nop
+    f->mode = _IOLBF;
+    13c8:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+    13cf:	eb c7                	jmp    1398 <fdopen+0x78>
+    13d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13df:	90                   	nop
+
+000013e0 <fopen>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	53                   	push   %ebx
+    13e4:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+    13e7:	ff 75 0c             	push   0xc(%ebp)
+    13ea:	ff 75 08             	push   0x8(%ebp)
+    13ed:	e8 74 fa ff ff       	call   e66 <open>
+    13f2:	83 c4 10             	add    $0x10,%esp
+    13f5:	85 c0                	test   %eax,%eax
+    13f7:	78 37                	js     1430 <fopen+0x50>
+    13f9:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+    13fb:	8b 04 85 c0 23 00 00 	mov    0x23c0(,%eax,4),%eax
+    1402:	85 c0                	test   %eax,%eax
+    1404:	74 17                	je     141d <fopen+0x3d>
+    free(streams[fd]);
+    1406:	83 ec 0c             	sub    $0xc,%esp
+    1409:	50                   	push   %eax
+    140a:	e8 a1 04 00 00       	call   18b0 <free>
+    streams[fd] = 0;
+    140f:	83 c4 10             	add    $0x10,%esp
+    1412:	c7 04 9d c0 23 00 00 	movl   $0x0,0x23c0(,%ebx,4)
+    1419:	00 00 00 00 
+  return fdopen(fd);
+    141d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1420:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1423:	c9                   	leave
+  return fdopen(fd);
+    1424:	e9 f7 fe ff ff       	jmp    1320 <fdopen>
+    1429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+    1430:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1433:	31 c0                	xor    %eax,%eax
+    1435:	c9                   	leave
+    1436:	c3                   	ret
+    1437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143e:	66 90                	xchg   %ax,%ax
+
+00001440 <setvbuf>:
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	56                   	push   %esi
+    1444:	53                   	push   %ebx
+    1445:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1448:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+    144b:	83 fe 02             	cmp    $0x2,%esi
+    144e:	77 38                	ja     1488 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1450:	8b 43 08             	mov    0x8(%ebx),%eax
+    1453:	85 c0                	test   %eax,%eax
+    1455:	7e 12                	jle    1469 <setvbuf+0x29>
+    1457:	83 ec 04             	sub    $0x4,%esp
+    145a:	50                   	push   %eax
+    145b:	8d 43 10             	lea    0x10(%ebx),%eax
+    145e:	50                   	push   %eax
+    145f:	ff 33                	push   (%ebx)
+    1461:	e8 e0 f9 ff ff       	call   e46 <write>
+    1466:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    1469:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+    1470:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+    1472:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+    1479:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+    147c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    147f:	5b                   	pop    %ebx
+    1480:	5e                   	pop    %esi
+    1481:	5d                   	pop    %ebp
+    1482:	c3                   	ret
+    1483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1487:	90                   	nop
+    return -1;
+    1488:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    148d:	eb ed                	jmp    147c <setvbuf+0x3c>
+    148f:	90                   	nop
+
+00001490 <fflush>:
+{
+    1490:	55                   	push   %ebp
+    1491:	31 c0                	xor    %eax,%eax
+    1493:	89 e5                	mov    %esp,%ebp
+    1495:	53                   	push   %ebx
+    1496:	83 ec 04             	sub    $0x4,%esp
+    1499:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    149c:	8b 53 08             	mov    0x8(%ebx),%edx
+    149f:	85 d2                	test   %edx,%edx
+    14a1:	7e 1d                	jle    14c0 <fflush+0x30>
+    14a3:	83 ec 04             	sub    $0x4,%esp
+    14a6:	8d 43 10             	lea    0x10(%ebx),%eax
+    14a9:	52                   	push   %edx
+    14aa:	50                   	push   %eax
+    14ab:	ff 33                	push   (%ebx)
+    14ad:	e8 94 f9 ff ff       	call   e46 <write>
+    14b2:	83 c4 10             	add    $0x10,%esp
+    14b5:	39 43 08             	cmp    %eax,0x8(%ebx)
+    14b8:	0f 95 c0             	setne  %al
+    14bb:	0f b6 c0             	movzbl %al,%eax
+    14be:	f7 d8                	neg    %eax
+  f->n = 0;
+    14c0:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    14c7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    14ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14d1:	c9                   	leave
+    14d2:	c3                   	ret
+    14d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000014e0 <fclose>:
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	56                   	push   %esi
+    14e4:	31 f6                	xor    %esi,%esi
+    14e6:	53                   	push   %ebx
+    14e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    14ea:	8b 43 08             	mov    0x8(%ebx),%eax
+    14ed:	85 c0                	test   %eax,%eax
+    14ef:	7e 1f                	jle    1510 <fclose+0x30>
+    14f1:	83 ec 04             	sub    $0x4,%esp
+    14f4:	50                   	push   %eax
+    14f5:	8d 43 10             	lea    0x10(%ebx),%eax
+    14f8:	50                   	push   %eax
+    14f9:	ff 33                	push   (%ebx)
+    14fb:	e8 46 f9 ff ff       	call   e46 <write>
+    1500:	83 c4 10             	add    $0x10,%esp
+    1503:	39 43 08             	cmp    %eax,0x8(%ebx)
+    1506:	0f 95 c0             	setne  %al
+    1509:	0f b6 c0             	movzbl %al,%eax
+    150c:	f7 d8                	neg    %eax
+    150e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    1510:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+    1513:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    151a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+    1521:	ff 33                	push   (%ebx)
+    1523:	e8 26 f9 ff ff       	call   e4e <close>
+    1528:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    152b:	85 c0                	test   %eax,%eax
+    152d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1532:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+    1535:	8b 03                	mov    (%ebx),%eax
+    1537:	83 f8 0f             	cmp    $0xf,%eax
+    153a:	77 09                	ja     1545 <fclose+0x65>
+    153c:	39 1c 85 c0 23 00 00 	cmp    %ebx,0x23c0(,%eax,4)
+    1543:	74 0b                	je     1550 <fclose+0x70>
+}
+    1545:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1548:	89 f0                	mov    %esi,%eax
+    154a:	5b                   	pop    %ebx
+    154b:	5e                   	pop    %esi
+    154c:	5d                   	pop    %ebp
+    154d:	c3                   	ret
+    154e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+    1550:	c7 04 85 c0 23 00 00 	movl   $0x0,0x23c0(,%eax,4)
+    1557:	00 00 00 00 
+    free(f);
+    155b:	83 ec 0c             	sub    $0xc,%esp
+    155e:	53                   	push   %ebx
+    155f:	e8 4c 03 00 00       	call   18b0 <free>
+    1564:	83 c4 10             	add    $0x10,%esp
+  return r;
+    1567:	eb dc                	jmp    1545 <fclose+0x65>
+    1569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001570 <fputc>:
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	53                   	push   %ebx
+    1574:	83 ec 04             	sub    $0x4,%esp
+    1577:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    157a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+    157d:	8b 43 08             	mov    0x8(%ebx),%eax
+    1580:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1585:	74 59                	je     15e0 <fputc+0x70>
+  f->buf[f->n++] = c;
+    1587:	8d 48 01             	lea    0x1(%eax),%ecx
+    158a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+    158d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+    1591:	80 fa 0a             	cmp    $0xa,%dl
+    1594:	75 07                	jne    159d <fputc+0x2d>
+    f->nl = 1;
+    1596:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    159d:	8b 43 04             	mov    0x4(%ebx),%eax
+    15a0:	83 f8 02             	cmp    $0x2,%eax
+    15a3:	74 1a                	je     15bf <fputc+0x4f>
+    15a5:	83 f8 01             	cmp    $0x1,%eax
+    15a8:	74 0e                	je     15b8 <fputc+0x48>
+}
+    15aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+    15ad:	0f b6 c2             	movzbl %dl,%eax
+}
+    15b0:	c9                   	leave
+    15b1:	c3                   	ret
+    15b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    15b8:	8b 43 0c             	mov    0xc(%ebx),%eax
+    15bb:	85 c0                	test   %eax,%eax
+    15bd:	74 eb                	je     15aa <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    15bf:	85 c9                	test   %ecx,%ecx
+    15c1:	7f 4d                	jg     1610 <fputc+0xa0>
+  f->n = 0;
+    15c3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    15ca:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    15d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+    15d4:	0f b6 c2             	movzbl %dl,%eax
+}
+    15d7:	c9                   	leave
+    15d8:	c3                   	ret
+    15d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    15e0:	83 ec 04             	sub    $0x4,%esp
+    15e3:	8d 43 10             	lea    0x10(%ebx),%eax
+    15e6:	89 55 08             	mov    %edx,0x8(%ebp)
+    15e9:	68 00 02 00 00       	push   $0x200
+    15ee:	50                   	push   %eax
+    15ef:	ff 33                	push   (%ebx)
+    15f1:	e8 50 f8 ff ff       	call   e46 <write>
+  return r;
+    15f6:	8b 55 08             	mov    0x8(%ebp),%edx
+    15f9:	83 c4 10             	add    $0x10,%esp
+    15fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+    1601:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    1608:	31 c0                	xor    %eax,%eax
+    160a:	e9 7b ff ff ff       	jmp    158a <fputc+0x1a>
+    160f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1610:	83 ec 04             	sub    $0x4,%esp
+    1613:	8d 43 10             	lea    0x10(%ebx),%eax
+    1616:	89 55 08             	mov    %edx,0x8(%ebp)
+    1619:	51                   	push   %ecx
+    161a:	50                   	push   %eax
+    161b:	ff 33                	push   (%ebx)
+    161d:	e8 24 f8 ff ff       	call   e46 <write>
+  f->n = 0;
+    1622:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    1629:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    1636:	eb 99                	jmp    15d1 <fputc+0x61>
+    1638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+
+00001640 <fwrite>:
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	57                   	push   %edi
+    1644:	56                   	push   %esi
+    1645:	53                   	push   %ebx
+    1646:	83 ec 1c             	sub    $0x1c,%esp
+    1649:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+    164c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+    164f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+    1652:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    1655:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+    165b:	0f 8f af 00 00 00    	jg     1710 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+    1661:	85 ff                	test   %edi,%edi
+    1663:	7e 73                	jle    16d8 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1665:	8d 56 10             	lea    0x10(%esi),%edx
+    1668:	8b 46 08             	mov    0x8(%esi),%eax
+    166b:	31 db                	xor    %ebx,%ebx
+    166d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    1670:	eb 25                	jmp    1697 <fwrite+0x57>
+    1672:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+    1678:	89 c1                	mov    %eax,%ecx
+    167a:	83 c0 01             	add    $0x1,%eax
+    167d:	89 46 08             	mov    %eax,0x8(%esi)
+    1680:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    1684:	80 fa 0a             	cmp    $0xa,%dl
+    1687:	75 07                	jne    1690 <fwrite+0x50>
+    f->nl = 1;
+    1689:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+    1690:	83 c3 01             	add    $0x1,%ebx
+    1693:	39 df                	cmp    %ebx,%edi
+    1695:	7e 41                	jle    16d8 <fwrite+0x98>
+    bputc(f, s[i]);
+    1697:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    169a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+    169e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16a3:	75 d3                	jne    1678 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    16a5:	83 ec 04             	sub    $0x4,%esp
+    16a8:	88 55 e7             	mov    %dl,-0x19(%ebp)
+    16ab:	68 00 02 00 00       	push   $0x200
+    16b0:	ff 75 e0             	push   -0x20(%ebp)
+    16b3:	ff 36                	push   (%esi)
+    16b5:	e8 8c f7 ff ff       	call   e46 <write>
+  return r;
+    16ba:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+    16be:	83 c4 10             	add    $0x10,%esp
+    16c1:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    16c3:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    16ca:	b8 01 00 00 00       	mov    $0x1,%eax
+    16cf:	eb ac                	jmp    167d <fwrite+0x3d>
+    16d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    16d8:	8b 46 04             	mov    0x4(%esi),%eax
+    16db:	83 f8 02             	cmp    $0x2,%eax
+    16de:	74 0c                	je     16ec <fwrite+0xac>
+    16e0:	83 f8 01             	cmp    $0x1,%eax
+    16e3:	75 1c                	jne    1701 <fwrite+0xc1>
+    16e5:	8b 46 0c             	mov    0xc(%esi),%eax
+    16e8:	85 c0                	test   %eax,%eax
+    16ea:	74 15                	je     1701 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    16ec:	8b 46 08             	mov    0x8(%esi),%eax
+    16ef:	85 c0                	test   %eax,%eax
+    16f1:	7f 5d                	jg     1750 <fwrite+0x110>
+  f->n = 0;
+    16f3:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    16fa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+    1701:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+    1704:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1707:	5b                   	pop    %ebx
+    1708:	5e                   	pop    %esi
+    1709:	5f                   	pop    %edi
+    170a:	5d                   	pop    %ebp
+    170b:	c3                   	ret
+    170c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    1710:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+    1714:	0f 84 4b ff ff ff    	je     1665 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    171a:	8b 46 08             	mov    0x8(%esi),%eax
+    171d:	8b 16                	mov    (%esi),%edx
+    171f:	85 c0                	test   %eax,%eax
+    1721:	7f 45                	jg     1768 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+    1723:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+    1726:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    172d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+    1734:	57                   	push   %edi
+    1735:	ff 75 08             	push   0x8(%ebp)
+    1738:	ff 36                	push   (%esi)
+    173a:	e8 07 f7 ff ff       	call   e46 <write>
+    return size > 0 ? i / size : 0;
+    173f:	83 c4 10             	add    $0x10,%esp
+    1742:	85 c0                	test   %eax,%eax
+    1744:	78 4a                	js     1790 <fwrite+0x150>
+    1746:	85 db                	test   %ebx,%ebx
+    1748:	7e 46                	jle    1790 <fwrite+0x150>
+    174a:	99                   	cltd
+    174b:	f7 fb                	idiv   %ebx
+    174d:	eb b5                	jmp    1704 <fwrite+0xc4>
+    174f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    1750:	83 ec 04             	sub    $0x4,%esp
+    1753:	50                   	push   %eax
+    1754:	8d 46 10             	lea    0x10(%esi),%eax
+    1757:	50                   	push   %eax
+    1758:	ff 36                	push   (%esi)
+    175a:	e8 e7 f6 ff ff       	call   e46 <write>
+    175f:	83 c4 10             	add    $0x10,%esp
+    1762:	eb 8f                	jmp    16f3 <fwrite+0xb3>
+    1764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1768:	83 ec 04             	sub    $0x4,%esp
+    176b:	50                   	push   %eax
+    176c:	8d 46 10             	lea    0x10(%esi),%eax
+    176f:	50                   	push   %eax
+    1770:	52                   	push   %edx
+    1771:	e8 d0 f6 ff ff       	call   e46 <write>
+    1776:	83 c4 10             	add    $0x10,%esp
+    1779:	3b 46 08             	cmp    0x8(%esi),%eax
+    177c:	74 a5                	je     1723 <fwrite+0xe3>
+  f->n = 0;
+    177e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    1785:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    178c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+    1790:	31 c0                	xor    %eax,%eax
+    1792:	e9 6d ff ff ff       	jmp    1704 <fwrite+0xc4>
+    1797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179e:	66 90                	xchg   %ax,%ax
+
+000017a0 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    17a0:	55                   	push   %ebp
+    17a1:	89 e5                	mov    %esp,%ebp
+    17a3:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    17a4:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    17a7:	83 ec 04             	sub    $0x4,%esp
+    17aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    17ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+    17b0:	89 d8                	mov    %ebx,%eax
+    17b2:	e8 39 f9 ff ff       	call   10f0 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    17b7:	8b 43 04             	mov    0x4(%ebx),%eax
+    17ba:	83 f8 02             	cmp    $0x2,%eax
+    17bd:	74 18                	je     17d7 <fprintf+0x37>
+    17bf:	83 f8 01             	cmp    $0x1,%eax
+    17c2:	74 0c                	je     17d0 <fprintf+0x30>
+  settle(f);
+}
+    17c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17c7:	c9                   	leave
+    17c8:	c3                   	ret
+    17c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    17d0:	8b 43 0c             	mov    0xc(%ebx),%eax
+    17d3:	85 c0                	test   %eax,%eax
+    17d5:	74 ed                	je     17c4 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    17d7:	8b 43 08             	mov    0x8(%ebx),%eax
+    17da:	85 c0                	test   %eax,%eax
+    17dc:	7f 1a                	jg     17f8 <fprintf+0x58>
+  f->n = 0;
+    17de:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    17e5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    17ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17ef:	c9                   	leave
+    17f0:	c3                   	ret
+    17f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    17f8:	83 ec 04             	sub    $0x4,%esp
+    17fb:	50                   	push   %eax
+    17fc:	8d 43 10             	lea    0x10(%ebx),%eax
+    17ff:	50                   	push   %eax
+    1800:	ff 33                	push   (%ebx)
+    1802:	e8 3f f6 ff ff       	call   e46 <write>
+  f->n = 0;
+    1807:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    180e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+    1811:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    1818:	eb d2                	jmp    17ec <fprintf+0x4c>
+    181a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001820 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1820:	55                   	push   %ebp
+    1821:	89 e5                	mov    %esp,%ebp
+    1823:	53                   	push   %ebx
+    1824:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    182a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+    182d:	83 f8 0f             	cmp    $0xf,%eax
+    1830:	77 4e                	ja     1880 <printf+0x60>
+    1832:	8b 1c 85 c0 23 00 00 	mov    0x23c0(,%eax,4),%ebx
+    1839:	85 db                	test   %ebx,%ebx
+    183b:	74 43                	je     1880 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    183d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1840:	89 d8                	mov    %ebx,%eax
+    1842:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1845:	e8 a6 f8 ff ff       	call   10f0 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    184a:	8b 43 08             	mov    0x8(%ebx),%eax
+    184d:	85 c0                	test   %eax,%eax
+    184f:	7e 12                	jle    1863 <printf+0x43>
+    1851:	83 ec 04             	sub    $0x4,%esp
+    1854:	50                   	push   %eax
+    1855:	8d 43 10             	lea    0x10(%ebx),%eax
+    1858:	50                   	push   %eax
+    1859:	ff 33                	push   (%ebx)
+    185b:	e8 e6 f5 ff ff       	call   e46 <write>
+    1860:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    1863:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    186a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+    1871:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1874:	c9                   	leave
+    1875:	c3                   	ret
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+    1880:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+    1886:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+    188c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+    1893:	00 00 00 
+    f->n = 0;
+    1896:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    189d:	00 00 00 
+    f->nl = 0;
+    18a0:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+    18a7:	00 00 00 
+    18aa:	eb 91                	jmp    183d <printf+0x1d>
+    18ac:	66 90                	xchg   %ax,%ax
+    18ae:	66 90                	xchg   %ax,%ax
+
+000018b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    18b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    18b1:	a1 00 24 00 00       	mov    0x2400,%eax
+{
+    18b6:	89 e5                	mov    %esp,%ebp
+    18b8:	57                   	push   %edi
+    18b9:	56                   	push   %esi
+    18ba:	53                   	push   %ebx
+    18bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    18be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    18c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    18ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    18cc:	39 ca                	cmp    %ecx,%edx
+    18ce:	73 30                	jae    1900 <free+0x50>
+    18d0:	39 c1                	cmp    %eax,%ecx
+    18d2:	72 04                	jb     18d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    18d4:	39 c2                	cmp    %eax,%edx
+    18d6:	72 f0                	jb     18c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    18d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    18db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    18de:	39 f8                	cmp    %edi,%eax
+    18e0:	74 2e                	je     1910 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    18e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    18e5:	8b 42 04             	mov    0x4(%edx),%eax
+    18e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    18eb:	39 f1                	cmp    %esi,%ecx
+    18ed:	74 38                	je     1927 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    18ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    18f1:	5b                   	pop    %ebx
+  freep = p;
+    18f2:	89 15 00 24 00 00    	mov    %edx,0x2400
+}
+    18f8:	5e                   	pop    %esi
+    18f9:	5f                   	pop    %edi
+    18fa:	5d                   	pop    %ebp
+    18fb:	c3                   	ret
+    18fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1900:	39 c1                	cmp    %eax,%ecx
+    1902:	72 d0                	jb     18d4 <free+0x24>
+    1904:	eb c2                	jmp    18c8 <free+0x18>
+    1906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1910:	03 70 04             	add    0x4(%eax),%esi
+    1913:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1916:	8b 02                	mov    (%edx),%eax
+    1918:	8b 00                	mov    (%eax),%eax
+    191a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    191d:	8b 42 04             	mov    0x4(%edx),%eax
+    1920:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1923:	39 f1                	cmp    %esi,%ecx
+    1925:	75 c8                	jne    18ef <free+0x3f>
+    p->s.size += bp->s.size;
+    1927:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    192a:	89 15 00 24 00 00    	mov    %edx,0x2400
+    p->s.size += bp->s.size;
+    1930:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1933:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1936:	89 0a                	mov    %ecx,(%edx)
+}
+    1938:	5b                   	pop    %ebx
+    1939:	5e                   	pop    %esi
+    193a:	5f                   	pop    %edi
+    193b:	5d                   	pop    %ebp
+    193c:	c3                   	ret
+    193d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001940 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	57                   	push   %edi
+    1944:	56                   	push   %esi
+    1945:	53                   	push   %ebx
+    1946:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1949:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    194c:	8b 15 00 24 00 00    	mov    0x2400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1952:	8d 78 07             	lea    0x7(%eax),%edi
+    1955:	c1 ef 03             	shr    $0x3,%edi
+    1958:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    195b:	85 d2                	test   %edx,%edx
+    195d:	0f 84 8d 00 00 00    	je     19f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1963:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1965:	8b 48 04             	mov    0x4(%eax),%ecx
+    1968:	39 f9                	cmp    %edi,%ecx
+    196a:	73 64                	jae    19d0 <malloc+0x90>
+  if(nu < 4096)
+    196c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1971:	39 df                	cmp    %ebx,%edi
+    1973:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1976:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    197d:	eb 0a                	jmp    1989 <malloc+0x49>
+    197f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1980:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1982:	8b 48 04             	mov    0x4(%eax),%ecx
+    1985:	39 f9                	cmp    %edi,%ecx
+    1987:	73 47                	jae    19d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1989:	89 c2                	mov    %eax,%edx
+    198b:	39 05 00 24 00 00    	cmp    %eax,0x2400
+    1991:	75 ed                	jne    1980 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1993:	83 ec 0c             	sub    $0xc,%esp
+    1996:	56                   	push   %esi
+    1997:	e8 12 f5 ff ff       	call   eae <sbrk>
+  if(p == (char*)-1)
+    199c:	83 c4 10             	add    $0x10,%esp
+    199f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    19a2:	74 1c                	je     19c0 <malloc+0x80>
+  hp->s.size = nu;
+    19a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    19a7:	83 ec 0c             	sub    $0xc,%esp
+    19aa:	83 c0 08             	add    $0x8,%eax
+    19ad:	50                   	push   %eax
+    19ae:	e8 fd fe ff ff       	call   18b0 <free>
+  return freep;
+    19b3:	8b 15 00 24 00 00    	mov    0x2400,%edx
+      if((p = morecore(nunits)) == 0)
+    19b9:	83 c4 10             	add    $0x10,%esp
+    19bc:	85 d2                	test   %edx,%edx
+    19be:	75 c0                	jne    1980 <malloc+0x40>
+        return 0;
+  }
+}
+    19c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    19c3:	31 c0                	xor    %eax,%eax
+}
+    19c5:	5b                   	pop    %ebx
+    19c6:	5e                   	pop    %esi
+    19c7:	5f                   	pop    %edi
+    19c8:	5d                   	pop    %ebp
+    19c9:	c3                   	ret
+    19ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    19d0:	39 cf                	cmp    %ecx,%edi
+    19d2:	74 4c                	je     1a20 <malloc+0xe0>
+        p->s.size -= nunits;
+    19d4:	29 f9                	sub    %edi,%ecx
+    19d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    19d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    19dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    19df:	89 15 00 24 00 00    	mov    %edx,0x2400
+}
+    19e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    19e8:	83 c0 08             	add    $0x8,%eax
+}
+    19eb:	5b                   	pop    %ebx
+    19ec:	5e                   	pop    %esi
+    19ed:	5f                   	pop    %edi
+    19ee:	5d                   	pop    %ebp
+    19ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    19f0:	c7 05 00 24 00 00 04 	movl   $0x2404,0x2400
+    19f7:	24 00 00 
+    base.s.size = 0;
+    19fa:	b8 04 24 00 00       	mov    $0x2404,%eax
+    base.s.ptr = freep = prevp = &base;
+    19ff:	c7 05 04 24 00 00 04 	movl   $0x2404,0x2404
+    1a06:	24 00 00 
+    base.s.size = 0;
+    1a09:	c7 05 08 24 00 00 00 	movl   $0x0,0x2408
+    1a10:	00 00 00 
+    if(p->s.size >= nunits){
+    1a13:	e9 54 ff ff ff       	jmp    196c <malloc+0x2c>
+    1a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1a20:	8b 08                	mov    (%eax),%ecx
+    1a22:	89 0a                	mov    %ecx,(%edx)
+    1a24:	eb b9                	jmp    19df <malloc+0x9f>
@@ -0,0 +1,2118 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 78 0f 00 00       	push   $0xf78
+  44:	6a 01                	push   $0x1
+  46:	e8 25 0d 00 00       	call   d70 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 13 03 00 00       	call   376 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 8b 0f 00 00       	push   $0xf8b
+  78:	6a 01                	push   $0x1
+  7a:	e8 f1 0c 00 00       	call   d70 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 19 03 00 00       	call   3b6 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 df 02 00 00       	call   396 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 d6 02 00 00       	call   39e <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 95 0f 00 00       	push   $0xf95
+  cf:	6a 01                	push   $0x1
+  d1:	e8 9a 0c 00 00       	call   d70 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 cb 02 00 00       	call   3b6 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 8f 02 00 00       	call   38e <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 8e 02 00 00       	call   39e <close>
+
+  wait();
+ 110:	e8 69 02 00 00       	call   37e <wait>
+
+  exit();
+ 115:	e8 46 02 00 00       	call   360 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 31 01 00 00       	call   38e <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 04 01 00 00       	call   3b6 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 07 01 00 00       	call   3ce <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 cd 00 00 00       	call   39e <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 366:	a1 c0 14 00 00       	mov    0x14c0,%eax
+ 36b:	85 c0                	test   %eax,%eax
+ 36d:	74 02                	je     371 <exit+0x11>
+    exithook();
+ 36f:	ff d0                	call   *%eax
+  _exit();
+ 371:	e8 10 01 00 00       	call   486 <_exit>
+
+00000376 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 376:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <wait>:
+SYSCALL(wait)
+ 37e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <pipe>:
+SYSCALL(pipe)
+ 386:	b8 04 00 00 00       	mov    $0x4,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <read>:
+SYSCALL(read)
+ 38e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <write>:
+SYSCALL(write)
+ 396:	b8 10 00 00 00       	mov    $0x10,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <close>:
+SYSCALL(close)
+ 39e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <kill>:
+SYSCALL(kill)
+ 3a6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <exec>:
+SYSCALL(exec)
+ 3ae:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <open>:
+SYSCALL(open)
+ 3b6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <mknod>:
+SYSCALL(mknod)
+ 3be:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <unlink>:
+SYSCALL(unlink)
+ 3c6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <fstat>:
+SYSCALL(fstat)
+ 3ce:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <link>:
+SYSCALL(link)
+ 3d6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <mkdir>:
+SYSCALL(mkdir)
+ 3de:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <chdir>:
+SYSCALL(chdir)
+ 3e6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <dup>:
+SYSCALL(dup)
+ 3ee:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <getpid>:
+SYSCALL(getpid)
+ 3f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <sbrk>:
+SYSCALL(sbrk)
+ 3fe:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <sleep>:
+SYSCALL(sleep)
+ 406:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <uptime>:
+SYSCALL(uptime)
+ 40e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 416:	b8 16 00 00 00       	mov    $0x16,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <sigaction>:
+SYSCALL(sigaction)
+ 41e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <sigret>:
+SYSCALL(sigret)
+ 426:	b8 18 00 00 00       	mov    $0x18,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <readv>:
+SYSCALL(readv)
+ 42e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <writev>:
+SYSCALL(writev)
+ 436:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <nanosleep>:
+SYSCALL(nanosleep)
+ 43e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <setpriority>:
+SYSCALL(setpriority)
+ 446:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <sched_setattr>:
+SYSCALL(sched_setattr)
+ 44e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <sched_yield>:
+SYSCALL(sched_yield)
+ 456:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 45e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 466:	b8 20 00 00 00       	mov    $0x20,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <getrusage>:
+SYSCALL(getrusage)
+ 46e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <syslat>:
+SYSCALL(syslat)
+ 476:	b8 22 00 00 00       	mov    $0x22,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <sched_getattr>:
+SYSCALL(sched_getattr)
+ 47e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 486:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 48b:	cd 40                	int    $0x40
+  ret
+ 48d:	c3                   	ret
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 495:	31 db                	xor    %ebx,%ebx
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 4a0:	8b 34 9d e0 14 00 00 	mov    0x14e0(,%ebx,4),%esi
+ 4a7:	85 f6                	test   %esi,%esi
+ 4a9:	74 27                	je     4d2 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4ab:	8b 46 08             	mov    0x8(%esi),%eax
+ 4ae:	85 c0                	test   %eax,%eax
+ 4b0:	7e 12                	jle    4c4 <flushall+0x34>
+ 4b2:	83 ec 04             	sub    $0x4,%esp
+ 4b5:	50                   	push   %eax
+ 4b6:	8d 46 10             	lea    0x10(%esi),%eax
+ 4b9:	50                   	push   %eax
+ 4ba:	ff 36                	push   (%esi)
+ 4bc:	e8 d5 fe ff ff       	call   396 <write>
+ 4c1:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 4c4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 4cb:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 4d2:	83 c3 01             	add    $0x1,%ebx
+ 4d5:	83 fb 10             	cmp    $0x10,%ebx
+ 4d8:	75 c6                	jne    4a0 <flushall+0x10>
+}
+ 4da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4dd:	5b                   	pop    %ebx
+ 4de:	5e                   	pop    %esi
+ 4df:	5d                   	pop    %ebp
+ 4e0:	c3                   	ret
+ 4e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4f8:	89 d1                	mov    %edx,%ecx
+{
+ 4fa:	83 ec 2c             	sub    $0x2c,%esp
+ 4fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 500:	85 d2                	test   %edx,%edx
+ 502:	0f 89 c8 00 00 00    	jns    5d0 <printint+0xe0>
+ 508:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 50c:	0f 84 be 00 00 00    	je     5d0 <printint+0xe0>
+    x = -xx;
+ 512:	f7 d9                	neg    %ecx
+    neg = 1;
+ 514:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 519:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 51c:	31 f6                	xor    %esi,%esi
+ 51e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 520:	89 c8                	mov    %ecx,%eax
+ 522:	31 d2                	xor    %edx,%edx
+ 524:	89 f7                	mov    %esi,%edi
+ 526:	f7 f3                	div    %ebx
+ 528:	8d 76 01             	lea    0x1(%esi),%esi
+ 52b:	0f b6 92 fc 0f 00 00 	movzbl 0xffc(%edx),%edx
+ 532:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 536:	89 ca                	mov    %ecx,%edx
+ 538:	89 c1                	mov    %eax,%ecx
+ 53a:	39 da                	cmp    %ebx,%edx
+ 53c:	73 e2                	jae    520 <printint+0x30>
+  if(neg)
+ 53e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 541:	85 c0                	test   %eax,%eax
+ 543:	74 07                	je     54c <printint+0x5c>
+    buf[i++] = '-';
+ 545:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 54a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 54c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 54f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 552:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 554:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 557:	8b 41 08             	mov    0x8(%ecx),%eax
+ 55a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 55d:	89 ce                	mov    %ecx,%esi
+ 55f:	eb 28                	jmp    589 <printint+0x99>
+ 561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 568:	89 c1                	mov    %eax,%ecx
+ 56a:	83 c0 01             	add    $0x1,%eax
+ 56d:	89 46 08             	mov    %eax,0x8(%esi)
+ 570:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 574:	80 fa 0a             	cmp    $0xa,%dl
+ 577:	75 07                	jne    580 <printint+0x90>
+    f->nl = 1;
+ 579:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 580:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 583:	39 fb                	cmp    %edi,%ebx
+ 585:	74 39                	je     5c0 <printint+0xd0>
+ 587:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 589:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 58c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 591:	75 d5                	jne    568 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 593:	83 ec 04             	sub    $0x4,%esp
+ 596:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 599:	68 00 02 00 00       	push   $0x200
+ 59e:	ff 75 d0             	push   -0x30(%ebp)
+ 5a1:	ff 36                	push   (%esi)
+ 5a3:	e8 ee fd ff ff       	call   396 <write>
+  return r;
+ 5a8:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 5ac:	83 c4 10             	add    $0x10,%esp
+ 5af:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 5b1:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 5b8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5bd:	eb ae                	jmp    56d <printint+0x7d>
+ 5bf:	90                   	nop
+}
+ 5c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c3:	5b                   	pop    %ebx
+ 5c4:	5e                   	pop    %esi
+ 5c5:	5f                   	pop    %edi
+ 5c6:	5d                   	pop    %ebp
+ 5c7:	c3                   	ret
+ 5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+  neg = 0;
+ 5d0:	31 c0                	xor    %eax,%eax
+ 5d2:	e9 42 ff ff ff       	jmp    519 <printint+0x29>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <bputc>:
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	53                   	push   %ebx
+ 5e4:	89 c3                	mov    %eax,%ebx
+ 5e6:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 5e9:	8b 40 08             	mov    0x8(%eax),%eax
+ 5ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5f1:	74 1d                	je     610 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 5f3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5f6:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 5f9:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 5fd:	80 fa 0a             	cmp    $0xa,%dl
+ 600:	75 07                	jne    609 <bputc+0x29>
+    f->nl = 1;
+ 602:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 609:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 60c:	c9                   	leave
+ 60d:	c3                   	ret
+ 60e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	8d 43 10             	lea    0x10(%ebx),%eax
+ 616:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 619:	68 00 02 00 00       	push   $0x200
+ 61e:	50                   	push   %eax
+ 61f:	ff 33                	push   (%ebx)
+ 621:	e8 70 fd ff ff       	call   396 <write>
+  return r;
+ 626:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 629:	83 c4 10             	add    $0x10,%esp
+ 62c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 631:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 638:	31 c0                	xor    %eax,%eax
+ 63a:	eb ba                	jmp    5f6 <bputc+0x16>
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	83 ec 1c             	sub    $0x1c,%esp
+ 649:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 64c:	0f b6 0a             	movzbl (%edx),%ecx
+ 64f:	84 c9                	test   %cl,%cl
+ 651:	74 47                	je     69a <vfprintf+0x5a>
+ 653:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 656:	89 c7                	mov    %eax,%edi
+ 658:	31 d2                	xor    %edx,%edx
+ 65a:	89 de                	mov    %ebx,%esi
+ 65c:	89 cb                	mov    %ecx,%ebx
+ 65e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 660:	0f be cb             	movsbl %bl,%ecx
+ 663:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 666:	85 d2                	test   %edx,%edx
+ 668:	75 4e                	jne    6b8 <vfprintf+0x78>
+      if(c == '%'){
+ 66a:	83 f8 25             	cmp    $0x25,%eax
+ 66d:	74 69                	je     6d8 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 66f:	8b 47 08             	mov    0x8(%edi),%eax
+ 672:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 677:	0f 84 73 01 00 00    	je     7f0 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 67d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 680:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 683:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 687:	80 fb 0a             	cmp    $0xa,%bl
+ 68a:	74 1c                	je     6a8 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 68c:	31 d2                	xor    %edx,%edx
+ 68e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 690:	0f b6 1e             	movzbl (%esi),%ebx
+ 693:	83 c6 01             	add    $0x1,%esi
+ 696:	84 db                	test   %bl,%bl
+ 698:	75 c6                	jne    660 <vfprintf+0x20>
+    }
+  }
+}
+ 69a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69d:	5b                   	pop    %ebx
+ 69e:	5e                   	pop    %esi
+ 69f:	5f                   	pop    %edi
+ 6a0:	5d                   	pop    %ebp
+ 6a1:	c3                   	ret
+ 6a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 6a8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 6af:	eb df                	jmp    690 <vfprintf+0x50>
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 6b8:	83 fa 25             	cmp    $0x25,%edx
+ 6bb:	75 d3                	jne    690 <vfprintf+0x50>
+      if(c == 'd'){
+ 6bd:	83 f8 25             	cmp    $0x25,%eax
+ 6c0:	74 37                	je     6f9 <vfprintf+0xb9>
+ 6c2:	83 e8 63             	sub    $0x63,%eax
+ 6c5:	83 f8 15             	cmp    $0x15,%eax
+ 6c8:	77 16                	ja     6e0 <vfprintf+0xa0>
+ 6ca:	ff 24 85 a4 0f 00 00 	jmp    *0xfa4(,%eax,4)
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 6d8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6dd:	eb b1                	jmp    690 <vfprintf+0x50>
+ 6df:	90                   	nop
+  if(f->n == BUFSIZ)
+ 6e0:	8b 47 08             	mov    0x8(%edi),%eax
+ 6e3:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6e8:	0f 84 4c 01 00 00    	je     83a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 6ee:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f1:	89 57 08             	mov    %edx,0x8(%edi)
+ 6f4:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 6f9:	89 ca                	mov    %ecx,%edx
+ 6fb:	89 f8                	mov    %edi,%eax
+ 6fd:	e8 de fe ff ff       	call   5e0 <bputc>
+ 702:	eb 88                	jmp    68c <vfprintf+0x4c>
+ 704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 708:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 70b:	83 ec 0c             	sub    $0xc,%esp
+ 70e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 713:	8b 13                	mov    (%ebx),%edx
+ 715:	6a 00                	push   $0x0
+ 717:	89 f8                	mov    %edi,%eax
+        ap++;
+ 719:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 71c:	e8 cf fd ff ff       	call   4f0 <printint>
+        ap++;
+ 721:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 724:	83 c4 10             	add    $0x10,%esp
+ 727:	e9 60 ff ff ff       	jmp    68c <vfprintf+0x4c>
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 730:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 733:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 735:	83 c0 04             	add    $0x4,%eax
+ 738:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 73b:	85 d2                	test   %edx,%edx
+ 73d:	0f 84 dd 00 00 00    	je     820 <vfprintf+0x1e0>
+        while(*s != 0){
+ 743:	0f b6 1a             	movzbl (%edx),%ebx
+ 746:	84 db                	test   %bl,%bl
+ 748:	0f 84 3e ff ff ff    	je     68c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 74e:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 751:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 754:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 757:	89 fe                	mov    %edi,%esi
+ 759:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 75c:	89 d7                	mov    %edx,%edi
+ 75e:	eb 27                	jmp    787 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 760:	89 c1                	mov    %eax,%ecx
+ 762:	83 c0 01             	add    $0x1,%eax
+ 765:	89 46 08             	mov    %eax,0x8(%esi)
+ 768:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 76c:	80 fb 0a             	cmp    $0xa,%bl
+ 76f:	75 07                	jne    778 <vfprintf+0x138>
+    f->nl = 1;
+ 771:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 778:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 77c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 77f:	84 db                	test   %bl,%bl
+ 781:	0f 84 a9 00 00 00    	je     830 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 787:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 78c:	75 d2                	jne    760 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 78e:	83 ec 04             	sub    $0x4,%esp
+ 791:	68 00 02 00 00       	push   $0x200
+ 796:	ff 75 e0             	push   -0x20(%ebp)
+ 799:	ff 36                	push   (%esi)
+ 79b:	e8 f6 fb ff ff       	call   396 <write>
+  return r;
+ 7a0:	83 c4 10             	add    $0x10,%esp
+ 7a3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7a8:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 7aa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 7b1:	eb b2                	jmp    765 <vfprintf+0x125>
+ 7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7b7:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 7b8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 7bb:	83 ec 0c             	sub    $0xc,%esp
+ 7be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7c3:	8b 13                	mov    (%ebx),%edx
+ 7c5:	6a 01                	push   $0x1
+ 7c7:	e9 4b ff ff ff       	jmp    717 <vfprintf+0xd7>
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 7d0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 7d3:	89 f8                	mov    %edi,%eax
+ 7d5:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 7d8:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 7db:	e8 00 fe ff ff       	call   5e0 <bputc>
+        ap++;
+ 7e0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 7e3:	31 d2                	xor    %edx,%edx
+ 7e5:	e9 a6 fe ff ff       	jmp    690 <vfprintf+0x50>
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	8d 47 10             	lea    0x10(%edi),%eax
+ 7f6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 7f9:	68 00 02 00 00       	push   $0x200
+ 7fe:	50                   	push   %eax
+ 7ff:	ff 37                	push   (%edi)
+ 801:	e8 90 fb ff ff       	call   396 <write>
+  return r;
+ 806:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 809:	83 c4 10             	add    $0x10,%esp
+ 80c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 80e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 815:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 81a:	e9 61 fe ff ff       	jmp    680 <vfprintf+0x40>
+ 81f:	90                   	nop
+          s = "(null)";
+ 820:	ba 9b 0f 00 00       	mov    $0xf9b,%edx
+ 825:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 82a:	e9 1f ff ff ff       	jmp    74e <vfprintf+0x10e>
+ 82f:	90                   	nop
+ 830:	89 f7                	mov    %esi,%edi
+ 832:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 835:	e9 52 fe ff ff       	jmp    68c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 83a:	83 ec 04             	sub    $0x4,%esp
+ 83d:	8d 47 10             	lea    0x10(%edi),%eax
+ 840:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 843:	68 00 02 00 00       	push   $0x200
+ 848:	50                   	push   %eax
+ 849:	ff 37                	push   (%edi)
+ 84b:	e8 46 fb ff ff       	call   396 <write>
+  return r;
+ 850:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 853:	83 c4 10             	add    $0x10,%esp
+ 856:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 85b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 862:	31 c0                	xor    %eax,%eax
+ 864:	e9 88 fe ff ff       	jmp    6f1 <vfprintf+0xb1>
+ 869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <fdopen>:
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	56                   	push   %esi
+ 874:	53                   	push   %ebx
+ 875:	83 ec 20             	sub    $0x20,%esp
+ 878:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 87b:	83 fe 0f             	cmp    $0xf,%esi
+ 87e:	0f 87 84 00 00 00    	ja     908 <fdopen+0x98>
+  if(streams[fd])
+ 884:	8b 1c b5 e0 14 00 00 	mov    0x14e0(,%esi,4),%ebx
+ 88b:	85 db                	test   %ebx,%ebx
+ 88d:	74 11                	je     8a0 <fdopen+0x30>
+}
+ 88f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 892:	89 d8                	mov    %ebx,%eax
+ 894:	5b                   	pop    %ebx
+ 895:	5e                   	pop    %esi
+ 896:	5d                   	pop    %ebp
+ 897:	c3                   	ret
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 8a0:	83 ec 0c             	sub    $0xc,%esp
+ 8a3:	68 10 02 00 00       	push   $0x210
+ 8a8:	e8 e3 05 00 00       	call   e90 <malloc>
+ 8ad:	83 c4 10             	add    $0x10,%esp
+ 8b0:	89 c3                	mov    %eax,%ebx
+ 8b2:	85 c0                	test   %eax,%eax
+ 8b4:	74 52                	je     908 <fdopen+0x98>
+  f->fd = fd;
+ 8b6:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 8b8:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 8bb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 8c2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 8c9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 8d0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 8d3:	50                   	push   %eax
+ 8d4:	56                   	push   %esi
+ 8d5:	e8 f4 fa ff ff       	call   3ce <fstat>
+ 8da:	83 c4 10             	add    $0x10,%esp
+ 8dd:	85 c0                	test   %eax,%eax
+ 8df:	75 07                	jne    8e8 <fdopen+0x78>
+ 8e1:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 8e6:	74 30                	je     918 <fdopen+0xa8>
+  streams[fd] = f;
+ 8e8:	89 1c b5 e0 14 00 00 	mov    %ebx,0x14e0(,%esi,4)
+}
+ 8ef:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 8f1:	c7 05 c0 14 00 00 90 	movl   $0x490,0x14c0
+ 8f8:	04 00 00 
+}
+ 8fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8fe:	5b                   	pop    %ebx
+ 8ff:	5e                   	pop    %esi
+ 900:	5d                   	pop    %ebp
+ 901:	c3                   	ret
+ 902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 908:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 90b:	31 db                	xor    %ebx,%ebx
+}
+ 90d:	89 d8                	mov    %ebx,%eax
+ 90f:	5b                   	pop    %ebx
+ 910:	5e                   	pop    %esi
+ 911:	5d                   	pop    %ebp
+ 912:	c3                   	ret
+ 913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 917:	90                   	nop
+    f->mode = _IOLBF;
+ 918:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 91f:	eb c7                	jmp    8e8 <fdopen+0x78>
+ 921:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+
+00000930 <fopen>:
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	53                   	push   %ebx
+ 934:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 937:	ff 75 0c             	push   0xc(%ebp)
+ 93a:	ff 75 08             	push   0x8(%ebp)
+ 93d:	e8 74 fa ff ff       	call   3b6 <open>
+ 942:	83 c4 10             	add    $0x10,%esp
+ 945:	85 c0                	test   %eax,%eax
+ 947:	78 37                	js     980 <fopen+0x50>
+ 949:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 94b:	8b 04 85 e0 14 00 00 	mov    0x14e0(,%eax,4),%eax
+ 952:	85 c0                	test   %eax,%eax
+ 954:	74 17                	je     96d <fopen+0x3d>
+    free(streams[fd]);
+ 956:	83 ec 0c             	sub    $0xc,%esp
+ 959:	50                   	push   %eax
+ 95a:	e8 a1 04 00 00       	call   e00 <free>
+    streams[fd] = 0;
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	c7 04 9d e0 14 00 00 	movl   $0x0,0x14e0(,%ebx,4)
+ 969:	00 00 00 00 
+  return fdopen(fd);
+ 96d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 973:	c9                   	leave
+  return fdopen(fd);
+ 974:	e9 f7 fe ff ff       	jmp    870 <fdopen>
+ 979:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 983:	31 c0                	xor    %eax,%eax
+ 985:	c9                   	leave
+ 986:	c3                   	ret
+ 987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98e:	66 90                	xchg   %ax,%ax
+
+00000990 <setvbuf>:
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	56                   	push   %esi
+ 994:	53                   	push   %ebx
+ 995:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 998:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 99b:	83 fe 02             	cmp    $0x2,%esi
+ 99e:	77 38                	ja     9d8 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 9a0:	8b 43 08             	mov    0x8(%ebx),%eax
+ 9a3:	85 c0                	test   %eax,%eax
+ 9a5:	7e 12                	jle    9b9 <setvbuf+0x29>
+ 9a7:	83 ec 04             	sub    $0x4,%esp
+ 9aa:	50                   	push   %eax
+ 9ab:	8d 43 10             	lea    0x10(%ebx),%eax
+ 9ae:	50                   	push   %eax
+ 9af:	ff 33                	push   (%ebx)
+ 9b1:	e8 e0 f9 ff ff       	call   396 <write>
+ 9b6:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 9b9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 9c0:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 9c2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 9c9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 9cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9cf:	5b                   	pop    %ebx
+ 9d0:	5e                   	pop    %esi
+ 9d1:	5d                   	pop    %ebp
+ 9d2:	c3                   	ret
+ 9d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9d7:	90                   	nop
+    return -1;
+ 9d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9dd:	eb ed                	jmp    9cc <setvbuf+0x3c>
+ 9df:	90                   	nop
+
+000009e0 <fflush>:
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	31 c0                	xor    %eax,%eax
+ 9e3:	89 e5                	mov    %esp,%ebp
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 04             	sub    $0x4,%esp
+ 9e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 9ec:	8b 53 08             	mov    0x8(%ebx),%edx
+ 9ef:	85 d2                	test   %edx,%edx
+ 9f1:	7e 1d                	jle    a10 <fflush+0x30>
+ 9f3:	83 ec 04             	sub    $0x4,%esp
+ 9f6:	8d 43 10             	lea    0x10(%ebx),%eax
+ 9f9:	52                   	push   %edx
+ 9fa:	50                   	push   %eax
+ 9fb:	ff 33                	push   (%ebx)
+ 9fd:	e8 94 f9 ff ff       	call   396 <write>
+ a02:	83 c4 10             	add    $0x10,%esp
+ a05:	39 43 08             	cmp    %eax,0x8(%ebx)
+ a08:	0f 95 c0             	setne  %al
+ a0b:	0f b6 c0             	movzbl %al,%eax
+ a0e:	f7 d8                	neg    %eax
+  f->n = 0;
+ a10:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a17:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a21:	c9                   	leave
+ a22:	c3                   	ret
+ a23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a30 <fclose>:
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	56                   	push   %esi
+ a34:	31 f6                	xor    %esi,%esi
+ a36:	53                   	push   %ebx
+ a37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a3a:	8b 43 08             	mov    0x8(%ebx),%eax
+ a3d:	85 c0                	test   %eax,%eax
+ a3f:	7e 1f                	jle    a60 <fclose+0x30>
+ a41:	83 ec 04             	sub    $0x4,%esp
+ a44:	50                   	push   %eax
+ a45:	8d 43 10             	lea    0x10(%ebx),%eax
+ a48:	50                   	push   %eax
+ a49:	ff 33                	push   (%ebx)
+ a4b:	e8 46 f9 ff ff       	call   396 <write>
+ a50:	83 c4 10             	add    $0x10,%esp
+ a53:	39 43 08             	cmp    %eax,0x8(%ebx)
+ a56:	0f 95 c0             	setne  %al
+ a59:	0f b6 c0             	movzbl %al,%eax
+ a5c:	f7 d8                	neg    %eax
+ a5e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ a60:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ a63:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a6a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ a71:	ff 33                	push   (%ebx)
+ a73:	e8 26 f9 ff ff       	call   39e <close>
+ a78:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ a7b:	85 c0                	test   %eax,%eax
+ a7d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a82:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ a85:	8b 03                	mov    (%ebx),%eax
+ a87:	83 f8 0f             	cmp    $0xf,%eax
+ a8a:	77 09                	ja     a95 <fclose+0x65>
+ a8c:	39 1c 85 e0 14 00 00 	cmp    %ebx,0x14e0(,%eax,4)
+ a93:	74 0b                	je     aa0 <fclose+0x70>
+}
+ a95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a98:	89 f0                	mov    %esi,%eax
+ a9a:	5b                   	pop    %ebx
+ a9b:	5e                   	pop    %esi
+ a9c:	5d                   	pop    %ebp
+ a9d:	c3                   	ret
+ a9e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ aa0:	c7 04 85 e0 14 00 00 	movl   $0x0,0x14e0(,%eax,4)
+ aa7:	00 00 00 00 
+    free(f);
+ aab:	83 ec 0c             	sub    $0xc,%esp
+ aae:	53                   	push   %ebx
+ aaf:	e8 4c 03 00 00       	call   e00 <free>
+ ab4:	83 c4 10             	add    $0x10,%esp
+  return r;
+ ab7:	eb dc                	jmp    a95 <fclose+0x65>
+ ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <fputc>:
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	53                   	push   %ebx
+ ac4:	83 ec 04             	sub    $0x4,%esp
+ ac7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ acd:	8b 43 08             	mov    0x8(%ebx),%eax
+ ad0:	3d 00 02 00 00       	cmp    $0x200,%eax
+ ad5:	74 59                	je     b30 <fputc+0x70>
+  f->buf[f->n++] = c;
+ ad7:	8d 48 01             	lea    0x1(%eax),%ecx
+ ada:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ add:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ ae1:	80 fa 0a             	cmp    $0xa,%dl
+ ae4:	75 07                	jne    aed <fputc+0x2d>
+    f->nl = 1;
+ ae6:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ aed:	8b 43 04             	mov    0x4(%ebx),%eax
+ af0:	83 f8 02             	cmp    $0x2,%eax
+ af3:	74 1a                	je     b0f <fputc+0x4f>
+ af5:	83 f8 01             	cmp    $0x1,%eax
+ af8:	74 0e                	je     b08 <fputc+0x48>
+}
+ afa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ afd:	0f b6 c2             	movzbl %dl,%eax
+}
+ b00:	c9                   	leave
+ b01:	c3                   	ret
+ b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b08:	8b 43 0c             	mov    0xc(%ebx),%eax
+ b0b:	85 c0                	test   %eax,%eax
+ b0d:	74 eb                	je     afa <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b0f:	85 c9                	test   %ecx,%ecx
+ b11:	7f 4d                	jg     b60 <fputc+0xa0>
+  f->n = 0;
+ b13:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ b1a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ b21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ b24:	0f b6 c2             	movzbl %dl,%eax
+}
+ b27:	c9                   	leave
+ b28:	c3                   	ret
+ b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	8d 43 10             	lea    0x10(%ebx),%eax
+ b36:	89 55 08             	mov    %edx,0x8(%ebp)
+ b39:	68 00 02 00 00       	push   $0x200
+ b3e:	50                   	push   %eax
+ b3f:	ff 33                	push   (%ebx)
+ b41:	e8 50 f8 ff ff       	call   396 <write>
+  return r;
+ b46:	8b 55 08             	mov    0x8(%ebp),%edx
+ b49:	83 c4 10             	add    $0x10,%esp
+ b4c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ b51:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ b58:	31 c0                	xor    %eax,%eax
+ b5a:	e9 7b ff ff ff       	jmp    ada <fputc+0x1a>
+ b5f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	8d 43 10             	lea    0x10(%ebx),%eax
+ b66:	89 55 08             	mov    %edx,0x8(%ebp)
+ b69:	51                   	push   %ecx
+ b6a:	50                   	push   %eax
+ b6b:	ff 33                	push   (%ebx)
+ b6d:	e8 24 f8 ff ff       	call   396 <write>
+  f->n = 0;
+ b72:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ b79:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ b7c:	83 c4 10             	add    $0x10,%esp
+ b7f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ b86:	eb 99                	jmp    b21 <fputc+0x61>
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+
+00000b90 <fwrite>:
+{
+ b90:	55                   	push   %ebp
+ b91:	89 e5                	mov    %esp,%ebp
+ b93:	57                   	push   %edi
+ b94:	56                   	push   %esi
+ b95:	53                   	push   %ebx
+ b96:	83 ec 1c             	sub    $0x1c,%esp
+ b99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ b9c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ b9f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ ba2:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ ba5:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ bab:	0f 8f af 00 00 00    	jg     c60 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ bb1:	85 ff                	test   %edi,%edi
+ bb3:	7e 73                	jle    c28 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bb5:	8d 56 10             	lea    0x10(%esi),%edx
+ bb8:	8b 46 08             	mov    0x8(%esi),%eax
+ bbb:	31 db                	xor    %ebx,%ebx
+ bbd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ bc0:	eb 25                	jmp    be7 <fwrite+0x57>
+ bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ bc8:	89 c1                	mov    %eax,%ecx
+ bca:	83 c0 01             	add    $0x1,%eax
+ bcd:	89 46 08             	mov    %eax,0x8(%esi)
+ bd0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ bd4:	80 fa 0a             	cmp    $0xa,%dl
+ bd7:	75 07                	jne    be0 <fwrite+0x50>
+    f->nl = 1;
+ bd9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ be0:	83 c3 01             	add    $0x1,%ebx
+ be3:	39 df                	cmp    %ebx,%edi
+ be5:	7e 41                	jle    c28 <fwrite+0x98>
+    bputc(f, s[i]);
+ be7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ bea:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ bee:	3d 00 02 00 00       	cmp    $0x200,%eax
+ bf3:	75 d3                	jne    bc8 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bf5:	83 ec 04             	sub    $0x4,%esp
+ bf8:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ bfb:	68 00 02 00 00       	push   $0x200
+ c00:	ff 75 e0             	push   -0x20(%ebp)
+ c03:	ff 36                	push   (%esi)
+ c05:	e8 8c f7 ff ff       	call   396 <write>
+  return r;
+ c0a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ c0e:	83 c4 10             	add    $0x10,%esp
+ c11:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ c13:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ c1a:	b8 01 00 00 00       	mov    $0x1,%eax
+ c1f:	eb ac                	jmp    bcd <fwrite+0x3d>
+ c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c28:	8b 46 04             	mov    0x4(%esi),%eax
+ c2b:	83 f8 02             	cmp    $0x2,%eax
+ c2e:	74 0c                	je     c3c <fwrite+0xac>
+ c30:	83 f8 01             	cmp    $0x1,%eax
+ c33:	75 1c                	jne    c51 <fwrite+0xc1>
+ c35:	8b 46 0c             	mov    0xc(%esi),%eax
+ c38:	85 c0                	test   %eax,%eax
+ c3a:	74 15                	je     c51 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c3c:	8b 46 08             	mov    0x8(%esi),%eax
+ c3f:	85 c0                	test   %eax,%eax
+ c41:	7f 5d                	jg     ca0 <fwrite+0x110>
+  f->n = 0;
+ c43:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c4a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ c51:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c57:	5b                   	pop    %ebx
+ c58:	5e                   	pop    %esi
+ c59:	5f                   	pop    %edi
+ c5a:	5d                   	pop    %ebp
+ c5b:	c3                   	ret
+ c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ c60:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ c64:	0f 84 4b ff ff ff    	je     bb5 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c6a:	8b 46 08             	mov    0x8(%esi),%eax
+ c6d:	8b 16                	mov    (%esi),%edx
+ c6f:	85 c0                	test   %eax,%eax
+ c71:	7f 45                	jg     cb8 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ c73:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ c76:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ c7d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ c84:	57                   	push   %edi
+ c85:	ff 75 08             	push   0x8(%ebp)
+ c88:	ff 36                	push   (%esi)
+ c8a:	e8 07 f7 ff ff       	call   396 <write>
+    return size > 0 ? i / size : 0;
+ c8f:	83 c4 10             	add    $0x10,%esp
+ c92:	85 c0                	test   %eax,%eax
+ c94:	78 4a                	js     ce0 <fwrite+0x150>
+ c96:	85 db                	test   %ebx,%ebx
+ c98:	7e 46                	jle    ce0 <fwrite+0x150>
+ c9a:	99                   	cltd
+ c9b:	f7 fb                	idiv   %ebx
+ c9d:	eb b5                	jmp    c54 <fwrite+0xc4>
+ c9f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ ca0:	83 ec 04             	sub    $0x4,%esp
+ ca3:	50                   	push   %eax
+ ca4:	8d 46 10             	lea    0x10(%esi),%eax
+ ca7:	50                   	push   %eax
+ ca8:	ff 36                	push   (%esi)
+ caa:	e8 e7 f6 ff ff       	call   396 <write>
+ caf:	83 c4 10             	add    $0x10,%esp
+ cb2:	eb 8f                	jmp    c43 <fwrite+0xb3>
+ cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cb8:	83 ec 04             	sub    $0x4,%esp
+ cbb:	50                   	push   %eax
+ cbc:	8d 46 10             	lea    0x10(%esi),%eax
+ cbf:	50                   	push   %eax
+ cc0:	52                   	push   %edx
+ cc1:	e8 d0 f6 ff ff       	call   396 <write>
+ cc6:	83 c4 10             	add    $0x10,%esp
+ cc9:	3b 46 08             	cmp    0x8(%esi),%eax
+ ccc:	74 a5                	je     c73 <fwrite+0xe3>
+  f->n = 0;
+ cce:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ cd5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ ce0:	31 c0                	xor    %eax,%eax
+ ce2:	e9 6d ff ff ff       	jmp    c54 <fwrite+0xc4>
+ ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ cf4:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ cf7:	83 ec 04             	sub    $0x4,%esp
+ cfa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ cfd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d00:	89 d8                	mov    %ebx,%eax
+ d02:	e8 39 f9 ff ff       	call   640 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ d07:	8b 43 04             	mov    0x4(%ebx),%eax
+ d0a:	83 f8 02             	cmp    $0x2,%eax
+ d0d:	74 18                	je     d27 <fprintf+0x37>
+ d0f:	83 f8 01             	cmp    $0x1,%eax
+ d12:	74 0c                	je     d20 <fprintf+0x30>
+  settle(f);
+}
+ d14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d17:	c9                   	leave
+ d18:	c3                   	ret
+ d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ d20:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d23:	85 c0                	test   %eax,%eax
+ d25:	74 ed                	je     d14 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d27:	8b 43 08             	mov    0x8(%ebx),%eax
+ d2a:	85 c0                	test   %eax,%eax
+ d2c:	7f 1a                	jg     d48 <fprintf+0x58>
+  f->n = 0;
+ d2e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d35:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ d3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d3f:	c9                   	leave
+ d40:	c3                   	ret
+ d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d48:	83 ec 04             	sub    $0x4,%esp
+ d4b:	50                   	push   %eax
+ d4c:	8d 43 10             	lea    0x10(%ebx),%eax
+ d4f:	50                   	push   %eax
+ d50:	ff 33                	push   (%ebx)
+ d52:	e8 3f f6 ff ff       	call   396 <write>
+  f->n = 0;
+ d57:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ d5e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ d61:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ d68:	eb d2                	jmp    d3c <fprintf+0x4c>
+ d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d70 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	53                   	push   %ebx
+ d74:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ d7d:	83 f8 0f             	cmp    $0xf,%eax
+ d80:	77 4e                	ja     dd0 <printf+0x60>
+ d82:	8b 1c 85 e0 14 00 00 	mov    0x14e0(,%eax,4),%ebx
+ d89:	85 db                	test   %ebx,%ebx
+ d8b:	74 43                	je     dd0 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ d8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d90:	89 d8                	mov    %ebx,%eax
+ d92:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ d95:	e8 a6 f8 ff ff       	call   640 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d9a:	8b 43 08             	mov    0x8(%ebx),%eax
+ d9d:	85 c0                	test   %eax,%eax
+ d9f:	7e 12                	jle    db3 <printf+0x43>
+ da1:	83 ec 04             	sub    $0x4,%esp
+ da4:	50                   	push   %eax
+ da5:	8d 43 10             	lea    0x10(%ebx),%eax
+ da8:	50                   	push   %eax
+ da9:	ff 33                	push   (%ebx)
+ dab:	e8 e6 f5 ff ff       	call   396 <write>
+ db0:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ db3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ dba:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ dc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ dc4:	c9                   	leave
+ dc5:	c3                   	ret
+ dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ dd0:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ dd6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ ddc:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ de3:	00 00 00 
+    f->n = 0;
+ de6:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ ded:	00 00 00 
+    f->nl = 0;
+ df0:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ df7:	00 00 00 
+ dfa:	eb 91                	jmp    d8d <printf+0x1d>
+ dfc:	66 90                	xchg   %ax,%ax
+ dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ e00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e01:	a1 20 15 00 00       	mov    0x1520,%eax
+{
+ e06:	89 e5                	mov    %esp,%ebp
+ e08:	57                   	push   %edi
+ e09:	56                   	push   %esi
+ e0a:	53                   	push   %ebx
+ e0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ e0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e1c:	39 ca                	cmp    %ecx,%edx
+ e1e:	73 30                	jae    e50 <free+0x50>
+ e20:	39 c1                	cmp    %eax,%ecx
+ e22:	72 04                	jb     e28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e24:	39 c2                	cmp    %eax,%edx
+ e26:	72 f0                	jb     e18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ e2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ e2e:	39 f8                	cmp    %edi,%eax
+ e30:	74 2e                	je     e60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e35:	8b 42 04             	mov    0x4(%edx),%eax
+ e38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e3b:	39 f1                	cmp    %esi,%ecx
+ e3d:	74 38                	je     e77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ e41:	5b                   	pop    %ebx
+  freep = p;
+ e42:	89 15 20 15 00 00    	mov    %edx,0x1520
+}
+ e48:	5e                   	pop    %esi
+ e49:	5f                   	pop    %edi
+ e4a:	5d                   	pop    %ebp
+ e4b:	c3                   	ret
+ e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e50:	39 c1                	cmp    %eax,%ecx
+ e52:	72 d0                	jb     e24 <free+0x24>
+ e54:	eb c2                	jmp    e18 <free+0x18>
+ e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ e60:	03 70 04             	add    0x4(%eax),%esi
+ e63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e66:	8b 02                	mov    (%edx),%eax
+ e68:	8b 00                	mov    (%eax),%eax
+ e6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ e6d:	8b 42 04             	mov    0x4(%edx),%eax
+ e70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e73:	39 f1                	cmp    %esi,%ecx
+ e75:	75 c8                	jne    e3f <free+0x3f>
+    p->s.size += bp->s.size;
+ e77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e7a:	89 15 20 15 00 00    	mov    %edx,0x1520
+    p->s.size += bp->s.size;
+ e80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ e83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ e86:	89 0a                	mov    %ecx,(%edx)
+}
+ e88:	5b                   	pop    %ebx
+ e89:	5e                   	pop    %esi
+ e8a:	5f                   	pop    %edi
+ e8b:	5d                   	pop    %ebp
+ e8c:	c3                   	ret
+ e8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	57                   	push   %edi
+ e94:	56                   	push   %esi
+ e95:	53                   	push   %ebx
+ e96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e9c:	8b 15 20 15 00 00    	mov    0x1520,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ea2:	8d 78 07             	lea    0x7(%eax),%edi
+ ea5:	c1 ef 03             	shr    $0x3,%edi
+ ea8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ eab:	85 d2                	test   %edx,%edx
+ ead:	0f 84 8d 00 00 00    	je     f40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ eb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ eb5:	8b 48 04             	mov    0x4(%eax),%ecx
+ eb8:	39 f9                	cmp    %edi,%ecx
+ eba:	73 64                	jae    f20 <malloc+0x90>
+  if(nu < 4096)
+ ebc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ec1:	39 df                	cmp    %ebx,%edi
+ ec3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ec6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ecd:	eb 0a                	jmp    ed9 <malloc+0x49>
+ ecf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ed0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ed2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ed5:	39 f9                	cmp    %edi,%ecx
+ ed7:	73 47                	jae    f20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ed9:	89 c2                	mov    %eax,%edx
+ edb:	39 05 20 15 00 00    	cmp    %eax,0x1520
+ ee1:	75 ed                	jne    ed0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ee3:	83 ec 0c             	sub    $0xc,%esp
+ ee6:	56                   	push   %esi
+ ee7:	e8 12 f5 ff ff       	call   3fe <sbrk>
+  if(p == (char*)-1)
+ eec:	83 c4 10             	add    $0x10,%esp
+ eef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ef2:	74 1c                	je     f10 <malloc+0x80>
+  hp->s.size = nu;
+ ef4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ef7:	83 ec 0c             	sub    $0xc,%esp
+ efa:	83 c0 08             	add    $0x8,%eax
+ efd:	50                   	push   %eax
+ efe:	e8 fd fe ff ff       	call   e00 <free>
+  return freep;
+ f03:	8b 15 20 15 00 00    	mov    0x1520,%edx
+      if((p = morecore(nunits)) == 0)
+ f09:	83 c4 10             	add    $0x10,%esp
+ f0c:	85 d2                	test   %edx,%edx
+ f0e:	75 c0                	jne    ed0 <malloc+0x40>
+        return 0;
+  }
+}
+ f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ f13:	31 c0                	xor    %eax,%eax
+}
+ f15:	5b                   	pop    %ebx
+ f16:	5e                   	pop    %esi
+ f17:	5f                   	pop    %edi
+ f18:	5d                   	pop    %ebp
+ f19:	c3                   	ret
+ f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ f20:	39 cf                	cmp    %ecx,%edi
+ f22:	74 4c                	je     f70 <malloc+0xe0>
+        p->s.size -= nunits;
+ f24:	29 f9                	sub    %edi,%ecx
+ f26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ f29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ f2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ f2f:	89 15 20 15 00 00    	mov    %edx,0x1520
+}
+ f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f38:	83 c0 08             	add    $0x8,%eax
+}
+ f3b:	5b                   	pop    %ebx
+ f3c:	5e                   	pop    %esi
+ f3d:	5f                   	pop    %edi
+ f3e:	5d                   	pop    %ebp
+ f3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ f40:	c7 05 20 15 00 00 24 	movl   $0x1524,0x1520
+ f47:	15 00 00 
+    base.s.size = 0;
+ f4a:	b8 24 15 00 00       	mov    $0x1524,%eax
+    base.s.ptr = freep = prevp = &base;
+ f4f:	c7 05 24 15 00 00 24 	movl   $0x1524,0x1524
+ f56:	15 00 00 
+    base.s.size = 0;
+ f59:	c7 05 28 15 00 00 00 	movl   $0x0,0x1528
+ f60:	00 00 00 
+    if(p->s.size >= nunits){
+ f63:	e9 54 ff ff ff       	jmp    ebc <malloc+0x2c>
+ f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f70:	8b 08                	mov    (%eax),%ecx
+ f72:	89 0a                	mov    %ecx,(%edx)
+ f74:	eb b9                	jmp    f2f <malloc+0x9f>
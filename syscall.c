@@ -106,8 +106,19 @@ extern int sys_uptime(void);
 extern int sys_sigprocmask(void);
 extern int sys_sigaction(void);
 extern int sys_sigret(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_nanosleep(void);
+extern int sys_setpriority(void);
+extern int sys_sched_setattr(void);
+extern int sys_sched_yield(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_getrusage(void);
+extern int sys_syslat(void);
+extern int sys_sched_getattr(void);
 
-static int (*syscalls[])(void) = {
+static int (*syscalls[NSYSCALL])(void) = {
 [SYS_fork]    sys_fork,
 [SYS_exit]    sys_exit,
 [SYS_wait]    sys_wait,
@@ -132,20 +143,71 @@ static int (*syscalls[])(void) = {
 [SYS_sigprocmask]   sys_sigprocmask,
 [SYS_sigaction]   sys_sigaction,
 [SYS_sigret]  sys_sigret,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_nanosleep] sys_nanosleep,
+[SYS_setpriority] sys_setpriority,
+[SYS_sched_setattr] sys_sched_setattr,
+[SYS_sched_yield] sys_sched_yield,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_getrusage] sys_getrusage,
+[SYS_syslat]  sys_syslat,
+[SYS_sched_getattr] sys_sched_getattr,
 };
 
+// Histograms of how many TSC cycles each system call took,
+// a row per CPU. A CPU adds only to its own row, with
+// interrupts off, so no lock is needed; a call that sleeps
+// and moves is counted on the CPU it finished on.
+static uint syslathist[NCPU][NSYSCALL][NLATBUCKET];
+
 void
 syscall(void)
 {
-  int num;
+  int num, b;
+  uint64 t;
+  struct cpu *c;
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
+  curproc->ru.ru_nsyscall++;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    t = rdtsc();
     curproc->tf->eax = syscalls[num]();
+    t = rdtsc() - t;
+    b = t > 0xffffffff ? NLATBUCKET-1 : t ? 31 - __builtin_clz((uint)t) : 0;
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
     curproc->tf->eax = -1;
+    b = -1;
+  }
+  pushcli();
+  c = mycpu();
+  c->ru.ru_nsyscall++;
+  if(b >= 0)
+    syslathist[c-cpus][num][b]++;
+  popcli();
+}
+
+// Copy the system call latency histograms of CPU cpu, or the
+// sum of all CPUs' if cpu is -1, to hist, which holds
+// NSYSCALL*NLATBUCKET counts. Return the number of CPUs.
+int
+syslat(int cpu, uint *hist)
+{
+  int i, j, k;
+
+  if(cpu < -1 || cpu >= ncpu)
+    return -1;
+  memset(hist, 0, sizeof(syslathist[0]));
+  for(i = 0; i < ncpu; i++){
+    if(cpu != -1 && i != cpu)
+      continue;
+    for(j = 0; j < NSYSCALL; j++)
+      for(k = 0; k < NLATBUCKET; k++)
+        hist[j*NLATBUCKET + k] += syslathist[i][j][k];
   }
+  return ncpu;
 }
@@ -22,4 +22,18 @@
 #define SYS_close  21
 #define SYS_sigprocmask 22
 #define SYS_sigaction 23
-#define SYS_sigret 24
\ No newline at end of file
+#define SYS_sigret 24
+#define SYS_readv  25
+#define SYS_writev 26
+#define SYS_nanosleep 27
+#define SYS_setpriority 28
+#define SYS_sched_setattr 29
+#define SYS_sched_yield 30
+#define SYS_sched_setaffinity 31
+#define SYS_sched_getaffinity 32
+#define SYS_getrusage 33
+#define SYS_syslat 34
+#define SYS_sched_getattr 35
+
+#define NSYSCALL   36  // size of the system call table
+#define NLATBUCKET 32  // syslat() bucket i counts calls of 2^i..2^(i+1)-1 cycles
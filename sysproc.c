@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "sched.h"
+#include "syscall.h"
 
 int
 sys_fork(void)
@@ -63,34 +65,128 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
+  if(n <= 0)
+    return 0;
+  return sleepns((uint64)n * TICKNS);
+}
+
+// Sleep for the time in *ts, to the resolution of the
+// timer wheel rather than of the clock tick.
+int
+sys_nanosleep(void)
+{
+  struct timespec *ts;
+
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0 || ts->tv_nsec >= 1000000000)
+    return -1;
+  return sleepns((uint64)ts->tv_sec * 1000000000 + ts->tv_nsec);
+}
+
+// Set the nice value of process pid, or of the caller if
+// pid is 0.
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setsched(pid, SCHED_SETNICE, 0, 0, nice);
+}
+
+// Set the scheduling class of process pid, or of the caller
+// if pid is 0, and its priority or nice value within it.
+int
+sys_sched_setattr(void)
+{
+  int pid;
+  struct sched_attr *attr;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&attr, sizeof(*attr)) < 0)
+    return -1;
+  if(attr->policy == SCHED_RT)
+    return setsched(pid, SCHED_SETPOLICY|SCHED_SETRTPRIO, SCHED_RT,
+                    attr->priority, 0);
+  if(attr->policy == SCHED_FAIR)
+    return setsched(pid, SCHED_SETPOLICY|SCHED_SETNICE, SCHED_FAIR,
+                    0, attr->nice);
+  return -1;
+}
+
+// Get the scheduling class of process pid, or of the caller
+// if pid is 0, and its priority and nice value.
+int
+sys_sched_getattr(void)
+{
+  int pid;
+  struct sched_attr *attr;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&attr, sizeof(*attr)) < 0)
+    return -1;
+  return getsched(pid, attr);
+}
+
+int
+sys_sched_yield(void)
+{
+  schedyield();
   return 0;
 }
 
-// return how many clock tick interrupts have occurred
+// Let process pid, or the caller if pid is 0, run only on
+// the CPUs in a mask, bit i for the ith CPU.
+int
+sys_sched_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, (uint)mask);
+}
+
+int
+sys_sched_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
+int
+sys_getrusage(void)
+{
+  int who;
+  struct rusage *ru;
+
+  if(argint(0, &who) < 0 || argptr(1, (void*)&ru, sizeof(*ru)) < 0)
+    return -1;
+  return getrusage(who, ru);
+}
+
+int
+sys_syslat(void)
+{
+  int cpu;
+  char *hist;
+
+  if(argint(0, &cpu) < 0 ||
+     argptr(1, &hist, NSYSCALL*NLATBUCKET*sizeof(uint)) < 0)
+    return -1;
+  return syslat(cpu, (uint*)hist);
+}
+
+// return how many clock ticks have passed
 // since start.
 int
 sys_uptime(void)
 {
-  uint xticks;
-
-  acquire(&tickslock);
-  xticks = ticks;
-  release(&tickslock);
-  return xticks;
+  return tickcount();
 }
 
 int
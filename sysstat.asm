@@ -0,0 +1,2252 @@
+
+_sysstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 0c             	sub    $0xc,%esp
+  int cpu, ncpu, i;
+
+  cpu = -1;
+  if(argc > 2){
+      13:	83 39 02             	cmpl   $0x2,(%ecx)
+{
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 2){
+      19:	7f 4e                	jg     69 <main+0x69>
+    printf(2, "usage: sysstat [cpu]\n");
+    exit();
+  }
+  if(argc == 2)
+      1b:	74 74                	je     91 <main+0x91>
+    cpu = atoi(argv[1]);
+  if((ncpu = syslat(cpu, (uint*)hist)) < 0){
+      1d:	50                   	push   %eax
+      1e:	50                   	push   %eax
+      1f:	68 e0 17 00 00       	push   $0x17e0
+      24:	6a ff                	push   $0xffffffff
+      26:	e8 3b 05 00 00       	call   566 <syslat>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 4a                	js     7c <main+0x7c>
+    printf(2, "sysstat: no cpu %s\n", argv[1]);
+    exit();
+  }
+
+  if(cpu < 0)
+    printf(1, "all %d cpus\n", ncpu);
+      32:	52                   	push   %edx
+      33:	50                   	push   %eax
+      34:	68 a3 10 00 00       	push   $0x10a3
+      39:	6a 01                	push   $0x1
+      3b:	e8 20 0e 00 00       	call   e60 <printf>
+      40:	83 c4 10             	add    $0x10,%esp
+{
+      43:	bb 01 00 00 00       	mov    $0x1,%ebx
+      48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4f:	90                   	nop
+  else
+    printf(1, "cpu %d of %d\n", cpu, ncpu);
+  for(i = 1; i < NSYSCALL; i++)
+    printhist(i);
+      50:	83 ec 0c             	sub    $0xc,%esp
+      53:	53                   	push   %ebx
+  for(i = 1; i < NSYSCALL; i++)
+      54:	83 c3 01             	add    $0x1,%ebx
+    printhist(i);
+      57:	e8 74 00 00 00       	call   d0 <printhist>
+  for(i = 1; i < NSYSCALL; i++)
+      5c:	83 c4 10             	add    $0x10,%esp
+      5f:	83 fb 24             	cmp    $0x24,%ebx
+      62:	75 ec                	jne    50 <main+0x50>
+  exit();
+      64:	e8 e7 03 00 00       	call   450 <exit>
+    printf(2, "usage: sysstat [cpu]\n");
+      69:	50                   	push   %eax
+      6a:	50                   	push   %eax
+      6b:	68 79 10 00 00       	push   $0x1079
+      70:	6a 02                	push   $0x2
+      72:	e8 e9 0d 00 00       	call   e60 <printf>
+    exit();
+      77:	e8 d4 03 00 00       	call   450 <exit>
+    printf(2, "sysstat: no cpu %s\n", argv[1]);
+      7c:	50                   	push   %eax
+      7d:	ff 73 04             	push   0x4(%ebx)
+      80:	68 8f 10 00 00       	push   $0x108f
+      85:	6a 02                	push   $0x2
+      87:	e8 d4 0d 00 00       	call   e60 <printf>
+    exit();
+      8c:	e8 bf 03 00 00       	call   450 <exit>
+    cpu = atoi(argv[1]);
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	ff 73 04             	push   0x4(%ebx)
+      97:	e8 44 03 00 00       	call   3e0 <atoi>
+  if((ncpu = syslat(cpu, (uint*)hist)) < 0){
+      9c:	59                   	pop    %ecx
+    cpu = atoi(argv[1]);
+      9d:	89 c6                	mov    %eax,%esi
+  if((ncpu = syslat(cpu, (uint*)hist)) < 0){
+      9f:	58                   	pop    %eax
+      a0:	68 e0 17 00 00       	push   $0x17e0
+      a5:	56                   	push   %esi
+      a6:	e8 bb 04 00 00       	call   566 <syslat>
+      ab:	83 c4 10             	add    $0x10,%esp
+      ae:	85 c0                	test   %eax,%eax
+      b0:	78 ca                	js     7c <main+0x7c>
+  if(cpu < 0)
+      b2:	85 f6                	test   %esi,%esi
+      b4:	0f 88 78 ff ff ff    	js     32 <main+0x32>
+    printf(1, "cpu %d of %d\n", cpu, ncpu);
+      ba:	50                   	push   %eax
+      bb:	56                   	push   %esi
+      bc:	68 b0 10 00 00       	push   $0x10b0
+      c1:	6a 01                	push   $0x1
+      c3:	e8 98 0d 00 00       	call   e60 <printf>
+      c8:	83 c4 10             	add    $0x10,%esp
+      cb:	e9 73 ff ff ff       	jmp    43 <main+0x43>
+
+000000d0 <printhist>:
+{
+      d0:	55                   	push   %ebp
+  for(i = 0; i < NLATBUCKET; i++){
+      d1:	31 c0                	xor    %eax,%eax
+  tot = max = 0;
+      d3:	31 c9                	xor    %ecx,%ecx
+{
+      d5:	89 e5                	mov    %esp,%ebp
+      d7:	57                   	push   %edi
+  tot = max = 0;
+      d8:	31 ff                	xor    %edi,%edi
+{
+      da:	56                   	push   %esi
+      db:	53                   	push   %ebx
+  lo = hi = -1;
+      dc:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+{
+      e1:	83 ec 1c             	sub    $0x1c,%esp
+  h = hist[num];
+      e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  lo = hi = -1;
+      e7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  h = hist[num];
+      ee:	c1 e6 07             	shl    $0x7,%esi
+      f1:	81 c6 e0 17 00 00    	add    $0x17e0,%esi
+  for(i = 0; i < NLATBUCKET; i++){
+      f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fe:	66 90                	xchg   %ax,%ax
+    if(h[i] == 0)
+     100:	8b 14 86             	mov    (%esi,%eax,4),%edx
+     103:	85 d2                	test   %edx,%edx
+     105:	74 10                	je     117 <printhist+0x47>
+    tot += h[i];
+     107:	01 d1                	add    %edx,%ecx
+    if(h[i] > max)
+     109:	39 d7                	cmp    %edx,%edi
+    if(lo < 0)
+     10b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     10e:	0f 42 fa             	cmovb  %edx,%edi
+     111:	83 fb ff             	cmp    $0xffffffff,%ebx
+     114:	0f 44 d8             	cmove  %eax,%ebx
+  for(i = 0; i < NLATBUCKET; i++){
+     117:	83 c0 01             	add    $0x1,%eax
+     11a:	83 f8 20             	cmp    $0x20,%eax
+     11d:	75 e1                	jne    100 <printhist+0x30>
+  if(tot == 0)
+     11f:	85 c9                	test   %ecx,%ecx
+     121:	0f 84 d4 00 00 00    	je     1fb <printhist+0x12b>
+  per = (max + BARLEN - 1) / BARLEN;  // calls per star
+     127:	83 c7 27             	add    $0x27,%edi
+     12a:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     12f:	f7 e7                	mul    %edi
+  half = (tot + 1) / 2;
+     131:	8d 79 01             	lea    0x1(%ecx),%edi
+  for(med = lo; sum + h[med] < half; med++)
+     134:	89 d8                	mov    %ebx,%eax
+  half = (tot + 1) / 2;
+     136:	d1 ef                	shr    %edi
+  per = (max + BARLEN - 1) / BARLEN;  // calls per star
+     138:	c1 ea 05             	shr    $0x5,%edx
+     13b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  for(med = lo; sum + h[med] < half; med++)
+     13e:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+     141:	39 fa                	cmp    %edi,%edx
+     143:	73 0d                	jae    152 <printhist+0x82>
+     145:	8d 76 00             	lea    0x0(%esi),%esi
+     148:	83 c0 01             	add    $0x1,%eax
+     14b:	03 14 86             	add    (%esi,%eax,4),%edx
+     14e:	39 fa                	cmp    %edi,%edx
+     150:	72 f6                	jb     148 <printhist+0x78>
+  printf(1, "%s: %d calls, median under 2^%d cycles\n",
+     152:	8d 78 01             	lea    0x1(%eax),%edi
+         names[num] ? names[num] : "?", tot, med+1);
+     155:	8b 45 08             	mov    0x8(%ebp),%eax
+  printf(1, "%s: %d calls, median under 2^%d cycles\n",
+     158:	ba 68 10 00 00       	mov    $0x1068,%edx
+         names[num] ? names[num] : "?", tot, med+1);
+     15d:	8b 04 85 40 17 00 00 	mov    0x1740(,%eax,4),%eax
+  printf(1, "%s: %d calls, median under 2^%d cycles\n",
+     164:	85 c0                	test   %eax,%eax
+     166:	0f 44 c2             	cmove  %edx,%eax
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	57                   	push   %edi
+     16d:	51                   	push   %ecx
+     16e:	50                   	push   %eax
+     16f:	68 c8 11 00 00       	push   $0x11c8
+     174:	6a 01                	push   $0x1
+     176:	e8 e5 0c 00 00       	call   e60 <printf>
+  for(i = lo; i <= hi; i++){
+     17b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     17e:	83 c4 20             	add    $0x20,%esp
+     181:	39 c3                	cmp    %eax,%ebx
+     183:	7f 76                	jg     1fb <printhist+0x12b>
+    printf(1, "  2^%d%s %d ", i, i < 10 ? " " : "", h[i]);
+     185:	89 df                	mov    %ebx,%edi
+     187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18e:	66 90                	xchg   %ax,%ax
+     190:	83 ff 0a             	cmp    $0xa,%edi
+     193:	b9 75 10 00 00       	mov    $0x1075,%ecx
+     198:	b8 8e 10 00 00       	mov    $0x108e,%eax
+     19d:	0f 4c c1             	cmovl  %ecx,%eax
+     1a0:	83 ec 0c             	sub    $0xc,%esp
+     1a3:	ff 34 be             	push   (%esi,%edi,4)
+     1a6:	50                   	push   %eax
+     1a7:	57                   	push   %edi
+     1a8:	68 6a 10 00 00       	push   $0x106a
+     1ad:	6a 01                	push   $0x1
+     1af:	e8 ac 0c 00 00       	call   e60 <printf>
+    for(n = h[i] / per; n > 0; n--)
+     1b4:	8b 04 be             	mov    (%esi,%edi,4),%eax
+     1b7:	31 d2                	xor    %edx,%edx
+     1b9:	83 c4 20             	add    $0x20,%esp
+     1bc:	f7 75 e0             	divl   -0x20(%ebp)
+     1bf:	89 c3                	mov    %eax,%ebx
+     1c1:	85 c0                	test   %eax,%eax
+     1c3:	7e 1a                	jle    1df <printhist+0x10f>
+     1c5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "*");
+     1c8:	83 ec 08             	sub    $0x8,%esp
+     1cb:	68 77 10 00 00       	push   $0x1077
+     1d0:	6a 01                	push   $0x1
+     1d2:	e8 89 0c 00 00       	call   e60 <printf>
+    for(n = h[i] / per; n > 0; n--)
+     1d7:	83 c4 10             	add    $0x10,%esp
+     1da:	83 eb 01             	sub    $0x1,%ebx
+     1dd:	75 e9                	jne    1c8 <printhist+0xf8>
+    printf(1, "\n");
+     1df:	83 ec 08             	sub    $0x8,%esp
+  for(i = lo; i <= hi; i++){
+     1e2:	83 c7 01             	add    $0x1,%edi
+    printf(1, "\n");
+     1e5:	68 8d 10 00 00       	push   $0x108d
+     1ea:	6a 01                	push   $0x1
+     1ec:	e8 6f 0c 00 00       	call   e60 <printf>
+  for(i = lo; i <= hi; i++){
+     1f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1f4:	83 c4 10             	add    $0x10,%esp
+     1f7:	39 c7                	cmp    %eax,%edi
+     1f9:	7e 95                	jle    190 <printhist+0xc0>
+}
+     1fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1fe:	5b                   	pop    %ebx
+     1ff:	5e                   	pop    %esi
+     200:	5f                   	pop    %edi
+     201:	5d                   	pop    %ebp
+     202:	c3                   	ret
+     203:	66 90                	xchg   %ax,%ax
+     205:	66 90                	xchg   %ax,%ax
+     207:	66 90                	xchg   %ax,%ax
+     209:	66 90                	xchg   %ax,%ax
+     20b:	66 90                	xchg   %ax,%ax
+     20d:	66 90                	xchg   %ax,%ax
+     20f:	90                   	nop
+
+00000210 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     211:	31 c0                	xor    %eax,%eax
+{
+     213:	89 e5                	mov    %esp,%ebp
+     215:	53                   	push   %ebx
+     216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     227:	83 c0 01             	add    $0x1,%eax
+     22a:	84 d2                	test   %dl,%dl
+     22c:	75 f2                	jne    220 <strcpy+0x10>
+    ;
+  return os;
+}
+     22e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     231:	89 c8                	mov    %ecx,%eax
+     233:	c9                   	leave
+     234:	c3                   	ret
+     235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	53                   	push   %ebx
+     244:	8b 55 08             	mov    0x8(%ebp),%edx
+     247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     24a:	0f b6 02             	movzbl (%edx),%eax
+     24d:	84 c0                	test   %al,%al
+     24f:	75 17                	jne    268 <strcmp+0x28>
+     251:	eb 3a                	jmp    28d <strcmp+0x4d>
+     253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     257:	90                   	nop
+     258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     25c:	83 c2 01             	add    $0x1,%edx
+     25f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     262:	84 c0                	test   %al,%al
+     264:	74 1a                	je     280 <strcmp+0x40>
+    p++, q++;
+     266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     268:	0f b6 19             	movzbl (%ecx),%ebx
+     26b:	38 c3                	cmp    %al,%bl
+     26d:	74 e9                	je     258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     26f:	29 d8                	sub    %ebx,%eax
+}
+     271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     274:	c9                   	leave
+     275:	c3                   	ret
+     276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     284:	31 c0                	xor    %eax,%eax
+     286:	29 d8                	sub    %ebx,%eax
+}
+     288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     28b:	c9                   	leave
+     28c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     28d:	0f b6 19             	movzbl (%ecx),%ebx
+     290:	31 c0                	xor    %eax,%eax
+     292:	eb db                	jmp    26f <strcmp+0x2f>
+     294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     29f:	90                   	nop
+
+000002a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2a6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2a9:	74 15                	je     2c0 <strlen+0x20>
+     2ab:	31 c0                	xor    %eax,%eax
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+     2b0:	83 c0 01             	add    $0x1,%eax
+     2b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2b7:	89 c1                	mov    %eax,%ecx
+     2b9:	75 f5                	jne    2b0 <strlen+0x10>
+    ;
+  return n;
+}
+     2bb:	89 c8                	mov    %ecx,%eax
+     2bd:	5d                   	pop    %ebp
+     2be:	c3                   	ret
+     2bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2c0:	31 c9                	xor    %ecx,%ecx
+}
+     2c2:	5d                   	pop    %ebp
+     2c3:	89 c8                	mov    %ecx,%eax
+     2c5:	c3                   	ret
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	57                   	push   %edi
+     2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2da:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2dd:	89 d7                	mov    %edx,%edi
+     2df:	fc                   	cld
+     2e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2e5:	89 d0                	mov    %edx,%eax
+     2e7:	c9                   	leave
+     2e8:	c3                   	ret
+     2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2fa:	0f b6 10             	movzbl (%eax),%edx
+     2fd:	84 d2                	test   %dl,%dl
+     2ff:	75 12                	jne    313 <strchr+0x23>
+     301:	eb 1d                	jmp    320 <strchr+0x30>
+     303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     307:	90                   	nop
+     308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     30c:	83 c0 01             	add    $0x1,%eax
+     30f:	84 d2                	test   %dl,%dl
+     311:	74 0d                	je     320 <strchr+0x30>
+    if(*s == c)
+     313:	38 d1                	cmp    %dl,%cl
+     315:	75 f1                	jne    308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     317:	5d                   	pop    %ebp
+     318:	c3                   	ret
+     319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     320:	31 c0                	xor    %eax,%eax
+}
+     322:	5d                   	pop    %ebp
+     323:	c3                   	ret
+     324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     32f:	90                   	nop
+
+00000330 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	57                   	push   %edi
+     334:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     335:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     338:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     339:	31 db                	xor    %ebx,%ebx
+{
+     33b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     33e:	eb 27                	jmp    367 <gets+0x37>
+    cc = read(0, &c, 1);
+     340:	83 ec 04             	sub    $0x4,%esp
+     343:	6a 01                	push   $0x1
+     345:	56                   	push   %esi
+     346:	6a 00                	push   $0x0
+     348:	e8 31 01 00 00       	call   47e <read>
+    if(cc < 1)
+     34d:	83 c4 10             	add    $0x10,%esp
+     350:	85 c0                	test   %eax,%eax
+     352:	7e 1d                	jle    371 <gets+0x41>
+      break;
+    buf[i++] = c;
+     354:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     358:	8b 55 08             	mov    0x8(%ebp),%edx
+     35b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     35f:	3c 0a                	cmp    $0xa,%al
+     361:	74 10                	je     373 <gets+0x43>
+     363:	3c 0d                	cmp    $0xd,%al
+     365:	74 0c                	je     373 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     367:	89 df                	mov    %ebx,%edi
+     369:	83 c3 01             	add    $0x1,%ebx
+     36c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     36f:	7c cf                	jl     340 <gets+0x10>
+     371:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     373:	8b 45 08             	mov    0x8(%ebp),%eax
+     376:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     37a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     37d:	5b                   	pop    %ebx
+     37e:	5e                   	pop    %esi
+     37f:	5f                   	pop    %edi
+     380:	5d                   	pop    %ebp
+     381:	c3                   	ret
+     382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	56                   	push   %esi
+     394:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     395:	83 ec 08             	sub    $0x8,%esp
+     398:	6a 00                	push   $0x0
+     39a:	ff 75 08             	push   0x8(%ebp)
+     39d:	e8 04 01 00 00       	call   4a6 <open>
+  if(fd < 0)
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	85 c0                	test   %eax,%eax
+     3a7:	78 27                	js     3d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     3a9:	83 ec 08             	sub    $0x8,%esp
+     3ac:	ff 75 0c             	push   0xc(%ebp)
+     3af:	89 c3                	mov    %eax,%ebx
+     3b1:	50                   	push   %eax
+     3b2:	e8 07 01 00 00       	call   4be <fstat>
+  close(fd);
+     3b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     3ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+     3bc:	e8 cd 00 00 00       	call   48e <close>
+  return r;
+     3c1:	83 c4 10             	add    $0x10,%esp
+}
+     3c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3c7:	89 f0                	mov    %esi,%eax
+     3c9:	5b                   	pop    %ebx
+     3ca:	5e                   	pop    %esi
+     3cb:	5d                   	pop    %ebp
+     3cc:	c3                   	ret
+     3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     3d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     3d5:	eb ed                	jmp    3c4 <stat+0x34>
+     3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     3e0:	55                   	push   %ebp
+     3e1:	89 e5                	mov    %esp,%ebp
+     3e3:	53                   	push   %ebx
+     3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     3e7:	0f be 02             	movsbl (%edx),%eax
+     3ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     3ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     3f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     3f5:	77 1e                	ja     415 <atoi+0x35>
+     3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     400:	83 c2 01             	add    $0x1,%edx
+     403:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     406:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     40a:	0f be 02             	movsbl (%edx),%eax
+     40d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     410:	80 fb 09             	cmp    $0x9,%bl
+     413:	76 eb                	jbe    400 <atoi+0x20>
+  return n;
+}
+     415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     418:	89 c8                	mov    %ecx,%eax
+     41a:	c9                   	leave
+     41b:	c3                   	ret
+     41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	57                   	push   %edi
+     424:	56                   	push   %esi
+     425:	8b 45 10             	mov    0x10(%ebp),%eax
+     428:	8b 55 08             	mov    0x8(%ebp),%edx
+     42b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     42e:	85 c0                	test   %eax,%eax
+     430:	7e 13                	jle    445 <memmove+0x25>
+     432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     434:	89 d7                	mov    %edx,%edi
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     441:	39 f8                	cmp    %edi,%eax
+     443:	75 fb                	jne    440 <memmove+0x20>
+  return vdst;
+}
+     445:	5e                   	pop    %esi
+     446:	89 d0                	mov    %edx,%eax
+     448:	5f                   	pop    %edi
+     449:	5d                   	pop    %ebp
+     44a:	c3                   	ret
+     44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+
+00000450 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+     456:	a1 e0 29 00 00       	mov    0x29e0,%eax
+     45b:	85 c0                	test   %eax,%eax
+     45d:	74 02                	je     461 <exit+0x11>
+    exithook();
+     45f:	ff d0                	call   *%eax
+  _exit();
+     461:	e8 10 01 00 00       	call   576 <_exit>
+
+00000466 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     466:	b8 01 00 00 00       	mov    $0x1,%eax
+     46b:	cd 40                	int    $0x40
+     46d:	c3                   	ret
+
+0000046e <wait>:
+SYSCALL(wait)
+     46e:	b8 03 00 00 00       	mov    $0x3,%eax
+     473:	cd 40                	int    $0x40
+     475:	c3                   	ret
+
+00000476 <pipe>:
+SYSCALL(pipe)
+     476:	b8 04 00 00 00       	mov    $0x4,%eax
+     47b:	cd 40                	int    $0x40
+     47d:	c3                   	ret
+
+0000047e <read>:
+SYSCALL(read)
+     47e:	b8 05 00 00 00       	mov    $0x5,%eax
+     483:	cd 40                	int    $0x40
+     485:	c3                   	ret
+
+00000486 <write>:
+SYSCALL(write)
+     486:	b8 10 00 00 00       	mov    $0x10,%eax
+     48b:	cd 40                	int    $0x40
+     48d:	c3                   	ret
+
+0000048e <close>:
+SYSCALL(close)
+     48e:	b8 15 00 00 00       	mov    $0x15,%eax
+     493:	cd 40                	int    $0x40
+     495:	c3                   	ret
+
+00000496 <kill>:
+SYSCALL(kill)
+     496:	b8 06 00 00 00       	mov    $0x6,%eax
+     49b:	cd 40                	int    $0x40
+     49d:	c3                   	ret
+
+0000049e <exec>:
+SYSCALL(exec)
+     49e:	b8 07 00 00 00       	mov    $0x7,%eax
+     4a3:	cd 40                	int    $0x40
+     4a5:	c3                   	ret
+
+000004a6 <open>:
+SYSCALL(open)
+     4a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+     4ab:	cd 40                	int    $0x40
+     4ad:	c3                   	ret
+
+000004ae <mknod>:
+SYSCALL(mknod)
+     4ae:	b8 11 00 00 00       	mov    $0x11,%eax
+     4b3:	cd 40                	int    $0x40
+     4b5:	c3                   	ret
+
+000004b6 <unlink>:
+SYSCALL(unlink)
+     4b6:	b8 12 00 00 00       	mov    $0x12,%eax
+     4bb:	cd 40                	int    $0x40
+     4bd:	c3                   	ret
+
+000004be <fstat>:
+SYSCALL(fstat)
+     4be:	b8 08 00 00 00       	mov    $0x8,%eax
+     4c3:	cd 40                	int    $0x40
+     4c5:	c3                   	ret
+
+000004c6 <link>:
+SYSCALL(link)
+     4c6:	b8 13 00 00 00       	mov    $0x13,%eax
+     4cb:	cd 40                	int    $0x40
+     4cd:	c3                   	ret
+
+000004ce <mkdir>:
+SYSCALL(mkdir)
+     4ce:	b8 14 00 00 00       	mov    $0x14,%eax
+     4d3:	cd 40                	int    $0x40
+     4d5:	c3                   	ret
+
+000004d6 <chdir>:
+SYSCALL(chdir)
+     4d6:	b8 09 00 00 00       	mov    $0x9,%eax
+     4db:	cd 40                	int    $0x40
+     4dd:	c3                   	ret
+
+000004de <dup>:
+SYSCALL(dup)
+     4de:	b8 0a 00 00 00       	mov    $0xa,%eax
+     4e3:	cd 40                	int    $0x40
+     4e5:	c3                   	ret
+
+000004e6 <getpid>:
+SYSCALL(getpid)
+     4e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+     4eb:	cd 40                	int    $0x40
+     4ed:	c3                   	ret
+
+000004ee <sbrk>:
+SYSCALL(sbrk)
+     4ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+     4f3:	cd 40                	int    $0x40
+     4f5:	c3                   	ret
+
+000004f6 <sleep>:
+SYSCALL(sleep)
+     4f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+     4fb:	cd 40                	int    $0x40
+     4fd:	c3                   	ret
+
+000004fe <uptime>:
+SYSCALL(uptime)
+     4fe:	b8 0e 00 00 00       	mov    $0xe,%eax
+     503:	cd 40                	int    $0x40
+     505:	c3                   	ret
+
+00000506 <sigprocmask>:
+SYSCALL(sigprocmask)
+     506:	b8 16 00 00 00       	mov    $0x16,%eax
+     50b:	cd 40                	int    $0x40
+     50d:	c3                   	ret
+
+0000050e <sigaction>:
+SYSCALL(sigaction)
+     50e:	b8 17 00 00 00       	mov    $0x17,%eax
+     513:	cd 40                	int    $0x40
+     515:	c3                   	ret
+
+00000516 <sigret>:
+SYSCALL(sigret)
+     516:	b8 18 00 00 00       	mov    $0x18,%eax
+     51b:	cd 40                	int    $0x40
+     51d:	c3                   	ret
+
+0000051e <readv>:
+SYSCALL(readv)
+     51e:	b8 19 00 00 00       	mov    $0x19,%eax
+     523:	cd 40                	int    $0x40
+     525:	c3                   	ret
+
+00000526 <writev>:
+SYSCALL(writev)
+     526:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     52b:	cd 40                	int    $0x40
+     52d:	c3                   	ret
+
+0000052e <nanosleep>:
+SYSCALL(nanosleep)
+     52e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     533:	cd 40                	int    $0x40
+     535:	c3                   	ret
+
+00000536 <setpriority>:
+SYSCALL(setpriority)
+     536:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     53b:	cd 40                	int    $0x40
+     53d:	c3                   	ret
+
+0000053e <sched_setattr>:
+SYSCALL(sched_setattr)
+     53e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     543:	cd 40                	int    $0x40
+     545:	c3                   	ret
+
+00000546 <sched_yield>:
+SYSCALL(sched_yield)
+     546:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     54b:	cd 40                	int    $0x40
+     54d:	c3                   	ret
+
+0000054e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     54e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     553:	cd 40                	int    $0x40
+     555:	c3                   	ret
+
+00000556 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     556:	b8 20 00 00 00       	mov    $0x20,%eax
+     55b:	cd 40                	int    $0x40
+     55d:	c3                   	ret
+
+0000055e <getrusage>:
+SYSCALL(getrusage)
+     55e:	b8 21 00 00 00       	mov    $0x21,%eax
+     563:	cd 40                	int    $0x40
+     565:	c3                   	ret
+
+00000566 <syslat>:
+SYSCALL(syslat)
+     566:	b8 22 00 00 00       	mov    $0x22,%eax
+     56b:	cd 40                	int    $0x40
+     56d:	c3                   	ret
+
+0000056e <sched_getattr>:
+SYSCALL(sched_getattr)
+     56e:	b8 23 00 00 00       	mov    $0x23,%eax
+     573:	cd 40                	int    $0x40
+     575:	c3                   	ret
+
+00000576 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+     576:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+     57b:	cd 40                	int    $0x40
+  ret
+     57d:	c3                   	ret
+     57e:	66 90                	xchg   %ax,%ax
+
+00000580 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	56                   	push   %esi
+     584:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+     585:	31 db                	xor    %ebx,%ebx
+     587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58e:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+     590:	8b 34 9d 00 2a 00 00 	mov    0x2a00(,%ebx,4),%esi
+     597:	85 f6                	test   %esi,%esi
+     599:	74 27                	je     5c2 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     59b:	8b 46 08             	mov    0x8(%esi),%eax
+     59e:	85 c0                	test   %eax,%eax
+     5a0:	7e 12                	jle    5b4 <flushall+0x34>
+     5a2:	83 ec 04             	sub    $0x4,%esp
+     5a5:	50                   	push   %eax
+     5a6:	8d 46 10             	lea    0x10(%esi),%eax
+     5a9:	50                   	push   %eax
+     5aa:	ff 36                	push   (%esi)
+     5ac:	e8 d5 fe ff ff       	call   486 <write>
+     5b1:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+     5b4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     5bb:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+     5c2:	83 c3 01             	add    $0x1,%ebx
+     5c5:	83 fb 10             	cmp    $0x10,%ebx
+     5c8:	75 c6                	jne    590 <flushall+0x10>
+}
+     5ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5cd:	5b                   	pop    %ebx
+     5ce:	5e                   	pop    %esi
+     5cf:	5d                   	pop    %ebp
+     5d0:	c3                   	ret
+     5d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     5e8:	89 d1                	mov    %edx,%ecx
+{
+     5ea:	83 ec 2c             	sub    $0x2c,%esp
+     5ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+     5f0:	85 d2                	test   %edx,%edx
+     5f2:	0f 89 c8 00 00 00    	jns    6c0 <printint+0xe0>
+     5f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     5fc:	0f 84 be 00 00 00    	je     6c0 <printint+0xe0>
+    x = -xx;
+     602:	f7 d9                	neg    %ecx
+    neg = 1;
+     604:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     609:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     60c:	31 f6                	xor    %esi,%esi
+     60e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+     610:	89 c8                	mov    %ecx,%eax
+     612:	31 d2                	xor    %edx,%edx
+     614:	89 f7                	mov    %esi,%edi
+     616:	f7 f3                	div    %ebx
+     618:	8d 76 01             	lea    0x1(%esi),%esi
+     61b:	0f b6 92 50 12 00 00 	movzbl 0x1250(%edx),%edx
+     622:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     626:	89 ca                	mov    %ecx,%edx
+     628:	89 c1                	mov    %eax,%ecx
+     62a:	39 da                	cmp    %ebx,%edx
+     62c:	73 e2                	jae    610 <printint+0x30>
+  if(neg)
+     62e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     631:	85 c0                	test   %eax,%eax
+     633:	74 07                	je     63c <printint+0x5c>
+    buf[i++] = '-';
+     635:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     63a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+     63c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     63f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     642:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     644:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+     647:	8b 41 08             	mov    0x8(%ecx),%eax
+     64a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     64d:	89 ce                	mov    %ecx,%esi
+     64f:	eb 28                	jmp    679 <printint+0x99>
+     651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+     658:	89 c1                	mov    %eax,%ecx
+     65a:	83 c0 01             	add    $0x1,%eax
+     65d:	89 46 08             	mov    %eax,0x8(%esi)
+     660:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     664:	80 fa 0a             	cmp    $0xa,%dl
+     667:	75 07                	jne    670 <printint+0x90>
+    f->nl = 1;
+     669:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+     670:	8d 57 ff             	lea    -0x1(%edi),%edx
+     673:	39 fb                	cmp    %edi,%ebx
+     675:	74 39                	je     6b0 <printint+0xd0>
+     677:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+     679:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+     67c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     681:	75 d5                	jne    658 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     683:	83 ec 04             	sub    $0x4,%esp
+     686:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+     689:	68 00 02 00 00       	push   $0x200
+     68e:	ff 75 d0             	push   -0x30(%ebp)
+     691:	ff 36                	push   (%esi)
+     693:	e8 ee fd ff ff       	call   486 <write>
+  return r;
+     698:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+     69c:	83 c4 10             	add    $0x10,%esp
+     69f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     6a1:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     6a8:	b8 01 00 00 00       	mov    $0x1,%eax
+     6ad:	eb ae                	jmp    65d <printint+0x7d>
+     6af:	90                   	nop
+}
+     6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6b3:	5b                   	pop    %ebx
+     6b4:	5e                   	pop    %esi
+     6b5:	5f                   	pop    %edi
+     6b6:	5d                   	pop    %ebp
+     6b7:	c3                   	ret
+     6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+  neg = 0;
+     6c0:	31 c0                	xor    %eax,%eax
+     6c2:	e9 42 ff ff ff       	jmp    609 <printint+0x29>
+     6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <bputc>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	89 c3                	mov    %eax,%ebx
+     6d6:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+     6d9:	8b 40 08             	mov    0x8(%eax),%eax
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	74 1d                	je     700 <bputc+0x30>
+  f->buf[f->n++] = c;
+     6e3:	8d 48 01             	lea    0x1(%eax),%ecx
+     6e6:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     6e9:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     6ed:	80 fa 0a             	cmp    $0xa,%dl
+     6f0:	75 07                	jne    6f9 <bputc+0x29>
+    f->nl = 1;
+     6f2:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+     6f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6fc:	c9                   	leave
+     6fd:	c3                   	ret
+     6fe:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     700:	83 ec 04             	sub    $0x4,%esp
+     703:	8d 43 10             	lea    0x10(%ebx),%eax
+     706:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     709:	68 00 02 00 00       	push   $0x200
+     70e:	50                   	push   %eax
+     70f:	ff 33                	push   (%ebx)
+     711:	e8 70 fd ff ff       	call   486 <write>
+  return r;
+     716:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     719:	83 c4 10             	add    $0x10,%esp
+     71c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     721:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     728:	31 c0                	xor    %eax,%eax
+     72a:	eb ba                	jmp    6e6 <bputc+0x16>
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	57                   	push   %edi
+     734:	56                   	push   %esi
+     735:	53                   	push   %ebx
+     736:	83 ec 1c             	sub    $0x1c,%esp
+     739:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+     73c:	0f b6 0a             	movzbl (%edx),%ecx
+     73f:	84 c9                	test   %cl,%cl
+     741:	74 47                	je     78a <vfprintf+0x5a>
+     743:	8d 5a 01             	lea    0x1(%edx),%ebx
+     746:	89 c7                	mov    %eax,%edi
+     748:	31 d2                	xor    %edx,%edx
+     74a:	89 de                	mov    %ebx,%esi
+     74c:	89 cb                	mov    %ecx,%ebx
+     74e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+     750:	0f be cb             	movsbl %bl,%ecx
+     753:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     756:	85 d2                	test   %edx,%edx
+     758:	75 4e                	jne    7a8 <vfprintf+0x78>
+      if(c == '%'){
+     75a:	83 f8 25             	cmp    $0x25,%eax
+     75d:	74 69                	je     7c8 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+     75f:	8b 47 08             	mov    0x8(%edi),%eax
+     762:	3d 00 02 00 00       	cmp    $0x200,%eax
+     767:	0f 84 73 01 00 00    	je     8e0 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+     76d:	8d 48 01             	lea    0x1(%eax),%ecx
+     770:	89 4f 08             	mov    %ecx,0x8(%edi)
+     773:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+     777:	80 fb 0a             	cmp    $0xa,%bl
+     77a:	74 1c                	je     798 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+     77c:	31 d2                	xor    %edx,%edx
+     77e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+     780:	0f b6 1e             	movzbl (%esi),%ebx
+     783:	83 c6 01             	add    $0x1,%esi
+     786:	84 db                	test   %bl,%bl
+     788:	75 c6                	jne    750 <vfprintf+0x20>
+    }
+  }
+}
+     78a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     78d:	5b                   	pop    %ebx
+     78e:	5e                   	pop    %esi
+     78f:	5f                   	pop    %edi
+     790:	5d                   	pop    %ebp
+     791:	c3                   	ret
+     792:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+     798:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+     79f:	eb df                	jmp    780 <vfprintf+0x50>
+     7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+     7a8:	83 fa 25             	cmp    $0x25,%edx
+     7ab:	75 d3                	jne    780 <vfprintf+0x50>
+      if(c == 'd'){
+     7ad:	83 f8 25             	cmp    $0x25,%eax
+     7b0:	74 37                	je     7e9 <vfprintf+0xb9>
+     7b2:	83 e8 63             	sub    $0x63,%eax
+     7b5:	83 f8 15             	cmp    $0x15,%eax
+     7b8:	77 16                	ja     7d0 <vfprintf+0xa0>
+     7ba:	ff 24 85 f8 11 00 00 	jmp    *0x11f8(,%eax,4)
+     7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+     7c8:	ba 25 00 00 00       	mov    $0x25,%edx
+     7cd:	eb b1                	jmp    780 <vfprintf+0x50>
+     7cf:	90                   	nop
+  if(f->n == BUFSIZ)
+     7d0:	8b 47 08             	mov    0x8(%edi),%eax
+     7d3:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7d8:	0f 84 4c 01 00 00    	je     92a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+     7de:	8d 50 01             	lea    0x1(%eax),%edx
+     7e1:	89 57 08             	mov    %edx,0x8(%edi)
+     7e4:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+     7e9:	89 ca                	mov    %ecx,%edx
+     7eb:	89 f8                	mov    %edi,%eax
+     7ed:	e8 de fe ff ff       	call   6d0 <bputc>
+     7f2:	eb 88                	jmp    77c <vfprintf+0x4c>
+     7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+     7f8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     7fb:	83 ec 0c             	sub    $0xc,%esp
+     7fe:	b9 10 00 00 00       	mov    $0x10,%ecx
+     803:	8b 13                	mov    (%ebx),%edx
+     805:	6a 00                	push   $0x0
+     807:	89 f8                	mov    %edi,%eax
+        ap++;
+     809:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+     80c:	e8 cf fd ff ff       	call   5e0 <printint>
+        ap++;
+     811:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+     814:	83 c4 10             	add    $0x10,%esp
+     817:	e9 60 ff ff ff       	jmp    77c <vfprintf+0x4c>
+     81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+     820:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     823:	8b 10                	mov    (%eax),%edx
+        ap++;
+     825:	83 c0 04             	add    $0x4,%eax
+     828:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     82b:	85 d2                	test   %edx,%edx
+     82d:	0f 84 dd 00 00 00    	je     910 <vfprintf+0x1e0>
+        while(*s != 0){
+     833:	0f b6 1a             	movzbl (%edx),%ebx
+     836:	84 db                	test   %bl,%bl
+     838:	0f 84 3e ff ff ff    	je     77c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     83e:	8d 4f 10             	lea    0x10(%edi),%ecx
+     841:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+     844:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     847:	89 fe                	mov    %edi,%esi
+     849:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     84c:	89 d7                	mov    %edx,%edi
+     84e:	eb 27                	jmp    877 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+     850:	89 c1                	mov    %eax,%ecx
+     852:	83 c0 01             	add    $0x1,%eax
+     855:	89 46 08             	mov    %eax,0x8(%esi)
+     858:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     85c:	80 fb 0a             	cmp    $0xa,%bl
+     85f:	75 07                	jne    868 <vfprintf+0x138>
+    f->nl = 1;
+     861:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+     868:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+     86c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+     86f:	84 db                	test   %bl,%bl
+     871:	0f 84 a9 00 00 00    	je     920 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+     877:	3d 00 02 00 00       	cmp    $0x200,%eax
+     87c:	75 d2                	jne    850 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     87e:	83 ec 04             	sub    $0x4,%esp
+     881:	68 00 02 00 00       	push   $0x200
+     886:	ff 75 e0             	push   -0x20(%ebp)
+     889:	ff 36                	push   (%esi)
+     88b:	e8 f6 fb ff ff       	call   486 <write>
+  return r;
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	b8 01 00 00 00       	mov    $0x1,%eax
+     898:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     89a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     8a1:	eb b2                	jmp    855 <vfprintf+0x125>
+     8a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8a7:	90                   	nop
+        printint(f, *ap, 10, 1);
+     8a8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     8ab:	83 ec 0c             	sub    $0xc,%esp
+     8ae:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     8b3:	8b 13                	mov    (%ebx),%edx
+     8b5:	6a 01                	push   $0x1
+     8b7:	e9 4b ff ff ff       	jmp    807 <vfprintf+0xd7>
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+     8c0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     8c3:	89 f8                	mov    %edi,%eax
+     8c5:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+     8c8:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+     8cb:	e8 00 fe ff ff       	call   6d0 <bputc>
+        ap++;
+     8d0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+     8d3:	31 d2                	xor    %edx,%edx
+     8d5:	e9 a6 fe ff ff       	jmp    780 <vfprintf+0x50>
+     8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     8e0:	83 ec 04             	sub    $0x4,%esp
+     8e3:	8d 47 10             	lea    0x10(%edi),%eax
+     8e6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     8e9:	68 00 02 00 00       	push   $0x200
+     8ee:	50                   	push   %eax
+     8ef:	ff 37                	push   (%edi)
+     8f1:	e8 90 fb ff ff       	call   486 <write>
+  return r;
+     8f6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     8f9:	83 c4 10             	add    $0x10,%esp
+     8fc:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+     8fe:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+     905:	b9 01 00 00 00       	mov    $0x1,%ecx
+     90a:	e9 61 fe ff ff       	jmp    770 <vfprintf+0x40>
+     90f:	90                   	nop
+          s = "(null)";
+     910:	ba f0 11 00 00       	mov    $0x11f0,%edx
+     915:	bb 28 00 00 00       	mov    $0x28,%ebx
+     91a:	e9 1f ff ff ff       	jmp    83e <vfprintf+0x10e>
+     91f:	90                   	nop
+     920:	89 f7                	mov    %esi,%edi
+     922:	8b 75 dc             	mov    -0x24(%ebp),%esi
+     925:	e9 52 fe ff ff       	jmp    77c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     92a:	83 ec 04             	sub    $0x4,%esp
+     92d:	8d 47 10             	lea    0x10(%edi),%eax
+     930:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     933:	68 00 02 00 00       	push   $0x200
+     938:	50                   	push   %eax
+     939:	ff 37                	push   (%edi)
+     93b:	e8 46 fb ff ff       	call   486 <write>
+  return r;
+     940:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     943:	83 c4 10             	add    $0x10,%esp
+     946:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+     94b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+     952:	31 c0                	xor    %eax,%eax
+     954:	e9 88 fe ff ff       	jmp    7e1 <vfprintf+0xb1>
+     959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <fdopen>:
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	56                   	push   %esi
+     964:	53                   	push   %ebx
+     965:	83 ec 20             	sub    $0x20,%esp
+     968:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+     96b:	83 fe 0f             	cmp    $0xf,%esi
+     96e:	0f 87 84 00 00 00    	ja     9f8 <fdopen+0x98>
+  if(streams[fd])
+     974:	8b 1c b5 00 2a 00 00 	mov    0x2a00(,%esi,4),%ebx
+     97b:	85 db                	test   %ebx,%ebx
+     97d:	74 11                	je     990 <fdopen+0x30>
+}
+     97f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     982:	89 d8                	mov    %ebx,%eax
+     984:	5b                   	pop    %ebx
+     985:	5e                   	pop    %esi
+     986:	5d                   	pop    %ebp
+     987:	c3                   	ret
+     988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+     990:	83 ec 0c             	sub    $0xc,%esp
+     993:	68 10 02 00 00       	push   $0x210
+     998:	e8 e3 05 00 00       	call   f80 <malloc>
+     99d:	83 c4 10             	add    $0x10,%esp
+     9a0:	89 c3                	mov    %eax,%ebx
+     9a2:	85 c0                	test   %eax,%eax
+     9a4:	74 52                	je     9f8 <fdopen+0x98>
+  f->fd = fd;
+     9a6:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+     9a8:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+     9ab:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+     9b2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+     9b9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+     9c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     9c3:	50                   	push   %eax
+     9c4:	56                   	push   %esi
+     9c5:	e8 f4 fa ff ff       	call   4be <fstat>
+     9ca:	83 c4 10             	add    $0x10,%esp
+     9cd:	85 c0                	test   %eax,%eax
+     9cf:	75 07                	jne    9d8 <fdopen+0x78>
+     9d1:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+     9d6:	74 30                	je     a08 <fdopen+0xa8>
+  streams[fd] = f;
+     9d8:	89 1c b5 00 2a 00 00 	mov    %ebx,0x2a00(,%esi,4)
+}
+     9df:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+     9e1:	c7 05 e0 29 00 00 80 	movl   $0x580,0x29e0
+     9e8:	05 00 00 
+}
+     9eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9ee:	5b                   	pop    %ebx
+     9ef:	5e                   	pop    %esi
+     9f0:	5d                   	pop    %ebp
+     9f1:	c3                   	ret
+     9f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     9f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+     9fb:	31 db                	xor    %ebx,%ebx
+}
+     9fd:	89 d8                	mov    %ebx,%eax
+     9ff:	5b                   	pop    %ebx
+     a00:	5e                   	pop    %esi
+     a01:	5d                   	pop    %ebp
+     a02:	c3                   	ret
+     a03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a07:	90                   	nop
+    f->mode = _IOLBF;
+     a08:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+     a0f:	eb c7                	jmp    9d8 <fdopen+0x78>
+     a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1f:	90                   	nop
+
+00000a20 <fopen>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	53                   	push   %ebx
+     a24:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+     a27:	ff 75 0c             	push   0xc(%ebp)
+     a2a:	ff 75 08             	push   0x8(%ebp)
+     a2d:	e8 74 fa ff ff       	call   4a6 <open>
+     a32:	83 c4 10             	add    $0x10,%esp
+     a35:	85 c0                	test   %eax,%eax
+     a37:	78 37                	js     a70 <fopen+0x50>
+     a39:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+     a3b:	8b 04 85 00 2a 00 00 	mov    0x2a00(,%eax,4),%eax
+     a42:	85 c0                	test   %eax,%eax
+     a44:	74 17                	je     a5d <fopen+0x3d>
+    free(streams[fd]);
+     a46:	83 ec 0c             	sub    $0xc,%esp
+     a49:	50                   	push   %eax
+     a4a:	e8 a1 04 00 00       	call   ef0 <free>
+    streams[fd] = 0;
+     a4f:	83 c4 10             	add    $0x10,%esp
+     a52:	c7 04 9d 00 2a 00 00 	movl   $0x0,0x2a00(,%ebx,4)
+     a59:	00 00 00 00 
+  return fdopen(fd);
+     a5d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a63:	c9                   	leave
+  return fdopen(fd);
+     a64:	e9 f7 fe ff ff       	jmp    960 <fdopen>
+     a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+     a70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a73:	31 c0                	xor    %eax,%eax
+     a75:	c9                   	leave
+     a76:	c3                   	ret
+     a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7e:	66 90                	xchg   %ax,%ax
+
+00000a80 <setvbuf>:
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	56                   	push   %esi
+     a84:	53                   	push   %ebx
+     a85:	8b 75 0c             	mov    0xc(%ebp),%esi
+     a88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+     a8b:	83 fe 02             	cmp    $0x2,%esi
+     a8e:	77 38                	ja     ac8 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     a90:	8b 43 08             	mov    0x8(%ebx),%eax
+     a93:	85 c0                	test   %eax,%eax
+     a95:	7e 12                	jle    aa9 <setvbuf+0x29>
+     a97:	83 ec 04             	sub    $0x4,%esp
+     a9a:	50                   	push   %eax
+     a9b:	8d 43 10             	lea    0x10(%ebx),%eax
+     a9e:	50                   	push   %eax
+     a9f:	ff 33                	push   (%ebx)
+     aa1:	e8 e0 f9 ff ff       	call   486 <write>
+     aa6:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+     aa9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+     ab0:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+     ab2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+     ab9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+     abc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     abf:	5b                   	pop    %ebx
+     ac0:	5e                   	pop    %esi
+     ac1:	5d                   	pop    %ebp
+     ac2:	c3                   	ret
+     ac3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ac7:	90                   	nop
+    return -1;
+     ac8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     acd:	eb ed                	jmp    abc <setvbuf+0x3c>
+     acf:	90                   	nop
+
+00000ad0 <fflush>:
+{
+     ad0:	55                   	push   %ebp
+     ad1:	31 c0                	xor    %eax,%eax
+     ad3:	89 e5                	mov    %esp,%ebp
+     ad5:	53                   	push   %ebx
+     ad6:	83 ec 04             	sub    $0x4,%esp
+     ad9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     adc:	8b 53 08             	mov    0x8(%ebx),%edx
+     adf:	85 d2                	test   %edx,%edx
+     ae1:	7e 1d                	jle    b00 <fflush+0x30>
+     ae3:	83 ec 04             	sub    $0x4,%esp
+     ae6:	8d 43 10             	lea    0x10(%ebx),%eax
+     ae9:	52                   	push   %edx
+     aea:	50                   	push   %eax
+     aeb:	ff 33                	push   (%ebx)
+     aed:	e8 94 f9 ff ff       	call   486 <write>
+     af2:	83 c4 10             	add    $0x10,%esp
+     af5:	39 43 08             	cmp    %eax,0x8(%ebx)
+     af8:	0f 95 c0             	setne  %al
+     afb:	0f b6 c0             	movzbl %al,%eax
+     afe:	f7 d8                	neg    %eax
+  f->n = 0;
+     b00:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     b07:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     b0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b11:	c9                   	leave
+     b12:	c3                   	ret
+     b13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b20 <fclose>:
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	56                   	push   %esi
+     b24:	31 f6                	xor    %esi,%esi
+     b26:	53                   	push   %ebx
+     b27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     b2a:	8b 43 08             	mov    0x8(%ebx),%eax
+     b2d:	85 c0                	test   %eax,%eax
+     b2f:	7e 1f                	jle    b50 <fclose+0x30>
+     b31:	83 ec 04             	sub    $0x4,%esp
+     b34:	50                   	push   %eax
+     b35:	8d 43 10             	lea    0x10(%ebx),%eax
+     b38:	50                   	push   %eax
+     b39:	ff 33                	push   (%ebx)
+     b3b:	e8 46 f9 ff ff       	call   486 <write>
+     b40:	83 c4 10             	add    $0x10,%esp
+     b43:	39 43 08             	cmp    %eax,0x8(%ebx)
+     b46:	0f 95 c0             	setne  %al
+     b49:	0f b6 c0             	movzbl %al,%eax
+     b4c:	f7 d8                	neg    %eax
+     b4e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+     b50:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+     b53:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     b5a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+     b61:	ff 33                	push   (%ebx)
+     b63:	e8 26 f9 ff ff       	call   48e <close>
+     b68:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+     b6b:	85 c0                	test   %eax,%eax
+     b6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b72:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+     b75:	8b 03                	mov    (%ebx),%eax
+     b77:	83 f8 0f             	cmp    $0xf,%eax
+     b7a:	77 09                	ja     b85 <fclose+0x65>
+     b7c:	39 1c 85 00 2a 00 00 	cmp    %ebx,0x2a00(,%eax,4)
+     b83:	74 0b                	je     b90 <fclose+0x70>
+}
+     b85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b88:	89 f0                	mov    %esi,%eax
+     b8a:	5b                   	pop    %ebx
+     b8b:	5e                   	pop    %esi
+     b8c:	5d                   	pop    %ebp
+     b8d:	c3                   	ret
+     b8e:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+     b90:	c7 04 85 00 2a 00 00 	movl   $0x0,0x2a00(,%eax,4)
+     b97:	00 00 00 00 
+    free(f);
+     b9b:	83 ec 0c             	sub    $0xc,%esp
+     b9e:	53                   	push   %ebx
+     b9f:	e8 4c 03 00 00       	call   ef0 <free>
+     ba4:	83 c4 10             	add    $0x10,%esp
+  return r;
+     ba7:	eb dc                	jmp    b85 <fclose+0x65>
+     ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bb0 <fputc>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	53                   	push   %ebx
+     bb4:	83 ec 04             	sub    $0x4,%esp
+     bb7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     bba:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+     bbd:	8b 43 08             	mov    0x8(%ebx),%eax
+     bc0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     bc5:	74 59                	je     c20 <fputc+0x70>
+  f->buf[f->n++] = c;
+     bc7:	8d 48 01             	lea    0x1(%eax),%ecx
+     bca:	89 4b 08             	mov    %ecx,0x8(%ebx)
+     bcd:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+     bd1:	80 fa 0a             	cmp    $0xa,%dl
+     bd4:	75 07                	jne    bdd <fputc+0x2d>
+    f->nl = 1;
+     bd6:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     bdd:	8b 43 04             	mov    0x4(%ebx),%eax
+     be0:	83 f8 02             	cmp    $0x2,%eax
+     be3:	74 1a                	je     bff <fputc+0x4f>
+     be5:	83 f8 01             	cmp    $0x1,%eax
+     be8:	74 0e                	je     bf8 <fputc+0x48>
+}
+     bea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+     bed:	0f b6 c2             	movzbl %dl,%eax
+}
+     bf0:	c9                   	leave
+     bf1:	c3                   	ret
+     bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     bf8:	8b 43 0c             	mov    0xc(%ebx),%eax
+     bfb:	85 c0                	test   %eax,%eax
+     bfd:	74 eb                	je     bea <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     bff:	85 c9                	test   %ecx,%ecx
+     c01:	7f 4d                	jg     c50 <fputc+0xa0>
+  f->n = 0;
+     c03:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     c0a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     c11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+     c14:	0f b6 c2             	movzbl %dl,%eax
+}
+     c17:	c9                   	leave
+     c18:	c3                   	ret
+     c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	8d 43 10             	lea    0x10(%ebx),%eax
+     c26:	89 55 08             	mov    %edx,0x8(%ebp)
+     c29:	68 00 02 00 00       	push   $0x200
+     c2e:	50                   	push   %eax
+     c2f:	ff 33                	push   (%ebx)
+     c31:	e8 50 f8 ff ff       	call   486 <write>
+  return r;
+     c36:	8b 55 08             	mov    0x8(%ebp),%edx
+     c39:	83 c4 10             	add    $0x10,%esp
+     c3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+     c41:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     c48:	31 c0                	xor    %eax,%eax
+     c4a:	e9 7b ff ff ff       	jmp    bca <fputc+0x1a>
+     c4f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     c50:	83 ec 04             	sub    $0x4,%esp
+     c53:	8d 43 10             	lea    0x10(%ebx),%eax
+     c56:	89 55 08             	mov    %edx,0x8(%ebp)
+     c59:	51                   	push   %ecx
+     c5a:	50                   	push   %eax
+     c5b:	ff 33                	push   (%ebx)
+     c5d:	e8 24 f8 ff ff       	call   486 <write>
+  f->n = 0;
+     c62:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+     c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+     c6c:	83 c4 10             	add    $0x10,%esp
+     c6f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     c76:	eb 99                	jmp    c11 <fputc+0x61>
+     c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <fwrite>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+     c85:	53                   	push   %ebx
+     c86:	83 ec 1c             	sub    $0x1c,%esp
+     c89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+     c8c:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+     c8f:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+     c92:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+     c95:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+     c9b:	0f 8f af 00 00 00    	jg     d50 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+     ca1:	85 ff                	test   %edi,%edi
+     ca3:	7e 73                	jle    d18 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     ca5:	8d 56 10             	lea    0x10(%esi),%edx
+     ca8:	8b 46 08             	mov    0x8(%esi),%eax
+     cab:	31 db                	xor    %ebx,%ebx
+     cad:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     cb0:	eb 25                	jmp    cd7 <fwrite+0x57>
+     cb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+     cb8:	89 c1                	mov    %eax,%ecx
+     cba:	83 c0 01             	add    $0x1,%eax
+     cbd:	89 46 08             	mov    %eax,0x8(%esi)
+     cc0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+     cc4:	80 fa 0a             	cmp    $0xa,%dl
+     cc7:	75 07                	jne    cd0 <fwrite+0x50>
+    f->nl = 1;
+     cc9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+     cd0:	83 c3 01             	add    $0x1,%ebx
+     cd3:	39 df                	cmp    %ebx,%edi
+     cd5:	7e 41                	jle    d18 <fwrite+0x98>
+    bputc(f, s[i]);
+     cd7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     cda:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+     cde:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ce3:	75 d3                	jne    cb8 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     ce5:	83 ec 04             	sub    $0x4,%esp
+     ce8:	88 55 e7             	mov    %dl,-0x19(%ebp)
+     ceb:	68 00 02 00 00       	push   $0x200
+     cf0:	ff 75 e0             	push   -0x20(%ebp)
+     cf3:	ff 36                	push   (%esi)
+     cf5:	e8 8c f7 ff ff       	call   486 <write>
+  return r;
+     cfa:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+     cfe:	83 c4 10             	add    $0x10,%esp
+     d01:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+     d03:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     d0a:	b8 01 00 00 00       	mov    $0x1,%eax
+     d0f:	eb ac                	jmp    cbd <fwrite+0x3d>
+     d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     d18:	8b 46 04             	mov    0x4(%esi),%eax
+     d1b:	83 f8 02             	cmp    $0x2,%eax
+     d1e:	74 0c                	je     d2c <fwrite+0xac>
+     d20:	83 f8 01             	cmp    $0x1,%eax
+     d23:	75 1c                	jne    d41 <fwrite+0xc1>
+     d25:	8b 46 0c             	mov    0xc(%esi),%eax
+     d28:	85 c0                	test   %eax,%eax
+     d2a:	74 15                	je     d41 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d2c:	8b 46 08             	mov    0x8(%esi),%eax
+     d2f:	85 c0                	test   %eax,%eax
+     d31:	7f 5d                	jg     d90 <fwrite+0x110>
+  f->n = 0;
+     d33:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     d3a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+     d41:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+     d44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d47:	5b                   	pop    %ebx
+     d48:	5e                   	pop    %esi
+     d49:	5f                   	pop    %edi
+     d4a:	5d                   	pop    %ebp
+     d4b:	c3                   	ret
+     d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+     d50:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+     d54:	0f 84 4b ff ff ff    	je     ca5 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d5a:	8b 46 08             	mov    0x8(%esi),%eax
+     d5d:	8b 16                	mov    (%esi),%edx
+     d5f:	85 c0                	test   %eax,%eax
+     d61:	7f 45                	jg     da8 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+     d63:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+     d66:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     d6d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+     d74:	57                   	push   %edi
+     d75:	ff 75 08             	push   0x8(%ebp)
+     d78:	ff 36                	push   (%esi)
+     d7a:	e8 07 f7 ff ff       	call   486 <write>
+    return size > 0 ? i / size : 0;
+     d7f:	83 c4 10             	add    $0x10,%esp
+     d82:	85 c0                	test   %eax,%eax
+     d84:	78 4a                	js     dd0 <fwrite+0x150>
+     d86:	85 db                	test   %ebx,%ebx
+     d88:	7e 46                	jle    dd0 <fwrite+0x150>
+     d8a:	99                   	cltd
+     d8b:	f7 fb                	idiv   %ebx
+     d8d:	eb b5                	jmp    d44 <fwrite+0xc4>
+     d8f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     d90:	83 ec 04             	sub    $0x4,%esp
+     d93:	50                   	push   %eax
+     d94:	8d 46 10             	lea    0x10(%esi),%eax
+     d97:	50                   	push   %eax
+     d98:	ff 36                	push   (%esi)
+     d9a:	e8 e7 f6 ff ff       	call   486 <write>
+     d9f:	83 c4 10             	add    $0x10,%esp
+     da2:	eb 8f                	jmp    d33 <fwrite+0xb3>
+     da4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     da8:	83 ec 04             	sub    $0x4,%esp
+     dab:	50                   	push   %eax
+     dac:	8d 46 10             	lea    0x10(%esi),%eax
+     daf:	50                   	push   %eax
+     db0:	52                   	push   %edx
+     db1:	e8 d0 f6 ff ff       	call   486 <write>
+     db6:	83 c4 10             	add    $0x10,%esp
+     db9:	3b 46 08             	cmp    0x8(%esi),%eax
+     dbc:	74 a5                	je     d63 <fwrite+0xe3>
+  f->n = 0;
+     dbe:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+     dc5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+     dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+     dd0:	31 c0                	xor    %eax,%eax
+     dd2:	e9 6d ff ff ff       	jmp    d44 <fwrite+0xc4>
+     dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dde:	66 90                	xchg   %ax,%ax
+
+00000de0 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     de4:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+     de7:	83 ec 04             	sub    $0x4,%esp
+     dea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     ded:	8b 55 0c             	mov    0xc(%ebp),%edx
+     df0:	89 d8                	mov    %ebx,%eax
+     df2:	e8 39 f9 ff ff       	call   730 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     df7:	8b 43 04             	mov    0x4(%ebx),%eax
+     dfa:	83 f8 02             	cmp    $0x2,%eax
+     dfd:	74 18                	je     e17 <fprintf+0x37>
+     dff:	83 f8 01             	cmp    $0x1,%eax
+     e02:	74 0c                	je     e10 <fprintf+0x30>
+  settle(f);
+}
+     e04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e07:	c9                   	leave
+     e08:	c3                   	ret
+     e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+     e10:	8b 43 0c             	mov    0xc(%ebx),%eax
+     e13:	85 c0                	test   %eax,%eax
+     e15:	74 ed                	je     e04 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e17:	8b 43 08             	mov    0x8(%ebx),%eax
+     e1a:	85 c0                	test   %eax,%eax
+     e1c:	7f 1a                	jg     e38 <fprintf+0x58>
+  f->n = 0;
+     e1e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     e25:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     e2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e2f:	c9                   	leave
+     e30:	c3                   	ret
+     e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e38:	83 ec 04             	sub    $0x4,%esp
+     e3b:	50                   	push   %eax
+     e3c:	8d 43 10             	lea    0x10(%ebx),%eax
+     e3f:	50                   	push   %eax
+     e40:	ff 33                	push   (%ebx)
+     e42:	e8 3f f6 ff ff       	call   486 <write>
+  f->n = 0;
+     e47:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+     e4e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+     e51:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+     e58:	eb d2                	jmp    e2c <fprintf+0x4c>
+     e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e60 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	53                   	push   %ebx
+     e64:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+     e6d:	83 f8 0f             	cmp    $0xf,%eax
+     e70:	77 4e                	ja     ec0 <printf+0x60>
+     e72:	8b 1c 85 00 2a 00 00 	mov    0x2a00(,%eax,4),%ebx
+     e79:	85 db                	test   %ebx,%ebx
+     e7b:	74 43                	je     ec0 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+     e7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+     e80:	89 d8                	mov    %ebx,%eax
+     e82:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e85:	e8 a6 f8 ff ff       	call   730 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+     e8a:	8b 43 08             	mov    0x8(%ebx),%eax
+     e8d:	85 c0                	test   %eax,%eax
+     e8f:	7e 12                	jle    ea3 <printf+0x43>
+     e91:	83 ec 04             	sub    $0x4,%esp
+     e94:	50                   	push   %eax
+     e95:	8d 43 10             	lea    0x10(%ebx),%eax
+     e98:	50                   	push   %eax
+     e99:	ff 33                	push   (%ebx)
+     e9b:	e8 e6 f5 ff ff       	call   486 <write>
+     ea0:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+     ea3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+     eaa:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+     eb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eb4:	c9                   	leave
+     eb5:	c3                   	ret
+     eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+     ec0:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+     ec6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+     ecc:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+     ed3:	00 00 00 
+    f->n = 0;
+     ed6:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+     edd:	00 00 00 
+    f->nl = 0;
+     ee0:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+     ee7:	00 00 00 
+     eea:	eb 91                	jmp    e7d <printf+0x1d>
+     eec:	66 90                	xchg   %ax,%ax
+     eee:	66 90                	xchg   %ax,%ax
+
+00000ef0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ef0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ef1:	a1 40 2a 00 00       	mov    0x2a40,%eax
+{
+     ef6:	89 e5                	mov    %esp,%ebp
+     ef8:	57                   	push   %edi
+     ef9:	56                   	push   %esi
+     efa:	53                   	push   %ebx
+     efb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     efe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f0c:	39 ca                	cmp    %ecx,%edx
+     f0e:	73 30                	jae    f40 <free+0x50>
+     f10:	39 c1                	cmp    %eax,%ecx
+     f12:	72 04                	jb     f18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f14:	39 c2                	cmp    %eax,%edx
+     f16:	72 f0                	jb     f08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f1e:	39 f8                	cmp    %edi,%eax
+     f20:	74 2e                	je     f50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f25:	8b 42 04             	mov    0x4(%edx),%eax
+     f28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f2b:	39 f1                	cmp    %esi,%ecx
+     f2d:	74 38                	je     f67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f31:	5b                   	pop    %ebx
+  freep = p;
+     f32:	89 15 40 2a 00 00    	mov    %edx,0x2a40
+}
+     f38:	5e                   	pop    %esi
+     f39:	5f                   	pop    %edi
+     f3a:	5d                   	pop    %ebp
+     f3b:	c3                   	ret
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f40:	39 c1                	cmp    %eax,%ecx
+     f42:	72 d0                	jb     f14 <free+0x24>
+     f44:	eb c2                	jmp    f08 <free+0x18>
+     f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f50:	03 70 04             	add    0x4(%eax),%esi
+     f53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f56:	8b 02                	mov    (%edx),%eax
+     f58:	8b 00                	mov    (%eax),%eax
+     f5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f5d:	8b 42 04             	mov    0x4(%edx),%eax
+     f60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f63:	39 f1                	cmp    %esi,%ecx
+     f65:	75 c8                	jne    f2f <free+0x3f>
+    p->s.size += bp->s.size;
+     f67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f6a:	89 15 40 2a 00 00    	mov    %edx,0x2a40
+    p->s.size += bp->s.size;
+     f70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f76:	89 0a                	mov    %ecx,(%edx)
+}
+     f78:	5b                   	pop    %ebx
+     f79:	5e                   	pop    %esi
+     f7a:	5f                   	pop    %edi
+     f7b:	5d                   	pop    %ebp
+     f7c:	c3                   	ret
+     f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+     f85:	53                   	push   %ebx
+     f86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f8c:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f92:	8d 78 07             	lea    0x7(%eax),%edi
+     f95:	c1 ef 03             	shr    $0x3,%edi
+     f98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f9b:	85 d2                	test   %edx,%edx
+     f9d:	0f 84 8d 00 00 00    	je     1030 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fa3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fa5:	8b 48 04             	mov    0x4(%eax),%ecx
+     fa8:	39 f9                	cmp    %edi,%ecx
+     faa:	73 64                	jae    1010 <malloc+0x90>
+  if(nu < 4096)
+     fac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     fb1:	39 df                	cmp    %ebx,%edi
+     fb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     fb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     fbd:	eb 0a                	jmp    fc9 <malloc+0x49>
+     fbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fc2:	8b 48 04             	mov    0x4(%eax),%ecx
+     fc5:	39 f9                	cmp    %edi,%ecx
+     fc7:	73 47                	jae    1010 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fc9:	89 c2                	mov    %eax,%edx
+     fcb:	39 05 40 2a 00 00    	cmp    %eax,0x2a40
+     fd1:	75 ed                	jne    fc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     fd3:	83 ec 0c             	sub    $0xc,%esp
+     fd6:	56                   	push   %esi
+     fd7:	e8 12 f5 ff ff       	call   4ee <sbrk>
+  if(p == (char*)-1)
+     fdc:	83 c4 10             	add    $0x10,%esp
+     fdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fe2:	74 1c                	je     1000 <malloc+0x80>
+  hp->s.size = nu;
+     fe4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     fe7:	83 ec 0c             	sub    $0xc,%esp
+     fea:	83 c0 08             	add    $0x8,%eax
+     fed:	50                   	push   %eax
+     fee:	e8 fd fe ff ff       	call   ef0 <free>
+  return freep;
+     ff3:	8b 15 40 2a 00 00    	mov    0x2a40,%edx
+      if((p = morecore(nunits)) == 0)
+     ff9:	83 c4 10             	add    $0x10,%esp
+     ffc:	85 d2                	test   %edx,%edx
+     ffe:	75 c0                	jne    fc0 <malloc+0x40>
+        return 0;
+  }
+}
+    1000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1003:	31 c0                	xor    %eax,%eax
+}
+    1005:	5b                   	pop    %ebx
+    1006:	5e                   	pop    %esi
+    1007:	5f                   	pop    %edi
+    1008:	5d                   	pop    %ebp
+    1009:	c3                   	ret
+    100a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1010:	39 cf                	cmp    %ecx,%edi
+    1012:	74 4c                	je     1060 <malloc+0xe0>
+        p->s.size -= nunits;
+    1014:	29 f9                	sub    %edi,%ecx
+    1016:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1019:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    101c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    101f:	89 15 40 2a 00 00    	mov    %edx,0x2a40
+}
+    1025:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1028:	83 c0 08             	add    $0x8,%eax
+}
+    102b:	5b                   	pop    %ebx
+    102c:	5e                   	pop    %esi
+    102d:	5f                   	pop    %edi
+    102e:	5d                   	pop    %ebp
+    102f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1030:	c7 05 40 2a 00 00 44 	movl   $0x2a44,0x2a40
+    1037:	2a 00 00 
+    base.s.size = 0;
+    103a:	b8 44 2a 00 00       	mov    $0x2a44,%eax
+    base.s.ptr = freep = prevp = &base;
+    103f:	c7 05 44 2a 00 00 44 	movl   $0x2a44,0x2a44
+    1046:	2a 00 00 
+    base.s.size = 0;
+    1049:	c7 05 48 2a 00 00 00 	movl   $0x0,0x2a48
+    1050:	00 00 00 
+    if(p->s.size >= nunits){
+    1053:	e9 54 ff ff ff       	jmp    fac <malloc+0x2c>
+    1058:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1060:	8b 08                	mov    (%eax),%ecx
+    1062:	89 0a                	mov    %ecx,(%edx)
+    1064:	eb b9                	jmp    101f <malloc+0x9f>
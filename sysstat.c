@@ -0,0 +1,115 @@
+// sysstat: print how many TSC cycles system calls take,
+// for all CPUs or for the one given.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+
+#define BARLEN 40
+
+char *names[NSYSCALL] = {
+[SYS_fork]    "fork",
+[SYS_exit]    "exit",
+[SYS_wait]    "wait",
+[SYS_pipe]    "pipe",
+[SYS_read]    "read",
+[SYS_kill]    "kill",
+[SYS_exec]    "exec",
+[SYS_fstat]   "fstat",
+[SYS_chdir]   "chdir",
+[SYS_dup]     "dup",
+[SYS_getpid]  "getpid",
+[SYS_sbrk]    "sbrk",
+[SYS_sleep]   "sleep",
+[SYS_uptime]  "uptime",
+[SYS_open]    "open",
+[SYS_write]   "write",
+[SYS_mknod]   "mknod",
+[SYS_unlink]  "unlink",
+[SYS_link]    "link",
+[SYS_mkdir]   "mkdir",
+[SYS_close]   "close",
+[SYS_sigprocmask]   "sigprocmask",
+[SYS_sigaction]   "sigaction",
+[SYS_sigret]  "sigret",
+[SYS_readv]   "readv",
+[SYS_writev]  "writev",
+[SYS_nanosleep] "nanosleep",
+[SYS_setpriority] "setpriority",
+[SYS_sched_setattr] "sched_setattr",
+[SYS_sched_yield] "sched_yield",
+[SYS_sched_setaffinity] "sched_setaffinity",
+[SYS_sched_getaffinity] "sched_getaffinity",
+[SYS_getrusage] "getrusage",
+[SYS_syslat]  "syslat",
+[SYS_sched_getattr] "sched_getattr",
+};
+
+uint hist[NSYSCALL][NLATBUCKET];
+
+// Print the histogram of one system call, a row per
+// bucket from the first to the last that is not empty,
+// with a bar scaled to the fullest bucket.
+void
+printhist(int num)
+{
+  uint *h, tot, max, half, sum, per;
+  int lo, hi, med, i, n;
+
+  h = hist[num];
+  tot = max = 0;
+  lo = hi = -1;
+  for(i = 0; i < NLATBUCKET; i++){
+    if(h[i] == 0)
+      continue;
+    tot += h[i];
+    if(h[i] > max)
+      max = h[i];
+    if(lo < 0)
+      lo = i;
+    hi = i;
+  }
+  if(tot == 0)
+    return;
+  per = (max + BARLEN - 1) / BARLEN;  // calls per star
+  half = (tot + 1) / 2;
+  sum = 0;
+  for(med = lo; sum + h[med] < half; med++)
+    sum += h[med];
+
+  printf(1, "%s: %d calls, median under 2^%d cycles\n",
+         names[num] ? names[num] : "?", tot, med+1);
+  for(i = lo; i <= hi; i++){
+    printf(1, "  2^%d%s %d ", i, i < 10 ? " " : "", h[i]);
+    for(n = h[i] / per; n > 0; n--)
+      printf(1, "*");
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int cpu, ncpu, i;
+
+  cpu = -1;
+  if(argc > 2){
+    printf(2, "usage: sysstat [cpu]\n");
+    exit();
+  }
+  if(argc == 2)
+    cpu = atoi(argv[1]);
+  if((ncpu = syslat(cpu, (uint*)hist)) < 0){
+    printf(2, "sysstat: no cpu %s\n", argv[1]);
+    exit();
+  }
+
+  if(cpu < 0)
+    printf(1, "all %d cpus\n", ncpu);
+  else
+    printf(1, "cpu %d of %d\n", cpu, ncpu);
+  for(i = 1; i < NSYSCALL; i++)
+    printhist(i);
+  exit();
+}
@@ -0,0 +1,359 @@
+// Clock and per-CPU timers.
+//
+// Time is kept in nanoseconds by the TSC, which timerinit()
+// measures, along with the LAPIC timer's bus clock, against
+// a countdown of the PIT, whose rate is known. The CPUs'
+// TSCs are assumed to run in step.
+//
+// A process sleeps until its p->deadline on the timer wheel
+// of the CPU it slept on. A wheel has NLEVEL levels of WSIZE
+// slots, each a list of processes. Time on a wheel advances
+// in units of 2^USHIFT ns; a slot on level 0 holds the
+// deadlines of one unit, and a slot on level l those of
+// WSIZE^l units. As a wheel's clock reaches the start of a
+// higher level slot, its processes are cascaded down to the
+// levels below, so that each is looked at a few times at
+// most and woken exactly once, when its unit comes up.
+//
+// Each CPU runs its LAPIC timer one-shot, for the next tick
+// or the next thing its wheel has to do while it has
+// processes to run, and only for its wheel while it is idle.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+
+#define WBITS   6
+#define WSIZE   (1<<WBITS)
+#define NLEVEL  4
+#define USHIFT  16            // a wheel unit is 65.5us
+
+#define PITHZ   1193182       // PIT input clock
+#define PITCOUNT (PITHZ/100)  // calibrate over 10ms
+
+struct wheel {
+  struct spinlock lock;
+  uint64 clk;           // next unit to run
+  uint64 armed;         // when the LAPIC timer will go off, in ns
+  int idle;             // armed only for the wheel?
+  uint tick;            // clock tick of the last interrupt
+  int n[NLEVEL];        // processes on each level
+  struct proc *slot[NLEVEL][WSIZE];
+};
+
+static struct wheel wheels[NCPU];
+static uint64 tsc0;     // TSC at boot
+static uint tscmult;    // ns per TSC cycle, times 2^24
+static uint busmult;    // LAPIC bus cycles per ns, times 2^24
+
+// Divide n by d, where the quotient fits in 32 bits.
+static uint
+div64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+  return q;
+}
+
+// Called on the boot CPU before interrupts are enabled.
+void
+timerinit(void)
+{
+  uint tsc, bus, winns;
+  int i;
+
+  for(i = 0; i < NCPU; i++){
+    initlock(&wheels[i].lock, "wheel");
+    wheels[i].idle = 1;
+  }
+
+  // Count TSC cycles and LAPIC bus cycles while PIT
+  // channel 2 counts down PITCOUNT, with its gate on
+  // and the speaker off.
+  outb(0x61, (inb(0x61) & ~0x02) | 0x01);
+  outb(0x43, 0xB0);  // channel 2, lo/hi byte, one-shot
+  outb(0x42, PITCOUNT & 0xFF);
+  outb(0x42, PITCOUNT >> 8);
+  lapictimer(0xffffffff);
+  tsc0 = rdtsc();
+  while((inb(0x61) & 0x20) == 0)
+    ;
+  tsc = rdtsc() - tsc0;
+  bus = 0xffffffff - lapiccount();
+  lapictimer(0);
+
+  winns = div64((uint64)PITCOUNT * 1000000000, PITHZ);
+  tscmult = div64((uint64)winns << 24, tsc);
+  busmult = div64((uint64)bus << 24, winns);
+}
+
+// Nanoseconds since boot.
+uint64
+nsnow(void)
+{
+  uint64 d;
+
+  d = rdtsc() - tsc0;
+  return (((d & 0xffffffff) * tscmult) >> 24) + (((d >> 32) * tscmult) << 8);
+}
+
+// Clock ticks since boot.
+uint
+tickcount(void)
+{
+  return div64(nsnow(), TICKNS);
+}
+
+uint
+nstoms(uint64 ns)
+{
+  return div64(ns, 1000000);
+}
+
+// Arm this CPU's LAPIC timer to go off at ns, if that is
+// in the next few seconds, or for a few seconds from now.
+static void
+lapicarm(struct wheel *w, uint64 ns, uint64 now)
+{
+  uint64 count;
+
+  w->armed = ns;
+  ns = ns > now ? ns - now : 1;
+  if(ns > 4000000000ULL)
+    ns = 4000000000ULL;
+  count = (ns * busmult) >> 24;
+  if(count == 0)
+    count = 1;
+  if(count > 0xffffffff)
+    count = 0xffffffff;
+  lapictimer(count);
+}
+
+//PAGEBREAK!
+static void
+wremove(struct wheel *w, struct proc *p)
+{
+  w->n[(p->tslot - w->slot[0]) / WSIZE]--;
+  if(p->tprev)
+    p->tprev->tnext = p->tnext;
+  else
+    *p->tslot = p->tnext;
+  if(p->tnext)
+    p->tnext->tprev = p->tprev;
+  p->tslot = 0;
+}
+
+// Put p on w, at the lowest level whose slots reach out
+// to its deadline. A deadline beyond the top level waits
+// in its furthest slot, and is put back when that cascades.
+static void
+winsert(struct wheel *w, struct proc *p)
+{
+  uint64 e, d;
+  struct proc **head;
+  int l;
+
+  e = (p->deadline + (1<<USHIFT) - 1) >> USHIFT;
+  if(e < w->clk)
+    e = w->clk;
+  d = e - w->clk;
+  for(l = 0; l < NLEVEL-1 && d >= (1ULL << (WBITS*(l+1))); l++)
+    ;
+  if(d >= (1ULL << (WBITS*NLEVEL)))
+    e = w->clk + (1ULL << (WBITS*NLEVEL)) - 1;
+  head = &w->slot[l][(e >> (WBITS*l)) & (WSIZE-1)];
+  p->tslot = head;
+  p->tprev = 0;
+  p->tnext = *head;
+  if(*head)
+    (*head)->tprev = p;
+  *head = p;
+  w->n[l]++;
+}
+
+// Move the processes in slot i of level l to lower levels.
+static void
+wcascade(struct wheel *w, int l, int i)
+{
+  struct proc *p;
+
+  while((p = w->slot[l][i]) != 0){
+    wremove(w, p);
+    winsert(w, p);
+  }
+}
+
+// Run w's clock up to unit now, waking processes as
+// their units come up.
+static void
+wrun(struct wheel *w, uint64 now)
+{
+  struct proc *p;
+  uint64 m, next;
+  int l;
+
+  while(w->clk <= now){
+    // With the levels below l empty, nothing happens
+    // until level l next cascades.
+    for(l = 0; l < NLEVEL && w->n[l] == 0; l++)
+      ;
+    if(l > 0){
+      if(l == NLEVEL){
+        w->clk = now + 1;
+        break;
+      }
+      m = (1ULL << (WBITS*l)) - 1;
+      next = (w->clk + m) & ~m;
+      if(next > now){
+        w->clk = now + 1;
+        break;
+      }
+      w->clk = next;
+    }
+    for(l = 1; l < NLEVEL && (w->clk & ((1ULL << (WBITS*l)) - 1)) == 0; l++)
+      wcascade(w, l, (w->clk >> (WBITS*l)) & (WSIZE-1));
+    while((p = w->slot[0][w->clk & (WSIZE-1)]) != 0){
+      wremove(w, p);
+      wakeproc(p, &p->deadline);
+    }
+    w->clk++;
+  }
+}
+
+// When w next has something to do, in ns, or 0 if never.
+static uint64
+wnext(struct wheel *w)
+{
+  uint64 base, t, best;
+  int l, d, start;
+
+  best = 0;
+  for(l = 0; l < NLEVEL; l++){
+    if(w->n[l] == 0)
+      continue;
+    // The slot at the clock's index is due now if the
+    // clock is at its start, or else a full turn away.
+    base = w->clk >> (WBITS*l);
+    start = (w->clk & ((1ULL << (WBITS*l)) - 1)) != 0;
+    for(d = start; d < start + WSIZE; d++){
+      if(w->slot[l][(base + d) & (WSIZE-1)]){
+        t = ((base + d) << (WBITS*l)) << USHIFT;
+        if(best == 0 || t < best)
+          best = t;
+        break;
+      }
+    }
+  }
+  return best;
+}
+
+//PAGEBREAK!
+// Timer interrupt: wake the processes whose deadlines
+// have passed on this CPU and arm the LAPIC again.
+// Return whether a clock tick has passed since the last.
+int
+timerintr(void)
+{
+  struct wheel *w;
+  uint64 now, next;
+  uint tick;
+  int r;
+
+  now = nsnow();
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  wrun(w, now >> USHIFT);
+  next = wnext(w);
+  if(next == 0 || next > now + TICKNS)
+    next = now + TICKNS;
+  w->idle = 0;
+  lapicarm(w, next, now);
+  tick = div64(now, TICKNS);
+  r = tick != w->tick;
+  w->tick = tick;
+  release(&w->lock);
+  return r;
+}
+
+// Called by the scheduler with interrupts off when it has
+// nothing to run: arm the LAPIC only for this CPU's wheel,
+// or stop it if the wheel is empty.
+void
+timeridle(void)
+{
+  struct wheel *w;
+  uint64 now, next;
+
+  now = nsnow();
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  wrun(w, now >> USHIFT);
+  w->idle = 1;
+  if((next = wnext(w)) != 0)
+    lapicarm(w, next, now);
+  else
+    lapictimer(0);
+  release(&w->lock);
+}
+
+// Called by the scheduler with interrupts off before it
+// runs a process: restart the tick if idling stopped it.
+void
+timerbusy(void)
+{
+  struct wheel *w;
+  uint64 now, next;
+
+  w = &wheels[cpuid()];
+  if(!w->idle)
+    return;
+  now = nsnow();
+  acquire(&w->lock);
+  next = wnext(w);
+  if(next == 0 || next > now + TICKNS)
+    next = now + TICKNS;
+  w->idle = 0;
+  lapicarm(w, next, now);
+  release(&w->lock);
+}
+
+// Sleep for ns nanoseconds, on this CPU's wheel.
+// Return -1 if killed first, or sent a signal that
+// kill() wakes sleepers for.
+int
+sleepns(uint64 ns)
+{
+  struct proc *p = myproc();
+  struct wheel *w;
+  uint64 now;
+  int r;
+
+  now = nsnow();
+  p->deadline = now + ns;
+  // The deadline must go on the wheel of the CPU we are
+  // on, which is not idle and has its LAPIC armed.
+  pushcli();
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  popcli();
+  winsert(w, p);
+  if(p->deadline < w->armed)
+    lapicarm(w, p->deadline, now);
+  r = 0;
+  while(p->tslot){
+    if(p->killed || sigwakes(p)){
+      wremove(w, p);
+      r = -1;
+      break;
+    }
+    sleep(&p->deadline, &w->lock);
+  }
+  release(&w->lock);
+  return r;
+}
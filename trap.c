@@ -11,8 +11,6 @@
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
-struct spinlock tickslock;
-uint ticks;
 
 void
 tvinit(void)
@@ -22,8 +20,6 @@ tvinit(void)
   for(i = 0; i < 256; i++)
     SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
-
-  initlock(&tickslock, "time");
 }
 
 void
@@ -43,17 +39,30 @@ trap(struct trapframe *tf)
     syscall();
     if(myproc()->killed)
       exit();
+    preempt();
     return;
   }
 
+  if(tf->trapno == T_PGFLT){
+    mycpu()->ru.ru_nfault++;
+    if(myproc())
+      myproc()->ru.ru_nfault++;
+    // A write to a page mapped by a zero-copy read. The kernel
+    // may have been copying out to it holding locks, so return
+    // without preempting.
+    if(myproc() && (tf->err & FEC_WR) &&
+       cowfault(myproc()->pgdir, rcr2()) == 0)
+      return;
+  }
+
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    if(timerintr())
+      schedtick((tf->cs&3) == DPL_USER);
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_RESCHED:
+    mycpu()->resched = 1;
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -100,11 +109,10 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU if the clock tick or
+  // another CPU asked this one to reschedule.
   // If interrupts were on while locks held, would need to check nlock.
-  if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
-    yield();
+  preempt();
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
@@ -1,6 +1,7 @@
 typedef unsigned int   uint;
 typedef unsigned short ushort;
 typedef unsigned char  uchar;
+typedef unsigned long long uint64;
 typedef uint pde_t;
 
 #define null 0
@@ -16,3 +17,15 @@ struct sigaction{
   uint sigmask;
 };
 
+#define RUSAGE_SELF       0
+#define RUSAGE_CHILDREN (-1)  // children that have been waited for
+
+struct rusage {
+  uint ru_utime;     // clock ticks in user mode
+  uint ru_stime;     // clock ticks in the kernel
+  uint ru_nvcsw;     // voluntary context switches
+  uint ru_nivcsw;    // involuntary context switches
+  uint ru_nsyscall;  // system calls
+  uint ru_nfault;    // page faults
+};
+
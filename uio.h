@@ -0,0 +1,7 @@
+// Vectored I/O: one segment of a readv() or writev() buffer.
+struct iovec {
+  void *iov_base;
+  int iov_len;
+};
+
+#define IOVMAX 16  // max segments per readv() or writev()
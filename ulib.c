@@ -104,3 +104,15 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Called by exit() before the process ends, to flush
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+  if(exithook)
+    exithook();
+  _exit();
+}
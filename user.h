@@ -1,10 +1,15 @@
 struct stat;
 struct rtcdate;
+struct timespec;
+struct sched_attr;
+struct rusage;
+struct iovec;
 //struct sigaction;
 
 // system calls
 int fork(void);
 int exit(void) __attribute__((noreturn));
+int _exit(void) __attribute__((noreturn));
 int wait(void);
 int pipe(int*);
 int write(int, const void*, int);
@@ -24,9 +29,20 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int nanosleep(struct timespec*);
+int setpriority(int, int);
+int sched_setattr(int, struct sched_attr*);
+int sched_yield(void);
+int sched_setaffinity(int, uint);
+int sched_getaffinity(int);
+int getrusage(int, struct rusage*);
+int syslat(int, uint*);
+int sched_getattr(int, struct sched_attr*);
 uint sigprocmask(uint);
 int sigaction(int, const struct sigaction*, struct sigaction*);
 void sigret(void);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -34,10 +50,34 @@ char* strcpy(char*, const char*);
 void *memmove(void*, const void*, int);
 char* strchr(const char*, char c);
 int strcmp(const char*, const char*);
-void printf(int, const char*, ...);
 char* gets(char*, int max);
 uint strlen(const char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+extern void (*exithook)(void);
+
+// printf.c
+#define BUFSIZ 512
+#define _IOFBF 0  // full buffering
+#define _IOLBF 1  // line buffering
+#define _IONBF 2  // no buffering
+
+typedef struct {
+  int fd;
+  int mode;     // _IOFBF, _IOLBF or _IONBF
+  int n;        // bytes in buf
+  int nl;       // buf holds a newline
+  char buf[BUFSIZ];
+} FILE;
+
+FILE* fopen(const char*, int);
+FILE* fdopen(int);
+int setvbuf(FILE*, int);
+int fflush(FILE*);
+int fclose(FILE*);
+int fputc(int, FILE*);
+int fwrite(const void*, int, int, FILE*);
+void fprintf(FILE*, const char*, ...);
+void printf(int, const char*, ...);
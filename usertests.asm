@@ -0,0 +1,8858 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 40 66 00 00       	push   $0x6640
+      16:	6a 01                	push   $0x1
+      18:	e8 a3 50 00 00       	call   50c0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 54 66 00 00       	push   $0x6654
+      26:	e8 db 46 00 00       	call   4706 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 b0 6f 00 00       	push   $0x6fb0
+      39:	6a 01                	push   $0x1
+      3b:	e8 80 50 00 00       	call   50c0 <printf>
+    exit();
+      40:	e8 6b 46 00 00       	call   46b0 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 54 66 00 00       	push   $0x6654
+      51:	e8 b0 46 00 00       	call   4706 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 90 46 00 00       	call   46ee <close>
+
+  argptest();
+      5e:	e8 7d 43 00 00       	call   43e0 <argptest>
+  createdelete();
+      63:	e8 d8 1c 00 00       	call   1d40 <createdelete>
+  linkunlink();
+      68:	e8 73 25 00 00       	call   25e0 <linkunlink>
+  concreate();
+      6d:	e8 6e 22 00 00       	call   22e0 <concreate>
+  fourfiles();
+      72:	e8 c9 1a 00 00       	call   1b40 <fourfiles>
+  sharedfd();
+      77:	e8 04 19 00 00       	call   1980 <sharedfd>
+
+  bigargtest();
+      7c:	e8 1f 40 00 00       	call   40a0 <bigargtest>
+  bigwrite();
+      81:	e8 6a 31 00 00       	call   31f0 <bigwrite>
+  bigargtest();
+      86:	e8 15 40 00 00       	call   40a0 <bigargtest>
+  bsstest();
+      8b:	e8 a0 3f 00 00       	call   4030 <bsstest>
+  sbrktest();
+      90:	e8 9b 3a 00 00       	call   3b30 <sbrktest>
+  validatetest();
+      95:	e8 e6 3e 00 00       	call   3f80 <validatetest>
+
+  opentest();
+      9a:	e8 71 03 00 00       	call   410 <opentest>
+  writetest();
+      9f:	e8 fc 03 00 00       	call   4a0 <writetest>
+  writetest1();
+      a4:	e8 d7 05 00 00       	call   680 <writetest1>
+  createtest();
+      a9:	e8 92 08 00 00       	call   940 <createtest>
+
+  openiputtest();
+      ae:	e8 5d 02 00 00       	call   310 <openiputtest>
+  exitiputtest();
+      b3:	e8 58 01 00 00       	call   210 <exitiputtest>
+  iputtest();
+      b8:	e8 73 00 00 00       	call   130 <iputtest>
+
+  mem();
+      bd:	e8 ee 17 00 00       	call   18b0 <mem>
+  pipe1();
+      c2:	e8 59 0a 00 00       	call   b20 <pipe1>
+  iovtest();
+      c7:	e8 24 13 00 00       	call   13f0 <iovtest>
+  stdiotest();
+      cc:	e8 ef 0b 00 00       	call   cc0 <stdiotest>
+  nanosleeptest();
+      d1:	e8 ca 0d 00 00       	call   ea0 <nanosleeptest>
+  schedtest();
+      d6:	e8 e5 0e 00 00       	call   fc0 <schedtest>
+  rusagetest();
+      db:	e8 f0 11 00 00       	call   12d0 <rusagetest>
+  preempt();
+      e0:	e8 eb 15 00 00       	call   16d0 <preempt>
+  exitwait();
+      e5:	e8 46 17 00 00       	call   1830 <exitwait>
+
+  rmdot();
+      ea:	e8 f1 34 00 00       	call   35e0 <rmdot>
+  fourteen();
+      ef:	e8 ac 33 00 00       	call   34a0 <fourteen>
+  bigfile();
+      f4:	e8 d7 31 00 00       	call   32d0 <bigfile>
+  subdir();
+      f9:	e8 12 2a 00 00       	call   2b10 <subdir>
+  linktest();
+      fe:	e8 cd 1f 00 00       	call   20d0 <linktest>
+  unlinkread();
+     103:	e8 38 1e 00 00       	call   1f40 <unlinkread>
+  dirfile();
+     108:	e8 53 36 00 00       	call   3760 <dirfile>
+  iref();
+     10d:	e8 4e 38 00 00       	call   3960 <iref>
+  forktest();
+     112:	e8 69 39 00 00       	call   3a80 <forktest>
+  bigdir(); // slow
+     117:	e8 d4 25 00 00       	call   26f0 <bigdir>
+  indexdir();
+     11c:	e8 ff 26 00 00       	call   2820 <indexdir>
+
+  uio();
+     121:	e8 4a 42 00 00       	call   4370 <uio>
+
+  exectest();
+     126:	e8 a5 09 00 00       	call   ad0 <exectest>
+
+  exit();
+     12b:	e8 80 45 00 00       	call   46b0 <exit>
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 4e 53 00 00       	push   $0x534e
+     13b:	ff 35 48 7c 00 00    	push   0x7c48
+     141:	e8 7a 4f 00 00       	call   50c0 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 e1 52 00 00 	movl   $0x52e1,(%esp)
+     14d:	e8 dc 45 00 00       	call   472e <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 e1 52 00 00       	push   $0x52e1
+     161:	e8 d0 45 00 00       	call   4736 <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 85 00 00 00    	js     1f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 de 52 00 00       	push   $0x52de
+     179:	e8 98 45 00 00       	call   4716 <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 5a                	js     1df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 03 53 00 00       	push   $0x5303
+     18d:	e8 a4 45 00 00       	call   4736 <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 2f                	js     1c8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 86 53 00 00       	push   $0x5386
+     1a1:	ff 35 48 7c 00 00    	push   0x7c48
+     1a7:	e8 14 4f 00 00       	call   50c0 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 28 5d 00 00       	push   $0x5d28
+     1b8:	ff 35 48 7c 00 00    	push   0x7c48
+     1be:	e8 fd 4e 00 00       	call   50c0 <printf>
+    exit();
+     1c3:	e8 e8 44 00 00       	call   46b0 <exit>
+    printf(stdout, "chdir / failed\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 05 53 00 00       	push   $0x5305
+     1cf:	ff 35 48 7c 00 00    	push   0x7c48
+     1d5:	e8 e6 4e 00 00       	call   50c0 <printf>
+    exit();
+     1da:	e8 d1 44 00 00       	call   46b0 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1df:	52                   	push   %edx
+     1e0:	52                   	push   %edx
+     1e1:	68 e9 52 00 00       	push   $0x52e9
+     1e6:	ff 35 48 7c 00 00    	push   0x7c48
+     1ec:	e8 cf 4e 00 00       	call   50c0 <printf>
+    exit();
+     1f1:	e8 ba 44 00 00       	call   46b0 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1f6:	51                   	push   %ecx
+     1f7:	51                   	push   %ecx
+     1f8:	68 c8 52 00 00       	push   $0x52c8
+     1fd:	ff 35 48 7c 00 00    	push   0x7c48
+     203:	e8 b8 4e 00 00       	call   50c0 <printf>
+    exit();
+     208:	e8 a3 44 00 00       	call   46b0 <exit>
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <exitiputtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     216:	68 15 53 00 00       	push   $0x5315
+     21b:	ff 35 48 7c 00 00    	push   0x7c48
+     221:	e8 9a 4e 00 00       	call   50c0 <printf>
+  pid = fork();
+     226:	e8 9b 44 00 00       	call   46c6 <fork>
+  if(pid < 0){
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 88 8a 00 00 00    	js     2c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     236:	75 50                	jne    288 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	68 e1 52 00 00       	push   $0x52e1
+     240:	e8 e9 44 00 00       	call   472e <mkdir>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	85 c0                	test   %eax,%eax
+     24a:	0f 88 87 00 00 00    	js     2d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 e1 52 00 00       	push   $0x52e1
+     258:	e8 d9 44 00 00       	call   4736 <chdir>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 88 86 00 00 00    	js     2ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 de 52 00 00       	push   $0x52de
+     270:	e8 a1 44 00 00       	call   4716 <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	78 2c                	js     2a8 <exitiputtest+0x98>
+    exit();
+     27c:	e8 2f 44 00 00       	call   46b0 <exit>
+     281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     288:	e8 41 44 00 00       	call   46ce <wait>
+  printf(stdout, "exitiput test ok\n");
+     28d:	83 ec 08             	sub    $0x8,%esp
+     290:	68 38 53 00 00       	push   $0x5338
+     295:	ff 35 48 7c 00 00    	push   0x7c48
+     29b:	e8 20 4e 00 00       	call   50c0 <printf>
+}
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	68 e9 52 00 00       	push   $0x52e9
+     2b0:	ff 35 48 7c 00 00    	push   0x7c48
+     2b6:	e8 05 4e 00 00       	call   50c0 <printf>
+      exit();
+     2bb:	e8 f0 43 00 00       	call   46b0 <exit>
+    printf(stdout, "fork failed\n");
+     2c0:	51                   	push   %ecx
+     2c1:	51                   	push   %ecx
+     2c2:	68 c0 65 00 00       	push   $0x65c0
+     2c7:	ff 35 48 7c 00 00    	push   0x7c48
+     2cd:	e8 ee 4d 00 00       	call   50c0 <printf>
+    exit();
+     2d2:	e8 d9 43 00 00       	call   46b0 <exit>
+      printf(stdout, "mkdir failed\n");
+     2d7:	52                   	push   %edx
+     2d8:	52                   	push   %edx
+     2d9:	68 28 5d 00 00       	push   $0x5d28
+     2de:	ff 35 48 7c 00 00    	push   0x7c48
+     2e4:	e8 d7 4d 00 00       	call   50c0 <printf>
+      exit();
+     2e9:	e8 c2 43 00 00       	call   46b0 <exit>
+      printf(stdout, "child chdir failed\n");
+     2ee:	50                   	push   %eax
+     2ef:	50                   	push   %eax
+     2f0:	68 24 53 00 00       	push   $0x5324
+     2f5:	ff 35 48 7c 00 00    	push   0x7c48
+     2fb:	e8 c0 4d 00 00       	call   50c0 <printf>
+      exit();
+     300:	e8 ab 43 00 00       	call   46b0 <exit>
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <openiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     316:	68 4a 53 00 00       	push   $0x534a
+     31b:	ff 35 48 7c 00 00    	push   0x7c48
+     321:	e8 9a 4d 00 00       	call   50c0 <printf>
+  if(mkdir("oidir") < 0){
+     326:	c7 04 24 59 53 00 00 	movl   $0x5359,(%esp)
+     32d:	e8 fc 43 00 00       	call   472e <mkdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	0f 88 9f 00 00 00    	js     3dc <openiputtest+0xcc>
+  pid = fork();
+     33d:	e8 84 43 00 00       	call   46c6 <fork>
+  if(pid < 0){
+     342:	85 c0                	test   %eax,%eax
+     344:	78 7f                	js     3c5 <openiputtest+0xb5>
+  if(pid == 0){
+     346:	75 38                	jne    380 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     348:	83 ec 08             	sub    $0x8,%esp
+     34b:	6a 02                	push   $0x2
+     34d:	68 59 53 00 00       	push   $0x5359
+     352:	e8 af 43 00 00       	call   4706 <open>
+    if(fd >= 0){
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	85 c0                	test   %eax,%eax
+     35c:	78 62                	js     3c0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     35e:	83 ec 08             	sub    $0x8,%esp
+     361:	68 74 66 00 00       	push   $0x6674
+     366:	ff 35 48 7c 00 00    	push   0x7c48
+     36c:	e8 4f 4d 00 00       	call   50c0 <printf>
+      exit();
+     371:	e8 3a 43 00 00       	call   46b0 <exit>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	6a 01                	push   $0x1
+     385:	e8 cc 43 00 00       	call   4756 <sleep>
+  if(unlink("oidir") != 0){
+     38a:	c7 04 24 59 53 00 00 	movl   $0x5359,(%esp)
+     391:	e8 80 43 00 00       	call   4716 <unlink>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	75 56                	jne    3f3 <openiputtest+0xe3>
+  wait();
+     39d:	e8 2c 43 00 00       	call   46ce <wait>
+  printf(stdout, "openiput test ok\n");
+     3a2:	83 ec 08             	sub    $0x8,%esp
+     3a5:	68 82 53 00 00       	push   $0x5382
+     3aa:	ff 35 48 7c 00 00    	push   0x7c48
+     3b0:	e8 0b 4d 00 00       	call   50c0 <printf>
+}
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	c9                   	leave
+     3b9:	c3                   	ret
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3c0:	e8 eb 42 00 00       	call   46b0 <exit>
+    printf(stdout, "fork failed\n");
+     3c5:	52                   	push   %edx
+     3c6:	52                   	push   %edx
+     3c7:	68 c0 65 00 00       	push   $0x65c0
+     3cc:	ff 35 48 7c 00 00    	push   0x7c48
+     3d2:	e8 e9 4c 00 00       	call   50c0 <printf>
+    exit();
+     3d7:	e8 d4 42 00 00       	call   46b0 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3dc:	51                   	push   %ecx
+     3dd:	51                   	push   %ecx
+     3de:	68 5f 53 00 00       	push   $0x535f
+     3e3:	ff 35 48 7c 00 00    	push   0x7c48
+     3e9:	e8 d2 4c 00 00       	call   50c0 <printf>
+    exit();
+     3ee:	e8 bd 42 00 00       	call   46b0 <exit>
+    printf(stdout, "unlink failed\n");
+     3f3:	50                   	push   %eax
+     3f4:	50                   	push   %eax
+     3f5:	68 73 53 00 00       	push   $0x5373
+     3fa:	ff 35 48 7c 00 00    	push   0x7c48
+     400:	e8 bb 4c 00 00       	call   50c0 <printf>
+    exit();
+     405:	e8 a6 42 00 00       	call   46b0 <exit>
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <opentest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     416:	68 94 53 00 00       	push   $0x5394
+     41b:	ff 35 48 7c 00 00    	push   0x7c48
+     421:	e8 9a 4c 00 00       	call   50c0 <printf>
+  fd = open("echo", 0);
+     426:	58                   	pop    %eax
+     427:	5a                   	pop    %edx
+     428:	6a 00                	push   $0x0
+     42a:	68 9f 53 00 00       	push   $0x539f
+     42f:	e8 d2 42 00 00       	call   4706 <open>
+  if(fd < 0){
+     434:	83 c4 10             	add    $0x10,%esp
+     437:	85 c0                	test   %eax,%eax
+     439:	78 36                	js     471 <opentest+0x61>
+  close(fd);
+     43b:	83 ec 0c             	sub    $0xc,%esp
+     43e:	50                   	push   %eax
+     43f:	e8 aa 42 00 00       	call   46ee <close>
+  fd = open("doesnotexist", 0);
+     444:	5a                   	pop    %edx
+     445:	59                   	pop    %ecx
+     446:	6a 00                	push   $0x0
+     448:	68 b7 53 00 00       	push   $0x53b7
+     44d:	e8 b4 42 00 00       	call   4706 <open>
+  if(fd >= 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	79 2f                	jns    488 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     459:	83 ec 08             	sub    $0x8,%esp
+     45c:	68 e2 53 00 00       	push   $0x53e2
+     461:	ff 35 48 7c 00 00    	push   0x7c48
+     467:	e8 54 4c 00 00       	call   50c0 <printf>
+}
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	c9                   	leave
+     470:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     471:	50                   	push   %eax
+     472:	50                   	push   %eax
+     473:	68 a4 53 00 00       	push   $0x53a4
+     478:	ff 35 48 7c 00 00    	push   0x7c48
+     47e:	e8 3d 4c 00 00       	call   50c0 <printf>
+    exit();
+     483:	e8 28 42 00 00       	call   46b0 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     488:	50                   	push   %eax
+     489:	50                   	push   %eax
+     48a:	68 c4 53 00 00       	push   $0x53c4
+     48f:	ff 35 48 7c 00 00    	push   0x7c48
+     495:	e8 26 4c 00 00       	call   50c0 <printf>
+    exit();
+     49a:	e8 11 42 00 00       	call   46b0 <exit>
+     49f:	90                   	nop
+
+000004a0 <writetest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	68 f0 53 00 00       	push   $0x53f0
+     4ad:	ff 35 48 7c 00 00    	push   0x7c48
+     4b3:	e8 08 4c 00 00       	call   50c0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4b8:	58                   	pop    %eax
+     4b9:	5a                   	pop    %edx
+     4ba:	68 02 02 00 00       	push   $0x202
+     4bf:	68 01 54 00 00       	push   $0x5401
+     4c4:	e8 3d 42 00 00       	call   4706 <open>
+  if(fd >= 0){
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 88 01 00 00    	js     65c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4d4:	83 ec 08             	sub    $0x8,%esp
+     4d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4d9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4db:	68 07 54 00 00       	push   $0x5407
+     4e0:	ff 35 48 7c 00 00    	push   0x7c48
+     4e6:	e8 d5 4b 00 00       	call   50c0 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4f0:	83 ec 04             	sub    $0x4,%esp
+     4f3:	6a 0a                	push   $0xa
+     4f5:	68 3e 54 00 00       	push   $0x543e
+     4fa:	56                   	push   %esi
+     4fb:	e8 e6 41 00 00       	call   46e6 <write>
+     500:	83 c4 10             	add    $0x10,%esp
+     503:	83 f8 0a             	cmp    $0xa,%eax
+     506:	0f 85 d9 00 00 00    	jne    5e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     50c:	83 ec 04             	sub    $0x4,%esp
+     50f:	6a 0a                	push   $0xa
+     511:	68 49 54 00 00       	push   $0x5449
+     516:	56                   	push   %esi
+     517:	e8 ca 41 00 00       	call   46e6 <write>
+     51c:	83 c4 10             	add    $0x10,%esp
+     51f:	83 f8 0a             	cmp    $0xa,%eax
+     522:	0f 85 d6 00 00 00    	jne    5fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     528:	83 c3 01             	add    $0x1,%ebx
+     52b:	83 fb 64             	cmp    $0x64,%ebx
+     52e:	75 c0                	jne    4f0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     530:	83 ec 08             	sub    $0x8,%esp
+     533:	68 54 54 00 00       	push   $0x5454
+     538:	ff 35 48 7c 00 00    	push   0x7c48
+     53e:	e8 7d 4b 00 00       	call   50c0 <printf>
+  close(fd);
+     543:	89 34 24             	mov    %esi,(%esp)
+     546:	e8 a3 41 00 00       	call   46ee <close>
+  fd = open("small", O_RDONLY);
+     54b:	5b                   	pop    %ebx
+     54c:	5e                   	pop    %esi
+     54d:	6a 00                	push   $0x0
+     54f:	68 01 54 00 00       	push   $0x5401
+     554:	e8 ad 41 00 00       	call   4706 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     55c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     55e:	85 c0                	test   %eax,%eax
+     560:	0f 88 b1 00 00 00    	js     617 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     566:	83 ec 08             	sub    $0x8,%esp
+     569:	68 5f 54 00 00       	push   $0x545f
+     56e:	ff 35 48 7c 00 00    	push   0x7c48
+     574:	e8 47 4b 00 00       	call   50c0 <printf>
+  i = read(fd, buf, 2000);
+     579:	83 c4 0c             	add    $0xc,%esp
+     57c:	68 d0 07 00 00       	push   $0x7d0
+     581:	68 80 a3 00 00       	push   $0xa380
+     586:	53                   	push   %ebx
+     587:	e8 52 41 00 00       	call   46de <read>
+  if(i == 2000){
+     58c:	83 c4 10             	add    $0x10,%esp
+     58f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     594:	0f 85 94 00 00 00    	jne    62e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     59a:	83 ec 08             	sub    $0x8,%esp
+     59d:	68 93 54 00 00       	push   $0x5493
+     5a2:	ff 35 48 7c 00 00    	push   0x7c48
+     5a8:	e8 13 4b 00 00       	call   50c0 <printf>
+  close(fd);
+     5ad:	89 1c 24             	mov    %ebx,(%esp)
+     5b0:	e8 39 41 00 00       	call   46ee <close>
+  if(unlink("small") < 0){
+     5b5:	c7 04 24 01 54 00 00 	movl   $0x5401,(%esp)
+     5bc:	e8 55 41 00 00       	call   4716 <unlink>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	78 7d                	js     645 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5c8:	83 ec 08             	sub    $0x8,%esp
+     5cb:	68 bb 54 00 00       	push   $0x54bb
+     5d0:	ff 35 48 7c 00 00    	push   0x7c48
+     5d6:	e8 e5 4a 00 00       	call   50c0 <printf>
+}
+     5db:	83 c4 10             	add    $0x10,%esp
+     5de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5d                   	pop    %ebp
+     5e4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	53                   	push   %ebx
+     5e9:	68 98 66 00 00       	push   $0x6698
+     5ee:	ff 35 48 7c 00 00    	push   0x7c48
+     5f4:	e8 c7 4a 00 00       	call   50c0 <printf>
+      exit();
+     5f9:	e8 b2 40 00 00       	call   46b0 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5fe:	83 ec 04             	sub    $0x4,%esp
+     601:	53                   	push   %ebx
+     602:	68 bc 66 00 00       	push   $0x66bc
+     607:	ff 35 48 7c 00 00    	push   0x7c48
+     60d:	e8 ae 4a 00 00       	call   50c0 <printf>
+      exit();
+     612:	e8 99 40 00 00       	call   46b0 <exit>
+    printf(stdout, "error: open small failed!\n");
+     617:	51                   	push   %ecx
+     618:	51                   	push   %ecx
+     619:	68 78 54 00 00       	push   $0x5478
+     61e:	ff 35 48 7c 00 00    	push   0x7c48
+     624:	e8 97 4a 00 00       	call   50c0 <printf>
+    exit();
+     629:	e8 82 40 00 00       	call   46b0 <exit>
+    printf(stdout, "read failed\n");
+     62e:	52                   	push   %edx
+     62f:	52                   	push   %edx
+     630:	68 ce 5a 00 00       	push   $0x5ace
+     635:	ff 35 48 7c 00 00    	push   0x7c48
+     63b:	e8 80 4a 00 00       	call   50c0 <printf>
+    exit();
+     640:	e8 6b 40 00 00       	call   46b0 <exit>
+    printf(stdout, "unlink small failed\n");
+     645:	50                   	push   %eax
+     646:	50                   	push   %eax
+     647:	68 a6 54 00 00       	push   $0x54a6
+     64c:	ff 35 48 7c 00 00    	push   0x7c48
+     652:	e8 69 4a 00 00       	call   50c0 <printf>
+    exit();
+     657:	e8 54 40 00 00       	call   46b0 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     65c:	50                   	push   %eax
+     65d:	50                   	push   %eax
+     65e:	68 22 54 00 00       	push   $0x5422
+     663:	ff 35 48 7c 00 00    	push   0x7c48
+     669:	e8 52 4a 00 00       	call   50c0 <printf>
+    exit();
+     66e:	e8 3d 40 00 00       	call   46b0 <exit>
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <writetest1>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	57                   	push   %edi
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "big files test\n");
+     689:	68 cf 54 00 00       	push   $0x54cf
+     68e:	ff 35 48 7c 00 00    	push   0x7c48
+     694:	e8 27 4a 00 00       	call   50c0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     699:	5b                   	pop    %ebx
+     69a:	5e                   	pop    %esi
+     69b:	68 02 02 00 00       	push   $0x202
+     6a0:	68 49 55 00 00       	push   $0x5549
+     6a5:	e8 5c 40 00 00       	call   4706 <open>
+  if(fd < 0){
+     6aa:	83 c4 10             	add    $0x10,%esp
+     6ad:	85 c0                	test   %eax,%eax
+     6af:	0f 88 6b 02 00 00    	js     920 <writetest1+0x2a0>
+     6b5:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBIGBLOCKS; i++){
+     6b7:	31 db                	xor    %ebx,%ebx
+     6b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(write(fd, buf, 512) != 512){
+     6c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6c3:	89 1d 80 a3 00 00    	mov    %ebx,0xa380
+    if(write(fd, buf, 512) != 512){
+     6c9:	68 00 02 00 00       	push   $0x200
+     6ce:	68 80 a3 00 00       	push   $0xa380
+     6d3:	56                   	push   %esi
+     6d4:	e8 0d 40 00 00       	call   46e6 <write>
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	0f 85 55 01 00 00    	jne    83c <writetest1+0x1bc>
+  for(i = 0; i < NBIGBLOCKS; i++){
+     6e7:	83 c3 01             	add    $0x1,%ebx
+     6ea:	81 fb 0b 02 00 00    	cmp    $0x20b,%ebx
+     6f0:	75 ce                	jne    6c0 <writetest1+0x40>
+  close(fd);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 f3 3f 00 00       	call   46ee <close>
+  fd = open("big", O_RDONLY);
+     6fb:	58                   	pop    %eax
+     6fc:	5a                   	pop    %edx
+     6fd:	6a 00                	push   $0x0
+     6ff:	68 49 55 00 00       	push   $0x5549
+     704:	e8 fd 3f 00 00       	call   4706 <open>
+  if(fd < 0){
+     709:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     70c:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+     70e:	85 c0                	test   %eax,%eax
+     710:	0f 88 f3 01 00 00    	js     909 <writetest1+0x289>
+  n = 0;
+     716:	31 f6                	xor    %esi,%esi
+     718:	eb 21                	jmp    73b <writetest1+0xbb>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     720:	3d 00 02 00 00       	cmp    $0x200,%eax
+     725:	0f 85 c5 01 00 00    	jne    8f0 <writetest1+0x270>
+    if(((int*)buf)[0] != n){
+     72b:	a1 80 a3 00 00       	mov    0xa380,%eax
+     730:	39 f0                	cmp    %esi,%eax
+     732:	0f 85 68 01 00 00    	jne    8a0 <writetest1+0x220>
+    n++;
+     738:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     73b:	83 ec 04             	sub    $0x4,%esp
+     73e:	68 00 02 00 00       	push   $0x200
+     743:	68 80 a3 00 00       	push   $0xa380
+     748:	57                   	push   %edi
+     749:	e8 90 3f 00 00       	call   46de <read>
+    if(i == 0){
+     74e:	83 c4 10             	add    $0x10,%esp
+    i = read(fd, buf, 512);
+     751:	89 c3                	mov    %eax,%ebx
+    if(i == 0){
+     753:	85 c0                	test   %eax,%eax
+     755:	75 c9                	jne    720 <writetest1+0xa0>
+      if(n != NBIGBLOCKS){
+     757:	81 fe 0b 02 00 00    	cmp    $0x20b,%esi
+     75d:	0f 85 20 01 00 00    	jne    883 <writetest1+0x203>
+  close(fd);
+     763:	83 ec 0c             	sub    $0xc,%esp
+     766:	57                   	push   %edi
+     767:	e8 82 3f 00 00       	call   46ee <close>
+  fd = open("big", O_RDONLY|O_DIRECT);
+     76c:	5e                   	pop    %esi
+     76d:	5f                   	pop    %edi
+     76e:	68 00 04 00 00       	push   $0x400
+     773:	68 49 55 00 00       	push   $0x5549
+     778:	e8 89 3f 00 00       	call   4706 <open>
+  if(fd < 0){
+     77d:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY|O_DIRECT);
+     780:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     782:	85 c0                	test   %eax,%eax
+     784:	0f 88 46 01 00 00    	js     8d0 <writetest1+0x250>
+     78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  while((i = read(fd, buf, sizeof(buf))) > 0){
+     790:	83 ec 04             	sub    $0x4,%esp
+     793:	68 00 20 00 00       	push   $0x2000
+     798:	68 80 a3 00 00       	push   $0xa380
+     79d:	56                   	push   %esi
+     79e:	e8 3b 3f 00 00       	call   46de <read>
+     7a3:	83 c4 10             	add    $0x10,%esp
+     7a6:	85 c0                	test   %eax,%eax
+     7a8:	7e 4e                	jle    7f8 <writetest1+0x178>
+    if(i % 512 != 0){
+     7aa:	a9 ff 01 00 00       	test   $0x1ff,%eax
+     7af:	0f 85 02 01 00 00    	jne    8b7 <writetest1+0x237>
+    for(; i > 0; i -= 512, n++){
+     7b5:	83 e8 01             	sub    $0x1,%eax
+     7b8:	c1 e8 09             	shr    $0x9,%eax
+     7bb:	8d 54 03 01          	lea    0x1(%ebx,%eax,1),%edx
+     7bf:	eb 0e                	jmp    7cf <writetest1+0x14f>
+     7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7c8:	83 c3 01             	add    $0x1,%ebx
+     7cb:	39 d3                	cmp    %edx,%ebx
+     7cd:	74 c1                	je     790 <writetest1+0x110>
+      if(((int*)buf)[(n%(sizeof(buf)/512))*128] != n){
+     7cf:	89 d8                	mov    %ebx,%eax
+     7d1:	83 e0 0f             	and    $0xf,%eax
+     7d4:	c1 e0 09             	shl    $0x9,%eax
+     7d7:	8b 80 80 a3 00 00    	mov    0xa380(%eax),%eax
+     7dd:	39 d8                	cmp    %ebx,%eax
+     7df:	74 e7                	je     7c8 <writetest1+0x148>
+        printf(stdout, "direct read content of block %d is %d\n",
+     7e1:	50                   	push   %eax
+     7e2:	53                   	push   %ebx
+     7e3:	68 24 67 00 00       	push   $0x6724
+     7e8:	ff 35 48 7c 00 00    	push   0x7c48
+     7ee:	e8 cd 48 00 00       	call   50c0 <printf>
+        exit();
+     7f3:	e8 b8 3e 00 00       	call   46b0 <exit>
+  if(i < 0 || n != NBIGBLOCKS){
+     7f8:	78 72                	js     86c <writetest1+0x1ec>
+     7fa:	81 fb 0b 02 00 00    	cmp    $0x20b,%ebx
+     800:	75 6a                	jne    86c <writetest1+0x1ec>
+  close(fd);
+     802:	83 ec 0c             	sub    $0xc,%esp
+     805:	56                   	push   %esi
+     806:	e8 e3 3e 00 00       	call   46ee <close>
+  if(unlink("big") < 0){
+     80b:	c7 04 24 49 55 00 00 	movl   $0x5549,(%esp)
+     812:	e8 ff 3e 00 00       	call   4716 <unlink>
+     817:	83 c4 10             	add    $0x10,%esp
+     81a:	85 c0                	test   %eax,%eax
+     81c:	78 37                	js     855 <writetest1+0x1d5>
+  printf(stdout, "big files ok\n");
+     81e:	83 ec 08             	sub    $0x8,%esp
+     821:	68 77 55 00 00       	push   $0x5577
+     826:	ff 35 48 7c 00 00    	push   0x7c48
+     82c:	e8 8f 48 00 00       	call   50c0 <printf>
+}
+     831:	83 c4 10             	add    $0x10,%esp
+     834:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     837:	5b                   	pop    %ebx
+     838:	5e                   	pop    %esi
+     839:	5f                   	pop    %edi
+     83a:	5d                   	pop    %ebp
+     83b:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     83c:	83 ec 04             	sub    $0x4,%esp
+     83f:	53                   	push   %ebx
+     840:	68 f9 54 00 00       	push   $0x54f9
+     845:	ff 35 48 7c 00 00    	push   0x7c48
+     84b:	e8 70 48 00 00       	call   50c0 <printf>
+      exit();
+     850:	e8 5b 3e 00 00       	call   46b0 <exit>
+    printf(stdout, "unlink big failed\n");
+     855:	50                   	push   %eax
+     856:	50                   	push   %eax
+     857:	68 64 55 00 00       	push   $0x5564
+     85c:	ff 35 48 7c 00 00    	push   0x7c48
+     862:	e8 59 48 00 00       	call   50c0 <printf>
+    exit();
+     867:	e8 44 3e 00 00       	call   46b0 <exit>
+    printf(stdout, "direct read only %d blocks from big\n", n);
+     86c:	52                   	push   %edx
+     86d:	53                   	push   %ebx
+     86e:	68 4c 67 00 00       	push   $0x674c
+     873:	ff 35 48 7c 00 00    	push   0x7c48
+     879:	e8 42 48 00 00       	call   50c0 <printf>
+    exit();
+     87e:	e8 2d 3e 00 00       	call   46b0 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     883:	50                   	push   %eax
+     884:	56                   	push   %esi
+     885:	68 30 55 00 00       	push   $0x5530
+     88a:	ff 35 48 7c 00 00    	push   0x7c48
+     890:	e8 2b 48 00 00       	call   50c0 <printf>
+        exit();
+     895:	e8 16 3e 00 00       	call   46b0 <exit>
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      printf(stdout, "read content of block %d is %d\n",
+     8a0:	50                   	push   %eax
+     8a1:	56                   	push   %esi
+     8a2:	68 e0 66 00 00       	push   $0x66e0
+     8a7:	ff 35 48 7c 00 00    	push   0x7c48
+     8ad:	e8 0e 48 00 00       	call   50c0 <printf>
+      exit();
+     8b2:	e8 f9 3d 00 00       	call   46b0 <exit>
+      printf(stdout, "direct read failed %d\n", i);
+     8b7:	83 ec 04             	sub    $0x4,%esp
+     8ba:	50                   	push   %eax
+     8bb:	68 4d 55 00 00       	push   $0x554d
+     8c0:	ff 35 48 7c 00 00    	push   0x7c48
+     8c6:	e8 f5 47 00 00       	call   50c0 <printf>
+      exit();
+     8cb:	e8 e0 3d 00 00       	call   46b0 <exit>
+    printf(stdout, "error: open big O_DIRECT failed!\n");
+     8d0:	51                   	push   %ecx
+     8d1:	51                   	push   %ecx
+     8d2:	68 00 67 00 00       	push   $0x6700
+     8d7:	ff 35 48 7c 00 00    	push   0x7c48
+     8dd:	e8 de 47 00 00       	call   50c0 <printf>
+    exit();
+     8e2:	e8 c9 3d 00 00       	call   46b0 <exit>
+     8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ee:	66 90                	xchg   %ax,%ax
+      printf(stdout, "read failed %d\n", i);
+     8f0:	83 ec 04             	sub    $0x4,%esp
+     8f3:	50                   	push   %eax
+     8f4:	68 54 55 00 00       	push   $0x5554
+     8f9:	ff 35 48 7c 00 00    	push   0x7c48
+     8ff:	e8 bc 47 00 00       	call   50c0 <printf>
+      exit();
+     904:	e8 a7 3d 00 00       	call   46b0 <exit>
+    printf(stdout, "error: open big failed!\n");
+     909:	50                   	push   %eax
+     90a:	50                   	push   %eax
+     90b:	68 17 55 00 00       	push   $0x5517
+     910:	ff 35 48 7c 00 00    	push   0x7c48
+     916:	e8 a5 47 00 00       	call   50c0 <printf>
+    exit();
+     91b:	e8 90 3d 00 00       	call   46b0 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     920:	51                   	push   %ecx
+     921:	51                   	push   %ecx
+     922:	68 df 54 00 00       	push   $0x54df
+     927:	ff 35 48 7c 00 00    	push   0x7c48
+     92d:	e8 8e 47 00 00       	call   50c0 <printf>
+    exit();
+     932:	e8 79 3d 00 00       	call   46b0 <exit>
+     937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93e:	66 90                	xchg   %ax,%ax
+
+00000940 <createtest>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	53                   	push   %ebx
+  name[2] = '\0';
+     944:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     949:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     94c:	68 74 67 00 00       	push   $0x6774
+     951:	ff 35 48 7c 00 00    	push   0x7c48
+     957:	e8 64 47 00 00       	call   50c0 <printf>
+  name[0] = 'a';
+     95c:	c6 05 70 a3 00 00 61 	movb   $0x61,0xa370
+  name[2] = '\0';
+     963:	83 c4 10             	add    $0x10,%esp
+     966:	c6 05 72 a3 00 00 00 	movb   $0x0,0xa372
+  for(i = 0; i < 52; i++){
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     970:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     973:	88 1d 71 a3 00 00    	mov    %bl,0xa371
+  for(i = 0; i < 52; i++){
+     979:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     97c:	68 02 02 00 00       	push   $0x202
+     981:	68 70 a3 00 00       	push   $0xa370
+     986:	e8 7b 3d 00 00       	call   4706 <open>
+    close(fd);
+     98b:	89 04 24             	mov    %eax,(%esp)
+     98e:	e8 5b 3d 00 00       	call   46ee <close>
+  for(i = 0; i < 52; i++){
+     993:	83 c4 10             	add    $0x10,%esp
+     996:	80 fb 64             	cmp    $0x64,%bl
+     999:	75 d5                	jne    970 <createtest+0x30>
+  name[0] = 'a';
+     99b:	c6 05 70 a3 00 00 61 	movb   $0x61,0xa370
+  name[2] = '\0';
+     9a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     9a7:	c6 05 72 a3 00 00 00 	movb   $0x0,0xa372
+  for(i = 0; i < 52; i++){
+     9ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     9b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     9b3:	88 1d 71 a3 00 00    	mov    %bl,0xa371
+  for(i = 0; i < 52; i++){
+     9b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     9bc:	68 70 a3 00 00       	push   $0xa370
+     9c1:	e8 50 3d 00 00       	call   4716 <unlink>
+  for(i = 0; i < 52; i++){
+     9c6:	83 c4 10             	add    $0x10,%esp
+     9c9:	80 fb 64             	cmp    $0x64,%bl
+     9cc:	75 e2                	jne    9b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     9ce:	83 ec 08             	sub    $0x8,%esp
+     9d1:	68 9c 67 00 00       	push   $0x679c
+     9d6:	ff 35 48 7c 00 00    	push   0x7c48
+     9dc:	e8 df 46 00 00       	call   50c0 <printf>
+}
+     9e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9e4:	83 c4 10             	add    $0x10,%esp
+     9e7:	c9                   	leave
+     9e8:	c3                   	ret
+     9e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009f0 <dirtest>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     9f6:	68 85 55 00 00       	push   $0x5585
+     9fb:	ff 35 48 7c 00 00    	push   0x7c48
+     a01:	e8 ba 46 00 00       	call   50c0 <printf>
+  if(mkdir("dir0") < 0){
+     a06:	c7 04 24 91 55 00 00 	movl   $0x5591,(%esp)
+     a0d:	e8 1c 3d 00 00       	call   472e <mkdir>
+     a12:	83 c4 10             	add    $0x10,%esp
+     a15:	85 c0                	test   %eax,%eax
+     a17:	78 58                	js     a71 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     a19:	83 ec 0c             	sub    $0xc,%esp
+     a1c:	68 91 55 00 00       	push   $0x5591
+     a21:	e8 10 3d 00 00       	call   4736 <chdir>
+     a26:	83 c4 10             	add    $0x10,%esp
+     a29:	85 c0                	test   %eax,%eax
+     a2b:	0f 88 85 00 00 00    	js     ab6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     a31:	83 ec 0c             	sub    $0xc,%esp
+     a34:	68 f4 5e 00 00       	push   $0x5ef4
+     a39:	e8 f8 3c 00 00       	call   4736 <chdir>
+     a3e:	83 c4 10             	add    $0x10,%esp
+     a41:	85 c0                	test   %eax,%eax
+     a43:	78 5a                	js     a9f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     a45:	83 ec 0c             	sub    $0xc,%esp
+     a48:	68 91 55 00 00       	push   $0x5591
+     a4d:	e8 c4 3c 00 00       	call   4716 <unlink>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	78 2f                	js     a88 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     a59:	83 ec 08             	sub    $0x8,%esp
+     a5c:	68 ce 55 00 00       	push   $0x55ce
+     a61:	ff 35 48 7c 00 00    	push   0x7c48
+     a67:	e8 54 46 00 00       	call   50c0 <printf>
+}
+     a6c:	83 c4 10             	add    $0x10,%esp
+     a6f:	c9                   	leave
+     a70:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     a71:	50                   	push   %eax
+     a72:	50                   	push   %eax
+     a73:	68 28 5d 00 00       	push   $0x5d28
+     a78:	ff 35 48 7c 00 00    	push   0x7c48
+     a7e:	e8 3d 46 00 00       	call   50c0 <printf>
+    exit();
+     a83:	e8 28 3c 00 00       	call   46b0 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     a88:	50                   	push   %eax
+     a89:	50                   	push   %eax
+     a8a:	68 ba 55 00 00       	push   $0x55ba
+     a8f:	ff 35 48 7c 00 00    	push   0x7c48
+     a95:	e8 26 46 00 00       	call   50c0 <printf>
+    exit();
+     a9a:	e8 11 3c 00 00       	call   46b0 <exit>
+    printf(stdout, "chdir .. failed\n");
+     a9f:	52                   	push   %edx
+     aa0:	52                   	push   %edx
+     aa1:	68 a9 55 00 00       	push   $0x55a9
+     aa6:	ff 35 48 7c 00 00    	push   0x7c48
+     aac:	e8 0f 46 00 00       	call   50c0 <printf>
+    exit();
+     ab1:	e8 fa 3b 00 00       	call   46b0 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     ab6:	51                   	push   %ecx
+     ab7:	51                   	push   %ecx
+     ab8:	68 96 55 00 00       	push   $0x5596
+     abd:	ff 35 48 7c 00 00    	push   0x7c48
+     ac3:	e8 f8 45 00 00       	call   50c0 <printf>
+    exit();
+     ac8:	e8 e3 3b 00 00       	call   46b0 <exit>
+     acd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ad0 <exectest>:
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     ad6:	68 dd 55 00 00       	push   $0x55dd
+     adb:	ff 35 48 7c 00 00    	push   0x7c48
+     ae1:	e8 da 45 00 00       	call   50c0 <printf>
+  if(exec("echo", echoargv) < 0){
+     ae6:	5a                   	pop    %edx
+     ae7:	59                   	pop    %ecx
+     ae8:	68 4c 7c 00 00       	push   $0x7c4c
+     aed:	68 9f 53 00 00       	push   $0x539f
+     af2:	e8 07 3c 00 00       	call   46fe <exec>
+     af7:	83 c4 10             	add    $0x10,%esp
+     afa:	85 c0                	test   %eax,%eax
+     afc:	78 02                	js     b00 <exectest+0x30>
+}
+     afe:	c9                   	leave
+     aff:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     b00:	50                   	push   %eax
+     b01:	50                   	push   %eax
+     b02:	68 e8 55 00 00       	push   $0x55e8
+     b07:	ff 35 48 7c 00 00    	push   0x7c48
+     b0d:	e8 ae 45 00 00       	call   50c0 <printf>
+    exit();
+     b12:	e8 99 3b 00 00       	call   46b0 <exit>
+     b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <pipe1>:
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	57                   	push   %edi
+     b24:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     b25:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     b28:	53                   	push   %ebx
+     b29:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     b2c:	50                   	push   %eax
+     b2d:	e8 a4 3b 00 00       	call   46d6 <pipe>
+     b32:	83 c4 10             	add    $0x10,%esp
+     b35:	85 c0                	test   %eax,%eax
+     b37:	0f 85 41 01 00 00    	jne    c7e <pipe1+0x15e>
+     b3d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     b3f:	e8 82 3b 00 00       	call   46c6 <fork>
+  if(pid == 0){
+     b44:	85 c0                	test   %eax,%eax
+     b46:	0f 84 92 00 00 00    	je     bde <pipe1+0xbe>
+  } else if(pid > 0){
+     b4c:	0f 8e 3f 01 00 00    	jle    c91 <pipe1+0x171>
+    close(fds[1]);
+     b52:	83 ec 0c             	sub    $0xc,%esp
+     b55:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     b58:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     b5a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     b5f:	e8 8a 3b 00 00       	call   46ee <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     b64:	83 c4 10             	add    $0x10,%esp
+     b67:	83 ec 04             	sub    $0x4,%esp
+     b6a:	57                   	push   %edi
+     b6b:	68 80 a3 00 00       	push   $0xa380
+     b70:	ff 75 e0             	push   -0x20(%ebp)
+     b73:	e8 66 3b 00 00       	call   46de <read>
+     b78:	83 c4 10             	add    $0x10,%esp
+     b7b:	89 c1                	mov    %eax,%ecx
+     b7d:	85 c0                	test   %eax,%eax
+     b7f:	0f 8e b8 00 00 00    	jle    c3d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     b85:	89 f0                	mov    %esi,%eax
+     b87:	32 05 80 a3 00 00    	xor    0xa380,%al
+     b8d:	0f b6 c0             	movzbl %al,%eax
+     b90:	85 c0                	test   %eax,%eax
+     b92:	75 30                	jne    bc4 <pipe1+0xa4>
+     b94:	83 c6 01             	add    $0x1,%esi
+     b97:	eb 0f                	jmp    ba8 <pipe1+0x88>
+     b99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ba0:	38 90 80 a3 00 00    	cmp    %dl,0xa380(%eax)
+     ba6:	75 1c                	jne    bc4 <pipe1+0xa4>
+     ba8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     bab:	83 c0 01             	add    $0x1,%eax
+     bae:	39 c1                	cmp    %eax,%ecx
+     bb0:	75 ee                	jne    ba0 <pipe1+0x80>
+      cc = cc * 2;
+     bb2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     bb4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     bb9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     bbb:	89 d6                	mov    %edx,%esi
+     bbd:	39 c7                	cmp    %eax,%edi
+     bbf:	0f 4f f8             	cmovg  %eax,%edi
+     bc2:	eb a3                	jmp    b67 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     bc4:	83 ec 08             	sub    $0x8,%esp
+     bc7:	68 17 56 00 00       	push   $0x5617
+     bcc:	6a 01                	push   $0x1
+     bce:	e8 ed 44 00 00       	call   50c0 <printf>
+     bd3:	83 c4 10             	add    $0x10,%esp
+}
+     bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bd9:	5b                   	pop    %ebx
+     bda:	5e                   	pop    %esi
+     bdb:	5f                   	pop    %edi
+     bdc:	5d                   	pop    %ebp
+     bdd:	c3                   	ret
+    close(fds[0]);
+     bde:	83 ec 0c             	sub    $0xc,%esp
+     be1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     be4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     be6:	e8 03 3b 00 00       	call   46ee <close>
+     beb:	83 c4 10             	add    $0x10,%esp
+     bee:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     bf0:	31 c0                	xor    %eax,%eax
+     bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     bf8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     bfb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     bfe:	88 90 7f a3 00 00    	mov    %dl,0xa37f(%eax)
+      for(i = 0; i < 1033; i++)
+     c04:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c09:	75 ed                	jne    bf8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     c0b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     c0e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     c14:	68 09 04 00 00       	push   $0x409
+     c19:	68 80 a3 00 00       	push   $0xa380
+     c1e:	ff 75 e4             	push   -0x1c(%ebp)
+     c21:	e8 c0 3a 00 00       	call   46e6 <write>
+     c26:	83 c4 10             	add    $0x10,%esp
+     c29:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c2e:	75 74                	jne    ca4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     c30:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c36:	75 b8                	jne    bf0 <pipe1+0xd0>
+    exit();
+     c38:	e8 73 3a 00 00       	call   46b0 <exit>
+    if(total != 5 * 1033){
+     c3d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c43:	75 26                	jne    c6b <pipe1+0x14b>
+    close(fds[0]);
+     c45:	83 ec 0c             	sub    $0xc,%esp
+     c48:	ff 75 e0             	push   -0x20(%ebp)
+     c4b:	e8 9e 3a 00 00       	call   46ee <close>
+    wait();
+     c50:	e8 79 3a 00 00       	call   46ce <wait>
+  printf(1, "pipe1 ok\n");
+     c55:	5a                   	pop    %edx
+     c56:	59                   	pop    %ecx
+     c57:	68 3c 56 00 00       	push   $0x563c
+     c5c:	6a 01                	push   $0x1
+     c5e:	e8 5d 44 00 00       	call   50c0 <printf>
+     c63:	83 c4 10             	add    $0x10,%esp
+     c66:	e9 6b ff ff ff       	jmp    bd6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     c6b:	56                   	push   %esi
+     c6c:	53                   	push   %ebx
+     c6d:	68 25 56 00 00       	push   $0x5625
+     c72:	6a 01                	push   $0x1
+     c74:	e8 47 44 00 00       	call   50c0 <printf>
+      exit();
+     c79:	e8 32 3a 00 00       	call   46b0 <exit>
+    printf(1, "pipe() failed\n");
+     c7e:	50                   	push   %eax
+     c7f:	50                   	push   %eax
+     c80:	68 fa 55 00 00       	push   $0x55fa
+     c85:	6a 01                	push   $0x1
+     c87:	e8 34 44 00 00       	call   50c0 <printf>
+    exit();
+     c8c:	e8 1f 3a 00 00       	call   46b0 <exit>
+    printf(1, "fork() failed\n");
+     c91:	50                   	push   %eax
+     c92:	50                   	push   %eax
+     c93:	68 46 56 00 00       	push   $0x5646
+     c98:	6a 01                	push   $0x1
+     c9a:	e8 21 44 00 00       	call   50c0 <printf>
+    exit();
+     c9f:	e8 0c 3a 00 00       	call   46b0 <exit>
+        printf(1, "pipe1 oops 1\n");
+     ca4:	57                   	push   %edi
+     ca5:	57                   	push   %edi
+     ca6:	68 09 56 00 00       	push   $0x5609
+     cab:	6a 01                	push   $0x1
+     cad:	e8 0e 44 00 00       	call   50c0 <printf>
+        exit();
+     cb2:	e8 f9 39 00 00       	call   46b0 <exit>
+     cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbe:	66 90                	xchg   %ax,%ax
+
+00000cc0 <stdiotest>:
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	56                   	push   %esi
+     cc4:	53                   	push   %ebx
+  printf(1, "stdio test\n");
+     cc5:	83 ec 08             	sub    $0x8,%esp
+     cc8:	68 55 56 00 00       	push   $0x5655
+     ccd:	6a 01                	push   $0x1
+     ccf:	e8 ec 43 00 00       	call   50c0 <printf>
+  f = fopen("stdiofile", O_CREATE|O_WRONLY);
+     cd4:	58                   	pop    %eax
+     cd5:	5a                   	pop    %edx
+     cd6:	68 01 02 00 00       	push   $0x201
+     cdb:	68 61 56 00 00       	push   $0x5661
+     ce0:	e8 9b 3f 00 00       	call   4c80 <fopen>
+  if(f == 0){
+     ce5:	83 c4 10             	add    $0x10,%esp
+     ce8:	85 c0                	test   %eax,%eax
+     cea:	0f 84 4b 01 00 00    	je     e3b <stdiotest+0x17b>
+  fprintf(f, "%d %s", 42, "abc");
+     cf0:	68 7f 56 00 00       	push   $0x567f
+     cf5:	89 c3                	mov    %eax,%ebx
+     cf7:	6a 2a                	push   $0x2a
+     cf9:	68 83 56 00 00       	push   $0x5683
+     cfe:	50                   	push   %eax
+     cff:	e8 3c 43 00 00       	call   5040 <fprintf>
+  if(fwrite("xyz", 1, 3, f) != 3){
+     d04:	53                   	push   %ebx
+     d05:	6a 03                	push   $0x3
+     d07:	6a 01                	push   $0x1
+     d09:	68 bf 56 00 00       	push   $0x56bf
+     d0e:	e8 cd 41 00 00       	call   4ee0 <fwrite>
+     d13:	83 c4 20             	add    $0x20,%esp
+     d16:	83 f8 03             	cmp    $0x3,%eax
+     d19:	0f 85 42 01 00 00    	jne    e61 <stdiotest+0x1a1>
+  fd = open("stdiofile", O_RDONLY);
+     d1f:	83 ec 08             	sub    $0x8,%esp
+     d22:	6a 00                	push   $0x0
+     d24:	68 61 56 00 00       	push   $0x5661
+     d29:	e8 d8 39 00 00       	call   4706 <open>
+  if(read(fd, buf, sizeof(buf)) != 0){
+     d2e:	83 c4 0c             	add    $0xc,%esp
+     d31:	68 00 20 00 00       	push   $0x2000
+  fd = open("stdiofile", O_RDONLY);
+     d36:	89 c6                	mov    %eax,%esi
+  if(read(fd, buf, sizeof(buf)) != 0){
+     d38:	68 80 a3 00 00       	push   $0xa380
+     d3d:	50                   	push   %eax
+     d3e:	e8 9b 39 00 00       	call   46de <read>
+     d43:	83 c4 10             	add    $0x10,%esp
+     d46:	85 c0                	test   %eax,%eax
+     d48:	0f 85 00 01 00 00    	jne    e4e <stdiotest+0x18e>
+  fflush(f);
+     d4e:	83 ec 0c             	sub    $0xc,%esp
+     d51:	53                   	push   %ebx
+     d52:	e8 d9 3f 00 00       	call   4d30 <fflush>
+  if((n = read(fd, buf, sizeof(buf))) != 9 || !bufeq(buf, "42 abcxyz", 9)){
+     d57:	83 c4 0c             	add    $0xc,%esp
+     d5a:	68 00 20 00 00       	push   $0x2000
+     d5f:	68 80 a3 00 00       	push   $0xa380
+     d64:	56                   	push   %esi
+     d65:	e8 74 39 00 00       	call   46de <read>
+     d6a:	83 c4 10             	add    $0x10,%esp
+     d6d:	83 f8 09             	cmp    $0x9,%eax
+     d70:	0f 85 9f 00 00 00    	jne    e15 <stdiotest+0x155>
+    if(*p++ != *q++)
+     d76:	80 3d 80 a3 00 00 34 	cmpb   $0x34,0xa380
+     d7d:	0f 85 92 00 00 00    	jne    e15 <stdiotest+0x155>
+     d83:	ba 01 00 00 00       	mov    $0x1,%edx
+     d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8f:	90                   	nop
+     d90:	0f b6 8a 80 a3 00 00 	movzbl 0xa380(%edx),%ecx
+     d97:	83 c2 01             	add    $0x1,%edx
+     d9a:	3a 8a b8 56 00 00    	cmp    0x56b8(%edx),%cl
+     da0:	75 73                	jne    e15 <stdiotest+0x155>
+  while(n-- > 0)
+     da2:	83 fa 09             	cmp    $0x9,%edx
+     da5:	75 e9                	jne    d90 <stdiotest+0xd0>
+  pid = fork();
+     da7:	e8 1a 39 00 00       	call   46c6 <fork>
+  if(pid < 0){
+     dac:	85 c0                	test   %eax,%eax
+     dae:	0f 88 cf 00 00 00    	js     e83 <stdiotest+0x1c3>
+  if(pid == 0){
+     db4:	0f 84 ba 00 00 00    	je     e74 <stdiotest+0x1b4>
+  wait();
+     dba:	e8 0f 39 00 00       	call   46ce <wait>
+  if(read(fd, buf, sizeof(buf)) != 1 || buf[0] != '!'){
+     dbf:	83 ec 04             	sub    $0x4,%esp
+     dc2:	68 00 20 00 00       	push   $0x2000
+     dc7:	68 80 a3 00 00       	push   $0xa380
+     dcc:	56                   	push   %esi
+     dcd:	e8 0c 39 00 00       	call   46de <read>
+     dd2:	83 c4 10             	add    $0x10,%esp
+     dd5:	83 f8 01             	cmp    $0x1,%eax
+     dd8:	75 4e                	jne    e28 <stdiotest+0x168>
+     dda:	80 3d 80 a3 00 00 21 	cmpb   $0x21,0xa380
+     de1:	75 45                	jne    e28 <stdiotest+0x168>
+  close(fd);
+     de3:	83 ec 0c             	sub    $0xc,%esp
+     de6:	56                   	push   %esi
+     de7:	e8 02 39 00 00       	call   46ee <close>
+  fclose(f);
+     dec:	89 1c 24             	mov    %ebx,(%esp)
+     def:	e8 8c 3f 00 00       	call   4d80 <fclose>
+  unlink("stdiofile");
+     df4:	c7 04 24 61 56 00 00 	movl   $0x5661,(%esp)
+     dfb:	e8 16 39 00 00       	call   4716 <unlink>
+  printf(1, "stdio test ok\n");
+     e00:	58                   	pop    %eax
+     e01:	5a                   	pop    %edx
+     e02:	68 0d 57 00 00       	push   $0x570d
+     e07:	6a 01                	push   $0x1
+     e09:	e8 b2 42 00 00       	call   50c0 <printf>
+}
+     e0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e11:	5b                   	pop    %ebx
+     e12:	5e                   	pop    %esi
+     e13:	5d                   	pop    %ebp
+     e14:	c3                   	ret
+    printf(1, "stdio fflush wrote %d bytes\n", n);
+     e15:	52                   	push   %edx
+     e16:	50                   	push   %eax
+     e17:	68 c3 56 00 00       	push   $0x56c3
+     e1c:	6a 01                	push   $0x1
+     e1e:	e8 9d 42 00 00       	call   50c0 <printf>
+    exit();
+     e23:	e8 88 38 00 00       	call   46b0 <exit>
+    printf(1, "stdio exit did not flush\n");
+     e28:	51                   	push   %ecx
+     e29:	51                   	push   %ecx
+     e2a:	68 f3 56 00 00       	push   $0x56f3
+     e2f:	6a 01                	push   $0x1
+     e31:	e8 8a 42 00 00       	call   50c0 <printf>
+    exit();
+     e36:	e8 75 38 00 00       	call   46b0 <exit>
+    printf(1, "stdio fopen failed\n");
+     e3b:	56                   	push   %esi
+     e3c:	56                   	push   %esi
+     e3d:	68 6b 56 00 00       	push   $0x566b
+     e42:	6a 01                	push   $0x1
+     e44:	e8 77 42 00 00       	call   50c0 <printf>
+    exit();
+     e49:	e8 62 38 00 00       	call   46b0 <exit>
+    printf(1, "stdio output not buffered\n");
+     e4e:	51                   	push   %ecx
+     e4f:	51                   	push   %ecx
+     e50:	68 9e 56 00 00       	push   $0x569e
+     e55:	6a 01                	push   $0x1
+     e57:	e8 64 42 00 00       	call   50c0 <printf>
+    exit();
+     e5c:	e8 4f 38 00 00       	call   46b0 <exit>
+    printf(1, "stdio fwrite failed\n");
+     e61:	53                   	push   %ebx
+     e62:	53                   	push   %ebx
+     e63:	68 89 56 00 00       	push   $0x5689
+     e68:	6a 01                	push   $0x1
+     e6a:	e8 51 42 00 00       	call   50c0 <printf>
+    exit();
+     e6f:	e8 3c 38 00 00       	call   46b0 <exit>
+    fputc('!', f);
+     e74:	56                   	push   %esi
+     e75:	56                   	push   %esi
+     e76:	53                   	push   %ebx
+     e77:	6a 21                	push   $0x21
+     e79:	e8 92 3f 00 00       	call   4e10 <fputc>
+    exit();
+     e7e:	e8 2d 38 00 00       	call   46b0 <exit>
+    printf(1, "stdio fork failed\n");
+     e83:	50                   	push   %eax
+     e84:	50                   	push   %eax
+     e85:	68 e0 56 00 00       	push   $0x56e0
+     e8a:	6a 01                	push   $0x1
+     e8c:	e8 2f 42 00 00       	call   50c0 <printf>
+    exit();
+     e91:	e8 1a 38 00 00       	call   46b0 <exit>
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <nanosleeptest>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	56                   	push   %esi
+     ea4:	53                   	push   %ebx
+  if(nanosleep(&ts) != -1){
+     ea5:	8d 75 f0             	lea    -0x10(%ebp),%esi
+{
+     ea8:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "nanosleep test\n");
+     eab:	68 1c 57 00 00       	push   $0x571c
+     eb0:	6a 01                	push   $0x1
+     eb2:	e8 09 42 00 00       	call   50c0 <printf>
+  ts.tv_sec = 0;
+     eb7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  ts.tv_nsec = 1000000000;
+     ebe:	c7 45 f4 00 ca 9a 3b 	movl   $0x3b9aca00,-0xc(%ebp)
+  if(nanosleep(&ts) != -1){
+     ec5:	89 34 24             	mov    %esi,(%esp)
+     ec8:	e8 c1 38 00 00       	call   478e <nanosleep>
+     ecd:	83 c4 10             	add    $0x10,%esp
+     ed0:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ed3:	0f 85 94 00 00 00    	jne    f6d <nanosleeptest+0xcd>
+  ts.tv_nsec = 30000000;
+     ed9:	c7 45 f4 80 c3 c9 01 	movl   $0x1c9c380,-0xc(%ebp)
+  t0 = uptime();
+     ee0:	e8 79 38 00 00       	call   475e <uptime>
+  if(nanosleep(&ts) != 0 || uptime() - t0 < 2){
+     ee5:	83 ec 0c             	sub    $0xc,%esp
+     ee8:	56                   	push   %esi
+  t0 = uptime();
+     ee9:	89 c3                	mov    %eax,%ebx
+  if(nanosleep(&ts) != 0 || uptime() - t0 < 2){
+     eeb:	e8 9e 38 00 00       	call   478e <nanosleep>
+     ef0:	83 c4 10             	add    $0x10,%esp
+     ef3:	85 c0                	test   %eax,%eax
+     ef5:	75 63                	jne    f5a <nanosleeptest+0xba>
+     ef7:	e8 62 38 00 00       	call   475e <uptime>
+     efc:	29 d8                	sub    %ebx,%eax
+     efe:	83 f8 01             	cmp    $0x1,%eax
+     f01:	7e 57                	jle    f5a <nanosleeptest+0xba>
+  pid = fork();
+     f03:	e8 be 37 00 00       	call   46c6 <fork>
+     f08:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+     f0a:	85 c0                	test   %eax,%eax
+     f0c:	0f 88 9b 00 00 00    	js     fad <nanosleeptest+0x10d>
+  if(pid == 0){
+     f12:	74 7f                	je     f93 <nanosleeptest+0xf3>
+  nanosleep(&ts);
+     f14:	83 ec 0c             	sub    $0xc,%esp
+  ts.tv_sec = 0;
+     f17:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  ts.tv_nsec = 1000000;
+     f1e:	c7 45 f4 40 42 0f 00 	movl   $0xf4240,-0xc(%ebp)
+  nanosleep(&ts);
+     f25:	56                   	push   %esi
+     f26:	e8 63 38 00 00       	call   478e <nanosleep>
+  kill(pid, SIGKILL);
+     f2b:	5a                   	pop    %edx
+     f2c:	59                   	pop    %ecx
+     f2d:	6a 09                	push   $0x9
+     f2f:	53                   	push   %ebx
+     f30:	e8 c1 37 00 00       	call   46f6 <kill>
+  if(wait() != pid){
+     f35:	e8 94 37 00 00       	call   46ce <wait>
+     f3a:	83 c4 10             	add    $0x10,%esp
+     f3d:	39 d8                	cmp    %ebx,%eax
+     f3f:	75 3f                	jne    f80 <nanosleeptest+0xe0>
+  printf(1, "nanosleep test ok\n");
+     f41:	83 ec 08             	sub    $0x8,%esp
+     f44:	68 74 57 00 00       	push   $0x5774
+     f49:	6a 01                	push   $0x1
+     f4b:	e8 70 41 00 00       	call   50c0 <printf>
+}
+     f50:	83 c4 10             	add    $0x10,%esp
+     f53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f56:	5b                   	pop    %ebx
+     f57:	5e                   	pop    %esi
+     f58:	5d                   	pop    %ebp
+     f59:	c3                   	ret
+    printf(1, "nanosleep returned early\n");
+     f5a:	50                   	push   %eax
+     f5b:	50                   	push   %eax
+     f5c:	68 2c 57 00 00       	push   $0x572c
+     f61:	6a 01                	push   $0x1
+     f63:	e8 58 41 00 00       	call   50c0 <printf>
+    exit();
+     f68:	e8 43 37 00 00       	call   46b0 <exit>
+    printf(1, "nanosleep accepted bad tv_nsec\n");
+     f6d:	50                   	push   %eax
+     f6e:	50                   	push   %eax
+     f6f:	68 c4 67 00 00       	push   $0x67c4
+     f74:	6a 01                	push   $0x1
+     f76:	e8 45 41 00 00       	call   50c0 <printf>
+    exit();
+     f7b:	e8 30 37 00 00       	call   46b0 <exit>
+    printf(1, "nanosleep wait failed\n");
+     f80:	50                   	push   %eax
+     f81:	50                   	push   %eax
+     f82:	68 5d 57 00 00       	push   $0x575d
+     f87:	6a 01                	push   $0x1
+     f89:	e8 32 41 00 00       	call   50c0 <printf>
+    exit();
+     f8e:	e8 1d 37 00 00       	call   46b0 <exit>
+    nanosleep(&ts);
+     f93:	83 ec 0c             	sub    $0xc,%esp
+    ts.tv_nsec = 0;
+     f96:	31 db                	xor    %ebx,%ebx
+    ts.tv_sec = 1000;
+     f98:	c7 45 f0 e8 03 00 00 	movl   $0x3e8,-0x10(%ebp)
+    ts.tv_nsec = 0;
+     f9f:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+    nanosleep(&ts);
+     fa2:	56                   	push   %esi
+     fa3:	e8 e6 37 00 00       	call   478e <nanosleep>
+    exit();
+     fa8:	e8 03 37 00 00       	call   46b0 <exit>
+    printf(1, "nanosleep fork failed\n");
+     fad:	56                   	push   %esi
+     fae:	56                   	push   %esi
+     faf:	68 46 57 00 00       	push   $0x5746
+     fb4:	6a 01                	push   $0x1
+     fb6:	e8 05 41 00 00       	call   50c0 <printf>
+    exit();
+     fbb:	e8 f0 36 00 00       	call   46b0 <exit>
+
+00000fc0 <schedtest>:
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	56                   	push   %esi
+     fc4:	53                   	push   %ebx
+     fc5:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "sched test\n");
+     fc8:	68 87 57 00 00       	push   $0x5787
+     fcd:	6a 01                	push   $0x1
+     fcf:	e8 ec 40 00 00       	call   50c0 <printf>
+  if(setpriority(0, NICEMAX+1) != -1 || setpriority(0, NICEMIN-1) != -1){
+     fd4:	58                   	pop    %eax
+     fd5:	5a                   	pop    %edx
+     fd6:	6a 14                	push   $0x14
+     fd8:	6a 00                	push   $0x0
+     fda:	e8 b7 37 00 00       	call   4796 <setpriority>
+     fdf:	83 c4 10             	add    $0x10,%esp
+     fe2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fe5:	0f 85 69 02 00 00    	jne    1254 <schedtest+0x294>
+     feb:	83 ec 08             	sub    $0x8,%esp
+     fee:	6a eb                	push   $0xffffffeb
+     ff0:	6a 00                	push   $0x0
+     ff2:	e8 9f 37 00 00       	call   4796 <setpriority>
+     ff7:	83 c4 10             	add    $0x10,%esp
+     ffa:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ffd:	0f 85 51 02 00 00    	jne    1254 <schedtest+0x294>
+  if(sched_setattr(0, &attr) != -1){
+    1003:	83 ec 08             	sub    $0x8,%esp
+    1006:	8d 5d ec             	lea    -0x14(%ebp),%ebx
+  attr.policy = SCHED_RT;
+    1009:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+  attr.priority = NRTPRIO;
+    1010:	c7 45 f0 20 00 00 00 	movl   $0x20,-0x10(%ebp)
+  if(sched_setattr(0, &attr) != -1){
+    1017:	53                   	push   %ebx
+    1018:	6a 00                	push   $0x0
+    101a:	e8 7f 37 00 00       	call   479e <sched_setattr>
+    101f:	83 c4 10             	add    $0x10,%esp
+    1022:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1025:	0f 85 3c 02 00 00    	jne    1267 <schedtest+0x2a7>
+  if(setpriority(0, -1) != 0 || sched_getattr(0, &attr) != 0 ||
+    102b:	83 ec 08             	sub    $0x8,%esp
+    102e:	6a ff                	push   $0xffffffff
+    1030:	6a 00                	push   $0x0
+    1032:	e8 5f 37 00 00       	call   4796 <setpriority>
+    1037:	83 c4 10             	add    $0x10,%esp
+    103a:	85 c0                	test   %eax,%eax
+    103c:	0f 85 c3 01 00 00    	jne    1205 <schedtest+0x245>
+    1042:	83 ec 08             	sub    $0x8,%esp
+    1045:	53                   	push   %ebx
+    1046:	6a 00                	push   $0x0
+    1048:	e8 81 37 00 00       	call   47ce <sched_getattr>
+    104d:	83 c4 10             	add    $0x10,%esp
+    1050:	0b 45 ec             	or     -0x14(%ebp),%eax
+    1053:	0f 85 ac 01 00 00    	jne    1205 <schedtest+0x245>
+     attr.policy != SCHED_FAIR || attr.nice != -1){
+    1059:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    105d:	0f 85 a2 01 00 00    	jne    1205 <schedtest+0x245>
+  if(setpriority(0, 5) != 0 || sched_getattr(0, &attr) != 0 ||
+    1063:	83 ec 08             	sub    $0x8,%esp
+    1066:	6a 05                	push   $0x5
+    1068:	6a 00                	push   $0x0
+    106a:	e8 27 37 00 00       	call   4796 <setpriority>
+    106f:	83 c4 10             	add    $0x10,%esp
+    1072:	85 c0                	test   %eax,%eax
+    1074:	0f 85 b3 01 00 00    	jne    122d <schedtest+0x26d>
+    107a:	83 ec 08             	sub    $0x8,%esp
+    107d:	53                   	push   %ebx
+    107e:	6a 00                	push   $0x0
+    1080:	e8 49 37 00 00       	call   47ce <sched_getattr>
+    1085:	83 c4 10             	add    $0x10,%esp
+    1088:	85 c0                	test   %eax,%eax
+    108a:	0f 85 9d 01 00 00    	jne    122d <schedtest+0x26d>
+    1090:	83 7d f4 05          	cmpl   $0x5,-0xc(%ebp)
+    1094:	0f 85 93 01 00 00    	jne    122d <schedtest+0x26d>
+  if(sched_setattr(0, &attr) != 0 || sched_getattr(0, &attr) != 0 ||
+    109a:	83 ec 08             	sub    $0x8,%esp
+  attr.policy = SCHED_RT;
+    109d:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+  attr.priority = NRTPRIO-1;
+    10a4:	c7 45 f0 1f 00 00 00 	movl   $0x1f,-0x10(%ebp)
+  if(sched_setattr(0, &attr) != 0 || sched_getattr(0, &attr) != 0 ||
+    10ab:	53                   	push   %ebx
+    10ac:	6a 00                	push   $0x0
+    10ae:	e8 eb 36 00 00       	call   479e <sched_setattr>
+    10b3:	83 c4 10             	add    $0x10,%esp
+    10b6:	85 c0                	test   %eax,%eax
+    10b8:	0f 85 33 01 00 00    	jne    11f1 <schedtest+0x231>
+    10be:	83 ec 08             	sub    $0x8,%esp
+    10c1:	53                   	push   %ebx
+    10c2:	6a 00                	push   $0x0
+    10c4:	e8 05 37 00 00       	call   47ce <sched_getattr>
+    10c9:	83 c4 10             	add    $0x10,%esp
+    10cc:	85 c0                	test   %eax,%eax
+    10ce:	0f 85 1d 01 00 00    	jne    11f1 <schedtest+0x231>
+    10d4:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    10d8:	0f 85 13 01 00 00    	jne    11f1 <schedtest+0x231>
+     attr.policy != SCHED_RT || attr.priority != NRTPRIO-1){
+    10de:	83 7d f0 1f          	cmpl   $0x1f,-0x10(%ebp)
+    10e2:	0f 85 09 01 00 00    	jne    11f1 <schedtest+0x231>
+  pid = fork();
+    10e8:	e8 d9 35 00 00       	call   46c6 <fork>
+    10ed:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    10ef:	85 c0                	test   %eax,%eax
+    10f1:	0f 88 b5 01 00 00    	js     12ac <schedtest+0x2ec>
+  if(pid == 0){
+    10f7:	0f 84 7d 01 00 00    	je     127a <schedtest+0x2ba>
+  if(sched_yield() != 0 || wait() != pid){
+    10fd:	e8 a4 36 00 00       	call   47a6 <sched_yield>
+    1102:	85 c0                	test   %eax,%eax
+    1104:	0f 85 37 01 00 00    	jne    1241 <schedtest+0x281>
+    110a:	e8 bf 35 00 00       	call   46ce <wait>
+    110f:	39 f0                	cmp    %esi,%eax
+    1111:	0f 85 2a 01 00 00    	jne    1241 <schedtest+0x281>
+  if(sched_setaffinity(0, 0) != -1 || sched_setaffinity(0, 1) != 0 ||
+    1117:	83 ec 08             	sub    $0x8,%esp
+    111a:	6a 00                	push   $0x0
+    111c:	6a 00                	push   $0x0
+    111e:	e8 8b 36 00 00       	call   47ae <sched_setaffinity>
+    1123:	83 c4 10             	add    $0x10,%esp
+    1126:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1129:	0f 85 ae 00 00 00    	jne    11dd <schedtest+0x21d>
+    112f:	83 ec 08             	sub    $0x8,%esp
+    1132:	6a 01                	push   $0x1
+    1134:	6a 00                	push   $0x0
+    1136:	e8 73 36 00 00       	call   47ae <sched_setaffinity>
+    113b:	83 c4 10             	add    $0x10,%esp
+    113e:	85 c0                	test   %eax,%eax
+    1140:	0f 85 97 00 00 00    	jne    11dd <schedtest+0x21d>
+     sched_getaffinity(0) != 1 || sched_setaffinity(0, ~0) != 0 ||
+    1146:	83 ec 0c             	sub    $0xc,%esp
+    1149:	6a 00                	push   $0x0
+    114b:	e8 66 36 00 00       	call   47b6 <sched_getaffinity>
+  if(sched_setaffinity(0, 0) != -1 || sched_setaffinity(0, 1) != 0 ||
+    1150:	83 c4 10             	add    $0x10,%esp
+    1153:	83 f8 01             	cmp    $0x1,%eax
+    1156:	0f 85 81 00 00 00    	jne    11dd <schedtest+0x21d>
+     sched_getaffinity(0) != 1 || sched_setaffinity(0, ~0) != 0 ||
+    115c:	83 ec 08             	sub    $0x8,%esp
+    115f:	6a ff                	push   $0xffffffff
+    1161:	6a 00                	push   $0x0
+    1163:	e8 46 36 00 00       	call   47ae <sched_setaffinity>
+    1168:	83 c4 10             	add    $0x10,%esp
+    116b:	85 c0                	test   %eax,%eax
+    116d:	75 6e                	jne    11dd <schedtest+0x21d>
+     (sched_getaffinity(0) & 1) == 0){
+    116f:	83 ec 0c             	sub    $0xc,%esp
+    1172:	6a 00                	push   $0x0
+    1174:	e8 3d 36 00 00       	call   47b6 <sched_getaffinity>
+     sched_getaffinity(0) != 1 || sched_setaffinity(0, ~0) != 0 ||
+    1179:	83 c4 10             	add    $0x10,%esp
+    117c:	a8 01                	test   $0x1,%al
+    117e:	74 5d                	je     11dd <schedtest+0x21d>
+  if(sched_setattr(0, &attr) != 0 || sched_getattr(0, &attr) != 0 ||
+    1180:	83 ec 08             	sub    $0x8,%esp
+  attr.policy = SCHED_FAIR;
+    1183:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  attr.nice = -1;
+    118a:	c7 45 f4 ff ff ff ff 	movl   $0xffffffff,-0xc(%ebp)
+  if(sched_setattr(0, &attr) != 0 || sched_getattr(0, &attr) != 0 ||
+    1191:	53                   	push   %ebx
+    1192:	6a 00                	push   $0x0
+    1194:	e8 05 36 00 00       	call   479e <sched_setattr>
+    1199:	83 c4 10             	add    $0x10,%esp
+    119c:	85 c0                	test   %eax,%eax
+    119e:	75 79                	jne    1219 <schedtest+0x259>
+    11a0:	83 ec 08             	sub    $0x8,%esp
+    11a3:	53                   	push   %ebx
+    11a4:	6a 00                	push   $0x0
+    11a6:	e8 23 36 00 00       	call   47ce <sched_getattr>
+    11ab:	83 c4 10             	add    $0x10,%esp
+    11ae:	0b 45 ec             	or     -0x14(%ebp),%eax
+    11b1:	75 66                	jne    1219 <schedtest+0x259>
+     attr.policy != SCHED_FAIR || attr.nice != -1){
+    11b3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    11b7:	75 60                	jne    1219 <schedtest+0x259>
+  setpriority(0, 0);
+    11b9:	83 ec 08             	sub    $0x8,%esp
+    11bc:	6a 00                	push   $0x0
+    11be:	6a 00                	push   $0x0
+    11c0:	e8 d1 35 00 00       	call   4796 <setpriority>
+  printf(1, "sched test ok\n");
+    11c5:	58                   	pop    %eax
+    11c6:	5a                   	pop    %edx
+    11c7:	68 fd 57 00 00       	push   $0x57fd
+    11cc:	6a 01                	push   $0x1
+    11ce:	e8 ed 3e 00 00       	call   50c0 <printf>
+}
+    11d3:	83 c4 10             	add    $0x10,%esp
+    11d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11d9:	5b                   	pop    %ebx
+    11da:	5e                   	pop    %esi
+    11db:	5d                   	pop    %ebp
+    11dc:	c3                   	ret
+    printf(1, "sched affinity failed\n");
+    11dd:	83 ec 08             	sub    $0x8,%esp
+    11e0:	68 e6 57 00 00       	push   $0x57e6
+    11e5:	6a 01                	push   $0x1
+    11e7:	e8 d4 3e 00 00       	call   50c0 <printf>
+    exit();
+    11ec:	e8 bf 34 00 00       	call   46b0 <exit>
+    printf(1, "sched_setattr SCHED_RT failed\n");
+    11f1:	83 ec 08             	sub    $0x8,%esp
+    11f4:	68 2c 68 00 00       	push   $0x682c
+    11f9:	6a 01                	push   $0x1
+    11fb:	e8 c0 3e 00 00       	call   50c0 <printf>
+    exit();
+    1200:	e8 ab 34 00 00       	call   46b0 <exit>
+    printf(1, "setpriority -1 failed\n");
+    1205:	83 ec 08             	sub    $0x8,%esp
+    1208:	68 93 57 00 00       	push   $0x5793
+    120d:	6a 01                	push   $0x1
+    120f:	e8 ac 3e 00 00       	call   50c0 <printf>
+    exit();
+    1214:	e8 97 34 00 00       	call   46b0 <exit>
+    printf(1, "sched_setattr SCHED_FAIR failed\n");
+    1219:	83 ec 08             	sub    $0x8,%esp
+    121c:	68 70 68 00 00       	push   $0x6870
+    1221:	6a 01                	push   $0x1
+    1223:	e8 98 3e 00 00       	call   50c0 <printf>
+    exit();
+    1228:	e8 83 34 00 00       	call   46b0 <exit>
+    printf(1, "setpriority 5 failed\n");
+    122d:	83 ec 08             	sub    $0x8,%esp
+    1230:	68 aa 57 00 00       	push   $0x57aa
+    1235:	6a 01                	push   $0x1
+    1237:	e8 84 3e 00 00       	call   50c0 <printf>
+    exit();
+    123c:	e8 6f 34 00 00       	call   46b0 <exit>
+    printf(1, "sched wait failed\n");
+    1241:	51                   	push   %ecx
+    1242:	51                   	push   %ecx
+    1243:	68 d3 57 00 00       	push   $0x57d3
+    1248:	6a 01                	push   $0x1
+    124a:	e8 71 3e 00 00       	call   50c0 <printf>
+    exit();
+    124f:	e8 5c 34 00 00       	call   46b0 <exit>
+    printf(1, "setpriority accepted bad nice\n");
+    1254:	50                   	push   %eax
+    1255:	50                   	push   %eax
+    1256:	68 e4 67 00 00       	push   $0x67e4
+    125b:	6a 01                	push   $0x1
+    125d:	e8 5e 3e 00 00       	call   50c0 <printf>
+    exit();
+    1262:	e8 49 34 00 00       	call   46b0 <exit>
+    printf(1, "sched_setattr accepted bad priority\n");
+    1267:	50                   	push   %eax
+    1268:	50                   	push   %eax
+    1269:	68 04 68 00 00       	push   $0x6804
+    126e:	6a 01                	push   $0x1
+    1270:	e8 4b 3e 00 00       	call   50c0 <printf>
+    exit();
+    1275:	e8 36 34 00 00       	call   46b0 <exit>
+    if(sched_getattr(0, &attr) != 0 || attr.policy != SCHED_RT ||
+    127a:	56                   	push   %esi
+    127b:	56                   	push   %esi
+    127c:	53                   	push   %ebx
+    127d:	6a 00                	push   $0x0
+    127f:	e8 4a 35 00 00       	call   47ce <sched_getattr>
+    1284:	83 c4 10             	add    $0x10,%esp
+    1287:	85 c0                	test   %eax,%eax
+    1289:	75 06                	jne    1291 <schedtest+0x2d1>
+    128b:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    128f:	74 2e                	je     12bf <schedtest+0x2ff>
+      printf(1, "sched fork did not inherit class\n");
+    1291:	53                   	push   %ebx
+    1292:	53                   	push   %ebx
+    1293:	68 4c 68 00 00       	push   $0x684c
+    1298:	6a 01                	push   $0x1
+    129a:	e8 21 3e 00 00       	call   50c0 <printf>
+    129f:	83 c4 10             	add    $0x10,%esp
+    sched_yield();
+    12a2:	e8 ff 34 00 00       	call   47a6 <sched_yield>
+    exit();
+    12a7:	e8 04 34 00 00       	call   46b0 <exit>
+    printf(1, "sched fork failed\n");
+    12ac:	50                   	push   %eax
+    12ad:	50                   	push   %eax
+    12ae:	68 c0 57 00 00       	push   $0x57c0
+    12b3:	6a 01                	push   $0x1
+    12b5:	e8 06 3e 00 00       	call   50c0 <printf>
+    exit();
+    12ba:	e8 f1 33 00 00       	call   46b0 <exit>
+    if(sched_getattr(0, &attr) != 0 || attr.policy != SCHED_RT ||
+    12bf:	83 7d f0 1f          	cmpl   $0x1f,-0x10(%ebp)
+    12c3:	75 cc                	jne    1291 <schedtest+0x2d1>
+       attr.priority != NRTPRIO-1 || attr.nice != 5)
+    12c5:	83 7d f4 05          	cmpl   $0x5,-0xc(%ebp)
+    12c9:	75 c6                	jne    1291 <schedtest+0x2d1>
+    12cb:	eb d5                	jmp    12a2 <schedtest+0x2e2>
+    12cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012d0 <rusagetest>:
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	56                   	push   %esi
+    12d4:	53                   	push   %ebx
+    12d5:	83 ec 38             	sub    $0x38,%esp
+  printf(1, "rusage test\n");
+    12d8:	68 0c 58 00 00       	push   $0x580c
+    12dd:	6a 01                	push   $0x1
+    12df:	e8 dc 3d 00 00       	call   50c0 <printf>
+  if(getrusage(1, &ru0) != -1){
+    12e4:	5b                   	pop    %ebx
+    12e5:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+    12e8:	5e                   	pop    %esi
+    12e9:	53                   	push   %ebx
+    12ea:	6a 01                	push   $0x1
+    12ec:	e8 cd 34 00 00       	call   47be <getrusage>
+    12f1:	83 c4 10             	add    $0x10,%esp
+    12f4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12f7:	0f 85 9a 00 00 00    	jne    1397 <rusagetest+0xc7>
+  if(getrusage(RUSAGE_SELF, &ru0) != 0 ||
+    12fd:	83 ec 08             	sub    $0x8,%esp
+    1300:	53                   	push   %ebx
+    1301:	6a 00                	push   $0x0
+    1303:	e8 b6 34 00 00       	call   47be <getrusage>
+    1308:	83 c4 10             	add    $0x10,%esp
+    130b:	85 c0                	test   %eax,%eax
+    130d:	75 74                	jne    1383 <rusagetest+0xb3>
+     getrusage(RUSAGE_SELF, &ru1) != 0 ||
+    130f:	83 ec 08             	sub    $0x8,%esp
+    1312:	8d 75 e0             	lea    -0x20(%ebp),%esi
+    1315:	56                   	push   %esi
+    1316:	6a 00                	push   $0x0
+    1318:	e8 a1 34 00 00       	call   47be <getrusage>
+  if(getrusage(RUSAGE_SELF, &ru0) != 0 ||
+    131d:	83 c4 10             	add    $0x10,%esp
+    1320:	85 c0                	test   %eax,%eax
+    1322:	75 5f                	jne    1383 <rusagetest+0xb3>
+     ru1.ru_nsyscall != ru0.ru_nsyscall + 1){
+    1324:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    1327:	83 c0 01             	add    $0x1,%eax
+     getrusage(RUSAGE_SELF, &ru1) != 0 ||
+    132a:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    132d:	75 54                	jne    1383 <rusagetest+0xb3>
+  getrusage(RUSAGE_CHILDREN, &ru0);
+    132f:	83 ec 08             	sub    $0x8,%esp
+    1332:	53                   	push   %ebx
+    1333:	6a ff                	push   $0xffffffff
+    1335:	e8 84 34 00 00       	call   47be <getrusage>
+  pid = fork();
+    133a:	e8 87 33 00 00       	call   46c6 <fork>
+  if(pid < 0){
+    133f:	83 c4 10             	add    $0x10,%esp
+    1342:	85 c0                	test   %eax,%eax
+    1344:	0f 88 87 00 00 00    	js     13d1 <rusagetest+0x101>
+  if(pid == 0){
+    134a:	74 71                	je     13bd <rusagetest+0xed>
+  wait();
+    134c:	e8 7d 33 00 00       	call   46ce <wait>
+  getrusage(RUSAGE_CHILDREN, &ru1);
+    1351:	83 ec 08             	sub    $0x8,%esp
+    1354:	56                   	push   %esi
+    1355:	6a ff                	push   $0xffffffff
+    1357:	e8 62 34 00 00       	call   47be <getrusage>
+  if(ru1.ru_nsyscall < ru0.ru_nsyscall + 11){
+    135c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    135f:	83 c4 10             	add    $0x10,%esp
+    1362:	83 c0 0b             	add    $0xb,%eax
+    1365:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1368:	72 40                	jb     13aa <rusagetest+0xda>
+  printf(1, "rusage test ok\n");
+    136a:	83 ec 08             	sub    $0x8,%esp
+    136d:	68 7b 58 00 00       	push   $0x587b
+    1372:	6a 01                	push   $0x1
+    1374:	e8 47 3d 00 00       	call   50c0 <printf>
+}
+    1379:	83 c4 10             	add    $0x10,%esp
+    137c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    137f:	5b                   	pop    %ebx
+    1380:	5e                   	pop    %esi
+    1381:	5d                   	pop    %ebp
+    1382:	c3                   	ret
+    printf(1, "getrusage self failed\n");
+    1383:	83 ec 08             	sub    $0x8,%esp
+    1386:	68 35 58 00 00       	push   $0x5835
+    138b:	6a 01                	push   $0x1
+    138d:	e8 2e 3d 00 00       	call   50c0 <printf>
+    exit();
+    1392:	e8 19 33 00 00       	call   46b0 <exit>
+    printf(1, "getrusage accepted bad who\n");
+    1397:	51                   	push   %ecx
+    1398:	51                   	push   %ecx
+    1399:	68 19 58 00 00       	push   $0x5819
+    139e:	6a 01                	push   $0x1
+    13a0:	e8 1b 3d 00 00       	call   50c0 <printf>
+    exit();
+    13a5:	e8 06 33 00 00       	call   46b0 <exit>
+    printf(1, "getrusage children failed\n");
+    13aa:	50                   	push   %eax
+    13ab:	50                   	push   %eax
+    13ac:	68 60 58 00 00       	push   $0x5860
+    13b1:	6a 01                	push   $0x1
+    13b3:	e8 08 3d 00 00       	call   50c0 <printf>
+    exit();
+    13b8:	e8 f3 32 00 00       	call   46b0 <exit>
+    13bd:	bb 0a 00 00 00       	mov    $0xa,%ebx
+      getpid();
+    13c2:	e8 7f 33 00 00       	call   4746 <getpid>
+    for(i = 0; i < 10; i++)
+    13c7:	83 eb 01             	sub    $0x1,%ebx
+    13ca:	75 f6                	jne    13c2 <rusagetest+0xf2>
+    exit();
+    13cc:	e8 df 32 00 00       	call   46b0 <exit>
+    printf(1, "rusage fork failed\n");
+    13d1:	52                   	push   %edx
+    13d2:	52                   	push   %edx
+    13d3:	68 4c 58 00 00       	push   $0x584c
+    13d8:	6a 01                	push   $0x1
+    13da:	e8 e1 3c 00 00       	call   50c0 <printf>
+    exit();
+    13df:	e8 cc 32 00 00       	call   46b0 <exit>
+    13e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13ef:	90                   	nop
+
+000013f0 <iovtest>:
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	57                   	push   %edi
+    13f4:	56                   	push   %esi
+    13f5:	53                   	push   %ebx
+    13f6:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "iov test\n");
+    13f9:	68 8b 58 00 00       	push   $0x588b
+    13fe:	6a 01                	push   $0x1
+    1400:	e8 bb 3c 00 00       	call   50c0 <printf>
+  iov[0].iov_base = "hello";
+    1405:	c7 45 d0 95 58 00 00 	movl   $0x5895,-0x30(%ebp)
+  iov[0].iov_len = 5;
+    140c:	c7 45 d4 05 00 00 00 	movl   $0x5,-0x2c(%ebp)
+  iov[1].iov_base = "";
+    1413:	c7 45 d8 ec 59 00 00 	movl   $0x59ec,-0x28(%ebp)
+  iov[1].iov_len = 0;
+    141a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  iov[2].iov_base = " world!!!";
+    1421:	c7 45 e0 9b 58 00 00 	movl   $0x589b,-0x20(%ebp)
+  iov[2].iov_len = 9;
+    1428:	c7 45 e4 09 00 00 00 	movl   $0x9,-0x1c(%ebp)
+  fd = open("iovfile", O_CREATE|O_RDWR);
+    142f:	5e                   	pop    %esi
+    1430:	5f                   	pop    %edi
+    1431:	68 02 02 00 00       	push   $0x202
+    1436:	68 a5 58 00 00       	push   $0x58a5
+    143b:	e8 c6 32 00 00       	call   4706 <open>
+  if(fd < 0){
+    1440:	83 c4 10             	add    $0x10,%esp
+    1443:	85 c0                	test   %eax,%eax
+    1445:	0f 88 30 02 00 00    	js     167b <iovtest+0x28b>
+  if((n = writev(fd, iov, 3)) != 14){
+    144b:	83 ec 04             	sub    $0x4,%esp
+    144e:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+    1451:	89 c6                	mov    %eax,%esi
+    1453:	6a 03                	push   $0x3
+    1455:	53                   	push   %ebx
+    1456:	50                   	push   %eax
+    1457:	e8 2a 33 00 00       	call   4786 <writev>
+    145c:	83 c4 10             	add    $0x10,%esp
+    145f:	83 f8 0e             	cmp    $0xe,%eax
+    1462:	0f 85 00 02 00 00    	jne    1668 <iovtest+0x278>
+  close(fd);
+    1468:	83 ec 0c             	sub    $0xc,%esp
+  iov[0].iov_base = a;
+    146b:	8d 7d b7             	lea    -0x49(%ebp),%edi
+  close(fd);
+    146e:	56                   	push   %esi
+  iov[1].iov_base = b;
+    146f:	8d 75 c6             	lea    -0x3a(%ebp),%esi
+  close(fd);
+    1472:	e8 77 32 00 00       	call   46ee <close>
+  fd = open("iovfile", O_RDONLY);
+    1477:	58                   	pop    %eax
+    1478:	5a                   	pop    %edx
+    1479:	6a 00                	push   $0x0
+    147b:	68 a5 58 00 00       	push   $0x58a5
+    1480:	e8 81 32 00 00       	call   4706 <open>
+  if((n = readv(fd, iov, 2)) != 14){
+    1485:	83 c4 0c             	add    $0xc,%esp
+  iov[0].iov_base = a;
+    1488:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  iov[0].iov_len = sizeof(a);
+    148b:	c7 45 d4 05 00 00 00 	movl   $0x5,-0x2c(%ebp)
+  iov[1].iov_base = b;
+    1492:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  iov[1].iov_len = sizeof(b);
+    1495:	c7 45 dc 0a 00 00 00 	movl   $0xa,-0x24(%ebp)
+  if((n = readv(fd, iov, 2)) != 14){
+    149c:	6a 02                	push   $0x2
+    149e:	53                   	push   %ebx
+    149f:	50                   	push   %eax
+    14a0:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+    14a3:	e8 d6 32 00 00       	call   477e <readv>
+    14a8:	83 c4 10             	add    $0x10,%esp
+    14ab:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    14ae:	83 f8 0e             	cmp    $0xe,%eax
+    14b1:	0f 85 9e 01 00 00    	jne    1655 <iovtest+0x265>
+    if(*p++ != *q++)
+    14b7:	80 7d b7 68          	cmpb   $0x68,-0x49(%ebp)
+    14bb:	0f 85 65 01 00 00    	jne    1626 <iovtest+0x236>
+    14c1:	b8 01 00 00 00       	mov    $0x1,%eax
+    14c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14cd:	8d 76 00             	lea    0x0(%esi),%esi
+    14d0:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+    14d4:	83 c0 01             	add    $0x1,%eax
+    14d7:	3a 88 94 58 00 00    	cmp    0x5894(%eax),%cl
+    14dd:	0f 85 43 01 00 00    	jne    1626 <iovtest+0x236>
+  while(n-- > 0)
+    14e3:	83 f8 05             	cmp    $0x5,%eax
+    14e6:	75 e8                	jne    14d0 <iovtest+0xe0>
+    14e8:	31 c0                	xor    %eax,%eax
+    14ea:	eb 17                	jmp    1503 <iovtest+0x113>
+    14ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(*p++ != *q++)
+    14f0:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+    14f4:	83 c0 01             	add    $0x1,%eax
+    14f7:	3a 88 9a 58 00 00    	cmp    0x589a(%eax),%cl
+    14fd:	0f 85 23 01 00 00    	jne    1626 <iovtest+0x236>
+  while(n-- > 0)
+    1503:	83 f8 09             	cmp    $0x9,%eax
+    1506:	75 e8                	jne    14f0 <iovtest+0x100>
+  close(fd);
+    1508:	83 ec 0c             	sub    $0xc,%esp
+    150b:	52                   	push   %edx
+    150c:	e8 dd 31 00 00       	call   46ee <close>
+  unlink("iovfile");
+    1511:	c7 04 24 a5 58 00 00 	movl   $0x58a5,(%esp)
+    1518:	e8 f9 31 00 00       	call   4716 <unlink>
+  if(pipe(fds) != 0){
+    151d:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    1520:	89 04 24             	mov    %eax,(%esp)
+    1523:	e8 ae 31 00 00       	call   46d6 <pipe>
+    1528:	83 c4 10             	add    $0x10,%esp
+    152b:	85 c0                	test   %eax,%eax
+    152d:	0f 85 6e 01 00 00    	jne    16a1 <iovtest+0x2b1>
+  if(writev(fds[1], iov, 2) != 7){
+    1533:	83 ec 04             	sub    $0x4,%esp
+  iov[0].iov_base = "abc";
+    1536:	c7 45 d0 7f 56 00 00 	movl   $0x567f,-0x30(%ebp)
+  iov[0].iov_len = 3;
+    153d:	c7 45 d4 03 00 00 00 	movl   $0x3,-0x2c(%ebp)
+  iov[1].iov_base = "defg";
+    1544:	c7 45 d8 2f 59 00 00 	movl   $0x592f,-0x28(%ebp)
+  iov[1].iov_len = 4;
+    154b:	c7 45 dc 04 00 00 00 	movl   $0x4,-0x24(%ebp)
+  if(writev(fds[1], iov, 2) != 7){
+    1552:	6a 02                	push   $0x2
+    1554:	53                   	push   %ebx
+    1555:	ff 75 c0             	push   -0x40(%ebp)
+    1558:	e8 29 32 00 00       	call   4786 <writev>
+    155d:	83 c4 10             	add    $0x10,%esp
+    1560:	83 f8 07             	cmp    $0x7,%eax
+    1563:	0f 85 25 01 00 00    	jne    168e <iovtest+0x29e>
+  if((n = readv(fds[0], iov, 2)) != 7 || !bufeq(a, "ab", 2) ||
+    1569:	83 ec 04             	sub    $0x4,%esp
+  iov[0].iov_base = a;
+    156c:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  iov[0].iov_len = 2;
+    156f:	c7 45 d4 02 00 00 00 	movl   $0x2,-0x2c(%ebp)
+  iov[1].iov_base = b;
+    1576:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  iov[1].iov_len = sizeof(b);
+    1579:	c7 45 dc 0a 00 00 00 	movl   $0xa,-0x24(%ebp)
+  if((n = readv(fds[0], iov, 2)) != 7 || !bufeq(a, "ab", 2) ||
+    1580:	6a 02                	push   $0x2
+    1582:	53                   	push   %ebx
+    1583:	ff 75 bc             	push   -0x44(%ebp)
+    1586:	e8 f3 31 00 00       	call   477e <readv>
+    158b:	83 c4 10             	add    $0x10,%esp
+    158e:	83 f8 07             	cmp    $0x7,%eax
+    1591:	0f 85 a9 00 00 00    	jne    1640 <iovtest+0x250>
+    if(*p++ != *q++)
+    1597:	80 7d b7 61          	cmpb   $0x61,-0x49(%ebp)
+    159b:	0f 85 9f 00 00 00    	jne    1640 <iovtest+0x250>
+    15a1:	80 7d b8 62          	cmpb   $0x62,-0x48(%ebp)
+    15a5:	0f 85 95 00 00 00    	jne    1640 <iovtest+0x250>
+    15ab:	80 7d c6 63          	cmpb   $0x63,-0x3a(%ebp)
+    15af:	0f 85 8b 00 00 00    	jne    1640 <iovtest+0x250>
+    15b5:	ba 01 00 00 00       	mov    $0x1,%edx
+    15ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    15c0:	0f b6 0c 16          	movzbl (%esi,%edx,1),%ecx
+    15c4:	83 c2 01             	add    $0x1,%edx
+    15c7:	3a 8a 2d 59 00 00    	cmp    0x592d(%edx),%cl
+    15cd:	75 71                	jne    1640 <iovtest+0x250>
+  while(n-- > 0)
+    15cf:	83 fa 05             	cmp    $0x5,%edx
+    15d2:	75 ec                	jne    15c0 <iovtest+0x1d0>
+  close(fds[0]);
+    15d4:	83 ec 0c             	sub    $0xc,%esp
+    15d7:	ff 75 bc             	push   -0x44(%ebp)
+    15da:	e8 0f 31 00 00       	call   46ee <close>
+  close(fds[1]);
+    15df:	58                   	pop    %eax
+    15e0:	ff 75 c0             	push   -0x40(%ebp)
+    15e3:	e8 06 31 00 00       	call   46ee <close>
+  if(writev(1, iov, 1) != -1){
+    15e8:	83 c4 0c             	add    $0xc,%esp
+  iov[0].iov_base = (char*)0xffffff00;
+    15eb:	c7 45 d0 00 ff ff ff 	movl   $0xffffff00,-0x30(%ebp)
+  iov[0].iov_len = 16;
+    15f2:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+  if(writev(1, iov, 1) != -1){
+    15f9:	6a 01                	push   $0x1
+    15fb:	53                   	push   %ebx
+    15fc:	6a 01                	push   $0x1
+    15fe:	e8 83 31 00 00       	call   4786 <writev>
+    1603:	83 c4 10             	add    $0x10,%esp
+    1606:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1609:	0f 85 a5 00 00 00    	jne    16b4 <iovtest+0x2c4>
+  printf(1, "iov test ok\n");
+    160f:	83 ec 08             	sub    $0x8,%esp
+    1612:	68 50 59 00 00       	push   $0x5950
+    1617:	6a 01                	push   $0x1
+    1619:	e8 a2 3a 00 00       	call   50c0 <printf>
+}
+    161e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1621:	5b                   	pop    %ebx
+    1622:	5e                   	pop    %esi
+    1623:	5f                   	pop    %edi
+    1624:	5d                   	pop    %ebp
+    1625:	c3                   	ret
+    printf(1, "iov readv wrong data\n");
+    1626:	56                   	push   %esi
+    1627:	56                   	push   %esi
+    1628:	68 ef 58 00 00       	push   $0x58ef
+    162d:	6a 01                	push   $0x1
+    162f:	e8 8c 3a 00 00       	call   50c0 <printf>
+    exit();
+    1634:	e8 77 30 00 00       	call   46b0 <exit>
+    1639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "iov pipe readv returned %d\n", n);
+    1640:	83 ec 04             	sub    $0x4,%esp
+    1643:	50                   	push   %eax
+    1644:	68 34 59 00 00       	push   $0x5934
+    1649:	6a 01                	push   $0x1
+    164b:	e8 70 3a 00 00       	call   50c0 <printf>
+    exit();
+    1650:	e8 5b 30 00 00       	call   46b0 <exit>
+    printf(1, "iov readv returned %d\n", n);
+    1655:	57                   	push   %edi
+    1656:	50                   	push   %eax
+    1657:	68 d8 58 00 00       	push   $0x58d8
+    165c:	6a 01                	push   $0x1
+    165e:	e8 5d 3a 00 00       	call   50c0 <printf>
+    exit();
+    1663:	e8 48 30 00 00       	call   46b0 <exit>
+    printf(1, "iov writev returned %d\n", n);
+    1668:	51                   	push   %ecx
+    1669:	50                   	push   %eax
+    166a:	68 c0 58 00 00       	push   $0x58c0
+    166f:	6a 01                	push   $0x1
+    1671:	e8 4a 3a 00 00       	call   50c0 <printf>
+    exit();
+    1676:	e8 35 30 00 00       	call   46b0 <exit>
+    printf(1, "iov create failed\n");
+    167b:	53                   	push   %ebx
+    167c:	53                   	push   %ebx
+    167d:	68 ad 58 00 00       	push   $0x58ad
+    1682:	6a 01                	push   $0x1
+    1684:	e8 37 3a 00 00       	call   50c0 <printf>
+    exit();
+    1689:	e8 22 30 00 00       	call   46b0 <exit>
+    printf(1, "iov pipe writev failed\n");
+    168e:	51                   	push   %ecx
+    168f:	51                   	push   %ecx
+    1690:	68 16 59 00 00       	push   $0x5916
+    1695:	6a 01                	push   $0x1
+    1697:	e8 24 3a 00 00       	call   50c0 <printf>
+    exit();
+    169c:	e8 0f 30 00 00       	call   46b0 <exit>
+    printf(1, "iov pipe failed\n");
+    16a1:	53                   	push   %ebx
+    16a2:	53                   	push   %ebx
+    16a3:	68 05 59 00 00       	push   $0x5905
+    16a8:	6a 01                	push   $0x1
+    16aa:	e8 11 3a 00 00       	call   50c0 <printf>
+    exit();
+    16af:	e8 fc 2f 00 00       	call   46b0 <exit>
+    printf(1, "iov writev of bad segment succeeded\n");
+    16b4:	52                   	push   %edx
+    16b5:	52                   	push   %edx
+    16b6:	68 94 68 00 00       	push   $0x6894
+    16bb:	6a 01                	push   $0x1
+    16bd:	e8 fe 39 00 00       	call   50c0 <printf>
+    exit();
+    16c2:	e8 e9 2f 00 00       	call   46b0 <exit>
+    16c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ce:	66 90                	xchg   %ax,%ax
+
+000016d0 <preempt>:
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	57                   	push   %edi
+    16d4:	56                   	push   %esi
+    16d5:	53                   	push   %ebx
+    16d6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    16d9:	68 5d 59 00 00       	push   $0x595d
+    16de:	6a 01                	push   $0x1
+    16e0:	e8 db 39 00 00       	call   50c0 <printf>
+  pid1 = fork();
+    16e5:	e8 dc 2f 00 00       	call   46c6 <fork>
+  if(pid1 == 0)
+    16ea:	83 c4 10             	add    $0x10,%esp
+    16ed:	85 c0                	test   %eax,%eax
+    16ef:	75 07                	jne    16f8 <preempt+0x28>
+    for(;;)
+    16f1:	eb fe                	jmp    16f1 <preempt+0x21>
+    16f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16f7:	90                   	nop
+    16f8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    16fa:	e8 c7 2f 00 00       	call   46c6 <fork>
+    16ff:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    1701:	85 c0                	test   %eax,%eax
+    1703:	75 0b                	jne    1710 <preempt+0x40>
+    for(;;)
+    1705:	eb fe                	jmp    1705 <preempt+0x35>
+    1707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    170e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    1710:	83 ec 0c             	sub    $0xc,%esp
+    1713:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1716:	50                   	push   %eax
+    1717:	e8 ba 2f 00 00       	call   46d6 <pipe>
+  pid3 = fork();
+    171c:	e8 a5 2f 00 00       	call   46c6 <fork>
+  if(pid3 == 0){
+    1721:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    1724:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    1726:	85 c0                	test   %eax,%eax
+    1728:	75 3e                	jne    1768 <preempt+0x98>
+    close(pfds[0]);
+    172a:	83 ec 0c             	sub    $0xc,%esp
+    172d:	ff 75 e0             	push   -0x20(%ebp)
+    1730:	e8 b9 2f 00 00       	call   46ee <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1735:	83 c4 0c             	add    $0xc,%esp
+    1738:	6a 01                	push   $0x1
+    173a:	68 1d 5d 00 00       	push   $0x5d1d
+    173f:	ff 75 e4             	push   -0x1c(%ebp)
+    1742:	e8 9f 2f 00 00       	call   46e6 <write>
+    1747:	83 c4 10             	add    $0x10,%esp
+    174a:	83 f8 01             	cmp    $0x1,%eax
+    174d:	0f 85 be 00 00 00    	jne    1811 <preempt+0x141>
+    close(pfds[1]);
+    1753:	83 ec 0c             	sub    $0xc,%esp
+    1756:	ff 75 e4             	push   -0x1c(%ebp)
+    1759:	e8 90 2f 00 00       	call   46ee <close>
+    175e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    1761:	eb fe                	jmp    1761 <preempt+0x91>
+    1763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1767:	90                   	nop
+  close(pfds[1]);
+    1768:	83 ec 0c             	sub    $0xc,%esp
+    176b:	ff 75 e4             	push   -0x1c(%ebp)
+    176e:	e8 7b 2f 00 00       	call   46ee <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    1773:	83 c4 0c             	add    $0xc,%esp
+    1776:	68 00 20 00 00       	push   $0x2000
+    177b:	68 80 a3 00 00       	push   $0xa380
+    1780:	ff 75 e0             	push   -0x20(%ebp)
+    1783:	e8 56 2f 00 00       	call   46de <read>
+    1788:	83 c4 10             	add    $0x10,%esp
+    178b:	83 f8 01             	cmp    $0x1,%eax
+    178e:	75 6d                	jne    17fd <preempt+0x12d>
+  close(pfds[0]);
+    1790:	83 ec 0c             	sub    $0xc,%esp
+    1793:	ff 75 e0             	push   -0x20(%ebp)
+    1796:	e8 53 2f 00 00       	call   46ee <close>
+  printf(1, "kill... ");
+    179b:	58                   	pop    %eax
+    179c:	5a                   	pop    %edx
+    179d:	68 8e 59 00 00       	push   $0x598e
+    17a2:	6a 01                	push   $0x1
+    17a4:	e8 17 39 00 00       	call   50c0 <printf>
+  kill(pid1, SIGKILL);
+    17a9:	59                   	pop    %ecx
+    17aa:	58                   	pop    %eax
+    17ab:	6a 09                	push   $0x9
+    17ad:	53                   	push   %ebx
+    17ae:	e8 43 2f 00 00       	call   46f6 <kill>
+  kill(pid2, SIGKILL);
+    17b3:	58                   	pop    %eax
+    17b4:	5a                   	pop    %edx
+    17b5:	6a 09                	push   $0x9
+    17b7:	56                   	push   %esi
+    17b8:	e8 39 2f 00 00       	call   46f6 <kill>
+  kill(pid3, SIGKILL);
+    17bd:	59                   	pop    %ecx
+    17be:	5b                   	pop    %ebx
+    17bf:	6a 09                	push   $0x9
+    17c1:	57                   	push   %edi
+    17c2:	e8 2f 2f 00 00       	call   46f6 <kill>
+  printf(1, "wait... ");
+    17c7:	5e                   	pop    %esi
+    17c8:	5f                   	pop    %edi
+    17c9:	68 97 59 00 00       	push   $0x5997
+    17ce:	6a 01                	push   $0x1
+    17d0:	e8 eb 38 00 00       	call   50c0 <printf>
+  wait();
+    17d5:	e8 f4 2e 00 00       	call   46ce <wait>
+  wait();
+    17da:	e8 ef 2e 00 00       	call   46ce <wait>
+  wait();
+    17df:	e8 ea 2e 00 00       	call   46ce <wait>
+  printf(1, "preempt ok\n");
+    17e4:	58                   	pop    %eax
+    17e5:	5a                   	pop    %edx
+    17e6:	68 a0 59 00 00       	push   $0x59a0
+    17eb:	6a 01                	push   $0x1
+    17ed:	e8 ce 38 00 00       	call   50c0 <printf>
+    17f2:	83 c4 10             	add    $0x10,%esp
+}
+    17f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17f8:	5b                   	pop    %ebx
+    17f9:	5e                   	pop    %esi
+    17fa:	5f                   	pop    %edi
+    17fb:	5d                   	pop    %ebp
+    17fc:	c3                   	ret
+    printf(1, "preempt read error");
+    17fd:	83 ec 08             	sub    $0x8,%esp
+    1800:	68 7b 59 00 00       	push   $0x597b
+    1805:	6a 01                	push   $0x1
+    1807:	e8 b4 38 00 00       	call   50c0 <printf>
+    180c:	83 c4 10             	add    $0x10,%esp
+    180f:	eb e4                	jmp    17f5 <preempt+0x125>
+      printf(1, "preempt write error");
+    1811:	83 ec 08             	sub    $0x8,%esp
+    1814:	68 67 59 00 00       	push   $0x5967
+    1819:	6a 01                	push   $0x1
+    181b:	e8 a0 38 00 00       	call   50c0 <printf>
+    1820:	83 c4 10             	add    $0x10,%esp
+    1823:	e9 2b ff ff ff       	jmp    1753 <preempt+0x83>
+    1828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182f:	90                   	nop
+
+00001830 <exitwait>:
+{
+    1830:	55                   	push   %ebp
+    1831:	89 e5                	mov    %esp,%ebp
+    1833:	56                   	push   %esi
+    1834:	be 64 00 00 00       	mov    $0x64,%esi
+    1839:	53                   	push   %ebx
+    183a:	eb 14                	jmp    1850 <exitwait+0x20>
+    183c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    1840:	74 68                	je     18aa <exitwait+0x7a>
+      if(wait() != pid){
+    1842:	e8 87 2e 00 00       	call   46ce <wait>
+    1847:	39 d8                	cmp    %ebx,%eax
+    1849:	75 2d                	jne    1878 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    184b:	83 ee 01             	sub    $0x1,%esi
+    184e:	74 41                	je     1891 <exitwait+0x61>
+    pid = fork();
+    1850:	e8 71 2e 00 00       	call   46c6 <fork>
+    1855:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1857:	85 c0                	test   %eax,%eax
+    1859:	79 e5                	jns    1840 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    185b:	83 ec 08             	sub    $0x8,%esp
+    185e:	68 c0 65 00 00       	push   $0x65c0
+    1863:	6a 01                	push   $0x1
+    1865:	e8 56 38 00 00       	call   50c0 <printf>
+      return;
+    186a:	83 c4 10             	add    $0x10,%esp
+}
+    186d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1870:	5b                   	pop    %ebx
+    1871:	5e                   	pop    %esi
+    1872:	5d                   	pop    %ebp
+    1873:	c3                   	ret
+    1874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    1878:	83 ec 08             	sub    $0x8,%esp
+    187b:	68 ac 59 00 00       	push   $0x59ac
+    1880:	6a 01                	push   $0x1
+    1882:	e8 39 38 00 00       	call   50c0 <printf>
+        return;
+    1887:	83 c4 10             	add    $0x10,%esp
+}
+    188a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    188d:	5b                   	pop    %ebx
+    188e:	5e                   	pop    %esi
+    188f:	5d                   	pop    %ebp
+    1890:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1891:	83 ec 08             	sub    $0x8,%esp
+    1894:	68 bc 59 00 00       	push   $0x59bc
+    1899:	6a 01                	push   $0x1
+    189b:	e8 20 38 00 00       	call   50c0 <printf>
+    18a0:	83 c4 10             	add    $0x10,%esp
+}
+    18a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    18a6:	5b                   	pop    %ebx
+    18a7:	5e                   	pop    %esi
+    18a8:	5d                   	pop    %ebp
+    18a9:	c3                   	ret
+      exit();
+    18aa:	e8 01 2e 00 00       	call   46b0 <exit>
+    18af:	90                   	nop
+
+000018b0 <mem>:
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	56                   	push   %esi
+    18b4:	31 f6                	xor    %esi,%esi
+    18b6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    18b7:	83 ec 08             	sub    $0x8,%esp
+    18ba:	68 c9 59 00 00       	push   $0x59c9
+    18bf:	6a 01                	push   $0x1
+    18c1:	e8 fa 37 00 00       	call   50c0 <printf>
+  ppid = getpid();
+    18c6:	e8 7b 2e 00 00       	call   4746 <getpid>
+    18cb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    18cd:	e8 f4 2d 00 00       	call   46c6 <fork>
+    18d2:	83 c4 10             	add    $0x10,%esp
+    18d5:	85 c0                	test   %eax,%eax
+    18d7:	74 0b                	je     18e4 <mem+0x34>
+    18d9:	e9 92 00 00 00       	jmp    1970 <mem+0xc0>
+    18de:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    18e0:	89 30                	mov    %esi,(%eax)
+    18e2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    18e4:	83 ec 0c             	sub    $0xc,%esp
+    18e7:	68 11 27 00 00       	push   $0x2711
+    18ec:	e8 ef 38 00 00       	call   51e0 <malloc>
+    18f1:	83 c4 10             	add    $0x10,%esp
+    18f4:	85 c0                	test   %eax,%eax
+    18f6:	75 e8                	jne    18e0 <mem+0x30>
+    while(m1){
+    18f8:	85 f6                	test   %esi,%esi
+    18fa:	74 18                	je     1914 <mem+0x64>
+    18fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1900:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1902:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1905:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1907:	50                   	push   %eax
+    1908:	e8 43 38 00 00       	call   5150 <free>
+    while(m1){
+    190d:	83 c4 10             	add    $0x10,%esp
+    1910:	85 f6                	test   %esi,%esi
+    1912:	75 ec                	jne    1900 <mem+0x50>
+    m1 = malloc(1024*20);
+    1914:	83 ec 0c             	sub    $0xc,%esp
+    1917:	68 00 50 00 00       	push   $0x5000
+    191c:	e8 bf 38 00 00       	call   51e0 <malloc>
+    if(m1 == 0){
+    1921:	83 c4 10             	add    $0x10,%esp
+    1924:	85 c0                	test   %eax,%eax
+    1926:	74 20                	je     1948 <mem+0x98>
+    free(m1);
+    1928:	83 ec 0c             	sub    $0xc,%esp
+    192b:	50                   	push   %eax
+    192c:	e8 1f 38 00 00       	call   5150 <free>
+    printf(1, "mem ok\n");
+    1931:	58                   	pop    %eax
+    1932:	5a                   	pop    %edx
+    1933:	68 ed 59 00 00       	push   $0x59ed
+    1938:	6a 01                	push   $0x1
+    193a:	e8 81 37 00 00       	call   50c0 <printf>
+    exit();
+    193f:	e8 6c 2d 00 00       	call   46b0 <exit>
+    1944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1948:	83 ec 08             	sub    $0x8,%esp
+    194b:	68 d3 59 00 00       	push   $0x59d3
+    1950:	6a 01                	push   $0x1
+    1952:	e8 69 37 00 00       	call   50c0 <printf>
+      kill(ppid, SIGKILL);
+    1957:	59                   	pop    %ecx
+    1958:	5e                   	pop    %esi
+    1959:	6a 09                	push   $0x9
+    195b:	53                   	push   %ebx
+    195c:	e8 95 2d 00 00       	call   46f6 <kill>
+      exit();
+    1961:	e8 4a 2d 00 00       	call   46b0 <exit>
+    1966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1970:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1973:	5b                   	pop    %ebx
+    1974:	5e                   	pop    %esi
+    1975:	5d                   	pop    %ebp
+    wait();
+    1976:	e9 53 2d 00 00       	jmp    46ce <wait>
+    197b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    197f:	90                   	nop
+
+00001980 <sharedfd>:
+{
+    1980:	55                   	push   %ebp
+    1981:	89 e5                	mov    %esp,%ebp
+    1983:	57                   	push   %edi
+    1984:	56                   	push   %esi
+    1985:	53                   	push   %ebx
+    1986:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1989:	68 f5 59 00 00       	push   $0x59f5
+    198e:	6a 01                	push   $0x1
+    1990:	e8 2b 37 00 00       	call   50c0 <printf>
+  unlink("sharedfd");
+    1995:	c7 04 24 04 5a 00 00 	movl   $0x5a04,(%esp)
+    199c:	e8 75 2d 00 00       	call   4716 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    19a1:	5b                   	pop    %ebx
+    19a2:	5e                   	pop    %esi
+    19a3:	68 02 02 00 00       	push   $0x202
+    19a8:	68 04 5a 00 00       	push   $0x5a04
+    19ad:	e8 54 2d 00 00       	call   4706 <open>
+  if(fd < 0){
+    19b2:	83 c4 10             	add    $0x10,%esp
+    19b5:	85 c0                	test   %eax,%eax
+    19b7:	0f 88 2a 01 00 00    	js     1ae7 <sharedfd+0x167>
+    19bd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    19bf:	8d 75 de             	lea    -0x22(%ebp),%esi
+    19c2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    19c7:	e8 fa 2c 00 00       	call   46c6 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    19cc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    19cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    19d2:	19 c0                	sbb    %eax,%eax
+    19d4:	83 ec 04             	sub    $0x4,%esp
+    19d7:	83 e0 f3             	and    $0xfffffff3,%eax
+    19da:	6a 0a                	push   $0xa
+    19dc:	83 c0 70             	add    $0x70,%eax
+    19df:	50                   	push   %eax
+    19e0:	56                   	push   %esi
+    19e1:	e8 4a 2b 00 00       	call   4530 <memset>
+    19e6:	83 c4 10             	add    $0x10,%esp
+    19e9:	eb 0a                	jmp    19f5 <sharedfd+0x75>
+    19eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19ef:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    19f0:	83 eb 01             	sub    $0x1,%ebx
+    19f3:	74 26                	je     1a1b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    19f5:	83 ec 04             	sub    $0x4,%esp
+    19f8:	6a 0a                	push   $0xa
+    19fa:	56                   	push   %esi
+    19fb:	57                   	push   %edi
+    19fc:	e8 e5 2c 00 00       	call   46e6 <write>
+    1a01:	83 c4 10             	add    $0x10,%esp
+    1a04:	83 f8 0a             	cmp    $0xa,%eax
+    1a07:	74 e7                	je     19f0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1a09:	83 ec 08             	sub    $0x8,%esp
+    1a0c:	68 e8 68 00 00       	push   $0x68e8
+    1a11:	6a 01                	push   $0x1
+    1a13:	e8 a8 36 00 00       	call   50c0 <printf>
+      break;
+    1a18:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    1a1b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1a1e:	85 c9                	test   %ecx,%ecx
+    1a20:	0f 84 f5 00 00 00    	je     1b1b <sharedfd+0x19b>
+    wait();
+    1a26:	e8 a3 2c 00 00       	call   46ce <wait>
+  close(fd);
+    1a2b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    1a2e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1a30:	57                   	push   %edi
+    1a31:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1a34:	e8 b5 2c 00 00       	call   46ee <close>
+  fd = open("sharedfd", 0);
+    1a39:	58                   	pop    %eax
+    1a3a:	5a                   	pop    %edx
+    1a3b:	6a 00                	push   $0x0
+    1a3d:	68 04 5a 00 00       	push   $0x5a04
+    1a42:	e8 bf 2c 00 00       	call   4706 <open>
+  if(fd < 0){
+    1a47:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    1a4a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    1a4c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    1a4f:	85 c0                	test   %eax,%eax
+    1a51:	0f 88 aa 00 00 00    	js     1b01 <sharedfd+0x181>
+    1a57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a5e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1a60:	83 ec 04             	sub    $0x4,%esp
+    1a63:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1a66:	6a 0a                	push   $0xa
+    1a68:	56                   	push   %esi
+    1a69:	ff 75 d0             	push   -0x30(%ebp)
+    1a6c:	e8 6d 2c 00 00       	call   46de <read>
+    1a71:	83 c4 10             	add    $0x10,%esp
+    1a74:	85 c0                	test   %eax,%eax
+    1a76:	7e 28                	jle    1aa0 <sharedfd+0x120>
+    1a78:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1a7b:	89 f0                	mov    %esi,%eax
+    1a7d:	eb 13                	jmp    1a92 <sharedfd+0x112>
+    1a7f:	90                   	nop
+        np++;
+    1a80:	80 f9 70             	cmp    $0x70,%cl
+    1a83:	0f 94 c1             	sete   %cl
+    1a86:	0f b6 c9             	movzbl %cl,%ecx
+    1a89:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    1a8b:	83 c0 01             	add    $0x1,%eax
+    1a8e:	39 f8                	cmp    %edi,%eax
+    1a90:	74 ce                	je     1a60 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1a92:	0f b6 08             	movzbl (%eax),%ecx
+    1a95:	80 f9 63             	cmp    $0x63,%cl
+    1a98:	75 e6                	jne    1a80 <sharedfd+0x100>
+        nc++;
+    1a9a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    1a9d:	eb ec                	jmp    1a8b <sharedfd+0x10b>
+    1a9f:	90                   	nop
+  close(fd);
+    1aa0:	83 ec 0c             	sub    $0xc,%esp
+    1aa3:	ff 75 d0             	push   -0x30(%ebp)
+    1aa6:	e8 43 2c 00 00       	call   46ee <close>
+  unlink("sharedfd");
+    1aab:	c7 04 24 04 5a 00 00 	movl   $0x5a04,(%esp)
+    1ab2:	e8 5f 2c 00 00       	call   4716 <unlink>
+  if(nc == 10000 && np == 10000){
+    1ab7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1aba:	83 c4 10             	add    $0x10,%esp
+    1abd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1ac3:	75 5b                	jne    1b20 <sharedfd+0x1a0>
+    1ac5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    1acb:	75 53                	jne    1b20 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    1acd:	83 ec 08             	sub    $0x8,%esp
+    1ad0:	68 0d 5a 00 00       	push   $0x5a0d
+    1ad5:	6a 01                	push   $0x1
+    1ad7:	e8 e4 35 00 00       	call   50c0 <printf>
+    1adc:	83 c4 10             	add    $0x10,%esp
+}
+    1adf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ae2:	5b                   	pop    %ebx
+    1ae3:	5e                   	pop    %esi
+    1ae4:	5f                   	pop    %edi
+    1ae5:	5d                   	pop    %ebp
+    1ae6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1ae7:	83 ec 08             	sub    $0x8,%esp
+    1aea:	68 bc 68 00 00       	push   $0x68bc
+    1aef:	6a 01                	push   $0x1
+    1af1:	e8 ca 35 00 00       	call   50c0 <printf>
+    return;
+    1af6:	83 c4 10             	add    $0x10,%esp
+}
+    1af9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1afc:	5b                   	pop    %ebx
+    1afd:	5e                   	pop    %esi
+    1afe:	5f                   	pop    %edi
+    1aff:	5d                   	pop    %ebp
+    1b00:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1b01:	83 ec 08             	sub    $0x8,%esp
+    1b04:	68 08 69 00 00       	push   $0x6908
+    1b09:	6a 01                	push   $0x1
+    1b0b:	e8 b0 35 00 00       	call   50c0 <printf>
+    return;
+    1b10:	83 c4 10             	add    $0x10,%esp
+}
+    1b13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b16:	5b                   	pop    %ebx
+    1b17:	5e                   	pop    %esi
+    1b18:	5f                   	pop    %edi
+    1b19:	5d                   	pop    %ebp
+    1b1a:	c3                   	ret
+    exit();
+    1b1b:	e8 90 2b 00 00       	call   46b0 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1b20:	53                   	push   %ebx
+    1b21:	52                   	push   %edx
+    1b22:	68 1a 5a 00 00       	push   $0x5a1a
+    1b27:	6a 01                	push   $0x1
+    1b29:	e8 92 35 00 00       	call   50c0 <printf>
+    exit();
+    1b2e:	e8 7d 2b 00 00       	call   46b0 <exit>
+    1b33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001b40 <fourfiles>:
+{
+    1b40:	55                   	push   %ebp
+    1b41:	89 e5                	mov    %esp,%ebp
+    1b43:	57                   	push   %edi
+    1b44:	56                   	push   %esi
+    1b45:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1b46:	31 db                	xor    %ebx,%ebx
+{
+    1b48:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    1b4b:	c7 45 d8 2f 5a 00 00 	movl   $0x5a2f,-0x28(%ebp)
+    1b52:	c7 45 dc 72 5b 00 00 	movl   $0x5b72,-0x24(%ebp)
+    1b59:	c7 45 e0 76 5b 00 00 	movl   $0x5b76,-0x20(%ebp)
+    1b60:	c7 45 e4 32 5a 00 00 	movl   $0x5a32,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1b67:	68 35 5a 00 00       	push   $0x5a35
+    1b6c:	6a 01                	push   $0x1
+    1b6e:	e8 4d 35 00 00       	call   50c0 <printf>
+    1b73:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1b76:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    1b7a:	83 ec 0c             	sub    $0xc,%esp
+    1b7d:	56                   	push   %esi
+    1b7e:	e8 93 2b 00 00       	call   4716 <unlink>
+    pid = fork();
+    1b83:	e8 3e 2b 00 00       	call   46c6 <fork>
+    if(pid < 0){
+    1b88:	83 c4 10             	add    $0x10,%esp
+    1b8b:	85 c0                	test   %eax,%eax
+    1b8d:	0f 88 65 01 00 00    	js     1cf8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1b93:	0f 84 eb 00 00 00    	je     1c84 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1b99:	83 c3 01             	add    $0x1,%ebx
+    1b9c:	83 fb 04             	cmp    $0x4,%ebx
+    1b9f:	75 d5                	jne    1b76 <fourfiles+0x36>
+    wait();
+    1ba1:	e8 28 2b 00 00       	call   46ce <wait>
+  for(i = 0; i < 2; i++){
+    1ba6:	31 f6                	xor    %esi,%esi
+    wait();
+    1ba8:	e8 21 2b 00 00       	call   46ce <wait>
+    1bad:	e8 1c 2b 00 00       	call   46ce <wait>
+    1bb2:	e8 17 2b 00 00       	call   46ce <wait>
+    fname = names[i];
+    1bb7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    1bbb:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    1bbe:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1bc0:	6a 00                	push   $0x0
+    1bc2:	53                   	push   %ebx
+    1bc3:	e8 3e 2b 00 00       	call   4706 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1bc8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1bcb:	83 c4 10             	add    $0x10,%esp
+    1bce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bd8:	83 ec 04             	sub    $0x4,%esp
+    1bdb:	68 00 20 00 00       	push   $0x2000
+    1be0:	68 80 a3 00 00       	push   $0xa380
+    1be5:	ff 75 d4             	push   -0x2c(%ebp)
+    1be8:	e8 f1 2a 00 00       	call   46de <read>
+    1bed:	83 c4 10             	add    $0x10,%esp
+    1bf0:	89 c3                	mov    %eax,%ebx
+    1bf2:	85 c0                	test   %eax,%eax
+    1bf4:	7e 28                	jle    1c1e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1bf6:	31 c0                	xor    %eax,%eax
+    1bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bff:	90                   	nop
+        if(buf[j] != '0'+i){
+    1c00:	83 fe 01             	cmp    $0x1,%esi
+    1c03:	0f be 88 80 a3 00 00 	movsbl 0xa380(%eax),%ecx
+    1c0a:	19 d2                	sbb    %edx,%edx
+    1c0c:	83 c2 31             	add    $0x31,%edx
+    1c0f:	39 d1                	cmp    %edx,%ecx
+    1c11:	75 5d                	jne    1c70 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1c13:	83 c0 01             	add    $0x1,%eax
+    1c16:	39 c3                	cmp    %eax,%ebx
+    1c18:	75 e6                	jne    1c00 <fourfiles+0xc0>
+      total += n;
+    1c1a:	01 df                	add    %ebx,%edi
+    1c1c:	eb ba                	jmp    1bd8 <fourfiles+0x98>
+    close(fd);
+    1c1e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1c21:	83 ec 0c             	sub    $0xc,%esp
+    1c24:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1c27:	51                   	push   %ecx
+    1c28:	e8 c1 2a 00 00       	call   46ee <close>
+    if(total != 12*500){
+    1c2d:	83 c4 10             	add    $0x10,%esp
+    1c30:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1c36:	0f 85 d0 00 00 00    	jne    1d0c <fourfiles+0x1cc>
+    unlink(fname);
+    1c3c:	83 ec 0c             	sub    $0xc,%esp
+    1c3f:	53                   	push   %ebx
+    1c40:	e8 d1 2a 00 00       	call   4716 <unlink>
+  for(i = 0; i < 2; i++){
+    1c45:	83 c4 10             	add    $0x10,%esp
+    1c48:	85 f6                	test   %esi,%esi
+    1c4a:	75 0a                	jne    1c56 <fourfiles+0x116>
+    1c4c:	be 01 00 00 00       	mov    $0x1,%esi
+    1c51:	e9 61 ff ff ff       	jmp    1bb7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1c56:	83 ec 08             	sub    $0x8,%esp
+    1c59:	68 73 5a 00 00       	push   $0x5a73
+    1c5e:	6a 01                	push   $0x1
+    1c60:	e8 5b 34 00 00       	call   50c0 <printf>
+}
+    1c65:	83 c4 10             	add    $0x10,%esp
+    1c68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c6b:	5b                   	pop    %ebx
+    1c6c:	5e                   	pop    %esi
+    1c6d:	5f                   	pop    %edi
+    1c6e:	5d                   	pop    %ebp
+    1c6f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1c70:	83 ec 08             	sub    $0x8,%esp
+    1c73:	68 56 5a 00 00       	push   $0x5a56
+    1c78:	6a 01                	push   $0x1
+    1c7a:	e8 41 34 00 00       	call   50c0 <printf>
+          exit();
+    1c7f:	e8 2c 2a 00 00       	call   46b0 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1c84:	83 ec 08             	sub    $0x8,%esp
+    1c87:	68 02 02 00 00       	push   $0x202
+    1c8c:	56                   	push   %esi
+    1c8d:	e8 74 2a 00 00       	call   4706 <open>
+      if(fd < 0){
+    1c92:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1c95:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1c97:	85 c0                	test   %eax,%eax
+    1c99:	78 45                	js     1ce0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    1c9b:	83 ec 04             	sub    $0x4,%esp
+    1c9e:	83 c3 30             	add    $0x30,%ebx
+    1ca1:	68 00 02 00 00       	push   $0x200
+    1ca6:	53                   	push   %ebx
+    1ca7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    1cac:	68 80 a3 00 00       	push   $0xa380
+    1cb1:	e8 7a 28 00 00       	call   4530 <memset>
+    1cb6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1cb9:	83 ec 04             	sub    $0x4,%esp
+    1cbc:	68 f4 01 00 00       	push   $0x1f4
+    1cc1:	68 80 a3 00 00       	push   $0xa380
+    1cc6:	56                   	push   %esi
+    1cc7:	e8 1a 2a 00 00       	call   46e6 <write>
+    1ccc:	83 c4 10             	add    $0x10,%esp
+    1ccf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1cd4:	75 49                	jne    1d1f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1cd6:	83 eb 01             	sub    $0x1,%ebx
+    1cd9:	75 de                	jne    1cb9 <fourfiles+0x179>
+      exit();
+    1cdb:	e8 d0 29 00 00       	call   46b0 <exit>
+        printf(1, "create failed\n");
+    1ce0:	51                   	push   %ecx
+    1ce1:	51                   	push   %ecx
+    1ce2:	68 ca 5c 00 00       	push   $0x5cca
+    1ce7:	6a 01                	push   $0x1
+    1ce9:	e8 d2 33 00 00       	call   50c0 <printf>
+        exit();
+    1cee:	e8 bd 29 00 00       	call   46b0 <exit>
+    1cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1cf7:	90                   	nop
+      printf(1, "fork failed\n");
+    1cf8:	83 ec 08             	sub    $0x8,%esp
+    1cfb:	68 c0 65 00 00       	push   $0x65c0
+    1d00:	6a 01                	push   $0x1
+    1d02:	e8 b9 33 00 00       	call   50c0 <printf>
+      exit();
+    1d07:	e8 a4 29 00 00       	call   46b0 <exit>
+      printf(1, "wrong length %d\n", total);
+    1d0c:	50                   	push   %eax
+    1d0d:	57                   	push   %edi
+    1d0e:	68 62 5a 00 00       	push   $0x5a62
+    1d13:	6a 01                	push   $0x1
+    1d15:	e8 a6 33 00 00       	call   50c0 <printf>
+      exit();
+    1d1a:	e8 91 29 00 00       	call   46b0 <exit>
+          printf(1, "write failed %d\n", n);
+    1d1f:	52                   	push   %edx
+    1d20:	50                   	push   %eax
+    1d21:	68 45 5a 00 00       	push   $0x5a45
+    1d26:	6a 01                	push   $0x1
+    1d28:	e8 93 33 00 00       	call   50c0 <printf>
+          exit();
+    1d2d:	e8 7e 29 00 00       	call   46b0 <exit>
+    1d32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001d40 <createdelete>:
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	57                   	push   %edi
+    1d44:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1d45:	31 f6                	xor    %esi,%esi
+{
+    1d47:	53                   	push   %ebx
+    1d48:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    1d4b:	68 81 5a 00 00       	push   $0x5a81
+    1d50:	6a 01                	push   $0x1
+    1d52:	e8 69 33 00 00       	call   50c0 <printf>
+    1d57:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    1d5a:	e8 67 29 00 00       	call   46c6 <fork>
+    1d5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1d61:	85 c0                	test   %eax,%eax
+    1d63:	0f 88 ac 01 00 00    	js     1f15 <createdelete+0x1d5>
+    if(pid == 0){
+    1d69:	0f 84 01 01 00 00    	je     1e70 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    1d6f:	83 c6 01             	add    $0x1,%esi
+    1d72:	83 fe 04             	cmp    $0x4,%esi
+    1d75:	75 e3                	jne    1d5a <createdelete+0x1a>
+    wait();
+    1d77:	e8 52 29 00 00       	call   46ce <wait>
+  for(i = 0; i < N; i++){
+    1d7c:	31 ff                	xor    %edi,%edi
+    1d7e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1d81:	e8 48 29 00 00       	call   46ce <wait>
+    1d86:	e8 43 29 00 00       	call   46ce <wait>
+    1d8b:	e8 3e 29 00 00       	call   46ce <wait>
+  name[0] = name[1] = name[2] = 0;
+    1d90:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1d98:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    1d9a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    1d9d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1da2:	0f 94 c2             	sete   %dl
+    1da5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1da8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    1dab:	0f 9f c0             	setg   %al
+    1dae:	09 c2                	or     %eax,%edx
+    1db0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1db3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1db7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    1dba:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    1dbd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1dc0:	6a 00                	push   $0x0
+    1dc2:	56                   	push   %esi
+    1dc3:	e8 3e 29 00 00       	call   4706 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1dc8:	83 c4 10             	add    $0x10,%esp
+    1dcb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    1dcf:	74 7f                	je     1e50 <createdelete+0x110>
+    1dd1:	85 c0                	test   %eax,%eax
+    1dd3:	0f 88 27 01 00 00    	js     1f00 <createdelete+0x1c0>
+        close(fd);
+    1dd9:	83 ec 0c             	sub    $0xc,%esp
+    1ddc:	50                   	push   %eax
+    1ddd:	e8 0c 29 00 00       	call   46ee <close>
+    1de2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1de5:	83 c3 01             	add    $0x1,%ebx
+    1de8:	80 fb 74             	cmp    $0x74,%bl
+    1deb:	75 c6                	jne    1db3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    1ded:	83 c7 01             	add    $0x1,%edi
+    1df0:	83 ff 14             	cmp    $0x14,%edi
+    1df3:	75 a3                	jne    1d98 <createdelete+0x58>
+    1df5:	bf 70 00 00 00       	mov    $0x70,%edi
+    1dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1e00:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1e03:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1e08:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    1e0b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    1e0d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1e10:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1e13:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1e17:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    1e1a:	56                   	push   %esi
+    1e1b:	e8 f6 28 00 00       	call   4716 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1e20:	83 c4 10             	add    $0x10,%esp
+    1e23:	83 eb 01             	sub    $0x1,%ebx
+    1e26:	75 e3                	jne    1e0b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1e28:	83 c7 01             	add    $0x1,%edi
+    1e2b:	89 f8                	mov    %edi,%eax
+    1e2d:	3c 84                	cmp    $0x84,%al
+    1e2f:	75 cf                	jne    1e00 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1e31:	83 ec 08             	sub    $0x8,%esp
+    1e34:	68 94 5a 00 00       	push   $0x5a94
+    1e39:	6a 01                	push   $0x1
+    1e3b:	e8 80 32 00 00       	call   50c0 <printf>
+}
+    1e40:	83 c4 10             	add    $0x10,%esp
+    1e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e46:	5b                   	pop    %ebx
+    1e47:	5e                   	pop    %esi
+    1e48:	5f                   	pop    %edi
+    1e49:	5d                   	pop    %ebp
+    1e4a:	c3                   	ret
+    1e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e4f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1e50:	85 c0                	test   %eax,%eax
+    1e52:	78 91                	js     1de5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1e54:	50                   	push   %eax
+    1e55:	56                   	push   %esi
+    1e56:	68 58 69 00 00       	push   $0x6958
+    1e5b:	6a 01                	push   $0x1
+    1e5d:	e8 5e 32 00 00       	call   50c0 <printf>
+        exit();
+    1e62:	e8 49 28 00 00       	call   46b0 <exit>
+    1e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1e70:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1e73:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1e77:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    1e7a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    1e7d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1e80:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1e83:	8d 43 30             	lea    0x30(%ebx),%eax
+    1e86:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1e89:	68 02 02 00 00       	push   $0x202
+    1e8e:	56                   	push   %esi
+    1e8f:	e8 72 28 00 00       	call   4706 <open>
+        if(fd < 0){
+    1e94:	83 c4 10             	add    $0x10,%esp
+    1e97:	85 c0                	test   %eax,%eax
+    1e99:	0f 88 8a 00 00 00    	js     1f29 <createdelete+0x1e9>
+        close(fd);
+    1e9f:	83 ec 0c             	sub    $0xc,%esp
+    1ea2:	50                   	push   %eax
+    1ea3:	e8 46 28 00 00       	call   46ee <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1ea8:	83 c4 10             	add    $0x10,%esp
+    1eab:	85 db                	test   %ebx,%ebx
+    1ead:	74 19                	je     1ec8 <createdelete+0x188>
+    1eaf:	f6 c3 01             	test   $0x1,%bl
+    1eb2:	74 1b                	je     1ecf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1eb4:	83 c3 01             	add    $0x1,%ebx
+    1eb7:	83 fb 14             	cmp    $0x14,%ebx
+    1eba:	75 c4                	jne    1e80 <createdelete+0x140>
+      exit();
+    1ebc:	e8 ef 27 00 00       	call   46b0 <exit>
+    1ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1ec8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1ecd:	eb b1                	jmp    1e80 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    1ecf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1ed1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1ed4:	d1 f8                	sar    %eax
+    1ed6:	83 c0 30             	add    $0x30,%eax
+    1ed9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    1edc:	56                   	push   %esi
+    1edd:	e8 34 28 00 00       	call   4716 <unlink>
+    1ee2:	83 c4 10             	add    $0x10,%esp
+    1ee5:	85 c0                	test   %eax,%eax
+    1ee7:	79 cb                	jns    1eb4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1ee9:	52                   	push   %edx
+    1eea:	52                   	push   %edx
+    1eeb:	68 73 53 00 00       	push   $0x5373
+    1ef0:	6a 01                	push   $0x1
+    1ef2:	e8 c9 31 00 00       	call   50c0 <printf>
+            exit();
+    1ef7:	e8 b4 27 00 00       	call   46b0 <exit>
+    1efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1f00:	83 ec 04             	sub    $0x4,%esp
+    1f03:	56                   	push   %esi
+    1f04:	68 34 69 00 00       	push   $0x6934
+    1f09:	6a 01                	push   $0x1
+    1f0b:	e8 b0 31 00 00       	call   50c0 <printf>
+        exit();
+    1f10:	e8 9b 27 00 00       	call   46b0 <exit>
+      printf(1, "fork failed\n");
+    1f15:	83 ec 08             	sub    $0x8,%esp
+    1f18:	68 c0 65 00 00       	push   $0x65c0
+    1f1d:	6a 01                	push   $0x1
+    1f1f:	e8 9c 31 00 00       	call   50c0 <printf>
+      exit();
+    1f24:	e8 87 27 00 00       	call   46b0 <exit>
+          printf(1, "create failed\n");
+    1f29:	83 ec 08             	sub    $0x8,%esp
+    1f2c:	68 ca 5c 00 00       	push   $0x5cca
+    1f31:	6a 01                	push   $0x1
+    1f33:	e8 88 31 00 00       	call   50c0 <printf>
+          exit();
+    1f38:	e8 73 27 00 00       	call   46b0 <exit>
+    1f3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001f40 <unlinkread>:
+{
+    1f40:	55                   	push   %ebp
+    1f41:	89 e5                	mov    %esp,%ebp
+    1f43:	56                   	push   %esi
+    1f44:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1f45:	83 ec 08             	sub    $0x8,%esp
+    1f48:	68 a5 5a 00 00       	push   $0x5aa5
+    1f4d:	6a 01                	push   $0x1
+    1f4f:	e8 6c 31 00 00       	call   50c0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1f54:	5b                   	pop    %ebx
+    1f55:	5e                   	pop    %esi
+    1f56:	68 02 02 00 00       	push   $0x202
+    1f5b:	68 b6 5a 00 00       	push   $0x5ab6
+    1f60:	e8 a1 27 00 00       	call   4706 <open>
+  if(fd < 0){
+    1f65:	83 c4 10             	add    $0x10,%esp
+    1f68:	85 c0                	test   %eax,%eax
+    1f6a:	0f 88 e6 00 00 00    	js     2056 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1f70:	83 ec 04             	sub    $0x4,%esp
+    1f73:	89 c3                	mov    %eax,%ebx
+    1f75:	6a 05                	push   $0x5
+    1f77:	68 95 58 00 00       	push   $0x5895
+    1f7c:	50                   	push   %eax
+    1f7d:	e8 64 27 00 00       	call   46e6 <write>
+  close(fd);
+    1f82:	89 1c 24             	mov    %ebx,(%esp)
+    1f85:	e8 64 27 00 00       	call   46ee <close>
+  fd = open("unlinkread", O_RDWR);
+    1f8a:	58                   	pop    %eax
+    1f8b:	5a                   	pop    %edx
+    1f8c:	6a 02                	push   $0x2
+    1f8e:	68 b6 5a 00 00       	push   $0x5ab6
+    1f93:	e8 6e 27 00 00       	call   4706 <open>
+  if(fd < 0){
+    1f98:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    1f9b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f9d:	85 c0                	test   %eax,%eax
+    1f9f:	0f 88 10 01 00 00    	js     20b5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1fa5:	83 ec 0c             	sub    $0xc,%esp
+    1fa8:	68 b6 5a 00 00       	push   $0x5ab6
+    1fad:	e8 64 27 00 00       	call   4716 <unlink>
+    1fb2:	83 c4 10             	add    $0x10,%esp
+    1fb5:	85 c0                	test   %eax,%eax
+    1fb7:	0f 85 e5 00 00 00    	jne    20a2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1fbd:	83 ec 08             	sub    $0x8,%esp
+    1fc0:	68 02 02 00 00       	push   $0x202
+    1fc5:	68 b6 5a 00 00       	push   $0x5ab6
+    1fca:	e8 37 27 00 00       	call   4706 <open>
+  write(fd1, "yyy", 3);
+    1fcf:	83 c4 0c             	add    $0xc,%esp
+    1fd2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1fd4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1fd6:	68 0d 5b 00 00       	push   $0x5b0d
+    1fdb:	50                   	push   %eax
+    1fdc:	e8 05 27 00 00       	call   46e6 <write>
+  close(fd1);
+    1fe1:	89 34 24             	mov    %esi,(%esp)
+    1fe4:	e8 05 27 00 00       	call   46ee <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1fe9:	83 c4 0c             	add    $0xc,%esp
+    1fec:	68 00 20 00 00       	push   $0x2000
+    1ff1:	68 80 a3 00 00       	push   $0xa380
+    1ff6:	53                   	push   %ebx
+    1ff7:	e8 e2 26 00 00       	call   46de <read>
+    1ffc:	83 c4 10             	add    $0x10,%esp
+    1fff:	83 f8 05             	cmp    $0x5,%eax
+    2002:	0f 85 87 00 00 00    	jne    208f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    2008:	80 3d 80 a3 00 00 68 	cmpb   $0x68,0xa380
+    200f:	75 6b                	jne    207c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    2011:	83 ec 04             	sub    $0x4,%esp
+    2014:	6a 0a                	push   $0xa
+    2016:	68 80 a3 00 00       	push   $0xa380
+    201b:	53                   	push   %ebx
+    201c:	e8 c5 26 00 00       	call   46e6 <write>
+    2021:	83 c4 10             	add    $0x10,%esp
+    2024:	83 f8 0a             	cmp    $0xa,%eax
+    2027:	75 40                	jne    2069 <unlinkread+0x129>
+  close(fd);
+    2029:	83 ec 0c             	sub    $0xc,%esp
+    202c:	53                   	push   %ebx
+    202d:	e8 bc 26 00 00       	call   46ee <close>
+  unlink("unlinkread");
+    2032:	c7 04 24 b6 5a 00 00 	movl   $0x5ab6,(%esp)
+    2039:	e8 d8 26 00 00       	call   4716 <unlink>
+  printf(1, "unlinkread ok\n");
+    203e:	58                   	pop    %eax
+    203f:	5a                   	pop    %edx
+    2040:	68 58 5b 00 00       	push   $0x5b58
+    2045:	6a 01                	push   $0x1
+    2047:	e8 74 30 00 00       	call   50c0 <printf>
+}
+    204c:	83 c4 10             	add    $0x10,%esp
+    204f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2052:	5b                   	pop    %ebx
+    2053:	5e                   	pop    %esi
+    2054:	5d                   	pop    %ebp
+    2055:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    2056:	51                   	push   %ecx
+    2057:	51                   	push   %ecx
+    2058:	68 c1 5a 00 00       	push   $0x5ac1
+    205d:	6a 01                	push   $0x1
+    205f:	e8 5c 30 00 00       	call   50c0 <printf>
+    exit();
+    2064:	e8 47 26 00 00       	call   46b0 <exit>
+    printf(1, "unlinkread write failed\n");
+    2069:	51                   	push   %ecx
+    206a:	51                   	push   %ecx
+    206b:	68 3f 5b 00 00       	push   $0x5b3f
+    2070:	6a 01                	push   $0x1
+    2072:	e8 49 30 00 00       	call   50c0 <printf>
+    exit();
+    2077:	e8 34 26 00 00       	call   46b0 <exit>
+    printf(1, "unlinkread wrong data\n");
+    207c:	53                   	push   %ebx
+    207d:	53                   	push   %ebx
+    207e:	68 28 5b 00 00       	push   $0x5b28
+    2083:	6a 01                	push   $0x1
+    2085:	e8 36 30 00 00       	call   50c0 <printf>
+    exit();
+    208a:	e8 21 26 00 00       	call   46b0 <exit>
+    printf(1, "unlinkread read failed");
+    208f:	56                   	push   %esi
+    2090:	56                   	push   %esi
+    2091:	68 11 5b 00 00       	push   $0x5b11
+    2096:	6a 01                	push   $0x1
+    2098:	e8 23 30 00 00       	call   50c0 <printf>
+    exit();
+    209d:	e8 0e 26 00 00       	call   46b0 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    20a2:	50                   	push   %eax
+    20a3:	50                   	push   %eax
+    20a4:	68 f3 5a 00 00       	push   $0x5af3
+    20a9:	6a 01                	push   $0x1
+    20ab:	e8 10 30 00 00       	call   50c0 <printf>
+    exit();
+    20b0:	e8 fb 25 00 00       	call   46b0 <exit>
+    printf(1, "open unlinkread failed\n");
+    20b5:	50                   	push   %eax
+    20b6:	50                   	push   %eax
+    20b7:	68 db 5a 00 00       	push   $0x5adb
+    20bc:	6a 01                	push   $0x1
+    20be:	e8 fd 2f 00 00       	call   50c0 <printf>
+    exit();
+    20c3:	e8 e8 25 00 00       	call   46b0 <exit>
+    20c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20cf:	90                   	nop
+
+000020d0 <linktest>:
+{
+    20d0:	55                   	push   %ebp
+    20d1:	89 e5                	mov    %esp,%ebp
+    20d3:	53                   	push   %ebx
+    20d4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    20d7:	68 67 5b 00 00       	push   $0x5b67
+    20dc:	6a 01                	push   $0x1
+    20de:	e8 dd 2f 00 00       	call   50c0 <printf>
+  unlink("lf1");
+    20e3:	c7 04 24 71 5b 00 00 	movl   $0x5b71,(%esp)
+    20ea:	e8 27 26 00 00       	call   4716 <unlink>
+  unlink("lf2");
+    20ef:	c7 04 24 75 5b 00 00 	movl   $0x5b75,(%esp)
+    20f6:	e8 1b 26 00 00       	call   4716 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    20fb:	58                   	pop    %eax
+    20fc:	5a                   	pop    %edx
+    20fd:	68 02 02 00 00       	push   $0x202
+    2102:	68 71 5b 00 00       	push   $0x5b71
+    2107:	e8 fa 25 00 00       	call   4706 <open>
+  if(fd < 0){
+    210c:	83 c4 10             	add    $0x10,%esp
+    210f:	85 c0                	test   %eax,%eax
+    2111:	0f 88 1e 01 00 00    	js     2235 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    2117:	83 ec 04             	sub    $0x4,%esp
+    211a:	89 c3                	mov    %eax,%ebx
+    211c:	6a 05                	push   $0x5
+    211e:	68 95 58 00 00       	push   $0x5895
+    2123:	50                   	push   %eax
+    2124:	e8 bd 25 00 00       	call   46e6 <write>
+    2129:	83 c4 10             	add    $0x10,%esp
+    212c:	83 f8 05             	cmp    $0x5,%eax
+    212f:	0f 85 98 01 00 00    	jne    22cd <linktest+0x1fd>
+  close(fd);
+    2135:	83 ec 0c             	sub    $0xc,%esp
+    2138:	53                   	push   %ebx
+    2139:	e8 b0 25 00 00       	call   46ee <close>
+  if(link("lf1", "lf2") < 0){
+    213e:	5b                   	pop    %ebx
+    213f:	58                   	pop    %eax
+    2140:	68 75 5b 00 00       	push   $0x5b75
+    2145:	68 71 5b 00 00       	push   $0x5b71
+    214a:	e8 d7 25 00 00       	call   4726 <link>
+    214f:	83 c4 10             	add    $0x10,%esp
+    2152:	85 c0                	test   %eax,%eax
+    2154:	0f 88 60 01 00 00    	js     22ba <linktest+0x1ea>
+  unlink("lf1");
+    215a:	83 ec 0c             	sub    $0xc,%esp
+    215d:	68 71 5b 00 00       	push   $0x5b71
+    2162:	e8 af 25 00 00       	call   4716 <unlink>
+  if(open("lf1", 0) >= 0){
+    2167:	58                   	pop    %eax
+    2168:	5a                   	pop    %edx
+    2169:	6a 00                	push   $0x0
+    216b:	68 71 5b 00 00       	push   $0x5b71
+    2170:	e8 91 25 00 00       	call   4706 <open>
+    2175:	83 c4 10             	add    $0x10,%esp
+    2178:	85 c0                	test   %eax,%eax
+    217a:	0f 89 27 01 00 00    	jns    22a7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    2180:	83 ec 08             	sub    $0x8,%esp
+    2183:	6a 00                	push   $0x0
+    2185:	68 75 5b 00 00       	push   $0x5b75
+    218a:	e8 77 25 00 00       	call   4706 <open>
+  if(fd < 0){
+    218f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    2192:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2194:	85 c0                	test   %eax,%eax
+    2196:	0f 88 f8 00 00 00    	js     2294 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    219c:	83 ec 04             	sub    $0x4,%esp
+    219f:	68 00 20 00 00       	push   $0x2000
+    21a4:	68 80 a3 00 00       	push   $0xa380
+    21a9:	50                   	push   %eax
+    21aa:	e8 2f 25 00 00       	call   46de <read>
+    21af:	83 c4 10             	add    $0x10,%esp
+    21b2:	83 f8 05             	cmp    $0x5,%eax
+    21b5:	0f 85 c6 00 00 00    	jne    2281 <linktest+0x1b1>
+  close(fd);
+    21bb:	83 ec 0c             	sub    $0xc,%esp
+    21be:	53                   	push   %ebx
+    21bf:	e8 2a 25 00 00       	call   46ee <close>
+  if(link("lf2", "lf2") >= 0){
+    21c4:	58                   	pop    %eax
+    21c5:	5a                   	pop    %edx
+    21c6:	68 75 5b 00 00       	push   $0x5b75
+    21cb:	68 75 5b 00 00       	push   $0x5b75
+    21d0:	e8 51 25 00 00       	call   4726 <link>
+    21d5:	83 c4 10             	add    $0x10,%esp
+    21d8:	85 c0                	test   %eax,%eax
+    21da:	0f 89 8e 00 00 00    	jns    226e <linktest+0x19e>
+  unlink("lf2");
+    21e0:	83 ec 0c             	sub    $0xc,%esp
+    21e3:	68 75 5b 00 00       	push   $0x5b75
+    21e8:	e8 29 25 00 00       	call   4716 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    21ed:	59                   	pop    %ecx
+    21ee:	5b                   	pop    %ebx
+    21ef:	68 71 5b 00 00       	push   $0x5b71
+    21f4:	68 75 5b 00 00       	push   $0x5b75
+    21f9:	e8 28 25 00 00       	call   4726 <link>
+    21fe:	83 c4 10             	add    $0x10,%esp
+    2201:	85 c0                	test   %eax,%eax
+    2203:	79 56                	jns    225b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    2205:	83 ec 08             	sub    $0x8,%esp
+    2208:	68 71 5b 00 00       	push   $0x5b71
+    220d:	68 f5 5e 00 00       	push   $0x5ef5
+    2212:	e8 0f 25 00 00       	call   4726 <link>
+    2217:	83 c4 10             	add    $0x10,%esp
+    221a:	85 c0                	test   %eax,%eax
+    221c:	79 2a                	jns    2248 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    221e:	83 ec 08             	sub    $0x8,%esp
+    2221:	68 0f 5c 00 00       	push   $0x5c0f
+    2226:	6a 01                	push   $0x1
+    2228:	e8 93 2e 00 00       	call   50c0 <printf>
+}
+    222d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2230:	83 c4 10             	add    $0x10,%esp
+    2233:	c9                   	leave
+    2234:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2235:	50                   	push   %eax
+    2236:	50                   	push   %eax
+    2237:	68 79 5b 00 00       	push   $0x5b79
+    223c:	6a 01                	push   $0x1
+    223e:	e8 7d 2e 00 00       	call   50c0 <printf>
+    exit();
+    2243:	e8 68 24 00 00       	call   46b0 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2248:	50                   	push   %eax
+    2249:	50                   	push   %eax
+    224a:	68 f3 5b 00 00       	push   $0x5bf3
+    224f:	6a 01                	push   $0x1
+    2251:	e8 6a 2e 00 00       	call   50c0 <printf>
+    exit();
+    2256:	e8 55 24 00 00       	call   46b0 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    225b:	52                   	push   %edx
+    225c:	52                   	push   %edx
+    225d:	68 a0 69 00 00       	push   $0x69a0
+    2262:	6a 01                	push   $0x1
+    2264:	e8 57 2e 00 00       	call   50c0 <printf>
+    exit();
+    2269:	e8 42 24 00 00       	call   46b0 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    226e:	50                   	push   %eax
+    226f:	50                   	push   %eax
+    2270:	68 d5 5b 00 00       	push   $0x5bd5
+    2275:	6a 01                	push   $0x1
+    2277:	e8 44 2e 00 00       	call   50c0 <printf>
+    exit();
+    227c:	e8 2f 24 00 00       	call   46b0 <exit>
+    printf(1, "read lf2 failed\n");
+    2281:	51                   	push   %ecx
+    2282:	51                   	push   %ecx
+    2283:	68 c4 5b 00 00       	push   $0x5bc4
+    2288:	6a 01                	push   $0x1
+    228a:	e8 31 2e 00 00       	call   50c0 <printf>
+    exit();
+    228f:	e8 1c 24 00 00       	call   46b0 <exit>
+    printf(1, "open lf2 failed\n");
+    2294:	53                   	push   %ebx
+    2295:	53                   	push   %ebx
+    2296:	68 b3 5b 00 00       	push   $0x5bb3
+    229b:	6a 01                	push   $0x1
+    229d:	e8 1e 2e 00 00       	call   50c0 <printf>
+    exit();
+    22a2:	e8 09 24 00 00       	call   46b0 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    22a7:	50                   	push   %eax
+    22a8:	50                   	push   %eax
+    22a9:	68 78 69 00 00       	push   $0x6978
+    22ae:	6a 01                	push   $0x1
+    22b0:	e8 0b 2e 00 00       	call   50c0 <printf>
+    exit();
+    22b5:	e8 f6 23 00 00       	call   46b0 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    22ba:	51                   	push   %ecx
+    22bb:	51                   	push   %ecx
+    22bc:	68 9e 5b 00 00       	push   $0x5b9e
+    22c1:	6a 01                	push   $0x1
+    22c3:	e8 f8 2d 00 00       	call   50c0 <printf>
+    exit();
+    22c8:	e8 e3 23 00 00       	call   46b0 <exit>
+    printf(1, "write lf1 failed\n");
+    22cd:	50                   	push   %eax
+    22ce:	50                   	push   %eax
+    22cf:	68 8c 5b 00 00       	push   $0x5b8c
+    22d4:	6a 01                	push   $0x1
+    22d6:	e8 e5 2d 00 00       	call   50c0 <printf>
+    exit();
+    22db:	e8 d0 23 00 00       	call   46b0 <exit>
+
+000022e0 <concreate>:
+{
+    22e0:	55                   	push   %ebp
+    22e1:	89 e5                	mov    %esp,%ebp
+    22e3:	57                   	push   %edi
+    22e4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    22e5:	31 f6                	xor    %esi,%esi
+{
+    22e7:	53                   	push   %ebx
+    22e8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    22eb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    22ee:	68 1c 5c 00 00       	push   $0x5c1c
+    22f3:	6a 01                	push   $0x1
+    22f5:	e8 c6 2d 00 00       	call   50c0 <printf>
+  file[0] = 'C';
+    22fa:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    22fe:	83 c4 10             	add    $0x10,%esp
+    2301:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    2305:	eb 4c                	jmp    2353 <concreate+0x73>
+    2307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    230e:	66 90                	xchg   %ax,%ax
+    2310:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    2316:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    231b:	0f 83 8f 00 00 00    	jae    23b0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    2321:	83 ec 08             	sub    $0x8,%esp
+    2324:	68 02 02 00 00       	push   $0x202
+    2329:	53                   	push   %ebx
+    232a:	e8 d7 23 00 00       	call   4706 <open>
+      if(fd < 0){
+    232f:	83 c4 10             	add    $0x10,%esp
+    2332:	85 c0                	test   %eax,%eax
+    2334:	78 63                	js     2399 <concreate+0xb9>
+      close(fd);
+    2336:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    2339:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    233c:	50                   	push   %eax
+    233d:	e8 ac 23 00 00       	call   46ee <close>
+    2342:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2345:	e8 84 23 00 00       	call   46ce <wait>
+  for(i = 0; i < 40; i++){
+    234a:	83 fe 28             	cmp    $0x28,%esi
+    234d:	0f 84 7f 00 00 00    	je     23d2 <concreate+0xf2>
+    unlink(file);
+    2353:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    2356:	8d 46 30             	lea    0x30(%esi),%eax
+    2359:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    235c:	53                   	push   %ebx
+    235d:	e8 b4 23 00 00       	call   4716 <unlink>
+    pid = fork();
+    2362:	e8 5f 23 00 00       	call   46c6 <fork>
+    if(pid && (i % 3) == 1){
+    2367:	83 c4 10             	add    $0x10,%esp
+    236a:	85 c0                	test   %eax,%eax
+    236c:	75 a2                	jne    2310 <concreate+0x30>
+      link("C0", file);
+    236e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    2374:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    237a:	0f 83 d0 00 00 00    	jae    2450 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    2380:	83 ec 08             	sub    $0x8,%esp
+    2383:	68 02 02 00 00       	push   $0x202
+    2388:	53                   	push   %ebx
+    2389:	e8 78 23 00 00       	call   4706 <open>
+      if(fd < 0){
+    238e:	83 c4 10             	add    $0x10,%esp
+    2391:	85 c0                	test   %eax,%eax
+    2393:	0f 89 ea 01 00 00    	jns    2583 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    2399:	83 ec 04             	sub    $0x4,%esp
+    239c:	53                   	push   %ebx
+    239d:	68 2f 5c 00 00       	push   $0x5c2f
+    23a2:	6a 01                	push   $0x1
+    23a4:	e8 17 2d 00 00       	call   50c0 <printf>
+        exit();
+    23a9:	e8 02 23 00 00       	call   46b0 <exit>
+    23ae:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    23b0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    23b3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    23b6:	53                   	push   %ebx
+    23b7:	68 2c 5c 00 00       	push   $0x5c2c
+    23bc:	e8 65 23 00 00       	call   4726 <link>
+    23c1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    23c4:	e8 05 23 00 00       	call   46ce <wait>
+  for(i = 0; i < 40; i++){
+    23c9:	83 fe 28             	cmp    $0x28,%esi
+    23cc:	0f 85 81 ff ff ff    	jne    2353 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    23d2:	83 ec 04             	sub    $0x4,%esp
+    23d5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    23d8:	6a 28                	push   $0x28
+    23da:	6a 00                	push   $0x0
+    23dc:	50                   	push   %eax
+    23dd:	e8 4e 21 00 00       	call   4530 <memset>
+  fd = open(".", 0);
+    23e2:	5e                   	pop    %esi
+    23e3:	5f                   	pop    %edi
+    23e4:	6a 00                	push   $0x0
+    23e6:	68 f5 5e 00 00       	push   $0x5ef5
+    23eb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    23ee:	e8 13 23 00 00       	call   4706 <open>
+  n = 0;
+    23f3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    23fa:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    23fd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    23ff:	90                   	nop
+    2400:	83 ec 04             	sub    $0x4,%esp
+    2403:	6a 10                	push   $0x10
+    2405:	57                   	push   %edi
+    2406:	56                   	push   %esi
+    2407:	e8 d2 22 00 00       	call   46de <read>
+    240c:	83 c4 10             	add    $0x10,%esp
+    240f:	85 c0                	test   %eax,%eax
+    2411:	7e 5d                	jle    2470 <concreate+0x190>
+    if(de.inum == 0)
+    2413:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    2418:	74 e6                	je     2400 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    241a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    241e:	75 e0                	jne    2400 <concreate+0x120>
+    2420:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    2424:	75 da                	jne    2400 <concreate+0x120>
+      i = de.name[1] - '0';
+    2426:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    242a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    242d:	83 f8 27             	cmp    $0x27,%eax
+    2430:	0f 87 5e 01 00 00    	ja     2594 <concreate+0x2b4>
+      if(fa[i]){
+    2436:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    243b:	0f 85 7e 01 00 00    	jne    25bf <concreate+0x2df>
+      n++;
+    2441:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    2445:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    244a:	eb b4                	jmp    2400 <concreate+0x120>
+    244c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    2450:	83 ec 08             	sub    $0x8,%esp
+    2453:	53                   	push   %ebx
+    2454:	68 2c 5c 00 00       	push   $0x5c2c
+    2459:	e8 c8 22 00 00       	call   4726 <link>
+    245e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2461:	e8 4a 22 00 00       	call   46b0 <exit>
+    2466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    246d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    2470:	83 ec 0c             	sub    $0xc,%esp
+    2473:	56                   	push   %esi
+    2474:	e8 75 22 00 00       	call   46ee <close>
+  if(n != 40){
+    2479:	83 c4 10             	add    $0x10,%esp
+    247c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    2480:	0f 85 26 01 00 00    	jne    25ac <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    2486:	31 f6                	xor    %esi,%esi
+    2488:	eb 48                	jmp    24d2 <concreate+0x1f2>
+    248a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    2490:	85 ff                	test   %edi,%edi
+    2492:	74 05                	je     2499 <concreate+0x1b9>
+    2494:	83 f8 01             	cmp    $0x1,%eax
+    2497:	74 68                	je     2501 <concreate+0x221>
+      unlink(file);
+    2499:	83 ec 0c             	sub    $0xc,%esp
+    249c:	53                   	push   %ebx
+    249d:	e8 74 22 00 00       	call   4716 <unlink>
+      unlink(file);
+    24a2:	89 1c 24             	mov    %ebx,(%esp)
+    24a5:	e8 6c 22 00 00       	call   4716 <unlink>
+      unlink(file);
+    24aa:	89 1c 24             	mov    %ebx,(%esp)
+    24ad:	e8 64 22 00 00       	call   4716 <unlink>
+      unlink(file);
+    24b2:	89 1c 24             	mov    %ebx,(%esp)
+    24b5:	e8 5c 22 00 00       	call   4716 <unlink>
+    24ba:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    24bd:	85 ff                	test   %edi,%edi
+    24bf:	74 a0                	je     2461 <concreate+0x181>
+      wait();
+    24c1:	e8 08 22 00 00       	call   46ce <wait>
+  for(i = 0; i < 40; i++){
+    24c6:	83 c6 01             	add    $0x1,%esi
+    24c9:	83 fe 28             	cmp    $0x28,%esi
+    24cc:	0f 84 86 00 00 00    	je     2558 <concreate+0x278>
+    file[1] = '0' + i;
+    24d2:	8d 46 30             	lea    0x30(%esi),%eax
+    24d5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    24d8:	e8 e9 21 00 00       	call   46c6 <fork>
+    24dd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    24df:	85 c0                	test   %eax,%eax
+    24e1:	0f 88 88 00 00 00    	js     256f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    24e7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    24ec:	f7 e6                	mul    %esi
+    24ee:	89 d0                	mov    %edx,%eax
+    24f0:	83 e2 fe             	and    $0xfffffffe,%edx
+    24f3:	d1 e8                	shr    %eax
+    24f5:	01 c2                	add    %eax,%edx
+    24f7:	89 f0                	mov    %esi,%eax
+    24f9:	29 d0                	sub    %edx,%eax
+    24fb:	89 c1                	mov    %eax,%ecx
+    24fd:	09 f9                	or     %edi,%ecx
+    24ff:	75 8f                	jne    2490 <concreate+0x1b0>
+      close(open(file, 0));
+    2501:	83 ec 08             	sub    $0x8,%esp
+    2504:	6a 00                	push   $0x0
+    2506:	53                   	push   %ebx
+    2507:	e8 fa 21 00 00       	call   4706 <open>
+    250c:	89 04 24             	mov    %eax,(%esp)
+    250f:	e8 da 21 00 00       	call   46ee <close>
+      close(open(file, 0));
+    2514:	58                   	pop    %eax
+    2515:	5a                   	pop    %edx
+    2516:	6a 00                	push   $0x0
+    2518:	53                   	push   %ebx
+    2519:	e8 e8 21 00 00       	call   4706 <open>
+    251e:	89 04 24             	mov    %eax,(%esp)
+    2521:	e8 c8 21 00 00       	call   46ee <close>
+      close(open(file, 0));
+    2526:	59                   	pop    %ecx
+    2527:	58                   	pop    %eax
+    2528:	6a 00                	push   $0x0
+    252a:	53                   	push   %ebx
+    252b:	e8 d6 21 00 00       	call   4706 <open>
+    2530:	89 04 24             	mov    %eax,(%esp)
+    2533:	e8 b6 21 00 00       	call   46ee <close>
+      close(open(file, 0));
+    2538:	58                   	pop    %eax
+    2539:	5a                   	pop    %edx
+    253a:	6a 00                	push   $0x0
+    253c:	53                   	push   %ebx
+    253d:	e8 c4 21 00 00       	call   4706 <open>
+    2542:	89 04 24             	mov    %eax,(%esp)
+    2545:	e8 a4 21 00 00       	call   46ee <close>
+    254a:	83 c4 10             	add    $0x10,%esp
+    254d:	e9 6b ff ff ff       	jmp    24bd <concreate+0x1dd>
+    2552:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    2558:	83 ec 08             	sub    $0x8,%esp
+    255b:	68 81 5c 00 00       	push   $0x5c81
+    2560:	6a 01                	push   $0x1
+    2562:	e8 59 2b 00 00       	call   50c0 <printf>
+}
+    2567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    256a:	5b                   	pop    %ebx
+    256b:	5e                   	pop    %esi
+    256c:	5f                   	pop    %edi
+    256d:	5d                   	pop    %ebp
+    256e:	c3                   	ret
+      printf(1, "fork failed\n");
+    256f:	83 ec 08             	sub    $0x8,%esp
+    2572:	68 c0 65 00 00       	push   $0x65c0
+    2577:	6a 01                	push   $0x1
+    2579:	e8 42 2b 00 00       	call   50c0 <printf>
+      exit();
+    257e:	e8 2d 21 00 00       	call   46b0 <exit>
+      close(fd);
+    2583:	83 ec 0c             	sub    $0xc,%esp
+    2586:	50                   	push   %eax
+    2587:	e8 62 21 00 00       	call   46ee <close>
+    258c:	83 c4 10             	add    $0x10,%esp
+    258f:	e9 cd fe ff ff       	jmp    2461 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    2594:	83 ec 04             	sub    $0x4,%esp
+    2597:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    259a:	50                   	push   %eax
+    259b:	68 4b 5c 00 00       	push   $0x5c4b
+    25a0:	6a 01                	push   $0x1
+    25a2:	e8 19 2b 00 00       	call   50c0 <printf>
+        exit();
+    25a7:	e8 04 21 00 00       	call   46b0 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    25ac:	51                   	push   %ecx
+    25ad:	51                   	push   %ecx
+    25ae:	68 c4 69 00 00       	push   $0x69c4
+    25b3:	6a 01                	push   $0x1
+    25b5:	e8 06 2b 00 00       	call   50c0 <printf>
+    exit();
+    25ba:	e8 f1 20 00 00       	call   46b0 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    25bf:	83 ec 04             	sub    $0x4,%esp
+    25c2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    25c5:	50                   	push   %eax
+    25c6:	68 64 5c 00 00       	push   $0x5c64
+    25cb:	6a 01                	push   $0x1
+    25cd:	e8 ee 2a 00 00       	call   50c0 <printf>
+        exit();
+    25d2:	e8 d9 20 00 00       	call   46b0 <exit>
+    25d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25de:	66 90                	xchg   %ax,%ax
+
+000025e0 <linkunlink>:
+{
+    25e0:	55                   	push   %ebp
+    25e1:	89 e5                	mov    %esp,%ebp
+    25e3:	57                   	push   %edi
+    25e4:	56                   	push   %esi
+    25e5:	53                   	push   %ebx
+    25e6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    25e9:	68 8f 5c 00 00       	push   $0x5c8f
+    25ee:	6a 01                	push   $0x1
+    25f0:	e8 cb 2a 00 00       	call   50c0 <printf>
+  unlink("x");
+    25f5:	c7 04 24 1d 5d 00 00 	movl   $0x5d1d,(%esp)
+    25fc:	e8 15 21 00 00       	call   4716 <unlink>
+  pid = fork();
+    2601:	e8 c0 20 00 00       	call   46c6 <fork>
+  if(pid < 0){
+    2606:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2609:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    260c:	85 c0                	test   %eax,%eax
+    260e:	0f 88 b6 00 00 00    	js     26ca <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2614:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2618:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    261d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2622:	19 ff                	sbb    %edi,%edi
+    2624:	83 e7 60             	and    $0x60,%edi
+    2627:	83 c7 01             	add    $0x1,%edi
+    262a:	eb 1e                	jmp    264a <linkunlink+0x6a>
+    262c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2630:	83 f8 01             	cmp    $0x1,%eax
+    2633:	74 7b                	je     26b0 <linkunlink+0xd0>
+      unlink("x");
+    2635:	83 ec 0c             	sub    $0xc,%esp
+    2638:	68 1d 5d 00 00       	push   $0x5d1d
+    263d:	e8 d4 20 00 00       	call   4716 <unlink>
+    2642:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2645:	83 eb 01             	sub    $0x1,%ebx
+    2648:	74 41                	je     268b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    264a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2650:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    2656:	89 f8                	mov    %edi,%eax
+    2658:	f7 e6                	mul    %esi
+    265a:	89 d0                	mov    %edx,%eax
+    265c:	83 e2 fe             	and    $0xfffffffe,%edx
+    265f:	d1 e8                	shr    %eax
+    2661:	01 c2                	add    %eax,%edx
+    2663:	89 f8                	mov    %edi,%eax
+    2665:	29 d0                	sub    %edx,%eax
+    2667:	75 c7                	jne    2630 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    2669:	83 ec 08             	sub    $0x8,%esp
+    266c:	68 02 02 00 00       	push   $0x202
+    2671:	68 1d 5d 00 00       	push   $0x5d1d
+    2676:	e8 8b 20 00 00       	call   4706 <open>
+    267b:	89 04 24             	mov    %eax,(%esp)
+    267e:	e8 6b 20 00 00       	call   46ee <close>
+    2683:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2686:	83 eb 01             	sub    $0x1,%ebx
+    2689:	75 bf                	jne    264a <linkunlink+0x6a>
+  if(pid)
+    268b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    268e:	85 c0                	test   %eax,%eax
+    2690:	74 4b                	je     26dd <linkunlink+0xfd>
+    wait();
+    2692:	e8 37 20 00 00       	call   46ce <wait>
+  printf(1, "linkunlink ok\n");
+    2697:	83 ec 08             	sub    $0x8,%esp
+    269a:	68 a4 5c 00 00       	push   $0x5ca4
+    269f:	6a 01                	push   $0x1
+    26a1:	e8 1a 2a 00 00       	call   50c0 <printf>
+}
+    26a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    26a9:	5b                   	pop    %ebx
+    26aa:	5e                   	pop    %esi
+    26ab:	5f                   	pop    %edi
+    26ac:	5d                   	pop    %ebp
+    26ad:	c3                   	ret
+    26ae:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    26b0:	83 ec 08             	sub    $0x8,%esp
+    26b3:	68 1d 5d 00 00       	push   $0x5d1d
+    26b8:	68 a0 5c 00 00       	push   $0x5ca0
+    26bd:	e8 64 20 00 00       	call   4726 <link>
+    26c2:	83 c4 10             	add    $0x10,%esp
+    26c5:	e9 7b ff ff ff       	jmp    2645 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    26ca:	52                   	push   %edx
+    26cb:	52                   	push   %edx
+    26cc:	68 c0 65 00 00       	push   $0x65c0
+    26d1:	6a 01                	push   $0x1
+    26d3:	e8 e8 29 00 00       	call   50c0 <printf>
+    exit();
+    26d8:	e8 d3 1f 00 00       	call   46b0 <exit>
+    exit();
+    26dd:	e8 ce 1f 00 00       	call   46b0 <exit>
+    26e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000026f0 <bigdir>:
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	57                   	push   %edi
+    26f4:	56                   	push   %esi
+    26f5:	53                   	push   %ebx
+    26f6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    26f9:	68 b3 5c 00 00       	push   $0x5cb3
+    26fe:	6a 01                	push   $0x1
+    2700:	e8 bb 29 00 00       	call   50c0 <printf>
+  unlink("bd");
+    2705:	c7 04 24 c0 5c 00 00 	movl   $0x5cc0,(%esp)
+    270c:	e8 05 20 00 00       	call   4716 <unlink>
+  fd = open("bd", O_CREATE);
+    2711:	5a                   	pop    %edx
+    2712:	59                   	pop    %ecx
+    2713:	68 00 02 00 00       	push   $0x200
+    2718:	68 c0 5c 00 00       	push   $0x5cc0
+    271d:	e8 e4 1f 00 00       	call   4706 <open>
+  if(fd < 0){
+    2722:	83 c4 10             	add    $0x10,%esp
+    2725:	85 c0                	test   %eax,%eax
+    2727:	0f 88 de 00 00 00    	js     280b <bigdir+0x11b>
+  close(fd);
+    272d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2730:	31 f6                	xor    %esi,%esi
+    2732:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2735:	50                   	push   %eax
+    2736:	e8 b3 1f 00 00       	call   46ee <close>
+    273b:	83 c4 10             	add    $0x10,%esp
+    273e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2740:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2742:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2745:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2749:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    274c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2750:	83 c0 30             	add    $0x30,%eax
+    2753:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2756:	89 f0                	mov    %esi,%eax
+    2758:	83 e0 3f             	and    $0x3f,%eax
+    275b:	83 c0 30             	add    $0x30,%eax
+    275e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2761:	57                   	push   %edi
+    2762:	68 c0 5c 00 00       	push   $0x5cc0
+    2767:	e8 ba 1f 00 00       	call   4726 <link>
+    276c:	83 c4 10             	add    $0x10,%esp
+    276f:	89 c3                	mov    %eax,%ebx
+    2771:	85 c0                	test   %eax,%eax
+    2773:	75 6e                	jne    27e3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2775:	83 c6 01             	add    $0x1,%esi
+    2778:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    277e:	75 c0                	jne    2740 <bigdir+0x50>
+  unlink("bd");
+    2780:	83 ec 0c             	sub    $0xc,%esp
+    2783:	68 c0 5c 00 00       	push   $0x5cc0
+    2788:	e8 89 1f 00 00       	call   4716 <unlink>
+    278d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2790:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2792:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2795:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2799:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    279c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    27a0:	83 c0 30             	add    $0x30,%eax
+    27a3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    27a6:	89 d8                	mov    %ebx,%eax
+    27a8:	83 e0 3f             	and    $0x3f,%eax
+    27ab:	83 c0 30             	add    $0x30,%eax
+    27ae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    27b1:	57                   	push   %edi
+    27b2:	e8 5f 1f 00 00       	call   4716 <unlink>
+    27b7:	83 c4 10             	add    $0x10,%esp
+    27ba:	85 c0                	test   %eax,%eax
+    27bc:	75 39                	jne    27f7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    27be:	83 c3 01             	add    $0x1,%ebx
+    27c1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    27c7:	75 c7                	jne    2790 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    27c9:	83 ec 08             	sub    $0x8,%esp
+    27cc:	68 02 5d 00 00       	push   $0x5d02
+    27d1:	6a 01                	push   $0x1
+    27d3:	e8 e8 28 00 00       	call   50c0 <printf>
+    27d8:	83 c4 10             	add    $0x10,%esp
+}
+    27db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27de:	5b                   	pop    %ebx
+    27df:	5e                   	pop    %esi
+    27e0:	5f                   	pop    %edi
+    27e1:	5d                   	pop    %ebp
+    27e2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    27e3:	83 ec 08             	sub    $0x8,%esp
+    27e6:	68 d9 5c 00 00       	push   $0x5cd9
+    27eb:	6a 01                	push   $0x1
+    27ed:	e8 ce 28 00 00       	call   50c0 <printf>
+      exit();
+    27f2:	e8 b9 1e 00 00       	call   46b0 <exit>
+      printf(1, "bigdir unlink failed");
+    27f7:	83 ec 08             	sub    $0x8,%esp
+    27fa:	68 ed 5c 00 00       	push   $0x5ced
+    27ff:	6a 01                	push   $0x1
+    2801:	e8 ba 28 00 00       	call   50c0 <printf>
+      exit();
+    2806:	e8 a5 1e 00 00       	call   46b0 <exit>
+    printf(1, "bigdir create failed\n");
+    280b:	50                   	push   %eax
+    280c:	50                   	push   %eax
+    280d:	68 c3 5c 00 00       	push   $0x5cc3
+    2812:	6a 01                	push   $0x1
+    2814:	e8 a7 28 00 00       	call   50c0 <printf>
+    exit();
+    2819:	e8 92 1e 00 00       	call   46b0 <exit>
+    281e:	66 90                	xchg   %ax,%ax
+
+00002820 <indexdir>:
+{
+    2820:	55                   	push   %ebp
+    2821:	89 e5                	mov    %esp,%ebp
+    2823:	57                   	push   %edi
+    2824:	56                   	push   %esi
+    2825:	53                   	push   %ebx
+    2826:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  printf(1, "indexdir test\n");
+    282c:	68 0d 5d 00 00       	push   $0x5d0d
+    2831:	6a 01                	push   $0x1
+    2833:	e8 88 28 00 00       	call   50c0 <printf>
+  if(mkdir("ix") != 0){
+    2838:	c7 04 24 1c 5d 00 00 	movl   $0x5d1c,(%esp)
+    283f:	e8 ea 1e 00 00       	call   472e <mkdir>
+    2844:	83 c4 10             	add    $0x10,%esp
+    2847:	85 c0                	test   %eax,%eax
+    2849:	0f 85 51 02 00 00    	jne    2aa0 <indexdir+0x280>
+  fd = open("ixf", O_CREATE|O_RDWR);
+    284f:	83 ec 08             	sub    $0x8,%esp
+    2852:	89 c6                	mov    %eax,%esi
+    2854:	68 02 02 00 00       	push   $0x202
+    2859:	68 36 5d 00 00       	push   $0x5d36
+    285e:	e8 a3 1e 00 00       	call   4706 <open>
+  if(fd < 0){
+    2863:	83 c4 10             	add    $0x10,%esp
+    2866:	85 c0                	test   %eax,%eax
+    2868:	0f 88 1f 02 00 00    	js     2a8d <indexdir+0x26d>
+  close(fd);
+    286e:	83 ec 0c             	sub    $0xc,%esp
+    2871:	8d bd dc fd ff ff    	lea    -0x224(%ebp),%edi
+    2877:	50                   	push   %eax
+    2878:	e8 71 1e 00 00       	call   46ee <close>
+    287d:	83 c4 10             	add    $0x10,%esp
+  name[4] = '0' + (i / 64) % 64;
+    2880:	89 f0                	mov    %esi,%eax
+    if(link("ixf", name) != 0){
+    2882:	83 ec 08             	sub    $0x8,%esp
+  name[0] = 'i';
+    2885:	c7 85 dc fd ff ff 69 	movl   $0x302f7869,-0x224(%ebp)
+    288c:	78 2f 30 
+  name[4] = '0' + (i / 64) % 64;
+    288f:	c1 f8 06             	sar    $0x6,%eax
+  name[6] = '\0';
+    2892:	c6 85 e2 fd ff ff 00 	movb   $0x0,-0x21e(%ebp)
+  name[4] = '0' + (i / 64) % 64;
+    2899:	83 c0 30             	add    $0x30,%eax
+    289c:	88 85 e0 fd ff ff    	mov    %al,-0x220(%ebp)
+  name[5] = '0' + (i % 64);
+    28a2:	89 f0                	mov    %esi,%eax
+    28a4:	83 e0 3f             	and    $0x3f,%eax
+    28a7:	83 c0 30             	add    $0x30,%eax
+    28aa:	88 85 e1 fd ff ff    	mov    %al,-0x21f(%ebp)
+    if(link("ixf", name) != 0){
+    28b0:	57                   	push   %edi
+    28b1:	68 36 5d 00 00       	push   $0x5d36
+    28b6:	e8 6b 1e 00 00       	call   4726 <link>
+    28bb:	83 c4 10             	add    $0x10,%esp
+    28be:	89 c3                	mov    %eax,%ebx
+    28c0:	85 c0                	test   %eax,%eax
+    28c2:	0f 85 86 01 00 00    	jne    2a4e <indexdir+0x22e>
+  for(i = 0; i < NIXENT; i++){
+    28c8:	83 c6 01             	add    $0x1,%esi
+    28cb:	81 fe 01 08 00 00    	cmp    $0x801,%esi
+    28d1:	75 ad                	jne    2880 <indexdir+0x60>
+  fd = open("ix", 0);
+    28d3:	83 ec 08             	sub    $0x8,%esp
+    28d6:	6a 00                	push   $0x0
+    28d8:	68 1c 5d 00 00       	push   $0x5d1c
+    28dd:	e8 24 1e 00 00       	call   4706 <open>
+  if(fd < 0 || read(fd, blk, BSIZE) != BSIZE){
+    28e2:	83 c4 10             	add    $0x10,%esp
+  fd = open("ix", 0);
+    28e5:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || read(fd, blk, BSIZE) != BSIZE){
+    28e7:	85 c0                	test   %eax,%eax
+    28e9:	0f 88 0b 02 00 00    	js     2afa <indexdir+0x2da>
+    28ef:	83 ec 04             	sub    $0x4,%esp
+    28f2:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    28f8:	68 00 02 00 00       	push   $0x200
+    28fd:	50                   	push   %eax
+    28fe:	56                   	push   %esi
+    28ff:	e8 da 1d 00 00       	call   46de <read>
+    2904:	83 c4 10             	add    $0x10,%esp
+    2907:	3d 00 02 00 00       	cmp    $0x200,%eax
+    290c:	0f 85 e8 01 00 00    	jne    2afa <indexdir+0x2da>
+  close(fd);
+    2912:	83 ec 0c             	sub    $0xc,%esp
+    2915:	56                   	push   %esi
+    2916:	e8 d3 1d 00 00       	call   46ee <close>
+  if(root->h.magic != DXMAGIC || root->h.levels != 1 || root->h.count < 2){
+    291b:	83 c4 10             	add    $0x10,%esp
+    291e:	66 81 bd 0a fe ff ff 	cmpw   $0xd1c7,-0x1f6(%ebp)
+    2925:	c7 d1 
+    2927:	0f 85 ac 01 00 00    	jne    2ad9 <indexdir+0x2b9>
+    292d:	66 83 bd 0c fe ff ff 	cmpw   $0x1,-0x1f4(%ebp)
+    2934:	01 
+    2935:	0f b7 85 0e fe ff ff 	movzwl -0x1f2(%ebp),%eax
+    293c:	0f 85 97 01 00 00    	jne    2ad9 <indexdir+0x2b9>
+    2942:	66 83 f8 01          	cmp    $0x1,%ax
+    2946:	0f 86 8d 01 00 00    	jbe    2ad9 <indexdir+0x2b9>
+  for(i = 0; i < NIXENT; i++){
+    294c:	31 f6                	xor    %esi,%esi
+    294e:	66 90                	xchg   %ax,%ax
+  name[4] = '0' + (i / 64) % 64;
+    2950:	89 f0                	mov    %esi,%eax
+    fd = open(name, 0);
+    2952:	83 ec 08             	sub    $0x8,%esp
+  name[0] = 'i';
+    2955:	c7 85 dc fd ff ff 69 	movl   $0x302f7869,-0x224(%ebp)
+    295c:	78 2f 30 
+  name[4] = '0' + (i / 64) % 64;
+    295f:	c1 f8 06             	sar    $0x6,%eax
+  name[6] = '\0';
+    2962:	c6 85 e2 fd ff ff 00 	movb   $0x0,-0x21e(%ebp)
+  name[4] = '0' + (i / 64) % 64;
+    2969:	83 c0 30             	add    $0x30,%eax
+    296c:	88 85 e0 fd ff ff    	mov    %al,-0x220(%ebp)
+  name[5] = '0' + (i % 64);
+    2972:	89 f0                	mov    %esi,%eax
+    2974:	83 e0 3f             	and    $0x3f,%eax
+    2977:	83 c0 30             	add    $0x30,%eax
+    297a:	88 85 e1 fd ff ff    	mov    %al,-0x21f(%ebp)
+    fd = open(name, 0);
+    2980:	6a 00                	push   $0x0
+    2982:	57                   	push   %edi
+    2983:	e8 7e 1d 00 00       	call   4706 <open>
+    if(fd < 0){
+    2988:	83 c4 10             	add    $0x10,%esp
+    298b:	85 c0                	test   %eax,%eax
+    298d:	0f 88 e5 00 00 00    	js     2a78 <indexdir+0x258>
+    close(fd);
+    2993:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NIXENT; i++){
+    2996:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+    2999:	50                   	push   %eax
+    299a:	e8 4f 1d 00 00       	call   46ee <close>
+  for(i = 0; i < NIXENT; i++){
+    299f:	83 c4 10             	add    $0x10,%esp
+    29a2:	81 fe 01 08 00 00    	cmp    $0x801,%esi
+    29a8:	75 a6                	jne    2950 <indexdir+0x130>
+  if(unlink("ix") == 0){
+    29aa:	83 ec 0c             	sub    $0xc,%esp
+    29ad:	68 1c 5d 00 00       	push   $0x5d1c
+    29b2:	e8 5f 1d 00 00       	call   4716 <unlink>
+    29b7:	83 c4 10             	add    $0x10,%esp
+    29ba:	85 c0                	test   %eax,%eax
+    29bc:	0f 84 04 01 00 00    	je     2ac6 <indexdir+0x2a6>
+    29c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  name[4] = '0' + (i / 64) % 64;
+    29c8:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    29ca:	83 ec 0c             	sub    $0xc,%esp
+  name[0] = 'i';
+    29cd:	c7 85 dc fd ff ff 69 	movl   $0x302f7869,-0x224(%ebp)
+    29d4:	78 2f 30 
+  name[4] = '0' + (i / 64) % 64;
+    29d7:	c1 f8 06             	sar    $0x6,%eax
+  name[6] = '\0';
+    29da:	c6 85 e2 fd ff ff 00 	movb   $0x0,-0x21e(%ebp)
+  name[4] = '0' + (i / 64) % 64;
+    29e1:	83 c0 30             	add    $0x30,%eax
+    29e4:	88 85 e0 fd ff ff    	mov    %al,-0x220(%ebp)
+  name[5] = '0' + (i % 64);
+    29ea:	89 d8                	mov    %ebx,%eax
+    29ec:	83 e0 3f             	and    $0x3f,%eax
+    29ef:	83 c0 30             	add    $0x30,%eax
+    29f2:	88 85 e1 fd ff ff    	mov    %al,-0x21f(%ebp)
+    if(unlink(name) != 0){
+    29f8:	57                   	push   %edi
+    29f9:	e8 18 1d 00 00       	call   4716 <unlink>
+    29fe:	83 c4 10             	add    $0x10,%esp
+    2a01:	85 c0                	test   %eax,%eax
+    2a03:	75 5e                	jne    2a63 <indexdir+0x243>
+  for(i = 0; i < NIXENT; i++){
+    2a05:	83 c3 01             	add    $0x1,%ebx
+    2a08:	81 fb 01 08 00 00    	cmp    $0x801,%ebx
+    2a0e:	75 b8                	jne    29c8 <indexdir+0x1a8>
+  if(unlink("ix") != 0){
+    2a10:	83 ec 0c             	sub    $0xc,%esp
+    2a13:	68 1c 5d 00 00       	push   $0x5d1c
+    2a18:	e8 f9 1c 00 00       	call   4716 <unlink>
+    2a1d:	83 c4 10             	add    $0x10,%esp
+    2a20:	85 c0                	test   %eax,%eax
+    2a22:	0f 85 8b 00 00 00    	jne    2ab3 <indexdir+0x293>
+  unlink("ixf");
+    2a28:	83 ec 0c             	sub    $0xc,%esp
+    2a2b:	68 36 5d 00 00       	push   $0x5d36
+    2a30:	e8 e1 1c 00 00       	call   4716 <unlink>
+  printf(1, "indexdir ok\n");
+    2a35:	58                   	pop    %eax
+    2a36:	5a                   	pop    %edx
+    2a37:	68 bc 5d 00 00       	push   $0x5dbc
+    2a3c:	6a 01                	push   $0x1
+    2a3e:	e8 7d 26 00 00       	call   50c0 <printf>
+}
+    2a43:	83 c4 10             	add    $0x10,%esp
+    2a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a49:	5b                   	pop    %ebx
+    2a4a:	5e                   	pop    %esi
+    2a4b:	5f                   	pop    %edi
+    2a4c:	5d                   	pop    %ebp
+    2a4d:	c3                   	ret
+      printf(1, "indexdir link %s failed\n", name);
+    2a4e:	83 ec 04             	sub    $0x4,%esp
+    2a51:	57                   	push   %edi
+    2a52:	68 52 5d 00 00       	push   $0x5d52
+    2a57:	6a 01                	push   $0x1
+    2a59:	e8 62 26 00 00       	call   50c0 <printf>
+      exit();
+    2a5e:	e8 4d 1c 00 00       	call   46b0 <exit>
+      printf(1, "indexdir unlink %s failed\n", name);
+    2a63:	83 ec 04             	sub    $0x4,%esp
+    2a66:	57                   	push   %edi
+    2a67:	68 a1 5d 00 00       	push   $0x5da1
+    2a6c:	6a 01                	push   $0x1
+    2a6e:	e8 4d 26 00 00       	call   50c0 <printf>
+      exit();
+    2a73:	e8 38 1c 00 00       	call   46b0 <exit>
+      printf(1, "indexdir open %s failed\n", name);
+    2a78:	83 ec 04             	sub    $0x4,%esp
+    2a7b:	57                   	push   %edi
+    2a7c:	68 88 5d 00 00       	push   $0x5d88
+    2a81:	6a 01                	push   $0x1
+    2a83:	e8 38 26 00 00       	call   50c0 <printf>
+      exit();
+    2a88:	e8 23 1c 00 00       	call   46b0 <exit>
+    printf(1, "indexdir create failed\n");
+    2a8d:	57                   	push   %edi
+    2a8e:	57                   	push   %edi
+    2a8f:	68 3a 5d 00 00       	push   $0x5d3a
+    2a94:	6a 01                	push   $0x1
+    2a96:	e8 25 26 00 00       	call   50c0 <printf>
+    exit();
+    2a9b:	e8 10 1c 00 00       	call   46b0 <exit>
+    printf(1, "indexdir mkdir failed\n");
+    2aa0:	50                   	push   %eax
+    2aa1:	50                   	push   %eax
+    2aa2:	68 1f 5d 00 00       	push   $0x5d1f
+    2aa7:	6a 01                	push   $0x1
+    2aa9:	e8 12 26 00 00       	call   50c0 <printf>
+    exit();
+    2aae:	e8 fd 1b 00 00       	call   46b0 <exit>
+    printf(1, "indexdir unlink of empty dir failed\n");
+    2ab3:	51                   	push   %ecx
+    2ab4:	51                   	push   %ecx
+    2ab5:	68 58 6a 00 00       	push   $0x6a58
+    2aba:	6a 01                	push   $0x1
+    2abc:	e8 ff 25 00 00       	call   50c0 <printf>
+    exit();
+    2ac1:	e8 ea 1b 00 00       	call   46b0 <exit>
+    printf(1, "indexdir unlink of non-empty dir succeeded\n");
+    2ac6:	53                   	push   %ebx
+    2ac7:	53                   	push   %ebx
+    2ac8:	68 2c 6a 00 00       	push   $0x6a2c
+    2acd:	6a 01                	push   $0x1
+    2acf:	e8 ec 25 00 00       	call   50c0 <printf>
+    exit();
+    2ad4:	e8 d7 1b 00 00       	call   46b0 <exit>
+    printf(1, "indexdir index did not grow: levels %d count %d\n",
+    2ad9:	0f b7 85 0e fe ff ff 	movzwl -0x1f2(%ebp),%eax
+    2ae0:	50                   	push   %eax
+    2ae1:	0f b7 85 0c fe ff ff 	movzwl -0x1f4(%ebp),%eax
+    2ae8:	50                   	push   %eax
+    2ae9:	68 f8 69 00 00       	push   $0x69f8
+    2aee:	6a 01                	push   $0x1
+    2af0:	e8 cb 25 00 00       	call   50c0 <printf>
+    exit();
+    2af5:	e8 b6 1b 00 00       	call   46b0 <exit>
+    printf(1, "indexdir read of dir failed\n");
+    2afa:	56                   	push   %esi
+    2afb:	56                   	push   %esi
+    2afc:	68 6b 5d 00 00       	push   $0x5d6b
+    2b01:	6a 01                	push   $0x1
+    2b03:	e8 b8 25 00 00       	call   50c0 <printf>
+    exit();
+    2b08:	e8 a3 1b 00 00       	call   46b0 <exit>
+    2b0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002b10 <subdir>:
+{
+    2b10:	55                   	push   %ebp
+    2b11:	89 e5                	mov    %esp,%ebp
+    2b13:	53                   	push   %ebx
+    2b14:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2b17:	68 c9 5d 00 00       	push   $0x5dc9
+    2b1c:	6a 01                	push   $0x1
+    2b1e:	e8 9d 25 00 00       	call   50c0 <printf>
+  unlink("ff");
+    2b23:	c7 04 24 52 5e 00 00 	movl   $0x5e52,(%esp)
+    2b2a:	e8 e7 1b 00 00       	call   4716 <unlink>
+  if(mkdir("dd") != 0){
+    2b2f:	c7 04 24 ef 5e 00 00 	movl   $0x5eef,(%esp)
+    2b36:	e8 f3 1b 00 00       	call   472e <mkdir>
+    2b3b:	83 c4 10             	add    $0x10,%esp
+    2b3e:	85 c0                	test   %eax,%eax
+    2b40:	0f 85 b3 05 00 00    	jne    30f9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2b46:	83 ec 08             	sub    $0x8,%esp
+    2b49:	68 02 02 00 00       	push   $0x202
+    2b4e:	68 28 5e 00 00       	push   $0x5e28
+    2b53:	e8 ae 1b 00 00       	call   4706 <open>
+  if(fd < 0){
+    2b58:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2b5b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2b5d:	85 c0                	test   %eax,%eax
+    2b5f:	0f 88 81 05 00 00    	js     30e6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2b65:	83 ec 04             	sub    $0x4,%esp
+    2b68:	6a 02                	push   $0x2
+    2b6a:	68 52 5e 00 00       	push   $0x5e52
+    2b6f:	50                   	push   %eax
+    2b70:	e8 71 1b 00 00       	call   46e6 <write>
+  close(fd);
+    2b75:	89 1c 24             	mov    %ebx,(%esp)
+    2b78:	e8 71 1b 00 00       	call   46ee <close>
+  if(unlink("dd") >= 0){
+    2b7d:	c7 04 24 ef 5e 00 00 	movl   $0x5eef,(%esp)
+    2b84:	e8 8d 1b 00 00       	call   4716 <unlink>
+    2b89:	83 c4 10             	add    $0x10,%esp
+    2b8c:	85 c0                	test   %eax,%eax
+    2b8e:	0f 89 3f 05 00 00    	jns    30d3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2b94:	83 ec 0c             	sub    $0xc,%esp
+    2b97:	68 03 5e 00 00       	push   $0x5e03
+    2b9c:	e8 8d 1b 00 00       	call   472e <mkdir>
+    2ba1:	83 c4 10             	add    $0x10,%esp
+    2ba4:	85 c0                	test   %eax,%eax
+    2ba6:	0f 85 14 05 00 00    	jne    30c0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2bac:	83 ec 08             	sub    $0x8,%esp
+    2baf:	68 02 02 00 00       	push   $0x202
+    2bb4:	68 25 5e 00 00       	push   $0x5e25
+    2bb9:	e8 48 1b 00 00       	call   4706 <open>
+  if(fd < 0){
+    2bbe:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2bc1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2bc3:	85 c0                	test   %eax,%eax
+    2bc5:	0f 88 24 04 00 00    	js     2fef <subdir+0x4df>
+  write(fd, "FF", 2);
+    2bcb:	83 ec 04             	sub    $0x4,%esp
+    2bce:	6a 02                	push   $0x2
+    2bd0:	68 46 5e 00 00       	push   $0x5e46
+    2bd5:	50                   	push   %eax
+    2bd6:	e8 0b 1b 00 00       	call   46e6 <write>
+  close(fd);
+    2bdb:	89 1c 24             	mov    %ebx,(%esp)
+    2bde:	e8 0b 1b 00 00       	call   46ee <close>
+  fd = open("dd/dd/../ff", 0);
+    2be3:	58                   	pop    %eax
+    2be4:	5a                   	pop    %edx
+    2be5:	6a 00                	push   $0x0
+    2be7:	68 49 5e 00 00       	push   $0x5e49
+    2bec:	e8 15 1b 00 00       	call   4706 <open>
+  if(fd < 0){
+    2bf1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2bf4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2bf6:	85 c0                	test   %eax,%eax
+    2bf8:	0f 88 de 03 00 00    	js     2fdc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    2bfe:	83 ec 04             	sub    $0x4,%esp
+    2c01:	68 00 20 00 00       	push   $0x2000
+    2c06:	68 80 a3 00 00       	push   $0xa380
+    2c0b:	50                   	push   %eax
+    2c0c:	e8 cd 1a 00 00       	call   46de <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2c11:	83 c4 10             	add    $0x10,%esp
+    2c14:	83 f8 02             	cmp    $0x2,%eax
+    2c17:	0f 85 3a 03 00 00    	jne    2f57 <subdir+0x447>
+    2c1d:	80 3d 80 a3 00 00 66 	cmpb   $0x66,0xa380
+    2c24:	0f 85 2d 03 00 00    	jne    2f57 <subdir+0x447>
+  close(fd);
+    2c2a:	83 ec 0c             	sub    $0xc,%esp
+    2c2d:	53                   	push   %ebx
+    2c2e:	e8 bb 1a 00 00       	call   46ee <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2c33:	59                   	pop    %ecx
+    2c34:	5b                   	pop    %ebx
+    2c35:	68 89 5e 00 00       	push   $0x5e89
+    2c3a:	68 25 5e 00 00       	push   $0x5e25
+    2c3f:	e8 e2 1a 00 00       	call   4726 <link>
+    2c44:	83 c4 10             	add    $0x10,%esp
+    2c47:	85 c0                	test   %eax,%eax
+    2c49:	0f 85 c6 03 00 00    	jne    3015 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    2c4f:	83 ec 0c             	sub    $0xc,%esp
+    2c52:	68 25 5e 00 00       	push   $0x5e25
+    2c57:	e8 ba 1a 00 00       	call   4716 <unlink>
+    2c5c:	83 c4 10             	add    $0x10,%esp
+    2c5f:	85 c0                	test   %eax,%eax
+    2c61:	0f 85 16 03 00 00    	jne    2f7d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2c67:	83 ec 08             	sub    $0x8,%esp
+    2c6a:	6a 00                	push   $0x0
+    2c6c:	68 25 5e 00 00       	push   $0x5e25
+    2c71:	e8 90 1a 00 00       	call   4706 <open>
+    2c76:	83 c4 10             	add    $0x10,%esp
+    2c79:	85 c0                	test   %eax,%eax
+    2c7b:	0f 89 2c 04 00 00    	jns    30ad <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2c81:	83 ec 0c             	sub    $0xc,%esp
+    2c84:	68 ef 5e 00 00       	push   $0x5eef
+    2c89:	e8 a8 1a 00 00       	call   4736 <chdir>
+    2c8e:	83 c4 10             	add    $0x10,%esp
+    2c91:	85 c0                	test   %eax,%eax
+    2c93:	0f 85 01 04 00 00    	jne    309a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2c99:	83 ec 0c             	sub    $0xc,%esp
+    2c9c:	68 bd 5e 00 00       	push   $0x5ebd
+    2ca1:	e8 90 1a 00 00       	call   4736 <chdir>
+    2ca6:	83 c4 10             	add    $0x10,%esp
+    2ca9:	85 c0                	test   %eax,%eax
+    2cab:	0f 85 b9 02 00 00    	jne    2f6a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2cb1:	83 ec 0c             	sub    $0xc,%esp
+    2cb4:	68 e3 5e 00 00       	push   $0x5ee3
+    2cb9:	e8 78 1a 00 00       	call   4736 <chdir>
+    2cbe:	83 c4 10             	add    $0x10,%esp
+    2cc1:	85 c0                	test   %eax,%eax
+    2cc3:	0f 85 a1 02 00 00    	jne    2f6a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2cc9:	83 ec 0c             	sub    $0xc,%esp
+    2ccc:	68 f2 5e 00 00       	push   $0x5ef2
+    2cd1:	e8 60 1a 00 00       	call   4736 <chdir>
+    2cd6:	83 c4 10             	add    $0x10,%esp
+    2cd9:	85 c0                	test   %eax,%eax
+    2cdb:	0f 85 21 03 00 00    	jne    3002 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2ce1:	83 ec 08             	sub    $0x8,%esp
+    2ce4:	6a 00                	push   $0x0
+    2ce6:	68 89 5e 00 00       	push   $0x5e89
+    2ceb:	e8 16 1a 00 00       	call   4706 <open>
+  if(fd < 0){
+    2cf0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2cf3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2cf5:	85 c0                	test   %eax,%eax
+    2cf7:	0f 88 e0 04 00 00    	js     31dd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2cfd:	83 ec 04             	sub    $0x4,%esp
+    2d00:	68 00 20 00 00       	push   $0x2000
+    2d05:	68 80 a3 00 00       	push   $0xa380
+    2d0a:	50                   	push   %eax
+    2d0b:	e8 ce 19 00 00       	call   46de <read>
+    2d10:	83 c4 10             	add    $0x10,%esp
+    2d13:	83 f8 02             	cmp    $0x2,%eax
+    2d16:	0f 85 ae 04 00 00    	jne    31ca <subdir+0x6ba>
+  close(fd);
+    2d1c:	83 ec 0c             	sub    $0xc,%esp
+    2d1f:	53                   	push   %ebx
+    2d20:	e8 c9 19 00 00       	call   46ee <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2d25:	58                   	pop    %eax
+    2d26:	5a                   	pop    %edx
+    2d27:	6a 00                	push   $0x0
+    2d29:	68 25 5e 00 00       	push   $0x5e25
+    2d2e:	e8 d3 19 00 00       	call   4706 <open>
+    2d33:	83 c4 10             	add    $0x10,%esp
+    2d36:	85 c0                	test   %eax,%eax
+    2d38:	0f 89 65 02 00 00    	jns    2fa3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2d3e:	83 ec 08             	sub    $0x8,%esp
+    2d41:	68 02 02 00 00       	push   $0x202
+    2d46:	68 3d 5f 00 00       	push   $0x5f3d
+    2d4b:	e8 b6 19 00 00       	call   4706 <open>
+    2d50:	83 c4 10             	add    $0x10,%esp
+    2d53:	85 c0                	test   %eax,%eax
+    2d55:	0f 89 35 02 00 00    	jns    2f90 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2d5b:	83 ec 08             	sub    $0x8,%esp
+    2d5e:	68 02 02 00 00       	push   $0x202
+    2d63:	68 62 5f 00 00       	push   $0x5f62
+    2d68:	e8 99 19 00 00       	call   4706 <open>
+    2d6d:	83 c4 10             	add    $0x10,%esp
+    2d70:	85 c0                	test   %eax,%eax
+    2d72:	0f 89 0f 03 00 00    	jns    3087 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2d78:	83 ec 08             	sub    $0x8,%esp
+    2d7b:	68 00 02 00 00       	push   $0x200
+    2d80:	68 ef 5e 00 00       	push   $0x5eef
+    2d85:	e8 7c 19 00 00       	call   4706 <open>
+    2d8a:	83 c4 10             	add    $0x10,%esp
+    2d8d:	85 c0                	test   %eax,%eax
+    2d8f:	0f 89 df 02 00 00    	jns    3074 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2d95:	83 ec 08             	sub    $0x8,%esp
+    2d98:	6a 02                	push   $0x2
+    2d9a:	68 ef 5e 00 00       	push   $0x5eef
+    2d9f:	e8 62 19 00 00       	call   4706 <open>
+    2da4:	83 c4 10             	add    $0x10,%esp
+    2da7:	85 c0                	test   %eax,%eax
+    2da9:	0f 89 b2 02 00 00    	jns    3061 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    2daf:	83 ec 08             	sub    $0x8,%esp
+    2db2:	6a 01                	push   $0x1
+    2db4:	68 ef 5e 00 00       	push   $0x5eef
+    2db9:	e8 48 19 00 00       	call   4706 <open>
+    2dbe:	83 c4 10             	add    $0x10,%esp
+    2dc1:	85 c0                	test   %eax,%eax
+    2dc3:	0f 89 85 02 00 00    	jns    304e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2dc9:	83 ec 08             	sub    $0x8,%esp
+    2dcc:	68 d1 5f 00 00       	push   $0x5fd1
+    2dd1:	68 3d 5f 00 00       	push   $0x5f3d
+    2dd6:	e8 4b 19 00 00       	call   4726 <link>
+    2ddb:	83 c4 10             	add    $0x10,%esp
+    2dde:	85 c0                	test   %eax,%eax
+    2de0:	0f 84 55 02 00 00    	je     303b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2de6:	83 ec 08             	sub    $0x8,%esp
+    2de9:	68 d1 5f 00 00       	push   $0x5fd1
+    2dee:	68 62 5f 00 00       	push   $0x5f62
+    2df3:	e8 2e 19 00 00       	call   4726 <link>
+    2df8:	83 c4 10             	add    $0x10,%esp
+    2dfb:	85 c0                	test   %eax,%eax
+    2dfd:	0f 84 25 02 00 00    	je     3028 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2e03:	83 ec 08             	sub    $0x8,%esp
+    2e06:	68 89 5e 00 00       	push   $0x5e89
+    2e0b:	68 28 5e 00 00       	push   $0x5e28
+    2e10:	e8 11 19 00 00       	call   4726 <link>
+    2e15:	83 c4 10             	add    $0x10,%esp
+    2e18:	85 c0                	test   %eax,%eax
+    2e1a:	0f 84 a9 01 00 00    	je     2fc9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2e20:	83 ec 0c             	sub    $0xc,%esp
+    2e23:	68 3d 5f 00 00       	push   $0x5f3d
+    2e28:	e8 01 19 00 00       	call   472e <mkdir>
+    2e2d:	83 c4 10             	add    $0x10,%esp
+    2e30:	85 c0                	test   %eax,%eax
+    2e32:	0f 84 7e 01 00 00    	je     2fb6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2e38:	83 ec 0c             	sub    $0xc,%esp
+    2e3b:	68 62 5f 00 00       	push   $0x5f62
+    2e40:	e8 e9 18 00 00       	call   472e <mkdir>
+    2e45:	83 c4 10             	add    $0x10,%esp
+    2e48:	85 c0                	test   %eax,%eax
+    2e4a:	0f 84 67 03 00 00    	je     31b7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2e50:	83 ec 0c             	sub    $0xc,%esp
+    2e53:	68 89 5e 00 00       	push   $0x5e89
+    2e58:	e8 d1 18 00 00       	call   472e <mkdir>
+    2e5d:	83 c4 10             	add    $0x10,%esp
+    2e60:	85 c0                	test   %eax,%eax
+    2e62:	0f 84 3c 03 00 00    	je     31a4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2e68:	83 ec 0c             	sub    $0xc,%esp
+    2e6b:	68 62 5f 00 00       	push   $0x5f62
+    2e70:	e8 a1 18 00 00       	call   4716 <unlink>
+    2e75:	83 c4 10             	add    $0x10,%esp
+    2e78:	85 c0                	test   %eax,%eax
+    2e7a:	0f 84 11 03 00 00    	je     3191 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2e80:	83 ec 0c             	sub    $0xc,%esp
+    2e83:	68 3d 5f 00 00       	push   $0x5f3d
+    2e88:	e8 89 18 00 00       	call   4716 <unlink>
+    2e8d:	83 c4 10             	add    $0x10,%esp
+    2e90:	85 c0                	test   %eax,%eax
+    2e92:	0f 84 e6 02 00 00    	je     317e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2e98:	83 ec 0c             	sub    $0xc,%esp
+    2e9b:	68 28 5e 00 00       	push   $0x5e28
+    2ea0:	e8 91 18 00 00       	call   4736 <chdir>
+    2ea5:	83 c4 10             	add    $0x10,%esp
+    2ea8:	85 c0                	test   %eax,%eax
+    2eaa:	0f 84 bb 02 00 00    	je     316b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2eb0:	83 ec 0c             	sub    $0xc,%esp
+    2eb3:	68 d4 5f 00 00       	push   $0x5fd4
+    2eb8:	e8 79 18 00 00       	call   4736 <chdir>
+    2ebd:	83 c4 10             	add    $0x10,%esp
+    2ec0:	85 c0                	test   %eax,%eax
+    2ec2:	0f 84 90 02 00 00    	je     3158 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2ec8:	83 ec 0c             	sub    $0xc,%esp
+    2ecb:	68 89 5e 00 00       	push   $0x5e89
+    2ed0:	e8 41 18 00 00       	call   4716 <unlink>
+    2ed5:	83 c4 10             	add    $0x10,%esp
+    2ed8:	85 c0                	test   %eax,%eax
+    2eda:	0f 85 9d 00 00 00    	jne    2f7d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2ee0:	83 ec 0c             	sub    $0xc,%esp
+    2ee3:	68 28 5e 00 00       	push   $0x5e28
+    2ee8:	e8 29 18 00 00       	call   4716 <unlink>
+    2eed:	83 c4 10             	add    $0x10,%esp
+    2ef0:	85 c0                	test   %eax,%eax
+    2ef2:	0f 85 4d 02 00 00    	jne    3145 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2ef8:	83 ec 0c             	sub    $0xc,%esp
+    2efb:	68 ef 5e 00 00       	push   $0x5eef
+    2f00:	e8 11 18 00 00       	call   4716 <unlink>
+    2f05:	83 c4 10             	add    $0x10,%esp
+    2f08:	85 c0                	test   %eax,%eax
+    2f0a:	0f 84 22 02 00 00    	je     3132 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2f10:	83 ec 0c             	sub    $0xc,%esp
+    2f13:	68 04 5e 00 00       	push   $0x5e04
+    2f18:	e8 f9 17 00 00       	call   4716 <unlink>
+    2f1d:	83 c4 10             	add    $0x10,%esp
+    2f20:	85 c0                	test   %eax,%eax
+    2f22:	0f 88 f7 01 00 00    	js     311f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2f28:	83 ec 0c             	sub    $0xc,%esp
+    2f2b:	68 ef 5e 00 00       	push   $0x5eef
+    2f30:	e8 e1 17 00 00       	call   4716 <unlink>
+    2f35:	83 c4 10             	add    $0x10,%esp
+    2f38:	85 c0                	test   %eax,%eax
+    2f3a:	0f 88 cc 01 00 00    	js     310c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2f40:	83 ec 08             	sub    $0x8,%esp
+    2f43:	68 d1 60 00 00       	push   $0x60d1
+    2f48:	6a 01                	push   $0x1
+    2f4a:	e8 71 21 00 00       	call   50c0 <printf>
+}
+    2f4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f52:	83 c4 10             	add    $0x10,%esp
+    2f55:	c9                   	leave
+    2f56:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2f57:	50                   	push   %eax
+    2f58:	50                   	push   %eax
+    2f59:	68 6e 5e 00 00       	push   $0x5e6e
+    2f5e:	6a 01                	push   $0x1
+    2f60:	e8 5b 21 00 00       	call   50c0 <printf>
+    exit();
+    2f65:	e8 46 17 00 00       	call   46b0 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2f6a:	50                   	push   %eax
+    2f6b:	50                   	push   %eax
+    2f6c:	68 c9 5e 00 00       	push   $0x5ec9
+    2f71:	6a 01                	push   $0x1
+    2f73:	e8 48 21 00 00       	call   50c0 <printf>
+    exit();
+    2f78:	e8 33 17 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2f7d:	50                   	push   %eax
+    2f7e:	50                   	push   %eax
+    2f7f:	68 94 5e 00 00       	push   $0x5e94
+    2f84:	6a 01                	push   $0x1
+    2f86:	e8 35 21 00 00       	call   50c0 <printf>
+    exit();
+    2f8b:	e8 20 17 00 00       	call   46b0 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2f90:	51                   	push   %ecx
+    2f91:	51                   	push   %ecx
+    2f92:	68 46 5f 00 00       	push   $0x5f46
+    2f97:	6a 01                	push   $0x1
+    2f99:	e8 22 21 00 00       	call   50c0 <printf>
+    exit();
+    2f9e:	e8 0d 17 00 00       	call   46b0 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2fa3:	53                   	push   %ebx
+    2fa4:	53                   	push   %ebx
+    2fa5:	68 f0 6a 00 00       	push   $0x6af0
+    2faa:	6a 01                	push   $0x1
+    2fac:	e8 0f 21 00 00       	call   50c0 <printf>
+    exit();
+    2fb1:	e8 fa 16 00 00       	call   46b0 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2fb6:	51                   	push   %ecx
+    2fb7:	51                   	push   %ecx
+    2fb8:	68 da 5f 00 00       	push   $0x5fda
+    2fbd:	6a 01                	push   $0x1
+    2fbf:	e8 fc 20 00 00       	call   50c0 <printf>
+    exit();
+    2fc4:	e8 e7 16 00 00       	call   46b0 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2fc9:	53                   	push   %ebx
+    2fca:	53                   	push   %ebx
+    2fcb:	68 60 6b 00 00       	push   $0x6b60
+    2fd0:	6a 01                	push   $0x1
+    2fd2:	e8 e9 20 00 00       	call   50c0 <printf>
+    exit();
+    2fd7:	e8 d4 16 00 00       	call   46b0 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    2fdc:	50                   	push   %eax
+    2fdd:	50                   	push   %eax
+    2fde:	68 55 5e 00 00       	push   $0x5e55
+    2fe3:	6a 01                	push   $0x1
+    2fe5:	e8 d6 20 00 00       	call   50c0 <printf>
+    exit();
+    2fea:	e8 c1 16 00 00       	call   46b0 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    2fef:	51                   	push   %ecx
+    2ff0:	51                   	push   %ecx
+    2ff1:	68 2e 5e 00 00       	push   $0x5e2e
+    2ff6:	6a 01                	push   $0x1
+    2ff8:	e8 c3 20 00 00       	call   50c0 <printf>
+    exit();
+    2ffd:	e8 ae 16 00 00       	call   46b0 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3002:	50                   	push   %eax
+    3003:	50                   	push   %eax
+    3004:	68 f7 5e 00 00       	push   $0x5ef7
+    3009:	6a 01                	push   $0x1
+    300b:	e8 b0 20 00 00       	call   50c0 <printf>
+    exit();
+    3010:	e8 9b 16 00 00       	call   46b0 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3015:	52                   	push   %edx
+    3016:	52                   	push   %edx
+    3017:	68 a8 6a 00 00       	push   $0x6aa8
+    301c:	6a 01                	push   $0x1
+    301e:	e8 9d 20 00 00       	call   50c0 <printf>
+    exit();
+    3023:	e8 88 16 00 00       	call   46b0 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    3028:	50                   	push   %eax
+    3029:	50                   	push   %eax
+    302a:	68 3c 6b 00 00       	push   $0x6b3c
+    302f:	6a 01                	push   $0x1
+    3031:	e8 8a 20 00 00       	call   50c0 <printf>
+    exit();
+    3036:	e8 75 16 00 00       	call   46b0 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    303b:	50                   	push   %eax
+    303c:	50                   	push   %eax
+    303d:	68 18 6b 00 00       	push   $0x6b18
+    3042:	6a 01                	push   $0x1
+    3044:	e8 77 20 00 00       	call   50c0 <printf>
+    exit();
+    3049:	e8 62 16 00 00       	call   46b0 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    304e:	50                   	push   %eax
+    304f:	50                   	push   %eax
+    3050:	68 b6 5f 00 00       	push   $0x5fb6
+    3055:	6a 01                	push   $0x1
+    3057:	e8 64 20 00 00       	call   50c0 <printf>
+    exit();
+    305c:	e8 4f 16 00 00       	call   46b0 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    3061:	50                   	push   %eax
+    3062:	50                   	push   %eax
+    3063:	68 9d 5f 00 00       	push   $0x5f9d
+    3068:	6a 01                	push   $0x1
+    306a:	e8 51 20 00 00       	call   50c0 <printf>
+    exit();
+    306f:	e8 3c 16 00 00       	call   46b0 <exit>
+    printf(1, "create dd succeeded!\n");
+    3074:	50                   	push   %eax
+    3075:	50                   	push   %eax
+    3076:	68 87 5f 00 00       	push   $0x5f87
+    307b:	6a 01                	push   $0x1
+    307d:	e8 3e 20 00 00       	call   50c0 <printf>
+    exit();
+    3082:	e8 29 16 00 00       	call   46b0 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    3087:	52                   	push   %edx
+    3088:	52                   	push   %edx
+    3089:	68 6b 5f 00 00       	push   $0x5f6b
+    308e:	6a 01                	push   $0x1
+    3090:	e8 2b 20 00 00       	call   50c0 <printf>
+    exit();
+    3095:	e8 16 16 00 00       	call   46b0 <exit>
+    printf(1, "chdir dd failed\n");
+    309a:	50                   	push   %eax
+    309b:	50                   	push   %eax
+    309c:	68 ac 5e 00 00       	push   $0x5eac
+    30a1:	6a 01                	push   $0x1
+    30a3:	e8 18 20 00 00       	call   50c0 <printf>
+    exit();
+    30a8:	e8 03 16 00 00       	call   46b0 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    30ad:	50                   	push   %eax
+    30ae:	50                   	push   %eax
+    30af:	68 cc 6a 00 00       	push   $0x6acc
+    30b4:	6a 01                	push   $0x1
+    30b6:	e8 05 20 00 00       	call   50c0 <printf>
+    exit();
+    30bb:	e8 f0 15 00 00       	call   46b0 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    30c0:	53                   	push   %ebx
+    30c1:	53                   	push   %ebx
+    30c2:	68 0a 5e 00 00       	push   $0x5e0a
+    30c7:	6a 01                	push   $0x1
+    30c9:	e8 f2 1f 00 00       	call   50c0 <printf>
+    exit();
+    30ce:	e8 dd 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    30d3:	50                   	push   %eax
+    30d4:	50                   	push   %eax
+    30d5:	68 80 6a 00 00       	push   $0x6a80
+    30da:	6a 01                	push   $0x1
+    30dc:	e8 df 1f 00 00       	call   50c0 <printf>
+    exit();
+    30e1:	e8 ca 15 00 00       	call   46b0 <exit>
+    printf(1, "create dd/ff failed\n");
+    30e6:	50                   	push   %eax
+    30e7:	50                   	push   %eax
+    30e8:	68 ee 5d 00 00       	push   $0x5dee
+    30ed:	6a 01                	push   $0x1
+    30ef:	e8 cc 1f 00 00       	call   50c0 <printf>
+    exit();
+    30f4:	e8 b7 15 00 00       	call   46b0 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    30f9:	50                   	push   %eax
+    30fa:	50                   	push   %eax
+    30fb:	68 d6 5d 00 00       	push   $0x5dd6
+    3100:	6a 01                	push   $0x1
+    3102:	e8 b9 1f 00 00       	call   50c0 <printf>
+    exit();
+    3107:	e8 a4 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd failed\n");
+    310c:	50                   	push   %eax
+    310d:	50                   	push   %eax
+    310e:	68 bf 60 00 00       	push   $0x60bf
+    3113:	6a 01                	push   $0x1
+    3115:	e8 a6 1f 00 00       	call   50c0 <printf>
+    exit();
+    311a:	e8 91 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    311f:	52                   	push   %edx
+    3120:	52                   	push   %edx
+    3121:	68 aa 60 00 00       	push   $0x60aa
+    3126:	6a 01                	push   $0x1
+    3128:	e8 93 1f 00 00       	call   50c0 <printf>
+    exit();
+    312d:	e8 7e 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3132:	51                   	push   %ecx
+    3133:	51                   	push   %ecx
+    3134:	68 84 6b 00 00       	push   $0x6b84
+    3139:	6a 01                	push   $0x1
+    313b:	e8 80 1f 00 00       	call   50c0 <printf>
+    exit();
+    3140:	e8 6b 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    3145:	53                   	push   %ebx
+    3146:	53                   	push   %ebx
+    3147:	68 95 60 00 00       	push   $0x6095
+    314c:	6a 01                	push   $0x1
+    314e:	e8 6d 1f 00 00       	call   50c0 <printf>
+    exit();
+    3153:	e8 58 15 00 00       	call   46b0 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3158:	50                   	push   %eax
+    3159:	50                   	push   %eax
+    315a:	68 7d 60 00 00       	push   $0x607d
+    315f:	6a 01                	push   $0x1
+    3161:	e8 5a 1f 00 00       	call   50c0 <printf>
+    exit();
+    3166:	e8 45 15 00 00       	call   46b0 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    316b:	50                   	push   %eax
+    316c:	50                   	push   %eax
+    316d:	68 65 60 00 00       	push   $0x6065
+    3172:	6a 01                	push   $0x1
+    3174:	e8 47 1f 00 00       	call   50c0 <printf>
+    exit();
+    3179:	e8 32 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    317e:	50                   	push   %eax
+    317f:	50                   	push   %eax
+    3180:	68 49 60 00 00       	push   $0x6049
+    3185:	6a 01                	push   $0x1
+    3187:	e8 34 1f 00 00       	call   50c0 <printf>
+    exit();
+    318c:	e8 1f 15 00 00       	call   46b0 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3191:	50                   	push   %eax
+    3192:	50                   	push   %eax
+    3193:	68 2d 60 00 00       	push   $0x602d
+    3198:	6a 01                	push   $0x1
+    319a:	e8 21 1f 00 00       	call   50c0 <printf>
+    exit();
+    319f:	e8 0c 15 00 00       	call   46b0 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    31a4:	50                   	push   %eax
+    31a5:	50                   	push   %eax
+    31a6:	68 10 60 00 00       	push   $0x6010
+    31ab:	6a 01                	push   $0x1
+    31ad:	e8 0e 1f 00 00       	call   50c0 <printf>
+    exit();
+    31b2:	e8 f9 14 00 00       	call   46b0 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    31b7:	52                   	push   %edx
+    31b8:	52                   	push   %edx
+    31b9:	68 f5 5f 00 00       	push   $0x5ff5
+    31be:	6a 01                	push   $0x1
+    31c0:	e8 fb 1e 00 00       	call   50c0 <printf>
+    exit();
+    31c5:	e8 e6 14 00 00       	call   46b0 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    31ca:	51                   	push   %ecx
+    31cb:	51                   	push   %ecx
+    31cc:	68 22 5f 00 00       	push   $0x5f22
+    31d1:	6a 01                	push   $0x1
+    31d3:	e8 e8 1e 00 00       	call   50c0 <printf>
+    exit();
+    31d8:	e8 d3 14 00 00       	call   46b0 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    31dd:	53                   	push   %ebx
+    31de:	53                   	push   %ebx
+    31df:	68 0a 5f 00 00       	push   $0x5f0a
+    31e4:	6a 01                	push   $0x1
+    31e6:	e8 d5 1e 00 00       	call   50c0 <printf>
+    exit();
+    31eb:	e8 c0 14 00 00       	call   46b0 <exit>
+
+000031f0 <bigwrite>:
+{
+    31f0:	55                   	push   %ebp
+    31f1:	89 e5                	mov    %esp,%ebp
+    31f3:	56                   	push   %esi
+    31f4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    31f5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    31fa:	83 ec 08             	sub    $0x8,%esp
+    31fd:	68 dc 60 00 00       	push   $0x60dc
+    3202:	6a 01                	push   $0x1
+    3204:	e8 b7 1e 00 00       	call   50c0 <printf>
+  unlink("bigwrite");
+    3209:	c7 04 24 eb 60 00 00 	movl   $0x60eb,(%esp)
+    3210:	e8 01 15 00 00       	call   4716 <unlink>
+    3215:	83 c4 10             	add    $0x10,%esp
+    3218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    321f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3220:	83 ec 08             	sub    $0x8,%esp
+    3223:	68 02 02 00 00       	push   $0x202
+    3228:	68 eb 60 00 00       	push   $0x60eb
+    322d:	e8 d4 14 00 00       	call   4706 <open>
+    if(fd < 0){
+    3232:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3235:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3237:	85 c0                	test   %eax,%eax
+    3239:	78 7e                	js     32b9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    323b:	83 ec 04             	sub    $0x4,%esp
+    323e:	53                   	push   %ebx
+    323f:	68 80 a3 00 00       	push   $0xa380
+    3244:	50                   	push   %eax
+    3245:	e8 9c 14 00 00       	call   46e6 <write>
+      if(cc != sz){
+    324a:	83 c4 10             	add    $0x10,%esp
+    324d:	39 d8                	cmp    %ebx,%eax
+    324f:	75 55                	jne    32a6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    3251:	83 ec 04             	sub    $0x4,%esp
+    3254:	53                   	push   %ebx
+    3255:	68 80 a3 00 00       	push   $0xa380
+    325a:	56                   	push   %esi
+    325b:	e8 86 14 00 00       	call   46e6 <write>
+      if(cc != sz){
+    3260:	83 c4 10             	add    $0x10,%esp
+    3263:	39 c3                	cmp    %eax,%ebx
+    3265:	75 3f                	jne    32a6 <bigwrite+0xb6>
+    close(fd);
+    3267:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    326a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    3270:	56                   	push   %esi
+    3271:	e8 78 14 00 00       	call   46ee <close>
+    unlink("bigwrite");
+    3276:	c7 04 24 eb 60 00 00 	movl   $0x60eb,(%esp)
+    327d:	e8 94 14 00 00       	call   4716 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    3282:	83 c4 10             	add    $0x10,%esp
+    3285:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    328b:	75 93                	jne    3220 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    328d:	83 ec 08             	sub    $0x8,%esp
+    3290:	68 1e 61 00 00       	push   $0x611e
+    3295:	6a 01                	push   $0x1
+    3297:	e8 24 1e 00 00       	call   50c0 <printf>
+}
+    329c:	83 c4 10             	add    $0x10,%esp
+    329f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    32a2:	5b                   	pop    %ebx
+    32a3:	5e                   	pop    %esi
+    32a4:	5d                   	pop    %ebp
+    32a5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    32a6:	50                   	push   %eax
+    32a7:	53                   	push   %ebx
+    32a8:	68 0c 61 00 00       	push   $0x610c
+    32ad:	6a 01                	push   $0x1
+    32af:	e8 0c 1e 00 00       	call   50c0 <printf>
+        exit();
+    32b4:	e8 f7 13 00 00       	call   46b0 <exit>
+      printf(1, "cannot create bigwrite\n");
+    32b9:	83 ec 08             	sub    $0x8,%esp
+    32bc:	68 f4 60 00 00       	push   $0x60f4
+    32c1:	6a 01                	push   $0x1
+    32c3:	e8 f8 1d 00 00       	call   50c0 <printf>
+      exit();
+    32c8:	e8 e3 13 00 00       	call   46b0 <exit>
+    32cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000032d0 <bigfile>:
+{
+    32d0:	55                   	push   %ebp
+    32d1:	89 e5                	mov    %esp,%ebp
+    32d3:	57                   	push   %edi
+    32d4:	56                   	push   %esi
+    32d5:	53                   	push   %ebx
+    32d6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    32d9:	68 2b 61 00 00       	push   $0x612b
+    32de:	6a 01                	push   $0x1
+    32e0:	e8 db 1d 00 00       	call   50c0 <printf>
+  unlink("bigfile");
+    32e5:	c7 04 24 47 61 00 00 	movl   $0x6147,(%esp)
+    32ec:	e8 25 14 00 00       	call   4716 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    32f1:	58                   	pop    %eax
+    32f2:	5a                   	pop    %edx
+    32f3:	68 02 02 00 00       	push   $0x202
+    32f8:	68 47 61 00 00       	push   $0x6147
+    32fd:	e8 04 14 00 00       	call   4706 <open>
+  if(fd < 0){
+    3302:	83 c4 10             	add    $0x10,%esp
+    3305:	85 c0                	test   %eax,%eax
+    3307:	0f 88 5e 01 00 00    	js     346b <bigfile+0x19b>
+    330d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    330f:	31 db                	xor    %ebx,%ebx
+    3311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    3318:	83 ec 04             	sub    $0x4,%esp
+    331b:	68 58 02 00 00       	push   $0x258
+    3320:	53                   	push   %ebx
+    3321:	68 80 a3 00 00       	push   $0xa380
+    3326:	e8 05 12 00 00       	call   4530 <memset>
+    if(write(fd, buf, 600) != 600){
+    332b:	83 c4 0c             	add    $0xc,%esp
+    332e:	68 58 02 00 00       	push   $0x258
+    3333:	68 80 a3 00 00       	push   $0xa380
+    3338:	56                   	push   %esi
+    3339:	e8 a8 13 00 00       	call   46e6 <write>
+    333e:	83 c4 10             	add    $0x10,%esp
+    3341:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3346:	0f 85 f8 00 00 00    	jne    3444 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    334c:	83 c3 01             	add    $0x1,%ebx
+    334f:	83 fb 14             	cmp    $0x14,%ebx
+    3352:	75 c4                	jne    3318 <bigfile+0x48>
+  close(fd);
+    3354:	83 ec 0c             	sub    $0xc,%esp
+    3357:	56                   	push   %esi
+    3358:	e8 91 13 00 00       	call   46ee <close>
+  fd = open("bigfile", 0);
+    335d:	5e                   	pop    %esi
+    335e:	5f                   	pop    %edi
+    335f:	6a 00                	push   $0x0
+    3361:	68 47 61 00 00       	push   $0x6147
+    3366:	e8 9b 13 00 00       	call   4706 <open>
+  if(fd < 0){
+    336b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    336e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    3370:	85 c0                	test   %eax,%eax
+    3372:	0f 88 e0 00 00 00    	js     3458 <bigfile+0x188>
+  total = 0;
+    3378:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    337a:	31 ff                	xor    %edi,%edi
+    337c:	eb 30                	jmp    33ae <bigfile+0xde>
+    337e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    3380:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    3385:	0f 85 91 00 00 00    	jne    341c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    338b:	89 fa                	mov    %edi,%edx
+    338d:	0f be 05 80 a3 00 00 	movsbl 0xa380,%eax
+    3394:	d1 fa                	sar    %edx
+    3396:	39 d0                	cmp    %edx,%eax
+    3398:	75 6e                	jne    3408 <bigfile+0x138>
+    339a:	0f be 15 ab a4 00 00 	movsbl 0xa4ab,%edx
+    33a1:	39 d0                	cmp    %edx,%eax
+    33a3:	75 63                	jne    3408 <bigfile+0x138>
+    total += cc;
+    33a5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    33ab:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    33ae:	83 ec 04             	sub    $0x4,%esp
+    33b1:	68 2c 01 00 00       	push   $0x12c
+    33b6:	68 80 a3 00 00       	push   $0xa380
+    33bb:	56                   	push   %esi
+    33bc:	e8 1d 13 00 00       	call   46de <read>
+    if(cc < 0){
+    33c1:	83 c4 10             	add    $0x10,%esp
+    33c4:	85 c0                	test   %eax,%eax
+    33c6:	78 68                	js     3430 <bigfile+0x160>
+    if(cc == 0)
+    33c8:	75 b6                	jne    3380 <bigfile+0xb0>
+  close(fd);
+    33ca:	83 ec 0c             	sub    $0xc,%esp
+    33cd:	56                   	push   %esi
+    33ce:	e8 1b 13 00 00       	call   46ee <close>
+  if(total != 20*600){
+    33d3:	83 c4 10             	add    $0x10,%esp
+    33d6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    33dc:	0f 85 9c 00 00 00    	jne    347e <bigfile+0x1ae>
+  unlink("bigfile");
+    33e2:	83 ec 0c             	sub    $0xc,%esp
+    33e5:	68 47 61 00 00       	push   $0x6147
+    33ea:	e8 27 13 00 00       	call   4716 <unlink>
+  printf(1, "bigfile test ok\n");
+    33ef:	58                   	pop    %eax
+    33f0:	5a                   	pop    %edx
+    33f1:	68 d6 61 00 00       	push   $0x61d6
+    33f6:	6a 01                	push   $0x1
+    33f8:	e8 c3 1c 00 00       	call   50c0 <printf>
+}
+    33fd:	83 c4 10             	add    $0x10,%esp
+    3400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3403:	5b                   	pop    %ebx
+    3404:	5e                   	pop    %esi
+    3405:	5f                   	pop    %edi
+    3406:	5d                   	pop    %ebp
+    3407:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    3408:	83 ec 08             	sub    $0x8,%esp
+    340b:	68 a3 61 00 00       	push   $0x61a3
+    3410:	6a 01                	push   $0x1
+    3412:	e8 a9 1c 00 00       	call   50c0 <printf>
+      exit();
+    3417:	e8 94 12 00 00       	call   46b0 <exit>
+      printf(1, "short read bigfile\n");
+    341c:	83 ec 08             	sub    $0x8,%esp
+    341f:	68 8f 61 00 00       	push   $0x618f
+    3424:	6a 01                	push   $0x1
+    3426:	e8 95 1c 00 00       	call   50c0 <printf>
+      exit();
+    342b:	e8 80 12 00 00       	call   46b0 <exit>
+      printf(1, "read bigfile failed\n");
+    3430:	83 ec 08             	sub    $0x8,%esp
+    3433:	68 7a 61 00 00       	push   $0x617a
+    3438:	6a 01                	push   $0x1
+    343a:	e8 81 1c 00 00       	call   50c0 <printf>
+      exit();
+    343f:	e8 6c 12 00 00       	call   46b0 <exit>
+      printf(1, "write bigfile failed\n");
+    3444:	83 ec 08             	sub    $0x8,%esp
+    3447:	68 4f 61 00 00       	push   $0x614f
+    344c:	6a 01                	push   $0x1
+    344e:	e8 6d 1c 00 00       	call   50c0 <printf>
+      exit();
+    3453:	e8 58 12 00 00       	call   46b0 <exit>
+    printf(1, "cannot open bigfile\n");
+    3458:	53                   	push   %ebx
+    3459:	53                   	push   %ebx
+    345a:	68 65 61 00 00       	push   $0x6165
+    345f:	6a 01                	push   $0x1
+    3461:	e8 5a 1c 00 00       	call   50c0 <printf>
+    exit();
+    3466:	e8 45 12 00 00       	call   46b0 <exit>
+    printf(1, "cannot create bigfile");
+    346b:	50                   	push   %eax
+    346c:	50                   	push   %eax
+    346d:	68 39 61 00 00       	push   $0x6139
+    3472:	6a 01                	push   $0x1
+    3474:	e8 47 1c 00 00       	call   50c0 <printf>
+    exit();
+    3479:	e8 32 12 00 00       	call   46b0 <exit>
+    printf(1, "read bigfile wrong total\n");
+    347e:	51                   	push   %ecx
+    347f:	51                   	push   %ecx
+    3480:	68 bc 61 00 00       	push   $0x61bc
+    3485:	6a 01                	push   $0x1
+    3487:	e8 34 1c 00 00       	call   50c0 <printf>
+    exit();
+    348c:	e8 1f 12 00 00       	call   46b0 <exit>
+    3491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    349f:	90                   	nop
+
+000034a0 <fourteen>:
+{
+    34a0:	55                   	push   %ebp
+    34a1:	89 e5                	mov    %esp,%ebp
+    34a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    34a6:	68 e7 61 00 00       	push   $0x61e7
+    34ab:	6a 01                	push   $0x1
+    34ad:	e8 0e 1c 00 00       	call   50c0 <printf>
+  if(mkdir("12345678901234") != 0){
+    34b2:	c7 04 24 22 62 00 00 	movl   $0x6222,(%esp)
+    34b9:	e8 70 12 00 00       	call   472e <mkdir>
+    34be:	83 c4 10             	add    $0x10,%esp
+    34c1:	85 c0                	test   %eax,%eax
+    34c3:	0f 85 97 00 00 00    	jne    3560 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    34c9:	83 ec 0c             	sub    $0xc,%esp
+    34cc:	68 a4 6b 00 00       	push   $0x6ba4
+    34d1:	e8 58 12 00 00       	call   472e <mkdir>
+    34d6:	83 c4 10             	add    $0x10,%esp
+    34d9:	85 c0                	test   %eax,%eax
+    34db:	0f 85 de 00 00 00    	jne    35bf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    34e1:	83 ec 08             	sub    $0x8,%esp
+    34e4:	68 00 02 00 00       	push   $0x200
+    34e9:	68 f4 6b 00 00       	push   $0x6bf4
+    34ee:	e8 13 12 00 00       	call   4706 <open>
+  if(fd < 0){
+    34f3:	83 c4 10             	add    $0x10,%esp
+    34f6:	85 c0                	test   %eax,%eax
+    34f8:	0f 88 ae 00 00 00    	js     35ac <fourteen+0x10c>
+  close(fd);
+    34fe:	83 ec 0c             	sub    $0xc,%esp
+    3501:	50                   	push   %eax
+    3502:	e8 e7 11 00 00       	call   46ee <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3507:	58                   	pop    %eax
+    3508:	5a                   	pop    %edx
+    3509:	6a 00                	push   $0x0
+    350b:	68 64 6c 00 00       	push   $0x6c64
+    3510:	e8 f1 11 00 00       	call   4706 <open>
+  if(fd < 0){
+    3515:	83 c4 10             	add    $0x10,%esp
+    3518:	85 c0                	test   %eax,%eax
+    351a:	78 7d                	js     3599 <fourteen+0xf9>
+  close(fd);
+    351c:	83 ec 0c             	sub    $0xc,%esp
+    351f:	50                   	push   %eax
+    3520:	e8 c9 11 00 00       	call   46ee <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3525:	c7 04 24 13 62 00 00 	movl   $0x6213,(%esp)
+    352c:	e8 fd 11 00 00       	call   472e <mkdir>
+    3531:	83 c4 10             	add    $0x10,%esp
+    3534:	85 c0                	test   %eax,%eax
+    3536:	74 4e                	je     3586 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3538:	83 ec 0c             	sub    $0xc,%esp
+    353b:	68 00 6d 00 00       	push   $0x6d00
+    3540:	e8 e9 11 00 00       	call   472e <mkdir>
+    3545:	83 c4 10             	add    $0x10,%esp
+    3548:	85 c0                	test   %eax,%eax
+    354a:	74 27                	je     3573 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    354c:	83 ec 08             	sub    $0x8,%esp
+    354f:	68 31 62 00 00       	push   $0x6231
+    3554:	6a 01                	push   $0x1
+    3556:	e8 65 1b 00 00       	call   50c0 <printf>
+}
+    355b:	83 c4 10             	add    $0x10,%esp
+    355e:	c9                   	leave
+    355f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3560:	50                   	push   %eax
+    3561:	50                   	push   %eax
+    3562:	68 f6 61 00 00       	push   $0x61f6
+    3567:	6a 01                	push   $0x1
+    3569:	e8 52 1b 00 00       	call   50c0 <printf>
+    exit();
+    356e:	e8 3d 11 00 00       	call   46b0 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3573:	50                   	push   %eax
+    3574:	50                   	push   %eax
+    3575:	68 20 6d 00 00       	push   $0x6d20
+    357a:	6a 01                	push   $0x1
+    357c:	e8 3f 1b 00 00       	call   50c0 <printf>
+    exit();
+    3581:	e8 2a 11 00 00       	call   46b0 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3586:	52                   	push   %edx
+    3587:	52                   	push   %edx
+    3588:	68 d0 6c 00 00       	push   $0x6cd0
+    358d:	6a 01                	push   $0x1
+    358f:	e8 2c 1b 00 00       	call   50c0 <printf>
+    exit();
+    3594:	e8 17 11 00 00       	call   46b0 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3599:	51                   	push   %ecx
+    359a:	51                   	push   %ecx
+    359b:	68 94 6c 00 00       	push   $0x6c94
+    35a0:	6a 01                	push   $0x1
+    35a2:	e8 19 1b 00 00       	call   50c0 <printf>
+    exit();
+    35a7:	e8 04 11 00 00       	call   46b0 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    35ac:	51                   	push   %ecx
+    35ad:	51                   	push   %ecx
+    35ae:	68 24 6c 00 00       	push   $0x6c24
+    35b3:	6a 01                	push   $0x1
+    35b5:	e8 06 1b 00 00       	call   50c0 <printf>
+    exit();
+    35ba:	e8 f1 10 00 00       	call   46b0 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    35bf:	50                   	push   %eax
+    35c0:	50                   	push   %eax
+    35c1:	68 c4 6b 00 00       	push   $0x6bc4
+    35c6:	6a 01                	push   $0x1
+    35c8:	e8 f3 1a 00 00       	call   50c0 <printf>
+    exit();
+    35cd:	e8 de 10 00 00       	call   46b0 <exit>
+    35d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000035e0 <rmdot>:
+{
+    35e0:	55                   	push   %ebp
+    35e1:	89 e5                	mov    %esp,%ebp
+    35e3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    35e6:	68 3e 62 00 00       	push   $0x623e
+    35eb:	6a 01                	push   $0x1
+    35ed:	e8 ce 1a 00 00       	call   50c0 <printf>
+  if(mkdir("dots") != 0){
+    35f2:	c7 04 24 4a 62 00 00 	movl   $0x624a,(%esp)
+    35f9:	e8 30 11 00 00       	call   472e <mkdir>
+    35fe:	83 c4 10             	add    $0x10,%esp
+    3601:	85 c0                	test   %eax,%eax
+    3603:	0f 85 b0 00 00 00    	jne    36b9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    3609:	83 ec 0c             	sub    $0xc,%esp
+    360c:	68 4a 62 00 00       	push   $0x624a
+    3611:	e8 20 11 00 00       	call   4736 <chdir>
+    3616:	83 c4 10             	add    $0x10,%esp
+    3619:	85 c0                	test   %eax,%eax
+    361b:	0f 85 1d 01 00 00    	jne    373e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    3621:	83 ec 0c             	sub    $0xc,%esp
+    3624:	68 f5 5e 00 00       	push   $0x5ef5
+    3629:	e8 e8 10 00 00       	call   4716 <unlink>
+    362e:	83 c4 10             	add    $0x10,%esp
+    3631:	85 c0                	test   %eax,%eax
+    3633:	0f 84 f2 00 00 00    	je     372b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    3639:	83 ec 0c             	sub    $0xc,%esp
+    363c:	68 f4 5e 00 00       	push   $0x5ef4
+    3641:	e8 d0 10 00 00       	call   4716 <unlink>
+    3646:	83 c4 10             	add    $0x10,%esp
+    3649:	85 c0                	test   %eax,%eax
+    364b:	0f 84 c7 00 00 00    	je     3718 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3651:	83 ec 0c             	sub    $0xc,%esp
+    3654:	68 03 53 00 00       	push   $0x5303
+    3659:	e8 d8 10 00 00       	call   4736 <chdir>
+    365e:	83 c4 10             	add    $0x10,%esp
+    3661:	85 c0                	test   %eax,%eax
+    3663:	0f 85 9c 00 00 00    	jne    3705 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3669:	83 ec 0c             	sub    $0xc,%esp
+    366c:	68 92 62 00 00       	push   $0x6292
+    3671:	e8 a0 10 00 00       	call   4716 <unlink>
+    3676:	83 c4 10             	add    $0x10,%esp
+    3679:	85 c0                	test   %eax,%eax
+    367b:	74 75                	je     36f2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    367d:	83 ec 0c             	sub    $0xc,%esp
+    3680:	68 b0 62 00 00       	push   $0x62b0
+    3685:	e8 8c 10 00 00       	call   4716 <unlink>
+    368a:	83 c4 10             	add    $0x10,%esp
+    368d:	85 c0                	test   %eax,%eax
+    368f:	74 4e                	je     36df <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3691:	83 ec 0c             	sub    $0xc,%esp
+    3694:	68 4a 62 00 00       	push   $0x624a
+    3699:	e8 78 10 00 00       	call   4716 <unlink>
+    369e:	83 c4 10             	add    $0x10,%esp
+    36a1:	85 c0                	test   %eax,%eax
+    36a3:	75 27                	jne    36cc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    36a5:	83 ec 08             	sub    $0x8,%esp
+    36a8:	68 e5 62 00 00       	push   $0x62e5
+    36ad:	6a 01                	push   $0x1
+    36af:	e8 0c 1a 00 00       	call   50c0 <printf>
+}
+    36b4:	83 c4 10             	add    $0x10,%esp
+    36b7:	c9                   	leave
+    36b8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    36b9:	50                   	push   %eax
+    36ba:	50                   	push   %eax
+    36bb:	68 4f 62 00 00       	push   $0x624f
+    36c0:	6a 01                	push   $0x1
+    36c2:	e8 f9 19 00 00       	call   50c0 <printf>
+    exit();
+    36c7:	e8 e4 0f 00 00       	call   46b0 <exit>
+    printf(1, "unlink dots failed!\n");
+    36cc:	50                   	push   %eax
+    36cd:	50                   	push   %eax
+    36ce:	68 d0 62 00 00       	push   $0x62d0
+    36d3:	6a 01                	push   $0x1
+    36d5:	e8 e6 19 00 00       	call   50c0 <printf>
+    exit();
+    36da:	e8 d1 0f 00 00       	call   46b0 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    36df:	52                   	push   %edx
+    36e0:	52                   	push   %edx
+    36e1:	68 b8 62 00 00       	push   $0x62b8
+    36e6:	6a 01                	push   $0x1
+    36e8:	e8 d3 19 00 00       	call   50c0 <printf>
+    exit();
+    36ed:	e8 be 0f 00 00       	call   46b0 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    36f2:	51                   	push   %ecx
+    36f3:	51                   	push   %ecx
+    36f4:	68 99 62 00 00       	push   $0x6299
+    36f9:	6a 01                	push   $0x1
+    36fb:	e8 c0 19 00 00       	call   50c0 <printf>
+    exit();
+    3700:	e8 ab 0f 00 00       	call   46b0 <exit>
+    printf(1, "chdir / failed\n");
+    3705:	50                   	push   %eax
+    3706:	50                   	push   %eax
+    3707:	68 05 53 00 00       	push   $0x5305
+    370c:	6a 01                	push   $0x1
+    370e:	e8 ad 19 00 00       	call   50c0 <printf>
+    exit();
+    3713:	e8 98 0f 00 00       	call   46b0 <exit>
+    printf(1, "rm .. worked!\n");
+    3718:	50                   	push   %eax
+    3719:	50                   	push   %eax
+    371a:	68 83 62 00 00       	push   $0x6283
+    371f:	6a 01                	push   $0x1
+    3721:	e8 9a 19 00 00       	call   50c0 <printf>
+    exit();
+    3726:	e8 85 0f 00 00       	call   46b0 <exit>
+    printf(1, "rm . worked!\n");
+    372b:	50                   	push   %eax
+    372c:	50                   	push   %eax
+    372d:	68 75 62 00 00       	push   $0x6275
+    3732:	6a 01                	push   $0x1
+    3734:	e8 87 19 00 00       	call   50c0 <printf>
+    exit();
+    3739:	e8 72 0f 00 00       	call   46b0 <exit>
+    printf(1, "chdir dots failed\n");
+    373e:	50                   	push   %eax
+    373f:	50                   	push   %eax
+    3740:	68 62 62 00 00       	push   $0x6262
+    3745:	6a 01                	push   $0x1
+    3747:	e8 74 19 00 00       	call   50c0 <printf>
+    exit();
+    374c:	e8 5f 0f 00 00       	call   46b0 <exit>
+    3751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    375f:	90                   	nop
+
+00003760 <dirfile>:
+{
+    3760:	55                   	push   %ebp
+    3761:	89 e5                	mov    %esp,%ebp
+    3763:	53                   	push   %ebx
+    3764:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3767:	68 ef 62 00 00       	push   $0x62ef
+    376c:	6a 01                	push   $0x1
+    376e:	e8 4d 19 00 00       	call   50c0 <printf>
+  fd = open("dirfile", O_CREATE);
+    3773:	5b                   	pop    %ebx
+    3774:	58                   	pop    %eax
+    3775:	68 00 02 00 00       	push   $0x200
+    377a:	68 fc 62 00 00       	push   $0x62fc
+    377f:	e8 82 0f 00 00       	call   4706 <open>
+  if(fd < 0){
+    3784:	83 c4 10             	add    $0x10,%esp
+    3787:	85 c0                	test   %eax,%eax
+    3789:	0f 88 43 01 00 00    	js     38d2 <dirfile+0x172>
+  close(fd);
+    378f:	83 ec 0c             	sub    $0xc,%esp
+    3792:	50                   	push   %eax
+    3793:	e8 56 0f 00 00       	call   46ee <close>
+  if(chdir("dirfile") == 0){
+    3798:	c7 04 24 fc 62 00 00 	movl   $0x62fc,(%esp)
+    379f:	e8 92 0f 00 00       	call   4736 <chdir>
+    37a4:	83 c4 10             	add    $0x10,%esp
+    37a7:	85 c0                	test   %eax,%eax
+    37a9:	0f 84 10 01 00 00    	je     38bf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    37af:	83 ec 08             	sub    $0x8,%esp
+    37b2:	6a 00                	push   $0x0
+    37b4:	68 35 63 00 00       	push   $0x6335
+    37b9:	e8 48 0f 00 00       	call   4706 <open>
+  if(fd >= 0){
+    37be:	83 c4 10             	add    $0x10,%esp
+    37c1:	85 c0                	test   %eax,%eax
+    37c3:	0f 89 e3 00 00 00    	jns    38ac <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    37c9:	83 ec 08             	sub    $0x8,%esp
+    37cc:	68 00 02 00 00       	push   $0x200
+    37d1:	68 35 63 00 00       	push   $0x6335
+    37d6:	e8 2b 0f 00 00       	call   4706 <open>
+  if(fd >= 0){
+    37db:	83 c4 10             	add    $0x10,%esp
+    37de:	85 c0                	test   %eax,%eax
+    37e0:	0f 89 c6 00 00 00    	jns    38ac <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    37e6:	83 ec 0c             	sub    $0xc,%esp
+    37e9:	68 35 63 00 00       	push   $0x6335
+    37ee:	e8 3b 0f 00 00       	call   472e <mkdir>
+    37f3:	83 c4 10             	add    $0x10,%esp
+    37f6:	85 c0                	test   %eax,%eax
+    37f8:	0f 84 46 01 00 00    	je     3944 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    37fe:	83 ec 0c             	sub    $0xc,%esp
+    3801:	68 35 63 00 00       	push   $0x6335
+    3806:	e8 0b 0f 00 00       	call   4716 <unlink>
+    380b:	83 c4 10             	add    $0x10,%esp
+    380e:	85 c0                	test   %eax,%eax
+    3810:	0f 84 1b 01 00 00    	je     3931 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    3816:	83 ec 08             	sub    $0x8,%esp
+    3819:	68 35 63 00 00       	push   $0x6335
+    381e:	68 99 63 00 00       	push   $0x6399
+    3823:	e8 fe 0e 00 00       	call   4726 <link>
+    3828:	83 c4 10             	add    $0x10,%esp
+    382b:	85 c0                	test   %eax,%eax
+    382d:	0f 84 eb 00 00 00    	je     391e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    3833:	83 ec 0c             	sub    $0xc,%esp
+    3836:	68 fc 62 00 00       	push   $0x62fc
+    383b:	e8 d6 0e 00 00       	call   4716 <unlink>
+    3840:	83 c4 10             	add    $0x10,%esp
+    3843:	85 c0                	test   %eax,%eax
+    3845:	0f 85 c0 00 00 00    	jne    390b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    384b:	83 ec 08             	sub    $0x8,%esp
+    384e:	6a 02                	push   $0x2
+    3850:	68 f5 5e 00 00       	push   $0x5ef5
+    3855:	e8 ac 0e 00 00       	call   4706 <open>
+  if(fd >= 0){
+    385a:	83 c4 10             	add    $0x10,%esp
+    385d:	85 c0                	test   %eax,%eax
+    385f:	0f 89 93 00 00 00    	jns    38f8 <dirfile+0x198>
+  fd = open(".", 0);
+    3865:	83 ec 08             	sub    $0x8,%esp
+    3868:	6a 00                	push   $0x0
+    386a:	68 f5 5e 00 00       	push   $0x5ef5
+    386f:	e8 92 0e 00 00       	call   4706 <open>
+  if(write(fd, "x", 1) > 0){
+    3874:	83 c4 0c             	add    $0xc,%esp
+    3877:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3879:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    387b:	68 1d 5d 00 00       	push   $0x5d1d
+    3880:	50                   	push   %eax
+    3881:	e8 60 0e 00 00       	call   46e6 <write>
+    3886:	83 c4 10             	add    $0x10,%esp
+    3889:	85 c0                	test   %eax,%eax
+    388b:	7f 58                	jg     38e5 <dirfile+0x185>
+  close(fd);
+    388d:	83 ec 0c             	sub    $0xc,%esp
+    3890:	53                   	push   %ebx
+    3891:	e8 58 0e 00 00       	call   46ee <close>
+  printf(1, "dir vs file OK\n");
+    3896:	58                   	pop    %eax
+    3897:	5a                   	pop    %edx
+    3898:	68 cc 63 00 00       	push   $0x63cc
+    389d:	6a 01                	push   $0x1
+    389f:	e8 1c 18 00 00       	call   50c0 <printf>
+}
+    38a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38a7:	83 c4 10             	add    $0x10,%esp
+    38aa:	c9                   	leave
+    38ab:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    38ac:	50                   	push   %eax
+    38ad:	50                   	push   %eax
+    38ae:	68 40 63 00 00       	push   $0x6340
+    38b3:	6a 01                	push   $0x1
+    38b5:	e8 06 18 00 00       	call   50c0 <printf>
+    exit();
+    38ba:	e8 f1 0d 00 00       	call   46b0 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    38bf:	52                   	push   %edx
+    38c0:	52                   	push   %edx
+    38c1:	68 1b 63 00 00       	push   $0x631b
+    38c6:	6a 01                	push   $0x1
+    38c8:	e8 f3 17 00 00       	call   50c0 <printf>
+    exit();
+    38cd:	e8 de 0d 00 00       	call   46b0 <exit>
+    printf(1, "create dirfile failed\n");
+    38d2:	51                   	push   %ecx
+    38d3:	51                   	push   %ecx
+    38d4:	68 04 63 00 00       	push   $0x6304
+    38d9:	6a 01                	push   $0x1
+    38db:	e8 e0 17 00 00       	call   50c0 <printf>
+    exit();
+    38e0:	e8 cb 0d 00 00       	call   46b0 <exit>
+    printf(1, "write . succeeded!\n");
+    38e5:	51                   	push   %ecx
+    38e6:	51                   	push   %ecx
+    38e7:	68 b8 63 00 00       	push   $0x63b8
+    38ec:	6a 01                	push   $0x1
+    38ee:	e8 cd 17 00 00       	call   50c0 <printf>
+    exit();
+    38f3:	e8 b8 0d 00 00       	call   46b0 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    38f8:	53                   	push   %ebx
+    38f9:	53                   	push   %ebx
+    38fa:	68 74 6d 00 00       	push   $0x6d74
+    38ff:	6a 01                	push   $0x1
+    3901:	e8 ba 17 00 00       	call   50c0 <printf>
+    exit();
+    3906:	e8 a5 0d 00 00       	call   46b0 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    390b:	50                   	push   %eax
+    390c:	50                   	push   %eax
+    390d:	68 a0 63 00 00       	push   $0x63a0
+    3912:	6a 01                	push   $0x1
+    3914:	e8 a7 17 00 00       	call   50c0 <printf>
+    exit();
+    3919:	e8 92 0d 00 00       	call   46b0 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    391e:	50                   	push   %eax
+    391f:	50                   	push   %eax
+    3920:	68 54 6d 00 00       	push   $0x6d54
+    3925:	6a 01                	push   $0x1
+    3927:	e8 94 17 00 00       	call   50c0 <printf>
+    exit();
+    392c:	e8 7f 0d 00 00       	call   46b0 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3931:	50                   	push   %eax
+    3932:	50                   	push   %eax
+    3933:	68 7b 63 00 00       	push   $0x637b
+    3938:	6a 01                	push   $0x1
+    393a:	e8 81 17 00 00       	call   50c0 <printf>
+    exit();
+    393f:	e8 6c 0d 00 00       	call   46b0 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3944:	50                   	push   %eax
+    3945:	50                   	push   %eax
+    3946:	68 5e 63 00 00       	push   $0x635e
+    394b:	6a 01                	push   $0x1
+    394d:	e8 6e 17 00 00       	call   50c0 <printf>
+    exit();
+    3952:	e8 59 0d 00 00       	call   46b0 <exit>
+    3957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    395e:	66 90                	xchg   %ax,%ax
+
+00003960 <iref>:
+{
+    3960:	55                   	push   %ebp
+    3961:	89 e5                	mov    %esp,%ebp
+    3963:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3964:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3969:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    396c:	68 dc 63 00 00       	push   $0x63dc
+    3971:	6a 01                	push   $0x1
+    3973:	e8 48 17 00 00       	call   50c0 <printf>
+    3978:	83 c4 10             	add    $0x10,%esp
+    397b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    397f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3980:	83 ec 0c             	sub    $0xc,%esp
+    3983:	68 ed 63 00 00       	push   $0x63ed
+    3988:	e8 a1 0d 00 00       	call   472e <mkdir>
+    398d:	83 c4 10             	add    $0x10,%esp
+    3990:	85 c0                	test   %eax,%eax
+    3992:	0f 85 bb 00 00 00    	jne    3a53 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3998:	83 ec 0c             	sub    $0xc,%esp
+    399b:	68 ed 63 00 00       	push   $0x63ed
+    39a0:	e8 91 0d 00 00       	call   4736 <chdir>
+    39a5:	83 c4 10             	add    $0x10,%esp
+    39a8:	85 c0                	test   %eax,%eax
+    39aa:	0f 85 b7 00 00 00    	jne    3a67 <iref+0x107>
+    mkdir("");
+    39b0:	83 ec 0c             	sub    $0xc,%esp
+    39b3:	68 ec 59 00 00       	push   $0x59ec
+    39b8:	e8 71 0d 00 00       	call   472e <mkdir>
+    link("README", "");
+    39bd:	59                   	pop    %ecx
+    39be:	58                   	pop    %eax
+    39bf:	68 ec 59 00 00       	push   $0x59ec
+    39c4:	68 99 63 00 00       	push   $0x6399
+    39c9:	e8 58 0d 00 00       	call   4726 <link>
+    fd = open("", O_CREATE);
+    39ce:	58                   	pop    %eax
+    39cf:	5a                   	pop    %edx
+    39d0:	68 00 02 00 00       	push   $0x200
+    39d5:	68 ec 59 00 00       	push   $0x59ec
+    39da:	e8 27 0d 00 00       	call   4706 <open>
+    if(fd >= 0)
+    39df:	83 c4 10             	add    $0x10,%esp
+    39e2:	85 c0                	test   %eax,%eax
+    39e4:	78 0c                	js     39f2 <iref+0x92>
+      close(fd);
+    39e6:	83 ec 0c             	sub    $0xc,%esp
+    39e9:	50                   	push   %eax
+    39ea:	e8 ff 0c 00 00       	call   46ee <close>
+    39ef:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    39f2:	83 ec 08             	sub    $0x8,%esp
+    39f5:	68 00 02 00 00       	push   $0x200
+    39fa:	68 d7 5f 00 00       	push   $0x5fd7
+    39ff:	e8 02 0d 00 00       	call   4706 <open>
+    if(fd >= 0)
+    3a04:	83 c4 10             	add    $0x10,%esp
+    3a07:	85 c0                	test   %eax,%eax
+    3a09:	78 0c                	js     3a17 <iref+0xb7>
+      close(fd);
+    3a0b:	83 ec 0c             	sub    $0xc,%esp
+    3a0e:	50                   	push   %eax
+    3a0f:	e8 da 0c 00 00       	call   46ee <close>
+    3a14:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3a17:	83 ec 0c             	sub    $0xc,%esp
+    3a1a:	68 d7 5f 00 00       	push   $0x5fd7
+    3a1f:	e8 f2 0c 00 00       	call   4716 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3a24:	83 c4 10             	add    $0x10,%esp
+    3a27:	83 eb 01             	sub    $0x1,%ebx
+    3a2a:	0f 85 50 ff ff ff    	jne    3980 <iref+0x20>
+  chdir("/");
+    3a30:	83 ec 0c             	sub    $0xc,%esp
+    3a33:	68 03 53 00 00       	push   $0x5303
+    3a38:	e8 f9 0c 00 00       	call   4736 <chdir>
+  printf(1, "empty file name OK\n");
+    3a3d:	58                   	pop    %eax
+    3a3e:	5a                   	pop    %edx
+    3a3f:	68 1b 64 00 00       	push   $0x641b
+    3a44:	6a 01                	push   $0x1
+    3a46:	e8 75 16 00 00       	call   50c0 <printf>
+}
+    3a4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a4e:	83 c4 10             	add    $0x10,%esp
+    3a51:	c9                   	leave
+    3a52:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    3a53:	83 ec 08             	sub    $0x8,%esp
+    3a56:	68 f3 63 00 00       	push   $0x63f3
+    3a5b:	6a 01                	push   $0x1
+    3a5d:	e8 5e 16 00 00       	call   50c0 <printf>
+      exit();
+    3a62:	e8 49 0c 00 00       	call   46b0 <exit>
+      printf(1, "chdir irefd failed\n");
+    3a67:	83 ec 08             	sub    $0x8,%esp
+    3a6a:	68 07 64 00 00       	push   $0x6407
+    3a6f:	6a 01                	push   $0x1
+    3a71:	e8 4a 16 00 00       	call   50c0 <printf>
+      exit();
+    3a76:	e8 35 0c 00 00       	call   46b0 <exit>
+    3a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a7f:	90                   	nop
+
+00003a80 <forktest>:
+{
+    3a80:	55                   	push   %ebp
+    3a81:	89 e5                	mov    %esp,%ebp
+    3a83:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3a84:	31 db                	xor    %ebx,%ebx
+{
+    3a86:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3a89:	68 2f 64 00 00       	push   $0x642f
+    3a8e:	6a 01                	push   $0x1
+    3a90:	e8 2b 16 00 00       	call   50c0 <printf>
+    3a95:	83 c4 10             	add    $0x10,%esp
+    3a98:	eb 13                	jmp    3aad <forktest+0x2d>
+    3a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3aa0:	74 4d                	je     3aef <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3aa2:	83 c3 01             	add    $0x1,%ebx
+    3aa5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    3aab:	74 6e                	je     3b1b <forktest+0x9b>
+    pid = fork();
+    3aad:	e8 14 0c 00 00       	call   46c6 <fork>
+    if(pid < 0)
+    3ab2:	85 c0                	test   %eax,%eax
+    3ab4:	79 ea                	jns    3aa0 <forktest+0x20>
+  for(; n > 0; n--){
+    3ab6:	85 db                	test   %ebx,%ebx
+    3ab8:	74 14                	je     3ace <forktest+0x4e>
+    3aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3ac0:	e8 09 0c 00 00       	call   46ce <wait>
+    3ac5:	85 c0                	test   %eax,%eax
+    3ac7:	78 2b                	js     3af4 <forktest+0x74>
+  for(; n > 0; n--){
+    3ac9:	83 eb 01             	sub    $0x1,%ebx
+    3acc:	75 f2                	jne    3ac0 <forktest+0x40>
+  if(wait() != -1){
+    3ace:	e8 fb 0b 00 00       	call   46ce <wait>
+    3ad3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ad6:	75 30                	jne    3b08 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3ad8:	83 ec 08             	sub    $0x8,%esp
+    3adb:	68 61 64 00 00       	push   $0x6461
+    3ae0:	6a 01                	push   $0x1
+    3ae2:	e8 d9 15 00 00       	call   50c0 <printf>
+}
+    3ae7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3aea:	83 c4 10             	add    $0x10,%esp
+    3aed:	c9                   	leave
+    3aee:	c3                   	ret
+      exit();
+    3aef:	e8 bc 0b 00 00       	call   46b0 <exit>
+      printf(1, "wait stopped early\n");
+    3af4:	83 ec 08             	sub    $0x8,%esp
+    3af7:	68 3a 64 00 00       	push   $0x643a
+    3afc:	6a 01                	push   $0x1
+    3afe:	e8 bd 15 00 00       	call   50c0 <printf>
+      exit();
+    3b03:	e8 a8 0b 00 00       	call   46b0 <exit>
+    printf(1, "wait got too many\n");
+    3b08:	50                   	push   %eax
+    3b09:	50                   	push   %eax
+    3b0a:	68 4e 64 00 00       	push   $0x644e
+    3b0f:	6a 01                	push   $0x1
+    3b11:	e8 aa 15 00 00       	call   50c0 <printf>
+    exit();
+    3b16:	e8 95 0b 00 00       	call   46b0 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    3b1b:	52                   	push   %edx
+    3b1c:	52                   	push   %edx
+    3b1d:	68 94 6d 00 00       	push   $0x6d94
+    3b22:	6a 01                	push   $0x1
+    3b24:	e8 97 15 00 00       	call   50c0 <printf>
+    exit();
+    3b29:	e8 82 0b 00 00       	call   46b0 <exit>
+    3b2e:	66 90                	xchg   %ax,%ax
+
+00003b30 <sbrktest>:
+{
+    3b30:	55                   	push   %ebp
+    3b31:	89 e5                	mov    %esp,%ebp
+    3b33:	57                   	push   %edi
+    3b34:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3b35:	31 f6                	xor    %esi,%esi
+{
+    3b37:	53                   	push   %ebx
+    3b38:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    3b3b:	68 6f 64 00 00       	push   $0x646f
+    3b40:	ff 35 48 7c 00 00    	push   0x7c48
+    3b46:	e8 75 15 00 00       	call   50c0 <printf>
+  oldbrk = sbrk(0);
+    3b4b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b52:	e8 f7 0b 00 00       	call   474e <sbrk>
+    3b57:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    3b5a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b61:	e8 e8 0b 00 00       	call   474e <sbrk>
+    3b66:	83 c4 10             	add    $0x10,%esp
+    3b69:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    3b6b:	eb 05                	jmp    3b72 <sbrktest+0x42>
+    3b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3b70:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3b72:	83 ec 0c             	sub    $0xc,%esp
+    3b75:	6a 01                	push   $0x1
+    3b77:	e8 d2 0b 00 00       	call   474e <sbrk>
+    if(b != a){
+    3b7c:	83 c4 10             	add    $0x10,%esp
+    3b7f:	39 d8                	cmp    %ebx,%eax
+    3b81:	0f 85 a4 02 00 00    	jne    3e2b <sbrktest+0x2fb>
+  for(i = 0; i < 5000; i++){
+    3b87:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    3b8a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    3b8d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3b90:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3b96:	75 d8                	jne    3b70 <sbrktest+0x40>
+  pid = fork();
+    3b98:	e8 29 0b 00 00       	call   46c6 <fork>
+    3b9d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    3b9f:	85 c0                	test   %eax,%eax
+    3ba1:	0f 88 0c 03 00 00    	js     3eb3 <sbrktest+0x383>
+  c = sbrk(1);
+    3ba7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    3baa:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    3bad:	6a 01                	push   $0x1
+    3baf:	e8 9a 0b 00 00       	call   474e <sbrk>
+  c = sbrk(1);
+    3bb4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3bbb:	e8 8e 0b 00 00       	call   474e <sbrk>
+  if(c != a + 1){
+    3bc0:	83 c4 10             	add    $0x10,%esp
+    3bc3:	39 c3                	cmp    %eax,%ebx
+    3bc5:	0f 85 45 03 00 00    	jne    3f10 <sbrktest+0x3e0>
+  if(pid == 0)
+    3bcb:	85 f6                	test   %esi,%esi
+    3bcd:	0f 84 38 03 00 00    	je     3f0b <sbrktest+0x3db>
+  wait();
+    3bd3:	e8 f6 0a 00 00       	call   46ce <wait>
+  a = sbrk(0);
+    3bd8:	83 ec 0c             	sub    $0xc,%esp
+    3bdb:	6a 00                	push   $0x0
+    3bdd:	e8 6c 0b 00 00       	call   474e <sbrk>
+    3be2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3be4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3be9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3beb:	89 04 24             	mov    %eax,(%esp)
+    3bee:	e8 5b 0b 00 00       	call   474e <sbrk>
+  if (p != a) {
+    3bf3:	83 c4 10             	add    $0x10,%esp
+    3bf6:	39 c3                	cmp    %eax,%ebx
+    3bf8:	0f 85 9e 02 00 00    	jne    3e9c <sbrktest+0x36c>
+  a = sbrk(0);
+    3bfe:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3c01:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3c08:	6a 00                	push   $0x0
+    3c0a:	e8 3f 0b 00 00       	call   474e <sbrk>
+  c = sbrk(-4096);
+    3c0f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3c16:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3c18:	e8 31 0b 00 00       	call   474e <sbrk>
+  if(c == (char*)0xffffffff){
+    3c1d:	83 c4 10             	add    $0x10,%esp
+    3c20:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c23:	0f 84 2c 03 00 00    	je     3f55 <sbrktest+0x425>
+  c = sbrk(0);
+    3c29:	83 ec 0c             	sub    $0xc,%esp
+    3c2c:	6a 00                	push   $0x0
+    3c2e:	e8 1b 0b 00 00       	call   474e <sbrk>
+  if(c != a - 4096){
+    3c33:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3c39:	83 c4 10             	add    $0x10,%esp
+    3c3c:	39 d0                	cmp    %edx,%eax
+    3c3e:	0f 85 fa 02 00 00    	jne    3f3e <sbrktest+0x40e>
+  a = sbrk(0);
+    3c44:	83 ec 0c             	sub    $0xc,%esp
+    3c47:	6a 00                	push   $0x0
+    3c49:	e8 00 0b 00 00       	call   474e <sbrk>
+  c = sbrk(4096);
+    3c4e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3c55:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3c57:	e8 f2 0a 00 00       	call   474e <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3c5c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3c5f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3c61:	39 c3                	cmp    %eax,%ebx
+    3c63:	0f 85 be 02 00 00    	jne    3f27 <sbrktest+0x3f7>
+    3c69:	83 ec 0c             	sub    $0xc,%esp
+    3c6c:	6a 00                	push   $0x0
+    3c6e:	e8 db 0a 00 00       	call   474e <sbrk>
+    3c73:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3c79:	83 c4 10             	add    $0x10,%esp
+    3c7c:	39 c2                	cmp    %eax,%edx
+    3c7e:	0f 85 a3 02 00 00    	jne    3f27 <sbrktest+0x3f7>
+  if(*lastaddr == 99){
+    3c84:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3c8b:	0f 84 39 02 00 00    	je     3eca <sbrktest+0x39a>
+  a = sbrk(0);
+    3c91:	83 ec 0c             	sub    $0xc,%esp
+    3c94:	6a 00                	push   $0x0
+    3c96:	e8 b3 0a 00 00       	call   474e <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3c9b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3ca2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3ca4:	e8 a5 0a 00 00       	call   474e <sbrk>
+    3ca9:	89 c2                	mov    %eax,%edx
+    3cab:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3cae:	29 d0                	sub    %edx,%eax
+    3cb0:	89 04 24             	mov    %eax,(%esp)
+    3cb3:	e8 96 0a 00 00       	call   474e <sbrk>
+  if(c != a){
+    3cb8:	83 c4 10             	add    $0x10,%esp
+    3cbb:	39 c3                	cmp    %eax,%ebx
+    3cbd:	0f 85 c2 01 00 00    	jne    3e85 <sbrktest+0x355>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3cc3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ccf:	90                   	nop
+    ppid = getpid();
+    3cd0:	e8 71 0a 00 00       	call   4746 <getpid>
+    3cd5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3cd7:	e8 ea 09 00 00       	call   46c6 <fork>
+    if(pid < 0){
+    3cdc:	85 c0                	test   %eax,%eax
+    3cde:	0f 88 65 01 00 00    	js     3e49 <sbrktest+0x319>
+    if(pid == 0){
+    3ce4:	0f 84 77 01 00 00    	je     3e61 <sbrktest+0x331>
+    wait();
+    3cea:	e8 df 09 00 00       	call   46ce <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3cef:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3cf5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    3cfb:	75 d3                	jne    3cd0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    3cfd:	83 ec 0c             	sub    $0xc,%esp
+    3d00:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3d03:	50                   	push   %eax
+    3d04:	e8 cd 09 00 00       	call   46d6 <pipe>
+    3d09:	83 c4 10             	add    $0x10,%esp
+    3d0c:	85 c0                	test   %eax,%eax
+    3d0e:	0f 85 e4 01 00 00    	jne    3ef8 <sbrktest+0x3c8>
+    3d14:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3d17:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    3d1a:	89 df                	mov    %ebx,%edi
+    3d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3d20:	e8 a1 09 00 00       	call   46c6 <fork>
+    3d25:	89 07                	mov    %eax,(%edi)
+    3d27:	85 c0                	test   %eax,%eax
+    3d29:	0f 84 93 00 00 00    	je     3dc2 <sbrktest+0x292>
+    if(pids[i] != -1)
+    3d2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d32:	74 14                	je     3d48 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3d34:	83 ec 04             	sub    $0x4,%esp
+    3d37:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3d3a:	6a 01                	push   $0x1
+    3d3c:	50                   	push   %eax
+    3d3d:	ff 75 b8             	push   -0x48(%ebp)
+    3d40:	e8 99 09 00 00       	call   46de <read>
+    3d45:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d48:	83 c7 04             	add    $0x4,%edi
+    3d4b:	39 f7                	cmp    %esi,%edi
+    3d4d:	75 d1                	jne    3d20 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    3d4f:	83 ec 0c             	sub    $0xc,%esp
+    3d52:	68 00 10 00 00       	push   $0x1000
+    3d57:	e8 f2 09 00 00       	call   474e <sbrk>
+    3d5c:	83 c4 10             	add    $0x10,%esp
+    3d5f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3d68:	8b 03                	mov    (%ebx),%eax
+    3d6a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d6d:	74 13                	je     3d82 <sbrktest+0x252>
+    kill(pids[i], SIGKILL);
+    3d6f:	83 ec 08             	sub    $0x8,%esp
+    3d72:	6a 09                	push   $0x9
+    3d74:	50                   	push   %eax
+    3d75:	e8 7c 09 00 00       	call   46f6 <kill>
+    wait();
+    3d7a:	e8 4f 09 00 00       	call   46ce <wait>
+    3d7f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d82:	83 c3 04             	add    $0x4,%ebx
+    3d85:	39 f3                	cmp    %esi,%ebx
+    3d87:	75 df                	jne    3d68 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3d89:	83 ff ff             	cmp    $0xffffffff,%edi
+    3d8c:	0f 84 4f 01 00 00    	je     3ee1 <sbrktest+0x3b1>
+  if(sbrk(0) > oldbrk)
+    3d92:	83 ec 0c             	sub    $0xc,%esp
+    3d95:	6a 00                	push   $0x0
+    3d97:	e8 b2 09 00 00       	call   474e <sbrk>
+    3d9c:	83 c4 10             	add    $0x10,%esp
+    3d9f:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3da2:	72 66                	jb     3e0a <sbrktest+0x2da>
+  printf(stdout, "sbrk test OK\n");
+    3da4:	83 ec 08             	sub    $0x8,%esp
+    3da7:	68 17 65 00 00       	push   $0x6517
+    3dac:	ff 35 48 7c 00 00    	push   0x7c48
+    3db2:	e8 09 13 00 00       	call   50c0 <printf>
+}
+    3db7:	83 c4 10             	add    $0x10,%esp
+    3dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3dbd:	5b                   	pop    %ebx
+    3dbe:	5e                   	pop    %esi
+    3dbf:	5f                   	pop    %edi
+    3dc0:	5d                   	pop    %ebp
+    3dc1:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3dc2:	83 ec 0c             	sub    $0xc,%esp
+    3dc5:	6a 00                	push   $0x0
+    3dc7:	e8 82 09 00 00       	call   474e <sbrk>
+    3dcc:	89 c2                	mov    %eax,%edx
+    3dce:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3dd3:	29 d0                	sub    %edx,%eax
+    3dd5:	89 04 24             	mov    %eax,(%esp)
+    3dd8:	e8 71 09 00 00       	call   474e <sbrk>
+      write(fds[1], "x", 1);
+    3ddd:	83 c4 0c             	add    $0xc,%esp
+    3de0:	6a 01                	push   $0x1
+    3de2:	68 1d 5d 00 00       	push   $0x5d1d
+    3de7:	ff 75 bc             	push   -0x44(%ebp)
+    3dea:	e8 f7 08 00 00       	call   46e6 <write>
+    3def:	83 c4 10             	add    $0x10,%esp
+    3df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      for(;;) sleep(1000);
+    3df8:	83 ec 0c             	sub    $0xc,%esp
+    3dfb:	68 e8 03 00 00       	push   $0x3e8
+    3e00:	e8 51 09 00 00       	call   4756 <sleep>
+    3e05:	83 c4 10             	add    $0x10,%esp
+    3e08:	eb ee                	jmp    3df8 <sbrktest+0x2c8>
+    sbrk(-(sbrk(0) - oldbrk));
+    3e0a:	83 ec 0c             	sub    $0xc,%esp
+    3e0d:	6a 00                	push   $0x0
+    3e0f:	e8 3a 09 00 00       	call   474e <sbrk>
+    3e14:	89 c2                	mov    %eax,%edx
+    3e16:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3e19:	29 d0                	sub    %edx,%eax
+    3e1b:	89 04 24             	mov    %eax,(%esp)
+    3e1e:	e8 2b 09 00 00       	call   474e <sbrk>
+    3e23:	83 c4 10             	add    $0x10,%esp
+    3e26:	e9 79 ff ff ff       	jmp    3da4 <sbrktest+0x274>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3e2b:	83 ec 0c             	sub    $0xc,%esp
+    3e2e:	50                   	push   %eax
+    3e2f:	53                   	push   %ebx
+    3e30:	56                   	push   %esi
+    3e31:	68 7a 64 00 00       	push   $0x647a
+    3e36:	ff 35 48 7c 00 00    	push   0x7c48
+    3e3c:	e8 7f 12 00 00       	call   50c0 <printf>
+      exit();
+    3e41:	83 c4 20             	add    $0x20,%esp
+    3e44:	e8 67 08 00 00       	call   46b0 <exit>
+      printf(stdout, "fork failed\n");
+    3e49:	83 ec 08             	sub    $0x8,%esp
+    3e4c:	68 c0 65 00 00       	push   $0x65c0
+    3e51:	ff 35 48 7c 00 00    	push   0x7c48
+    3e57:	e8 64 12 00 00       	call   50c0 <printf>
+      exit();
+    3e5c:	e8 4f 08 00 00       	call   46b0 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3e61:	0f be 03             	movsbl (%ebx),%eax
+    3e64:	50                   	push   %eax
+    3e65:	53                   	push   %ebx
+    3e66:	68 e3 64 00 00       	push   $0x64e3
+    3e6b:	ff 35 48 7c 00 00    	push   0x7c48
+    3e71:	e8 4a 12 00 00       	call   50c0 <printf>
+      kill(ppid, SIGKILL);
+    3e76:	59                   	pop    %ecx
+    3e77:	5b                   	pop    %ebx
+    3e78:	6a 09                	push   $0x9
+    3e7a:	56                   	push   %esi
+    3e7b:	e8 76 08 00 00       	call   46f6 <kill>
+      exit();
+    3e80:	e8 2b 08 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3e85:	50                   	push   %eax
+    3e86:	53                   	push   %ebx
+    3e87:	68 88 6e 00 00       	push   $0x6e88
+    3e8c:	ff 35 48 7c 00 00    	push   0x7c48
+    3e92:	e8 29 12 00 00       	call   50c0 <printf>
+    exit();
+    3e97:	e8 14 08 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3e9c:	50                   	push   %eax
+    3e9d:	50                   	push   %eax
+    3e9e:	68 b8 6d 00 00       	push   $0x6db8
+    3ea3:	ff 35 48 7c 00 00    	push   0x7c48
+    3ea9:	e8 12 12 00 00       	call   50c0 <printf>
+    exit();
+    3eae:	e8 fd 07 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3eb3:	50                   	push   %eax
+    3eb4:	50                   	push   %eax
+    3eb5:	68 95 64 00 00       	push   $0x6495
+    3eba:	ff 35 48 7c 00 00    	push   0x7c48
+    3ec0:	e8 fb 11 00 00       	call   50c0 <printf>
+    exit();
+    3ec5:	e8 e6 07 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3eca:	56                   	push   %esi
+    3ecb:	56                   	push   %esi
+    3ecc:	68 58 6e 00 00       	push   $0x6e58
+    3ed1:	ff 35 48 7c 00 00    	push   0x7c48
+    3ed7:	e8 e4 11 00 00       	call   50c0 <printf>
+    exit();
+    3edc:	e8 cf 07 00 00       	call   46b0 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3ee1:	50                   	push   %eax
+    3ee2:	50                   	push   %eax
+    3ee3:	68 fc 64 00 00       	push   $0x64fc
+    3ee8:	ff 35 48 7c 00 00    	push   0x7c48
+    3eee:	e8 cd 11 00 00       	call   50c0 <printf>
+    exit();
+    3ef3:	e8 b8 07 00 00       	call   46b0 <exit>
+    printf(1, "pipe() failed\n");
+    3ef8:	52                   	push   %edx
+    3ef9:	52                   	push   %edx
+    3efa:	68 fa 55 00 00       	push   $0x55fa
+    3eff:	6a 01                	push   $0x1
+    3f01:	e8 ba 11 00 00       	call   50c0 <printf>
+    exit();
+    3f06:	e8 a5 07 00 00       	call   46b0 <exit>
+    exit();
+    3f0b:	e8 a0 07 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3f10:	50                   	push   %eax
+    3f11:	50                   	push   %eax
+    3f12:	68 ac 64 00 00       	push   $0x64ac
+    3f17:	ff 35 48 7c 00 00    	push   0x7c48
+    3f1d:	e8 9e 11 00 00       	call   50c0 <printf>
+    exit();
+    3f22:	e8 89 07 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3f27:	56                   	push   %esi
+    3f28:	53                   	push   %ebx
+    3f29:	68 30 6e 00 00       	push   $0x6e30
+    3f2e:	ff 35 48 7c 00 00    	push   0x7c48
+    3f34:	e8 87 11 00 00       	call   50c0 <printf>
+    exit();
+    3f39:	e8 72 07 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3f3e:	50                   	push   %eax
+    3f3f:	53                   	push   %ebx
+    3f40:	68 f8 6d 00 00       	push   $0x6df8
+    3f45:	ff 35 48 7c 00 00    	push   0x7c48
+    3f4b:	e8 70 11 00 00       	call   50c0 <printf>
+    exit();
+    3f50:	e8 5b 07 00 00       	call   46b0 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3f55:	57                   	push   %edi
+    3f56:	57                   	push   %edi
+    3f57:	68 c8 64 00 00       	push   $0x64c8
+    3f5c:	ff 35 48 7c 00 00    	push   0x7c48
+    3f62:	e8 59 11 00 00       	call   50c0 <printf>
+    exit();
+    3f67:	e8 44 07 00 00       	call   46b0 <exit>
+    3f6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003f70 <validateint>:
+}
+    3f70:	c3                   	ret
+    3f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f7f:	90                   	nop
+
+00003f80 <validatetest>:
+{
+    3f80:	55                   	push   %ebp
+    3f81:	89 e5                	mov    %esp,%ebp
+    3f83:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3f84:	31 f6                	xor    %esi,%esi
+{
+    3f86:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3f87:	83 ec 08             	sub    $0x8,%esp
+    3f8a:	68 25 65 00 00       	push   $0x6525
+    3f8f:	ff 35 48 7c 00 00    	push   0x7c48
+    3f95:	e8 26 11 00 00       	call   50c0 <printf>
+    3f9a:	83 c4 10             	add    $0x10,%esp
+    3f9d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3fa0:	e8 21 07 00 00       	call   46c6 <fork>
+    3fa5:	89 c3                	mov    %eax,%ebx
+    3fa7:	85 c0                	test   %eax,%eax
+    3fa9:	74 65                	je     4010 <validatetest+0x90>
+    sleep(0);
+    3fab:	83 ec 0c             	sub    $0xc,%esp
+    3fae:	6a 00                	push   $0x0
+    3fb0:	e8 a1 07 00 00       	call   4756 <sleep>
+    sleep(0);
+    3fb5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3fbc:	e8 95 07 00 00       	call   4756 <sleep>
+    kill(pid, SIGKILL);
+    3fc1:	58                   	pop    %eax
+    3fc2:	5a                   	pop    %edx
+    3fc3:	6a 09                	push   $0x9
+    3fc5:	53                   	push   %ebx
+    3fc6:	e8 2b 07 00 00       	call   46f6 <kill>
+    wait();
+    3fcb:	e8 fe 06 00 00       	call   46ce <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3fd0:	59                   	pop    %ecx
+    3fd1:	5b                   	pop    %ebx
+    3fd2:	56                   	push   %esi
+    3fd3:	68 34 65 00 00       	push   $0x6534
+    3fd8:	e8 49 07 00 00       	call   4726 <link>
+    3fdd:	83 c4 10             	add    $0x10,%esp
+    3fe0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3fe3:	75 30                	jne    4015 <validatetest+0x95>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3fe5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3feb:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3ff1:	75 ad                	jne    3fa0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3ff3:	83 ec 08             	sub    $0x8,%esp
+    3ff6:	68 58 65 00 00       	push   $0x6558
+    3ffb:	ff 35 48 7c 00 00    	push   0x7c48
+    4001:	e8 ba 10 00 00       	call   50c0 <printf>
+}
+    4006:	83 c4 10             	add    $0x10,%esp
+    4009:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    400c:	5b                   	pop    %ebx
+    400d:	5e                   	pop    %esi
+    400e:	5d                   	pop    %ebp
+    400f:	c3                   	ret
+      exit();
+    4010:	e8 9b 06 00 00       	call   46b0 <exit>
+      printf(stdout, "link should not succeed\n");
+    4015:	83 ec 08             	sub    $0x8,%esp
+    4018:	68 3f 65 00 00       	push   $0x653f
+    401d:	ff 35 48 7c 00 00    	push   0x7c48
+    4023:	e8 98 10 00 00       	call   50c0 <printf>
+      exit();
+    4028:	e8 83 06 00 00       	call   46b0 <exit>
+    402d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004030 <bsstest>:
+{
+    4030:	55                   	push   %ebp
+    4031:	89 e5                	mov    %esp,%ebp
+    4033:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4036:	68 65 65 00 00       	push   $0x6565
+    403b:	ff 35 48 7c 00 00    	push   0x7c48
+    4041:	e8 7a 10 00 00       	call   50c0 <printf>
+    4046:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4049:	31 c0                	xor    %eax,%eax
+    404b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    404f:	90                   	nop
+    if(uninit[i] != '\0'){
+    4050:	80 b8 60 7c 00 00 00 	cmpb   $0x0,0x7c60(%eax)
+    4057:	75 22                	jne    407b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4059:	83 c0 01             	add    $0x1,%eax
+    405c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4061:	75 ed                	jne    4050 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4063:	83 ec 08             	sub    $0x8,%esp
+    4066:	68 80 65 00 00       	push   $0x6580
+    406b:	ff 35 48 7c 00 00    	push   0x7c48
+    4071:	e8 4a 10 00 00       	call   50c0 <printf>
+}
+    4076:	83 c4 10             	add    $0x10,%esp
+    4079:	c9                   	leave
+    407a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    407b:	83 ec 08             	sub    $0x8,%esp
+    407e:	68 6f 65 00 00       	push   $0x656f
+    4083:	ff 35 48 7c 00 00    	push   0x7c48
+    4089:	e8 32 10 00 00       	call   50c0 <printf>
+      exit();
+    408e:	e8 1d 06 00 00       	call   46b0 <exit>
+    4093:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    409a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000040a0 <bigargtest>:
+{
+    40a0:	55                   	push   %ebp
+    40a1:	89 e5                	mov    %esp,%ebp
+    40a3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    40a6:	68 8d 65 00 00       	push   $0x658d
+    40ab:	e8 66 06 00 00       	call   4716 <unlink>
+  pid = fork();
+    40b0:	e8 11 06 00 00       	call   46c6 <fork>
+  if(pid == 0){
+    40b5:	83 c4 10             	add    $0x10,%esp
+    40b8:	85 c0                	test   %eax,%eax
+    40ba:	74 44                	je     4100 <bigargtest+0x60>
+  } else if(pid < 0){
+    40bc:	0f 88 c3 00 00 00    	js     4185 <bigargtest+0xe5>
+  wait();
+    40c2:	e8 07 06 00 00       	call   46ce <wait>
+  fd = open("bigarg-ok", 0);
+    40c7:	83 ec 08             	sub    $0x8,%esp
+    40ca:	6a 00                	push   $0x0
+    40cc:	68 8d 65 00 00       	push   $0x658d
+    40d1:	e8 30 06 00 00       	call   4706 <open>
+  if(fd < 0){
+    40d6:	83 c4 10             	add    $0x10,%esp
+    40d9:	85 c0                	test   %eax,%eax
+    40db:	0f 88 8d 00 00 00    	js     416e <bigargtest+0xce>
+  close(fd);
+    40e1:	83 ec 0c             	sub    $0xc,%esp
+    40e4:	50                   	push   %eax
+    40e5:	e8 04 06 00 00       	call   46ee <close>
+  unlink("bigarg-ok");
+    40ea:	c7 04 24 8d 65 00 00 	movl   $0x658d,(%esp)
+    40f1:	e8 20 06 00 00       	call   4716 <unlink>
+}
+    40f6:	83 c4 10             	add    $0x10,%esp
+    40f9:	c9                   	leave
+    40fa:	c3                   	ret
+    40fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    40ff:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4100:	c7 04 85 80 c3 00 00 	movl   $0x6eac,0xc380(,%eax,4)
+    4107:	ac 6e 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    410b:	83 c0 01             	add    $0x1,%eax
+    410e:	83 f8 1f             	cmp    $0x1f,%eax
+    4111:	75 ed                	jne    4100 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4113:	31 c9                	xor    %ecx,%ecx
+    4115:	89 0d fc c3 00 00    	mov    %ecx,0xc3fc
+    printf(stdout, "bigarg test\n");
+    411b:	50                   	push   %eax
+    411c:	50                   	push   %eax
+    411d:	68 97 65 00 00       	push   $0x6597
+    4122:	ff 35 48 7c 00 00    	push   0x7c48
+    4128:	e8 93 0f 00 00       	call   50c0 <printf>
+    exec("echo", args);
+    412d:	58                   	pop    %eax
+    412e:	5a                   	pop    %edx
+    412f:	68 80 c3 00 00       	push   $0xc380
+    4134:	68 9f 53 00 00       	push   $0x539f
+    4139:	e8 c0 05 00 00       	call   46fe <exec>
+    printf(stdout, "bigarg test ok\n");
+    413e:	59                   	pop    %ecx
+    413f:	58                   	pop    %eax
+    4140:	68 a4 65 00 00       	push   $0x65a4
+    4145:	ff 35 48 7c 00 00    	push   0x7c48
+    414b:	e8 70 0f 00 00       	call   50c0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4150:	58                   	pop    %eax
+    4151:	5a                   	pop    %edx
+    4152:	68 00 02 00 00       	push   $0x200
+    4157:	68 8d 65 00 00       	push   $0x658d
+    415c:	e8 a5 05 00 00       	call   4706 <open>
+    close(fd);
+    4161:	89 04 24             	mov    %eax,(%esp)
+    4164:	e8 85 05 00 00       	call   46ee <close>
+    exit();
+    4169:	e8 42 05 00 00       	call   46b0 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    416e:	50                   	push   %eax
+    416f:	50                   	push   %eax
+    4170:	68 cd 65 00 00       	push   $0x65cd
+    4175:	ff 35 48 7c 00 00    	push   0x7c48
+    417b:	e8 40 0f 00 00       	call   50c0 <printf>
+    exit();
+    4180:	e8 2b 05 00 00       	call   46b0 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4185:	52                   	push   %edx
+    4186:	52                   	push   %edx
+    4187:	68 b4 65 00 00       	push   $0x65b4
+    418c:	ff 35 48 7c 00 00    	push   0x7c48
+    4192:	e8 29 0f 00 00       	call   50c0 <printf>
+    exit();
+    4197:	e8 14 05 00 00       	call   46b0 <exit>
+    419c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000041a0 <fsfull>:
+{
+    41a0:	55                   	push   %ebp
+    41a1:	89 e5                	mov    %esp,%ebp
+    41a3:	57                   	push   %edi
+    41a4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    41a5:	31 f6                	xor    %esi,%esi
+{
+    41a7:	53                   	push   %ebx
+    41a8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    41ab:	68 e2 65 00 00       	push   $0x65e2
+    41b0:	6a 01                	push   $0x1
+    41b2:	e8 09 0f 00 00       	call   50c0 <printf>
+    41b7:	83 c4 10             	add    $0x10,%esp
+    41ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    41c0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    41c5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    41ca:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    41cd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    41d1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    41d3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    41d7:	c1 ea 06             	shr    $0x6,%edx
+    41da:	8d 42 30             	lea    0x30(%edx),%eax
+    41dd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    41e0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    41e6:	89 f2                	mov    %esi,%edx
+    41e8:	29 c2                	sub    %eax,%edx
+    41ea:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    41ef:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    41f1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    41f6:	c1 ea 05             	shr    $0x5,%edx
+    41f9:	83 c2 30             	add    $0x30,%edx
+    41fc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    41ff:	f7 e6                	mul    %esi
+    4201:	c1 ea 05             	shr    $0x5,%edx
+    4204:	6b c2 64             	imul   $0x64,%edx,%eax
+    4207:	89 f2                	mov    %esi,%edx
+    4209:	29 c2                	sub    %eax,%edx
+    420b:	89 d0                	mov    %edx,%eax
+    420d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    420f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4211:	c1 ea 03             	shr    $0x3,%edx
+    4214:	83 c2 30             	add    $0x30,%edx
+    4217:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    421a:	f7 e1                	mul    %ecx
+    421c:	89 f0                	mov    %esi,%eax
+    421e:	c1 ea 03             	shr    $0x3,%edx
+    4221:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4224:	01 d2                	add    %edx,%edx
+    4226:	29 d0                	sub    %edx,%eax
+    4228:	83 c0 30             	add    $0x30,%eax
+    422b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    422e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4231:	50                   	push   %eax
+    4232:	68 ef 65 00 00       	push   $0x65ef
+    4237:	6a 01                	push   $0x1
+    4239:	e8 82 0e 00 00       	call   50c0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    423e:	58                   	pop    %eax
+    423f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4242:	5a                   	pop    %edx
+    4243:	68 02 02 00 00       	push   $0x202
+    4248:	50                   	push   %eax
+    4249:	e8 b8 04 00 00       	call   4706 <open>
+    if(fd < 0){
+    424e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4251:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4253:	85 c0                	test   %eax,%eax
+    4255:	78 4f                	js     42a6 <fsfull+0x106>
+    int total = 0;
+    4257:	31 db                	xor    %ebx,%ebx
+    4259:	eb 07                	jmp    4262 <fsfull+0xc2>
+    425b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    425f:	90                   	nop
+      total += cc;
+    4260:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4262:	83 ec 04             	sub    $0x4,%esp
+    4265:	68 00 02 00 00       	push   $0x200
+    426a:	68 80 a3 00 00       	push   $0xa380
+    426f:	57                   	push   %edi
+    4270:	e8 71 04 00 00       	call   46e6 <write>
+      if(cc < 512)
+    4275:	83 c4 10             	add    $0x10,%esp
+    4278:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    427d:	7f e1                	jg     4260 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    427f:	83 ec 04             	sub    $0x4,%esp
+    4282:	53                   	push   %ebx
+    4283:	68 d0 56 00 00       	push   $0x56d0
+    4288:	6a 01                	push   $0x1
+    428a:	e8 31 0e 00 00       	call   50c0 <printf>
+    close(fd);
+    428f:	89 3c 24             	mov    %edi,(%esp)
+    4292:	e8 57 04 00 00       	call   46ee <close>
+    if(total == 0)
+    4297:	83 c4 10             	add    $0x10,%esp
+    429a:	85 db                	test   %ebx,%ebx
+    429c:	74 1e                	je     42bc <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    429e:	83 c6 01             	add    $0x1,%esi
+    42a1:	e9 1a ff ff ff       	jmp    41c0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    42a6:	83 ec 04             	sub    $0x4,%esp
+    42a9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    42ac:	50                   	push   %eax
+    42ad:	68 91 5d 00 00       	push   $0x5d91
+    42b2:	6a 01                	push   $0x1
+    42b4:	e8 07 0e 00 00       	call   50c0 <printf>
+      break;
+    42b9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    42bc:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    42c1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    42c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42cd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    42d0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    42d2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    42d5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    42d9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    42db:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    42df:	c1 ea 06             	shr    $0x6,%edx
+    42e2:	8d 42 30             	lea    0x30(%edx),%eax
+    42e5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    42e8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    42ee:	89 f2                	mov    %esi,%edx
+    42f0:	29 c2                	sub    %eax,%edx
+    42f2:	89 d0                	mov    %edx,%eax
+    42f4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    42f6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    42f8:	c1 ea 05             	shr    $0x5,%edx
+    42fb:	83 c2 30             	add    $0x30,%edx
+    42fe:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4301:	f7 e3                	mul    %ebx
+    4303:	c1 ea 05             	shr    $0x5,%edx
+    4306:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4309:	89 f2                	mov    %esi,%edx
+    430b:	29 ca                	sub    %ecx,%edx
+    430d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4312:	89 d0                	mov    %edx,%eax
+    4314:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4316:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4318:	c1 ea 03             	shr    $0x3,%edx
+    431b:	83 c2 30             	add    $0x30,%edx
+    431e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4321:	f7 e1                	mul    %ecx
+    4323:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4325:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4328:	c1 ea 03             	shr    $0x3,%edx
+    432b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    432e:	01 d2                	add    %edx,%edx
+    4330:	29 d0                	sub    %edx,%eax
+    4332:	83 c0 30             	add    $0x30,%eax
+    4335:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4338:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    433b:	50                   	push   %eax
+    433c:	e8 d5 03 00 00       	call   4716 <unlink>
+  while(nfiles >= 0){
+    4341:	83 c4 10             	add    $0x10,%esp
+    4344:	83 fe ff             	cmp    $0xffffffff,%esi
+    4347:	75 87                	jne    42d0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4349:	83 ec 08             	sub    $0x8,%esp
+    434c:	68 fb 65 00 00       	push   $0x65fb
+    4351:	6a 01                	push   $0x1
+    4353:	e8 68 0d 00 00       	call   50c0 <printf>
+}
+    4358:	83 c4 10             	add    $0x10,%esp
+    435b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    435e:	5b                   	pop    %ebx
+    435f:	5e                   	pop    %esi
+    4360:	5f                   	pop    %edi
+    4361:	5d                   	pop    %ebp
+    4362:	c3                   	ret
+    4363:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    436a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004370 <uio>:
+{
+    4370:	55                   	push   %ebp
+    4371:	89 e5                	mov    %esp,%ebp
+    4373:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4376:	68 11 66 00 00       	push   $0x6611
+    437b:	6a 01                	push   $0x1
+    437d:	e8 3e 0d 00 00       	call   50c0 <printf>
+  pid = fork();
+    4382:	e8 3f 03 00 00       	call   46c6 <fork>
+  if(pid == 0){
+    4387:	83 c4 10             	add    $0x10,%esp
+    438a:	85 c0                	test   %eax,%eax
+    438c:	74 1b                	je     43a9 <uio+0x39>
+  } else if(pid < 0){
+    438e:	78 3d                	js     43cd <uio+0x5d>
+  wait();
+    4390:	e8 39 03 00 00       	call   46ce <wait>
+  printf(1, "uio test done\n");
+    4395:	83 ec 08             	sub    $0x8,%esp
+    4398:	68 1b 66 00 00       	push   $0x661b
+    439d:	6a 01                	push   $0x1
+    439f:	e8 1c 0d 00 00       	call   50c0 <printf>
+}
+    43a4:	83 c4 10             	add    $0x10,%esp
+    43a7:	c9                   	leave
+    43a8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    43a9:	b8 09 00 00 00       	mov    $0x9,%eax
+    43ae:	ba 70 00 00 00       	mov    $0x70,%edx
+    43b3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    43b4:	ba 71 00 00 00       	mov    $0x71,%edx
+    43b9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    43ba:	52                   	push   %edx
+    43bb:	52                   	push   %edx
+    43bc:	68 8c 6f 00 00       	push   $0x6f8c
+    43c1:	6a 01                	push   $0x1
+    43c3:	e8 f8 0c 00 00       	call   50c0 <printf>
+    exit();
+    43c8:	e8 e3 02 00 00       	call   46b0 <exit>
+    printf (1, "fork failed\n");
+    43cd:	50                   	push   %eax
+    43ce:	50                   	push   %eax
+    43cf:	68 c0 65 00 00       	push   $0x65c0
+    43d4:	6a 01                	push   $0x1
+    43d6:	e8 e5 0c 00 00       	call   50c0 <printf>
+    exit();
+    43db:	e8 d0 02 00 00       	call   46b0 <exit>
+
+000043e0 <argptest>:
+{
+    43e0:	55                   	push   %ebp
+    43e1:	89 e5                	mov    %esp,%ebp
+    43e3:	53                   	push   %ebx
+    43e4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    43e7:	6a 00                	push   $0x0
+    43e9:	68 2a 66 00 00       	push   $0x662a
+    43ee:	e8 13 03 00 00       	call   4706 <open>
+  if (fd < 0) {
+    43f3:	83 c4 10             	add    $0x10,%esp
+    43f6:	85 c0                	test   %eax,%eax
+    43f8:	78 39                	js     4433 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    43fa:	83 ec 0c             	sub    $0xc,%esp
+    43fd:	89 c3                	mov    %eax,%ebx
+    43ff:	6a 00                	push   $0x0
+    4401:	e8 48 03 00 00       	call   474e <sbrk>
+    4406:	83 c4 0c             	add    $0xc,%esp
+    4409:	83 e8 01             	sub    $0x1,%eax
+    440c:	6a ff                	push   $0xffffffff
+    440e:	50                   	push   %eax
+    440f:	53                   	push   %ebx
+    4410:	e8 c9 02 00 00       	call   46de <read>
+  close(fd);
+    4415:	89 1c 24             	mov    %ebx,(%esp)
+    4418:	e8 d1 02 00 00       	call   46ee <close>
+  printf(1, "arg test passed\n");
+    441d:	58                   	pop    %eax
+    441e:	5a                   	pop    %edx
+    441f:	68 2f 66 00 00       	push   $0x662f
+    4424:	6a 01                	push   $0x1
+    4426:	e8 95 0c 00 00       	call   50c0 <printf>
+}
+    442b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    442e:	83 c4 10             	add    $0x10,%esp
+    4431:	c9                   	leave
+    4432:	c3                   	ret
+    printf(2, "open failed\n");
+    4433:	51                   	push   %ecx
+    4434:	51                   	push   %ecx
+    4435:	68 72 56 00 00       	push   $0x5672
+    443a:	6a 02                	push   $0x2
+    443c:	e8 7f 0c 00 00       	call   50c0 <printf>
+    exit();
+    4441:	e8 6a 02 00 00       	call   46b0 <exit>
+    4446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    444d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004450 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4450:	69 05 44 7c 00 00 0d 	imul   $0x19660d,0x7c44,%eax
+    4457:	66 19 00 
+    445a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    445f:	a3 44 7c 00 00       	mov    %eax,0x7c44
+}
+    4464:	c3                   	ret
+    4465:	66 90                	xchg   %ax,%ax
+    4467:	66 90                	xchg   %ax,%ax
+    4469:	66 90                	xchg   %ax,%ax
+    446b:	66 90                	xchg   %ax,%ax
+    446d:	66 90                	xchg   %ax,%ax
+    446f:	90                   	nop
+
+00004470 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4470:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4471:	31 c0                	xor    %eax,%eax
+{
+    4473:	89 e5                	mov    %esp,%ebp
+    4475:	53                   	push   %ebx
+    4476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4479:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    447c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4480:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4484:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4487:	83 c0 01             	add    $0x1,%eax
+    448a:	84 d2                	test   %dl,%dl
+    448c:	75 f2                	jne    4480 <strcpy+0x10>
+    ;
+  return os;
+}
+    448e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4491:	89 c8                	mov    %ecx,%eax
+    4493:	c9                   	leave
+    4494:	c3                   	ret
+    4495:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    449c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000044a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    44a0:	55                   	push   %ebp
+    44a1:	89 e5                	mov    %esp,%ebp
+    44a3:	53                   	push   %ebx
+    44a4:	8b 55 08             	mov    0x8(%ebp),%edx
+    44a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    44aa:	0f b6 02             	movzbl (%edx),%eax
+    44ad:	84 c0                	test   %al,%al
+    44af:	75 17                	jne    44c8 <strcmp+0x28>
+    44b1:	eb 3a                	jmp    44ed <strcmp+0x4d>
+    44b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    44b7:	90                   	nop
+    44b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    44bc:	83 c2 01             	add    $0x1,%edx
+    44bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    44c2:	84 c0                	test   %al,%al
+    44c4:	74 1a                	je     44e0 <strcmp+0x40>
+    p++, q++;
+    44c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    44c8:	0f b6 19             	movzbl (%ecx),%ebx
+    44cb:	38 c3                	cmp    %al,%bl
+    44cd:	74 e9                	je     44b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    44cf:	29 d8                	sub    %ebx,%eax
+}
+    44d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    44d4:	c9                   	leave
+    44d5:	c3                   	ret
+    44d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    44e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    44e4:	31 c0                	xor    %eax,%eax
+    44e6:	29 d8                	sub    %ebx,%eax
+}
+    44e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    44eb:	c9                   	leave
+    44ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    44ed:	0f b6 19             	movzbl (%ecx),%ebx
+    44f0:	31 c0                	xor    %eax,%eax
+    44f2:	eb db                	jmp    44cf <strcmp+0x2f>
+    44f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    44ff:	90                   	nop
+
+00004500 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4500:	55                   	push   %ebp
+    4501:	89 e5                	mov    %esp,%ebp
+    4503:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4506:	80 3a 00             	cmpb   $0x0,(%edx)
+    4509:	74 15                	je     4520 <strlen+0x20>
+    450b:	31 c0                	xor    %eax,%eax
+    450d:	8d 76 00             	lea    0x0(%esi),%esi
+    4510:	83 c0 01             	add    $0x1,%eax
+    4513:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4517:	89 c1                	mov    %eax,%ecx
+    4519:	75 f5                	jne    4510 <strlen+0x10>
+    ;
+  return n;
+}
+    451b:	89 c8                	mov    %ecx,%eax
+    451d:	5d                   	pop    %ebp
+    451e:	c3                   	ret
+    451f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4520:	31 c9                	xor    %ecx,%ecx
+}
+    4522:	5d                   	pop    %ebp
+    4523:	89 c8                	mov    %ecx,%eax
+    4525:	c3                   	ret
+    4526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    452d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004530 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4530:	55                   	push   %ebp
+    4531:	89 e5                	mov    %esp,%ebp
+    4533:	57                   	push   %edi
+    4534:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4537:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    453a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    453d:	89 d7                	mov    %edx,%edi
+    453f:	fc                   	cld
+    4540:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4542:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4545:	89 d0                	mov    %edx,%eax
+    4547:	c9                   	leave
+    4548:	c3                   	ret
+    4549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004550 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4550:	55                   	push   %ebp
+    4551:	89 e5                	mov    %esp,%ebp
+    4553:	8b 45 08             	mov    0x8(%ebp),%eax
+    4556:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    455a:	0f b6 10             	movzbl (%eax),%edx
+    455d:	84 d2                	test   %dl,%dl
+    455f:	75 12                	jne    4573 <strchr+0x23>
+    4561:	eb 1d                	jmp    4580 <strchr+0x30>
+    4563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4567:	90                   	nop
+    4568:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    456c:	83 c0 01             	add    $0x1,%eax
+    456f:	84 d2                	test   %dl,%dl
+    4571:	74 0d                	je     4580 <strchr+0x30>
+    if(*s == c)
+    4573:	38 d1                	cmp    %dl,%cl
+    4575:	75 f1                	jne    4568 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4577:	5d                   	pop    %ebp
+    4578:	c3                   	ret
+    4579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4580:	31 c0                	xor    %eax,%eax
+}
+    4582:	5d                   	pop    %ebp
+    4583:	c3                   	ret
+    4584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    458b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    458f:	90                   	nop
+
+00004590 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4590:	55                   	push   %ebp
+    4591:	89 e5                	mov    %esp,%ebp
+    4593:	57                   	push   %edi
+    4594:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4595:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4598:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4599:	31 db                	xor    %ebx,%ebx
+{
+    459b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    459e:	eb 27                	jmp    45c7 <gets+0x37>
+    cc = read(0, &c, 1);
+    45a0:	83 ec 04             	sub    $0x4,%esp
+    45a3:	6a 01                	push   $0x1
+    45a5:	56                   	push   %esi
+    45a6:	6a 00                	push   $0x0
+    45a8:	e8 31 01 00 00       	call   46de <read>
+    if(cc < 1)
+    45ad:	83 c4 10             	add    $0x10,%esp
+    45b0:	85 c0                	test   %eax,%eax
+    45b2:	7e 1d                	jle    45d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    45b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    45b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    45bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    45bf:	3c 0a                	cmp    $0xa,%al
+    45c1:	74 10                	je     45d3 <gets+0x43>
+    45c3:	3c 0d                	cmp    $0xd,%al
+    45c5:	74 0c                	je     45d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    45c7:	89 df                	mov    %ebx,%edi
+    45c9:	83 c3 01             	add    $0x1,%ebx
+    45cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    45cf:	7c cf                	jl     45a0 <gets+0x10>
+    45d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    45d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    45d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    45da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    45dd:	5b                   	pop    %ebx
+    45de:	5e                   	pop    %esi
+    45df:	5f                   	pop    %edi
+    45e0:	5d                   	pop    %ebp
+    45e1:	c3                   	ret
+    45e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000045f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    45f0:	55                   	push   %ebp
+    45f1:	89 e5                	mov    %esp,%ebp
+    45f3:	56                   	push   %esi
+    45f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    45f5:	83 ec 08             	sub    $0x8,%esp
+    45f8:	6a 00                	push   $0x0
+    45fa:	ff 75 08             	push   0x8(%ebp)
+    45fd:	e8 04 01 00 00       	call   4706 <open>
+  if(fd < 0)
+    4602:	83 c4 10             	add    $0x10,%esp
+    4605:	85 c0                	test   %eax,%eax
+    4607:	78 27                	js     4630 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    4609:	83 ec 08             	sub    $0x8,%esp
+    460c:	ff 75 0c             	push   0xc(%ebp)
+    460f:	89 c3                	mov    %eax,%ebx
+    4611:	50                   	push   %eax
+    4612:	e8 07 01 00 00       	call   471e <fstat>
+  close(fd);
+    4617:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    461a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    461c:	e8 cd 00 00 00       	call   46ee <close>
+  return r;
+    4621:	83 c4 10             	add    $0x10,%esp
+}
+    4624:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4627:	89 f0                	mov    %esi,%eax
+    4629:	5b                   	pop    %ebx
+    462a:	5e                   	pop    %esi
+    462b:	5d                   	pop    %ebp
+    462c:	c3                   	ret
+    462d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    4630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    4635:	eb ed                	jmp    4624 <stat+0x34>
+    4637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    463e:	66 90                	xchg   %ax,%ax
+
+00004640 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4640:	55                   	push   %ebp
+    4641:	89 e5                	mov    %esp,%ebp
+    4643:	53                   	push   %ebx
+    4644:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    4647:	0f be 02             	movsbl (%edx),%eax
+    464a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    464d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4655:	77 1e                	ja     4675 <atoi+0x35>
+    4657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    465e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4660:	83 c2 01             	add    $0x1,%edx
+    4663:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4666:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    466a:	0f be 02             	movsbl (%edx),%eax
+    466d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4670:	80 fb 09             	cmp    $0x9,%bl
+    4673:	76 eb                	jbe    4660 <atoi+0x20>
+  return n;
+}
+    4675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4678:	89 c8                	mov    %ecx,%eax
+    467a:	c9                   	leave
+    467b:	c3                   	ret
+    467c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004680 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4680:	55                   	push   %ebp
+    4681:	89 e5                	mov    %esp,%ebp
+    4683:	57                   	push   %edi
+    4684:	56                   	push   %esi
+    4685:	8b 45 10             	mov    0x10(%ebp),%eax
+    4688:	8b 55 08             	mov    0x8(%ebp),%edx
+    468b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    468e:	85 c0                	test   %eax,%eax
+    4690:	7e 13                	jle    46a5 <memmove+0x25>
+    4692:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4694:	89 d7                	mov    %edx,%edi
+    4696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    469d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    46a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    46a1:	39 f8                	cmp    %edi,%eax
+    46a3:	75 fb                	jne    46a0 <memmove+0x20>
+  return vdst;
+}
+    46a5:	5e                   	pop    %esi
+    46a6:	89 d0                	mov    %edx,%eax
+    46a8:	5f                   	pop    %edi
+    46a9:	5d                   	pop    %ebp
+    46aa:	c3                   	ret
+    46ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    46af:	90                   	nop
+
+000046b0 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+    46b0:	55                   	push   %ebp
+    46b1:	89 e5                	mov    %esp,%ebp
+    46b3:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+    46b6:	a1 00 c4 00 00       	mov    0xc400,%eax
+    46bb:	85 c0                	test   %eax,%eax
+    46bd:	74 02                	je     46c1 <exit+0x11>
+    exithook();
+    46bf:	ff d0                	call   *%eax
+  _exit();
+    46c1:	e8 10 01 00 00       	call   47d6 <_exit>
+
+000046c6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    46c6:	b8 01 00 00 00       	mov    $0x1,%eax
+    46cb:	cd 40                	int    $0x40
+    46cd:	c3                   	ret
+
+000046ce <wait>:
+SYSCALL(wait)
+    46ce:	b8 03 00 00 00       	mov    $0x3,%eax
+    46d3:	cd 40                	int    $0x40
+    46d5:	c3                   	ret
+
+000046d6 <pipe>:
+SYSCALL(pipe)
+    46d6:	b8 04 00 00 00       	mov    $0x4,%eax
+    46db:	cd 40                	int    $0x40
+    46dd:	c3                   	ret
+
+000046de <read>:
+SYSCALL(read)
+    46de:	b8 05 00 00 00       	mov    $0x5,%eax
+    46e3:	cd 40                	int    $0x40
+    46e5:	c3                   	ret
+
+000046e6 <write>:
+SYSCALL(write)
+    46e6:	b8 10 00 00 00       	mov    $0x10,%eax
+    46eb:	cd 40                	int    $0x40
+    46ed:	c3                   	ret
+
+000046ee <close>:
+SYSCALL(close)
+    46ee:	b8 15 00 00 00       	mov    $0x15,%eax
+    46f3:	cd 40                	int    $0x40
+    46f5:	c3                   	ret
+
+000046f6 <kill>:
+SYSCALL(kill)
+    46f6:	b8 06 00 00 00       	mov    $0x6,%eax
+    46fb:	cd 40                	int    $0x40
+    46fd:	c3                   	ret
+
+000046fe <exec>:
+SYSCALL(exec)
+    46fe:	b8 07 00 00 00       	mov    $0x7,%eax
+    4703:	cd 40                	int    $0x40
+    4705:	c3                   	ret
+
+00004706 <open>:
+SYSCALL(open)
+    4706:	b8 0f 00 00 00       	mov    $0xf,%eax
+    470b:	cd 40                	int    $0x40
+    470d:	c3                   	ret
+
+0000470e <mknod>:
+SYSCALL(mknod)
+    470e:	b8 11 00 00 00       	mov    $0x11,%eax
+    4713:	cd 40                	int    $0x40
+    4715:	c3                   	ret
+
+00004716 <unlink>:
+SYSCALL(unlink)
+    4716:	b8 12 00 00 00       	mov    $0x12,%eax
+    471b:	cd 40                	int    $0x40
+    471d:	c3                   	ret
+
+0000471e <fstat>:
+SYSCALL(fstat)
+    471e:	b8 08 00 00 00       	mov    $0x8,%eax
+    4723:	cd 40                	int    $0x40
+    4725:	c3                   	ret
+
+00004726 <link>:
+SYSCALL(link)
+    4726:	b8 13 00 00 00       	mov    $0x13,%eax
+    472b:	cd 40                	int    $0x40
+    472d:	c3                   	ret
+
+0000472e <mkdir>:
+SYSCALL(mkdir)
+    472e:	b8 14 00 00 00       	mov    $0x14,%eax
+    4733:	cd 40                	int    $0x40
+    4735:	c3                   	ret
+
+00004736 <chdir>:
+SYSCALL(chdir)
+    4736:	b8 09 00 00 00       	mov    $0x9,%eax
+    473b:	cd 40                	int    $0x40
+    473d:	c3                   	ret
+
+0000473e <dup>:
+SYSCALL(dup)
+    473e:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4743:	cd 40                	int    $0x40
+    4745:	c3                   	ret
+
+00004746 <getpid>:
+SYSCALL(getpid)
+    4746:	b8 0b 00 00 00       	mov    $0xb,%eax
+    474b:	cd 40                	int    $0x40
+    474d:	c3                   	ret
+
+0000474e <sbrk>:
+SYSCALL(sbrk)
+    474e:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4753:	cd 40                	int    $0x40
+    4755:	c3                   	ret
+
+00004756 <sleep>:
+SYSCALL(sleep)
+    4756:	b8 0d 00 00 00       	mov    $0xd,%eax
+    475b:	cd 40                	int    $0x40
+    475d:	c3                   	ret
+
+0000475e <uptime>:
+SYSCALL(uptime)
+    475e:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4763:	cd 40                	int    $0x40
+    4765:	c3                   	ret
+
+00004766 <sigprocmask>:
+SYSCALL(sigprocmask)
+    4766:	b8 16 00 00 00       	mov    $0x16,%eax
+    476b:	cd 40                	int    $0x40
+    476d:	c3                   	ret
+
+0000476e <sigaction>:
+SYSCALL(sigaction)
+    476e:	b8 17 00 00 00       	mov    $0x17,%eax
+    4773:	cd 40                	int    $0x40
+    4775:	c3                   	ret
+
+00004776 <sigret>:
+SYSCALL(sigret)
+    4776:	b8 18 00 00 00       	mov    $0x18,%eax
+    477b:	cd 40                	int    $0x40
+    477d:	c3                   	ret
+
+0000477e <readv>:
+SYSCALL(readv)
+    477e:	b8 19 00 00 00       	mov    $0x19,%eax
+    4783:	cd 40                	int    $0x40
+    4785:	c3                   	ret
+
+00004786 <writev>:
+SYSCALL(writev)
+    4786:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    478b:	cd 40                	int    $0x40
+    478d:	c3                   	ret
+
+0000478e <nanosleep>:
+SYSCALL(nanosleep)
+    478e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4793:	cd 40                	int    $0x40
+    4795:	c3                   	ret
+
+00004796 <setpriority>:
+SYSCALL(setpriority)
+    4796:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    479b:	cd 40                	int    $0x40
+    479d:	c3                   	ret
+
+0000479e <sched_setattr>:
+SYSCALL(sched_setattr)
+    479e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    47a3:	cd 40                	int    $0x40
+    47a5:	c3                   	ret
+
+000047a6 <sched_yield>:
+SYSCALL(sched_yield)
+    47a6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    47ab:	cd 40                	int    $0x40
+    47ad:	c3                   	ret
+
+000047ae <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    47ae:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    47b3:	cd 40                	int    $0x40
+    47b5:	c3                   	ret
+
+000047b6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    47b6:	b8 20 00 00 00       	mov    $0x20,%eax
+    47bb:	cd 40                	int    $0x40
+    47bd:	c3                   	ret
+
+000047be <getrusage>:
+SYSCALL(getrusage)
+    47be:	b8 21 00 00 00       	mov    $0x21,%eax
+    47c3:	cd 40                	int    $0x40
+    47c5:	c3                   	ret
+
+000047c6 <syslat>:
+SYSCALL(syslat)
+    47c6:	b8 22 00 00 00       	mov    $0x22,%eax
+    47cb:	cd 40                	int    $0x40
+    47cd:	c3                   	ret
+
+000047ce <sched_getattr>:
+SYSCALL(sched_getattr)
+    47ce:	b8 23 00 00 00       	mov    $0x23,%eax
+    47d3:	cd 40                	int    $0x40
+    47d5:	c3                   	ret
+
+000047d6 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+    47d6:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+    47db:	cd 40                	int    $0x40
+  ret
+    47dd:	c3                   	ret
+    47de:	66 90                	xchg   %ax,%ax
+
+000047e0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+    47e0:	55                   	push   %ebp
+    47e1:	89 e5                	mov    %esp,%ebp
+    47e3:	56                   	push   %esi
+    47e4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    47e5:	31 db                	xor    %ebx,%ebx
+    47e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47ee:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+    47f0:	8b 34 9d 20 c4 00 00 	mov    0xc420(,%ebx,4),%esi
+    47f7:	85 f6                	test   %esi,%esi
+    47f9:	74 27                	je     4822 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    47fb:	8b 46 08             	mov    0x8(%esi),%eax
+    47fe:	85 c0                	test   %eax,%eax
+    4800:	7e 12                	jle    4814 <flushall+0x34>
+    4802:	83 ec 04             	sub    $0x4,%esp
+    4805:	50                   	push   %eax
+    4806:	8d 46 10             	lea    0x10(%esi),%eax
+    4809:	50                   	push   %eax
+    480a:	ff 36                	push   (%esi)
+    480c:	e8 d5 fe ff ff       	call   46e6 <write>
+    4811:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+    4814:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    481b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+    4822:	83 c3 01             	add    $0x1,%ebx
+    4825:	83 fb 10             	cmp    $0x10,%ebx
+    4828:	75 c6                	jne    47f0 <flushall+0x10>
+}
+    482a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    482d:	5b                   	pop    %ebx
+    482e:	5e                   	pop    %esi
+    482f:	5d                   	pop    %ebp
+    4830:	c3                   	ret
+    4831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    483f:	90                   	nop
+
+00004840 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+    4840:	55                   	push   %ebp
+    4841:	89 e5                	mov    %esp,%ebp
+    4843:	57                   	push   %edi
+    4844:	56                   	push   %esi
+    4845:	53                   	push   %ebx
+    4846:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4848:	89 d1                	mov    %edx,%ecx
+{
+    484a:	83 ec 2c             	sub    $0x2c,%esp
+    484d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+    4850:	85 d2                	test   %edx,%edx
+    4852:	0f 89 c8 00 00 00    	jns    4920 <printint+0xe0>
+    4858:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    485c:	0f 84 be 00 00 00    	je     4920 <printint+0xe0>
+    x = -xx;
+    4862:	f7 d9                	neg    %ecx
+    neg = 1;
+    4864:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4869:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    486c:	31 f6                	xor    %esi,%esi
+    486e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+    4870:	89 c8                	mov    %ecx,%eax
+    4872:	31 d2                	xor    %edx,%edx
+    4874:	89 f7                	mov    %esi,%edi
+    4876:	f7 f3                	div    %ebx
+    4878:	8d 76 01             	lea    0x1(%esi),%esi
+    487b:	0f b6 92 3c 70 00 00 	movzbl 0x703c(%edx),%edx
+    4882:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4886:	89 ca                	mov    %ecx,%edx
+    4888:	89 c1                	mov    %eax,%ecx
+    488a:	39 da                	cmp    %ebx,%edx
+    488c:	73 e2                	jae    4870 <printint+0x30>
+  if(neg)
+    488e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    4891:	85 c0                	test   %eax,%eax
+    4893:	74 07                	je     489c <printint+0x5c>
+    buf[i++] = '-';
+    4895:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    489a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+    489c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    489f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    48a2:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    48a4:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+    48a7:	8b 41 08             	mov    0x8(%ecx),%eax
+    48aa:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    48ad:	89 ce                	mov    %ecx,%esi
+    48af:	eb 28                	jmp    48d9 <printint+0x99>
+    48b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+    48b8:	89 c1                	mov    %eax,%ecx
+    48ba:	83 c0 01             	add    $0x1,%eax
+    48bd:	89 46 08             	mov    %eax,0x8(%esi)
+    48c0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    48c4:	80 fa 0a             	cmp    $0xa,%dl
+    48c7:	75 07                	jne    48d0 <printint+0x90>
+    f->nl = 1;
+    48c9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+    48d0:	8d 57 ff             	lea    -0x1(%edi),%edx
+    48d3:	39 fb                	cmp    %edi,%ebx
+    48d5:	74 39                	je     4910 <printint+0xd0>
+    48d7:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+    48d9:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+    48dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+    48e1:	75 d5                	jne    48b8 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    48e3:	83 ec 04             	sub    $0x4,%esp
+    48e6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+    48e9:	68 00 02 00 00       	push   $0x200
+    48ee:	ff 75 d0             	push   -0x30(%ebp)
+    48f1:	ff 36                	push   (%esi)
+    48f3:	e8 ee fd ff ff       	call   46e6 <write>
+  return r;
+    48f8:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+    48fc:	83 c4 10             	add    $0x10,%esp
+    48ff:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    4901:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    4908:	b8 01 00 00 00       	mov    $0x1,%eax
+    490d:	eb ae                	jmp    48bd <printint+0x7d>
+    490f:	90                   	nop
+}
+    4910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4913:	5b                   	pop    %ebx
+    4914:	5e                   	pop    %esi
+    4915:	5f                   	pop    %edi
+    4916:	5d                   	pop    %ebp
+    4917:	c3                   	ret
+    4918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    491f:	90                   	nop
+  neg = 0;
+    4920:	31 c0                	xor    %eax,%eax
+    4922:	e9 42 ff ff ff       	jmp    4869 <printint+0x29>
+    4927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    492e:	66 90                	xchg   %ax,%ax
+
+00004930 <bputc>:
+{
+    4930:	55                   	push   %ebp
+    4931:	89 e5                	mov    %esp,%ebp
+    4933:	53                   	push   %ebx
+    4934:	89 c3                	mov    %eax,%ebx
+    4936:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+    4939:	8b 40 08             	mov    0x8(%eax),%eax
+    493c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4941:	74 1d                	je     4960 <bputc+0x30>
+  f->buf[f->n++] = c;
+    4943:	8d 48 01             	lea    0x1(%eax),%ecx
+    4946:	89 4b 08             	mov    %ecx,0x8(%ebx)
+    4949:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+    494d:	80 fa 0a             	cmp    $0xa,%dl
+    4950:	75 07                	jne    4959 <bputc+0x29>
+    f->nl = 1;
+    4952:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+    4959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    495c:	c9                   	leave
+    495d:	c3                   	ret
+    495e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4960:	83 ec 04             	sub    $0x4,%esp
+    4963:	8d 43 10             	lea    0x10(%ebx),%eax
+    4966:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4969:	68 00 02 00 00       	push   $0x200
+    496e:	50                   	push   %eax
+    496f:	ff 33                	push   (%ebx)
+    4971:	e8 70 fd ff ff       	call   46e6 <write>
+  return r;
+    4976:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    4979:	83 c4 10             	add    $0x10,%esp
+    497c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+    4981:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    4988:	31 c0                	xor    %eax,%eax
+    498a:	eb ba                	jmp    4946 <bputc+0x16>
+    498c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004990 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+    4990:	55                   	push   %ebp
+    4991:	89 e5                	mov    %esp,%ebp
+    4993:	57                   	push   %edi
+    4994:	56                   	push   %esi
+    4995:	53                   	push   %ebx
+    4996:	83 ec 1c             	sub    $0x1c,%esp
+    4999:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    499c:	0f b6 0a             	movzbl (%edx),%ecx
+    499f:	84 c9                	test   %cl,%cl
+    49a1:	74 47                	je     49ea <vfprintf+0x5a>
+    49a3:	8d 5a 01             	lea    0x1(%edx),%ebx
+    49a6:	89 c7                	mov    %eax,%edi
+    49a8:	31 d2                	xor    %edx,%edx
+    49aa:	89 de                	mov    %ebx,%esi
+    49ac:	89 cb                	mov    %ecx,%ebx
+    49ae:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    49b0:	0f be cb             	movsbl %bl,%ecx
+    49b3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    49b6:	85 d2                	test   %edx,%edx
+    49b8:	75 4e                	jne    4a08 <vfprintf+0x78>
+      if(c == '%'){
+    49ba:	83 f8 25             	cmp    $0x25,%eax
+    49bd:	74 69                	je     4a28 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+    49bf:	8b 47 08             	mov    0x8(%edi),%eax
+    49c2:	3d 00 02 00 00       	cmp    $0x200,%eax
+    49c7:	0f 84 73 01 00 00    	je     4b40 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+    49cd:	8d 48 01             	lea    0x1(%eax),%ecx
+    49d0:	89 4f 08             	mov    %ecx,0x8(%edi)
+    49d3:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+    49d7:	80 fb 0a             	cmp    $0xa,%bl
+    49da:	74 1c                	je     49f8 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+    49dc:	31 d2                	xor    %edx,%edx
+    49de:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+    49e0:	0f b6 1e             	movzbl (%esi),%ebx
+    49e3:	83 c6 01             	add    $0x1,%esi
+    49e6:	84 db                	test   %bl,%bl
+    49e8:	75 c6                	jne    49b0 <vfprintf+0x20>
+    }
+  }
+}
+    49ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    49ed:	5b                   	pop    %ebx
+    49ee:	5e                   	pop    %esi
+    49ef:	5f                   	pop    %edi
+    49f0:	5d                   	pop    %ebp
+    49f1:	c3                   	ret
+    49f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+    49f8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+    49ff:	eb df                	jmp    49e0 <vfprintf+0x50>
+    4a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+    4a08:	83 fa 25             	cmp    $0x25,%edx
+    4a0b:	75 d3                	jne    49e0 <vfprintf+0x50>
+      if(c == 'd'){
+    4a0d:	83 f8 25             	cmp    $0x25,%eax
+    4a10:	74 37                	je     4a49 <vfprintf+0xb9>
+    4a12:	83 e8 63             	sub    $0x63,%eax
+    4a15:	83 f8 15             	cmp    $0x15,%eax
+    4a18:	77 16                	ja     4a30 <vfprintf+0xa0>
+    4a1a:	ff 24 85 e4 6f 00 00 	jmp    *0x6fe4(,%eax,4)
+    4a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+    4a28:	ba 25 00 00 00       	mov    $0x25,%edx
+    4a2d:	eb b1                	jmp    49e0 <vfprintf+0x50>
+    4a2f:	90                   	nop
+  if(f->n == BUFSIZ)
+    4a30:	8b 47 08             	mov    0x8(%edi),%eax
+    4a33:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4a38:	0f 84 4c 01 00 00    	je     4b8a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+    4a3e:	8d 50 01             	lea    0x1(%eax),%edx
+    4a41:	89 57 08             	mov    %edx,0x8(%edi)
+    4a44:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+    4a49:	89 ca                	mov    %ecx,%edx
+    4a4b:	89 f8                	mov    %edi,%eax
+    4a4d:	e8 de fe ff ff       	call   4930 <bputc>
+    4a52:	eb 88                	jmp    49dc <vfprintf+0x4c>
+    4a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+    4a58:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    4a5b:	83 ec 0c             	sub    $0xc,%esp
+    4a5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    4a63:	8b 13                	mov    (%ebx),%edx
+    4a65:	6a 00                	push   $0x0
+    4a67:	89 f8                	mov    %edi,%eax
+        ap++;
+    4a69:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+    4a6c:	e8 cf fd ff ff       	call   4840 <printint>
+        ap++;
+    4a71:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    4a74:	83 c4 10             	add    $0x10,%esp
+    4a77:	e9 60 ff ff ff       	jmp    49dc <vfprintf+0x4c>
+    4a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+    4a80:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4a83:	8b 10                	mov    (%eax),%edx
+        ap++;
+    4a85:	83 c0 04             	add    $0x4,%eax
+    4a88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    4a8b:	85 d2                	test   %edx,%edx
+    4a8d:	0f 84 dd 00 00 00    	je     4b70 <vfprintf+0x1e0>
+        while(*s != 0){
+    4a93:	0f b6 1a             	movzbl (%edx),%ebx
+    4a96:	84 db                	test   %bl,%bl
+    4a98:	0f 84 3e ff ff ff    	je     49dc <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4a9e:	8d 4f 10             	lea    0x10(%edi),%ecx
+    4aa1:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+    4aa4:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4aa7:	89 fe                	mov    %edi,%esi
+    4aa9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    4aac:	89 d7                	mov    %edx,%edi
+    4aae:	eb 27                	jmp    4ad7 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+    4ab0:	89 c1                	mov    %eax,%ecx
+    4ab2:	83 c0 01             	add    $0x1,%eax
+    4ab5:	89 46 08             	mov    %eax,0x8(%esi)
+    4ab8:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    4abc:	80 fb 0a             	cmp    $0xa,%bl
+    4abf:	75 07                	jne    4ac8 <vfprintf+0x138>
+    f->nl = 1;
+    4ac1:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+    4ac8:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+    4acc:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+    4acf:	84 db                	test   %bl,%bl
+    4ad1:	0f 84 a9 00 00 00    	je     4b80 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+    4ad7:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4adc:	75 d2                	jne    4ab0 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4ade:	83 ec 04             	sub    $0x4,%esp
+    4ae1:	68 00 02 00 00       	push   $0x200
+    4ae6:	ff 75 e0             	push   -0x20(%ebp)
+    4ae9:	ff 36                	push   (%esi)
+    4aeb:	e8 f6 fb ff ff       	call   46e6 <write>
+  return r;
+    4af0:	83 c4 10             	add    $0x10,%esp
+    4af3:	b8 01 00 00 00       	mov    $0x1,%eax
+    4af8:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    4afa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    4b01:	eb b2                	jmp    4ab5 <vfprintf+0x125>
+    4b03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4b07:	90                   	nop
+        printint(f, *ap, 10, 1);
+    4b08:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    4b0b:	83 ec 0c             	sub    $0xc,%esp
+    4b0e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4b13:	8b 13                	mov    (%ebx),%edx
+    4b15:	6a 01                	push   $0x1
+    4b17:	e9 4b ff ff ff       	jmp    4a67 <vfprintf+0xd7>
+    4b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+    4b20:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    4b23:	89 f8                	mov    %edi,%eax
+    4b25:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+    4b28:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+    4b2b:	e8 00 fe ff ff       	call   4930 <bputc>
+        ap++;
+    4b30:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+    4b33:	31 d2                	xor    %edx,%edx
+    4b35:	e9 a6 fe ff ff       	jmp    49e0 <vfprintf+0x50>
+    4b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4b40:	83 ec 04             	sub    $0x4,%esp
+    4b43:	8d 47 10             	lea    0x10(%edi),%eax
+    4b46:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    4b49:	68 00 02 00 00       	push   $0x200
+    4b4e:	50                   	push   %eax
+    4b4f:	ff 37                	push   (%edi)
+    4b51:	e8 90 fb ff ff       	call   46e6 <write>
+  return r;
+    4b56:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    4b59:	83 c4 10             	add    $0x10,%esp
+    4b5c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+    4b5e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+    4b65:	b9 01 00 00 00       	mov    $0x1,%ecx
+    4b6a:	e9 61 fe ff ff       	jmp    49d0 <vfprintf+0x40>
+    4b6f:	90                   	nop
+          s = "(null)";
+    4b70:	ba da 6f 00 00       	mov    $0x6fda,%edx
+    4b75:	bb 28 00 00 00       	mov    $0x28,%ebx
+    4b7a:	e9 1f ff ff ff       	jmp    4a9e <vfprintf+0x10e>
+    4b7f:	90                   	nop
+    4b80:	89 f7                	mov    %esi,%edi
+    4b82:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    4b85:	e9 52 fe ff ff       	jmp    49dc <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4b8a:	83 ec 04             	sub    $0x4,%esp
+    4b8d:	8d 47 10             	lea    0x10(%edi),%eax
+    4b90:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    4b93:	68 00 02 00 00       	push   $0x200
+    4b98:	50                   	push   %eax
+    4b99:	ff 37                	push   (%edi)
+    4b9b:	e8 46 fb ff ff       	call   46e6 <write>
+  return r;
+    4ba0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    4ba3:	83 c4 10             	add    $0x10,%esp
+    4ba6:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+    4bab:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+    4bb2:	31 c0                	xor    %eax,%eax
+    4bb4:	e9 88 fe ff ff       	jmp    4a41 <vfprintf+0xb1>
+    4bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004bc0 <fdopen>:
+{
+    4bc0:	55                   	push   %ebp
+    4bc1:	89 e5                	mov    %esp,%ebp
+    4bc3:	56                   	push   %esi
+    4bc4:	53                   	push   %ebx
+    4bc5:	83 ec 20             	sub    $0x20,%esp
+    4bc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+    4bcb:	83 fe 0f             	cmp    $0xf,%esi
+    4bce:	0f 87 84 00 00 00    	ja     4c58 <fdopen+0x98>
+  if(streams[fd])
+    4bd4:	8b 1c b5 20 c4 00 00 	mov    0xc420(,%esi,4),%ebx
+    4bdb:	85 db                	test   %ebx,%ebx
+    4bdd:	74 11                	je     4bf0 <fdopen+0x30>
+}
+    4bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4be2:	89 d8                	mov    %ebx,%eax
+    4be4:	5b                   	pop    %ebx
+    4be5:	5e                   	pop    %esi
+    4be6:	5d                   	pop    %ebp
+    4be7:	c3                   	ret
+    4be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4bef:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+    4bf0:	83 ec 0c             	sub    $0xc,%esp
+    4bf3:	68 10 02 00 00       	push   $0x210
+    4bf8:	e8 e3 05 00 00       	call   51e0 <malloc>
+    4bfd:	83 c4 10             	add    $0x10,%esp
+    4c00:	89 c3                	mov    %eax,%ebx
+    4c02:	85 c0                	test   %eax,%eax
+    4c04:	74 52                	je     4c58 <fdopen+0x98>
+  f->fd = fd;
+    4c06:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    4c08:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+    4c0b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+    4c12:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+    4c19:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+    4c20:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    4c23:	50                   	push   %eax
+    4c24:	56                   	push   %esi
+    4c25:	e8 f4 fa ff ff       	call   471e <fstat>
+    4c2a:	83 c4 10             	add    $0x10,%esp
+    4c2d:	85 c0                	test   %eax,%eax
+    4c2f:	75 07                	jne    4c38 <fdopen+0x78>
+    4c31:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+    4c36:	74 30                	je     4c68 <fdopen+0xa8>
+  streams[fd] = f;
+    4c38:	89 1c b5 20 c4 00 00 	mov    %ebx,0xc420(,%esi,4)
+}
+    4c3f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+    4c41:	c7 05 00 c4 00 00 e0 	movl   $0x47e0,0xc400
+    4c48:	47 00 00 
+}
+    4c4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4c4e:	5b                   	pop    %ebx
+    4c4f:	5e                   	pop    %esi
+    4c50:	5d                   	pop    %ebp
+    4c51:	c3                   	ret
+    4c52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    4c58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+    4c5b:	31 db                	xor    %ebx,%ebx
+}
+    4c5d:	89 d8                	mov    %ebx,%eax
+    4c5f:	5b                   	pop    %ebx
+    4c60:	5e                   	pop    %esi
+    4c61:	5d                   	pop    %ebp
+    4c62:	c3                   	ret
+    4c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4c67:	90                   	nop
+    f->mode = _IOLBF;
+    4c68:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+    4c6f:	eb c7                	jmp    4c38 <fdopen+0x78>
+    4c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4c7f:	90                   	nop
+
+00004c80 <fopen>:
+{
+    4c80:	55                   	push   %ebp
+    4c81:	89 e5                	mov    %esp,%ebp
+    4c83:	53                   	push   %ebx
+    4c84:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+    4c87:	ff 75 0c             	push   0xc(%ebp)
+    4c8a:	ff 75 08             	push   0x8(%ebp)
+    4c8d:	e8 74 fa ff ff       	call   4706 <open>
+    4c92:	83 c4 10             	add    $0x10,%esp
+    4c95:	85 c0                	test   %eax,%eax
+    4c97:	78 37                	js     4cd0 <fopen+0x50>
+    4c99:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+    4c9b:	8b 04 85 20 c4 00 00 	mov    0xc420(,%eax,4),%eax
+    4ca2:	85 c0                	test   %eax,%eax
+    4ca4:	74 17                	je     4cbd <fopen+0x3d>
+    free(streams[fd]);
+    4ca6:	83 ec 0c             	sub    $0xc,%esp
+    4ca9:	50                   	push   %eax
+    4caa:	e8 a1 04 00 00       	call   5150 <free>
+    streams[fd] = 0;
+    4caf:	83 c4 10             	add    $0x10,%esp
+    4cb2:	c7 04 9d 20 c4 00 00 	movl   $0x0,0xc420(,%ebx,4)
+    4cb9:	00 00 00 00 
+  return fdopen(fd);
+    4cbd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    4cc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4cc3:	c9                   	leave
+  return fdopen(fd);
+    4cc4:	e9 f7 fe ff ff       	jmp    4bc0 <fdopen>
+    4cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+    4cd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4cd3:	31 c0                	xor    %eax,%eax
+    4cd5:	c9                   	leave
+    4cd6:	c3                   	ret
+    4cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4cde:	66 90                	xchg   %ax,%ax
+
+00004ce0 <setvbuf>:
+{
+    4ce0:	55                   	push   %ebp
+    4ce1:	89 e5                	mov    %esp,%ebp
+    4ce3:	56                   	push   %esi
+    4ce4:	53                   	push   %ebx
+    4ce5:	8b 75 0c             	mov    0xc(%ebp),%esi
+    4ce8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+    4ceb:	83 fe 02             	cmp    $0x2,%esi
+    4cee:	77 38                	ja     4d28 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4cf0:	8b 43 08             	mov    0x8(%ebx),%eax
+    4cf3:	85 c0                	test   %eax,%eax
+    4cf5:	7e 12                	jle    4d09 <setvbuf+0x29>
+    4cf7:	83 ec 04             	sub    $0x4,%esp
+    4cfa:	50                   	push   %eax
+    4cfb:	8d 43 10             	lea    0x10(%ebx),%eax
+    4cfe:	50                   	push   %eax
+    4cff:	ff 33                	push   (%ebx)
+    4d01:	e8 e0 f9 ff ff       	call   46e6 <write>
+    4d06:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    4d09:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+    4d10:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+    4d12:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+    4d19:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+    4d1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4d1f:	5b                   	pop    %ebx
+    4d20:	5e                   	pop    %esi
+    4d21:	5d                   	pop    %ebp
+    4d22:	c3                   	ret
+    4d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4d27:	90                   	nop
+    return -1;
+    4d28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4d2d:	eb ed                	jmp    4d1c <setvbuf+0x3c>
+    4d2f:	90                   	nop
+
+00004d30 <fflush>:
+{
+    4d30:	55                   	push   %ebp
+    4d31:	31 c0                	xor    %eax,%eax
+    4d33:	89 e5                	mov    %esp,%ebp
+    4d35:	53                   	push   %ebx
+    4d36:	83 ec 04             	sub    $0x4,%esp
+    4d39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4d3c:	8b 53 08             	mov    0x8(%ebx),%edx
+    4d3f:	85 d2                	test   %edx,%edx
+    4d41:	7e 1d                	jle    4d60 <fflush+0x30>
+    4d43:	83 ec 04             	sub    $0x4,%esp
+    4d46:	8d 43 10             	lea    0x10(%ebx),%eax
+    4d49:	52                   	push   %edx
+    4d4a:	50                   	push   %eax
+    4d4b:	ff 33                	push   (%ebx)
+    4d4d:	e8 94 f9 ff ff       	call   46e6 <write>
+    4d52:	83 c4 10             	add    $0x10,%esp
+    4d55:	39 43 08             	cmp    %eax,0x8(%ebx)
+    4d58:	0f 95 c0             	setne  %al
+    4d5b:	0f b6 c0             	movzbl %al,%eax
+    4d5e:	f7 d8                	neg    %eax
+  f->n = 0;
+    4d60:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    4d67:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    4d6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4d71:	c9                   	leave
+    4d72:	c3                   	ret
+    4d73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004d80 <fclose>:
+{
+    4d80:	55                   	push   %ebp
+    4d81:	89 e5                	mov    %esp,%ebp
+    4d83:	56                   	push   %esi
+    4d84:	31 f6                	xor    %esi,%esi
+    4d86:	53                   	push   %ebx
+    4d87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4d8a:	8b 43 08             	mov    0x8(%ebx),%eax
+    4d8d:	85 c0                	test   %eax,%eax
+    4d8f:	7e 1f                	jle    4db0 <fclose+0x30>
+    4d91:	83 ec 04             	sub    $0x4,%esp
+    4d94:	50                   	push   %eax
+    4d95:	8d 43 10             	lea    0x10(%ebx),%eax
+    4d98:	50                   	push   %eax
+    4d99:	ff 33                	push   (%ebx)
+    4d9b:	e8 46 f9 ff ff       	call   46e6 <write>
+    4da0:	83 c4 10             	add    $0x10,%esp
+    4da3:	39 43 08             	cmp    %eax,0x8(%ebx)
+    4da6:	0f 95 c0             	setne  %al
+    4da9:	0f b6 c0             	movzbl %al,%eax
+    4dac:	f7 d8                	neg    %eax
+    4dae:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+    4db0:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+    4db3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    4dba:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+    4dc1:	ff 33                	push   (%ebx)
+    4dc3:	e8 26 f9 ff ff       	call   46ee <close>
+    4dc8:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+    4dcb:	85 c0                	test   %eax,%eax
+    4dcd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4dd2:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+    4dd5:	8b 03                	mov    (%ebx),%eax
+    4dd7:	83 f8 0f             	cmp    $0xf,%eax
+    4dda:	77 09                	ja     4de5 <fclose+0x65>
+    4ddc:	39 1c 85 20 c4 00 00 	cmp    %ebx,0xc420(,%eax,4)
+    4de3:	74 0b                	je     4df0 <fclose+0x70>
+}
+    4de5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4de8:	89 f0                	mov    %esi,%eax
+    4dea:	5b                   	pop    %ebx
+    4deb:	5e                   	pop    %esi
+    4dec:	5d                   	pop    %ebp
+    4ded:	c3                   	ret
+    4dee:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+    4df0:	c7 04 85 20 c4 00 00 	movl   $0x0,0xc420(,%eax,4)
+    4df7:	00 00 00 00 
+    free(f);
+    4dfb:	83 ec 0c             	sub    $0xc,%esp
+    4dfe:	53                   	push   %ebx
+    4dff:	e8 4c 03 00 00       	call   5150 <free>
+    4e04:	83 c4 10             	add    $0x10,%esp
+  return r;
+    4e07:	eb dc                	jmp    4de5 <fclose+0x65>
+    4e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004e10 <fputc>:
+{
+    4e10:	55                   	push   %ebp
+    4e11:	89 e5                	mov    %esp,%ebp
+    4e13:	53                   	push   %ebx
+    4e14:	83 ec 04             	sub    $0x4,%esp
+    4e17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    4e1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+    4e1d:	8b 43 08             	mov    0x8(%ebx),%eax
+    4e20:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4e25:	74 59                	je     4e80 <fputc+0x70>
+  f->buf[f->n++] = c;
+    4e27:	8d 48 01             	lea    0x1(%eax),%ecx
+    4e2a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+    4e2d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+    4e31:	80 fa 0a             	cmp    $0xa,%dl
+    4e34:	75 07                	jne    4e3d <fputc+0x2d>
+    f->nl = 1;
+    4e36:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    4e3d:	8b 43 04             	mov    0x4(%ebx),%eax
+    4e40:	83 f8 02             	cmp    $0x2,%eax
+    4e43:	74 1a                	je     4e5f <fputc+0x4f>
+    4e45:	83 f8 01             	cmp    $0x1,%eax
+    4e48:	74 0e                	je     4e58 <fputc+0x48>
+}
+    4e4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+    4e4d:	0f b6 c2             	movzbl %dl,%eax
+}
+    4e50:	c9                   	leave
+    4e51:	c3                   	ret
+    4e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    4e58:	8b 43 0c             	mov    0xc(%ebx),%eax
+    4e5b:	85 c0                	test   %eax,%eax
+    4e5d:	74 eb                	je     4e4a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4e5f:	85 c9                	test   %ecx,%ecx
+    4e61:	7f 4d                	jg     4eb0 <fputc+0xa0>
+  f->n = 0;
+    4e63:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    4e6a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    4e71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+    4e74:	0f b6 c2             	movzbl %dl,%eax
+}
+    4e77:	c9                   	leave
+    4e78:	c3                   	ret
+    4e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4e80:	83 ec 04             	sub    $0x4,%esp
+    4e83:	8d 43 10             	lea    0x10(%ebx),%eax
+    4e86:	89 55 08             	mov    %edx,0x8(%ebp)
+    4e89:	68 00 02 00 00       	push   $0x200
+    4e8e:	50                   	push   %eax
+    4e8f:	ff 33                	push   (%ebx)
+    4e91:	e8 50 f8 ff ff       	call   46e6 <write>
+  return r;
+    4e96:	8b 55 08             	mov    0x8(%ebp),%edx
+    4e99:	83 c4 10             	add    $0x10,%esp
+    4e9c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+    4ea1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    4ea8:	31 c0                	xor    %eax,%eax
+    4eaa:	e9 7b ff ff ff       	jmp    4e2a <fputc+0x1a>
+    4eaf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4eb0:	83 ec 04             	sub    $0x4,%esp
+    4eb3:	8d 43 10             	lea    0x10(%ebx),%eax
+    4eb6:	89 55 08             	mov    %edx,0x8(%ebp)
+    4eb9:	51                   	push   %ecx
+    4eba:	50                   	push   %eax
+    4ebb:	ff 33                	push   (%ebx)
+    4ebd:	e8 24 f8 ff ff       	call   46e6 <write>
+  f->n = 0;
+    4ec2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    4ec9:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+    4ecc:	83 c4 10             	add    $0x10,%esp
+    4ecf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    4ed6:	eb 99                	jmp    4e71 <fputc+0x61>
+    4ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4edf:	90                   	nop
+
+00004ee0 <fwrite>:
+{
+    4ee0:	55                   	push   %ebp
+    4ee1:	89 e5                	mov    %esp,%ebp
+    4ee3:	57                   	push   %edi
+    4ee4:	56                   	push   %esi
+    4ee5:	53                   	push   %ebx
+    4ee6:	83 ec 1c             	sub    $0x1c,%esp
+    4ee9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+    4eec:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+    4eef:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+    4ef2:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    4ef5:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+    4efb:	0f 8f af 00 00 00    	jg     4fb0 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+    4f01:	85 ff                	test   %edi,%edi
+    4f03:	7e 73                	jle    4f78 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4f05:	8d 56 10             	lea    0x10(%esi),%edx
+    4f08:	8b 46 08             	mov    0x8(%esi),%eax
+    4f0b:	31 db                	xor    %ebx,%ebx
+    4f0d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    4f10:	eb 25                	jmp    4f37 <fwrite+0x57>
+    4f12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+    4f18:	89 c1                	mov    %eax,%ecx
+    4f1a:	83 c0 01             	add    $0x1,%eax
+    4f1d:	89 46 08             	mov    %eax,0x8(%esi)
+    4f20:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+    4f24:	80 fa 0a             	cmp    $0xa,%dl
+    4f27:	75 07                	jne    4f30 <fwrite+0x50>
+    f->nl = 1;
+    4f29:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+    4f30:	83 c3 01             	add    $0x1,%ebx
+    4f33:	39 df                	cmp    %ebx,%edi
+    4f35:	7e 41                	jle    4f78 <fwrite+0x98>
+    bputc(f, s[i]);
+    4f37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4f3a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+    4f3e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    4f43:	75 d3                	jne    4f18 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4f45:	83 ec 04             	sub    $0x4,%esp
+    4f48:	88 55 e7             	mov    %dl,-0x19(%ebp)
+    4f4b:	68 00 02 00 00       	push   $0x200
+    4f50:	ff 75 e0             	push   -0x20(%ebp)
+    4f53:	ff 36                	push   (%esi)
+    4f55:	e8 8c f7 ff ff       	call   46e6 <write>
+  return r;
+    4f5a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+    4f5e:	83 c4 10             	add    $0x10,%esp
+    4f61:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+    4f63:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    4f6a:	b8 01 00 00 00       	mov    $0x1,%eax
+    4f6f:	eb ac                	jmp    4f1d <fwrite+0x3d>
+    4f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    4f78:	8b 46 04             	mov    0x4(%esi),%eax
+    4f7b:	83 f8 02             	cmp    $0x2,%eax
+    4f7e:	74 0c                	je     4f8c <fwrite+0xac>
+    4f80:	83 f8 01             	cmp    $0x1,%eax
+    4f83:	75 1c                	jne    4fa1 <fwrite+0xc1>
+    4f85:	8b 46 0c             	mov    0xc(%esi),%eax
+    4f88:	85 c0                	test   %eax,%eax
+    4f8a:	74 15                	je     4fa1 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4f8c:	8b 46 08             	mov    0x8(%esi),%eax
+    4f8f:	85 c0                	test   %eax,%eax
+    4f91:	7f 5d                	jg     4ff0 <fwrite+0x110>
+  f->n = 0;
+    4f93:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    4f9a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+    4fa1:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+    4fa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4fa7:	5b                   	pop    %ebx
+    4fa8:	5e                   	pop    %esi
+    4fa9:	5f                   	pop    %edi
+    4faa:	5d                   	pop    %ebp
+    4fab:	c3                   	ret
+    4fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+    4fb0:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+    4fb4:	0f 84 4b ff ff ff    	je     4f05 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4fba:	8b 46 08             	mov    0x8(%esi),%eax
+    4fbd:	8b 16                	mov    (%esi),%edx
+    4fbf:	85 c0                	test   %eax,%eax
+    4fc1:	7f 45                	jg     5008 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+    4fc3:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+    4fc6:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    4fcd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+    4fd4:	57                   	push   %edi
+    4fd5:	ff 75 08             	push   0x8(%ebp)
+    4fd8:	ff 36                	push   (%esi)
+    4fda:	e8 07 f7 ff ff       	call   46e6 <write>
+    return size > 0 ? i / size : 0;
+    4fdf:	83 c4 10             	add    $0x10,%esp
+    4fe2:	85 c0                	test   %eax,%eax
+    4fe4:	78 4a                	js     5030 <fwrite+0x150>
+    4fe6:	85 db                	test   %ebx,%ebx
+    4fe8:	7e 46                	jle    5030 <fwrite+0x150>
+    4fea:	99                   	cltd
+    4feb:	f7 fb                	idiv   %ebx
+    4fed:	eb b5                	jmp    4fa4 <fwrite+0xc4>
+    4fef:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    4ff0:	83 ec 04             	sub    $0x4,%esp
+    4ff3:	50                   	push   %eax
+    4ff4:	8d 46 10             	lea    0x10(%esi),%eax
+    4ff7:	50                   	push   %eax
+    4ff8:	ff 36                	push   (%esi)
+    4ffa:	e8 e7 f6 ff ff       	call   46e6 <write>
+    4fff:	83 c4 10             	add    $0x10,%esp
+    5002:	eb 8f                	jmp    4f93 <fwrite+0xb3>
+    5004:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    5008:	83 ec 04             	sub    $0x4,%esp
+    500b:	50                   	push   %eax
+    500c:	8d 46 10             	lea    0x10(%esi),%eax
+    500f:	50                   	push   %eax
+    5010:	52                   	push   %edx
+    5011:	e8 d0 f6 ff ff       	call   46e6 <write>
+    5016:	83 c4 10             	add    $0x10,%esp
+    5019:	3b 46 08             	cmp    0x8(%esi),%eax
+    501c:	74 a5                	je     4fc3 <fwrite+0xe3>
+  f->n = 0;
+    501e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+    5025:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+    502c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+    5030:	31 c0                	xor    %eax,%eax
+    5032:	e9 6d ff ff ff       	jmp    4fa4 <fwrite+0xc4>
+    5037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    503e:	66 90                	xchg   %ax,%ax
+
+00005040 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+    5040:	55                   	push   %ebp
+    5041:	89 e5                	mov    %esp,%ebp
+    5043:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    5044:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+    5047:	83 ec 04             	sub    $0x4,%esp
+    504a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    504d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5050:	89 d8                	mov    %ebx,%eax
+    5052:	e8 39 f9 ff ff       	call   4990 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    5057:	8b 43 04             	mov    0x4(%ebx),%eax
+    505a:	83 f8 02             	cmp    $0x2,%eax
+    505d:	74 18                	je     5077 <fprintf+0x37>
+    505f:	83 f8 01             	cmp    $0x1,%eax
+    5062:	74 0c                	je     5070 <fprintf+0x30>
+  settle(f);
+}
+    5064:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5067:	c9                   	leave
+    5068:	c3                   	ret
+    5069:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+    5070:	8b 43 0c             	mov    0xc(%ebx),%eax
+    5073:	85 c0                	test   %eax,%eax
+    5075:	74 ed                	je     5064 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    5077:	8b 43 08             	mov    0x8(%ebx),%eax
+    507a:	85 c0                	test   %eax,%eax
+    507c:	7f 1a                	jg     5098 <fprintf+0x58>
+  f->n = 0;
+    507e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    5085:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    508c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    508f:	c9                   	leave
+    5090:	c3                   	ret
+    5091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    5098:	83 ec 04             	sub    $0x4,%esp
+    509b:	50                   	push   %eax
+    509c:	8d 43 10             	lea    0x10(%ebx),%eax
+    509f:	50                   	push   %eax
+    50a0:	ff 33                	push   (%ebx)
+    50a2:	e8 3f f6 ff ff       	call   46e6 <write>
+  f->n = 0;
+    50a7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    50ae:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+    50b1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+    50b8:	eb d2                	jmp    508c <fprintf+0x4c>
+    50ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000050c0 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+    50c0:	55                   	push   %ebp
+    50c1:	89 e5                	mov    %esp,%ebp
+    50c3:	53                   	push   %ebx
+    50c4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+    50ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+    50cd:	83 f8 0f             	cmp    $0xf,%eax
+    50d0:	77 4e                	ja     5120 <printf+0x60>
+    50d2:	8b 1c 85 20 c4 00 00 	mov    0xc420(,%eax,4),%ebx
+    50d9:	85 db                	test   %ebx,%ebx
+    50db:	74 43                	je     5120 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+    50dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+    50e0:	89 d8                	mov    %ebx,%eax
+    50e2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    50e5:	e8 a6 f8 ff ff       	call   4990 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+    50ea:	8b 43 08             	mov    0x8(%ebx),%eax
+    50ed:	85 c0                	test   %eax,%eax
+    50ef:	7e 12                	jle    5103 <printf+0x43>
+    50f1:	83 ec 04             	sub    $0x4,%esp
+    50f4:	50                   	push   %eax
+    50f5:	8d 43 10             	lea    0x10(%ebx),%eax
+    50f8:	50                   	push   %eax
+    50f9:	ff 33                	push   (%ebx)
+    50fb:	e8 e6 f5 ff ff       	call   46e6 <write>
+    5100:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+    5103:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+    510a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+    5111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5114:	c9                   	leave
+    5115:	c3                   	ret
+    5116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    511d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+    5120:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+    5126:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+    512c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+    5133:	00 00 00 
+    f->n = 0;
+    5136:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+    513d:	00 00 00 
+    f->nl = 0;
+    5140:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+    5147:	00 00 00 
+    514a:	eb 91                	jmp    50dd <printf+0x1d>
+    514c:	66 90                	xchg   %ax,%ax
+    514e:	66 90                	xchg   %ax,%ax
+
+00005150 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    5150:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5151:	a1 60 c4 00 00       	mov    0xc460,%eax
+{
+    5156:	89 e5                	mov    %esp,%ebp
+    5158:	57                   	push   %edi
+    5159:	56                   	push   %esi
+    515a:	53                   	push   %ebx
+    515b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    515e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    5161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    5168:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    516a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    516c:	39 ca                	cmp    %ecx,%edx
+    516e:	73 30                	jae    51a0 <free+0x50>
+    5170:	39 c1                	cmp    %eax,%ecx
+    5172:	72 04                	jb     5178 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    5174:	39 c2                	cmp    %eax,%edx
+    5176:	72 f0                	jb     5168 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    5178:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    517b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    517e:	39 f8                	cmp    %edi,%eax
+    5180:	74 2e                	je     51b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    5182:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    5185:	8b 42 04             	mov    0x4(%edx),%eax
+    5188:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    518b:	39 f1                	cmp    %esi,%ecx
+    518d:	74 38                	je     51c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    518f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    5191:	5b                   	pop    %ebx
+  freep = p;
+    5192:	89 15 60 c4 00 00    	mov    %edx,0xc460
+}
+    5198:	5e                   	pop    %esi
+    5199:	5f                   	pop    %edi
+    519a:	5d                   	pop    %ebp
+    519b:	c3                   	ret
+    519c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    51a0:	39 c1                	cmp    %eax,%ecx
+    51a2:	72 d0                	jb     5174 <free+0x24>
+    51a4:	eb c2                	jmp    5168 <free+0x18>
+    51a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    51ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    51b0:	03 70 04             	add    0x4(%eax),%esi
+    51b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    51b6:	8b 02                	mov    (%edx),%eax
+    51b8:	8b 00                	mov    (%eax),%eax
+    51ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    51bd:	8b 42 04             	mov    0x4(%edx),%eax
+    51c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    51c3:	39 f1                	cmp    %esi,%ecx
+    51c5:	75 c8                	jne    518f <free+0x3f>
+    p->s.size += bp->s.size;
+    51c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    51ca:	89 15 60 c4 00 00    	mov    %edx,0xc460
+    p->s.size += bp->s.size;
+    51d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    51d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    51d6:	89 0a                	mov    %ecx,(%edx)
+}
+    51d8:	5b                   	pop    %ebx
+    51d9:	5e                   	pop    %esi
+    51da:	5f                   	pop    %edi
+    51db:	5d                   	pop    %ebp
+    51dc:	c3                   	ret
+    51dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000051e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    51e0:	55                   	push   %ebp
+    51e1:	89 e5                	mov    %esp,%ebp
+    51e3:	57                   	push   %edi
+    51e4:	56                   	push   %esi
+    51e5:	53                   	push   %ebx
+    51e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    51e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    51ec:	8b 15 60 c4 00 00    	mov    0xc460,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    51f2:	8d 78 07             	lea    0x7(%eax),%edi
+    51f5:	c1 ef 03             	shr    $0x3,%edi
+    51f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    51fb:	85 d2                	test   %edx,%edx
+    51fd:	0f 84 8d 00 00 00    	je     5290 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5203:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    5205:	8b 48 04             	mov    0x4(%eax),%ecx
+    5208:	39 f9                	cmp    %edi,%ecx
+    520a:	73 64                	jae    5270 <malloc+0x90>
+  if(nu < 4096)
+    520c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    5211:	39 df                	cmp    %ebx,%edi
+    5213:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    5216:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    521d:	eb 0a                	jmp    5229 <malloc+0x49>
+    521f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5220:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    5222:	8b 48 04             	mov    0x4(%eax),%ecx
+    5225:	39 f9                	cmp    %edi,%ecx
+    5227:	73 47                	jae    5270 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    5229:	89 c2                	mov    %eax,%edx
+    522b:	39 05 60 c4 00 00    	cmp    %eax,0xc460
+    5231:	75 ed                	jne    5220 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    5233:	83 ec 0c             	sub    $0xc,%esp
+    5236:	56                   	push   %esi
+    5237:	e8 12 f5 ff ff       	call   474e <sbrk>
+  if(p == (char*)-1)
+    523c:	83 c4 10             	add    $0x10,%esp
+    523f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5242:	74 1c                	je     5260 <malloc+0x80>
+  hp->s.size = nu;
+    5244:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    5247:	83 ec 0c             	sub    $0xc,%esp
+    524a:	83 c0 08             	add    $0x8,%eax
+    524d:	50                   	push   %eax
+    524e:	e8 fd fe ff ff       	call   5150 <free>
+  return freep;
+    5253:	8b 15 60 c4 00 00    	mov    0xc460,%edx
+      if((p = morecore(nunits)) == 0)
+    5259:	83 c4 10             	add    $0x10,%esp
+    525c:	85 d2                	test   %edx,%edx
+    525e:	75 c0                	jne    5220 <malloc+0x40>
+        return 0;
+  }
+}
+    5260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    5263:	31 c0                	xor    %eax,%eax
+}
+    5265:	5b                   	pop    %ebx
+    5266:	5e                   	pop    %esi
+    5267:	5f                   	pop    %edi
+    5268:	5d                   	pop    %ebp
+    5269:	c3                   	ret
+    526a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    5270:	39 cf                	cmp    %ecx,%edi
+    5272:	74 4c                	je     52c0 <malloc+0xe0>
+        p->s.size -= nunits;
+    5274:	29 f9                	sub    %edi,%ecx
+    5276:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    5279:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    527c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    527f:	89 15 60 c4 00 00    	mov    %edx,0xc460
+}
+    5285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    5288:	83 c0 08             	add    $0x8,%eax
+}
+    528b:	5b                   	pop    %ebx
+    528c:	5e                   	pop    %esi
+    528d:	5f                   	pop    %edi
+    528e:	5d                   	pop    %ebp
+    528f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    5290:	c7 05 60 c4 00 00 64 	movl   $0xc464,0xc460
+    5297:	c4 00 00 
+    base.s.size = 0;
+    529a:	b8 64 c4 00 00       	mov    $0xc464,%eax
+    base.s.ptr = freep = prevp = &base;
+    529f:	c7 05 64 c4 00 00 64 	movl   $0xc464,0xc464
+    52a6:	c4 00 00 
+    base.s.size = 0;
+    52a9:	c7 05 68 c4 00 00 00 	movl   $0x0,0xc468
+    52b0:	00 00 00 
+    if(p->s.size >= nunits){
+    52b3:	e9 54 ff ff ff       	jmp    520c <malloc+0x2c>
+    52b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    52bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    52c0:	8b 08                	mov    (%eax),%ecx
+    52c2:	89 0a                	mov    %ecx,(%edx)
+    52c4:	eb b9                	jmp    527f <malloc+0x9f>
@@ -7,6 +7,9 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "uio.h"
+#include "date.h"
+#include "sched.h"
 
 char buf[8192];
 char name[3];
@@ -184,6 +187,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// enough blocks to reach into the double-indirect range
+#define NBIGBLOCKS (NDIRECT + NINDIRECT + 3*NINDIRECT)
+
 void
 writetest1(void)
 {
@@ -197,7 +203,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < NBIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +223,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != NBIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -234,6 +240,32 @@ writetest1(void)
     n++;
   }
   close(fd);
+
+  // again, many blocks at a time.
+  fd = open("big", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+  n = 0;
+  while((i = read(fd, buf, sizeof(buf))) > 0){
+    if(i % 512 != 0){
+      printf(stdout, "multi-block read failed %d\n", i);
+      exit();
+    }
+    for(; i > 0; i -= 512, n++){
+      if(((int*)buf)[(n%(sizeof(buf)/512))*128] != n){
+        printf(stdout, "multi-block read content of block %d is %d\n",
+               n, ((int*)buf)[(n%(sizeof(buf)/512))*128]);
+        exit();
+      }
+    }
+  }
+  if(i < 0 || n != NBIGBLOCKS){
+    printf(stdout, "multi-block read only %d blocks from big\n", n);
+    exit();
+  }
+  close(fd);
   if(unlink("big") < 0){
     printf(stdout, "unlink big failed\n");
     exit();
@@ -241,6 +273,107 @@ writetest1(void)
   printf(stdout, "big files ok\n");
 }
 
+// reads of whole pages into page-aligned memory map the
+// file's cached pages copy-on-write. writes to that memory,
+// by the process, by the kernel or by a child, must not
+// reach the file or others who read it, and a write to the
+// file must reach later reads but not earlier ones.
+#define MAPSZ (3*4096)
+char mapbuf[MAPSZ] __attribute__((aligned(4096)));
+char mapbuf2[MAPSZ] __attribute__((aligned(4096)));
+
+static void
+mapcheck(char *b, char *what)
+{
+  int i;
+
+  for(i = 0; i < MAPSZ; i++){
+    if(b[i] != (char)(i % 251)){
+      printf(stdout, "mapread %s: byte %d is %d\n", what, i, b[i]);
+      exit();
+    }
+  }
+}
+
+static void
+mapreadall(char *b)
+{
+  int fd;
+
+  fd = open("mapfile", 0);
+  if(fd < 0 || read(fd, b, MAPSZ) != MAPSZ){
+    printf(stdout, "mapread read failed\n");
+    exit();
+  }
+  close(fd);
+}
+
+void
+mapread(void)
+{
+  int fd, i, pid, p[2];
+
+  printf(stdout, "mapread test\n");
+
+  for(i = 0; i < MAPSZ; i++)
+    mapbuf[i] = i % 251;
+  fd = open("mapfile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, mapbuf, MAPSZ) != MAPSZ){
+    printf(stdout, "mapread create failed\n");
+    exit();
+  }
+  close(fd);
+
+  memset(mapbuf, 0, MAPSZ);
+  mapreadall(mapbuf);
+  mapcheck(mapbuf, "first read");
+  mapreadall(mapbuf2);
+  mapcheck(mapbuf2, "second read");
+
+  // the process writes to a shared page
+  mapbuf[0] = 'x';
+  mapcheck(mapbuf2, "after user write");
+
+  // the kernel writes to one, holding the pipe lock
+  if(pipe(p) != 0 || write(p[1], "hello", 5) != 5 ||
+     read(p[0], mapbuf + 4096, 5) != 5 || mapbuf[4096] != 'h'){
+    printf(stdout, "mapread pipe read failed\n");
+    exit();
+  }
+  close(p[0]);
+  close(p[1]);
+  mapcheck(mapbuf2, "after kernel write");
+
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "mapread fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    mapcheck(mapbuf2, "in child");
+    mapbuf2[8192] = 'c';
+    exit();
+  }
+  wait();
+  mapcheck(mapbuf2, "after child write");
+
+  fd = open("mapfile", O_RDWR);
+  if(fd < 0 || write(fd, "Z", 1) != 1){
+    printf(stdout, "mapread rewrite failed\n");
+    exit();
+  }
+  close(fd);
+  mapreadall(mapbuf);
+  if(mapbuf[0] != 'Z'){
+    printf(stdout, "mapread read old data after write\n");
+    exit();
+  }
+  mapcheck(mapbuf2, "after file write");
+
+  unlink("mapfile");
+  printf(stdout, "mapread ok\n");
+}
+
 void
 createtest(void)
 {
@@ -354,6 +487,305 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+static int
+bufeq(char *p, char *q, int n)
+{
+  while(n-- > 0)
+    if(*p++ != *q++)
+      return 0;
+  return 1;
+}
+
+// buffered streams reach the file on fflush and exit.
+void
+stdiotest(void)
+{
+  FILE *f;
+  int fd, n, pid;
+
+  printf(1, "stdio test\n");
+
+  f = fopen("stdiofile", O_CREATE|O_WRONLY);
+  if(f == 0){
+    printf(1, "stdio fopen failed\n");
+    exit();
+  }
+  fprintf(f, "%d %s", 42, "abc");
+  if(fwrite("xyz", 1, 3, f) != 3){
+    printf(1, "stdio fwrite failed\n");
+    exit();
+  }
+  fd = open("stdiofile", O_RDONLY);
+  if(read(fd, buf, sizeof(buf)) != 0){
+    printf(1, "stdio output not buffered\n");
+    exit();
+  }
+  fflush(f);
+  if((n = read(fd, buf, sizeof(buf))) != 9 || !bufeq(buf, "42 abcxyz", 9)){
+    printf(1, "stdio fflush wrote %d bytes\n", n);
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "stdio fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    fputc('!', f);
+    exit();
+  }
+  wait();
+  if(read(fd, buf, sizeof(buf)) != 1 || buf[0] != '!'){
+    printf(1, "stdio exit did not flush\n");
+    exit();
+  }
+  close(fd);
+  fclose(f);
+  unlink("stdiofile");
+
+  printf(1, "stdio test ok\n");
+}
+
+// nanosleep sleeps at least as long as asked, and a
+// sleeper on the timer wheel can be killed.
+void
+nanosleeptest(void)
+{
+  struct timespec ts;
+  int t0, pid;
+
+  printf(1, "nanosleep test\n");
+
+  ts.tv_sec = 0;
+  ts.tv_nsec = 1000000000;
+  if(nanosleep(&ts) != -1){
+    printf(1, "nanosleep accepted bad tv_nsec\n");
+    exit();
+  }
+
+  ts.tv_nsec = 30000000;
+  t0 = uptime();
+  if(nanosleep(&ts) != 0 || uptime() - t0 < 2){
+    printf(1, "nanosleep returned early\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "nanosleep fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    ts.tv_sec = 1000;
+    ts.tv_nsec = 0;
+    nanosleep(&ts);
+    exit();
+  }
+  ts.tv_sec = 0;
+  ts.tv_nsec = 1000000;
+  nanosleep(&ts);
+  kill(pid, SIGKILL);
+  if(wait() != pid){
+    printf(1, "nanosleep wait failed\n");
+    exit();
+  }
+
+  printf(1, "nanosleep test ok\n");
+}
+
+// scheduling classes: bad arguments are refused, settings
+// take effect and are inherited, and a SCHED_RT process can
+// fork, wait and go back to SCHED_FAIR.
+void
+schedtest(void)
+{
+  struct sched_attr attr;
+  int pid;
+
+  printf(1, "sched test\n");
+
+  if(setpriority(0, NICEMAX+1) != -1 || setpriority(0, NICEMIN-1) != -1){
+    printf(1, "setpriority accepted bad nice\n");
+    exit();
+  }
+  attr.policy = SCHED_RT;
+  attr.priority = NRTPRIO;
+  if(sched_setattr(0, &attr) != -1){
+    printf(1, "sched_setattr accepted bad priority\n");
+    exit();
+  }
+  if(setpriority(0, -1) != 0 || sched_getattr(0, &attr) != 0 ||
+     attr.policy != SCHED_FAIR || attr.nice != -1){
+    printf(1, "setpriority -1 failed\n");
+    exit();
+  }
+  if(setpriority(0, 5) != 0 || sched_getattr(0, &attr) != 0 ||
+     attr.nice != 5){
+    printf(1, "setpriority 5 failed\n");
+    exit();
+  }
+
+  attr.policy = SCHED_RT;
+  attr.priority = NRTPRIO-1;
+  if(sched_setattr(0, &attr) != 0 || sched_getattr(0, &attr) != 0 ||
+     attr.policy != SCHED_RT || attr.priority != NRTPRIO-1){
+    printf(1, "sched_setattr SCHED_RT failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "sched fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(sched_getattr(0, &attr) != 0 || attr.policy != SCHED_RT ||
+       attr.priority != NRTPRIO-1 || attr.nice != 5)
+      printf(1, "sched fork did not inherit class\n");
+    sched_yield();
+    exit();
+  }
+  if(sched_yield() != 0 || wait() != pid){
+    printf(1, "sched wait failed\n");
+    exit();
+  }
+  if(sched_setaffinity(0, 0) != -1 || sched_setaffinity(0, 1) != 0 ||
+     sched_getaffinity(0) != 1 || sched_setaffinity(0, ~0) != 0 ||
+     (sched_getaffinity(0) & 1) == 0){
+    printf(1, "sched affinity failed\n");
+    exit();
+  }
+  attr.policy = SCHED_FAIR;
+  attr.nice = -1;
+  if(sched_setattr(0, &attr) != 0 || sched_getattr(0, &attr) != 0 ||
+     attr.policy != SCHED_FAIR || attr.nice != -1){
+    printf(1, "sched_setattr SCHED_FAIR failed\n");
+    exit();
+  }
+  setpriority(0, 0);
+
+  printf(1, "sched test ok\n");
+}
+
+// getrusage counts our own system calls, and a child's
+// once it has been waited for.
+void
+rusagetest(void)
+{
+  struct rusage ru0, ru1;
+  int pid, i;
+
+  printf(1, "rusage test\n");
+
+  if(getrusage(1, &ru0) != -1){
+    printf(1, "getrusage accepted bad who\n");
+    exit();
+  }
+  if(getrusage(RUSAGE_SELF, &ru0) != 0 ||
+     getrusage(RUSAGE_SELF, &ru1) != 0 ||
+     ru1.ru_nsyscall != ru0.ru_nsyscall + 1){
+    printf(1, "getrusage self failed\n");
+    exit();
+  }
+
+  getrusage(RUSAGE_CHILDREN, &ru0);
+  pid = fork();
+  if(pid < 0){
+    printf(1, "rusage fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < 10; i++)
+      getpid();
+    exit();
+  }
+  wait();
+  getrusage(RUSAGE_CHILDREN, &ru1);
+  if(ru1.ru_nsyscall < ru0.ru_nsyscall + 11){
+    printf(1, "getrusage children failed\n");
+    exit();
+  }
+
+  printf(1, "rusage test ok\n");
+}
+
+// readv and writev on files and pipes.
+void
+iovtest(void)
+{
+  struct iovec iov[3];
+  char a[5], b[10];
+  int fd, fds[2], n;
+
+  printf(1, "iov test\n");
+
+  iov[0].iov_base = "hello";
+  iov[0].iov_len = 5;
+  iov[1].iov_base = "";
+  iov[1].iov_len = 0;
+  iov[2].iov_base = " world!!!";
+  iov[2].iov_len = 9;
+  fd = open("iovfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "iov create failed\n");
+    exit();
+  }
+  if((n = writev(fd, iov, 3)) != 14){
+    printf(1, "iov writev returned %d\n", n);
+    exit();
+  }
+  close(fd);
+
+  fd = open("iovfile", O_RDONLY);
+  iov[0].iov_base = a;
+  iov[0].iov_len = sizeof(a);
+  iov[1].iov_base = b;
+  iov[1].iov_len = sizeof(b);
+  if((n = readv(fd, iov, 2)) != 14){
+    printf(1, "iov readv returned %d\n", n);
+    exit();
+  }
+  if(!bufeq(a, "hello", 5) || !bufeq(b, " world!!!", 9)){
+    printf(1, "iov readv wrong data\n");
+    exit();
+  }
+  close(fd);
+  unlink("iovfile");
+
+  if(pipe(fds) != 0){
+    printf(1, "iov pipe failed\n");
+    exit();
+  }
+  iov[0].iov_base = "abc";
+  iov[0].iov_len = 3;
+  iov[1].iov_base = "defg";
+  iov[1].iov_len = 4;
+  if(writev(fds[1], iov, 2) != 7){
+    printf(1, "iov pipe writev failed\n");
+    exit();
+  }
+  iov[0].iov_base = a;
+  iov[0].iov_len = 2;
+  iov[1].iov_base = b;
+  iov[1].iov_len = sizeof(b);
+  if((n = readv(fds[0], iov, 2)) != 7 || !bufeq(a, "ab", 2) ||
+     !bufeq(b, "cdefg", 5)){
+    printf(1, "iov pipe readv returned %d\n", n);
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+
+  iov[0].iov_base = (char*)0xffffff00;
+  iov[0].iov_len = 16;
+  if(writev(1, iov, 1) != -1){
+    printf(1, "iov writev of bad segment succeeded\n");
+    exit();
+  }
+
+  printf(1, "iov test ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -931,6 +1363,170 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// Enough entries to fill more than one full interior
+// index node with leaves, even if every leaf were full.
+#define NIXENT ((DXNODEENT+1) * (BSIZE/sizeof(struct dirent)) + 1)
+
+static void
+ixname(char *name, int i)
+{
+  name[0] = 'i';
+  name[1] = 'x';
+  name[2] = '/';
+  name[3] = '0' + (i / (64*64));
+  name[4] = '0' + (i / 64) % 64;
+  name[5] = '0' + (i % 64);
+  name[6] = '\0';
+}
+
+// directories that grow an index must still look up,
+// unlink, and become removable, after the root has moved
+// to an interior node and that node has split. The entries
+// are links to one file, so as not to run out of inodes.
+void
+indexdir(void)
+{
+  int i, fd;
+  char name[10], blk[BSIZE];
+  struct dxroot *root;
+
+  printf(1, "indexdir test\n");
+
+  if(mkdir("ix") != 0){
+    printf(1, "indexdir mkdir failed\n");
+    exit();
+  }
+  fd = open("ixf", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "indexdir create failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < NIXENT; i++){
+    ixname(name, i);
+    if(link("ixf", name) != 0){
+      printf(1, "indexdir link %s failed\n", name);
+      exit();
+    }
+  }
+
+  fd = open("ix", 0);
+  if(fd < 0 || read(fd, blk, BSIZE) != BSIZE){
+    printf(1, "indexdir read of dir failed\n");
+    exit();
+  }
+  close(fd);
+  root = (struct dxroot*)(blk + 2*sizeof(struct dirent));
+  if(root->h.magic != DXMAGIC || root->h.levels != 1 || root->h.count < 2){
+    printf(1, "indexdir index did not grow: levels %d count %d\n",
+           root->h.levels, root->h.count);
+    exit();
+  }
+
+  for(i = 0; i < NIXENT; i++){
+    ixname(name, i);
+    fd = open(name, 0);
+    if(fd < 0){
+      printf(1, "indexdir open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if(unlink("ix") == 0){
+    printf(1, "indexdir unlink of non-empty dir succeeded\n");
+    exit();
+  }
+  for(i = 0; i < NIXENT; i++){
+    ixname(name, i);
+    if(unlink(name) != 0){
+      printf(1, "indexdir unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("ix") != 0){
+    printf(1, "indexdir unlink of empty dir failed\n");
+    exit();
+  }
+  unlink("ixf");
+
+  printf(1, "indexdir ok\n");
+}
+
+// filling an indexed directory must make creating in it
+// fail, not panic, and give back the new inode each time.
+// Links spread over four files keep nlink from overflowing.
+void
+fulldir(void)
+{
+  int i, n, fd;
+  char name[10], file[5];
+
+  printf(1, "fulldir test\n");
+
+  if(mkdir("ix") != 0){
+    printf(1, "fulldir mkdir failed\n");
+    exit();
+  }
+  strcpy(file, "ixf0");
+  for(i = 0; i < 4; i++){
+    file[3] = '0' + i;
+    fd = open(file, O_CREATE|O_RDWR);
+    if(fd < 0){
+      printf(1, "fulldir create failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  for(n = 0; n < 64*64*64; n++){
+    ixname(name, n);
+    file[3] = '0' + n%4;
+    if(link(file, name) != 0)
+      break;
+  }
+  if(n == 64*64*64){
+    printf(1, "fulldir directory never filled\n");
+    exit();
+  }
+
+  // name belongs in a leaf that cannot split; more tries
+  // than there are inodes show that none are leaked.
+  for(i = 0; i < 250; i++){
+    if(open(name, O_CREATE|O_RDWR) >= 0){
+      printf(1, "fulldir create in full dir succeeded\n");
+      exit();
+    }
+  }
+  if(mkdir(name) == 0 || mknod(name, 1, 1) == 0){
+    printf(1, "fulldir mkdir/mknod in full dir succeeded\n");
+    exit();
+  }
+  fd = open("ixf4", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "fulldir create after full dir failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("ixf4");
+
+  for(i = 0; i < n; i++){
+    ixname(name, i);
+    if(unlink(name) != 0){
+      printf(1, "fulldir unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("ix") != 0){
+    printf(1, "fulldir unlink of empty dir failed\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    file[3] = '0' + i;
+    unlink(file);
+  }
+
+  printf(1, "fulldir ok (%d entries)\n", n);
+}
+
 void
 subdir(void)
 {
@@ -1773,6 +2369,7 @@ main(int argc, char *argv[])
   opentest();
   writetest();
   writetest1();
+  mapread();
   createtest();
 
   openiputtest();
@@ -1781,6 +2378,11 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  iovtest();
+  stdiotest();
+  nanosleeptest();
+  schedtest();
+  rusagetest();
   preempt();
   exitwait();
 
@@ -1794,6 +2396,8 @@ main(int argc, char *argv[])
   iref();
   forktest();
   bigdir(); // slow
+  indexdir();
+  fulldir(); // slow
 
   uio();
 
@@ -329,6 +329,8 @@ copyuvm(pde_t *pgdir, uint sz)
       panic("copyuvm: page not present");
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
+    if(flags & PTE_COW)  // the child's copy is its own
+      flags = (flags & ~PTE_COW) | PTE_W;
     if((mem = kalloc()) == 0)
       goto bad;
     memmove(mem, (char*)P2V(pa), PGSIZE);
@@ -344,6 +346,59 @@ bad:
   return 0;
 }
 
+// Map the page at kernel address ka at the page-aligned user
+// address uva, read-only and copy-on-write, in place of the
+// page there, which must be writable user memory. The mapping
+// takes over the caller's reference to ka. Used by zero-copy
+// reads, so pgdir is the current page table.
+// Returns -1 if uva cannot be written.
+int
+mapcow(pde_t *pgdir, char *uva, char *ka)
+{
+  pte_t *pte;
+  char *old;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) ||
+     (*pte & (PTE_W|PTE_COW)) == 0)
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  *pte = V2P(ka) | PTE_P | PTE_U | PTE_COW;
+  invlpg(uva);
+  kfree(old);
+  return 0;
+}
+
+// Handle a write fault at user address va in pgdir, the current
+// page table, by the process or by the kernel on its behalf.
+// A copy-on-write page gets copied unless nothing else refers
+// to it any more. Returns -1 if va is not copy-on-write or
+// there is no memory for the copy.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *old, *mem;
+
+  if(va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  if(krefs(old) > 1){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    kfree(old);
+  } else {
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  }
+  invlpg((char*)PGROUNDDOWN(va));
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -0,0 +1,2177 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 b5 03 00 00       	call   3fe <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 b9 03 00 00       	call   416 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 fb 0f 00 00       	push   $0xffb
+  6e:	6a 01                	push   $0x1
+  70:	e8 5b 0d 00 00       	call   dd0 <printf>
+      exit();
+  75:	e8 46 03 00 00       	call   3c0 <exit>
+  }
+  exit();
+  7a:	e8 41 03 00 00       	call   3c0 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 ed 0f 00 00       	push   $0xfed
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 2e 03 00 00       	call   3c0 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 60 15 00 00       	push   $0x1560
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 19 03 00 00       	call   3ee <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 60 15 00 00 	movsbl 0x1560(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 d8 0f 00 00       	push   $0xfd8
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 ee 0f 00 00       	push   $0xfee
+ 155:	6a 01                	push   $0x1
+ 157:	e8 74 0c 00 00       	call   dd0 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 de 0f 00 00       	push   $0xfde
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 5b 0c 00 00       	call   dd0 <printf>
+    exit();
+ 175:	e8 46 02 00 00       	call   3c0 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 31 01 00 00       	call   3ee <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 04 01 00 00       	call   416 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 07 01 00 00       	call   42e <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 cd 00 00 00       	call   3fe <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 3c6:	a1 60 17 00 00       	mov    0x1760,%eax
+ 3cb:	85 c0                	test   %eax,%eax
+ 3cd:	74 02                	je     3d1 <exit+0x11>
+    exithook();
+ 3cf:	ff d0                	call   *%eax
+  _exit();
+ 3d1:	e8 10 01 00 00       	call   4e6 <_exit>
+
+000003d6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3d6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <wait>:
+SYSCALL(wait)
+ 3de:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <pipe>:
+SYSCALL(pipe)
+ 3e6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <read>:
+SYSCALL(read)
+ 3ee:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <write>:
+SYSCALL(write)
+ 3f6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <close>:
+SYSCALL(close)
+ 3fe:	b8 15 00 00 00       	mov    $0x15,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <kill>:
+SYSCALL(kill)
+ 406:	b8 06 00 00 00       	mov    $0x6,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <exec>:
+SYSCALL(exec)
+ 40e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <open>:
+SYSCALL(open)
+ 416:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <mknod>:
+SYSCALL(mknod)
+ 41e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <unlink>:
+SYSCALL(unlink)
+ 426:	b8 12 00 00 00       	mov    $0x12,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <fstat>:
+SYSCALL(fstat)
+ 42e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <link>:
+SYSCALL(link)
+ 436:	b8 13 00 00 00       	mov    $0x13,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <mkdir>:
+SYSCALL(mkdir)
+ 43e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <chdir>:
+SYSCALL(chdir)
+ 446:	b8 09 00 00 00       	mov    $0x9,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <dup>:
+SYSCALL(dup)
+ 44e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <getpid>:
+SYSCALL(getpid)
+ 456:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <sbrk>:
+SYSCALL(sbrk)
+ 45e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <sleep>:
+SYSCALL(sleep)
+ 466:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <uptime>:
+SYSCALL(uptime)
+ 46e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 476:	b8 16 00 00 00       	mov    $0x16,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <sigaction>:
+SYSCALL(sigaction)
+ 47e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <sigret>:
+SYSCALL(sigret)
+ 486:	b8 18 00 00 00       	mov    $0x18,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <readv>:
+SYSCALL(readv)
+ 48e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <writev>:
+SYSCALL(writev)
+ 496:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <nanosleep>:
+SYSCALL(nanosleep)
+ 49e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <setpriority>:
+SYSCALL(setpriority)
+ 4a6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <sched_setattr>:
+SYSCALL(sched_setattr)
+ 4ae:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <sched_yield>:
+SYSCALL(sched_yield)
+ 4b6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4be:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4c6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <getrusage>:
+SYSCALL(getrusage)
+ 4ce:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <syslat>:
+SYSCALL(syslat)
+ 4d6:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <sched_getattr>:
+SYSCALL(sched_getattr)
+ 4de:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 4e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 4eb:	cd 40                	int    $0x40
+  ret
+ 4ed:	c3                   	ret
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 4f5:	31 db                	xor    %ebx,%ebx
+ 4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fe:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 500:	8b 34 9d 80 17 00 00 	mov    0x1780(,%ebx,4),%esi
+ 507:	85 f6                	test   %esi,%esi
+ 509:	74 27                	je     532 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 50b:	8b 46 08             	mov    0x8(%esi),%eax
+ 50e:	85 c0                	test   %eax,%eax
+ 510:	7e 12                	jle    524 <flushall+0x34>
+ 512:	83 ec 04             	sub    $0x4,%esp
+ 515:	50                   	push   %eax
+ 516:	8d 46 10             	lea    0x10(%esi),%eax
+ 519:	50                   	push   %eax
+ 51a:	ff 36                	push   (%esi)
+ 51c:	e8 d5 fe ff ff       	call   3f6 <write>
+ 521:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 524:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 52b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 532:	83 c3 01             	add    $0x1,%ebx
+ 535:	83 fb 10             	cmp    $0x10,%ebx
+ 538:	75 c6                	jne    500 <flushall+0x10>
+}
+ 53a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 53d:	5b                   	pop    %ebx
+ 53e:	5e                   	pop    %esi
+ 53f:	5d                   	pop    %ebp
+ 540:	c3                   	ret
+ 541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 2c             	sub    $0x2c,%esp
+ 55d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 c8 00 00 00    	jns    630 <printint+0xe0>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	0f 84 be 00 00 00    	je     630 <printint+0xe0>
+    x = -xx;
+ 572:	f7 d9                	neg    %ecx
+    neg = 1;
+ 574:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 579:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 57c:	31 f6                	xor    %esi,%esi
+ 57e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 70 10 00 00 	movzbl 0x1070(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 5ac:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 5af:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5b2:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 5b4:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 5b7:	8b 41 08             	mov    0x8(%ecx),%eax
+ 5ba:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5bd:	89 ce                	mov    %ecx,%esi
+ 5bf:	eb 28                	jmp    5e9 <printint+0x99>
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	83 c0 01             	add    $0x1,%eax
+ 5cd:	89 46 08             	mov    %eax,0x8(%esi)
+ 5d0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 5d4:	80 fa 0a             	cmp    $0xa,%dl
+ 5d7:	75 07                	jne    5e0 <printint+0x90>
+    f->nl = 1;
+ 5d9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 5e0:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 5e3:	39 fb                	cmp    %edi,%ebx
+ 5e5:	74 39                	je     620 <printint+0xd0>
+ 5e7:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 5e9:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 5ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5f1:	75 d5                	jne    5c8 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 5f3:	83 ec 04             	sub    $0x4,%esp
+ 5f6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 5f9:	68 00 02 00 00       	push   $0x200
+ 5fe:	ff 75 d0             	push   -0x30(%ebp)
+ 601:	ff 36                	push   (%esi)
+ 603:	e8 ee fd ff ff       	call   3f6 <write>
+  return r;
+ 608:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 60c:	83 c4 10             	add    $0x10,%esp
+ 60f:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 611:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 618:	b8 01 00 00 00       	mov    $0x1,%eax
+ 61d:	eb ae                	jmp    5cd <printint+0x7d>
+ 61f:	90                   	nop
+}
+ 620:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 623:	5b                   	pop    %ebx
+ 624:	5e                   	pop    %esi
+ 625:	5f                   	pop    %edi
+ 626:	5d                   	pop    %ebp
+ 627:	c3                   	ret
+ 628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+  neg = 0;
+ 630:	31 c0                	xor    %eax,%eax
+ 632:	e9 42 ff ff ff       	jmp    579 <printint+0x29>
+ 637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <bputc>:
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	53                   	push   %ebx
+ 644:	89 c3                	mov    %eax,%ebx
+ 646:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 649:	8b 40 08             	mov    0x8(%eax),%eax
+ 64c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 651:	74 1d                	je     670 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 653:	8d 48 01             	lea    0x1(%eax),%ecx
+ 656:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 659:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 65d:	80 fa 0a             	cmp    $0xa,%dl
+ 660:	75 07                	jne    669 <bputc+0x29>
+    f->nl = 1;
+ 662:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 669:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 66c:	c9                   	leave
+ 66d:	c3                   	ret
+ 66e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	8d 43 10             	lea    0x10(%ebx),%eax
+ 676:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 679:	68 00 02 00 00       	push   $0x200
+ 67e:	50                   	push   %eax
+ 67f:	ff 33                	push   (%ebx)
+ 681:	e8 70 fd ff ff       	call   3f6 <write>
+  return r;
+ 686:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 689:	83 c4 10             	add    $0x10,%esp
+ 68c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 691:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 698:	31 c0                	xor    %eax,%eax
+ 69a:	eb ba                	jmp    656 <bputc+0x16>
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 1c             	sub    $0x1c,%esp
+ 6a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 6ac:	0f b6 0a             	movzbl (%edx),%ecx
+ 6af:	84 c9                	test   %cl,%cl
+ 6b1:	74 47                	je     6fa <vfprintf+0x5a>
+ 6b3:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 6b6:	89 c7                	mov    %eax,%edi
+ 6b8:	31 d2                	xor    %edx,%edx
+ 6ba:	89 de                	mov    %ebx,%esi
+ 6bc:	89 cb                	mov    %ecx,%ebx
+ 6be:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 6c0:	0f be cb             	movsbl %bl,%ecx
+ 6c3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6c6:	85 d2                	test   %edx,%edx
+ 6c8:	75 4e                	jne    718 <vfprintf+0x78>
+      if(c == '%'){
+ 6ca:	83 f8 25             	cmp    $0x25,%eax
+ 6cd:	74 69                	je     738 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 6cf:	8b 47 08             	mov    0x8(%edi),%eax
+ 6d2:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6d7:	0f 84 73 01 00 00    	je     850 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 6dd:	8d 48 01             	lea    0x1(%eax),%ecx
+ 6e0:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 6e3:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 6e7:	80 fb 0a             	cmp    $0xa,%bl
+ 6ea:	74 1c                	je     708 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 6ec:	31 d2                	xor    %edx,%edx
+ 6ee:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 6f0:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f3:	83 c6 01             	add    $0x1,%esi
+ 6f6:	84 db                	test   %bl,%bl
+ 6f8:	75 c6                	jne    6c0 <vfprintf+0x20>
+    }
+  }
+}
+ 6fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fd:	5b                   	pop    %ebx
+ 6fe:	5e                   	pop    %esi
+ 6ff:	5f                   	pop    %edi
+ 700:	5d                   	pop    %ebp
+ 701:	c3                   	ret
+ 702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 708:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 70f:	eb df                	jmp    6f0 <vfprintf+0x50>
+ 711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 718:	83 fa 25             	cmp    $0x25,%edx
+ 71b:	75 d3                	jne    6f0 <vfprintf+0x50>
+      if(c == 'd'){
+ 71d:	83 f8 25             	cmp    $0x25,%eax
+ 720:	74 37                	je     759 <vfprintf+0xb9>
+ 722:	83 e8 63             	sub    $0x63,%eax
+ 725:	83 f8 15             	cmp    $0x15,%eax
+ 728:	77 16                	ja     740 <vfprintf+0xa0>
+ 72a:	ff 24 85 18 10 00 00 	jmp    *0x1018(,%eax,4)
+ 731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 738:	ba 25 00 00 00       	mov    $0x25,%edx
+ 73d:	eb b1                	jmp    6f0 <vfprintf+0x50>
+ 73f:	90                   	nop
+  if(f->n == BUFSIZ)
+ 740:	8b 47 08             	mov    0x8(%edi),%eax
+ 743:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 748:	0f 84 4c 01 00 00    	je     89a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 74e:	8d 50 01             	lea    0x1(%eax),%edx
+ 751:	89 57 08             	mov    %edx,0x8(%edi)
+ 754:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 759:	89 ca                	mov    %ecx,%edx
+ 75b:	89 f8                	mov    %edi,%eax
+ 75d:	e8 de fe ff ff       	call   640 <bputc>
+ 762:	eb 88                	jmp    6ec <vfprintf+0x4c>
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 768:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 76b:	83 ec 0c             	sub    $0xc,%esp
+ 76e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 773:	8b 13                	mov    (%ebx),%edx
+ 775:	6a 00                	push   $0x0
+ 777:	89 f8                	mov    %edi,%eax
+        ap++;
+ 779:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 77c:	e8 cf fd ff ff       	call   550 <printint>
+        ap++;
+ 781:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 784:	83 c4 10             	add    $0x10,%esp
+ 787:	e9 60 ff ff ff       	jmp    6ec <vfprintf+0x4c>
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 790:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 793:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 795:	83 c0 04             	add    $0x4,%eax
+ 798:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 79b:	85 d2                	test   %edx,%edx
+ 79d:	0f 84 dd 00 00 00    	je     880 <vfprintf+0x1e0>
+        while(*s != 0){
+ 7a3:	0f b6 1a             	movzbl (%edx),%ebx
+ 7a6:	84 db                	test   %bl,%bl
+ 7a8:	0f 84 3e ff ff ff    	je     6ec <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 7ae:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 7b1:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 7b4:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 7b7:	89 fe                	mov    %edi,%esi
+ 7b9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 7bc:	89 d7                	mov    %edx,%edi
+ 7be:	eb 27                	jmp    7e7 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 7c0:	89 c1                	mov    %eax,%ecx
+ 7c2:	83 c0 01             	add    $0x1,%eax
+ 7c5:	89 46 08             	mov    %eax,0x8(%esi)
+ 7c8:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 7cc:	80 fb 0a             	cmp    $0xa,%bl
+ 7cf:	75 07                	jne    7d8 <vfprintf+0x138>
+    f->nl = 1;
+ 7d1:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 7d8:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 7dc:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 7df:	84 db                	test   %bl,%bl
+ 7e1:	0f 84 a9 00 00 00    	je     890 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 7e7:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 7ec:	75 d2                	jne    7c0 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 7ee:	83 ec 04             	sub    $0x4,%esp
+ 7f1:	68 00 02 00 00       	push   $0x200
+ 7f6:	ff 75 e0             	push   -0x20(%ebp)
+ 7f9:	ff 36                	push   (%esi)
+ 7fb:	e8 f6 fb ff ff       	call   3f6 <write>
+  return r;
+ 800:	83 c4 10             	add    $0x10,%esp
+ 803:	b8 01 00 00 00       	mov    $0x1,%eax
+ 808:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 80a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 811:	eb b2                	jmp    7c5 <vfprintf+0x125>
+ 813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 817:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 818:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 81b:	83 ec 0c             	sub    $0xc,%esp
+ 81e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 823:	8b 13                	mov    (%ebx),%edx
+ 825:	6a 01                	push   $0x1
+ 827:	e9 4b ff ff ff       	jmp    777 <vfprintf+0xd7>
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 830:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 833:	89 f8                	mov    %edi,%eax
+ 835:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 838:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 83b:	e8 00 fe ff ff       	call   640 <bputc>
+        ap++;
+ 840:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 843:	31 d2                	xor    %edx,%edx
+ 845:	e9 a6 fe ff ff       	jmp    6f0 <vfprintf+0x50>
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 47 10             	lea    0x10(%edi),%eax
+ 856:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 859:	68 00 02 00 00       	push   $0x200
+ 85e:	50                   	push   %eax
+ 85f:	ff 37                	push   (%edi)
+ 861:	e8 90 fb ff ff       	call   3f6 <write>
+  return r;
+ 866:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 86e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 875:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 87a:	e9 61 fe ff ff       	jmp    6e0 <vfprintf+0x40>
+ 87f:	90                   	nop
+          s = "(null)";
+ 880:	ba 0f 10 00 00       	mov    $0x100f,%edx
+ 885:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 88a:	e9 1f ff ff ff       	jmp    7ae <vfprintf+0x10e>
+ 88f:	90                   	nop
+ 890:	89 f7                	mov    %esi,%edi
+ 892:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 895:	e9 52 fe ff ff       	jmp    6ec <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 89a:	83 ec 04             	sub    $0x4,%esp
+ 89d:	8d 47 10             	lea    0x10(%edi),%eax
+ 8a0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 8a3:	68 00 02 00 00       	push   $0x200
+ 8a8:	50                   	push   %eax
+ 8a9:	ff 37                	push   (%edi)
+ 8ab:	e8 46 fb ff ff       	call   3f6 <write>
+  return r;
+ 8b0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 8b3:	83 c4 10             	add    $0x10,%esp
+ 8b6:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 8bb:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 8c2:	31 c0                	xor    %eax,%eax
+ 8c4:	e9 88 fe ff ff       	jmp    751 <vfprintf+0xb1>
+ 8c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <fdopen>:
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	56                   	push   %esi
+ 8d4:	53                   	push   %ebx
+ 8d5:	83 ec 20             	sub    $0x20,%esp
+ 8d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 8db:	83 fe 0f             	cmp    $0xf,%esi
+ 8de:	0f 87 84 00 00 00    	ja     968 <fdopen+0x98>
+  if(streams[fd])
+ 8e4:	8b 1c b5 80 17 00 00 	mov    0x1780(,%esi,4),%ebx
+ 8eb:	85 db                	test   %ebx,%ebx
+ 8ed:	74 11                	je     900 <fdopen+0x30>
+}
+ 8ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8f2:	89 d8                	mov    %ebx,%eax
+ 8f4:	5b                   	pop    %ebx
+ 8f5:	5e                   	pop    %esi
+ 8f6:	5d                   	pop    %ebp
+ 8f7:	c3                   	ret
+ 8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 900:	83 ec 0c             	sub    $0xc,%esp
+ 903:	68 10 02 00 00       	push   $0x210
+ 908:	e8 e3 05 00 00       	call   ef0 <malloc>
+ 90d:	83 c4 10             	add    $0x10,%esp
+ 910:	89 c3                	mov    %eax,%ebx
+ 912:	85 c0                	test   %eax,%eax
+ 914:	74 52                	je     968 <fdopen+0x98>
+  f->fd = fd;
+ 916:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 918:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 91b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 922:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 929:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 930:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 933:	50                   	push   %eax
+ 934:	56                   	push   %esi
+ 935:	e8 f4 fa ff ff       	call   42e <fstat>
+ 93a:	83 c4 10             	add    $0x10,%esp
+ 93d:	85 c0                	test   %eax,%eax
+ 93f:	75 07                	jne    948 <fdopen+0x78>
+ 941:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 946:	74 30                	je     978 <fdopen+0xa8>
+  streams[fd] = f;
+ 948:	89 1c b5 80 17 00 00 	mov    %ebx,0x1780(,%esi,4)
+}
+ 94f:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 951:	c7 05 60 17 00 00 f0 	movl   $0x4f0,0x1760
+ 958:	04 00 00 
+}
+ 95b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 95e:	5b                   	pop    %ebx
+ 95f:	5e                   	pop    %esi
+ 960:	5d                   	pop    %ebp
+ 961:	c3                   	ret
+ 962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 968:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 96b:	31 db                	xor    %ebx,%ebx
+}
+ 96d:	89 d8                	mov    %ebx,%eax
+ 96f:	5b                   	pop    %ebx
+ 970:	5e                   	pop    %esi
+ 971:	5d                   	pop    %ebp
+ 972:	c3                   	ret
+ 973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 977:	90                   	nop
+    f->mode = _IOLBF;
+ 978:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 97f:	eb c7                	jmp    948 <fdopen+0x78>
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+
+00000990 <fopen>:
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	53                   	push   %ebx
+ 994:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 997:	ff 75 0c             	push   0xc(%ebp)
+ 99a:	ff 75 08             	push   0x8(%ebp)
+ 99d:	e8 74 fa ff ff       	call   416 <open>
+ 9a2:	83 c4 10             	add    $0x10,%esp
+ 9a5:	85 c0                	test   %eax,%eax
+ 9a7:	78 37                	js     9e0 <fopen+0x50>
+ 9a9:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 9ab:	8b 04 85 80 17 00 00 	mov    0x1780(,%eax,4),%eax
+ 9b2:	85 c0                	test   %eax,%eax
+ 9b4:	74 17                	je     9cd <fopen+0x3d>
+    free(streams[fd]);
+ 9b6:	83 ec 0c             	sub    $0xc,%esp
+ 9b9:	50                   	push   %eax
+ 9ba:	e8 a1 04 00 00       	call   e60 <free>
+    streams[fd] = 0;
+ 9bf:	83 c4 10             	add    $0x10,%esp
+ 9c2:	c7 04 9d 80 17 00 00 	movl   $0x0,0x1780(,%ebx,4)
+ 9c9:	00 00 00 00 
+  return fdopen(fd);
+ 9cd:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 9d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 9d3:	c9                   	leave
+  return fdopen(fd);
+ 9d4:	e9 f7 fe ff ff       	jmp    8d0 <fdopen>
+ 9d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 9e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 9e3:	31 c0                	xor    %eax,%eax
+ 9e5:	c9                   	leave
+ 9e6:	c3                   	ret
+ 9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <setvbuf>:
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	56                   	push   %esi
+ 9f4:	53                   	push   %ebx
+ 9f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 9f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 9fb:	83 fe 02             	cmp    $0x2,%esi
+ 9fe:	77 38                	ja     a38 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a00:	8b 43 08             	mov    0x8(%ebx),%eax
+ a03:	85 c0                	test   %eax,%eax
+ a05:	7e 12                	jle    a19 <setvbuf+0x29>
+ a07:	83 ec 04             	sub    $0x4,%esp
+ a0a:	50                   	push   %eax
+ a0b:	8d 43 10             	lea    0x10(%ebx),%eax
+ a0e:	50                   	push   %eax
+ a0f:	ff 33                	push   (%ebx)
+ a11:	e8 e0 f9 ff ff       	call   3f6 <write>
+ a16:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ a19:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ a20:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ a22:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ a29:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ a2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a2f:	5b                   	pop    %ebx
+ a30:	5e                   	pop    %esi
+ a31:	5d                   	pop    %ebp
+ a32:	c3                   	ret
+ a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a37:	90                   	nop
+    return -1;
+ a38:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a3d:	eb ed                	jmp    a2c <setvbuf+0x3c>
+ a3f:	90                   	nop
+
+00000a40 <fflush>:
+{
+ a40:	55                   	push   %ebp
+ a41:	31 c0                	xor    %eax,%eax
+ a43:	89 e5                	mov    %esp,%ebp
+ a45:	53                   	push   %ebx
+ a46:	83 ec 04             	sub    $0x4,%esp
+ a49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a4c:	8b 53 08             	mov    0x8(%ebx),%edx
+ a4f:	85 d2                	test   %edx,%edx
+ a51:	7e 1d                	jle    a70 <fflush+0x30>
+ a53:	83 ec 04             	sub    $0x4,%esp
+ a56:	8d 43 10             	lea    0x10(%ebx),%eax
+ a59:	52                   	push   %edx
+ a5a:	50                   	push   %eax
+ a5b:	ff 33                	push   (%ebx)
+ a5d:	e8 94 f9 ff ff       	call   3f6 <write>
+ a62:	83 c4 10             	add    $0x10,%esp
+ a65:	39 43 08             	cmp    %eax,0x8(%ebx)
+ a68:	0f 95 c0             	setne  %al
+ a6b:	0f b6 c0             	movzbl %al,%eax
+ a6e:	f7 d8                	neg    %eax
+  f->n = 0;
+ a70:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a77:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a81:	c9                   	leave
+ a82:	c3                   	ret
+ a83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a90 <fclose>:
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	56                   	push   %esi
+ a94:	31 f6                	xor    %esi,%esi
+ a96:	53                   	push   %ebx
+ a97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a9a:	8b 43 08             	mov    0x8(%ebx),%eax
+ a9d:	85 c0                	test   %eax,%eax
+ a9f:	7e 1f                	jle    ac0 <fclose+0x30>
+ aa1:	83 ec 04             	sub    $0x4,%esp
+ aa4:	50                   	push   %eax
+ aa5:	8d 43 10             	lea    0x10(%ebx),%eax
+ aa8:	50                   	push   %eax
+ aa9:	ff 33                	push   (%ebx)
+ aab:	e8 46 f9 ff ff       	call   3f6 <write>
+ ab0:	83 c4 10             	add    $0x10,%esp
+ ab3:	39 43 08             	cmp    %eax,0x8(%ebx)
+ ab6:	0f 95 c0             	setne  %al
+ ab9:	0f b6 c0             	movzbl %al,%eax
+ abc:	f7 d8                	neg    %eax
+ abe:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ ac0:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ ac3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ aca:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ ad1:	ff 33                	push   (%ebx)
+ ad3:	e8 26 f9 ff ff       	call   3fe <close>
+ ad8:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ adb:	85 c0                	test   %eax,%eax
+ add:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ae2:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ ae5:	8b 03                	mov    (%ebx),%eax
+ ae7:	83 f8 0f             	cmp    $0xf,%eax
+ aea:	77 09                	ja     af5 <fclose+0x65>
+ aec:	39 1c 85 80 17 00 00 	cmp    %ebx,0x1780(,%eax,4)
+ af3:	74 0b                	je     b00 <fclose+0x70>
+}
+ af5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ af8:	89 f0                	mov    %esi,%eax
+ afa:	5b                   	pop    %ebx
+ afb:	5e                   	pop    %esi
+ afc:	5d                   	pop    %ebp
+ afd:	c3                   	ret
+ afe:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ b00:	c7 04 85 80 17 00 00 	movl   $0x0,0x1780(,%eax,4)
+ b07:	00 00 00 00 
+    free(f);
+ b0b:	83 ec 0c             	sub    $0xc,%esp
+ b0e:	53                   	push   %ebx
+ b0f:	e8 4c 03 00 00       	call   e60 <free>
+ b14:	83 c4 10             	add    $0x10,%esp
+  return r;
+ b17:	eb dc                	jmp    af5 <fclose+0x65>
+ b19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <fputc>:
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	53                   	push   %ebx
+ b24:	83 ec 04             	sub    $0x4,%esp
+ b27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ b2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ b2d:	8b 43 08             	mov    0x8(%ebx),%eax
+ b30:	3d 00 02 00 00       	cmp    $0x200,%eax
+ b35:	74 59                	je     b90 <fputc+0x70>
+  f->buf[f->n++] = c;
+ b37:	8d 48 01             	lea    0x1(%eax),%ecx
+ b3a:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ b3d:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ b41:	80 fa 0a             	cmp    $0xa,%dl
+ b44:	75 07                	jne    b4d <fputc+0x2d>
+    f->nl = 1;
+ b46:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b4d:	8b 43 04             	mov    0x4(%ebx),%eax
+ b50:	83 f8 02             	cmp    $0x2,%eax
+ b53:	74 1a                	je     b6f <fputc+0x4f>
+ b55:	83 f8 01             	cmp    $0x1,%eax
+ b58:	74 0e                	je     b68 <fputc+0x48>
+}
+ b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ b5d:	0f b6 c2             	movzbl %dl,%eax
+}
+ b60:	c9                   	leave
+ b61:	c3                   	ret
+ b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b68:	8b 43 0c             	mov    0xc(%ebx),%eax
+ b6b:	85 c0                	test   %eax,%eax
+ b6d:	74 eb                	je     b5a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b6f:	85 c9                	test   %ecx,%ecx
+ b71:	7f 4d                	jg     bc0 <fputc+0xa0>
+  f->n = 0;
+ b73:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ b7a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ b81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ b84:	0f b6 c2             	movzbl %dl,%eax
+}
+ b87:	c9                   	leave
+ b88:	c3                   	ret
+ b89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b90:	83 ec 04             	sub    $0x4,%esp
+ b93:	8d 43 10             	lea    0x10(%ebx),%eax
+ b96:	89 55 08             	mov    %edx,0x8(%ebp)
+ b99:	68 00 02 00 00       	push   $0x200
+ b9e:	50                   	push   %eax
+ b9f:	ff 33                	push   (%ebx)
+ ba1:	e8 50 f8 ff ff       	call   3f6 <write>
+  return r;
+ ba6:	8b 55 08             	mov    0x8(%ebp),%edx
+ ba9:	83 c4 10             	add    $0x10,%esp
+ bac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ bb1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ bb8:	31 c0                	xor    %eax,%eax
+ bba:	e9 7b ff ff ff       	jmp    b3a <fputc+0x1a>
+ bbf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	8d 43 10             	lea    0x10(%ebx),%eax
+ bc6:	89 55 08             	mov    %edx,0x8(%ebp)
+ bc9:	51                   	push   %ecx
+ bca:	50                   	push   %eax
+ bcb:	ff 33                	push   (%ebx)
+ bcd:	e8 24 f8 ff ff       	call   3f6 <write>
+  f->n = 0;
+ bd2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ bd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ bdc:	83 c4 10             	add    $0x10,%esp
+ bdf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ be6:	eb 99                	jmp    b81 <fputc+0x61>
+ be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+
+00000bf0 <fwrite>:
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	57                   	push   %edi
+ bf4:	56                   	push   %esi
+ bf5:	53                   	push   %ebx
+ bf6:	83 ec 1c             	sub    $0x1c,%esp
+ bf9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ bfc:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ bff:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ c02:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ c05:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ c0b:	0f 8f af 00 00 00    	jg     cc0 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ c11:	85 ff                	test   %edi,%edi
+ c13:	7e 73                	jle    c88 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c15:	8d 56 10             	lea    0x10(%esi),%edx
+ c18:	8b 46 08             	mov    0x8(%esi),%eax
+ c1b:	31 db                	xor    %ebx,%ebx
+ c1d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ c20:	eb 25                	jmp    c47 <fwrite+0x57>
+ c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ c28:	89 c1                	mov    %eax,%ecx
+ c2a:	83 c0 01             	add    $0x1,%eax
+ c2d:	89 46 08             	mov    %eax,0x8(%esi)
+ c30:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ c34:	80 fa 0a             	cmp    $0xa,%dl
+ c37:	75 07                	jne    c40 <fwrite+0x50>
+    f->nl = 1;
+ c39:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ c40:	83 c3 01             	add    $0x1,%ebx
+ c43:	39 df                	cmp    %ebx,%edi
+ c45:	7e 41                	jle    c88 <fwrite+0x98>
+    bputc(f, s[i]);
+ c47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ c4a:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ c4e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ c53:	75 d3                	jne    c28 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c55:	83 ec 04             	sub    $0x4,%esp
+ c58:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ c5b:	68 00 02 00 00       	push   $0x200
+ c60:	ff 75 e0             	push   -0x20(%ebp)
+ c63:	ff 36                	push   (%esi)
+ c65:	e8 8c f7 ff ff       	call   3f6 <write>
+  return r;
+ c6a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ c6e:	83 c4 10             	add    $0x10,%esp
+ c71:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ c73:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ c7a:	b8 01 00 00 00       	mov    $0x1,%eax
+ c7f:	eb ac                	jmp    c2d <fwrite+0x3d>
+ c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c88:	8b 46 04             	mov    0x4(%esi),%eax
+ c8b:	83 f8 02             	cmp    $0x2,%eax
+ c8e:	74 0c                	je     c9c <fwrite+0xac>
+ c90:	83 f8 01             	cmp    $0x1,%eax
+ c93:	75 1c                	jne    cb1 <fwrite+0xc1>
+ c95:	8b 46 0c             	mov    0xc(%esi),%eax
+ c98:	85 c0                	test   %eax,%eax
+ c9a:	74 15                	je     cb1 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c9c:	8b 46 08             	mov    0x8(%esi),%eax
+ c9f:	85 c0                	test   %eax,%eax
+ ca1:	7f 5d                	jg     d00 <fwrite+0x110>
+  f->n = 0;
+ ca3:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ caa:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ cb1:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cb7:	5b                   	pop    %ebx
+ cb8:	5e                   	pop    %esi
+ cb9:	5f                   	pop    %edi
+ cba:	5d                   	pop    %ebp
+ cbb:	c3                   	ret
+ cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ cc0:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ cc4:	0f 84 4b ff ff ff    	je     c15 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ cca:	8b 46 08             	mov    0x8(%esi),%eax
+ ccd:	8b 16                	mov    (%esi),%edx
+ ccf:	85 c0                	test   %eax,%eax
+ cd1:	7f 45                	jg     d18 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ cd3:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ cd6:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ cdd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ ce4:	57                   	push   %edi
+ ce5:	ff 75 08             	push   0x8(%ebp)
+ ce8:	ff 36                	push   (%esi)
+ cea:	e8 07 f7 ff ff       	call   3f6 <write>
+    return size > 0 ? i / size : 0;
+ cef:	83 c4 10             	add    $0x10,%esp
+ cf2:	85 c0                	test   %eax,%eax
+ cf4:	78 4a                	js     d40 <fwrite+0x150>
+ cf6:	85 db                	test   %ebx,%ebx
+ cf8:	7e 46                	jle    d40 <fwrite+0x150>
+ cfa:	99                   	cltd
+ cfb:	f7 fb                	idiv   %ebx
+ cfd:	eb b5                	jmp    cb4 <fwrite+0xc4>
+ cff:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d00:	83 ec 04             	sub    $0x4,%esp
+ d03:	50                   	push   %eax
+ d04:	8d 46 10             	lea    0x10(%esi),%eax
+ d07:	50                   	push   %eax
+ d08:	ff 36                	push   (%esi)
+ d0a:	e8 e7 f6 ff ff       	call   3f6 <write>
+ d0f:	83 c4 10             	add    $0x10,%esp
+ d12:	eb 8f                	jmp    ca3 <fwrite+0xb3>
+ d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d18:	83 ec 04             	sub    $0x4,%esp
+ d1b:	50                   	push   %eax
+ d1c:	8d 46 10             	lea    0x10(%esi),%eax
+ d1f:	50                   	push   %eax
+ d20:	52                   	push   %edx
+ d21:	e8 d0 f6 ff ff       	call   3f6 <write>
+ d26:	83 c4 10             	add    $0x10,%esp
+ d29:	3b 46 08             	cmp    0x8(%esi),%eax
+ d2c:	74 a5                	je     cd3 <fwrite+0xe3>
+  f->n = 0;
+ d2e:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ d35:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ d40:	31 c0                	xor    %eax,%eax
+ d42:	e9 6d ff ff ff       	jmp    cb4 <fwrite+0xc4>
+ d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4e:	66 90                	xchg   %ax,%ax
+
+00000d50 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ d54:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ d57:	83 ec 04             	sub    $0x4,%esp
+ d5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ d5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d60:	89 d8                	mov    %ebx,%eax
+ d62:	e8 39 f9 ff ff       	call   6a0 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ d67:	8b 43 04             	mov    0x4(%ebx),%eax
+ d6a:	83 f8 02             	cmp    $0x2,%eax
+ d6d:	74 18                	je     d87 <fprintf+0x37>
+ d6f:	83 f8 01             	cmp    $0x1,%eax
+ d72:	74 0c                	je     d80 <fprintf+0x30>
+  settle(f);
+}
+ d74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d77:	c9                   	leave
+ d78:	c3                   	ret
+ d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ d80:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d83:	85 c0                	test   %eax,%eax
+ d85:	74 ed                	je     d74 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ d87:	8b 43 08             	mov    0x8(%ebx),%eax
+ d8a:	85 c0                	test   %eax,%eax
+ d8c:	7f 1a                	jg     da8 <fprintf+0x58>
+  f->n = 0;
+ d8e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ d95:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ d9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d9f:	c9                   	leave
+ da0:	c3                   	ret
+ da1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ da8:	83 ec 04             	sub    $0x4,%esp
+ dab:	50                   	push   %eax
+ dac:	8d 43 10             	lea    0x10(%ebx),%eax
+ daf:	50                   	push   %eax
+ db0:	ff 33                	push   (%ebx)
+ db2:	e8 3f f6 ff ff       	call   3f6 <write>
+  f->n = 0;
+ db7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ dbe:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ dc1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ dc8:	eb d2                	jmp    d9c <fprintf+0x4c>
+ dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000dd0 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	53                   	push   %ebx
+ dd4:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ ddd:	83 f8 0f             	cmp    $0xf,%eax
+ de0:	77 4e                	ja     e30 <printf+0x60>
+ de2:	8b 1c 85 80 17 00 00 	mov    0x1780(,%eax,4),%ebx
+ de9:	85 db                	test   %ebx,%ebx
+ deb:	74 43                	je     e30 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ ded:	8b 55 0c             	mov    0xc(%ebp),%edx
+ df0:	89 d8                	mov    %ebx,%eax
+ df2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ df5:	e8 a6 f8 ff ff       	call   6a0 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ dfa:	8b 43 08             	mov    0x8(%ebx),%eax
+ dfd:	85 c0                	test   %eax,%eax
+ dff:	7e 12                	jle    e13 <printf+0x43>
+ e01:	83 ec 04             	sub    $0x4,%esp
+ e04:	50                   	push   %eax
+ e05:	8d 43 10             	lea    0x10(%ebx),%eax
+ e08:	50                   	push   %eax
+ e09:	ff 33                	push   (%ebx)
+ e0b:	e8 e6 f5 ff ff       	call   3f6 <write>
+ e10:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ e13:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ e1a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ e21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e24:	c9                   	leave
+ e25:	c3                   	ret
+ e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ e30:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ e36:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ e3c:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ e43:	00 00 00 
+    f->n = 0;
+ e46:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ e4d:	00 00 00 
+    f->nl = 0;
+ e50:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ e57:	00 00 00 
+ e5a:	eb 91                	jmp    ded <printf+0x1d>
+ e5c:	66 90                	xchg   %ax,%ax
+ e5e:	66 90                	xchg   %ax,%ax
+
+00000e60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ e60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e61:	a1 c0 17 00 00       	mov    0x17c0,%eax
+{
+ e66:	89 e5                	mov    %esp,%ebp
+ e68:	57                   	push   %edi
+ e69:	56                   	push   %esi
+ e6a:	53                   	push   %ebx
+ e6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ e6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e7c:	39 ca                	cmp    %ecx,%edx
+ e7e:	73 30                	jae    eb0 <free+0x50>
+ e80:	39 c1                	cmp    %eax,%ecx
+ e82:	72 04                	jb     e88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e84:	39 c2                	cmp    %eax,%edx
+ e86:	72 f0                	jb     e78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ e8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ e8e:	39 f8                	cmp    %edi,%eax
+ e90:	74 2e                	je     ec0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e95:	8b 42 04             	mov    0x4(%edx),%eax
+ e98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e9b:	39 f1                	cmp    %esi,%ecx
+ e9d:	74 38                	je     ed7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ea1:	5b                   	pop    %ebx
+  freep = p;
+ ea2:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+}
+ ea8:	5e                   	pop    %esi
+ ea9:	5f                   	pop    %edi
+ eaa:	5d                   	pop    %ebp
+ eab:	c3                   	ret
+ eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ eb0:	39 c1                	cmp    %eax,%ecx
+ eb2:	72 d0                	jb     e84 <free+0x24>
+ eb4:	eb c2                	jmp    e78 <free+0x18>
+ eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ebd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ec0:	03 70 04             	add    0x4(%eax),%esi
+ ec3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ec6:	8b 02                	mov    (%edx),%eax
+ ec8:	8b 00                	mov    (%eax),%eax
+ eca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ecd:	8b 42 04             	mov    0x4(%edx),%eax
+ ed0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ed3:	39 f1                	cmp    %esi,%ecx
+ ed5:	75 c8                	jne    e9f <free+0x3f>
+    p->s.size += bp->s.size;
+ ed7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ eda:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+    p->s.size += bp->s.size;
+ ee0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ee3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ee6:	89 0a                	mov    %ecx,(%edx)
+}
+ ee8:	5b                   	pop    %ebx
+ ee9:	5e                   	pop    %esi
+ eea:	5f                   	pop    %edi
+ eeb:	5d                   	pop    %ebp
+ eec:	c3                   	ret
+ eed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ef0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ef0:	55                   	push   %ebp
+ ef1:	89 e5                	mov    %esp,%ebp
+ ef3:	57                   	push   %edi
+ ef4:	56                   	push   %esi
+ ef5:	53                   	push   %ebx
+ ef6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ efc:	8b 15 c0 17 00 00    	mov    0x17c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ f02:	8d 78 07             	lea    0x7(%eax),%edi
+ f05:	c1 ef 03             	shr    $0x3,%edi
+ f08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ f0b:	85 d2                	test   %edx,%edx
+ f0d:	0f 84 8d 00 00 00    	je     fa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ f15:	8b 48 04             	mov    0x4(%eax),%ecx
+ f18:	39 f9                	cmp    %edi,%ecx
+ f1a:	73 64                	jae    f80 <malloc+0x90>
+  if(nu < 4096)
+ f1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ f21:	39 df                	cmp    %ebx,%edi
+ f23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ f26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ f2d:	eb 0a                	jmp    f39 <malloc+0x49>
+ f2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ f32:	8b 48 04             	mov    0x4(%eax),%ecx
+ f35:	39 f9                	cmp    %edi,%ecx
+ f37:	73 47                	jae    f80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ f39:	89 c2                	mov    %eax,%edx
+ f3b:	39 05 c0 17 00 00    	cmp    %eax,0x17c0
+ f41:	75 ed                	jne    f30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ f43:	83 ec 0c             	sub    $0xc,%esp
+ f46:	56                   	push   %esi
+ f47:	e8 12 f5 ff ff       	call   45e <sbrk>
+  if(p == (char*)-1)
+ f4c:	83 c4 10             	add    $0x10,%esp
+ f4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ f52:	74 1c                	je     f70 <malloc+0x80>
+  hp->s.size = nu;
+ f54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ f57:	83 ec 0c             	sub    $0xc,%esp
+ f5a:	83 c0 08             	add    $0x8,%eax
+ f5d:	50                   	push   %eax
+ f5e:	e8 fd fe ff ff       	call   e60 <free>
+  return freep;
+ f63:	8b 15 c0 17 00 00    	mov    0x17c0,%edx
+      if((p = morecore(nunits)) == 0)
+ f69:	83 c4 10             	add    $0x10,%esp
+ f6c:	85 d2                	test   %edx,%edx
+ f6e:	75 c0                	jne    f30 <malloc+0x40>
+        return 0;
+  }
+}
+ f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ f73:	31 c0                	xor    %eax,%eax
+}
+ f75:	5b                   	pop    %ebx
+ f76:	5e                   	pop    %esi
+ f77:	5f                   	pop    %edi
+ f78:	5d                   	pop    %ebp
+ f79:	c3                   	ret
+ f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ f80:	39 cf                	cmp    %ecx,%edi
+ f82:	74 4c                	je     fd0 <malloc+0xe0>
+        p->s.size -= nunits;
+ f84:	29 f9                	sub    %edi,%ecx
+ f86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ f89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ f8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ f8f:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+}
+ f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f98:	83 c0 08             	add    $0x8,%eax
+}
+ f9b:	5b                   	pop    %ebx
+ f9c:	5e                   	pop    %esi
+ f9d:	5f                   	pop    %edi
+ f9e:	5d                   	pop    %ebp
+ f9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ fa0:	c7 05 c0 17 00 00 c4 	movl   $0x17c4,0x17c0
+ fa7:	17 00 00 
+    base.s.size = 0;
+ faa:	b8 c4 17 00 00       	mov    $0x17c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ faf:	c7 05 c4 17 00 00 c4 	movl   $0x17c4,0x17c4
+ fb6:	17 00 00 
+    base.s.size = 0;
+ fb9:	c7 05 c8 17 00 00 00 	movl   $0x0,0x17c8
+ fc0:	00 00 00 
+    if(p->s.size >= nunits){
+ fc3:	e9 54 ff ff ff       	jmp    f1c <malloc+0x2c>
+ fc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ fcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ fd0:	8b 08                	mov    (%eax),%ecx
+ fd2:	89 0a                	mov    %ecx,(%edx)
+ fd4:	eb b9                	jmp    f8f <malloc+0x9f>
@@ -117,6 +117,44 @@ sti(void)
   asm volatile("sti");
 }
 
+// Enable interrupts and halt until one arrives, then
+// disable them again. sti holds off interrupts until
+// after the next instruction, so one that is already
+// pending wakes the hlt rather than slipping in before it.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt; cli");
+}
+
+// Like stihlt, but also wake on a store to the line
+// armed by monitor.
+static inline void
+stimwait(void)
+{
+  asm volatile("sti; mwait; cli" : : "a" (0), "c" (0));
+}
+
+static inline void
+monitor(volatile void *addr)
+{
+  asm volatile("monitor" : : "a" (addr), "c" (0), "d" (0));
+}
+
+static inline void
+cpuinfo(uint leaf, uint *a, uint *b, uint *c, uint *d)
+{
+  asm volatile("cpuid" : "=a" (*a), "=b" (*b), "=c" (*c), "=d" (*d) : "a" (leaf), "c" (0));
+}
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+  return val;
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {
@@ -144,6 +182,12 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
 static inline int
 cas(volatile void* addr, int expected, int newval) {
     int result;
@@ -0,0 +1,2009 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 70 02 00 00       	call   286 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 f2 02 00 00       	call   316 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 44 02 00 00       	call   270 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 31 01 00 00       	call   29e <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 04 01 00 00       	call   2c6 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 07 01 00 00       	call   2de <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 cd 00 00 00       	call   2ae <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <exit>:
+// buffered output; set by printf.c.
+void (*exithook)(void);
+
+int
+exit(void)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	83 ec 08             	sub    $0x8,%esp
+  if(exithook)
+ 276:	a1 a0 13 00 00       	mov    0x13a0,%eax
+ 27b:	85 c0                	test   %eax,%eax
+ 27d:	74 02                	je     281 <exit+0x11>
+    exithook();
+ 27f:	ff d0                	call   *%eax
+  _exit();
+ 281:	e8 10 01 00 00       	call   396 <_exit>
+
+00000286 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 286:	b8 01 00 00 00       	mov    $0x1,%eax
+ 28b:	cd 40                	int    $0x40
+ 28d:	c3                   	ret
+
+0000028e <wait>:
+SYSCALL(wait)
+ 28e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 293:	cd 40                	int    $0x40
+ 295:	c3                   	ret
+
+00000296 <pipe>:
+SYSCALL(pipe)
+ 296:	b8 04 00 00 00       	mov    $0x4,%eax
+ 29b:	cd 40                	int    $0x40
+ 29d:	c3                   	ret
+
+0000029e <read>:
+SYSCALL(read)
+ 29e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2a3:	cd 40                	int    $0x40
+ 2a5:	c3                   	ret
+
+000002a6 <write>:
+SYSCALL(write)
+ 2a6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2ab:	cd 40                	int    $0x40
+ 2ad:	c3                   	ret
+
+000002ae <close>:
+SYSCALL(close)
+ 2ae:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2b3:	cd 40                	int    $0x40
+ 2b5:	c3                   	ret
+
+000002b6 <kill>:
+SYSCALL(kill)
+ 2b6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2bb:	cd 40                	int    $0x40
+ 2bd:	c3                   	ret
+
+000002be <exec>:
+SYSCALL(exec)
+ 2be:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2c3:	cd 40                	int    $0x40
+ 2c5:	c3                   	ret
+
+000002c6 <open>:
+SYSCALL(open)
+ 2c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+000002ce <mknod>:
+SYSCALL(mknod)
+ 2ce:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+000002d6 <unlink>:
+SYSCALL(unlink)
+ 2d6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <fstat>:
+SYSCALL(fstat)
+ 2de:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <link>:
+SYSCALL(link)
+ 2e6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <mkdir>:
+SYSCALL(mkdir)
+ 2ee:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <chdir>:
+SYSCALL(chdir)
+ 2f6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <dup>:
+SYSCALL(dup)
+ 2fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <getpid>:
+SYSCALL(getpid)
+ 306:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <sbrk>:
+SYSCALL(sbrk)
+ 30e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <sleep>:
+SYSCALL(sleep)
+ 316:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <uptime>:
+SYSCALL(uptime)
+ 31e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 326:	b8 16 00 00 00       	mov    $0x16,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <sigaction>:
+SYSCALL(sigaction)
+ 32e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <sigret>:
+SYSCALL(sigret)
+ 336:	b8 18 00 00 00       	mov    $0x18,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <readv>:
+SYSCALL(readv)
+ 33e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <writev>:
+SYSCALL(writev)
+ 346:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <nanosleep>:
+SYSCALL(nanosleep)
+ 34e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <setpriority>:
+SYSCALL(setpriority)
+ 356:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <sched_setattr>:
+SYSCALL(sched_setattr)
+ 35e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <sched_yield>:
+SYSCALL(sched_yield)
+ 366:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 36e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 376:	b8 20 00 00 00       	mov    $0x20,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <getrusage>:
+SYSCALL(getrusage)
+ 37e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <syslat>:
+SYSCALL(syslat)
+ 386:	b8 22 00 00 00       	mov    $0x22,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <sched_getattr>:
+SYSCALL(sched_getattr)
+ 38e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <_exit>:
+
+// The exit system call; exit() in ulib.c flushes output first.
+.globl _exit
+_exit:
+  movl $SYS_exit, %eax
+ 396:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+ 39b:	cd 40                	int    $0x40
+  ret
+ 39d:	c3                   	ret
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <flushall>:
+
+static FILE *streams[NOFILE];
+
+static void
+flushall(void)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 3a5:	31 db                	xor    %ebx,%ebx
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    if(streams[fd])
+ 3b0:	8b 34 9d c0 13 00 00 	mov    0x13c0(,%ebx,4),%esi
+ 3b7:	85 f6                	test   %esi,%esi
+ 3b9:	74 27                	je     3e2 <flushall+0x42>
+fflush(FILE *f)
+{
+  int r;
+
+  r = 0;
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 3bb:	8b 46 08             	mov    0x8(%esi),%eax
+ 3be:	85 c0                	test   %eax,%eax
+ 3c0:	7e 12                	jle    3d4 <flushall+0x34>
+ 3c2:	83 ec 04             	sub    $0x4,%esp
+ 3c5:	50                   	push   %eax
+ 3c6:	8d 46 10             	lea    0x10(%esi),%eax
+ 3c9:	50                   	push   %eax
+ 3ca:	ff 36                	push   (%esi)
+ 3cc:	e8 d5 fe ff ff       	call   2a6 <write>
+ 3d1:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+  f->n = 0;
+ 3d4:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ 3db:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  for(fd = 0; fd < NOFILE; fd++)
+ 3e2:	83 c3 01             	add    $0x1,%ebx
+ 3e5:	83 fb 10             	cmp    $0x10,%ebx
+ 3e8:	75 c6                	jne    3b0 <flushall+0x10>
+}
+ 3ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5d                   	pop    %ebp
+ 3f0:	c3                   	ret
+ 3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <printint>:
+  return n;
+}
+
+static void
+printint(FILE *f, int xx, int base, int sgn)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 408:	89 d1                	mov    %edx,%ecx
+{
+ 40a:	83 ec 2c             	sub    $0x2c,%esp
+ 40d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(sgn && xx < 0){
+ 410:	85 d2                	test   %edx,%edx
+ 412:	0f 89 c8 00 00 00    	jns    4e0 <printint+0xe0>
+ 418:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 41c:	0f 84 be 00 00 00    	je     4e0 <printint+0xe0>
+    x = -xx;
+ 422:	f7 d9                	neg    %ecx
+    neg = 1;
+ 424:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 429:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 42c:	31 f6                	xor    %esi,%esi
+ 42e:	66 90                	xchg   %ax,%ax
+  do{
+    buf[i++] = digits[x % base];
+ 430:	89 c8                	mov    %ecx,%eax
+ 432:	31 d2                	xor    %edx,%edx
+ 434:	89 f7                	mov    %esi,%edi
+ 436:	f7 f3                	div    %ebx
+ 438:	8d 76 01             	lea    0x1(%esi),%esi
+ 43b:	0f b6 92 e8 0e 00 00 	movzbl 0xee8(%edx),%edx
+ 442:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 446:	89 ca                	mov    %ecx,%edx
+ 448:	89 c1                	mov    %eax,%ecx
+ 44a:	39 da                	cmp    %ebx,%edx
+ 44c:	73 e2                	jae    430 <printint+0x30>
+  if(neg)
+ 44e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 451:	85 c0                	test   %eax,%eax
+ 453:	74 07                	je     45c <printint+0x5c>
+    buf[i++] = '-';
+ 455:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 45a:	89 f7                	mov    %esi,%edi
+  if(f->n == BUFSIZ)
+ 45c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 45f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 462:	01 df                	add    %ebx,%edi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 464:	8d 71 10             	lea    0x10(%ecx),%esi
+  if(f->n == BUFSIZ)
+ 467:	8b 41 08             	mov    0x8(%ecx),%eax
+ 46a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 46d:	89 ce                	mov    %ecx,%esi
+ 46f:	eb 28                	jmp    499 <printint+0x99>
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  f->buf[f->n++] = c;
+ 478:	89 c1                	mov    %eax,%ecx
+ 47a:	83 c0 01             	add    $0x1,%eax
+ 47d:	89 46 08             	mov    %eax,0x8(%esi)
+ 480:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 484:	80 fa 0a             	cmp    $0xa,%dl
+ 487:	75 07                	jne    490 <printint+0x90>
+    f->nl = 1;
+ 489:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+
+  while(--i >= 0)
+ 490:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 493:	39 fb                	cmp    %edi,%ebx
+ 495:	74 39                	je     4d0 <printint+0xd0>
+ 497:	89 d7                	mov    %edx,%edi
+    bputc(f, buf[i]);
+ 499:	0f b6 17             	movzbl (%edi),%edx
+  if(f->n == BUFSIZ)
+ 49c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 4a1:	75 d5                	jne    478 <printint+0x78>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 4a3:	83 ec 04             	sub    $0x4,%esp
+ 4a6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+ 4a9:	68 00 02 00 00       	push   $0x200
+ 4ae:	ff 75 d0             	push   -0x30(%ebp)
+ 4b1:	ff 36                	push   (%esi)
+ 4b3:	e8 ee fd ff ff       	call   2a6 <write>
+  return r;
+ 4b8:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+ 4bc:	83 c4 10             	add    $0x10,%esp
+ 4bf:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 4c1:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 4c8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4cd:	eb ae                	jmp    47d <printint+0x7d>
+ 4cf:	90                   	nop
+}
+ 4d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4d3:	5b                   	pop    %ebx
+ 4d4:	5e                   	pop    %esi
+ 4d5:	5f                   	pop    %edi
+ 4d6:	5d                   	pop    %ebp
+ 4d7:	c3                   	ret
+ 4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+  neg = 0;
+ 4e0:	31 c0                	xor    %eax,%eax
+ 4e2:	e9 42 ff ff ff       	jmp    429 <printint+0x29>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <bputc>:
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	53                   	push   %ebx
+ 4f4:	89 c3                	mov    %eax,%ebx
+ 4f6:	83 ec 14             	sub    $0x14,%esp
+  if(f->n == BUFSIZ)
+ 4f9:	8b 40 08             	mov    0x8(%eax),%eax
+ 4fc:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 501:	74 1d                	je     520 <bputc+0x30>
+  f->buf[f->n++] = c;
+ 503:	8d 48 01             	lea    0x1(%eax),%ecx
+ 506:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 509:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 50d:	80 fa 0a             	cmp    $0xa,%dl
+ 510:	75 07                	jne    519 <bputc+0x29>
+    f->nl = 1;
+ 512:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+}
+ 519:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 51c:	c9                   	leave
+ 51d:	c3                   	ret
+ 51e:	66 90                	xchg   %ax,%ax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	8d 43 10             	lea    0x10(%ebx),%eax
+ 526:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 529:	68 00 02 00 00       	push   $0x200
+ 52e:	50                   	push   %eax
+ 52f:	ff 33                	push   (%ebx)
+ 531:	e8 70 fd ff ff       	call   2a6 <write>
+  return r;
+ 536:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 539:	83 c4 10             	add    $0x10,%esp
+ 53c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ 541:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ 548:	31 c0                	xor    %eax,%eax
+ 54a:	eb ba                	jmp    506 <bputc+0x16>
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <vfprintf>:
+
+// Format to f. Only understands %d, %x, %p, %s, %c.
+static void
+vfprintf(FILE *f, const char *fmt, uint *ap)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 1c             	sub    $0x1c,%esp
+ 559:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  char *s;
+  int c, i, state;
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 55c:	0f b6 0a             	movzbl (%edx),%ecx
+ 55f:	84 c9                	test   %cl,%cl
+ 561:	74 47                	je     5aa <vfprintf+0x5a>
+ 563:	8d 5a 01             	lea    0x1(%edx),%ebx
+ 566:	89 c7                	mov    %eax,%edi
+ 568:	31 d2                	xor    %edx,%edx
+ 56a:	89 de                	mov    %ebx,%esi
+ 56c:	89 cb                	mov    %ecx,%ebx
+ 56e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+ 570:	0f be cb             	movsbl %bl,%ecx
+ 573:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 576:	85 d2                	test   %edx,%edx
+ 578:	75 4e                	jne    5c8 <vfprintf+0x78>
+      if(c == '%'){
+ 57a:	83 f8 25             	cmp    $0x25,%eax
+ 57d:	74 69                	je     5e8 <vfprintf+0x98>
+  if(f->n == BUFSIZ)
+ 57f:	8b 47 08             	mov    0x8(%edi),%eax
+ 582:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 587:	0f 84 73 01 00 00    	je     700 <vfprintf+0x1b0>
+  f->buf[f->n++] = c;
+ 58d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 590:	89 4f 08             	mov    %ecx,0x8(%edi)
+ 593:	88 5c 07 10          	mov    %bl,0x10(%edi,%eax,1)
+  if(c == '\n')
+ 597:	80 fb 0a             	cmp    $0xa,%bl
+ 59a:	74 1c                	je     5b8 <vfprintf+0x68>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        bputc(f, '%');
+        bputc(f, c);
+      }
+      state = 0;
+ 59c:	31 d2                	xor    %edx,%edx
+ 59e:	66 90                	xchg   %ax,%ax
+  for(i = 0; fmt[i]; i++){
+ 5a0:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a3:	83 c6 01             	add    $0x1,%esi
+ 5a6:	84 db                	test   %bl,%bl
+ 5a8:	75 c6                	jne    570 <vfprintf+0x20>
+    }
+  }
+}
+ 5aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ad:	5b                   	pop    %ebx
+ 5ae:	5e                   	pop    %esi
+ 5af:	5f                   	pop    %edi
+ 5b0:	5d                   	pop    %ebp
+ 5b1:	c3                   	ret
+ 5b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    f->nl = 1;
+ 5b8:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+ 5bf:	eb df                	jmp    5a0 <vfprintf+0x50>
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    } else if(state == '%'){
+ 5c8:	83 fa 25             	cmp    $0x25,%edx
+ 5cb:	75 d3                	jne    5a0 <vfprintf+0x50>
+      if(c == 'd'){
+ 5cd:	83 f8 25             	cmp    $0x25,%eax
+ 5d0:	74 37                	je     609 <vfprintf+0xb9>
+ 5d2:	83 e8 63             	sub    $0x63,%eax
+ 5d5:	83 f8 15             	cmp    $0x15,%eax
+ 5d8:	77 16                	ja     5f0 <vfprintf+0xa0>
+ 5da:	ff 24 85 90 0e 00 00 	jmp    *0xe90(,%eax,4)
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        state = '%';
+ 5e8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5ed:	eb b1                	jmp    5a0 <vfprintf+0x50>
+ 5ef:	90                   	nop
+  if(f->n == BUFSIZ)
+ 5f0:	8b 47 08             	mov    0x8(%edi),%eax
+ 5f3:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 5f8:	0f 84 4c 01 00 00    	je     74a <vfprintf+0x1fa>
+  f->buf[f->n++] = c;
+ 5fe:	8d 50 01             	lea    0x1(%eax),%edx
+ 601:	89 57 08             	mov    %edx,0x8(%edi)
+ 604:	c6 44 07 10 25       	movb   $0x25,0x10(%edi,%eax,1)
+        bputc(f, c);
+ 609:	89 ca                	mov    %ecx,%edx
+ 60b:	89 f8                	mov    %edi,%eax
+ 60d:	e8 de fe ff ff       	call   4f0 <bputc>
+ 612:	eb 88                	jmp    59c <vfprintf+0x4c>
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(f, *ap, 16, 0);
+ 618:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 61b:	83 ec 0c             	sub    $0xc,%esp
+ 61e:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 623:	8b 13                	mov    (%ebx),%edx
+ 625:	6a 00                	push   $0x0
+ 627:	89 f8                	mov    %edi,%eax
+        ap++;
+ 629:	83 c3 04             	add    $0x4,%ebx
+        printint(f, *ap, 16, 0);
+ 62c:	e8 cf fd ff ff       	call   400 <printint>
+        ap++;
+ 631:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+ 634:	83 c4 10             	add    $0x10,%esp
+ 637:	e9 60 ff ff ff       	jmp    59c <vfprintf+0x4c>
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        s = (char*)*ap;
+ 640:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 643:	8b 10                	mov    (%eax),%edx
+        ap++;
+ 645:	83 c0 04             	add    $0x4,%eax
+ 648:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 64b:	85 d2                	test   %edx,%edx
+ 64d:	0f 84 dd 00 00 00    	je     730 <vfprintf+0x1e0>
+        while(*s != 0){
+ 653:	0f b6 1a             	movzbl (%edx),%ebx
+ 656:	84 db                	test   %bl,%bl
+ 658:	0f 84 3e ff ff ff    	je     59c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 65e:	8d 4f 10             	lea    0x10(%edi),%ecx
+ 661:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  if(f->n == BUFSIZ)
+ 664:	8b 47 08             	mov    0x8(%edi),%eax
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 667:	89 fe                	mov    %edi,%esi
+ 669:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 66c:	89 d7                	mov    %edx,%edi
+ 66e:	eb 27                	jmp    697 <vfprintf+0x147>
+  f->buf[f->n++] = c;
+ 670:	89 c1                	mov    %eax,%ecx
+ 672:	83 c0 01             	add    $0x1,%eax
+ 675:	89 46 08             	mov    %eax,0x8(%esi)
+ 678:	88 5c 0e 10          	mov    %bl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ 67c:	80 fb 0a             	cmp    $0xa,%bl
+ 67f:	75 07                	jne    688 <vfprintf+0x138>
+    f->nl = 1;
+ 681:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+        while(*s != 0){
+ 688:	0f b6 5f 01          	movzbl 0x1(%edi),%ebx
+          s++;
+ 68c:	83 c7 01             	add    $0x1,%edi
+        while(*s != 0){
+ 68f:	84 db                	test   %bl,%bl
+ 691:	0f 84 a9 00 00 00    	je     740 <vfprintf+0x1f0>
+  if(f->n == BUFSIZ)
+ 697:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 69c:	75 d2                	jne    670 <vfprintf+0x120>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 69e:	83 ec 04             	sub    $0x4,%esp
+ 6a1:	68 00 02 00 00       	push   $0x200
+ 6a6:	ff 75 e0             	push   -0x20(%ebp)
+ 6a9:	ff 36                	push   (%esi)
+ 6ab:	e8 f6 fb ff ff       	call   2a6 <write>
+  return r;
+ 6b0:	83 c4 10             	add    $0x10,%esp
+ 6b3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6b8:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ 6ba:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ 6c1:	eb b2                	jmp    675 <vfprintf+0x125>
+ 6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6c7:	90                   	nop
+        printint(f, *ap, 10, 1);
+ 6c8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 6cb:	83 ec 0c             	sub    $0xc,%esp
+ 6ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6d3:	8b 13                	mov    (%ebx),%edx
+ 6d5:	6a 01                	push   $0x1
+ 6d7:	e9 4b ff ff ff       	jmp    627 <vfprintf+0xd7>
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        bputc(f, *ap);
+ 6e0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 6e3:	89 f8                	mov    %edi,%eax
+ 6e5:	0f be 13             	movsbl (%ebx),%edx
+        ap++;
+ 6e8:	83 c3 04             	add    $0x4,%ebx
+        bputc(f, *ap);
+ 6eb:	e8 00 fe ff ff       	call   4f0 <bputc>
+        ap++;
+ 6f0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      state = 0;
+ 6f3:	31 d2                	xor    %edx,%edx
+ 6f5:	e9 a6 fe ff ff       	jmp    5a0 <vfprintf+0x50>
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	8d 47 10             	lea    0x10(%edi),%eax
+ 706:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 709:	68 00 02 00 00       	push   $0x200
+ 70e:	50                   	push   %eax
+ 70f:	ff 37                	push   (%edi)
+ 711:	e8 90 fb ff ff       	call   2a6 <write>
+  return r;
+ 716:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 71e:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 725:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 72a:	e9 61 fe ff ff       	jmp    590 <vfprintf+0x40>
+ 72f:	90                   	nop
+          s = "(null)";
+ 730:	ba 88 0e 00 00       	mov    $0xe88,%edx
+ 735:	bb 28 00 00 00       	mov    $0x28,%ebx
+ 73a:	e9 1f ff ff ff       	jmp    65e <vfprintf+0x10e>
+ 73f:	90                   	nop
+ 740:	89 f7                	mov    %esi,%edi
+ 742:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 745:	e9 52 fe ff ff       	jmp    59c <vfprintf+0x4c>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 74a:	83 ec 04             	sub    $0x4,%esp
+ 74d:	8d 47 10             	lea    0x10(%edi),%eax
+ 750:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ 753:	68 00 02 00 00       	push   $0x200
+ 758:	50                   	push   %eax
+ 759:	ff 37                	push   (%edi)
+ 75b:	e8 46 fb ff ff       	call   2a6 <write>
+  return r;
+ 760:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 763:	83 c4 10             	add    $0x10,%esp
+ 766:	ba 01 00 00 00       	mov    $0x1,%edx
+  f->nl = 0;
+ 76b:	c7 47 0c 00 00 00 00 	movl   $0x0,0xc(%edi)
+  return r;
+ 772:	31 c0                	xor    %eax,%eax
+ 774:	e9 88 fe ff ff       	jmp    601 <vfprintf+0xb1>
+ 779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <fdopen>:
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	56                   	push   %esi
+ 784:	53                   	push   %ebx
+ 785:	83 ec 20             	sub    $0x20,%esp
+ 788:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(fd < 0 || fd >= NOFILE)
+ 78b:	83 fe 0f             	cmp    $0xf,%esi
+ 78e:	0f 87 84 00 00 00    	ja     818 <fdopen+0x98>
+  if(streams[fd])
+ 794:	8b 1c b5 c0 13 00 00 	mov    0x13c0(,%esi,4),%ebx
+ 79b:	85 db                	test   %ebx,%ebx
+ 79d:	74 11                	je     7b0 <fdopen+0x30>
+}
+ 79f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7a2:	89 d8                	mov    %ebx,%eax
+ 7a4:	5b                   	pop    %ebx
+ 7a5:	5e                   	pop    %esi
+ 7a6:	5d                   	pop    %ebp
+ 7a7:	c3                   	ret
+ 7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+  if((f = malloc(sizeof(*f))) == 0)
+ 7b0:	83 ec 0c             	sub    $0xc,%esp
+ 7b3:	68 10 02 00 00       	push   $0x210
+ 7b8:	e8 e3 05 00 00       	call   da0 <malloc>
+ 7bd:	83 c4 10             	add    $0x10,%esp
+ 7c0:	89 c3                	mov    %eax,%ebx
+ 7c2:	85 c0                	test   %eax,%eax
+ 7c4:	74 52                	je     818 <fdopen+0x98>
+  f->fd = fd;
+ 7c6:	89 30                	mov    %esi,(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 7c8:	83 ec 08             	sub    $0x8,%esp
+  f->n = 0;
+ 7cb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  f->nl = 0;
+ 7d2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  f->mode = _IOFBF;
+ 7d9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  if(fstat(fd, &st) == 0 && st.type == T_DEV)
+ 7e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 7e3:	50                   	push   %eax
+ 7e4:	56                   	push   %esi
+ 7e5:	e8 f4 fa ff ff       	call   2de <fstat>
+ 7ea:	83 c4 10             	add    $0x10,%esp
+ 7ed:	85 c0                	test   %eax,%eax
+ 7ef:	75 07                	jne    7f8 <fdopen+0x78>
+ 7f1:	66 83 7d e4 03       	cmpw   $0x3,-0x1c(%ebp)
+ 7f6:	74 30                	je     828 <fdopen+0xa8>
+  streams[fd] = f;
+ 7f8:	89 1c b5 c0 13 00 00 	mov    %ebx,0x13c0(,%esi,4)
+}
+ 7ff:	89 d8                	mov    %ebx,%eax
+  exithook = flushall;
+ 801:	c7 05 a0 13 00 00 a0 	movl   $0x3a0,0x13a0
+ 808:	03 00 00 
+}
+ 80b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 80e:	5b                   	pop    %ebx
+ 80f:	5e                   	pop    %esi
+ 810:	5d                   	pop    %ebp
+ 811:	c3                   	ret
+ 812:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 818:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+ 81b:	31 db                	xor    %ebx,%ebx
+}
+ 81d:	89 d8                	mov    %ebx,%eax
+ 81f:	5b                   	pop    %ebx
+ 820:	5e                   	pop    %esi
+ 821:	5d                   	pop    %ebp
+ 822:	c3                   	ret
+ 823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 827:	90                   	nop
+    f->mode = _IOLBF;
+ 828:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+ 82f:	eb c7                	jmp    7f8 <fdopen+0x78>
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+
+00000840 <fopen>:
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	53                   	push   %ebx
+ 844:	83 ec 0c             	sub    $0xc,%esp
+  if((fd = open(path, omode)) < 0)
+ 847:	ff 75 0c             	push   0xc(%ebp)
+ 84a:	ff 75 08             	push   0x8(%ebp)
+ 84d:	e8 74 fa ff ff       	call   2c6 <open>
+ 852:	83 c4 10             	add    $0x10,%esp
+ 855:	85 c0                	test   %eax,%eax
+ 857:	78 37                	js     890 <fopen+0x50>
+ 859:	89 c3                	mov    %eax,%ebx
+  if(streams[fd]){
+ 85b:	8b 04 85 c0 13 00 00 	mov    0x13c0(,%eax,4),%eax
+ 862:	85 c0                	test   %eax,%eax
+ 864:	74 17                	je     87d <fopen+0x3d>
+    free(streams[fd]);
+ 866:	83 ec 0c             	sub    $0xc,%esp
+ 869:	50                   	push   %eax
+ 86a:	e8 a1 04 00 00       	call   d10 <free>
+    streams[fd] = 0;
+ 86f:	83 c4 10             	add    $0x10,%esp
+ 872:	c7 04 9d c0 13 00 00 	movl   $0x0,0x13c0(,%ebx,4)
+ 879:	00 00 00 00 
+  return fdopen(fd);
+ 87d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 880:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 883:	c9                   	leave
+  return fdopen(fd);
+ 884:	e9 f7 fe ff ff       	jmp    780 <fdopen>
+ 889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 890:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 893:	31 c0                	xor    %eax,%eax
+ 895:	c9                   	leave
+ 896:	c3                   	ret
+ 897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89e:	66 90                	xchg   %ax,%ax
+
+000008a0 <setvbuf>:
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	56                   	push   %esi
+ 8a4:	53                   	push   %ebx
+ 8a5:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 8a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(mode != _IOFBF && mode != _IOLBF && mode != _IONBF)
+ 8ab:	83 fe 02             	cmp    $0x2,%esi
+ 8ae:	77 38                	ja     8e8 <setvbuf+0x48>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 8b0:	8b 43 08             	mov    0x8(%ebx),%eax
+ 8b3:	85 c0                	test   %eax,%eax
+ 8b5:	7e 12                	jle    8c9 <setvbuf+0x29>
+ 8b7:	83 ec 04             	sub    $0x4,%esp
+ 8ba:	50                   	push   %eax
+ 8bb:	8d 43 10             	lea    0x10(%ebx),%eax
+ 8be:	50                   	push   %eax
+ 8bf:	ff 33                	push   (%ebx)
+ 8c1:	e8 e0 f9 ff ff       	call   2a6 <write>
+ 8c6:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ 8c9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return 0;
+ 8d0:	31 c0                	xor    %eax,%eax
+  f->nl = 0;
+ 8d2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  f->mode = mode;
+ 8d9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+ 8dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8df:	5b                   	pop    %ebx
+ 8e0:	5e                   	pop    %esi
+ 8e1:	5d                   	pop    %ebp
+ 8e2:	c3                   	ret
+ 8e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8e7:	90                   	nop
+    return -1;
+ 8e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 8ed:	eb ed                	jmp    8dc <setvbuf+0x3c>
+ 8ef:	90                   	nop
+
+000008f0 <fflush>:
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	31 c0                	xor    %eax,%eax
+ 8f3:	89 e5                	mov    %esp,%ebp
+ 8f5:	53                   	push   %ebx
+ 8f6:	83 ec 04             	sub    $0x4,%esp
+ 8f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 8fc:	8b 53 08             	mov    0x8(%ebx),%edx
+ 8ff:	85 d2                	test   %edx,%edx
+ 901:	7e 1d                	jle    920 <fflush+0x30>
+ 903:	83 ec 04             	sub    $0x4,%esp
+ 906:	8d 43 10             	lea    0x10(%ebx),%eax
+ 909:	52                   	push   %edx
+ 90a:	50                   	push   %eax
+ 90b:	ff 33                	push   (%ebx)
+ 90d:	e8 94 f9 ff ff       	call   2a6 <write>
+ 912:	83 c4 10             	add    $0x10,%esp
+ 915:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 918:	0f 95 c0             	setne  %al
+ 91b:	0f b6 c0             	movzbl %al,%eax
+ 91e:	f7 d8                	neg    %eax
+  f->n = 0;
+ 920:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 927:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 92e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 931:	c9                   	leave
+ 932:	c3                   	ret
+ 933:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000940 <fclose>:
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	56                   	push   %esi
+ 944:	31 f6                	xor    %esi,%esi
+ 946:	53                   	push   %ebx
+ 947:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ 94a:	8b 43 08             	mov    0x8(%ebx),%eax
+ 94d:	85 c0                	test   %eax,%eax
+ 94f:	7e 1f                	jle    970 <fclose+0x30>
+ 951:	83 ec 04             	sub    $0x4,%esp
+ 954:	50                   	push   %eax
+ 955:	8d 43 10             	lea    0x10(%ebx),%eax
+ 958:	50                   	push   %eax
+ 959:	ff 33                	push   (%ebx)
+ 95b:	e8 46 f9 ff ff       	call   2a6 <write>
+ 960:	83 c4 10             	add    $0x10,%esp
+ 963:	39 43 08             	cmp    %eax,0x8(%ebx)
+ 966:	0f 95 c0             	setne  %al
+ 969:	0f b6 c0             	movzbl %al,%eax
+ 96c:	f7 d8                	neg    %eax
+ 96e:	89 c6                	mov    %eax,%esi
+  if(close(f->fd) < 0)
+ 970:	83 ec 0c             	sub    $0xc,%esp
+  f->n = 0;
+ 973:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ 97a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  if(close(f->fd) < 0)
+ 981:	ff 33                	push   (%ebx)
+ 983:	e8 26 f9 ff ff       	call   2ae <close>
+ 988:	83 c4 10             	add    $0x10,%esp
+    r = -1;
+ 98b:	85 c0                	test   %eax,%eax
+ 98d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 992:	0f 48 f0             	cmovs  %eax,%esi
+  if(f->fd >= 0 && f->fd < NOFILE && streams[f->fd] == f){
+ 995:	8b 03                	mov    (%ebx),%eax
+ 997:	83 f8 0f             	cmp    $0xf,%eax
+ 99a:	77 09                	ja     9a5 <fclose+0x65>
+ 99c:	39 1c 85 c0 13 00 00 	cmp    %ebx,0x13c0(,%eax,4)
+ 9a3:	74 0b                	je     9b0 <fclose+0x70>
+}
+ 9a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9a8:	89 f0                	mov    %esi,%eax
+ 9aa:	5b                   	pop    %ebx
+ 9ab:	5e                   	pop    %esi
+ 9ac:	5d                   	pop    %ebp
+ 9ad:	c3                   	ret
+ 9ae:	66 90                	xchg   %ax,%ax
+    streams[f->fd] = 0;
+ 9b0:	c7 04 85 c0 13 00 00 	movl   $0x0,0x13c0(,%eax,4)
+ 9b7:	00 00 00 00 
+    free(f);
+ 9bb:	83 ec 0c             	sub    $0xc,%esp
+ 9be:	53                   	push   %ebx
+ 9bf:	e8 4c 03 00 00       	call   d10 <free>
+ 9c4:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 9c7:	eb dc                	jmp    9a5 <fclose+0x65>
+ 9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <fputc>:
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	53                   	push   %ebx
+ 9d4:	83 ec 04             	sub    $0x4,%esp
+ 9d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 9da:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(f->n == BUFSIZ)
+ 9dd:	8b 43 08             	mov    0x8(%ebx),%eax
+ 9e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 9e5:	74 59                	je     a40 <fputc+0x70>
+  f->buf[f->n++] = c;
+ 9e7:	8d 48 01             	lea    0x1(%eax),%ecx
+ 9ea:	89 4b 08             	mov    %ecx,0x8(%ebx)
+ 9ed:	88 54 03 10          	mov    %dl,0x10(%ebx,%eax,1)
+  if(c == '\n')
+ 9f1:	80 fa 0a             	cmp    $0xa,%dl
+ 9f4:	75 07                	jne    9fd <fputc+0x2d>
+    f->nl = 1;
+ 9f6:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ 9fd:	8b 43 04             	mov    0x4(%ebx),%eax
+ a00:	83 f8 02             	cmp    $0x2,%eax
+ a03:	74 1a                	je     a1f <fputc+0x4f>
+ a05:	83 f8 01             	cmp    $0x1,%eax
+ a08:	74 0e                	je     a18 <fputc+0x48>
+}
+ a0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a0d:	0f b6 c2             	movzbl %dl,%eax
+}
+ a10:	c9                   	leave
+ a11:	c3                   	ret
+ a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ a18:	8b 43 0c             	mov    0xc(%ebx),%eax
+ a1b:	85 c0                	test   %eax,%eax
+ a1d:	74 eb                	je     a0a <fputc+0x3a>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a1f:	85 c9                	test   %ecx,%ecx
+ a21:	7f 4d                	jg     a70 <fputc+0xa0>
+  f->n = 0;
+ a23:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ a2a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ a31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return c & 0xff;
+ a34:	0f b6 c2             	movzbl %dl,%eax
+}
+ a37:	c9                   	leave
+ a38:	c3                   	ret
+ a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	8d 43 10             	lea    0x10(%ebx),%eax
+ a46:	89 55 08             	mov    %edx,0x8(%ebp)
+ a49:	68 00 02 00 00       	push   $0x200
+ a4e:	50                   	push   %eax
+ a4f:	ff 33                	push   (%ebx)
+ a51:	e8 50 f8 ff ff       	call   2a6 <write>
+  return r;
+ a56:	8b 55 08             	mov    0x8(%ebp),%edx
+ a59:	83 c4 10             	add    $0x10,%esp
+ a5c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  f->nl = 0;
+ a61:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ a68:	31 c0                	xor    %eax,%eax
+ a6a:	e9 7b ff ff ff       	jmp    9ea <fputc+0x1a>
+ a6f:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	8d 43 10             	lea    0x10(%ebx),%eax
+ a76:	89 55 08             	mov    %edx,0x8(%ebp)
+ a79:	51                   	push   %ecx
+ a7a:	50                   	push   %eax
+ a7b:	ff 33                	push   (%ebx)
+ a7d:	e8 24 f8 ff ff       	call   2a6 <write>
+  f->n = 0;
+ a82:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ a89:	8b 55 08             	mov    0x8(%ebp),%edx
+  f->nl = 0;
+ a8c:	83 c4 10             	add    $0x10,%esp
+ a8f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ a96:	eb 99                	jmp    a31 <fputc+0x61>
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+
+00000aa0 <fwrite>:
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 1c             	sub    $0x1c,%esp
+ aa9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  len = size * n;
+ aac:	8b 7d 10             	mov    0x10(%ebp),%edi
+{
+ aaf:	8b 75 14             	mov    0x14(%ebp),%esi
+  len = size * n;
+ ab2:	0f af fb             	imul   %ebx,%edi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ ab5:	81 ff ff 01 00 00    	cmp    $0x1ff,%edi
+ abb:	0f 8f af 00 00 00    	jg     b70 <fwrite+0xd0>
+  for(i = 0; i < len; i++)
+ ac1:	85 ff                	test   %edi,%edi
+ ac3:	7e 73                	jle    b38 <fwrite+0x98>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ ac5:	8d 56 10             	lea    0x10(%esi),%edx
+ ac8:	8b 46 08             	mov    0x8(%esi),%eax
+ acb:	31 db                	xor    %ebx,%ebx
+ acd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ ad0:	eb 25                	jmp    af7 <fwrite+0x57>
+ ad2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  f->buf[f->n++] = c;
+ ad8:	89 c1                	mov    %eax,%ecx
+ ada:	83 c0 01             	add    $0x1,%eax
+ add:	89 46 08             	mov    %eax,0x8(%esi)
+ ae0:	88 54 0e 10          	mov    %dl,0x10(%esi,%ecx,1)
+  if(c == '\n')
+ ae4:	80 fa 0a             	cmp    $0xa,%dl
+ ae7:	75 07                	jne    af0 <fwrite+0x50>
+    f->nl = 1;
+ ae9:	c7 46 0c 01 00 00 00 	movl   $0x1,0xc(%esi)
+  for(i = 0; i < len; i++)
+ af0:	83 c3 01             	add    $0x1,%ebx
+ af3:	39 df                	cmp    %ebx,%edi
+ af5:	7e 41                	jle    b38 <fwrite+0x98>
+    bputc(f, s[i]);
+ af7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ afa:	0f b6 14 19          	movzbl (%ecx,%ebx,1),%edx
+  if(f->n == BUFSIZ)
+ afe:	3d 00 02 00 00       	cmp    $0x200,%eax
+ b03:	75 d3                	jne    ad8 <fwrite+0x38>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b05:	83 ec 04             	sub    $0x4,%esp
+ b08:	88 55 e7             	mov    %dl,-0x19(%ebp)
+ b0b:	68 00 02 00 00       	push   $0x200
+ b10:	ff 75 e0             	push   -0x20(%ebp)
+ b13:	ff 36                	push   (%esi)
+ b15:	e8 8c f7 ff ff       	call   2a6 <write>
+  return r;
+ b1a:	0f b6 55 e7          	movzbl -0x19(%ebp),%edx
+ b1e:	83 c4 10             	add    $0x10,%esp
+ b21:	31 c9                	xor    %ecx,%ecx
+  f->nl = 0;
+ b23:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ b2a:	b8 01 00 00 00       	mov    $0x1,%eax
+ b2f:	eb ac                	jmp    add <fwrite+0x3d>
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ b38:	8b 46 04             	mov    0x4(%esi),%eax
+ b3b:	83 f8 02             	cmp    $0x2,%eax
+ b3e:	74 0c                	je     b4c <fwrite+0xac>
+ b40:	83 f8 01             	cmp    $0x1,%eax
+ b43:	75 1c                	jne    b61 <fwrite+0xc1>
+ b45:	8b 46 0c             	mov    0xc(%esi),%eax
+ b48:	85 c0                	test   %eax,%eax
+ b4a:	74 15                	je     b61 <fwrite+0xc1>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b4c:	8b 46 08             	mov    0x8(%esi),%eax
+ b4f:	85 c0                	test   %eax,%eax
+ b51:	7f 5d                	jg     bb0 <fwrite+0x110>
+  f->n = 0;
+ b53:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ b5a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return n;
+ b61:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+ b64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b67:	5b                   	pop    %ebx
+ b68:	5e                   	pop    %esi
+ b69:	5f                   	pop    %edi
+ b6a:	5d                   	pop    %ebp
+ b6b:	c3                   	ret
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(len >= BUFSIZ && f->mode != _IOLBF){
+ b70:	83 7e 04 01          	cmpl   $0x1,0x4(%esi)
+ b74:	0f 84 4b ff ff ff    	je     ac5 <fwrite+0x25>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ b7a:	8b 46 08             	mov    0x8(%esi),%eax
+ b7d:	8b 16                	mov    (%esi),%edx
+ b7f:	85 c0                	test   %eax,%eax
+ b81:	7f 45                	jg     bc8 <fwrite+0x128>
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ b83:	83 ec 04             	sub    $0x4,%esp
+  f->n = 0;
+ b86:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ b8d:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(fflush(f) < 0 || (i = write(f->fd, s, len)) < 0)
+ b94:	57                   	push   %edi
+ b95:	ff 75 08             	push   0x8(%ebp)
+ b98:	ff 36                	push   (%esi)
+ b9a:	e8 07 f7 ff ff       	call   2a6 <write>
+    return size > 0 ? i / size : 0;
+ b9f:	83 c4 10             	add    $0x10,%esp
+ ba2:	85 c0                	test   %eax,%eax
+ ba4:	78 4a                	js     bf0 <fwrite+0x150>
+ ba6:	85 db                	test   %ebx,%ebx
+ ba8:	7e 46                	jle    bf0 <fwrite+0x150>
+ baa:	99                   	cltd
+ bab:	f7 fb                	idiv   %ebx
+ bad:	eb b5                	jmp    b64 <fwrite+0xc4>
+ baf:	90                   	nop
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ bb0:	83 ec 04             	sub    $0x4,%esp
+ bb3:	50                   	push   %eax
+ bb4:	8d 46 10             	lea    0x10(%esi),%eax
+ bb7:	50                   	push   %eax
+ bb8:	ff 36                	push   (%esi)
+ bba:	e8 e7 f6 ff ff       	call   2a6 <write>
+ bbf:	83 c4 10             	add    $0x10,%esp
+ bc2:	eb 8f                	jmp    b53 <fwrite+0xb3>
+ bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bc8:	83 ec 04             	sub    $0x4,%esp
+ bcb:	50                   	push   %eax
+ bcc:	8d 46 10             	lea    0x10(%esi),%eax
+ bcf:	50                   	push   %eax
+ bd0:	52                   	push   %edx
+ bd1:	e8 d0 f6 ff ff       	call   2a6 <write>
+ bd6:	83 c4 10             	add    $0x10,%esp
+ bd9:	3b 46 08             	cmp    0x8(%esi),%eax
+ bdc:	74 a5                	je     b83 <fwrite+0xe3>
+  f->n = 0;
+ bde:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  f->nl = 0;
+ be5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  return r;
+ bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return 0;
+ bf0:	31 c0                	xor    %eax,%eax
+ bf2:	e9 6d ff ff ff       	jmp    b64 <fwrite+0xc4>
+ bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfe:	66 90                	xchg   %ax,%ax
+
+00000c00 <fprintf>:
+
+// Print to the given stream.
+void
+fprintf(FILE *f, const char *fmt, ...)
+{
+ c00:	55                   	push   %ebp
+ c01:	89 e5                	mov    %esp,%ebp
+ c03:	53                   	push   %ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c04:	8d 4d 10             	lea    0x10(%ebp),%ecx
+{
+ c07:	83 ec 04             	sub    $0x4,%esp
+ c0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c10:	89 d8                	mov    %ebx,%eax
+ c12:	e8 39 f9 ff ff       	call   550 <vfprintf>
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c17:	8b 43 04             	mov    0x4(%ebx),%eax
+ c1a:	83 f8 02             	cmp    $0x2,%eax
+ c1d:	74 18                	je     c37 <fprintf+0x37>
+ c1f:	83 f8 01             	cmp    $0x1,%eax
+ c22:	74 0c                	je     c30 <fprintf+0x30>
+  settle(f);
+}
+ c24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c27:	c9                   	leave
+ c28:	c3                   	ret
+ c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->mode == _IONBF || (f->mode == _IOLBF && f->nl))
+ c30:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c33:	85 c0                	test   %eax,%eax
+ c35:	74 ed                	je     c24 <fprintf+0x24>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c37:	8b 43 08             	mov    0x8(%ebx),%eax
+ c3a:	85 c0                	test   %eax,%eax
+ c3c:	7f 1a                	jg     c58 <fprintf+0x58>
+  f->n = 0;
+ c3e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ c45:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ c4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ c4f:	c9                   	leave
+ c50:	c3                   	ret
+ c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ c58:	83 ec 04             	sub    $0x4,%esp
+ c5b:	50                   	push   %eax
+ c5c:	8d 43 10             	lea    0x10(%ebx),%eax
+ c5f:	50                   	push   %eax
+ c60:	ff 33                	push   (%ebx)
+ c62:	e8 3f f6 ff ff       	call   2a6 <write>
+  f->n = 0;
+ c67:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+ c6e:	83 c4 10             	add    $0x10,%esp
+  f->nl = 0;
+ c71:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  return r;
+ c78:	eb d2                	jmp    c4c <fprintf+0x4c>
+ c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c80 <printf>:
+// Print to the given fd, with a single write() unless the
+// output is longer than a buffer. Output buffered in a
+// stream for fd is written first.
+void
+printf(int fd, const char *fmt, ...)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	53                   	push   %ebx
+ c84:	81 ec 14 02 00 00    	sub    $0x214,%esp
+ c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  FILE tmp, *f;
+
+  if(fd >= 0 && fd < NOFILE && streams[fd])
+ c8d:	83 f8 0f             	cmp    $0xf,%eax
+ c90:	77 4e                	ja     ce0 <printf+0x60>
+ c92:	8b 1c 85 c0 13 00 00 	mov    0x13c0(,%eax,4),%ebx
+ c99:	85 db                	test   %ebx,%ebx
+ c9b:	74 43                	je     ce0 <printf+0x60>
+    f->fd = fd;
+    f->mode = _IOFBF;
+    f->n = 0;
+    f->nl = 0;
+  }
+  vfprintf(f, fmt, (uint*)(void*)&fmt + 1);
+ c9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ca0:	89 d8                	mov    %ebx,%eax
+ ca2:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ ca5:	e8 a6 f8 ff ff       	call   550 <vfprintf>
+  if(f->n > 0 && write(f->fd, f->buf, f->n) != f->n)
+ caa:	8b 43 08             	mov    0x8(%ebx),%eax
+ cad:	85 c0                	test   %eax,%eax
+ caf:	7e 12                	jle    cc3 <printf+0x43>
+ cb1:	83 ec 04             	sub    $0x4,%esp
+ cb4:	50                   	push   %eax
+ cb5:	8d 43 10             	lea    0x10(%ebx),%eax
+ cb8:	50                   	push   %eax
+ cb9:	ff 33                	push   (%ebx)
+ cbb:	e8 e6 f5 ff ff       	call   2a6 <write>
+ cc0:	83 c4 10             	add    $0x10,%esp
+  f->n = 0;
+ cc3:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  f->nl = 0;
+ cca:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  fflush(f);
+}
+ cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ cd4:	c9                   	leave
+ cd5:	c3                   	ret
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    f->fd = fd;
+ ce0:	89 85 e8 fd ff ff    	mov    %eax,-0x218(%ebp)
+    f = &tmp;
+ ce6:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+    f->mode = _IOFBF;
+ cec:	c7 85 ec fd ff ff 00 	movl   $0x0,-0x214(%ebp)
+ cf3:	00 00 00 
+    f->n = 0;
+ cf6:	c7 85 f0 fd ff ff 00 	movl   $0x0,-0x210(%ebp)
+ cfd:	00 00 00 
+    f->nl = 0;
+ d00:	c7 85 f4 fd ff ff 00 	movl   $0x0,-0x20c(%ebp)
+ d07:	00 00 00 
+ d0a:	eb 91                	jmp    c9d <printf+0x1d>
+ d0c:	66 90                	xchg   %ax,%ax
+ d0e:	66 90                	xchg   %ax,%ax
+
+00000d10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d11:	a1 00 14 00 00       	mov    0x1400,%eax
+{
+ d16:	89 e5                	mov    %esp,%ebp
+ d18:	57                   	push   %edi
+ d19:	56                   	push   %esi
+ d1a:	53                   	push   %ebx
+ d1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d1e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d28:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d2a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d2c:	39 ca                	cmp    %ecx,%edx
+ d2e:	73 30                	jae    d60 <free+0x50>
+ d30:	39 c1                	cmp    %eax,%ecx
+ d32:	72 04                	jb     d38 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d34:	39 c2                	cmp    %eax,%edx
+ d36:	72 f0                	jb     d28 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d38:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d3b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d3e:	39 f8                	cmp    %edi,%eax
+ d40:	74 2e                	je     d70 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d42:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d45:	8b 42 04             	mov    0x4(%edx),%eax
+ d48:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d4b:	39 f1                	cmp    %esi,%ecx
+ d4d:	74 38                	je     d87 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d4f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d51:	5b                   	pop    %ebx
+  freep = p;
+ d52:	89 15 00 14 00 00    	mov    %edx,0x1400
+}
+ d58:	5e                   	pop    %esi
+ d59:	5f                   	pop    %edi
+ d5a:	5d                   	pop    %ebp
+ d5b:	c3                   	ret
+ d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d60:	39 c1                	cmp    %eax,%ecx
+ d62:	72 d0                	jb     d34 <free+0x24>
+ d64:	eb c2                	jmp    d28 <free+0x18>
+ d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d70:	03 70 04             	add    0x4(%eax),%esi
+ d73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d76:	8b 02                	mov    (%edx),%eax
+ d78:	8b 00                	mov    (%eax),%eax
+ d7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d7d:	8b 42 04             	mov    0x4(%edx),%eax
+ d80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d83:	39 f1                	cmp    %esi,%ecx
+ d85:	75 c8                	jne    d4f <free+0x3f>
+    p->s.size += bp->s.size;
+ d87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d8a:	89 15 00 14 00 00    	mov    %edx,0x1400
+    p->s.size += bp->s.size;
+ d90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d96:	89 0a                	mov    %ecx,(%edx)
+}
+ d98:	5b                   	pop    %ebx
+ d99:	5e                   	pop    %esi
+ d9a:	5f                   	pop    %edi
+ d9b:	5d                   	pop    %ebp
+ d9c:	c3                   	ret
+ d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000da0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	57                   	push   %edi
+ da4:	56                   	push   %esi
+ da5:	53                   	push   %ebx
+ da6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dac:	8b 15 00 14 00 00    	mov    0x1400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ db2:	8d 78 07             	lea    0x7(%eax),%edi
+ db5:	c1 ef 03             	shr    $0x3,%edi
+ db8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ dbb:	85 d2                	test   %edx,%edx
+ dbd:	0f 84 8d 00 00 00    	je     e50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dc3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ dc5:	8b 48 04             	mov    0x4(%eax),%ecx
+ dc8:	39 f9                	cmp    %edi,%ecx
+ dca:	73 64                	jae    e30 <malloc+0x90>
+  if(nu < 4096)
+ dcc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ dd1:	39 df                	cmp    %ebx,%edi
+ dd3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ dd6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ddd:	eb 0a                	jmp    de9 <malloc+0x49>
+ ddf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ de0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ de2:	8b 48 04             	mov    0x4(%eax),%ecx
+ de5:	39 f9                	cmp    %edi,%ecx
+ de7:	73 47                	jae    e30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ de9:	89 c2                	mov    %eax,%edx
+ deb:	39 05 00 14 00 00    	cmp    %eax,0x1400
+ df1:	75 ed                	jne    de0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ df3:	83 ec 0c             	sub    $0xc,%esp
+ df6:	56                   	push   %esi
+ df7:	e8 12 f5 ff ff       	call   30e <sbrk>
+  if(p == (char*)-1)
+ dfc:	83 c4 10             	add    $0x10,%esp
+ dff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e02:	74 1c                	je     e20 <malloc+0x80>
+  hp->s.size = nu;
+ e04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e07:	83 ec 0c             	sub    $0xc,%esp
+ e0a:	83 c0 08             	add    $0x8,%eax
+ e0d:	50                   	push   %eax
+ e0e:	e8 fd fe ff ff       	call   d10 <free>
+  return freep;
+ e13:	8b 15 00 14 00 00    	mov    0x1400,%edx
+      if((p = morecore(nunits)) == 0)
+ e19:	83 c4 10             	add    $0x10,%esp
+ e1c:	85 d2                	test   %edx,%edx
+ e1e:	75 c0                	jne    de0 <malloc+0x40>
+        return 0;
+  }
+}
+ e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e23:	31 c0                	xor    %eax,%eax
+}
+ e25:	5b                   	pop    %ebx
+ e26:	5e                   	pop    %esi
+ e27:	5f                   	pop    %edi
+ e28:	5d                   	pop    %ebp
+ e29:	c3                   	ret
+ e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e30:	39 cf                	cmp    %ecx,%edi
+ e32:	74 4c                	je     e80 <malloc+0xe0>
+        p->s.size -= nunits;
+ e34:	29 f9                	sub    %edi,%ecx
+ e36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e3f:	89 15 00 14 00 00    	mov    %edx,0x1400
+}
+ e45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e48:	83 c0 08             	add    $0x8,%eax
+}
+ e4b:	5b                   	pop    %ebx
+ e4c:	5e                   	pop    %esi
+ e4d:	5f                   	pop    %edi
+ e4e:	5d                   	pop    %ebp
+ e4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e50:	c7 05 00 14 00 00 04 	movl   $0x1404,0x1400
+ e57:	14 00 00 
+    base.s.size = 0;
+ e5a:	b8 04 14 00 00       	mov    $0x1404,%eax
+    base.s.ptr = freep = prevp = &base;
+ e5f:	c7 05 04 14 00 00 04 	movl   $0x1404,0x1404
+ e66:	14 00 00 
+    base.s.size = 0;
+ e69:	c7 05 08 14 00 00 00 	movl   $0x0,0x1408
+ e70:	00 00 00 
+    if(p->s.size >= nunits){
+ e73:	e9 54 ff ff ff       	jmp    dcc <malloc+0x2c>
+ e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e80:	8b 08                	mov    (%eax),%ecx
+ e82:	89 0a                	mov    %ecx,(%edx)
+ e84:	eb b9                	jmp    e3f <malloc+0x9f>